@@ -0,0 +1,689 @@
+// allocbench.m.cpp                                                   -*-C++-*-
+
+// ----------------------------------------------------------------------------
+//                                   NOTICE
+//
+// This program is a benchmark, not a component: it is built on its own (see
+// 'README.md') and is not part of any package group.
+// ----------------------------------------------------------------------------
+
+//@PURPOSE: Measure the throughput and footprint of BDE allocators.
+//
+//@DESCRIPTION: This program runs a set of container workloads against each of
+// several allocators and reports, for each combination, the number of
+// container operations per second and the peak resident set size (RSS)
+// observed while the containers were fully populated.
+//
+// The allocators measured are:
+//: o 'bslma::NewDeleteAllocator'
+//: o the default allocator ('bslma::Default::defaultAllocator()')
+//: o 'bdlma::SequentialAllocator'
+//: o 'bdlma::MultipoolAllocator'
+//: o 'bdlma::ConcurrentMultipoolAllocator'
+//: o 'bdlma::ThreadCachingMultipoolAllocator'
+//: o 'bdlma::LocalSequentialAllocator<16384>'
+//
+// The workloads are:
+//: 'vector':        'push_back' 'n' integers into a 'bsl::vector'
+//: 'list':          'push_back' 'n' integers into a 'bsl::list', erase every
+//:                  other element, and 'push_front' 'n / 2' more
+//: 'map':           insert 'n' random keys into a 'bsl::map', then erase
+//:                  'n / 2' random keys
+//: 'unordered_map': as 'map', for 'bsl::unordered_map'
+//: 'strings':       'push_back' 'n' strings of 16 to 271 characters into a
+//:                  'bsl::vector<bsl::string>'
+//
+// Each workload is run in one or both of two modes:
+//: 'local':  each thread creates a new allocator for every iteration, so that
+//:           all memory is returned when the allocator is destroyed (the
+//:           typical use of a sequential or multipool allocator)
+//: 'shared': all threads share one allocator for the whole run (the typical
+//:           use of the new/delete or default allocator); allocators that are
+//:           not thread-safe are skipped in this mode when there is more than
+//:           one thread, with a note written to 'stderr'
+//
+// RSS is sampled by the first thread when its containers are fully populated.
+// Because memory freed to the C library is not necessarily returned to the
+// operating system, RSS measured after an earlier configuration in the same
+// process is an upper bound; use the '-w' and '-a' options to measure one
+// configuration per process when precise footprints are needed.
+//
+///Usage
+///-----
+//..
+//  allocbench [-w workload] [-a allocator] [-m local|shared]
+//             [-t numThreads] [-n numElements] [-i numIterations]
+//..
+// Each of '-w', '-a', and '-m' may be repeated; if one is not given, all of
+// its values are run.  By default, 1 thread runs 20 iterations on 10000
+// elements.  Explicitly requesting both an allocator that is not thread-safe
+// and 'shared' mode with more than one thread is an error.
+
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_list.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+using namespace BloombergLP;
+
+namespace {
+
+// ============================================================================
+//                              CONFIGURATION
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64 Int64;
+
+enum AllocatorId {
+    e_NEW_DELETE,
+    e_DEFAULT,
+    e_SEQUENTIAL,
+    e_MULTIPOOL,
+    e_CONCURRENT_MULTIPOOL,
+    e_THREAD_CACHING_MULTIPOOL,
+    e_LOCAL_SEQUENTIAL,
+    k_NUM_ALLOCATORS
+};
+
+enum WorkloadId {
+    e_VECTOR,
+    e_LIST,
+    e_MAP,
+    e_UNORDERED_MAP,
+    e_STRINGS,
+    k_NUM_WORKLOADS
+};
+
+enum ModeId {
+    e_LOCAL,
+    e_SHARED,
+    k_NUM_MODES
+};
+
+const struct {
+    const char *d_option;      // name used on the command line
+    const char *d_name;        // name used in the report
+    bool        d_threadSafe;  // 'true' if usable by concurrent threads
+} ALLOCATORS[k_NUM_ALLOCATORS] = {
+    { "newdelete",     "bslma::NewDeleteAllocator",              true  },
+    { "default",       "default allocator",                      true  },
+    { "sequential",    "bdlma::SequentialAllocator",             false },
+    { "multipool",     "bdlma::MultipoolAllocator",              false },
+    { "concurrent",    "bdlma::ConcurrentMultipoolAllocator",    true  },
+    { "threadcaching", "bdlma::ThreadCachingMultipoolAllocator", true  },
+    { "local",         "bdlma::LocalSequentialAllocator",        false },
+};
+
+const char *const WORKLOADS[k_NUM_WORKLOADS] = {
+    "vector", "list", "map", "unordered_map", "strings"
+};
+
+const char *const MODES[k_NUM_MODES] = { "local", "shared" };
+
+enum { k_LOCAL_BUFFER_SIZE = 16384 };
+
+struct Config {
+    // This 'struct' describes one measurement.
+
+    AllocatorId d_allocator;
+    WorkloadId  d_workload;
+    ModeId      d_mode;
+    int         d_numThreads;
+    int         d_numElements;
+    int         d_numIterations;
+};
+
+// ============================================================================
+//                            RESIDENT SET SIZE
+// ----------------------------------------------------------------------------
+
+Int64 residentSetSize()
+    // Return the current resident set size of this process in bytes, or, on
+    // platforms where only the peak is available, the peak resident set
+    // size.  Return 0 if neither is available.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    FILE *file = bsl::fopen("/proc/self/statm", "r");
+    if (file) {
+        long size     = 0;
+        long resident = 0;
+        const int rc  = bsl::fscanf(file, "%ld %ld", &size, &resident);
+        bsl::fclose(file);
+        if (2 == rc) {
+            return static_cast<Int64>(resident) * sysconf(_SC_PAGESIZE);
+                                                                      // RETURN
+        }
+    }
+#endif
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    struct rusage usage;
+    if (0 == getrusage(RUSAGE_SELF, &usage)) {
+#if defined(BSLS_PLATFORM_OS_DARWIN)
+        return static_cast<Int64>(usage.ru_maxrss);                   // RETURN
+#else
+        return static_cast<Int64>(usage.ru_maxrss) * 1024;            // RETURN
+#endif
+    }
+#endif
+    return 0;
+}
+
+// ============================================================================
+//                                WORKLOADS
+// ----------------------------------------------------------------------------
+
+unsigned int nextRandom(unsigned int *state)
+    // Return the next value of the linear congruential generator whose state
+    // is at the specified 'state' address.
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+Int64 runWorkload(WorkloadId        workload,
+                  bslma::Allocator *allocator,
+                  int               numElements,
+                  unsigned int      seed,
+                  Int64            *peakRss)
+    // Run the specified 'workload' on the specified 'numElements' using the
+    // specified 'allocator', with random keys generated from the specified
+    // 'seed', and return the number of container operations performed.  If
+    // the specified 'peakRss' is not 0, update it with the resident set size
+    // when the containers are fully populated, if larger.
+{
+    unsigned int state = seed;
+    Int64        numOps = 0;
+    Int64        rss    = 0;
+
+    switch (workload) {
+      case e_VECTOR: {
+        bsl::vector<int> v(allocator);
+        for (int i = 0; i < numElements; ++i) {
+            v.push_back(i);
+        }
+        numOps = numElements;
+        rss    = peakRss ? residentSetSize() : 0;
+      } break;
+      case e_LIST: {
+        bsl::list<int> l(allocator);
+        for (int i = 0; i < numElements; ++i) {
+            l.push_back(i);
+        }
+        for (bsl::list<int>::iterator it = l.begin(); it != l.end(); ) {
+            it = l.erase(it);
+            if (it != l.end()) {
+                ++it;
+            }
+        }
+        for (int i = 0; i < numElements / 2; ++i) {
+            l.push_front(i);
+        }
+        numOps = 2 * static_cast<Int64>(numElements);
+        rss    = peakRss ? residentSetSize() : 0;
+      } break;
+      case e_MAP: {
+        bsl::map<int, int> m(allocator);
+        const unsigned int range = 4 * static_cast<unsigned int>(numElements);
+        for (int i = 0; i < numElements; ++i) {
+            m[static_cast<int>(nextRandom(&state) % range)] = i;
+        }
+        rss = peakRss ? residentSetSize() : 0;
+        for (int i = 0; i < numElements / 2; ++i) {
+            m.erase(static_cast<int>(nextRandom(&state) % range));
+        }
+        numOps = numElements + numElements / 2;
+      } break;
+      case e_UNORDERED_MAP: {
+        bsl::unordered_map<int, int> m(allocator);
+        const unsigned int range = 4 * static_cast<unsigned int>(numElements);
+        for (int i = 0; i < numElements; ++i) {
+            m[static_cast<int>(nextRandom(&state) % range)] = i;
+        }
+        rss = peakRss ? residentSetSize() : 0;
+        for (int i = 0; i < numElements / 2; ++i) {
+            m.erase(static_cast<int>(nextRandom(&state) % range));
+        }
+        numOps = numElements + numElements / 2;
+      } break;
+      case e_STRINGS: {
+        bsl::vector<bsl::string> v(allocator);
+        for (int i = 0; i < numElements; ++i) {
+            v.push_back(bsl::string(16 + nextRandom(&state) % 256, 'x'));
+        }
+        numOps = numElements;
+        rss    = peakRss ? residentSetSize() : 0;
+      } break;
+      default: {
+        BSLS_ASSERT_INVOKE_NORETURN("unreachable");
+      }
+    }
+
+    if (peakRss && rss > *peakRss) {
+        *peakRss = rss;
+    }
+    return numOps;
+}
+
+Int64 runWithLocalAllocator(const Config& config,
+                            unsigned int  seed,
+                            Int64        *peakRss)
+    // Run the workload of the specified 'config' once with a newly created
+    // allocator of the kind specified by 'config', using the specified 'seed'
+    // and 'peakRss' as for 'runWorkload', and return the number of container
+    // operations performed.
+{
+    const WorkloadId w = config.d_workload;
+    const int        n = config.d_numElements;
+
+    switch (config.d_allocator) {
+      case e_NEW_DELETE: {
+        return runWorkload(w,
+                           &bslma::NewDeleteAllocator::singleton(),
+                           n,
+                           seed,
+                           peakRss);                                  // RETURN
+      }
+      case e_DEFAULT: {
+        return runWorkload(w,
+                           bslma::Default::defaultAllocator(),
+                           n,
+                           seed,
+                           peakRss);                                  // RETURN
+      }
+      case e_SEQUENTIAL: {
+        bdlma::SequentialAllocator allocator;
+        return runWorkload(w, &allocator, n, seed, peakRss);          // RETURN
+      }
+      case e_MULTIPOOL: {
+        bdlma::MultipoolAllocator allocator;
+        return runWorkload(w, &allocator, n, seed, peakRss);          // RETURN
+      }
+      case e_CONCURRENT_MULTIPOOL: {
+        bdlma::ConcurrentMultipoolAllocator allocator;
+        return runWorkload(w, &allocator, n, seed, peakRss);          // RETURN
+      }
+      case e_THREAD_CACHING_MULTIPOOL: {
+        bdlma::ThreadCachingMultipoolAllocator allocator;
+        return runWorkload(w, &allocator, n, seed, peakRss);          // RETURN
+      }
+      case e_LOCAL_SEQUENTIAL: {
+        bdlma::LocalSequentialAllocator<k_LOCAL_BUFFER_SIZE> allocator;
+        return runWorkload(w, &allocator, n, seed, peakRss);          // RETURN
+      }
+      default: {
+        BSLS_ASSERT_INVOKE_NORETURN("unreachable");
+      }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                                 THREADS
+// ----------------------------------------------------------------------------
+
+class Worker {
+    // This class provides the body of one benchmark thread.
+
+    // DATA
+    const Config     *d_config_p;     // measurement to run
+    bslma::Allocator *d_shared_p;     // shared allocator, or 0 in local mode
+    bslmt::Barrier   *d_barrier_p;    // start barrier
+    Int64            *d_numOps_p;     // number of operations performed
+    Int64            *d_startTime_p;  // start time in nanoseconds
+    Int64            *d_endTime_p;    // end time in nanoseconds
+    Int64            *d_peakRss_p;    // peak RSS, or 0 if not sampling
+    unsigned int      d_seed;         // seed for random keys
+
+  public:
+    // CREATORS
+    Worker(const Config     *config,
+           bslma::Allocator *shared,
+           bslmt::Barrier   *barrier,
+           Int64            *numOps,
+           Int64            *startTime,
+           Int64            *endTime,
+           Int64            *peakRss,
+           unsigned int      seed)
+    : d_config_p(config)
+    , d_shared_p(shared)
+    , d_barrier_p(barrier)
+    , d_numOps_p(numOps)
+    , d_startTime_p(startTime)
+    , d_endTime_p(endTime)
+    , d_peakRss_p(peakRss)
+    , d_seed(seed)
+    {
+    }
+
+    // MANIPULATORS
+    void operator()()
+        // Wait for all threads to start, then run the configured number of
+        // iterations, recording the start and end times.
+    {
+        d_barrier_p->wait();
+        *d_startTime_p = bsls::TimeUtil::getTimer();
+
+        Int64 numOps = 0;
+        for (int i = 0; i < d_config_p->d_numIterations; ++i) {
+            const unsigned int seed = d_seed + static_cast<unsigned int>(i);
+            if (d_shared_p) {
+                numOps += runWorkload(d_config_p->d_workload,
+                                      d_shared_p,
+                                      d_config_p->d_numElements,
+                                      seed,
+                                      d_peakRss_p);
+            }
+            else {
+                numOps += runWithLocalAllocator(*d_config_p,
+                                                seed,
+                                                d_peakRss_p);
+            }
+        }
+        *d_endTime_p = bsls::TimeUtil::getTimer();
+        *d_numOps_p  = numOps;
+    }
+};
+
+void runShared(const Config&     config,
+               bslma::Allocator *shared,
+               double           *opsPerSecond,
+               Int64            *peakRss)
+    // Run the specified 'config' on 'config.d_numThreads' threads, sharing
+    // the specified 'shared' allocator if it is not 0, and load the resulting
+    // throughput and peak resident set size into the specified
+    // 'opsPerSecond' and 'peakRss'.
+{
+    const int          numThreads = config.d_numThreads;
+    bsl::vector<Int64> numOps(numThreads, 0);
+    bsl::vector<Int64> startTimes(numThreads, 0);
+    bsl::vector<Int64> endTimes(numThreads, 0);
+    bslmt::Barrier     barrier(numThreads);
+    bslmt::ThreadGroup threads;
+
+    *peakRss = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        threads.addThread(Worker(&config,
+                                 shared,
+                                 &barrier,
+                                 &numOps[i],
+                                 &startTimes[i],
+                                 &endTimes[i],
+                                 0 == i ? peakRss : 0,
+                                 static_cast<unsigned int>(i) * 7919u));
+    }
+
+    threads.joinAll();
+
+    // The elapsed time runs from the first thread starting to the last
+    // finishing.
+
+    Int64 totalOps  = 0;
+    Int64 startTime = startTimes[0];
+    Int64 endTime   = endTimes[0];
+    for (int i = 0; i < numThreads; ++i) {
+        totalOps  += numOps[i];
+        startTime  = bsl::min(startTime, startTimes[i]);
+        endTime    = bsl::max(endTime, endTimes[i]);
+    }
+    *opsPerSecond = static_cast<double>(totalOps) * 1e9
+                  / static_cast<double>(bsl::max<Int64>(endTime - startTime,
+                                                        1));
+}
+
+void runConfig(const Config& config)
+    // Run the specified 'config' and print a line reporting the results.
+{
+    double opsPerSecond = 0;
+    Int64  peakRss      = 0;
+
+    if (e_LOCAL == config.d_mode) {
+        runShared(config, 0, &opsPerSecond, &peakRss);
+    }
+    else {
+        // The shared allocator lives for the whole run.
+
+        switch (config.d_allocator) {
+          case e_NEW_DELETE: {
+            runShared(config,
+                      &bslma::NewDeleteAllocator::singleton(),
+                      &opsPerSecond,
+                      &peakRss);
+          } break;
+          case e_DEFAULT: {
+            runShared(config,
+                      bslma::Default::defaultAllocator(),
+                      &opsPerSecond,
+                      &peakRss);
+          } break;
+          case e_SEQUENTIAL: {
+            bdlma::SequentialAllocator allocator;
+            runShared(config, &allocator, &opsPerSecond, &peakRss);
+          } break;
+          case e_MULTIPOOL: {
+            bdlma::MultipoolAllocator allocator;
+            runShared(config, &allocator, &opsPerSecond, &peakRss);
+          } break;
+          case e_CONCURRENT_MULTIPOOL: {
+            bdlma::ConcurrentMultipoolAllocator allocator;
+            runShared(config, &allocator, &opsPerSecond, &peakRss);
+          } break;
+          case e_THREAD_CACHING_MULTIPOOL: {
+            bdlma::ThreadCachingMultipoolAllocator allocator;
+            runShared(config, &allocator, &opsPerSecond, &peakRss);
+          } break;
+          case e_LOCAL_SEQUENTIAL: {
+            bdlma::LocalSequentialAllocator<k_LOCAL_BUFFER_SIZE> allocator;
+            runShared(config, &allocator, &opsPerSecond, &peakRss);
+          } break;
+          default: {
+            BSLS_ASSERT_INVOKE_NORETURN("unreachable");
+          }
+        }
+    }
+
+    bsl::printf("%-14s %-38s %-7s %7d %14.0f %10.1f\n",
+                WORKLOADS[config.d_workload],
+                ALLOCATORS[config.d_allocator].d_name,
+                MODES[config.d_mode],
+                config.d_numThreads,
+                opsPerSecond,
+                static_cast<double>(peakRss) / (1024 * 1024));
+    bsl::fflush(stdout);
+}
+
+// ============================================================================
+//                             COMMAND LINE
+// ----------------------------------------------------------------------------
+
+void usage(const char *program)
+    // Print the command-line usage of the specified 'program' to 'stderr'.
+{
+    bsl::fprintf(stderr,
+                 "usage: %s [-w workload] [-a allocator] [-m local|shared]\n"
+                 "       [-t numThreads] [-n numElements] "
+                 "[-i numIterations]\n",
+                 program);
+    bsl::fprintf(stderr, "workloads:");
+    for (int i = 0; i < k_NUM_WORKLOADS; ++i) {
+        bsl::fprintf(stderr, " %s", WORKLOADS[i]);
+    }
+    bsl::fprintf(stderr, "\nallocators:");
+    for (int i = 0; i < k_NUM_ALLOCATORS; ++i) {
+        bsl::fprintf(stderr, " %s", ALLOCATORS[i].d_option);
+    }
+    bsl::fprintf(stderr, "\n");
+}
+
+int parsePositive(const char *text)
+    // Return the positive integer in the specified 'text', or 0 if 'text'
+    // does not hold one.
+{
+    char       *end   = 0;
+    const long  value = bsl::strtol(text, &end, 10);
+    return *end || value <= 0 || value > 1000000000 ? 0
+                                                    : static_cast<int>(value);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    bool useAllocator[k_NUM_ALLOCATORS] = { false };
+    bool useWorkload[k_NUM_WORKLOADS]   = { false };
+    bool useMode[k_NUM_MODES]           = { false };
+    bool anyAllocator = false;
+    bool anyWorkload  = false;
+    bool anyMode      = false;
+
+    Config config;
+    config.d_numThreads    = 1;
+    config.d_numElements   = 10000;
+    config.d_numIterations = 20;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *option = argv[i];
+        const char *value  = i + 1 < argc ? argv[i + 1] : 0;
+        bool        valid  = false;
+
+        if (value && 0 == bsl::strcmp(option, "-a")) {
+            for (int j = 0; j < k_NUM_ALLOCATORS; ++j) {
+                if (0 == bsl::strcmp(value, ALLOCATORS[j].d_option)) {
+                    useAllocator[j] = anyAllocator = valid = true;
+                }
+            }
+        }
+        else if (value && 0 == bsl::strcmp(option, "-w")) {
+            for (int j = 0; j < k_NUM_WORKLOADS; ++j) {
+                if (0 == bsl::strcmp(value, WORKLOADS[j])) {
+                    useWorkload[j] = anyWorkload = valid = true;
+                }
+            }
+        }
+        else if (value && 0 == bsl::strcmp(option, "-m")) {
+            for (int j = 0; j < k_NUM_MODES; ++j) {
+                if (0 == bsl::strcmp(value, MODES[j])) {
+                    useMode[j] = anyMode = valid = true;
+                }
+            }
+        }
+        else if (value && 0 == bsl::strcmp(option, "-t")) {
+            config.d_numThreads = parsePositive(value);
+            valid               = 0 != config.d_numThreads;
+        }
+        else if (value && 0 == bsl::strcmp(option, "-n")) {
+            config.d_numElements = parsePositive(value);
+            valid                = 0 != config.d_numElements;
+        }
+        else if (value && 0 == bsl::strcmp(option, "-i")) {
+            config.d_numIterations = parsePositive(value);
+            valid                  = 0 != config.d_numIterations;
+        }
+
+        if (!valid) {
+            usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+        ++i;
+    }
+
+    if (anyMode && useMode[e_SHARED] && 1 < config.d_numThreads) {
+        for (int a = 0; a < k_NUM_ALLOCATORS; ++a) {
+            if (useAllocator[a] && !ALLOCATORS[a].d_threadSafe) {
+                bsl::fprintf(stderr,
+                             "%s: allocator '%s' is not thread-safe and cannot"
+                             " be shared by %d threads\n",
+                             argv[0],
+                             ALLOCATORS[a].d_option,
+                             config.d_numThreads);
+                return 1;                                             // RETURN
+            }
+        }
+    }
+
+    bsl::printf("%-14s %-38s %-7s %7s %14s %10s\n",
+                "workload",
+                "allocator",
+                "mode",
+                "threads",
+                "ops/sec",
+                "RSS (MiB)");
+
+    for (int w = 0; w < k_NUM_WORKLOADS; ++w) {
+        if (anyWorkload && !useWorkload[w]) {
+            continue;
+        }
+        for (int m = 0; m < k_NUM_MODES; ++m) {
+            if (anyMode && !useMode[m]) {
+                continue;
+            }
+            for (int a = 0; a < k_NUM_ALLOCATORS; ++a) {
+                if (anyAllocator && !useAllocator[a]) {
+                    continue;
+                }
+                if (e_SHARED == m
+                 && 1 < config.d_numThreads
+                 && !ALLOCATORS[a].d_threadSafe) {
+                    bsl::fprintf(stderr,
+                                 "skipping %s with allocator '%s' in shared"
+                                 " mode: not thread-safe\n",
+                                 WORKLOADS[w],
+                                 ALLOCATORS[a].d_option);
+                    continue;
+                }
+                config.d_allocator = static_cast<AllocatorId>(a);
+                config.d_workload  = static_cast<WorkloadId>(w);
+                config.d_mode      = static_cast<ModeId>(m);
+                runConfig(config);
+            }
+        }
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -15,11 +15,20 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, 'baljsn::Decoder', for
 // decoding value-semantic objects in the JSON format.  In particular, the
 // 'class' contains a parameterized 'decode' function that decodes an object
-// from a specified stream.  There are two overloaded versions of this
+// from a specified input.  There are four overloaded versions of this
 // function:
 //
 //: o one that reads from a 'bsl::streambuf'
 //: o one that reads from a 'bsl::istream'
+//: o one that reads from a contiguous block of memory ('bslstl::StringRef')
+//: o one that reads from a 'bdlbb::Blob'
+//
+// The versions that read from a stream copy the input, a block at a time,
+// into an internal buffer of the decoder.  If the JSON data is already in
+// memory, it is more efficient to supply it as a 'bslstl::StringRef' (or as a
+// 'bdlbb::Blob' having a single data buffer): the data is then tokenized in
+// place, and element names and values that are not copied into the decoded
+// object are never copied at all.
 //
 // This component can be used with types that support the 'bdeat' framework
 // (see the 'bdeat' package for details), which is a compile-time interface for
@@ -141,6 +150,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_printmethods.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
 #include <bdlma_localsequentialallocator.h>
 
 #include <bslmf_assert.h>
@@ -214,6 +226,13 @@ class Decoder {
         // formatting mode as specified in 'bdlat_FormattingMode'.  Note that
         // 'ANY_CATEGORY' shall be a tag-type defined in 'bdlat_TypeCategory'.
 
+    template <class TYPE>
+    int decodeDocument(TYPE *value, const DecoderOptions& options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data read by the tokenizer owned by this object, which has
+        // been reset to its input, using the specified 'options'.  Return 0 on
+        // success, and a non-zero value otherwise.
+
     int skipUnknownElement(const bslstl::StringRef& elementName);
         // Skip the unknown element specified by 'elementName' by discarding
         // all the data associated with it and advancing the parser to the next
@@ -269,6 +288,45 @@ class Decoder {
         // if decoding is successful, will attempt to update the input position
         // of 'stream' to the last unprocessed byte.
 
+    template <class TYPE>
+    int decode(const bslstl::StringRef&  input,
+               TYPE                     *value,
+               const DecoderOptions&     options);
+    template <class TYPE>
+    int decode(const bslstl::StringRef&  input,
+               TYPE                     *value,
+               const DecoderOptions     *options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the specified 'input' and using the specified
+        // 'options'.  Specifying a nullptr 'options' is equivalent to passing
+        // a default-constructed DecoderOptions in 'options'.  'TYPE' shall be
+        // a 'bdeat'-compatible sequence, choice, or array type, or a
+        // 'bdeat'-compatible dynamic type referring to one of those types.
+        // Return 0 on success, and a non-zero value otherwise.  Note that
+        // 'input' is tokenized in place rather than copied into an internal
+        // buffer.  Also note that any data following the decoded JSON value
+        // in 'input' is ignored.
+
+    template <class TYPE>
+    int decode(const bdlbb::Blob&     blob,
+               TYPE                  *value,
+               const DecoderOptions&  options);
+    template <class TYPE>
+    int decode(const bdlbb::Blob&     blob,
+               TYPE                  *value,
+               const DecoderOptions  *options);
+        // Decode into the specified 'value', of a (template parameter) 'TYPE',
+        // the JSON data in the specified 'blob' and using the specified
+        // 'options'.  Specifying a nullptr 'options' is equivalent to passing
+        // a default-constructed DecoderOptions in 'options'.  'TYPE' shall be
+        // a 'bdeat'-compatible sequence, choice, or array type, or a
+        // 'bdeat'-compatible dynamic type referring to one of those types.
+        // Return 0 on success, and a non-zero value otherwise.  Note that the
+        // data of a 'blob' having at most one data buffer is tokenized in
+        // place, and the data of any other 'blob' is buffered internally as
+        // if read from a 'bsl::streambuf'.  Also note that any data following
+        // the decoded JSON value in 'blob' is ignored.
+
     template <class TYPE>
     int decode(bsl::streambuf *streamBuf, TYPE *value);
         // Decode an object of (template parameter) 'TYPE' from the specified
@@ -862,27 +920,9 @@ int Decoder::decodeImp(TYPE *, ANY_CATEGORY)
     return -1;
 }
 
-// CREATORS
-inline
-Decoder::Decoder(bslma::Allocator *basicAllocator)
-: d_logStream(basicAllocator)
-, d_tokenizer(basicAllocator)
-, d_elementName(basicAllocator)
-, d_currentDepth(0)
-, d_maxDepth(0)
-, d_skipUnknownElements(false)
-{
-}
-
-// MANIPULATORS
 template <class TYPE>
-int Decoder::decode(bsl::streambuf        *streamBuf,
-                    TYPE                  *value,
-                    const DecoderOptions&  options)
+int Decoder::decodeDocument(TYPE *value, const DecoderOptions& options)
 {
-    BSLS_ASSERT(streamBuf);
-    BSLS_ASSERT(value);
-
     d_logStream.clear();
     d_logStream.str("");
 
@@ -897,7 +937,6 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
         return -1;                                                    // RETURN
     }
 
-    d_tokenizer.reset(streamBuf);
     d_tokenizer.setAllowStandAloneValues(false);
     d_tokenizer.setAllowHeterogenousArrays(false);
 
@@ -922,6 +961,32 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     return rc;
 }
 
+// CREATORS
+inline
+Decoder::Decoder(bslma::Allocator *basicAllocator)
+: d_logStream(basicAllocator)
+, d_tokenizer(basicAllocator)
+, d_elementName(basicAllocator)
+, d_currentDepth(0)
+, d_maxDepth(0)
+, d_skipUnknownElements(false)
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+int Decoder::decode(bsl::streambuf        *streamBuf,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(streamBuf);
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(streamBuf);
+
+    return decodeDocument(value, options);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf        *streamBuf,
                     TYPE                  *value,
@@ -957,6 +1022,57 @@ int Decoder::decode(bsl::istream&          stream,
     return decode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Decoder::decode(const bslstl::StringRef&  input,
+                    TYPE                     *value,
+                    const DecoderOptions&     options)
+{
+    BSLS_ASSERT(value);
+
+    d_tokenizer.reset(input.data(), input.length());
+
+    return decodeDocument(value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const bslstl::StringRef&  input,
+                    TYPE                     *value,
+                    const DecoderOptions     *options)
+{
+    DecoderOptions localOpts;
+    return decode(input, value, options ? *options : localOpts);
+}
+
+template <class TYPE>
+int Decoder::decode(const bdlbb::Blob&     blob,
+                    TYPE                  *value,
+                    const DecoderOptions&  options)
+{
+    BSLS_ASSERT(value);
+
+    if (1 < blob.numDataBuffers()) {
+        bdlbb::InBlobStreamBuf streamBuf(&blob);
+
+        return decode(&streamBuf, value, options);                    // RETURN
+    }
+
+    const bslstl::StringRef input(blob.numDataBuffers()
+                                  ? blob.buffer(0).data()
+                                  : "",
+                                  blob.length());
+
+    return decode(input, value, options);
+}
+
+template <class TYPE>
+int Decoder::decode(const bdlbb::Blob&     blob,
+                    TYPE                  *value,
+                    const DecoderOptions  *options)
+{
+    DecoderOptions localOpts;
+    return decode(blob, value, options ? *options : localOpts);
+}
+
 template <class TYPE>
 int Decoder::decode(bsl::streambuf *streamBuf, TYPE *value)
 {
@@ -17,6 +17,10 @@
 #include <bdlsb_fixedmeminstreambuf.h>
 #include <bsl_sstream.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
+
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmeminstreambuf.h>
 
@@ -72,12 +76,16 @@ using bsl::endl;
 // [ 4] int decode(bsl::istream& stream, TYPE *v, options);
 // [ 4] int decode(bsl::streambuf *streamBuf, TYPE *v, &options);
 // [ 4] int decode(bsl::istream& stream, TYPE *v, &options);
+// [ 9] int decode(const bslstl::StringRef& input, TYPE *v, options);
+// [ 9] int decode(const bslstl::StringRef& input, TYPE *v, &options);
+// [ 9] int decode(const bdlbb::Blob& blob, TYPE *v, options);
+// [ 9] int decode(const bdlbb::Blob& blob, TYPE *v, &options);
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 // [ 5] MULTI-THREADING TEST CASE
 // [ 6] DRQS 43702912
 
@@ -37678,7 +37686,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -37785,6 +37793,175 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 //..
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING FROM MEMORY
+        //
+        // Concerns:
+        //: 1 Decoding JSON held in a 'bslstl::StringRef' or in a
+        //:   'bdlbb::Blob', having any number of data buffers, yields the
+        //:   same object as decoding it from a 'bsl::streambuf'.
+        //:
+        //: 2 Invalid or truncated JSON held in memory is an error.
+        //:
+        //: 3 Specifying a nullptr 'options' is equivalent to specifying
+        //:   default options.
+        //
+        // Plan:
+        //: 1 For each of the pretty and compact messages of case 2, decode
+        //:   the JSON text from a 'bslstl::StringRef', from a 'bdlbb::Blob'
+        //:   having a single data buffer, and from 'bdlbb::Blob' objects
+        //:   whose data buffers are of various small sizes, and verify that
+        //:   the decoded objects have the expected values.  (C-1, 3)
+        //:
+        //: 2 Decode each of a set of invalid inputs, and the first half of
+        //:   each message of P-1, from a 'bslstl::StringRef' and from a
+        //:   'bdlbb::Blob', and verify that decoding fails.  (C-2)
+        //
+        // Testing:
+        //   int decode(const bslstl::StringRef& input, TYPE *v, options);
+        //   int decode(const bslstl::StringRef& input, TYPE *v, &options);
+        //   int decode(const bdlbb::Blob& blob, TYPE *v, options);
+        //   int decode(const bdlbb::Blob& blob, TYPE *v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING FROM MEMORY" << endl
+                          << "============================" << endl;
+
+        bsl::vector<balb::FeatureTestMessage> testObjects;
+        constructFeatureTestMessage(&testObjects);
+
+        bsl::vector<bsl::string> inputs;
+        bsl::vector<int>         lines;
+        bsl::vector<int>         objects;
+
+        for (int ti = 0; ti < NUM_JSON_PRETTY_MESSAGES; ++ti) {
+            inputs.push_back(JSON_PRETTY_MESSAGES[ti].d_input_p);
+            lines.push_back(JSON_PRETTY_MESSAGES[ti].d_line);
+            objects.push_back(ti);
+        }
+        for (int ti = 0; ti < NUM_JSON_COMPACT_MESSAGES; ++ti) {
+            inputs.push_back(JSON_COMPACT_MESSAGES[ti].d_input_p);
+            lines.push_back(JSON_COMPACT_MESSAGES[ti].d_line);
+            objects.push_back(ti);
+        }
+
+        const int BUFFER_SIZES[] = { 1, 7, 64, 1024 * 1024 };
+        const int NUM_BUFFER_SIZES = sizeof BUFFER_SIZES
+                                                       / sizeof *BUFFER_SIZES;
+
+        const baljsn::DecoderOptions options;
+
+        for (bsl::size_t ti = 0; ti < inputs.size(); ++ti) {
+            const int                       LINE  = lines[ti];
+            const bsl::string&              INPUT = inputs[ti];
+            const balb::FeatureTestMessage& EXP   = testObjects[objects[ti]];
+
+            if (veryVerbose) { P_(ti) P(LINE) }
+
+            baljsn::Decoder decoder;
+
+            {
+                balb::FeatureTestMessage value;
+
+                const int rc = decoder.decode(bslstl::StringRef(INPUT),
+                                              &value,
+                                              options);
+                ASSERTV(LINE, decoder.loggedMessages(), rc, 0 == rc);
+                ASSERTV(LINE, EXP, value, EXP == value);
+            }
+            {
+                balb::FeatureTestMessage value;
+
+                const int rc = decoder.decode(bslstl::StringRef(INPUT),
+                                              &value,
+                                              0);
+                ASSERTV(LINE, decoder.loggedMessages(), rc, 0 == rc);
+                ASSERTV(LINE, EXP, value, EXP == value);
+            }
+
+            for (int si = 0; si < NUM_BUFFER_SIZES; ++si) {
+                const int BUFFER_SIZE = BUFFER_SIZES[si];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE);
+                bdlbb::Blob                    blob(&factory);
+                bdlbb::BlobUtil::append(&blob,
+                                        INPUT.data(),
+                                        static_cast<int>(INPUT.length()));
+
+                {
+                    balb::FeatureTestMessage value;
+
+                    const int rc = decoder.decode(blob, &value, options);
+                    ASSERTV(LINE, BUFFER_SIZE, decoder.loggedMessages(), rc,
+                            0 == rc);
+                    ASSERTV(LINE, BUFFER_SIZE, EXP, value, EXP == value);
+                }
+                {
+                    balb::FeatureTestMessage value;
+
+                    const int rc = decoder.decode(blob, &value, &options);
+                    ASSERTV(LINE, BUFFER_SIZE, decoder.loggedMessages(), rc,
+                            0 == rc);
+                    ASSERTV(LINE, BUFFER_SIZE, EXP, value, EXP == value);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting invalid input." << endl;
+
+        static const char *const INVALID[] = {
+            "",
+            "   ",
+            "1",
+            "\"abc\"",
+            "{",
+            "{\"name\"",
+            "{\"name\":",
+            "{\"name\":\"Bob",
+            "{\"name\":\"Bob\\",
+            "{\"name\":\"Bob\"",
+            "{\"name\":\"Bob\",}",
+            "[1,2",
+        };
+        const int NUM_INVALID = sizeof INVALID / sizeof *INVALID;
+
+        for (int ti = 0; ti < NUM_INVALID; ++ti) {
+            inputs.push_back(INVALID[ti]);
+        }
+        for (bsl::size_t ti = 0; ti < lines.size(); ++ti) {
+            inputs.push_back(inputs[ti].substr(0, inputs[ti].length() / 2));
+        }
+
+        for (bsl::size_t ti = lines.size(); ti < inputs.size(); ++ti) {
+            const bsl::string& INPUT = inputs[ti];
+
+            if (veryVerbose) { P_(ti) P(INPUT) }
+
+            baljsn::Decoder decoder;
+
+            {
+                balb::FeatureTestMessage value;
+
+                ASSERTV(ti, 0 != decoder.decode(bslstl::StringRef(INPUT),
+                                                &value,
+                                                options));
+            }
+
+            for (int si = 0; si < NUM_BUFFER_SIZES; ++si) {
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZES[si]);
+                bdlbb::Blob                    blob(&factory);
+                bdlbb::BlobUtil::append(&blob,
+                                        INPUT.data(),
+                                        static_cast<int>(INPUT.length()));
+
+                balb::FeatureTestMessage value;
+
+                ASSERTV(ti, si, 0 != decoder.decode(blob, &value, options));
+            }
+        }
+      } break;
       case 8: {
         // ------------------------------------------------------------------
         // TESTING CLEARING OF LOGGED MESSAGES ON DECODE CALLS
@@ -72,10 +72,14 @@ BSLS_IDENT("$Id: $")
 //:                                        'DatetimeTz'.
 //:
 //: o 'maxFloatPrecision': option specifying the maximum number of decimal
-//:                        places used to encode each 'float' value.
+//:                        places used to encode each 'float' value.  If 9,
+//:                        each 'float' value is encoded as the shortest text
+//:                        that decodes to exactly that value.
 //:
 //: o 'maxDoublePrecision': option specifying the maximum number of decimal
-//:                         places used to encode each 'double' value.
+//:                         places used to encode each 'double' value.  If 17,
+//:                         each 'double' value is encoded as the shortest
+//:                         text that decodes to exactly that value.
 //
 ///Implementation Note
 ///- - - - - - - - - -
@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_numericparseutil.h>
 #include <bdlb_string.h>
 
 #include <bdldfp_decimalutil.h>
@@ -21,7 +22,6 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bsl_algorithm.h>
 #include <bsl_cmath.h>
 #include <bsl_cctype.h>
-#include <bsl_cerrno.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
@@ -30,6 +30,22 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace {
 
+bool hasNonZeroSignificand(bslstl::StringRef data)
+    // Return 'true' if the significand of the specified numeric 'data' (i.e.,
+    // the part of 'data' preceding any exponent) has a non-zero digit, and
+    // 'false' otherwise.
+{
+    for (const char *iter = data.begin(); iter != data.end(); ++iter) {
+        if ('e' == *iter || 'E' == *iter) {
+            break;
+        }
+        if ('1' <= *iter && *iter <= '9') {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
 template <class TYPE>
 int loadInfOrNan(TYPE *value, bslstl::StringRef data)
 {
@@ -150,7 +166,10 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
         return -1;                                                    // RETURN
     }
 
+    // The unescaped value is never longer than its quoted representation.
+
     value->clear();
+    value->reserve(data.length());
 
     ++iter;
     while (iter < end) {
@@ -287,7 +306,15 @@ int ParserUtil::getString(bsl::string *value, bslstl::StringRef data)
             return 0;                                                 // RETURN
         }
         else {
-            *value += *iter;
+            // Append the run of characters up to the next escape sequence or
+            // the closing quote at once.
+
+            const char *runEnd = iter + 1;
+            while (runEnd < end && '\\' != *runEnd && '"' != *runEnd) {
+                ++runEnd;
+            }
+            value->append(iter, runEnd);
+            iter = runEnd - 1;
         }
         ++iter;
     }
@@ -366,24 +393,19 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
-    const int k_MAX_STRING_LENGTH = 63;
-    char      buffer[k_MAX_STRING_LENGTH + 1];
+    double            tmp;
+    bslstl::StringRef rest;
+
+    if (0 != bdlb::NumericParseUtil::parseDouble(&tmp, &rest, data)
+     || !rest.empty()
+     || !bsl::isdigit(static_cast<unsigned char>(data[data.length() - 1]))
+     ||  bsl::numeric_limits<double>::infinity() == tmp
+     || -bsl::numeric_limits<double>::infinity() == tmp
+     || (0 == tmp && hasNonZeroSignificand(data))) {
+        // Reject text that is not entirely a number, that is not a JSON
+        // number (e.g., "nan" or "1."), or whose value overflows or
+        // underflows to zero.
 
-    bdlma::BufferedSequentialAllocator allocator(buffer,
-                                                 k_MAX_STRING_LENGTH + 1);
-    bsl::string                        dataString(data.data(),
-                                                  data.length(),
-                                                  &allocator);
-
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
-
-    if (endPtr    != dataString.end()
-     || (0        == tmp && 0 != errno)
-     ||  HUGE_VAL == tmp
-     || -HUGE_VAL == tmp
-     || !bsl::isdigit(*(dataString.end() - 1))) {
         return -1;                                                    // RETURN
     }
 
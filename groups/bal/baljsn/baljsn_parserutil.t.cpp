@@ -2615,6 +2615,23 @@ int main(int argc, char *argv[])
                 {  L_,    "1e-1",                    0.1,       true    },
                 {  L_,    "1E-1",                    0.1,       true    },
 
+                {  L_,    "1.7976931348623157e308",
+                                          1.7976931348623157e308,
+                                                                true    },
+                {  L_,    "4.9406564584124654e-324",
+                                         4.9406564584124654e-324,
+                                                                true    },
+                {  L_,    "9007199254740993",  9007199254740992.0,
+                                                                true    },
+                {  L_,    "9007199254740993.00000000000000000000000000000"
+                          "00000000000000000000000000000000000000000001",
+                                               9007199254740994.0,
+                                                                true    },
+                {  L_,    "0e-400",                    0,       true    },
+                {  L_,    "1e400",            ERROR_VALUE,      false   },
+                {  L_,    "-1e400",           ERROR_VALUE,      false   },
+                {  L_,    "1e-400",           ERROR_VALUE,      false   },
+
                 {  L_,    "\"NaN\"", bsl::numeric_limits<Type>::quiet_NaN(),
                                                                 true    },
 
@@ -2696,9 +2713,10 @@ int main(int argc, char *argv[])
                 {  L_,  "34.56Z1",    ERROR_VALUE,   false   },
                 {  L_,  "34.56eZ",    ERROR_VALUE,   false   },
 
-// TBD:
-//                 {  L_,    "0x12",     ERROR_VALUE,   false   },
-//                 {  L_,    "0x256",    ERROR_VALUE,   false   },
+                {  L_,    "0x12",     ERROR_VALUE,   false   },
+                {  L_,    "0x256",    ERROR_VALUE,   false   },
+                {  L_,    "nan",      ERROR_VALUE,   false   },
+                {  L_,    "inf",      ERROR_VALUE,   false   },
                 {  L_,    "1.1}",     ERROR_VALUE,   false   },
                 {  L_,    "1.1,",     ERROR_VALUE,   false   },
                 {  L_,    "1.1]",     ERROR_VALUE,   false   },
@@ -2936,9 +2954,8 @@ int main(int argc, char *argv[])
                 {  L_,  "34.56Z1",    ERROR_VALUE,   false   },
                 {  L_,  "34.56eZ",    ERROR_VALUE,   false   },
 
-// TBD:
-//                 {  L_,    "0x12",     ERROR_VALUE,   false   },
-//                 {  L_,    "0x256",    ERROR_VALUE,   false   },
+                {  L_,    "0x12",     ERROR_VALUE,   false   },
+                {  L_,    "0x256",    ERROR_VALUE,   false   },
                 {  L_,    "DEADBEEF", ERROR_VALUE,   false   },
                 {  L_,    "JUNK",     ERROR_VALUE,   false   },
             };
@@ -82,6 +82,7 @@ BSLS_IDENT("$Id: $")
 #include <baljsn_encoderoptions.h>
 
 #include <bdlb_float.h>
+#include <bdlb_numericformatterutil.h>
 
 #include <bdldfp_decimal.h>
 #include <bdldfp_decimalconvertutil.h>
@@ -90,6 +91,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_iso8601util.h>
 #include <bdlt_datetimeinterval.h>
 
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -120,6 +122,13 @@ struct PrintUtil {
         // template parameter 'TYPE' using the specified 'options' to decide.
         // The behavior is undefined unless 'TYPE' is 'float' or 'double'.
 
+    template <class TYPE>
+    static int roundTripPrecision();
+        // Return the smallest precision at which every value of the specified
+        // template parameter 'TYPE' can be streamed without loss (i.e., 9 for
+        // 'float' and 17 for 'double').  The behavior is undefined unless
+        // 'TYPE' is 'float' or 'double'.
+
   public:
     // CLASS METHODS
     template <class TYPE>
@@ -136,7 +145,11 @@ struct PrintUtil {
                                   const EncoderOptions *options);
         // Encode the specified floating point 'value' into JSON and output the
         // result to the specified 'stream'.  Use the optionally-specified
-        // 'options' to decide how 'value' is encoded.
+        // 'options' to decide how 'value' is encoded.  If the maximum
+        // precision given by 'options' for 'TYPE' is at least the precision
+        // needed to encode every value of 'TYPE' without loss (9 for 'float'
+        // and 17 for 'double'), 'value' is encoded as the shortest text that
+        // decodes to exactly 'value' (see 'bdlb_numericformatterutil').
 
     static int printString(bsl::ostream&             stream,
                            const bslstl::StringRef&  value);
@@ -245,6 +258,20 @@ int PrintUtil::maxStreamPrecision<double>(
            : bsl::numeric_limits<double>::digits10;
 }
 
+template <>
+inline
+int PrintUtil::roundTripPrecision<float>()
+{
+    return 9;
+}
+
+template <>
+inline
+int PrintUtil::roundTripPrecision<double>()
+{
+    return 17;
+}
+
 // CLASS METHODS
 template <class TYPE>
 inline
@@ -299,23 +326,38 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         }
       } break;
       default: {
-        const int k_SIZE = 32;
-        char      buffer[k_SIZE];
+        const int precision = maxStreamPrecision<TYPE>(options);
+
+        if (precision >= roundTripPrecision<TYPE>()) {
+            char buffer[bdlb::NumericFormatterUtil::k_DOUBLE_MAX_LENGTH];
+
+            const char *end = bdlb::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        value);
+            BSLS_ASSERT(end);
+
+            stream.write(buffer, end - buffer);
+        }
+        else {
+            const int k_SIZE = 32;
+            char      buffer[k_SIZE];
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #define snprintf _snprintf
 #endif
 
-        const int len = snprintf(buffer,
-                                 k_SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
+            const int len = snprintf(buffer,
+                                     k_SIZE,
+                                     "%-1.*g",
+                                     precision,
+                                     value);
 
 #if defined(BSLS_PLATFORM_CMP_MSVC)
 #undef snprintf
 #endif
-        stream.write(buffer, len);
+            stream.write(buffer, len);
+        }
       }
     }
     return 0;
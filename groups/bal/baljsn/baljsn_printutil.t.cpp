@@ -12,10 +12,12 @@
 
 #include <bslim_testutil.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
@@ -692,6 +694,10 @@ int main(int argc, char *argv[])
         //: 2 Encoded numbers used default format.
         //:
         //: 3 Encoding 'unsigned char' prints a number instead of string.
+        //:
+        //: 4 At a precision sufficient for every value of the type, a 'float'
+        //:   or 'double' is encoded as text that decodes to exactly the same
+        //:   value.
         //
         // Plan:
         //: 1 Use the table-driven technique:
@@ -700,6 +706,11 @@ int main(int argc, char *argv[])
         //:     the precision of the output.
         //:
         //:   2 Encode each value and verify the output is as expected.
+        //:
+        //: 2 Encode the values represented by a large number of pseudo-random
+        //:   bit patterns at the maximum precision, decode each output with
+        //:   'strtod' (as does 'baljsn::ParserUtil'), and verify that the
+        //:   result is identical to the original value.  (C-4)
         //
         // Testing:
         //  static int printValue(bsl::ostream& s, char                    v);
@@ -855,7 +866,7 @@ int main(int argc, char *argv[])
                 { L_,        1.0e-1f, 1, "0.1" },
                 { L_,  0.1234567891f, 1, "0.1" },
                 { L_,  0.1234567891f, 4, "0.1235" },
-                { L_,  0.1234567891f, 9, "0.123456791" },
+                { L_,  0.1234567891f, 9, "0.12345679" },
 
 #if defined(BALJSN_PRINTUTIL_EXTRA_ZERO_PADDING_FOR_EXPONENTS)
                 { L_,           10.0, 1, "1e+001" },
@@ -863,18 +874,18 @@ int main(int argc, char *argv[])
                 { L_,-1.23456789e-20, 1, "-1e-020" },
                 { L_,-1.23456789e-20, 2, "-1.2e-020" },
                 { L_,-1.23456789e-20, 8, "-1.2345679e-020"  },
-                { L_,-1.23456789e-20, 9, "-1.23456787e-020" },
+                { L_,-1.23456789e-20, 9, "-1.2345679e-20" },
                 { L_, 1.23456789e-20, 1, "1e-020" },
-                { L_, 1.23456789e-20, 9, "1.23456787e-020" },
+                { L_, 1.23456789e-20, 9, "1.2345679e-20" },
 #else
                 { L_,           10.0f, 1, "1e+01" },
                 { L_,         -1.5e1f, 1, "-2e+01" },
                 { L_,-1.23456789e-20f, 1, "-1e-20" },
                 { L_,-1.23456789e-20f, 2, "-1.2e-20" },
                 { L_,-1.23456789e-20f, 8, "-1.2345679e-20"  },
-                { L_,-1.23456789e-20f, 9, "-1.23456787e-20" },
+                { L_,-1.23456789e-20f, 9, "-1.2345679e-20" },
                 { L_, 1.23456789e-20f, 1, "1e-20" },
-                { L_, 1.23456789e-20f, 9, "1.23456787e-20" },
+                { L_, 1.23456789e-20f, 9, "1.2345679e-20" },
 #endif
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
@@ -961,14 +972,20 @@ int main(int argc, char *argv[])
       { L_,                     -1.5,  2, "-1.5" },
       { L_,                 -9.9e100,  2, "-9.9e+100" },
       { L_,                 -9.9e100, 15, "-9.9e+100" },
-      { L_,                 -9.9e100, 17, "-9.9000000000000003e+100" },
+      { L_,                 -9.9e100, 17, "-9.9e+100" },
       { L_,                -3.14e300, 15, "-3.14e+300" },
-      { L_,                -3.14e300, 17, "-3.1400000000000001e+300" },
+      { L_,                -3.14e300, 17, "-3.14e+300" },
       { L_,                 3.14e300,  2, "3.1e+300" },
-      { L_,                 3.14e300, 17, "3.1400000000000001e+300" },
+      { L_,                 3.14e300, 17, "3.14e+300" },
       { L_,                   1.0e-1,  1, "0.1" },
       { L_,                2.23e-308,  2, "2.2e-308" },
-      { L_,                2.23e-308, 17, "2.2300000000000001e-308" },
+      { L_,                2.23e-308, 17, "2.23e-308" },
+      { L_,                   1.0e-1, 17, "0.1" },
+      { L_,                   0.0001, 17, "1e-04" },
+      { L_,              1.0 / 3.0, 15, "0.333333333333333" },
+      { L_,              1.0 / 3.0, 17, "0.3333333333333333" },
+      { L_,              0.1 + 0.2, 15, "0.3" },
+      { L_,              0.1 + 0.2, 17, "0.30000000000000004" },
       { L_,     0.123456789012345678,  1, "0.1" },
       { L_,     0.123456789012345678,  2, "0.12" },
       { L_,     0.123456789012345678, 15, "0.123456789012346" },
@@ -982,7 +999,7 @@ int main(int argc, char *argv[])
       { L_,  -1.2345678901234567e-20,  2, "-1.2e-020" },
       { L_,  -1.2345678901234567e-20, 15, "-1.23456789012346e-020"  },
       { L_,  -1.2345678901234567e-20, 16, "-1.234567890123457e-020" },
-      { L_,  -1.2345678901234567e-20, 17, "-1.2345678901234567e-020" },
+      { L_,  -1.2345678901234567e-20, 17, "-1.2345678901234567e-20" },
 #else
       { L_,                     10.0,  1, "1e+01" },
       { L_,                   -1.5e1,  1, "-2e+01" },
@@ -1012,6 +1029,50 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "Round trip at maximum precision" << endl;
+        {
+            baljsn::EncoderOptions options;
+            options.setMaxFloatPrecision(9);
+            options.setMaxDoublePrecision(17);
+
+            bsls::Types::Uint64 state = 0x9E3779B97F4A7C15ULL;
+
+            for (int i = 0; i < 100000; ++i) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+
+                double value;
+                bsl::memcpy(&value, &state, sizeof value);
+
+                bsl::ostringstream oss;
+                if (0 == Obj::printValue(oss, value, &options)) {
+                    const bsl::string result = oss.str();
+                    const double      parsed = bsl::strtod(result.c_str(), 0);
+
+                    ASSERTV(result, 0 == bsl::memcmp(&value,
+                                                     &parsed,
+                                                     sizeof value));
+                }
+
+                const unsigned int floatBits =
+                                           static_cast<unsigned int>(state);
+                float              floatValue;
+                bsl::memcpy(&floatValue, &floatBits, sizeof floatValue);
+
+                oss.str("");
+                if (0 == Obj::printValue(oss, floatValue, &options)) {
+                    const bsl::string result = oss.str();
+                    const float       parsed = static_cast<float>(
+                                             bsl::strtod(result.c_str(), 0));
+
+                    ASSERTV(result, 0 == bsl::memcmp(&floatValue,
+                                                     &parsed,
+                                                     sizeof floatValue));
+                }
+            }
+        }
+
         if (verbose) cout << "Encode invalid double" << endl;
         {
             bsl::ostringstream oss;
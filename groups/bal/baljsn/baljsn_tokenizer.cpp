@@ -4,12 +4,19 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 
-#include <bsl_cstring.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define BALJSN_TOKENIZER_SSE2
+#include <emmintrin.h>
+#endif
+
 #include <baljsn_parserutil.h>                 // for testing only
 
 // IMPLEMENTATION NOTES
@@ -52,12 +59,177 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_OBJECT                   '}'         ']'              END_ARRAY
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
+//
+// Most of the characters of a JSON document are string content, whitespace
+// between tokens, and the characters of unquoted values (numbers, 'true',
+// 'false', and 'null'), each of which ends at the first character of a small
+// class: '"' or '\\' for string content, anything but whitespace for
+// whitespace, and whitespace or a structural character ("{}[]:,") for
+// unquoted values.  The 'find*' functions below locate that character by
+// classifying 32 bytes at a time with SSE2 (available on every x86-64
+// processor) where supported, and a byte at a time otherwise, so that the
+// tokenizer skips a run of such characters with a few instructions per 32
+// bytes rather than a branch per byte.  A string is scanned from one '"' or
+// '\\' to the next, skipping the character following each '\\', so that
+// escaped quotes are not mistaken for the end of the string.
 
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+inline
+bool isWhitespace(char character)
+    // Return 'true' if the specified 'character' is one of " \n\t\v\f\r",
+    // and 'false' otherwise.
+{
+    return ' ' == character || ('\t' <= character && character <= '\r');
+}
+
+inline
+bool isValueEnd(char character)
+    // Return 'true' if the specified 'character' ends an unquoted value (i.e.,
+    // is whitespace, a structural character, or the null character), and
+    // 'false' otherwise.
+{
+    switch (character) {
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+      case '\0': {
+        return true;                                                  // RETURN
+      }
+    }
+    return isWhitespace(character);
+}
+
+#if defined(BALJSN_TOKENIZER_SSE2)
+
+inline
+unsigned int quoteOrBackslashMask(__m128i input)
+    // Return a 16-bit mask having bit 'i' set if byte 'i' of the specified
+    // 'input' is '"' or '\\'.
+{
+    const __m128i quotes      = _mm_cmpeq_epi8(input, _mm_set1_epi8('"'));
+    const __m128i backslashes = _mm_cmpeq_epi8(input, _mm_set1_epi8('\\'));
+
+    return _mm_movemask_epi8(_mm_or_si128(quotes, backslashes));
+}
+
+inline
+unsigned int whitespaceMask(__m128i input)
+    // Return a 16-bit mask having bit 'i' set if byte 'i' of the specified
+    // 'input' is whitespace.
+{
+    // '\t' through '\r' are the byte values 9 through 13.
+
+    const __m128i offset  = _mm_sub_epi8(input, _mm_set1_epi8('\t'));
+    const __m128i control = _mm_cmpeq_epi8(
+                            _mm_min_epu8(offset, _mm_set1_epi8('\r' - '\t')),
+                            offset);
+
+    return _mm_movemask_epi8(
+                       _mm_or_si128(_mm_cmpeq_epi8(input, _mm_set1_epi8(' ')),
+                                    control));
+}
+
+inline
+unsigned int valueEndMask(__m128i input)
+    // Return a 16-bit mask having bit 'i' set if byte 'i' of the specified
+    // 'input' ends an unquoted value.
+{
+    // Setting bit 5 maps '[' to '{' and ']' to '}', and no other byte to
+    // either.
+
+    const __m128i folded     = _mm_or_si128(input, _mm_set1_epi8(0x20));
+    const __m128i brackets   = _mm_or_si128(
+                                 _mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                                 _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+    const __m128i separators = _mm_or_si128(
+                                 _mm_cmpeq_epi8(input, _mm_set1_epi8(':')),
+                                 _mm_cmpeq_epi8(input, _mm_set1_epi8(',')));
+    const __m128i nulls      = _mm_cmpeq_epi8(input, _mm_setzero_si128());
+
+    return whitespaceMask(input)
+         | _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(brackets, separators),
+                                          nulls));
+}
+
+inline
+__m128i load(const char *address)
+    // Return the 16 bytes at the specified 'address'.
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(address));
+}
+
+#endif  // BALJSN_TOKENIZER_SSE2
+
+const char *findQuoteOrBackslash(const char *begin, const char *end)
+    // Return the address of the first '"' or '\\' in the specified range
+    // '[begin, end)', or 'end' if there is none.
+{
+#if defined(BALJSN_TOKENIZER_SSE2)
+    for (; end - begin >= 32; begin += 32) {
+        const bsl::uint32_t mask =
+                                  quoteOrBackslashMask(load(begin))
+                                | quoteOrBackslashMask(load(begin + 16)) << 16;
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+    }
+#endif
+
+    for (; begin != end && '"' != *begin && '\\' != *begin; ++begin) {
+    }
+    return begin;
+}
+
+const char *findNonWhitespace(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that is not whitespace, or 'end' if there is none.
+{
+    // Tokens are often not separated by whitespace, or by a single space.
+
+    for (int i = 0; i < 2; ++i, ++begin) {
+        if (begin == end || !isWhitespace(*begin)) {
+            return begin;                                             // RETURN
+        }
+    }
+
+#if defined(BALJSN_TOKENIZER_SSE2)
+    for (; end - begin >= 32; begin += 32) {
+        const bsl::uint32_t mask = ~(whitespaceMask(load(begin))
+                                     | whitespaceMask(load(begin + 16)) << 16);
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+    }
+#endif
+
+    for (; begin != end && isWhitespace(*begin); ++begin) {
+    }
+    return begin;
+}
+
+const char *findValueEnd(const char *begin, const char *end)
+    // Return the address of the first character in the specified range
+    // '[begin, end)' that ends an unquoted value, or 'end' if there is none.
+{
+#if defined(BALJSN_TOKENIZER_SSE2)
+    for (; end - begin >= 32; begin += 32) {
+        const bsl::uint32_t mask = valueEndMask(load(begin))
+                                 | valueEndMask(load(begin + 16)) << 16;
+        if (mask) {
+            return begin + bdlb::BitUtil::numTrailingUnsetBits(mask); // RETURN
+        }
+    }
+#endif
+
+    for (; begin != end && !isValueEnd(*begin); ++begin) {
+    }
+    return begin;
+}
 
 }  // close unnamed namespace
 
@@ -70,17 +242,26 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::reloadStringBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
     const int numRead =
                      static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[0],
                                                            k_MAX_STRING_SIZE));
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
+    setDataToStringBuffer();
     return numRead;
 }
 
 int Tokenizer::expandBufferForLargeValue()
 {
+    if (!d_streambuf_p) {
+        return -1;                                                    // RETURN
+    }
+
     const bsl::string::size_type currLength = d_stringBuffer.length();
     d_stringBuffer.resize(currLength + k_MAX_STRING_SIZE);
 
@@ -88,11 +269,16 @@ int Tokenizer::expandBufferForLargeValue()
             static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
                                                   k_MAX_STRING_SIZE));
     d_stringBuffer.resize(currLength + numRead);
+    setDataToStringBuffer();
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (!d_streambuf_p) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
@@ -105,6 +291,7 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
                                              k_MAX_STRING_SIZE - d_valueIter));
 
     d_stringBuffer.resize(d_valueIter + numRead);
+    setDataToStringBuffer();
 
     return numRead;
 }
@@ -112,10 +299,12 @@ int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        const char *begin = d_data_p;
+        const char *end   = begin + d_dataLength;
+        const char *next  = findNonWhitespace(begin + d_cursor, end);
+
+        if (next != end) {
+            d_cursor = next - begin;
             break;
         }
 
@@ -129,25 +318,40 @@ int Tokenizer::skipWhitespace()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime     = true;
+    bool isEscapeSplit = false;  // 'true' if the buffer ended with a '\\'
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        const char  *begin  = d_data_p;
+        bsl::size_t  length = d_dataLength;
 
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
+        if (isEscapeSplit && d_valueIter < length) {
+            // Skip the character escaped by the '\\' that ended the buffer.
+
+            ++d_valueIter;
+            isEscapeSplit = false;
+        }
+
+        while (d_valueIter < length) {
+            d_valueIter = findQuoteOrBackslash(begin + d_valueIter,
+                                               begin + length) - begin;
+
+            if (d_valueIter == length || '"' == begin[d_valueIter]) {
+                break;
+            }
+
+            // Skip the '\\' and the character it escapes.
+
+            if (d_valueIter + 1 == length) {
+                d_valueIter   = length;
+                isEscapeSplit = true;
             }
             else {
-                previousChar = d_stringBuffer[d_valueIter];
+                d_valueIter += 2;
             }
-
-            ++d_valueIter;
         }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= length) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -177,11 +381,6 @@ int Tokenizer::extractStringValue()
             }
         }
         else {
-            if ('\\' == previousChar) {
-                ++d_valueIter;
-                previousChar = 0;
-                continue;
-            }
             d_valueEnd = d_valueIter;
             return 0;                                                 // RETURN
         }
@@ -194,13 +393,12 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
-        }
+        const char *begin = d_data_p;
+
+        d_valueIter = findValueEnd(begin + d_valueIter,
+                                   begin + d_dataLength) - begin;
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        if (d_valueIter >= d_dataLength) {
 
             // There isn't enough room in the internal buffer to hold the
             // value.  If this is the first time through the loop, we move the
@@ -239,7 +437,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_dataLength) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -258,7 +456,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_data_p[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -572,12 +770,11 @@ int Tokenizer::advanceToNextToken()
 
 int Tokenizer::resetStreamBufGetPointer()
 {
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (!d_streambuf_p || d_cursor >= d_dataLength) {
         return 0;                                                     // RETURN
     }
 
-    const int numExtraCharsRead = static_cast<int>(d_stringBuffer.size()
-                                                                   - d_cursor);
+    const int numExtraCharsRead = static_cast<int>(d_dataLength - d_cursor);
     const bsl::streamoff newPos = d_streambuf_p->pubseekoff(-numExtraCharsRead,
                                                             bsl::ios_base::cur,
                                                             bsl::ios_base::in);
@@ -590,8 +787,7 @@ int Tokenizer::value(bslstl::StringRef *data) const
 {
     if ((e_ELEMENT_NAME == d_tokenType || e_ELEMENT_VALUE == d_tokenType) &&
         d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(d_data_p + d_valueBegin, d_data_p + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
@@ -19,6 +19,14 @@ BSLS_IDENT("$Id: $")
 // 'bsl::streambuf' containing JSON data with a tokenizer object and then call
 // the 'advanceToNextToken' function to extract individual data values.
 //
+// A tokenizer can also be associated with JSON data that is already held in a
+// contiguous block of memory, using the 'reset' overload that takes the
+// address and length of that data.  In that case the data is tokenized in
+// place: nothing is copied into the internal buffer of the tokenizer, and the
+// string references loaded by the 'value' accessor refer directly into the
+// supplied data (and so remain valid for as long as that data does, rather
+// than only until the next call to 'advanceToNextToken').
+//
 // This 'class' was created to be used by other components in the 'baljsn'
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
@@ -206,9 +214,22 @@ class Tokenizer {
 
     bsl::string                          d_stringBuffer;    // string buffer
 
+    const char                          *d_data_p;          // characters
+                                                            // being tokenized
+                                                            // (either
+                                                            // 'd_stringBuffer'
+                                                            // or data supplied
+                                                            // to 'reset')
+
+    bsl::size_t                          d_dataLength;      // number of
+                                                            // characters at
+                                                            // 'd_data_p'
+
     bsl::streambuf                      *d_streambuf_p;     // streambuf
                                                             // (held, not
-                                                            // owned)
+                                                            // owned), or 0
+                                                            // if tokenizing
+                                                            // in place
 
     bsl::size_t                          d_cursor;          // current cursor
 
@@ -239,6 +260,10 @@ class Tokenizer {
                                                             // values
 
     // PRIVATE MANIPULATORS
+    void setDataToStringBuffer();
+        // Set the characters being tokenized to the current contents of the
+        // internal string buffer, 'd_stringBuffer'.
+
     int extractStringValue();
         // Extract the string value starting at the current data cursor and
         // update the value begin and end pointers to refer to the begin and
@@ -251,19 +276,22 @@ class Tokenizer {
         // additional characters, from the internally-held 'streambuf'
         // ('d_streambuf_p') to the end of that sequence up to a maximum
         // sequence length of 'd_buffer.size()' characters.  Return the number
-        // of bytes read from the 'streambuf'.
+        // of bytes read from the 'streambuf', or 0 with no effect if this
+        // object is tokenizing data in place.
 
     int reloadStringBuffer();
         // Reload the string buffer with new data read from the underlying
         // 'streambuf' and overwriting the current buffer.  After reading
         // update the cursor to the new read location.  Return the number of
-        // bytes read from the 'streambuf'.
+        // bytes read from the 'streambuf', or 0 with no effect if this object
+        // is tokenizing data in place.
 
     int expandBufferForLargeValue();
         // Increase the size of the string buffer, 'd_stringBuffer', and then
         // append additional characters, from the internally-held 'streambuf' (
         // 'd_streambuf_p') to the end of the current sequence of characters.
-        // Return 0 on success and a non-zero value otherwise.
+        // Return 0 on success and a non-zero value otherwise.  Note that this
+        // method fails if this object is tokenizing data in place.
 
     int skipWhitespace();
         // Skip all whitespace characters and position the cursor onto the
@@ -307,11 +335,23 @@ class Tokenizer {
         // 'advanceToNextToken' is called.  Note that this function does not
         // change the value of the 'allowStandAloneValues' option.
 
+    void reset(const char *data, bsl::size_t length);
+        // Reset this tokenizer to read the specified 'data' having the
+        // specified 'length' in place, without copying it, so that the string
+        // references loaded by 'value' refer into 'data'.  The behavior is
+        // undefined unless 'data' is not 0 or 'length' is 0, and 'data'
+        // remains valid and unmodified while this tokenizer, or any string
+        // reference loaded by 'value', refers to it.  Note that the reader
+        // will not be on a valid node until 'advanceToNextToken' is called.
+        // Also note that this function does not change the value of the
+        // 'allowStandAloneValues' option.
+
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
         // non-zero value otherwise.  Note that each call to
         // 'advanceToNextToken' invalidates the string references returned by
-        // the 'value' accessor for prior nodes.
+        // the 'value' accessor for prior nodes, unless this object is
+        // tokenizing data in place.
 
     int resetStreamBufGetPointer();
         // Reset the get pointer of the 'streambuf' held by this object to
@@ -323,7 +363,8 @@ class Tokenizer {
         // from where this object stopped.  Also note that this call implies
         // the end of processing for this object and any subsequent methods
         // invoked on this object should only be done after calling 'reset' and
-        // specifying a new 'streambuf'.
+        // specifying a new 'streambuf'.  This method has no effect, and
+        // returns 0, if this object is tokenizing data in place.
 
     void setAllowStandAloneValues(bool value);
         // Set the 'allowStandAloneValues' option to the specified 'value'.  If
@@ -354,6 +395,12 @@ class Tokenizer {
         // Return the value of the 'allowHeterogenousArrays' option of this
         // tokenizer.
 
+    bsl::size_t readOffset() const;
+        // Return the offset, from the start of the data supplied to 'reset',
+        // of the first character not yet processed by this tokenizer.  The
+        // behavior is undefined unless this object is tokenizing data in
+        // place.
+
     int value(bslstl::StringRef *data) const;
         // Load into the specified 'data' the value of the specified token if
         // the current token's type is 'BAEJSN_ELEMENT_NAME' or
@@ -382,6 +429,13 @@ void Tokenizer::pushContext(ContextType context)
     d_contextStack.push_back(static_cast<char>(context));
 }
 
+inline
+void Tokenizer::setDataToStringBuffer()
+{
+    d_data_p     = d_stringBuffer.data();
+    d_dataLength = d_stringBuffer.length();
+}
+
 // PRIVATE ACCESSOR
 inline
 Tokenizer::ContextType Tokenizer::context() const
@@ -398,6 +452,8 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 : d_allocator(d_buffer.buffer(), k_BUFSIZE, basicAllocator)
 , d_stackAllocator(d_stackBuffer.buffer(), k_STACKBUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
+, d_data_p(d_stringBuffer.data())
+, d_dataLength(0)
 , d_streambuf_p(0)
 , d_cursor(0)
 , d_valueBegin(0)
@@ -425,6 +481,27 @@ void Tokenizer::reset(bsl::streambuf *streambuf)
 {
     d_streambuf_p = streambuf;
     d_stringBuffer.clear();
+    d_data_p      = d_stringBuffer.data();
+    d_dataLength  = 0;
+    d_cursor      = 0;
+    d_valueBegin  = 0;
+    d_valueEnd    = 0;
+    d_valueIter   = 0;
+    d_tokenType   = e_BEGIN;
+
+    d_contextStack.clear();
+    pushContext(e_OBJECT_CONTEXT);
+}
+
+inline
+void Tokenizer::reset(const char *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    d_streambuf_p = 0;
+    d_stringBuffer.clear();
+    d_data_p      = data;
+    d_dataLength  = length;
     d_cursor      = 0;
     d_valueBegin  = 0;
     d_valueEnd    = 0;
@@ -466,6 +543,14 @@ bool Tokenizer::allowHeterogenousArrays() const
     return d_allowHeterogenousArrays;
 }
 
+inline
+bsl::size_t Tokenizer::readOffset() const
+{
+    BSLS_ASSERT(!d_streambuf_p);
+
+    return d_cursor;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
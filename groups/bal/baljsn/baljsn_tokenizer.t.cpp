@@ -23,6 +23,9 @@
 
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
+#include <bsl_fstream.h>
+
+#include <bsls_timeutil.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -49,6 +52,7 @@ using bsl::endl;
 //
 // MANIPULATORS
 // [ 9] void reset(bsl::streambuf &streamBuf);
+// [18] void reset(const char *data, bsl::size_t length);
 // [12] void resetStreamBufGetPointer();
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
@@ -59,9 +63,12 @@ using bsl::endl;
 // [13] bool allowStandAloneValues() const;
 // [14] bool allowHeterogenousArrays() const;
 // [ 3] int value(bslstl::StringRef *data) const;
+// [18] bsl::size_t readOffset() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [17] USAGE EXAMPLE
+// [17] CONCERN: SCANNING ACROSS BLOCK AND BUFFER BOUNDARIES
+// [19] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -196,7 +203,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 17: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -318,6 +325,315 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING 'reset(const char *, bsl::size_t)'
+        //
+        // Concerns:
+        //: 1 Tokenizing data in place yields the same sequence of tokens,
+        //:   token values, and status codes as tokenizing the same data read
+        //:   from a 'streambuf', for both valid and invalid data.
+        //:
+        //: 2 The values of tokens refer into the supplied data.
+        //:
+        //: 3 A value, or a string longer than the internal buffer, that ends
+        //:   at the end of the supplied data is tokenized correctly, and an
+        //:   unterminated string is an error.
+        //:
+        //: 4 Tokenizing in place allocates no memory.
+        //:
+        //: 5 'readOffset' returns the offset of the first character following
+        //:   the last token, and 'resetStreamBufGetPointer' has no effect.
+        //
+        // Plan:
+        //: 1 Using a table-based approach, tokenize each of a set of inputs
+        //:   both in place and from a 'bdlsb::FixedMemInStreamBuf', advancing
+        //:   the two tokenizers in lockstep until both fail, and verify that
+        //:   the status codes, token types, and values match, and that each
+        //:   value of the in-place tokenizer refers into the input.  Also
+        //:   tokenize a generated document having a string several times
+        //:   longer than the internal buffer.  (C-1..3)
+        //:
+        //: 2 Supply a test allocator to the in-place tokenizer and verify
+        //:   that no memory is allocated from it, or from the default
+        //:   allocator, while tokenizing.  (C-4)
+        //:
+        //: 3 Tokenize an object followed by other data, and verify the values
+        //:   returned by 'readOffset' and 'resetStreamBufGetPointer'.  (C-5)
+        //
+        // Testing:
+        //   void reset(const char *data, bsl::size_t length);
+        //   bsl::size_t readOffset() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'reset(const char *, bsl::size_t)'"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        static const struct {
+            int         d_line;   // source line number
+            const char *d_input;  // JSON data
+        } DATA[] = {
+            //LINE  INPUT
+            //----  -----
+            { L_,   ""                                                     },
+            { L_,   "   "                                                  },
+            { L_,   "{}"                                                   },
+            { L_,   "[]"                                                   },
+            { L_,   "123"                                                  },
+            { L_,   " -1.5e3 "                                             },
+            { L_,   "\"abc\""                                              },
+            { L_,   "\"a\\\"b\""                                           },
+            { L_,   "\"abc"                                                },
+            { L_,   "\"abc\\"                                              },
+            { L_,   "\"abc\\\""                                            },
+            { L_,   "{\"a\":1,\"b\":\"x\\\\\",\"c\":[true,false,null]}"    },
+            { L_,   "{ \"a\" : { \"b\" : [ 1 , 2 ] } , \"c\" : \"\" }"     },
+            { L_,   "{\"a\"}"                                              },
+            { L_,   "{\"a\" 1}"                                            },
+            { L_,   "[1,,2]"                                               },
+            { L_,   "{\"a\":1} trailing"                                   },
+            { L_,   "[\"unterminated]"                                     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bsl::vector<bsl::string> inputs;
+        bsl::vector<int>         lines;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            inputs.push_back(DATA[ti].d_input);
+            lines.push_back(DATA[ti].d_line);
+        }
+
+        {
+            bsl::string input("{ \"name\" : \"");
+            for (int i = 0; i < 3 * 8 * 1024; ++i) {
+                input += 0 == i % 37 ? "\\\"" : "z";
+            }
+            input += "\", \"values\" : [ 1, 2.5, \"x\" ] }";
+            inputs.push_back(input);
+            lines.push_back(L_);
+
+            input.resize(input.length() / 2);
+            inputs.push_back(input);
+            lines.push_back(L_);
+        }
+
+        for (bsl::size_t ti = 0; ti < inputs.size(); ++ti) {
+            const int          LINE  = lines[ti];
+            const bsl::string& INPUT = inputs[ti];
+            const char        *BEGIN = INPUT.data();
+            const char        *END   = BEGIN + INPUT.length();
+
+            if (veryVerbose) { P(LINE) }
+
+            bdlsb::FixedMemInStreamBuf isb(BEGIN, INPUT.length());
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            bslma::TestAllocator         oa("object",  veryVeryVerbose);
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            const Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            mY.reset(BEGIN, INPUT.length());
+
+            for (int numTokens = 0; ; ++numTokens) {
+                const int RCX = mX.advanceToNextToken();
+                const int RCY = mY.advanceToNextToken();
+
+                ASSERTV(LINE, numTokens, RCX, RCY, RCX == RCY);
+                ASSERTV(LINE, numTokens, X.tokenType(), Y.tokenType(),
+                        X.tokenType() == Y.tokenType());
+
+                if (RCX || RCY) {
+                    break;
+                }
+
+                bslstl::StringRef valueX;
+                bslstl::StringRef valueY;
+
+                const int VRCX = X.value(&valueX);
+                const int VRCY = Y.value(&valueY);
+
+                ASSERTV(LINE, numTokens, VRCX, VRCY, VRCX == VRCY);
+
+                if (0 == VRCY) {
+                    ASSERTV(LINE, numTokens, valueX, valueY,
+                            valueX == valueY);
+                    ASSERTV(LINE, numTokens,
+                            BEGIN <= valueY.begin() && valueY.end() <= END);
+                }
+            }
+
+            ASSERTV(LINE, NUM_BLOCKS == oa.numBlocksTotal());
+            ASSERTV(LINE, 0          == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting 'readOffset'." << endl;
+        {
+            const bsl::string INPUT("{\"a\":1} trailing");
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(INPUT.data(), INPUT.length());
+
+            ASSERT(0                    == X.readOffset());
+
+            ASSERT(0                    == mX.advanceToNextToken());
+            ASSERT(Obj::e_START_OBJECT  == X.tokenType());
+            ASSERT(1                    == X.readOffset());
+
+            ASSERT(0                    == mX.advanceToNextToken());
+            ASSERT(0                    == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == X.tokenType());
+            ASSERT(6                    == X.readOffset());
+
+            ASSERT(0                    == mX.advanceToNextToken());
+            ASSERT(Obj::e_END_OBJECT    == X.tokenType());
+            ASSERT(7                    == X.readOffset());
+
+            ASSERT(0                    == mX.resetStreamBufGetPointer());
+            ASSERT(7                    == X.readOffset());
+        }
+      } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // CONCERN: SCANNING ACROSS BLOCK AND BUFFER BOUNDARIES
+        //
+        // Concerns:
+        //: 1 The end of a string is found wherever it falls relative to the
+        //:   32-byte blocks that are scanned together and to the end of the
+        //:   internal buffer, including when the string is longer than the
+        //:   buffer.
+        //:
+        //: 2 An escaped '"' does not end a string, and an escaped '\' does
+        //:   not escape the following character, including when the '\' and
+        //:   the character it escapes are in different blocks or are read
+        //:   from the stream by different reads.
+        //:
+        //: 3 Whitespace runs and unquoted values are skipped correctly
+        //:   wherever they fall relative to blocks and the buffer.
+        //
+        // Plan:
+        //: 1 Create a set of string contents of various lengths having escape
+        //:   sequences at various positions, including at their ends.
+        //:
+        //: 2 For each content of P-1, and for each of a range of lengths of
+        //:   leading whitespace that places the string near the end of the
+        //:   first buffer load, tokenize an array holding the string and a
+        //:   number separated by whitespace runs of various lengths, and
+        //:   verify the tokens and their values.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: SCANNING ACROSS BLOCK AND BUFFER BOUNDARIES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: SCANNING ACROSS BLOCK AND BUFFER "
+                          << "BOUNDARIES" << endl
+                          << "=========================================="
+                          << "==========" << endl;
+
+        const int k_BUFFER_SIZE = 8 * 1024 - 1;  // as in the implementation
+
+        bsl::vector<bsl::string> contents;
+
+        contents.push_back("");
+        contents.push_back("a");
+        contents.push_back("\\\"");
+        contents.push_back("\\\\");
+        contents.push_back("\\\\\\\"");
+        contents.push_back("abc\\\\");
+        contents.push_back("\\u0041\\n");
+
+        for (int length = 1; length <= 70; length += 3) {
+            for (int position = 0; position < length; position += 7) {
+                bsl::string content(length, 'x');
+                content.replace(position, 1, "\\\"");
+                contents.push_back(content);
+
+                content.assign(length, 'y');
+                content.replace(position, 1, "\\\\");
+                contents.push_back(content);
+            }
+        }
+
+        {
+            bsl::string content;
+            for (int i = 0; i < 3 * k_BUFFER_SIZE; ++i) {
+                content += 0 == i % 37 ? "\\\"" : 0 == i % 41 ? "\\\\" : "z";
+            }
+            contents.push_back(content);
+        }
+
+        const char *const SEPARATORS[] = {
+            "",
+            " ",
+            "\t\n\r ",
+            "\n                                                       \t ",
+        };
+        const int NUM_SEPARATORS = sizeof SEPARATORS / sizeof *SEPARATORS;
+
+        for (bsl::size_t ci = 0; ci < contents.size(); ++ci) {
+            const bsl::string& CONTENT = contents[ci];
+            const bsl::string  STRING  = '"' + CONTENT + '"';
+
+            for (int padding = k_BUFFER_SIZE - 40;
+                 padding < k_BUFFER_SIZE + 2;
+                 ++padding) {
+                for (int si = 0; si < NUM_SEPARATORS; ++si) {
+                    const char *const SEPARATOR = SEPARATORS[si];
+
+                    bsl::string input(padding, ' ');
+                    input += '[';
+                    input += SEPARATOR;
+                    input += STRING;
+                    input += SEPARATOR;
+                    input += ',';
+                    input += SEPARATOR;
+                    input += "-12.5e3";
+                    input += SEPARATOR;
+                    input += ']';
+
+                    if (veryVeryVerbose) { P_(ci) P_(padding) P(si) }
+
+                    bdlsb::FixedMemInStreamBuf isb(input.data(),
+                                                   input.length());
+
+                    Obj               mX;  const Obj& X = mX;
+                    bslstl::StringRef value;
+
+                    mX.reset(&isb);
+
+                    ASSERTV(ci, padding, si, 0 == mX.advanceToNextToken());
+                    ASSERTV(ci, padding, si,
+                            Obj::e_START_ARRAY == X.tokenType());
+
+                    ASSERTV(ci, padding, si, 0 == mX.advanceToNextToken());
+                    ASSERTV(ci, padding, si,
+                            Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(ci, padding, si, 0 == X.value(&value));
+                    ASSERTV(ci, padding, si, STRING == value);
+
+                    ASSERTV(ci, padding, si, 0 == mX.advanceToNextToken());
+                    ASSERTV(ci, padding, si,
+                            Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(ci, padding, si, 0 == X.value(&value));
+                    ASSERTV(ci, padding, si, value, "-12.5e3" == value);
+
+                    ASSERTV(ci, padding, si, 0 == mX.advanceToNextToken());
+                    ASSERTV(ci, padding, si,
+                            Obj::e_END_ARRAY == X.tokenType());
+                }
+            }
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // TESTING that arrays of heterogenous types are handled correctly
@@ -6814,6 +7130,126 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Tokenizing a large document is fast.
+        //
+        // Plan:
+        //: 1 Load the JSON document named by the second command line argument
+        //:   if it can be read; otherwise, generate a document of about 32 MB
+        //:   resembling a typical API response: a pretty-printed array of
+        //:   records having short names, long text fields (with occasional
+        //:   escape sequences), numbers, booleans, and nested arrays.
+        //:
+        //: 2 Tokenize the document several times, both from a 'streambuf' and
+        //:   in place, and report the throughput of the fastest run of each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bsl::string document;
+
+        if (argc > 2) {
+            bsl::ifstream file(argv[2], bsl::ios::binary);
+            if (file) {
+                bsl::ostringstream contents;
+                contents << file.rdbuf();
+                document = contents.str();
+            }
+        }
+
+        if (document.empty()) {
+            const char *const WORDS[] = {
+                "the", "quick", "brown", "fox", "jumps", "over", "lazy",
+                "dog", "\\\"quoted\\\"", "caf\\u00e9", "line\\nbreak",
+                "https:\\/\\/example.com\\/path"
+            };
+            const int NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+            bsl::ostringstream out;
+            unsigned int       seed = 12345;
+
+            out << "[\n";
+            for (int record = 0; out.tellp() < 32 * 1024 * 1024; ++record) {
+                if (record) {
+                    out << ",\n";
+                }
+
+                out << "  {\n"
+                    << "    \"id\": " << 1000000 + record << ",\n"
+                    << "    \"price\": " << record * 0.37 << ",\n"
+                    << "    \"active\": " << (record % 3 ? "true" : "false")
+                    << ",\n"
+                    << "    \"text\": \"";
+
+                seed = seed * 1103515245 + 12345;
+                const int numWords = 20 + static_cast<int>(seed >> 16) % 60;
+                for (int w = 0; w < numWords; ++w) {
+                    seed = seed * 1103515245 + 12345;
+                    out << (w ? " " : "")
+                        << WORDS[static_cast<int>(seed >> 16) % NUM_WORDS];
+                }
+
+                out << "\",\n"
+                    << "    \"tags\": [\"alpha\", \"beta\", \"gamma\"],\n"
+                    << "    \"location\": { \"lat\": 40.7128,"
+                    << " \"lon\": -74.0060 }\n"
+                    << "  }";
+            }
+            out << "\n]\n";
+
+            document = out.str();
+        }
+
+        const int k_NUM_RUNS = 5;
+
+        cout << "document: " << document.length() << " bytes" << endl;
+
+        for (int inPlace = 0; inPlace < 2; ++inPlace) {
+            Int64 bestTime  = 0;
+            int   numTokens = 0;
+
+            for (int run = 0; run < k_NUM_RUNS; ++run) {
+                bdlsb::FixedMemInStreamBuf isb(document.data(),
+                                               document.length());
+
+                Obj mX;
+                if (inPlace) {
+                    mX.reset(document.data(), document.length());
+                }
+                else {
+                    mX.reset(&isb);
+                }
+
+                numTokens = 0;
+
+                const Int64 start = bsls::TimeUtil::getTimer();
+                while (0 == mX.advanceToNextToken()) {
+                    ++numTokens;
+                }
+                const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+                if (0 == run || elapsed < bestTime) {
+                    bestTime = elapsed;
+                }
+            }
+
+            cout << (inPlace ? "in place:  " : "streambuf: ")
+                 << numTokens << " tokens, best of " << k_NUM_RUNS << ": "
+                 << static_cast<double>(bestTime) / 1e6 << " ms, "
+                 << static_cast<double>(document.length()) * 1e3
+                                               / static_cast<double>(bestTime)
+                 << " MB/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -18,11 +18,15 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bslmt_lockguard.h>
 #include <bslmt_threadattributes.h>
 
+#include <bslmf_movableref.h>
+
 #include <bsls_assert.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -85,19 +89,46 @@ void AsyncFileObserver::publishThreadEntryPoint()
     d_droppedRecordWarning.fixedFields().setThreadID(
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
-    while (!done) {
-        AsyncFileObserver_Record asyncRecord = d_recordQueue.popFront();
+    bsl::vector<AsyncFileObserver_Record> batch(k_MAX_BATCH_SIZE,
+                                                d_allocator_p);
+    bsl::vector<const Record *>           records(k_MAX_BATCH_SIZE,
+                                                  d_allocator_p);
 
-        // Publish the next log record on the queue only if the observer is not
-        // shutting down.
+    while (!done) {
+        bsl::size_t numPopped;
+        d_recordQueue.popFrontBatch(batch.data(),
+                                    k_MAX_BATCH_SIZE,
+                                    &numPopped);
+
+        // Publish the log records removed from the queue only if the observer
+        // is not shutting down.  Records queued after the 'e_END' record
+        // (pushed by 'stopThread') are published, rather than lost, since
+        // they have already been removed from the queue.
+
+        bsl::size_t numRecords = 0;
+
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            if (Transmission::e_END ==
+                                    batch[i].d_context.transmissionCause()) {
+                done = true;
+            }
+            else {
+                records[numRecords++] = batch[i].d_record.get();
+            }
+        }
 
-        if (Transmission::e_END == asyncRecord.d_context.transmissionCause()
-            || d_shuttingDownFlag) {
+        if (d_shuttingDownFlag) {
             done = true;
         }
-        else {
-            d_fileObserver.publish(*asyncRecord.d_record,
-                                   asyncRecord.d_context);
+        else if (0 < numRecords) {
+            d_fileObserver.publishBatch(records.data(), numRecords);
+        }
+
+        // Release the records promptly, rather than when the slots of 'batch'
+        // are next overwritten.
+
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            batch[i].d_record.reset();
         }
 
         // Publish the count of dropped records.  To avoid repeatedly
@@ -272,13 +303,17 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
     asyncRecord.d_record  = record;
     asyncRecord.d_context = context;
 
+    // Move the record into its slot in the queue, so that the reference count
+    // of 'record' is updated only once.
+
     if (record->fixedFields().severity() > d_dropRecordsOnFullQueueThreshold) {
-        if (0 != d_recordQueue.tryPushBack(asyncRecord)) {
+        if (0 != d_recordQueue.tryPushBack(
+                               bslmf::MovableRefUtil::move(asyncRecord))) {
             d_dropCount.addRelaxed(1);
         }
     }
     else {
-        d_recordQueue.pushBack(asyncRecord);
+        d_recordQueue.pushBack(bslmf::MovableRefUtil::move(asyncRecord));
     }
 }
 
@@ -36,11 +36,13 @@ BSLS_IDENT("$Id: $")
 //            ( ball::AsyncFileObserver )
 //             `-----------------------'
 //                         |              ctor
+//                         |              disableFileCompression
 //                         |              disableFileLogging
 //                         |              disablePublishInLocalTime
 //                         |              disableSizeRotation
 //                         |              disableStdoutLoggingPrefix
 //                         |              disableTimeIntervalRotation
+//                         |              enableFileCompression
 //                         |              enableFileLogging
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
@@ -48,12 +50,14 @@ BSLS_IDENT("$Id: $")
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFormat
+//                         |              setOnFileCompressionCallback
 //                         |              setOnFileRotationCallback
 //                         |              setStdoutThreshold
 //                         |              shutdownPublicationThread
 //                         |              startPublicationThread
 //                         |              stopPublicationThread
 //                         |              getLogFormat
+//                         |              isFileCompressionEnabled
 //                         |              isFileLoggingEnabled
 //                         |              isPublicationThreadRunning
 //                         |              isPublishInLocalTimeEnabled
@@ -121,6 +125,10 @@ BSLS_IDENT("$Id: $")
 // |             | disableTimeIntervalRotation |                              |
 // |             | setOnFileRotationCallback   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | Rotated Log | enableFileCompression       | isFileCompressionEnabled     |
+// | File        | disableFileCompression      |                              |
+// | Compression | setOnFileCompressionCallback|                              |
+// +-------------+-----------------------------+------------------------------+
 // | Publication | startPublicationThread      | isPublicationThreadRunning   |
 // | Thread      | stopPublicationThread       |                              |
 // | Management  | shutdownPublicationThread   |                              |
@@ -164,6 +172,16 @@ BSLS_IDENT("$Id: $")
 // record count is reset to 0 after each such warning is published, so each
 // dropped record is counted only once.
 //
+// The publication thread removes the records from the queue in batches (of up
+// to 'k_MAX_BATCH_SIZE' records, as many as are queued), and writes each
+// batch to the log file, and to 'stdout', with a single flush of each (see
+// 'ball::FileObserver::publishBatch').  Hence, when records are published
+// faster than they can be written, the cost of synchronizing with the queue
+// and of the system calls writing the log file is shared by the records of a
+// batch.  Note that 'publish' moves the supplied shared pointer into a slot
+// of the (preallocated) queue, so that no memory is allocated, and the
+// record itself is not copied, when a record is queued.
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records (whether to 'stdout'
@@ -331,6 +349,16 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Rotated Log File Compression
+///----------------------------
+// A 'ball::AsyncFileObserver' may be configured, by calling
+// 'enableFileCompression', to compress each log file it successfully rotates
+// in the gzip format.  The compression is performed on a background thread of
+// low priority, distinct from the publication thread, so that the publication
+// of log records is not delayed by the compression.  The rotated log file,
+// 'F', is replaced by the compressed file 'F.gz' once the compression
+// completes.  (See {'ball_fileobserver2'} for details.)
+//
 ///Thread Safety
 ///-------------
 // All public methods of 'ball::AsyncFileObserver' are thread-safe, and can be
@@ -515,6 +543,14 @@ class AsyncFileObserver : public Observer {
     // can operate on an object concurrently.  This class is exception-neutral
     // with no guarantee of rollback.  In no event is memory leaked.
 
+  public:
+    // CONSTANTS
+    enum {
+        k_MAX_BATCH_SIZE = 256  // maximum number of records removed from the
+                                // queue, and written, at once
+    };
+
+  private:
     // DATA
     FileObserver                   d_fileObserver;   // forward most public
                                                      // method calls to this
@@ -579,8 +615,9 @@ class AsyncFileObserver : public Observer {
         // threads, i.e., it is *not* thread-safe.
 
     void publishThreadEntryPoint();
-        // Publish records from the record queue, to the log file and 'stdout',
-        // until signaled to stop.  The behavior is undefined if this method is
+        // Publish records from the record queue, in batches of up to
+        // 'k_MAX_BATCH_SIZE' records, to the log file and 'stdout', until
+        // signaled to stop.  The behavior is undefined if this method is
         // invoked concurrently from multiple threads, i.e., it is *not*
         // thread-safe.  Note that this function is the entry point for the
         // publication thread.
@@ -621,6 +658,14 @@ class AsyncFileObserver : public Observer {
         //                         const bsl::string& rotatedLogFileName);
         //..
 
+    typedef FileObserver::OnFileCompressionCallback OnFileCompressionCallback;
+        // 'OnFileCompressionCallback' is an alias for a user-supplied callback
+        // function that is invoked, on a background thread, after the async
+        // file observer attempts to compress a rotated log file.  The callback
+        // takes three arguments: (1) an integer status value where 0 indicates
+        // the file was successfully compressed, (2) the name of the rotated
+        // log file, and (3) the name of the compressed file.
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(AsyncFileObserver,
                                    bslma::UsesBslmaAllocator);
@@ -702,6 +747,12 @@ class AsyncFileObserver : public Observer {
         // async file observer.
 
     // MANIPULATORS
+    void disableFileCompression();
+        // Disable the compression of the log files subsequently rotated by
+        // this async file observer.  This method has no effect if compression
+        // is not enabled.  Note that the rotated log files already queued for
+        // compression are still compressed.
+
     void disableFileLogging();
         // Disable file logging for this async file observer.  This method has
         // no effect if file logging is not enabled.  Calling this method will
@@ -740,6 +791,14 @@ class AsyncFileObserver : public Observer {
         // async file observer.  This method has no effect if
         // rotation-on-time-interval is not enabled.
 
+    void enableFileCompression();
+        // Enable the compression, in the gzip format and on a background
+        // thread, of each log file subsequently rotated (successfully) by this
+        // async file observer.  The rotated log file, 'F', is replaced by a
+        // compressed file named 'F.gz' once the compression completes.  This
+        // method has no effect if compression is already enabled.  See
+        // {Rotated Log File Compression}.
+
     int enableFileLogging(const char *logFilenamePattern);
         // Enable logging of all records published to this async file observer
         // to a file whose name is derived from the specified
@@ -857,6 +916,14 @@ class AsyncFileObserver : public Observer {
         // received through the 'publish' method as well as those that are
         // currently on the queue.
 
+    void setOnFileCompressionCallback(
+                       const OnFileCompressionCallback& onCompressionCallback);
+        // Set the specified 'onCompressionCallback' to be invoked, on the
+        // background thread compressing the rotated log files, after each
+        // time this async file observer attempts to compress a rotated log
+        // file.  The behavior is undefined if the supplied function calls
+        // 'setOnFileCompressionCallback' on this async file observer.
+
     void setOnFileRotationCallback(
                              const OnFileRotationCallback& onRotationCallback);
         // Set the specified 'onRotationCallback' to be invoked after each time
@@ -909,6 +976,10 @@ class AsyncFileObserver : public Observer {
         // Record Formatting} for details on the syntax of format
         // specifications.
 
+    bool isFileCompressionEnabled() const;
+        // Return 'true' if the log files rotated by this async file observer
+        // are compressed, and 'false' otherwise.
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
         // Return 'true' if file logging is enabled for this async file
@@ -985,6 +1056,12 @@ class AsyncFileObserver : public Observer {
                           // -----------------------
 
 // MANIPULATORS
+inline
+void AsyncFileObserver::disableFileCompression()
+{
+    d_fileObserver.disableFileCompression();
+}
+
 inline
 void AsyncFileObserver::disableFileLogging()
 {
@@ -1015,6 +1092,12 @@ void AsyncFileObserver::disableTimeIntervalRotation()
     d_fileObserver.disableTimeIntervalRotation();
 }
 
+inline
+void AsyncFileObserver::enableFileCompression()
+{
+    d_fileObserver.enableFileCompression();
+}
+
 inline
 int AsyncFileObserver::enableFileLogging(const char *logFilenamePattern)
 {
@@ -1067,6 +1150,13 @@ void AsyncFileObserver::setLogFormat(const char *logFileFormat,
     d_fileObserver.setLogFormat(logFileFormat, stdoutFormat);
 }
 
+inline
+void AsyncFileObserver::setOnFileCompressionCallback(
+                        const OnFileCompressionCallback& onCompressionCallback)
+{
+    d_fileObserver.setOnFileCompressionCallback(onCompressionCallback);
+}
+
 inline
 void AsyncFileObserver::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
@@ -1088,6 +1178,12 @@ void AsyncFileObserver::getLogFormat(const char **logFileFormat,
     d_fileObserver.getLogFormat(logFileFormat, stdoutFormat);
 }
 
+inline
+bool AsyncFileObserver::isFileCompressionEnabled() const
+{
+    return d_fileObserver.isFileCompressionEnabled();
+}
+
 inline
 bool AsyncFileObserver::isFileLoggingEnabled() const
 {
@@ -6,6 +6,8 @@
 #include <ball_loggermanagerconfiguration.h>
 #include <ball_streamobserver.h>
 
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
 #include <bdls_processutil.h>
@@ -24,6 +26,7 @@
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_semaphore.h>
 
 #include <bsls_assert.h>
 #include <bsls_platform.h>
@@ -37,8 +40,11 @@
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>       // 'time_t'
 #include <bsl_iomanip.h>     // 'setfill'
+#include <bsl_fstream.h>
 #include <bsl_iostream.h>
+#include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>    // 'unsetenv'
 
@@ -87,11 +93,13 @@ using bsl::flush;
 // [ 2] ~AsyncFileObserver();
 //
 // MANIPULATORS
+// [13] void disableFileCompression();
 // [ 1] void disableFileLogging();
 // [ X] void disablePublishInLocalTime();
 // [ 6] void disableSizeRotation();
 // [ 1] void disableStdoutLoggingPrefix();
 // [ 6] void disableTimeIntervalRotation();
+// [13] void enableFileCompression();
 // [ 1] int enableFileLogging(const char *logFilenamePattern);
 // [ 1] void enableStdoutLoggingPrefix();
 // [ 1] void enablePublishInLocalTime();
@@ -104,6 +112,7 @@ using bsl::flush;
 // [ 6] void rotateOnTimeInterval(const DatetimeInterval timeInterval);
 // [ 6] void rotateOnTimeInterval(const DatetimeI&, const Datetime&);
 // [ 1] void setLogFormat(const char* logF, const char* stdoutF);
+// [13] void setOnFileCompressionCallback(const OnFileCompressionCb&);
 // [ 8] void setOnFileRotationCallback(const OnFileRotationCallback&);
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold);
 // [ 3] void shutdownPublicationThread();
@@ -112,6 +121,7 @@ using bsl::flush;
 //
 // ACCESSORS
 // [ 1] void getLogFormat(const char** logF, const char** stdoutF) const;
+// [13] bool isFileCompressionEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 3] bool isPublicationThreadRunning() const;
@@ -124,11 +134,13 @@ using bsl::flush;
 // [ 1] ball::Severity::Level stdoutThreshold() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [12] CONCERN: BATCHED PUBLICATION
 // [10] CONCERN: CONCURRENT PUBLICATION
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [12] USAGE EXAMPLE
+// [13] CONCERN: ROTATED LOG FILE COMPRESSION
+// [14] USAGE EXAMPLE
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -534,6 +546,21 @@ class LogRotationCallbackTester {
 
 typedef LogRotationCallbackTester RotCb;
 
+void onCompression(int               *status,
+                   bsl::string       *compressedName,
+                   bslmt::Semaphore  *semaphore,
+                   int                compressionStatus,
+                   const bsl::string&,
+                   const bsl::string& compressedFileName)
+    // Load the specified 'compressionStatus' and 'compressedFileName' into the
+    // specified 'status' and 'compressedName', and post the specified
+    // 'semaphore'.
+{
+    *status         = compressionStatus;
+    *compressedName = compressedFileName;
+    semaphore->post();
+}
+
 }  // close unnamed namespace
 
 
@@ -623,7 +650,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 12: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -775,6 +802,189 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // CONCERN: ROTATED LOG FILE COMPRESSION
+        //
+        // Concerns:
+        //: 1 The methods configuring the compression of rotated log files
+        //:   are forwarded to the underlying file observer.
+        //
+        // Plan:
+        //: 1 Enable and disable compression, and verify the value returned by
+        //:   'isFileCompressionEnabled'.  Enable compression, set a
+        //:   compression callback, and force a rotation.  Wait for the
+        //:   callback, and verify that the rotated log file is replaced by a
+        //:   compressed file.  (C-1)
+        //
+        // Testing:
+        //   void disableFileCompression();
+        //   void enableFileCompression();
+        //   void setOnFileCompressionCallback(const OnFileCompressionCb&);
+        //   bool isFileCompressionEnabled() const;
+        //   CONCERN: ROTATED LOG FILE COMPRESSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: ROTATED LOG FILE COMPRESSION"
+                          << "\n=====================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "compressed.%T");
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        int              status = -1;
+        bsl::string      compressedFileName;
+        bslmt::Semaphore semaphore;
+        {
+            RotCb cb(&ta);
+
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isFileCompressionEnabled());
+
+            mX.enableFileCompression();
+            ASSERT(true  == X.isFileCompressionEnabled());
+
+            mX.disableFileCompression();
+            ASSERT(false == X.isFileCompressionEnabled());
+
+            mX.enableFileCompression();
+            mX.setOnFileRotationCallback(cb);
+            mX.setOnFileCompressionCallback(
+                            bdlf::BindUtil::bind(&onCompression,
+                                                 &status,
+                                                 &compressedFileName,
+                                                 &semaphore,
+                                                 bdlf::PlaceHolders::_1,
+                                                 bdlf::PlaceHolders::_2,
+                                                 bdlf::PlaceHolders::_3));
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            // Wait for the name of the rotated file to differ from the name
+            // of the new log file.
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+
+            mX.forceRotation();
+
+            ASSERT(1 == cb.numInvocations());
+            ASSERT(0 == cb.status());
+
+            semaphore.wait();
+
+            if (veryVerbose) { T_ P_(status) P(compressedFileName) }
+
+            ASSERTV(status, 0 == status);
+            ASSERTV(compressedFileName, cb.rotatedFileName(),
+                    cb.rotatedFileName() + ".gz" == compressedFileName);
+            ASSERT(false == FsUtil::exists(cb.rotatedFileName()));
+            ASSERT(true  == FsUtil::exists(compressedFileName));
+
+            mX.disableFileLogging();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING BATCHED PUBLICATION
+        //
+        // Concerns:
+        //: 1 The records accumulated in the queue are published, in the order
+        //:   in which they were queued, when they are removed from the queue
+        //:   in batches.
+        //:
+        //: 2 The records queued before 'stopPublicationThread' is called are
+        //:   all published.
+        //:
+        //: 3 The observer releases its references to the published records.
+        //
+        // Plan:
+        //: 1 With the publication thread stopped, publish a number of records
+        //:   larger than the maximum size of a batch, having sequential
+        //:   messages.  Start, then stop, the publication thread, and verify
+        //:   that the log file holds all the messages, in order.  (C-1..2)
+        //:
+        //: 2 Verify that the use count of each published record is 1.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+        if (verbose) cout << "\nTESTING BATCHED PUBLICATION"
+                          << "\n===========================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "testLog");
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        const int k_NUM_RECORDS = 5 * Obj::k_MAX_BATCH_SIZE + 7;
+
+        Obj mX(ball::Severity::e_OFF,
+               false,
+               2 * k_NUM_RECORDS,
+               ball::Severity::e_TRACE,
+               &ta);
+
+        mX.setLogFormat("%m\n", "%m\n");
+
+        ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records;
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream message;
+            message << i;
+
+            bsl::shared_ptr<ball::Record> record =
+                                       bsl::allocate_shared<ball::Record>(&ta);
+
+            record->fixedFields().setSeverity(ball::Severity::e_INFO);
+            record->fixedFields().setMessage(message.str().c_str());
+
+            records.push_back(record);
+
+            mX.publish(record, context);
+        }
+
+        ASSERTV(mX.recordQueueLength(),
+                k_NUM_RECORDS == mX.recordQueueLength());
+
+        ASSERT(0 == mX.startPublicationThread());
+        ASSERT(0 == mX.stopPublicationThread());
+
+        mX.disableFileLogging();
+
+        ASSERT(0 == mX.recordQueueLength());
+
+        bsl::ifstream fs(fileName.c_str());
+        ASSERT(fs.is_open());
+
+        bsl::string line;
+        int         numLines = 0;
+
+        while (getline(fs, line)) {
+            bsl::ostringstream expected;
+            expected << numLines;
+
+            ASSERTV(numLines, line, expected.str() == line);
+
+            ++numLines;
+        }
+
+        ASSERTV(numLines, k_NUM_RECORDS == numLines);
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            ASSERTV(i, records[i].use_count(), 1 == records[i].use_count());
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'recordQueueLength'
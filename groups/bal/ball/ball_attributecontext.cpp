@@ -50,6 +50,11 @@ BSLS_IDENT_RCSID(ball_attributecontext_cpp,"$Id$ $CSID$")
 // lock would need to be held (until the message was actually written to the
 // log).
 //
+// The same applies to the maximum threshold level of the rules active for the
+// current thread ('d_activeRulesThreshold'), which 'isCategoryEnabled' uses,
+// along with the rule set sequence number for which it was computed, to
+// reject a severity without evaluating the rules relevant to a category.
+//
 ///'initialize' and 'reset'
 ///------------------------
 // Although there is no lock in the implementation of this component, the
@@ -174,6 +179,8 @@ bslma::Allocator *AttributeContext::s_globalAllocator_p = 0;
 // PRIVATE CREATORS
 AttributeContext::AttributeContext(bslma::Allocator *globalAllocator)
 : d_containerList(bslma::Default::globalAllocator(globalAllocator))
+, d_thresholdSequenceNumber(-1)
+, d_activeRulesThreshold(0)
 , d_allocator_p(bslma::Default::globalAllocator(globalAllocator))
 {
 }
@@ -182,6 +189,46 @@ AttributeContext::~AttributeContext()
 {
 }
 
+// PRIVATE ACCESSORS
+void AttributeContext::updateActiveRulesThreshold() const
+{
+    bslmt::LockGuard<bslmt::Mutex> ruleGuard(
+                                         &s_categoryManager_p->rulesetMutex());
+
+    const bsls::Types::Int64 sequenceNumber =
+                                  s_categoryManager_p->ruleSetSequenceNumber();
+    const RuleSet&           rules = s_categoryManager_p->ruleSet();
+
+    RuleSet::MaskType activeRules = d_ruleCache_p.update(
+                                                  sequenceNumber,
+                                                  ~RuleSet::MaskType(0),
+                                                  rules,
+                                                  d_containerList);
+
+    int threshold = 0;
+    int i;
+    while ((i = bdlb::BitUtil::numTrailingUnsetBits(activeRules))
+                                                 != RuleSet::e_MAX_NUM_RULES) {
+        const Rule *rule = rules.getRuleById(i);
+
+        if (rule) {
+            const int ruleThreshold = ThresholdAggregate::maxLevel(
+                                                      rule->recordLevel(),
+                                                      rule->passLevel(),
+                                                      rule->triggerLevel(),
+                                                      rule->triggerAllLevel());
+            if (threshold < ruleThreshold) {
+                threshold = ruleThreshold;
+            }
+        }
+
+        activeRules &= ~(1 << i);
+    }
+
+    d_activeRulesThreshold    = threshold;
+    d_thresholdSequenceNumber = sequenceNumber;
+}
+
 // PRIVATE CLASS METHODS
 const bslmt::ThreadUtil::Key& AttributeContext::contextKey()
 {
@@ -404,6 +451,39 @@ AttributeContext::determineThresholdLevels(ThresholdAggregate *levels,
     }
 }
 
+bool AttributeContext::isCategoryEnabled(const Category *category,
+                                         int             severity) const
+{
+    BSLS_ASSERT(category);
+
+    if (category->maxLevel() >= severity) {
+        return true;                                                  // RETURN
+    }
+
+    if (!category->relevantRuleMask()) {
+        return false;                                                 // RETURN
+    }
+
+    // The 'rulesetMutex' is intentionally *not* locked before checking the
+    // cached threshold (see implementation note at the top).  No rule can
+    // enable 'severity' if none of the rules active for this thread has a
+    // threshold level at least as high.
+
+    if (d_thresholdSequenceNumber !=
+                               s_categoryManager_p->ruleSetSequenceNumber()) {
+        updateActiveRulesThreshold();
+    }
+
+    if (d_activeRulesThreshold < severity) {
+        return false;                                                 // RETURN
+    }
+
+    ThresholdAggregate levels;
+    determineThresholdLevels(&levels, category);
+
+    return ThresholdAggregate::maxLevel(levels) >= severity;
+}
+
 // ACCESSORS
 bsl::ostream& AttributeContext::print(bsl::ostream& stream,
                                       int           level,
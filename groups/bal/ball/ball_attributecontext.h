@@ -495,6 +495,20 @@ class AttributeContext {
     mutable RuleEvaluationCache
                              d_ruleCache_p;        // cache of rule evaluations
 
+    mutable bsls::Types::Int64
+                             d_thresholdSequenceNumber;
+                                                   // rule set sequence number
+                                                   // for which
+                                                   // 'd_activeRulesThreshold'
+                                                   // was computed, or -1 if
+                                                   // it is out of date
+
+    mutable int              d_activeRulesThreshold;
+                                                   // maximum threshold level
+                                                   // of the rules active for
+                                                   // this thread, regardless
+                                                   // of their relevance
+
     bslma::Allocator        *d_allocator_p;        // allocator used to create
                                                    // this object (held, not
                                                    // owned)
@@ -531,6 +545,14 @@ class AttributeContext {
     ~AttributeContext();
         // Destroy this object.
 
+    // PRIVATE ACCESSORS
+    void updateActiveRulesThreshold() const;
+        // Evaluate the rules maintained by the category manager supplied to
+        // the 'initialize' class method against the attributes of this
+        // object, and load the maximum threshold level of the active rules
+        // into 'd_activeRulesThreshold', along with the current rule set
+        // sequence number into 'd_thresholdSequenceNumber'.
+
   public:
     // PUBLIC TYPES
     typedef AttributeContainerList::iterator iterator;
@@ -629,6 +651,22 @@ class AttributeContext {
         // registry maintained by the category manager supplied to
         // 'initialize'.
 
+    bool isCategoryEnabled(const Category *category, int severity) const;
+        // Return 'true' if logging with the specified 'severity' is enabled
+        // for the specified 'category' in the current thread, and 'false'
+        // otherwise.  Logging is enabled if 'severity' is at least as severe
+        // as one of the threshold levels determined by
+        // 'determineThresholdLevels' for 'category'.  This method caches, for
+        // the current rule set sequence number, the maximum threshold level
+        // of the rules that are active for the current thread, so that, as
+        // long as the rules and the attributes of this object are unchanged,
+        // logging disabled by both the thresholds of 'category' and every
+        // active rule is detected without locking the rule set mutex nor
+        // evaluating any rule.  The behavior is undefined unless 'initialize'
+        // has previously been invoked without a subsequent call to 'reset',
+        // and 'category' is contained in the registry maintained by the
+        // category manager supplied to 'initialize'.
+
     bool hasAttribute(const Attribute& value) const;
         // Return 'true' if an attribute having the specified 'value' exists in
         // any of the attribute containers maintained by this object, and
@@ -742,6 +780,7 @@ AttributeContext::addAttributes(const AttributeContainer *attributes)
     BSLS_ASSERT(attributes);
 
     d_ruleCache_p.clear();
+    d_thresholdSequenceNumber = -1;
     return d_containerList.pushFront(attributes);
 }
 
@@ -749,12 +788,14 @@ inline
 void AttributeContext::clearCache()
 {
     d_ruleCache_p.clear();
+    d_thresholdSequenceNumber = -1;
 }
 
 inline
 void AttributeContext::removeAttributes(iterator element)
 {
     d_ruleCache_p.clear();
+    d_thresholdSequenceNumber = -1;
     d_containerList.remove(element);
 }
 
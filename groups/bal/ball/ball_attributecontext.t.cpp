@@ -71,6 +71,7 @@ using namespace bsl;
 // [ 3] void removeAttributes(iterator element);
 // [ 4] bool hasRelevantActiveRules(const Cat *cat) const;
 // [ 4] void determineThresholdLevels(TL *lvls, const Cat *cat) const;
+// [ 7] bool isCategoryEnabled(const Cat *cat, int severity) const;
 // [ 3] bool hasAttribute(const Attribute& value) const;
 // [ 3] const AttributeContainerList& containers() const;
 // [  ] bsl::ostream& print(bsl::ostream& stream, int level, int spl) const;
@@ -82,9 +83,9 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] AttributeSet
 // [ 6] CONCERN: No false positives from 'hasRelevantActiveRules'.
-// [ 7] (OLD) USAGE EXAMPLE
-// [ 8] USAGE EXAMPLE 1
-// [ 9] USAGE EXAMPLE 2
+// [ 8] (OLD) USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE 1
+// [10] USAGE EXAMPLE 2
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -1320,7 +1321,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 2
         //   Extracted from component header file.
@@ -1371,7 +1372,7 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(mainThread);
 
       } break;
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //   Extracted from component header file.
@@ -1403,7 +1404,7 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(threads[0]);
         bslmt::ThreadUtil::join(threads[1]);
       } break;
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING ORIGINAL USAGE EXAMPLE
         //   This test runs the original usage example for this component.  It
@@ -1435,6 +1436,149 @@ int main(int argc, char *argv[])
         bslmt::ThreadUtil::join(mainThread);
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'isCategoryEnabled'
+        //
+        // Concerns:
+        //: 1 'isCategoryEnabled' returns 'true' if and only if the severity is
+        //:   at least as severe as one of the levels returned by
+        //:   'determineThresholdLevels' for the category.
+        //:
+        //: 2 The result reflects a change of the thresholds of the category,
+        //:   of the rule set, and of the attributes of the context.
+        //:
+        //: 3 An active rule that is not relevant to a category does not
+        //:   enable logging for that category.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a category manager having two categories, "A" and "B",
+        //:   and a rule relevant to "A" only, having a predicate on the
+        //:   attribute "uuid".
+        //:
+        //: 2 For a sequence of modifications of the attributes of the context,
+        //:   of the rule set, and of the thresholds of the categories, verify
+        //:   that 'isCategoryEnabled' agrees with the expected result and with
+        //:   'determineThresholdLevels' for every severity.  (C-1..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   bool isCategoryEnabled(const Cat *cat, int severity) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 'isCategoryEnabled'" << endl
+                                  << "===========================" << endl;
+
+        CatMngr manager;
+        Obj::initialize(&manager);
+
+        const ball::Category *CAT_A = manager.addCategory("A", 64, 64, 0, 0);
+        const ball::Category *CAT_B = manager.addCategory("B", 64, 64, 0, 0);
+        ASSERT(CAT_A);
+        ASSERT(CAT_B);
+
+        ball::Rule rule("A", 160, 128, 0, 0);
+        rule.addPredicate(ball::Predicate("uuid", 1));
+
+        Obj *mX = Obj::getContext();  const Obj& X = *mX;
+
+        AttributeSet matching;
+        matching.insert(ball::Attribute("uuid", 1));
+
+        AttributeSet other;
+        other.insert(ball::Attribute("uuid", 2));
+
+        static const struct {
+            int d_line;        // source line number
+            int d_step;        // modification applied before verification
+            int d_thresholdA;  // expected maximum threshold for "A"
+            int d_thresholdB;  // expected maximum threshold for "B"
+        } DATA[] = {
+            //LINE  STEP  THR_A  THR_B
+            //----  ----  -----  -----
+            { L_,     0,    64,    64 },  // no rule
+            { L_,     1,    64,    64 },  // add rule, no attribute
+            { L_,     2,    64,    64 },  // add non-matching attributes
+            { L_,     3,   160,    64 },  // add matching attributes
+            { L_,     4,   160,   192 },  // raise "B" thresholds
+            { L_,     5,   192,   192 },  // raise "A" thresholds
+            { L_,     6,   160,    64 },  // restore category thresholds
+            { L_,     7,    64,    64 },  // remove rule
+            { L_,     8,   160,    64 },  // add rule again
+            { L_,     9,    64,    64 },  // remove matching attributes
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        Obj::iterator matchingIt;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE  = DATA[ti].d_line;
+            const int STEP  = DATA[ti].d_step;
+            const int THR_A = DATA[ti].d_thresholdA;
+            const int THR_B = DATA[ti].d_thresholdB;
+
+            switch (STEP) {
+              case 1: {
+                ASSERT(1 == manager.addRule(rule));
+              } break;
+              case 2: {
+                mX->addAttributes(&other);
+              } break;
+              case 3: {
+                matchingIt = mX->addAttributes(&matching);
+              } break;
+              case 4: {
+                manager.setThresholdLevels("B", 192, 64, 0, 0);
+              } break;
+              case 5: {
+                manager.setThresholdLevels("A", 64, 64, 192, 0);
+              } break;
+              case 6: {
+                manager.setThresholdLevels("A", 64, 64, 0, 0);
+                manager.setThresholdLevels("B", 64, 64, 0, 0);
+              } break;
+              case 7: {
+                ASSERT(1 == manager.removeRule(rule));
+              } break;
+              case 8: {
+                ASSERT(1 == manager.addRule(rule));
+              } break;
+              case 9: {
+                mX->removeAttributes(matchingIt);
+              } break;
+            }
+
+            for (int severity = 1; severity <= 255; ++severity) {
+                LOOP3_ASSERT(LINE, THR_A, severity,
+                             (THR_A >= severity)
+                                      == X.isCategoryEnabled(CAT_A, severity));
+                LOOP3_ASSERT(LINE, THR_B, severity,
+                             (THR_B >= severity)
+                                      == X.isCategoryEnabled(CAT_B, severity));
+
+                ball::ThresholdAggregate levels(0, 0, 0, 0);
+                X.determineThresholdLevels(&levels, CAT_A);
+                LOOP2_ASSERT(LINE, severity,
+                             (ball::ThresholdAggregate::maxLevel(levels)
+                                                                 >= severity)
+                                      == X.isCategoryEnabled(CAT_A, severity));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(X.isCategoryEnabled(CAT_A, 32));
+            ASSERT_FAIL(X.isCategoryEnabled(0,     32));
+        }
+
+        ball::AttributeContextProctor proctor;  // destroys context
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // NO FALSE POSITIVES FROM 'hasRelevantActiveRules'
@@ -0,0 +1,258 @@
+// ball_binaryfileobserver.cpp                                        -*-C++-*-
+#include <ball_binaryfileobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_binaryfileobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_binarylogutil.h>
+#include <ball_context.h>
+#include <ball_record.h>
+
+#include <bdls_memoryutil.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The frame following the last record written to a segment is always a
+// terminating frame header (i.e., a length of 0): 'publish' writes the
+// terminator following a new record before the length of the record itself.
+// Hence, the segment is well-formed at any time, and a reader never
+// encounters uninitialized memory (the content of a newly grown file being
+// unspecified), even if the process terminates abnormally.
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+enum {
+    k_SEGMENT_HEADER_SIZE = BinaryLogUtil::k_SEGMENT_HEADER_SIZE,
+    k_FRAME_HEADER_SIZE   = BinaryLogUtil::k_FRAME_HEADER_SIZE
+};
+
+void appendIndex(bsl::string *result, int index)
+    // Append the decimal representation of the specified non-negative
+    // 'index' to the specified 'result'.
+{
+    char  buffer[16];
+    char *end  = buffer + sizeof buffer;
+    char *iter = end;
+
+    do {
+        *--iter = static_cast<char>('0' + index % 10);
+        index /= 10;
+    } while (index);
+
+    result->append(iter, end);
+}
+
+}  // close unnamed namespace
+
+                         // ------------------------
+                         // class BinaryFileObserver
+                         // ------------------------
+
+// PRIVATE MANIPULATORS
+void BinaryFileObserver::closeSegment()
+{
+    if (d_segment_p) {
+        bdls::FilesystemUtil::unmap(d_segment_p, d_segmentSize);
+        bdls::FilesystemUtil::close(d_fd);
+
+        d_segment_p = 0;
+        d_fd        = bdls::FilesystemUtil::k_INVALID_FD;
+    }
+}
+
+int BinaryFileObserver::openSegment()
+{
+    typedef bdls::FilesystemUtil FileUtil;
+
+    BSLS_ASSERT(0 == d_segment_p);
+
+    // Find the first unused segment name.
+
+    do {
+        d_segmentName = d_fileNamePrefix;
+        d_segmentName += '.';
+        appendIndex(&d_segmentName, d_nextSegmentIndex++);
+    } while (FileUtil::exists(d_segmentName));
+
+    FileUtil::FileDescriptor fd = FileUtil::open(d_segmentName,
+                                                 FileUtil::e_CREATE,
+                                                 FileUtil::e_READ_WRITE);
+    if (FileUtil::k_INVALID_FD == fd) {
+        return -1;                                                    // RETURN
+    }
+
+    void *address;
+
+    if (0 != FileUtil::growFile(fd,
+                                static_cast<FileUtil::Offset>(d_segmentSize))
+     || 0 != FileUtil::map(fd,
+                           &address,
+                           0,
+                           d_segmentSize,
+                           bdls::MemoryUtil::k_ACCESS_READ_WRITE)) {
+        FileUtil::close(fd);
+        return -1;                                                    // RETURN
+    }
+
+    d_fd        = fd;
+    d_segment_p = static_cast<char *>(address);
+    d_offset    = k_SEGMENT_HEADER_SIZE;
+
+    BinaryLogUtil::writeSegmentHeader(d_segment_p);
+    BinaryLogUtil::writeFrameHeader(d_segment_p + d_offset, 0);
+
+    return 0;
+}
+
+// CREATORS
+BinaryFileObserver::BinaryFileObserver(bslma::Allocator *basicAllocator)
+: d_fileNamePrefix(basicAllocator)
+, d_segmentName(basicAllocator)
+, d_fd(bdls::FilesystemUtil::k_INVALID_FD)
+, d_segment_p(0)
+, d_isEnabled(false)
+, d_segmentSize(k_DEFAULT_SEGMENT_SIZE)
+, d_offset(0)
+, d_nextSegmentIndex(0)
+, d_numDroppedRecords(0)
+{
+}
+
+BinaryFileObserver::BinaryFileObserver(bsl::size_t       segmentSize,
+                                       bslma::Allocator *basicAllocator)
+: d_fileNamePrefix(basicAllocator)
+, d_segmentName(basicAllocator)
+, d_fd(bdls::FilesystemUtil::k_INVALID_FD)
+, d_segment_p(0)
+, d_isEnabled(false)
+, d_segmentSize(segmentSize)
+, d_offset(0)
+, d_nextSegmentIndex(0)
+, d_numDroppedRecords(0)
+{
+    BSLS_ASSERT(k_SEGMENT_HEADER_SIZE + 2 * k_FRAME_HEADER_SIZE <=
+                                                                  segmentSize);
+}
+
+BinaryFileObserver::~BinaryFileObserver()
+{
+    closeSegment();
+}
+
+// MANIPULATORS
+void BinaryFileObserver::disableFileLogging()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    closeSegment();
+    d_isEnabled = false;
+}
+
+int BinaryFileObserver::enableFileLogging(const char *fileNamePrefix)
+{
+    BSLS_ASSERT(fileNamePrefix);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_isEnabled) {
+        return 1;                                                     // RETURN
+    }
+
+    d_fileNamePrefix   = fileNamePrefix;
+    d_nextSegmentIndex = 0;
+
+    if (0 != openSegment()) {
+        return -1;                                                    // RETURN
+    }
+
+    d_isEnabled = true;
+
+    return 0;
+}
+
+void BinaryFileObserver::publish(const bsl::shared_ptr<const Record>& record,
+                                 const Context&)
+{
+    BSLS_ASSERT(record);
+
+    const bsl::size_t length    = BinaryLogUtil::encodedLength(*record);
+    const bsl::size_t frameSize = k_FRAME_HEADER_SIZE + length;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (!d_isEnabled) {
+        return;                                                       // RETURN
+    }
+
+    // A frame, and the terminator following it, must fit after the header
+    // of a segment.
+
+    if (d_segmentSize - k_SEGMENT_HEADER_SIZE - k_FRAME_HEADER_SIZE <
+                                                                   frameSize) {
+        d_numDroppedRecords.addRelaxed(1);
+        return;                                                       // RETURN
+    }
+
+    if (d_segment_p &&
+         d_segmentSize - d_offset - k_FRAME_HEADER_SIZE < frameSize) {
+        closeSegment();
+    }
+
+    if (0 == d_segment_p && 0 != openSegment()) {
+        d_numDroppedRecords.addRelaxed(1);
+        return;                                                       // RETURN
+    }
+
+    char *frame = d_segment_p + d_offset;
+
+    BinaryLogUtil::encode(frame + k_FRAME_HEADER_SIZE, *record);
+    BinaryLogUtil::writeFrameHeader(frame + frameSize, 0);
+    BinaryLogUtil::writeFrameHeader(frame, length);
+
+    d_offset += frameSize;
+}
+
+// ACCESSORS
+bool BinaryFileObserver::isFileLoggingEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_isEnabled;
+}
+
+bool BinaryFileObserver::isFileLoggingEnabled(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (d_isEnabled) {
+        *result = d_segmentName;
+    }
+    return d_isEnabled;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,311 @@
+// ball_binaryfileobserver.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_BINARYFILEOBSERVER
+#define INCLUDED_BALL_BINARYFILEOBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer logging unformatted records to mapped files.
+//
+//@CLASSES:
+//  ball::BinaryFileObserver: observer writing binary records to mapped files
+//
+//@SEE_ALSO: ball_binarylogutil, ball_fileobserver2, ball_recordstringformatter
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::BinaryFileObserver', that writes the
+// records it receives, *without* formatting them, to a sequence of
+// memory-mapped "segment" files:
+//..
+//             ,------------------------.
+//            ( ball::BinaryFileObserver )
+//             `------------------------'
+//                         |              ctor
+//                         |              disableFileLogging
+//                         |              enableFileLogging
+//                         |              isFileLoggingEnabled
+//                         |              numDroppedRecords
+//                         |              segmentSize
+//                         V
+//                 ,--------------.
+//                ( ball::Observer )
+//                 `--------------'
+//                                        dtor
+//                                        publish
+//                                        releaseRecords
+//..
+// Each record published to a 'ball::BinaryFileObserver' is encoded by
+// 'ball::BinaryLogUtil' (i.e., its attributes, message, and user fields are
+// copied, with a length prefix, in a compact binary representation) directly
+// into the mapped memory of the current segment.  No text is rendered, and no
+// system call is made, when publishing a record, except when a segment is
+// full and the next one must be created.  The records are rendered as text
+// offline, by decoding the segments (see 'ball::BinaryLogUtil::decodeSegment')
+// and formatting the decoded records with a 'ball::RecordStringFormatter'
+// having any format specification, as done by the 'balldecode' application.
+// Note that, as the segments are memory-mapped, the records published before a
+// process terminates abnormally are not lost, provided the operating system
+// itself does not fail.
+//
+///Segment Files
+///-------------
+// Calling 'enableFileLogging' with a file name prefix starts logging to the
+// segment file '<prefix>.<N>', for the smallest non-negative integer 'N' such
+// that no such file exists.  Each segment file is created having the size
+// specified at construction (or 'k_DEFAULT_SEGMENT_SIZE'), and is mapped in
+// its entirety.  When a record does not fit in the remainder of the current
+// segment, the segment is unmapped and closed, and the record is written to
+// the next segment file.  Segment files are not truncated when closed; the
+// records they hold are terminated as described in the "Segment Format"
+// section of 'ball_binarylogutil'.  A record whose encoding is larger than a
+// segment (which is then necessarily large) is dropped, and counted by
+// 'numDroppedRecords'; records are also dropped if a segment cannot be
+// created.
+//
+///Thread Safety
+///-------------
+// All methods of 'ball::BinaryFileObserver' are thread-safe, and can be called
+// concurrently by multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Logging Records in Binary
+/// - - - - - - - - - - - - - - - - - -
+// First, we create a binary file observer and enable logging to segment files
+// named after a prefix in a directory that we can write to:
+//..
+//  ball::BinaryFileObserver observer;
+//
+//  int rc = observer.enableFileLogging("/tmp/myapp.binlog");
+//  assert(0 == rc);
+//  assert(observer.isFileLoggingEnabled());
+//..
+// Then, we publish a record, as the logger manager would:
+//..
+//  bsl::shared_ptr<ball::Record> record(new ball::Record());
+//
+//  record->fixedFields().setSeverity(ball::Severity::e_WARN);
+//  record->fixedFields().setMessage("Hello, binary world!");
+//
+//  observer.publish(record,
+//                   ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+//..
+// Finally, we stop logging, which closes the current segment,
+// '/tmp/myapp.binlog.0' (assuming no other segment existed), that can later be
+// rendered as text by the 'balldecode' application, or by
+// 'ball::BinaryLogUtil::decodeSegment':
+//..
+//  observer.disableFileLogging();
+//..
+
+#include <balscm_version.h>
+
+#include <ball_observer.h>
+
+#include <bdls_filesystemutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Context;
+class Record;
+
+                         // ========================
+                         // class BinaryFileObserver
+                         // ========================
+
+class BinaryFileObserver : public Observer {
+    // This class implements the 'Observer' protocol.  The 'publish' method of
+    // this class encodes the records that it receives, unformatted, into
+    // memory-mapped segment files.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_DEFAULT_SEGMENT_SIZE = 16 * 1024 * 1024  // default size of a segment
+    };
+
+  private:
+    // DATA
+    bsl::string                          d_fileNamePrefix;
+                                             // prefix of the segment names
+
+    bsl::string                          d_segmentName;
+                                             // name of the current segment
+
+    bdls::FilesystemUtil::FileDescriptor d_fd;
+                                             // current segment file, or
+                                             // 'k_INVALID_FD'
+
+    char                                *d_segment_p;
+                                             // mapped current segment, or 0
+                                             // if no segment is open
+
+    bool                                 d_isEnabled;
+                                             // 'true' if file logging is
+                                             // enabled
+
+    bsl::size_t                          d_segmentSize;
+                                             // size of each segment
+
+    bsl::size_t                          d_offset;
+                                             // offset of the next frame in
+                                             // the current segment
+
+    int                                  d_nextSegmentIndex;
+                                             // lowest index for the next
+                                             // segment
+
+    bsls::AtomicInt64                    d_numDroppedRecords;
+                                             // records not logged
+
+    mutable bslmt::Mutex                 d_mutex;
+                                             // guard the members above
+
+    // NOT IMPLEMENTED
+    BinaryFileObserver(const BinaryFileObserver&);
+    BinaryFileObserver& operator=(const BinaryFileObserver&);
+
+    // PRIVATE MANIPULATORS
+    void closeSegment();
+        // Unmap and close the current segment, if any.  The behavior is
+        // undefined unless 'd_mutex' is locked.
+
+    int openSegment();
+        // Create, map, and initialize the next segment file.  Return 0 on
+        // success, and a non-zero value (with no segment open) otherwise.
+        // The behavior is undefined unless 'd_mutex' is locked and no segment
+        // is open.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BinaryFileObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+    explicit BinaryFileObserver(bsl::size_t       segmentSize,
+                                bslma::Allocator *basicAllocator = 0);
+        // Create a binary file observer with file logging disabled.
+        // Optionally specify the 'segmentSize', in bytes, of each segment
+        // file; if 'segmentSize' is not specified, 'k_DEFAULT_SEGMENT_SIZE'
+        // is used.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless 'segmentSize'
+        // can hold at least a segment header and two frame headers (see
+        // 'ball_binarylogutil').
+
+    virtual ~BinaryFileObserver();
+        // Close the current segment, if any, and destroy this object.
+
+    // MANIPULATORS
+    void disableFileLogging();
+        // Stop logging, closing the current segment.  This method has no
+        // effect if file logging is not enabled.
+
+    int enableFileLogging(const char *fileNamePrefix);
+        // Start logging records to segment files named '<prefix>.<N>', where
+        // '<prefix>' is the specified 'fileNamePrefix' and 'N' is the smallest
+        // non-negative integer such that the file does not exist.  Return 0
+        // on success, a positive value if file logging is already enabled
+        // (with no effect), and a negative value if the first segment cannot
+        // be created.
+
+    using Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const Record>& record,
+                         const Context&                       context);
+        // Process the specified log 'record' having the specified publishing
+        // 'context' by encoding 'record' into the current segment, creating
+        // the next segment first if 'record' does not fit in the current one.
+        // 'record' is dropped (and counted by 'numDroppedRecords') if file
+        // logging is enabled and it cannot be logged.  This method has no
+        // effect if file logging is not enabled.  Note that 'context' is not
+        // logged.
+
+    virtual void releaseRecords();
+        // Discard any shared reference to a 'Record' object that was supplied
+        // to the 'publish' method, and is held by this observer.  Note that
+        // this observer holds no such reference, and this method has no
+        // effect.
+
+    // ACCESSORS
+    bool isFileLoggingEnabled() const;
+    bool isFileLoggingEnabled(bsl::string *result) const;
+        // Return 'true' if file logging is enabled for this observer, and
+        // 'false' otherwise.  Optionally specify a 'result' into which the
+        // name of the current segment file is loaded if file logging is
+        // enabled ('result' is unmodified otherwise).
+
+    bsls::Types::Int64 numDroppedRecords() const;
+        // Return the number of records that were published while file logging
+        // was enabled but could not be logged.
+
+    bsl::size_t segmentSize() const;
+        // Return the size, in bytes, of each segment file created by this
+        // observer.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class BinaryFileObserver
+                         // ------------------------
+
+// MANIPULATORS
+inline
+void BinaryFileObserver::releaseRecords()
+{
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 BinaryFileObserver::numDroppedRecords() const
+{
+    return d_numDroppedRecords.loadRelaxed();
+}
+
+inline
+bsl::size_t BinaryFileObserver::segmentSize() const
+{
+    return d_segmentSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
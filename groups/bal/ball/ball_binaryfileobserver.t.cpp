@@ -0,0 +1,818 @@
+// ball_binaryfileobserver.t.cpp                                      -*-C++-*-
+#include <ball_binaryfileobserver.h>
+
+#include <ball_binarylogutil.h>
+#include <ball_context.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bdlt_datetime.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // atoi(), getenv()
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+// Note: on Windows -> WinGDI.h:#define PASSTHROUGH 19
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(PASSTHROUGH)
+#undef PASSTHROUGH
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an observer that encodes the records it
+// receives into memory-mapped segment files.  We verify the segments written
+// by the observer by reading them back with 'ball::BinaryLogUtil'.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+// [ 2] BinaryFileObserver(size_t segmentSize, bslma::Allocator * = 0);
+// [ 2] ~BinaryFileObserver();
+//
+// MANIPULATORS
+// [ 2] void disableFileLogging();
+// [ 2] int enableFileLogging(const char *fileNamePrefix);
+// [ 3] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 3] void releaseRecords();
+//
+// ACCESSORS
+// [ 2] bool isFileLoggingEnabled() const;
+// [ 2] bool isFileLoggingEnabled(bsl::string *result) const;
+// [ 3] bsls::Types::Int64 numDroppedRecords() const;
+// [ 2] size_t segmentSize() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: concurrent publication
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::BinaryFileObserver Obj;
+typedef ball::BinaryLogUtil      Util;
+typedef bdls::FilesystemUtil     FsUtil;
+
+//=============================================================================
+//                       HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+                         // ========================
+                         // class TempDirectoryGuard
+                         // ========================
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string d_dirName;  // path to the created directory
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // CREATORS
+    TempDirectoryGuard()
+        // Create temporary directory in the system-wide temp or current
+        // directory.
+    {
+        bsl::string tmpPath;
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = FsUtil::createTemporaryDirectory(&d_dirName, tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        FsUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    bsl::string path(const char *name) const
+        // Return the path of the file having the specified 'name' in the
+        // temporary directory.
+    {
+        bsl::string result(d_dirName);
+
+        int res = bdls::PathUtil::appendIfValid(&result, name);
+        ASSERTV(result, 0 == res);
+
+        return result;
+    }
+};
+
+struct RecordCollector {
+    // This 'struct' provides a visitor appending the records it is invoked
+    // with to a vector.
+
+    // DATA
+    bsl::vector<ball::Record> *d_records_p;
+
+    // ACCESSORS
+    void operator()(const ball::Record& record) const
+        // Append the specified 'record' to the vector.
+    {
+        d_records_p->push_back(record);
+    }
+};
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+bsl::shared_ptr<ball::Record> makeRecord(int         index,
+                                         bsl::size_t messageLength = 16)
+    // Return a record whose line number is the specified 'index', and whose
+    // message consists of 'messageLength' characters.
+{
+    bsl::shared_ptr<ball::Record> record =
+                                         bsl::allocate_shared<ball::Record>(
+                                                 bslma::Default::allocator());
+
+    ball::RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setTimestamp(bdlt::Datetime(2026, 1, 2, 3, 4, 5, index % 1000));
+    attributes.setLineNumber(index);
+    attributes.setCategory("BINARY");
+    attributes.setSeverity(ball::Severity::e_INFO);
+
+    bsl::string message(messageLength, static_cast<char>('a' + index % 26));
+    attributes.setMessage(message.c_str());
+
+    record->customFields().appendInt64(index);
+
+    return record;
+}
+
+int readSegment(bsl::vector<ball::Record> *records, const bsl::string& path)
+    // Append to the specified 'records' the records held in the segment file
+    // having the specified 'path'.  Return the result of 'decodeSegment', or
+    // a negative value if the file cannot be read.
+{
+    bsl::ifstream stream(path.c_str(), bsl::ios::binary);
+
+    if (!stream) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::vector<char> content((bsl::istreambuf_iterator<char>(stream)),
+                              bsl::istreambuf_iterator<char>());
+
+    RecordCollector collector = { records };
+
+    return Util::decodeSegment(content.data(), content.size(), collector);
+}
+
+bsl::string segmentName(const bsl::string& prefix, int index)
+    // Return the name of the segment file having the specified 'prefix' and
+    // 'index'.
+{
+    bsl::string result(prefix);
+
+    result += '.';
+    result += bsl::to_string(index);
+
+    return result;
+}
+
+                         // ===================
+                         // struct PublishThread
+                         // ===================
+
+struct PublishThread {
+    // This 'struct' provides a thread function publishing a sequence of
+    // records to an observer.
+
+    // DATA
+    Obj *d_observer_p;  // observer to publish to (held, not owned)
+    int  d_thread;      // index of the thread
+    int  d_numRecords;  // number of records to publish
+
+    // ACCESSORS
+    void operator()() const
+        // Publish 'd_numRecords' records, whose line numbers encode
+        // 'd_thread' and their index, to the observer.
+    {
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        for (int i = 0; i < d_numRecords; ++i) {
+            d_observer_p->publish(makeRecord(d_thread * 1000000 + i, i % 64),
+                                  context);
+        }
+    }
+};
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   Log to a temporary directory rather than to '/tmp'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string  prefix = tempDirGuard.path("myapp.binlog");
+
+///Example 1: Logging Records in Binary
+/// - - - - - - - - - - - - - - - - - -
+// First, we create a binary file observer and enable logging to segment files
+// named after a prefix in a directory that we can write to:
+//..
+    ball::BinaryFileObserver observer;
+
+    int rc = observer.enableFileLogging(prefix.c_str());
+    ASSERT(0 == rc);
+    ASSERT(observer.isFileLoggingEnabled());
+//..
+// Then, we publish a record, as the logger manager would:
+//..
+    bsl::shared_ptr<ball::Record> record(new ball::Record());
+
+    record->fixedFields().setSeverity(ball::Severity::e_WARN);
+    record->fixedFields().setMessage("Hello, binary world!");
+
+    observer.publish(record,
+                     ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+//..
+// Finally, we stop logging, which closes the current segment,
+// '/tmp/myapp.binlog.0' (assuming no other segment existed), that can later be
+// rendered as text by the 'balldecode' application, or by
+// 'ball::BinaryLogUtil::decodeSegment':
+//..
+    observer.disableFileLogging();
+//..
+
+        bsl::vector<ball::Record> records;
+
+        ASSERT(1 == readSegment(&records, segmentName(prefix, 0)));
+        ASSERT(1 == records.size());
+        ASSERT(0 == bsl::strcmp("Hello, binary world!",
+                                records[0].fixedFields().message()));
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        //: 1 Records published concurrently by several threads are all logged,
+        //:   uncorrupted, across segment rollovers.
+        //:
+        //: 2 The records published by each thread are logged in the order in
+        //:   which they were published.
+        //
+        // Plan:
+        //: 1 Publish records of various lengths from several threads to an
+        //:   observer having small segments, then decode every segment and
+        //:   verify that each record published is found once, in order for
+        //:   each thread.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: concurrent publication
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: CONCURRENT PUBLICATION"
+                          << "\n===============================" << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_RECORDS = 2000 };
+
+        TempDirectoryGuard tempDirGuard;
+        const bsl::string  prefix = tempDirGuard.path("concurrent");
+
+        {
+            Obj mX(4096);
+
+            ASSERT(0 == mX.enableFileLogging(prefix.c_str()));
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                PublishThread thread = { &mX, i, k_NUM_RECORDS };
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i], thread));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERT(0 == mX.numDroppedRecords());
+        }
+
+        int next[k_NUM_THREADS] = { 0 };
+        int numSegments         = 0;
+
+        for (; FsUtil::exists(segmentName(prefix, numSegments));
+                                                              ++numSegments) {
+            bsl::vector<ball::Record> records;
+
+            int rc = readSegment(&records, segmentName(prefix, numSegments));
+
+            ASSERTV(numSegments, rc, 0 < rc);
+
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                const int line   = records[i].fixedFields().lineNumber();
+                const int thread = line / 1000000;
+                const int index  = line % 1000000;
+
+                ASSERTV(line, 0 <= thread && thread < k_NUM_THREADS);
+                if (0 <= thread && thread < k_NUM_THREADS) {
+                    ASSERTV(thread, index, next[thread],
+                            next[thread] == index);
+                    next[thread] = index + 1;
+                }
+                ASSERTV(line, *makeRecord(line, index % 64) == records[i]);
+            }
+        }
+
+        if (veryVerbose) { P(numSegments) }
+
+        ASSERT(1 < numSegments);
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERTV(i, next[i], k_NUM_RECORDS == next[i]);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PUBLISH
+        //
+        // Concerns:
+        //: 1 Published records are logged, in order, and can be decoded from
+        //:   the segment files.
+        //:
+        //: 2 A segment remains decodable while it is being written.
+        //:
+        //: 3 A record that does not fit in the current segment is logged at
+        //:   the start of the next segment, and a record that fits exactly is
+        //:   logged in the current segment.
+        //:
+        //: 4 A record that cannot fit in any segment is dropped and counted.
+        //:
+        //: 5 Records published while file logging is disabled are ignored, and
+        //:   are not counted as dropped.
+        //:
+        //: 6 'publish' allocates no memory from the default allocator.
+        //
+        // Plan:
+        //: 1 Publish records, and decode the current segment after each one.
+        //:   (C-1..2)
+        //:
+        //: 2 Using a segment size computed from the length of the encoded
+        //:   records, publish records that fill a segment exactly, then a
+        //:   record that rolls over to the next segment.  (C-3)
+        //:
+        //: 3 Publish a record larger than the segment size.  (C-4)
+        //:
+        //: 4 Publish a record with file logging disabled.  (C-5)
+        //:
+        //: 5 Use a default allocator guard around 'publish'.  (C-6)
+        //
+        // Testing:
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   void releaseRecords();
+        //   bsls::Types::Int64 numDroppedRecords() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPUBLISH"
+                          << "\n=======" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        if (verbose) cout << "\tPublishing and decoding." << endl;
+        {
+            const bsl::string prefix = tempDirGuard.path("publish");
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            Obj                  mX(&oa);
+
+            ASSERT(0 == mX.enableFileLogging(prefix.c_str()));
+
+            bsl::vector<bsl::shared_ptr<ball::Record> > expected;
+
+            for (int i = 0; i < 20; ++i) {
+                expected.push_back(makeRecord(i, i * 10));
+
+                {
+                    bslma::TestAllocator         da("default",
+                                                    veryVeryVeryVerbose);
+                    bslma::DefaultAllocatorGuard guard(&da);
+
+                    mX.publish(expected.back(), context);
+
+                    ASSERTV(i, 0 == da.numBlocksTotal());
+                }
+
+                bsl::vector<ball::Record> records;
+
+                int rc = readSegment(&records, segmentName(prefix, 0));
+
+                ASSERTV(i, rc, i + 1 == rc);
+                for (bsl::size_t j = 0; j < records.size(); ++j) {
+                    ASSERTV(i, j, *expected[j] == records[j]);
+                }
+            }
+            mX.releaseRecords();
+
+            ASSERT(0 == mX.numDroppedRecords());
+            ASSERT(!FsUtil::exists(segmentName(prefix, 1)));
+        }
+
+        if (verbose) cout << "\tSegment rollover." << endl;
+        {
+            const bsl::string prefix = tempDirGuard.path("rollover");
+
+            bsl::shared_ptr<ball::Record> record = makeRecord(7);
+
+            const bsl::size_t FRAME = Util::k_FRAME_HEADER_SIZE
+                                    + Util::encodedLength(*record);
+            const bsl::size_t SIZE  = Util::k_SEGMENT_HEADER_SIZE
+                                    + 3 * FRAME
+                                    + Util::k_FRAME_HEADER_SIZE;
+
+            Obj mX(SIZE);
+
+            ASSERT(SIZE == mX.segmentSize());
+            ASSERT(0    == mX.enableFileLogging(prefix.c_str()));
+
+            for (int i = 0; i < 3; ++i) {
+                mX.publish(record, context);
+            }
+            ASSERT(!FsUtil::exists(segmentName(prefix, 1)));
+
+            mX.publish(record, context);
+            ASSERT(FsUtil::exists(segmentName(prefix, 1)));
+
+            bsl::string name;
+            ASSERT(mX.isFileLoggingEnabled(&name));
+            ASSERTV(name, segmentName(prefix, 1) == name);
+
+            bsl::vector<ball::Record> records;
+
+            ASSERT(3 == readSegment(&records, segmentName(prefix, 0)));
+            ASSERT(1 == readSegment(&records, segmentName(prefix, 1)));
+            ASSERT(4 == records.size());
+
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                ASSERTV(i, *record == records[i]);
+            }
+
+            if (verbose) cout << "\tOversized records." << endl;
+
+            ASSERT(0 == mX.numDroppedRecords());
+
+            mX.publish(makeRecord(8, SIZE), context);
+            ASSERT(1 == mX.numDroppedRecords());
+
+            // The largest record that fits in a segment.
+
+            mX.publish(makeRecord(9, 3 * FRAME - FRAME + 16), context);
+            ASSERT(1 == mX.numDroppedRecords());
+            ASSERT(FsUtil::exists(segmentName(prefix, 2)));
+
+            mX.publish(makeRecord(9, 3 * FRAME - FRAME + 17), context);
+            ASSERT(2 == mX.numDroppedRecords());
+            ASSERT(!FsUtil::exists(segmentName(prefix, 3)));
+
+            if (verbose) cout << "\tDisabled logging." << endl;
+
+            mX.disableFileLogging();
+            mX.publish(record, context);
+
+            ASSERT(2 == mX.numDroppedRecords());
+
+            records.clear();
+            ASSERT(1 == readSegment(&records, segmentName(prefix, 1)));
+            ASSERT(1 == readSegment(&records, segmentName(prefix, 2)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ENABLE AND DISABLE FILE LOGGING
+        //
+        // Concerns:
+        //: 1 The observer is created with file logging disabled, and with the
+        //:   specified (or default) segment size.
+        //:
+        //: 2 'enableFileLogging' creates the first segment file, named after
+        //:   the prefix and the smallest index of a segment file that does not
+        //:   exist, having the size of a segment.
+        //:
+        //: 3 'enableFileLogging' returns a positive value, with no effect, if
+        //:   file logging is already enabled, and a negative value if the
+        //:   segment cannot be created.
+        //:
+        //: 4 'disableFileLogging' closes the segment, and enabling file
+        //:   logging again creates a new segment.
+        //:
+        //: 5 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Create observers using the two constructors, and verify the
+        //:   value of their accessors.  (C-1)
+        //:
+        //: 2 Enable and disable file logging repeatedly, with a segment file
+        //:   existing before the first, and verify the files created.  (C-2,4)
+        //:
+        //: 3 Enable file logging twice, and in a directory that does not
+        //:   exist.  (C-3)
+        //:
+        //: 4 Install a test allocator as the default allocator, and verify
+        //:   that no memory from it is in use.  (C-5)
+        //
+        // Testing:
+        //   BinaryFileObserver(bslma::Allocator *basicAllocator = 0);
+        //   BinaryFileObserver(size_t segmentSize, bslma::Allocator * = 0);
+        //   ~BinaryFileObserver();
+        //   void disableFileLogging();
+        //   int enableFileLogging(const char *fileNamePrefix);
+        //   bool isFileLoggingEnabled() const;
+        //   bool isFileLoggingEnabled(bsl::string *result) const;
+        //   size_t segmentSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCREATORS, ENABLE AND DISABLE FILE LOGGING"
+                          << "\n=========================================="
+                          << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const bsl::string prefix = tempDirGuard.path("segment");
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        {
+            Obj X(&oa);
+
+            ASSERT(!X.isFileLoggingEnabled());
+            ASSERT(Obj::k_DEFAULT_SEGMENT_SIZE == X.segmentSize());
+            ASSERT(0 == X.numDroppedRecords());
+        }
+        {
+            Obj mX(1024, &oa);  const Obj& X = mX;
+
+            ASSERT(!X.isFileLoggingEnabled());
+            ASSERT(1024 == X.segmentSize());
+
+            // Create the first segment name, which must be skipped.
+
+            {
+                FsUtil::FileDescriptor fd = FsUtil::open(
+                                                    segmentName(prefix, 0),
+                                                    FsUtil::e_CREATE,
+                                                    FsUtil::e_READ_WRITE);
+                ASSERT(FsUtil::k_INVALID_FD != fd);
+                FsUtil::close(fd);
+            }
+
+            ASSERT(0 == mX.enableFileLogging(prefix.c_str()));
+            ASSERT(X.isFileLoggingEnabled());
+
+            bsl::string name("unset", &oa);
+
+            ASSERT(X.isFileLoggingEnabled(&name));
+            ASSERTV(name, segmentName(prefix, 1) == name);
+            ASSERT(1024 == FsUtil::getFileSize(name));
+
+            ASSERT(0 < mX.enableFileLogging(prefix.c_str()));
+            ASSERT(X.isFileLoggingEnabled(&name));
+            ASSERTV(name, segmentName(prefix, 1) == name);
+
+            mX.disableFileLogging();
+            ASSERT(!X.isFileLoggingEnabled());
+            ASSERT(!X.isFileLoggingEnabled(&name));
+            ASSERTV(name, segmentName(prefix, 1) == name);
+
+            mX.disableFileLogging();
+            ASSERT(!X.isFileLoggingEnabled());
+
+            ASSERT(0 == mX.enableFileLogging(prefix.c_str()));
+            ASSERT(X.isFileLoggingEnabled(&name));
+            ASSERTV(name, segmentName(prefix, 2) == name);
+
+            // The destructor closes the segment.
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const bsl::string missing = tempDirGuard.path("missing/segment");
+
+            ASSERT(0 > mX.enableFileLogging(missing.c_str()));
+            ASSERT(!X.isFileLoggingEnabled());
+            ASSERT(!FsUtil::exists(segmentName(missing, 0)));
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Enable file logging, publish a few records, disable file logging,
+        //:   and decode the segment file.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        const bsl::string prefix = tempDirGuard.path("breathing");
+
+        Obj mX;
+
+        ASSERT(!mX.isFileLoggingEnabled());
+        ASSERT(0 == mX.enableFileLogging(prefix.c_str()));
+        ASSERT(mX.isFileLoggingEnabled());
+
+        for (int i = 0; i < 3; ++i) {
+            mX.publish(makeRecord(i), context);
+        }
+
+        mX.disableFileLogging();
+        ASSERT(!mX.isFileLoggingEnabled());
+
+        bsl::vector<ball::Record> records;
+
+        ASSERT(3 == readSegment(&records, segmentName(prefix, 0)));
+        ASSERT(3 == records.size());
+
+        for (int i = 0; i < 3; ++i) {
+            ASSERTV(i, *makeRecord(i) == records[i]);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,544 @@
+// ball_binarylogutil.cpp                                             -*-C++-*-
+#include <ball_binarylogutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_binarylogutil_cpp,"$Id$ $CSID$")
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_userfields.h>
+#include <ball_userfieldtype.h>
+#include <ball_userfieldvalue.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+#include <bsl_ios.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace ball {
+namespace {
+
+const char k_MAGIC[] = "BALLBIN1";  // first 8 bytes of a segment
+
+enum {
+    k_MAGIC_SIZE     = 8,
+    k_INT32_SIZE     = 4,
+    k_INT64_SIZE     = 8,
+    k_TIMESTAMP_SIZE = k_INT64_SIZE,
+    k_FIXED_SIZE     = k_TIMESTAMP_SIZE   // timestamp
+                     + k_INT32_SIZE       // process id
+                     + k_INT64_SIZE       // thread id
+                     + k_INT32_SIZE       // line number
+                     + k_INT32_SIZE       // severity
+                     + 3 * k_INT32_SIZE   // string lengths
+                     + k_INT32_SIZE       // number of user fields
+};
+
+bsls::Types::Int64 toMicroseconds(const bdlt::Datetime& datetime)
+    // Return the number of microseconds from 0001/01/01_00:00 to the specified
+    // 'datetime'.
+{
+    return (datetime - bdlt::Datetime(1, 1, 1)).totalMicroseconds();
+}
+
+                               // =============
+                               // class Encoder
+                               // =============
+
+class Encoder {
+    // This class writes little-endian integers and strings to a buffer.
+
+    // DATA
+    char *d_cursor_p;  // next byte to write
+
+  public:
+    // CREATORS
+    explicit Encoder(char *buffer)
+        // Create an encoder writing to the specified 'buffer'.
+    : d_cursor_p(buffer)
+    {
+    }
+
+    // MANIPULATORS
+    void putUint32(bsls::Types::Uint64 value)
+        // Write the 4 least-significant bytes of the specified 'value'.
+    {
+        for (int i = 0; i < k_INT32_SIZE; ++i) {
+            *d_cursor_p++ = static_cast<char>(value >> (8 * i));
+        }
+    }
+
+    void putUint64(bsls::Types::Uint64 value)
+        // Write the specified 'value'.
+    {
+        for (int i = 0; i < k_INT64_SIZE; ++i) {
+            *d_cursor_p++ = static_cast<char>(value >> (8 * i));
+        }
+    }
+
+    void putString(const char *data, bsl::size_t length)
+        // Write the specified 'length' followed by the specified 'length'
+        // characters at the specified 'data'.
+    {
+        putUint32(length);
+        if (length) {
+            bsl::memcpy(d_cursor_p, data, length);
+            d_cursor_p += length;
+        }
+    }
+
+    void putByte(int value)
+        // Write the specified 'value' as a single byte.
+    {
+        *d_cursor_p++ = static_cast<char>(value);
+    }
+};
+
+                               // =============
+                               // class Decoder
+                               // =============
+
+class Decoder {
+    // This class reads little-endian integers and strings from a buffer,
+    // checking that they lie within the buffer.
+
+    // DATA
+    const char *d_cursor_p;  // next byte to read
+    const char *d_end_p;     // end of the buffer
+    bool        d_valid;     // 'false' once a read overran the buffer
+
+  public:
+    // CREATORS
+    Decoder(const char *buffer, bsl::size_t length)
+        // Create a decoder reading the specified 'length' bytes at the
+        // specified 'buffer'.
+    : d_cursor_p(buffer)
+    , d_end_p(buffer + length)
+    , d_valid(true)
+    {
+    }
+
+    // MANIPULATORS
+    bool reserve(bsl::size_t length)
+        // Return 'true' if the specified 'length' bytes remain to be read, and
+        // mark this decoder invalid and return 'false' otherwise.
+    {
+        if (!d_valid ||
+                    static_cast<bsl::size_t>(d_end_p - d_cursor_p) < length) {
+            d_valid = false;
+        }
+        return d_valid;
+    }
+
+    bsls::Types::Uint64 getUint32()
+        // Read and return a 4-byte value, or return 0 if it overruns the
+        // buffer.
+    {
+        bsls::Types::Uint64 value = 0;
+
+        if (reserve(k_INT32_SIZE)) {
+            for (int i = 0; i < k_INT32_SIZE; ++i) {
+                value |= static_cast<bsls::Types::Uint64>(
+                     static_cast<unsigned char>(*d_cursor_p++)) << (8 * i);
+            }
+        }
+        return value;
+    }
+
+    bsls::Types::Uint64 getUint64()
+        // Read and return an 8-byte value, or return 0 if it overruns the
+        // buffer.
+    {
+        bsls::Types::Uint64 value = 0;
+
+        if (reserve(k_INT64_SIZE)) {
+            for (int i = 0; i < k_INT64_SIZE; ++i) {
+                value |= static_cast<bsls::Types::Uint64>(
+                     static_cast<unsigned char>(*d_cursor_p++)) << (8 * i);
+            }
+        }
+        return value;
+    }
+
+    int getByte()
+        // Read and return a single byte, or return -1 if it overruns the
+        // buffer.
+    {
+        return reserve(1) ? static_cast<unsigned char>(*d_cursor_p++) : -1;
+    }
+
+    const char *getString(bsl::size_t *length)
+        // Read a string, load its length into the specified 'length', and
+        // return the address of its characters, or return 0 if it overruns
+        // the buffer.
+    {
+        *length = static_cast<bsl::size_t>(getUint32());
+        if (!reserve(*length)) {
+            return 0;                                                 // RETURN
+        }
+        const char *result = d_cursor_p;
+        d_cursor_p += *length;
+        return result;
+    }
+
+    // ACCESSORS
+    bool isComplete() const
+        // Return 'true' if every read succeeded and the buffer was read
+        // entirely, and 'false' otherwise.
+    {
+        return d_valid && d_cursor_p == d_end_p;
+    }
+
+    bool isValid() const
+        // Return 'true' if every read succeeded, and 'false' otherwise.
+    {
+        return d_valid;
+    }
+};
+
+bsl::size_t userFieldLength(const UserFieldValue& value)
+    // Return the number of bytes needed to encode the specified 'value',
+    // including its type.
+{
+    switch (value.type()) {
+      case UserFieldType::e_INT64:
+      case UserFieldType::e_DOUBLE: {
+        return 1 + k_INT64_SIZE;                                      // RETURN
+      }
+      case UserFieldType::e_STRING: {
+        return 1 + k_INT32_SIZE + value.theString().length();         // RETURN
+      }
+      case UserFieldType::e_DATETIMETZ: {
+        return 1 + k_TIMESTAMP_SIZE + k_INT32_SIZE;                   // RETURN
+      }
+      case UserFieldType::e_CHAR_ARRAY: {
+        return 1 + k_INT32_SIZE + value.theCharArray().size();        // RETURN
+      }
+      default: {
+        return 1;                                                     // RETURN
+      }
+    }
+}
+
+int decodeUserField(UserFields *fields, Decoder *decoder)
+    // Decode a user field using the specified 'decoder' and append it to the
+    // specified 'fields'.  Return 0 on success, and a non-zero value
+    // otherwise.
+{
+    switch (decoder->getByte()) {
+      case UserFieldType::e_VOID: {
+        fields->appendNull();
+      } break;
+      case UserFieldType::e_INT64: {
+        fields->appendInt64(
+                      static_cast<bsls::Types::Int64>(decoder->getUint64()));
+      } break;
+      case UserFieldType::e_DOUBLE: {
+        bsls::Types::Uint64 bits  = decoder->getUint64();
+        double              value;
+
+        bsl::memcpy(&value, &bits, sizeof value);
+        fields->appendDouble(value);
+      } break;
+      case UserFieldType::e_STRING: {
+        bsl::size_t  length;
+        const char  *data = decoder->getString(&length);
+
+        if (!data) {
+            return -1;                                                // RETURN
+        }
+        fields->appendString(bslstl::StringRef(data, length));
+      } break;
+      case UserFieldType::e_DATETIMETZ: {
+        bdlt::Datetime datetime(1, 1, 1);
+
+        const bsls::Types::Int64 microseconds =
+                        static_cast<bsls::Types::Int64>(decoder->getUint64());
+        const int                offset       = static_cast<int>(
+                                                        decoder->getUint32());
+
+        if (0 != datetime.addMicrosecondsIfValid(microseconds)
+         || !bdlt::DatetimeTz::isValid(datetime, offset)) {
+            return -1;                                                // RETURN
+        }
+        fields->appendDatetimeTz(bdlt::DatetimeTz(datetime, offset));
+      } break;
+      case UserFieldType::e_CHAR_ARRAY: {
+        bsl::size_t  length;
+        const char  *data = decoder->getString(&length);
+
+        if (!data) {
+            return -1;                                                // RETURN
+        }
+        fields->appendCharArray(bsl::vector<char>(data,
+                                                  data + length,
+                                                  fields->allocator()));
+      } break;
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+    return decoder->isValid() ? 0 : -1;
+}
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // struct BinaryLogUtil
+                            // --------------------
+
+// CLASS METHODS
+int BinaryLogUtil::decode(Record      *record,
+                          const char  *buffer,
+                          bsl::size_t  length)
+{
+    BSLS_ASSERT(record);
+    BSLS_ASSERT(buffer || 0 == length);
+
+    Decoder decoder(buffer, length);
+
+    bdlt::Datetime timestamp(1, 1, 1);
+
+    const bsls::Types::Int64  microseconds =
+                         static_cast<bsls::Types::Int64>(decoder.getUint64());
+    const int                 processId  = static_cast<int>(
+                                                         decoder.getUint32());
+    const bsls::Types::Uint64 threadId   = decoder.getUint64();
+    const int                 lineNumber = static_cast<int>(
+                                                         decoder.getUint32());
+    const int                 severity   = static_cast<int>(
+                                                         decoder.getUint32());
+
+    bsl::size_t fileNameLength;
+    bsl::size_t categoryLength;
+    bsl::size_t messageLength;
+
+    const char *fileName = decoder.getString(&fileNameLength);
+    const char *category = decoder.getString(&categoryLength);
+    const char *message  = decoder.getString(&messageLength);
+
+    const bsls::Types::Uint64 numFields = decoder.getUint32();
+
+    if (!decoder.isValid()
+     || 0 != timestamp.addMicrosecondsIfValid(microseconds)) {
+        return -1;                                                    // RETURN
+    }
+
+    bslma::Allocator *allocator = record->customFields().allocator();
+
+    UserFields fields(allocator);
+
+    for (bsls::Types::Uint64 i = 0; i < numFields; ++i) {
+        if (0 != decodeUserField(&fields, &decoder)) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (!decoder.isComplete()) {
+        return -1;                                                    // RETURN
+    }
+
+    // 'RecordAttributes' takes null-terminated strings.
+
+    const bsl::string fileNameString(fileName, fileNameLength, allocator);
+    const bsl::string categoryString(category, categoryLength, allocator);
+
+    RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setTimestamp(timestamp);
+    attributes.setProcessID(processId);
+    attributes.setThreadID(threadId);
+    attributes.setFileName(fileNameString.c_str());
+    attributes.setLineNumber(lineNumber);
+    attributes.setCategory(categoryString.c_str());
+    attributes.setSeverity(severity);
+    attributes.clearMessage();
+    attributes.messageStreamBuf().sputn(message,
+                                        static_cast<bsl::streamsize>(
+                                                              messageLength));
+
+    record->customFields().swap(fields);
+
+    return 0;
+}
+
+int BinaryLogUtil::decodeSegment(const char           *segment,
+                                 bsl::size_t           length,
+                                 const RecordVisitor&  visitor)
+{
+    BSLS_ASSERT(segment || 0 == length);
+
+    Decoder header(segment, length);
+
+    if (!header.reserve(k_SEGMENT_HEADER_SIZE)
+     || 0 != bsl::memcmp(segment, k_MAGIC, k_MAGIC_SIZE)) {
+        return -1;                                                    // RETURN
+    }
+
+    Decoder version(segment + k_MAGIC_SIZE, k_INT32_SIZE);
+
+    if (k_VERSION != version.getUint32()) {
+        return -1;                                                    // RETURN
+    }
+
+    Record      record;
+    int         numRecords = 0;
+    bsl::size_t offset     = k_SEGMENT_HEADER_SIZE;
+
+    while (length - offset >= k_FRAME_HEADER_SIZE) {
+        Decoder frame(segment + offset, k_FRAME_HEADER_SIZE);
+
+        const bsl::size_t recordLength =
+                                static_cast<bsl::size_t>(frame.getUint32());
+
+        if (0 == recordLength) {
+            break;
+        }
+
+        offset += k_FRAME_HEADER_SIZE;
+
+        if (length - offset < recordLength
+         || 0 != decode(&record, segment + offset, recordLength)) {
+            return -1;                                                // RETURN
+        }
+
+        visitor(record);
+
+        offset += recordLength;
+        ++numRecords;
+    }
+
+    return numRecords;
+}
+
+void BinaryLogUtil::encode(char *buffer, const Record& record)
+{
+    BSLS_ASSERT(buffer);
+
+    const RecordAttributes& attributes = record.fixedFields();
+    const UserFields&       fields     = record.customFields();
+
+    Encoder encoder(buffer);
+
+    encoder.putUint64(toMicroseconds(attributes.timestamp()));
+    encoder.putUint32(attributes.processID());
+    encoder.putUint64(attributes.threadID());
+    encoder.putUint32(attributes.lineNumber());
+    encoder.putUint32(attributes.severity());
+
+    const char *fileName = attributes.fileName();
+    const char *category = attributes.category();
+
+    const bslstl::StringRef message = attributes.messageRef();
+
+    encoder.putString(fileName, bsl::strlen(fileName));
+    encoder.putString(category, bsl::strlen(category));
+    encoder.putString(message.data(), message.length());
+
+    encoder.putUint32(fields.length());
+
+    for (UserFields::ConstIterator it = fields.begin();
+                                                    it != fields.end(); ++it) {
+        const UserFieldValue& value = *it;
+
+        encoder.putByte(value.type());
+
+        switch (value.type()) {
+          case UserFieldType::e_INT64: {
+            encoder.putUint64(value.theInt64());
+          } break;
+          case UserFieldType::e_DOUBLE: {
+            bsls::Types::Uint64 bits;
+
+            bsl::memcpy(&bits, &value.theDouble(), sizeof bits);
+            encoder.putUint64(bits);
+          } break;
+          case UserFieldType::e_STRING: {
+            const bsl::string& string = value.theString();
+
+            encoder.putString(string.data(), string.length());
+          } break;
+          case UserFieldType::e_DATETIMETZ: {
+            const bdlt::DatetimeTz& datetimeTz = value.theDatetimeTz();
+
+            encoder.putUint64(toMicroseconds(datetimeTz.localDatetime()));
+            encoder.putUint32(datetimeTz.offset());
+          } break;
+          case UserFieldType::e_CHAR_ARRAY: {
+            const bsl::vector<char>& array = value.theCharArray();
+
+            encoder.putString(array.data(), array.size());
+          } break;
+          default: {
+          } break;
+        }
+    }
+}
+
+bsl::size_t BinaryLogUtil::encodedLength(const Record& record)
+{
+    const RecordAttributes& attributes = record.fixedFields();
+    const UserFields&       fields     = record.customFields();
+
+    bsl::size_t length = k_FIXED_SIZE
+                       + bsl::strlen(attributes.fileName())
+                       + bsl::strlen(attributes.category())
+                       + attributes.messageRef().length();
+
+    for (UserFields::ConstIterator it = fields.begin();
+                                                    it != fields.end(); ++it) {
+        length += userFieldLength(*it);
+    }
+
+    return length;
+}
+
+void BinaryLogUtil::writeFrameHeader(char *buffer, bsl::size_t length)
+{
+    BSLS_ASSERT(buffer);
+
+    Encoder(buffer).putUint32(length);
+}
+
+void BinaryLogUtil::writeSegmentHeader(char *buffer)
+{
+    BSLS_ASSERT(buffer);
+
+    bsl::memcpy(buffer, k_MAGIC, k_MAGIC_SIZE);
+
+    Encoder encoder(buffer + k_MAGIC_SIZE);
+
+    encoder.putUint32(k_VERSION);
+    encoder.putUint32(0);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,188 @@
+// ball_binarylogutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BALL_BINARYLOGUTIL
+#define INCLUDED_BALL_BINARYLOGUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to encode and decode log records in binary.
+//
+//@CLASSES:
+//  ball::BinaryLogUtil: namespace for binary log encoding and decoding
+//
+//@SEE_ALSO: ball_binaryfileobserver, ball_record, ball_recordstringformatter
+//
+//@DESCRIPTION: This component provides a namespace, 'ball::BinaryLogUtil',
+// containing functions that encode a 'ball::Record' into a compact, portable,
+// binary representation, decode such a representation back into a
+// 'ball::Record', and read and write the "segments" in which a
+// 'ball::BinaryFileObserver' stores a sequence of encoded records.  Encoding a
+// record performs no formatting: the fixed fields, the (already streamed)
+// message, and the user fields of the record are copied into the destination
+// buffer, so that the cost of rendering the record as text can be paid later,
+// by another process, using any 'ball::RecordStringFormatter' format.
+//
+///Record Encoding
+///---------------
+// All integers are encoded in little-endian byte order, independent of the
+// platform.  A string is encoded as a 4-byte length followed by its
+// characters.  An encoded record consists of the following fields, in order:
+//..
+//  Field              Encoding
+//  -----------------  ---------------------------------------------------
+//  timestamp          8-byte count of microseconds since 0001/01/01_00:00
+//  process id         4 bytes
+//  thread id          8 bytes
+//  line number        4 bytes
+//  severity           4 bytes
+//  file name          string
+//  category           string
+//  message            string
+//  user fields        4-byte count, followed by each user field
+//..
+// Each user field is encoded as a 1-byte 'ball::UserFieldType::Enum' value
+// followed by its value: nothing for 'e_VOID'; 8 bytes for 'e_INT64'; the 8
+// bytes of the IEEE-754 representation for 'e_DOUBLE'; a string for
+// 'e_STRING' and 'e_CHAR_ARRAY'; and the 8-byte timestamp (encoded as above)
+// followed by the 4-byte offset in minutes for 'e_DATETIMETZ'.  Note that the
+// default 'bdlt::Datetime' value, '0001/01/01_24:00:00.000000', is decoded as
+// '0001/01/01_00:00:00.000000'.
+//
+///Segment Format
+///--------------
+// A segment is a contiguous region of memory (typically, a file) holding a
+// sequence of encoded records.  A segment starts with a header of
+// 'k_SEGMENT_HEADER_SIZE' bytes, consisting of the 8 characters "BALLBIN1"
+// followed by a 4-byte format version and 4 reserved bytes, followed by a
+// sequence of frames.  Each frame consists of the 4-byte length of an encoded
+// record followed by the encoded record.  A frame whose length is 0, or the
+// end of the segment, terminates the sequence.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding and Decoding a Record
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to store a log record in a buffer and restore it later.
+//
+// First, we create a record:
+//..
+//  ball::Record record;
+//
+//  record.fixedFields().setTimestamp(bdlt::Datetime(2020, 6, 1, 12, 30));
+//  record.fixedFields().setThreadID(6);
+//  record.fixedFields().setCategory("EQUITY.NASD");
+//  record.fixedFields().setSeverity(ball::Severity::e_INFO);
+//  record.fixedFields().setMessage("Hello, World!");
+//  record.customFields().appendInt64(42);
+//..
+// Then, we encode the record into a buffer of sufficient size:
+//..
+//  bsl::vector<char> buffer(ball::BinaryLogUtil::encodedLength(record));
+//
+//  ball::BinaryLogUtil::encode(buffer.data(), record);
+//..
+// Finally, we decode the buffer into another record, and verify that the two
+// records have the same value:
+//..
+//  ball::Record decoded;
+//
+//  int rc = ball::BinaryLogUtil::decode(&decoded,
+//                                       buffer.data(),
+//                                       buffer.size());
+//  assert(0      == rc);
+//  assert(record == decoded);
+//..
+
+#include <balscm_version.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Record;
+
+                            // ====================
+                            // struct BinaryLogUtil
+                            // ====================
+
+struct BinaryLogUtil {
+    // This 'struct' provides a namespace for functions that encode and decode
+    // log records in a binary representation, and that read and write the
+    // segments holding sequences of such records.
+
+    // TYPES
+    typedef bsl::function<void(const Record&)> RecordVisitor;
+        // 'RecordVisitor' is an alias for a functor invoked with each record
+        // decoded from a segment.
+
+    enum {
+        k_SEGMENT_HEADER_SIZE = 16,  // size of the header of a segment
+        k_FRAME_HEADER_SIZE   = 4,   // size of the length preceding a record
+        k_VERSION             = 1    // version of the format
+    };
+
+    // CLASS METHODS
+    static int decode(Record      *record,
+                      const char  *buffer,
+                      bsl::size_t  length);
+        // Load into the specified 'record' the record encoded in the specified
+        // 'buffer' of the specified 'length'.  Return 0 on success, and a
+        // non-zero value, with no effect on 'record', if 'buffer' does not
+        // hold exactly one valid encoded record.
+
+    static int decodeSegment(const char           *segment,
+                             bsl::size_t           length,
+                             const RecordVisitor&  visitor);
+        // Decode, in order, the records held in the specified 'segment' of
+        // the specified 'length', and invoke the specified 'visitor' with
+        // each of them.  Return the number of records decoded on success,
+        // and a negative value if 'segment' does not start with a valid header
+        // or if a frame is not valid (in which case 'visitor' has been invoked
+        // with each of the records preceding the invalid frame).
+
+    static void encode(char *buffer, const Record& record);
+        // Encode the specified 'record' into the specified 'buffer'.  The
+        // behavior is undefined unless 'buffer' has room for
+        // 'encodedLength(record)' bytes.
+
+    static bsl::size_t encodedLength(const Record& record);
+        // Return the number of bytes needed to encode the specified 'record'.
+        // Note that the length does not include 'k_FRAME_HEADER_SIZE'.
+
+    static void writeFrameHeader(char *buffer, bsl::size_t length);
+        // Write to the specified 'buffer' the header of a frame holding an
+        // encoded record of the specified 'length'.  The behavior is undefined
+        // unless 'buffer' has room for 'k_FRAME_HEADER_SIZE' bytes and
+        // 'length < 2^32'.  Note that a 'length' of 0 marks the end of the
+        // records in a segment.
+
+    static void writeSegmentHeader(char *buffer);
+        // Write to the specified 'buffer' the header of a segment.  The
+        // behavior is undefined unless 'buffer' has room for
+        // 'k_SEGMENT_HEADER_SIZE' bytes.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
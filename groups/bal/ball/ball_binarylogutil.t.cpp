@@ -0,0 +1,667 @@
+// ball_binarylogutil.t.cpp                                           -*-C++-*-
+#include <ball_binarylogutil.h>
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // atoi()
+#include <bsl_cstring.h>     // memcpy(), memset()
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a utility that encodes 'ball::Record' objects
+// into a binary representation, decodes them back, and reads and writes the
+// segments holding sequences of encoded records.  We verify that a round trip
+// through 'encode' and 'decode' preserves the value of records holding every
+// kind of field, that 'decode' and 'decodeSegment' reject malformed input,
+// and that segments written with 'writeSegmentHeader' and 'writeFrameHeader'
+// are read back by 'decodeSegment'.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int decode(Record *record, const char *buffer, size_t length);
+// [ 4] int decodeSegment(const char *, size_t, const RecordVisitor&);
+// [ 2] void encode(char *buffer, const Record& record);
+// [ 2] size_t encodedLength(const Record& record);
+// [ 4] void writeFrameHeader(char *buffer, size_t length);
+// [ 4] void writeSegmentHeader(char *buffer);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: 'decode' rejects truncated and corrupt buffers
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::BinaryLogUtil Util;
+
+enum {
+    k_SEGMENT_HEADER_SIZE = Util::k_SEGMENT_HEADER_SIZE,
+    k_FRAME_HEADER_SIZE   = Util::k_FRAME_HEADER_SIZE
+};
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+void makeRecord(ball::Record *record, int index)
+    // Load into the specified 'record' a value that depends on the specified
+    // 'index', having user fields of every type for sufficiently large
+    // 'index' values.
+{
+    ball::RecordAttributes& attributes = record->fixedFields();
+
+    attributes.setTimestamp(bdlt::Datetime(2000 + index,
+                                           1 + index % 12,
+                                           1 + index % 28,
+                                           index % 24,
+                                           index % 60,
+                                           index % 60,
+                                           index % 1000,
+                                           index % 1000));
+    attributes.setProcessID(1000 + index);
+    attributes.setThreadID(static_cast<bsls::Types::Uint64>(index) << 40);
+    attributes.setFileName(index % 2 ? "" : "ball_binarylogutil.t.cpp");
+    attributes.setLineNumber(index * 7);
+    attributes.setCategory(index % 3 ? "EQUITY.NASD" : "");
+    attributes.setSeverity(ball::Severity::e_INFO + index);
+
+    attributes.clearMessage();
+    for (int i = 0; i < index; ++i) {
+        attributes.messageStreamBuf().sputn("message ", 8);
+    }
+    if (index % 4 == 3) {
+        attributes.messageStreamBuf().sputc('\0');  // embedded null
+    }
+
+    ball::UserFields& fields = record->customFields();
+
+    fields.removeAll();
+    for (int i = 0; i < index; ++i) {
+        switch (i % 6) {
+          case 0: {
+            fields.appendNull();
+          } break;
+          case 1: {
+            fields.appendInt64(-(static_cast<bsls::Types::Int64>(i) << 35));
+          } break;
+          case 2: {
+            fields.appendDouble(i * -1.25e-300);
+          } break;
+          case 3: {
+            fields.appendString(bsl::string(i, 'x'));
+          } break;
+          case 4: {
+            fields.appendDatetimeTz(bdlt::DatetimeTz(
+                                  bdlt::Datetime(9999, 12, 31, 23, 59, 59),
+                                  i * 10));
+          } break;
+          case 5: {
+            bsl::vector<char> array(i, 'y');
+            array.push_back('\0');
+            fields.appendCharArray(array);
+          } break;
+        }
+    }
+}
+
+struct RecordCollector {
+    // This 'struct' provides a visitor appending the records it is invoked
+    // with to a vector.
+
+    // DATA
+    bsl::vector<ball::Record> *d_records_p;
+
+    // ACCESSORS
+    void operator()(const ball::Record& record) const
+        // Append the specified 'record' to the vector.
+    {
+        d_records_p->push_back(record);
+    }
+};
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Example 1: Encoding and Decoding a Record
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to store a log record in a buffer and restore it later.
+//
+// First, we create a record:
+//..
+    ball::Record record;
+
+    record.fixedFields().setTimestamp(bdlt::Datetime(2020, 6, 1, 12, 30));
+    record.fixedFields().setThreadID(6);
+    record.fixedFields().setCategory("EQUITY.NASD");
+    record.fixedFields().setSeverity(ball::Severity::e_INFO);
+    record.fixedFields().setMessage("Hello, World!");
+    record.customFields().appendInt64(42);
+//..
+// Then, we encode the record into a buffer of sufficient size:
+//..
+    bsl::vector<char> buffer(ball::BinaryLogUtil::encodedLength(record));
+
+    ball::BinaryLogUtil::encode(buffer.data(), record);
+//..
+// Finally, we decode the buffer into another record, and verify that the two
+// records have the same value:
+//..
+    ball::Record decoded;
+
+    int rc = ball::BinaryLogUtil::decode(&decoded,
+                                         buffer.data(),
+                                         buffer.size());
+    ASSERT(0      == rc);
+    ASSERT(record == decoded);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SEGMENTS
+        //
+        // Concerns:
+        //: 1 'decodeSegment' visits, in order, every record of a segment
+        //:   written with 'writeSegmentHeader' and 'writeFrameHeader', and
+        //:   returns their number.
+        //:
+        //: 2 The sequence of records ends at a 0-length frame, or at the end
+        //:   of the segment.
+        //:
+        //: 3 'decodeSegment' returns a negative value if the header is not
+        //:   valid, or if a frame is truncated or corrupt, having visited the
+        //:   records preceding the invalid frame.
+        //
+        // Plan:
+        //: 1 Write segments holding 0 to 'N' records, with and without a
+        //:   terminating frame, and possibly followed by garbage after the
+        //:   terminator; verify that 'decodeSegment' visits the expected
+        //:   records.  (C-1..2)
+        //:
+        //: 2 Corrupt the header, truncate the last frame, and corrupt the
+        //:   last record, and verify the result of 'decodeSegment'.  (C-3)
+        //
+        // Testing:
+        //   int decodeSegment(const char *, size_t, const RecordVisitor&);
+        //   void writeFrameHeader(char *buffer, size_t length);
+        //   void writeSegmentHeader(char *buffer);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nSEGMENTS"
+                          << "\n========" << endl;
+
+        const int N = 8;
+
+        for (int ni = 0; ni <= N; ++ni) {
+            bsl::vector<ball::Record> expected;
+            bsl::vector<char>         segment(k_SEGMENT_HEADER_SIZE);
+
+            Util::writeSegmentHeader(segment.data());
+
+            bsl::size_t lastFrame = 0;
+
+            for (int i = 0; i < ni; ++i) {
+                ball::Record record;
+                makeRecord(&record, i);
+                expected.push_back(record);
+
+                const bsl::size_t length = Util::encodedLength(record);
+
+                lastFrame = segment.size();
+                segment.resize(lastFrame + k_FRAME_HEADER_SIZE + length);
+                Util::writeFrameHeader(segment.data() + lastFrame, length);
+                Util::encode(segment.data() + lastFrame + k_FRAME_HEADER_SIZE,
+                             record);
+            }
+
+            for (int terminated = 0; terminated < 3; ++terminated) {
+                bsl::vector<char> buffer(segment);
+
+                if (terminated) {
+                    buffer.resize(buffer.size() + k_FRAME_HEADER_SIZE);
+                    Util::writeFrameHeader(
+                                buffer.data() + buffer.size()
+                                                        - k_FRAME_HEADER_SIZE,
+                                0);
+                }
+                if (2 == terminated) {
+                    buffer.resize(buffer.size() + 3, '\x7f');  // garbage
+                }
+
+                if (veryVerbose) { T_ P_(ni) P(terminated) }
+
+                bsl::vector<ball::Record> records;
+                RecordCollector           collector = { &records };
+
+                int rc = Util::decodeSegment(buffer.data(),
+                                             buffer.size(),
+                                             collector);
+
+                ASSERTV(ni, terminated, rc, ni == rc);
+                ASSERTV(ni, terminated, expected == records);
+            }
+
+            // Invalid headers.
+
+            for (int i = 0; i < k_SEGMENT_HEADER_SIZE - 4; ++i) {
+                bsl::vector<char> buffer(segment);
+
+                buffer[i] = static_cast<char>(buffer[i] ^ 1);
+
+                bsl::vector<ball::Record> records;
+                RecordCollector           collector = { &records };
+
+                int rc = Util::decodeSegment(buffer.data(),
+                                             buffer.size(),
+                                             collector);
+
+                ASSERTV(ni, i, rc, 0 > rc);
+                ASSERTV(ni, i, records.empty());
+            }
+            {
+                bsl::vector<ball::Record> records;
+                RecordCollector           collector = { &records };
+
+                int rc = Util::decodeSegment(segment.data(),
+                                             k_SEGMENT_HEADER_SIZE - 1,
+                                             collector);
+
+                ASSERTV(ni, rc, 0 > rc);
+            }
+
+            if (0 == ni) {
+                continue;
+            }
+
+            // Truncated last frame.
+
+            {
+                bsl::vector<ball::Record> records;
+                RecordCollector           collector = { &records };
+
+                int rc = Util::decodeSegment(segment.data(),
+                                             segment.size() - 1,
+                                             collector);
+
+                ASSERTV(ni, rc, 0 > rc);
+                ASSERTV(ni, records.size(), ni - 1 == (int)records.size());
+            }
+
+            // Corrupt last frame: a length one byte too short.
+
+            {
+                bsl::vector<char> buffer(segment);
+
+                const bsl::size_t length = segment.size() - lastFrame
+                                                         - k_FRAME_HEADER_SIZE;
+
+                Util::writeFrameHeader(buffer.data() + lastFrame, length - 1);
+
+                bsl::vector<ball::Record> records;
+                RecordCollector           collector = { &records };
+
+                int rc = Util::decodeSegment(buffer.data(),
+                                             buffer.size(),
+                                             collector);
+
+                ASSERTV(ni, rc, 0 > rc);
+                ASSERTV(ni, records.size(), ni - 1 == (int)records.size());
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'decode' REJECTS TRUNCATED AND CORRUPT BUFFERS
+        //
+        // Concerns:
+        //: 1 'decode' fails if the buffer is shorter, or longer, than the
+        //:   encoded record.
+        //:
+        //: 2 'decode' fails if a user field has an unknown type, or if a
+        //:   timestamp is out of range.
+        //:
+        //: 3 'decode' has no effect on the record on failure.
+        //
+        // Plan:
+        //: 1 For a set of encoded records, decode every proper prefix of the
+        //:   encoding, and the encoding followed by an extra byte.  (C-1,3)
+        //:
+        //: 2 Alter the type of the first user field, and the timestamp, of an
+        //:   encoded record and verify that 'decode' fails.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: 'decode' rejects truncated and corrupt buffers
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: 'decode' REJECTS TRUNCATED AND "
+                             "CORRUPT BUFFERS"
+                          << "\n========================================"
+                             "===============" << endl;
+
+        ball::Record control;
+        makeRecord(&control, 5);
+
+        for (int ti = 0; ti < 8; ++ti) {
+            ball::Record record;
+            makeRecord(&record, ti);
+
+            bsl::vector<char> buffer(Util::encodedLength(record) + 1);
+            Util::encode(buffer.data(), record);
+
+            for (bsl::size_t length = 0; length <= buffer.size(); ++length) {
+                if (length == buffer.size() - 1) {
+                    continue;
+                }
+
+                ball::Record mX(control);
+
+                int rc = Util::decode(&mX, buffer.data(), length);
+
+                ASSERTV(ti, length, 0 != rc);
+                ASSERTV(ti, length, control == mX);
+            }
+        }
+
+        // Unknown user field type and invalid timestamps.
+
+        {
+            ball::Record record;
+            record.fixedFields().setTimestamp(bdlt::Datetime(2020, 1, 1));
+            record.fixedFields().setMessage("message");
+            record.customFields().appendInt64(1);
+
+            bsl::vector<char> buffer(Util::encodedLength(record));
+            Util::encode(buffer.data(), record);
+
+            ball::Record mX(control);
+
+            ASSERT(0 == Util::decode(&mX, buffer.data(), buffer.size()));
+            ASSERT(record == mX);
+
+            // The user field follows the count in the last 9 bytes.
+
+            const bsl::size_t typeOffset = buffer.size() - 9;
+
+            buffer[typeOffset] = 99;
+            mX = control;
+            ASSERT(0 != Util::decode(&mX, buffer.data(), buffer.size()));
+            ASSERT(control == mX);
+
+            Util::encode(buffer.data(), record);
+            bsl::memset(buffer.data(), '\xff', 8);  // timestamp
+            ASSERT(0 != Util::decode(&mX, buffer.data(), buffer.size()));
+            ASSERT(control == mX);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ENCODE AND DECODE
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the number of bytes written by 'encode'.
+        //:
+        //: 2 Decoding an encoded record produces a record having the same
+        //:   value, for every kind of attribute and user field, including
+        //:   empty strings and messages holding null characters.
+        //:
+        //: 3 'decode' overwrites every field of a record having another value.
+        //:
+        //: 4 'decode' allocates memory only from the allocator of the record.
+        //:
+        //: 5 'encode' does not allocate memory.
+        //
+        // Plan:
+        //: 1 For a set of records having user fields of every type, encode the
+        //:   record into a buffer larger than 'encodedLength', and verify that
+        //:   the trailing bytes are not modified.  (C-1)
+        //:
+        //: 2 Decode the buffer into a record having another value, created
+        //:   using a test allocator, and verify that the decoded record equals
+        //:   the original; use a default allocator guard to verify that no
+        //:   other allocator is used.  (C-2..5)
+        //
+        // Testing:
+        //   int decode(Record *record, const char *buffer, size_t length);
+        //   void encode(char *buffer, const Record& record);
+        //   size_t encodedLength(const Record& record);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nENCODE AND DECODE"
+                          << "\n=================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::TestAllocator         oa("object", veryVeryVeryVerbose);
+
+        const int N = 14;
+
+        for (int ti = 0; ti < N; ++ti) {
+            ball::Record record(&sa);
+            makeRecord(&record, ti);
+
+            const bsl::size_t LENGTH = Util::encodedLength(record);
+
+            if (veryVerbose) { T_ P_(ti) P(LENGTH) }
+
+            bsl::vector<char> buffer(LENGTH + 16, '\xa5', &sa);
+
+            ball::Record mX(&oa);
+            makeRecord(&mX, N - ti);
+
+            {
+                bslma::DefaultAllocatorGuard guard(&da);
+
+                Util::encode(buffer.data(), record);
+
+                for (bsl::size_t i = LENGTH; i < buffer.size(); ++i) {
+                    ASSERTV(ti, i, '\xa5' == buffer[i]);
+                }
+
+                int rc = Util::decode(&mX, buffer.data(), LENGTH);
+
+                ASSERTV(ti, rc, 0 == rc);
+            }
+
+            ASSERTV(ti, record == mX);
+            ASSERTV(ti, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode a record, decode it, and write and read a segment holding
+        //:   it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        ball::Record record;
+        makeRecord(&record, 6);
+
+        const bsl::size_t LENGTH = Util::encodedLength(record);
+
+        bsl::vector<char> segment(k_SEGMENT_HEADER_SIZE
+                                  + 2 * k_FRAME_HEADER_SIZE
+                                  + LENGTH);
+
+        Util::writeSegmentHeader(segment.data());
+        Util::writeFrameHeader(segment.data() + k_SEGMENT_HEADER_SIZE, LENGTH);
+        Util::encode(segment.data() + k_SEGMENT_HEADER_SIZE
+                                    + k_FRAME_HEADER_SIZE,
+                     record);
+        Util::writeFrameHeader(segment.data() + segment.size()
+                                              - k_FRAME_HEADER_SIZE,
+                               0);
+
+        ball::Record decoded;
+
+        ASSERT(0 == Util::decode(&decoded,
+                                 segment.data() + k_SEGMENT_HEADER_SIZE
+                                                + k_FRAME_HEADER_SIZE,
+                                 LENGTH));
+        ASSERT(record == decoded);
+
+        bsl::vector<ball::Record> records;
+        RecordCollector           collector = { &records };
+
+        ASSERT(1 == Util::decodeSegment(segment.data(),
+                                        segment.size(),
+                                        collector));
+        ASSERT(1      == records.size());
+        ASSERT(record == records[0]);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -21,21 +21,26 @@ BSLS_IDENT("$Id: $")
 //               ( ball::FileObserver )
 //                `------------------'
 //                         |              ctor
+//                         |              disableFileCompression
 //                         |              disableFileLogging
 //                         |              disableTimeIntervalRotation
 //                         |              disableSizeRotation
 //                         |              disableStdoutLoggingPrefix
 //                         |              disablePublishInLocalTime
+//                         |              enableFileCompression
 //                         |              enableFileLogging
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
+//                         |              setOnFileCompressionCallback
 //                         |              setOnFileRotationCallback
 //                         |              setStdoutThreshold
 //                         |              setLogFormat
 //                         |              getLogFormat
+//                         |              isFileCompressionEnabled
 //                         |              isFileLoggingEnabled
 //                         |              isStdoutLoggingPrefixEnabled
 //                         |              isPublishInLocalTimeEnabled
@@ -100,6 +105,10 @@ BSLS_IDENT("$Id: $")
 // |             | disableTimeIntervalRotation |                              |
 // |             | setOnFileRotationCallback   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | Rotated Log | enableFileCompression       | isFileCompressionEnabled     |
+// | File        | disableFileCompression      |                              |
+// | Compression | setOnFileCompressionCallback|                              |
+// +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::FileObserver' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -269,6 +278,14 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Rotated Log File Compression
+///----------------------------
+// A 'ball::FileObserver' may be configured, by calling
+// 'enableFileCompression', to compress each log file it successfully rotates
+// in the gzip format, on a background thread of low priority.  The rotated
+// log file, 'F', is replaced by the compressed file 'F.gz' once the
+// compression completes.  (See {'ball_fileobserver2'} for details.)
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver' are thread-safe, and can be called
@@ -379,6 +396,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
 
@@ -458,6 +476,15 @@ class FileObserver : public Observer {
         //                         const bsl::string& rotatedLogFileName);
         //..
 
+    typedef FileObserver2::OnFileCompressionCallback
+                                                     OnFileCompressionCallback;
+        // 'OnFileCompressionCallback' is an alias for a user-supplied callback
+        // function that is invoked, on a background thread, after the file
+        // observer attempts to compress a rotated log file.  The callback
+        // takes three arguments: (1) an integer status value where 0 indicates
+        // the file was successfully compressed, (2) the name of the rotated
+        // log file, and (3) the name of the compressed file.
+
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileObserver, bslma::UsesBslmaAllocator);
 
@@ -499,6 +526,12 @@ class FileObserver : public Observer {
         // and destroy this file observer.
 
     // MANIPULATORS
+    void disableFileCompression();
+        // Disable the compression of the log files subsequently rotated by
+        // this file observer.  This method has no effect if compression is not
+        // enabled.  Note that the rotated log files already queued for
+        // compression are still compressed.
+
     void disableFileLogging();
         // Disable file logging for this file observer.  This method has no
         // effect if file logging is not enabled.  Note that records
@@ -545,6 +578,14 @@ class FileObserver : public Observer {
         // enabled.  Note that this method also affects log filenames (see {Log
         // Filename Patterns}).
 
+    void enableFileCompression();
+        // Enable the compression, in the gzip format and on a background
+        // thread, of each log file subsequently rotated (successfully) by this
+        // file observer.  The rotated log file, 'F', is replaced by a
+        // compressed file named 'F.gz' once the compression completes.  This
+        // method has no effect if compression is already enabled.  See
+        // {Rotated Log File Compression}.
+
     int enableFileLogging(const char *logFilenamePattern);
         // Enable logging of all records published to this file observer to a
         // file whose name is derived from the specified 'logFilenamePattern'.
@@ -625,6 +666,17 @@ class FileObserver : public Observer {
         // 'record' is at least as severe as the value returned by
         // 'stdoutThreshold'.
 
+    void publishBatch(const Record *const *records, bsl::size_t numRecords);
+        // Process the specified 'numRecords' log records addressed by the
+        // elements of the specified 'records' array, in order, by writing
+        // them to the current log file if file logging is enabled for this
+        // file observer, and to 'stdout' those whose severity is at least as
+        // severe as the value returned by 'stdoutThreshold'.  This method has
+        // the same effect as calling 'publish' for each record, except that
+        // 'stdout' and the log file are each flushed once per batch rather
+        // than once per record.  The behavior is undefined unless 'records'
+        // refers to an array of at least 'numRecords' non-null pointers.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -666,6 +718,14 @@ class FileObserver : public Observer {
         // of 'bdlt::Datetime(1, 1, 1)' and an interval of 24 hours would
         // configure a periodic rotation at midnight each day.
 
+    void setOnFileCompressionCallback(
+                       const OnFileCompressionCallback& onCompressionCallback);
+        // Set the specified 'onCompressionCallback' to be invoked, on the
+        // background thread compressing the rotated log files, after each
+        // time this file observer attempts to compress a rotated log file.
+        // The behavior is undefined if the supplied function calls
+        // 'setOnFileCompressionCallback' on this file observer.
+
     void setOnFileRotationCallback(
                              const OnFileRotationCallback& onRotationCallback);
         // Set the specified 'onRotationCallback' to be invoked after each time
@@ -708,6 +768,10 @@ class FileObserver : public Observer {
         // into the specified '*stdoutFormat' address.  See {Log Record
         // Formatting} for details on the syntax of format specifications.
 
+    bool isFileCompressionEnabled() const;
+        // Return 'true' if the log files rotated by this file observer are
+        // compressed, and 'false' otherwise.
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
         // Return 'true' if file logging is enabled for this file observer, and
@@ -772,6 +836,12 @@ class FileObserver : public Observer {
                           // ------------------
 
 // MANIPULATORS
+inline
+void FileObserver::disableFileCompression()
+{
+    d_fileObserver2.disableFileCompression();
+}
+
 inline
 void FileObserver::disableFileLogging()
 {
@@ -796,6 +866,12 @@ void FileObserver::disableTimeIntervalRotation()
     d_fileObserver2.disableTimeIntervalRotation();
 }
 
+inline
+void FileObserver::enableFileCompression()
+{
+    d_fileObserver2.enableFileCompression();
+}
+
 inline
 int FileObserver::enableFileLogging(const char *logFilenamePattern)
 {
@@ -854,6 +930,13 @@ void FileObserver::rotateOnTimeInterval(
     d_fileObserver2.rotateOnTimeInterval(interval, startTime);
 }
 
+inline
+void FileObserver::setOnFileCompressionCallback(
+                        const OnFileCompressionCallback& onCompressionCallback)
+{
+    d_fileObserver2.setOnFileCompressionCallback(onCompressionCallback);
+}
+
 inline
 void FileObserver::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
@@ -862,6 +945,12 @@ void FileObserver::setOnFileRotationCallback(
 }
 
 // ACCESSORS
+inline
+bool FileObserver::isFileCompressionEnabled() const
+{
+    return d_fileObserver2.isFileCompressionEnabled();
+}
+
 inline
 bool FileObserver::isFileLoggingEnabled() const
 {
@@ -32,6 +32,7 @@
 #include <bslmf_assert.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 
 #include <bsls_assert.h>
@@ -50,6 +51,7 @@
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdio.h>
 #include <bsl_c_stdlib.h>    // 'unsetenv'
@@ -97,6 +99,7 @@ using bsl::flush;
 // [ 6] FileObserver(Allocator *);
 //
 // MANIPULATORS
+// [ 8] void disableFileCompression();
 // [ 1] void disableFileLogging();
 // [ 2] void disableLifetimeRotation();
 // [  ] void disablePublishInLocalTime();
@@ -104,6 +107,7 @@ using bsl::flush;
 // [ 1] void disableStdoutLoggingPrefix();
 // [  ] void disableTimeIntervalRotation();
 // [ 1] void disableUserFieldsLogging();
+// [ 8] void enableFileCompression();
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
 // [  ] void enablePublishInLocalTime();
@@ -111,17 +115,20 @@ using bsl::flush;
 // [ 1] void enableUserFieldsLogging();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [ 7] void publishBatch(const Record *const *records, size_t num);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnTimeInterval(const DatetimeInterval& interval);
 // [ 2] void rotateOnTimeInterval(const DtInterval& i, const Datetime& s);
 // [ 1] void setLogFormat(const char*, const char*);
+// [ 8] void setOnFileCompressionCallback(const OnFileCompressionCb&);
 // [ 4] void setOnFileRotationCallback(const OnFileRotationCallback&);
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold);
 //
 // ACCESSORS
 // [ 1] void getLogFormat(const char**, const char**) const;
+// [ 8] bool isFileCompressionEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(string& logFilename) const;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
@@ -136,7 +143,7 @@ using bsl::flush;
 // [ 6] CONCERN: 'FileObserver' can be created using 'allocate_shared'.
 // [ 5] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [ 4] CONCERN: ROTATION CALLBACK INVOCATION
-// [ 7] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 
 // Note assert and debug macros all output to cerr instead of cout, unlike
 // most other test drivers.  This is necessary because test case 1 plays
@@ -509,6 +516,45 @@ class LogRotationCallbackTester {
 
 typedef LogRotationCallbackTester RotCb;
 
+class CompressionCallback {
+    // This class can be used as a functor matching the signature of
+    // 'ball::FileObserver::OnFileCompressionCallback'.  This class implements
+    // the function-call operator, that records the arguments of the latest
+    // invocation into the variables supplied at construction, and posts the
+    // semaphore supplied at construction.
+
+    // DATA
+    int              *d_status_p;          // latest status
+    bsl::string      *d_compressedName_p;  // latest compressed file name
+    bslmt::Semaphore *d_semaphore_p;       // posted on each invocation
+
+  public:
+    // CREATORS
+    CompressionCallback(int              *status,
+                        bsl::string      *compressedName,
+                        bslmt::Semaphore *semaphore)
+        // Create a compression callback recording the arguments of each
+        // invocation into the specified 'status' and 'compressedName', and
+        // posting the specified 'semaphore'.
+    : d_status_p(status)
+    , d_compressedName_p(compressedName)
+    , d_semaphore_p(semaphore)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(int                status,
+                    const bsl::string&,
+                    const bsl::string& compressedName) const
+        // Record the specified 'status' and 'compressedName', and post the
+        // semaphore supplied at construction.
+    {
+        *d_status_p         = status;
+        *d_compressedName_p = compressedName;
+        d_semaphore_p->post();
+    }
+};
+
 struct TestCurrentTimeCallback {
   private:
     // DATA
@@ -687,7 +733,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
-      case 7: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -800,6 +846,228 @@ int main(int argc, char *argv[])
         observer->disableSizeRotation();
 //..
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING ROTATED LOG FILE COMPRESSION
+        //
+        // Concerns:
+        //: 1 The methods configuring the compression of rotated log files
+        //:   are forwarded to the underlying 'ball::FileObserver2'.
+        //
+        // Plan:
+        //: 1 Enable and disable compression, and verify the value returned by
+        //:   'isFileCompressionEnabled'.  Enable compression, set a
+        //:   compression callback, and force a rotation.  Wait for the
+        //:   callback, and verify that the rotated log file is replaced by a
+        //:   compressed file.  (C-1)
+        //
+        // Testing:
+        //   void disableFileCompression();
+        //   void enableFileCompression();
+        //   void setOnFileCompressionCallback(const OnFileCompressionCb&);
+        //   bool isFileCompressionEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ROTATED LOG FILE COMPRESSION"
+                          << "\n====================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "compressed.%T");
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        int              status = -1;
+        bsl::string      compressedFileName;
+        bslmt::Semaphore semaphore;
+        {
+            RotCb cb(&ta);
+
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERT(false == X.isFileCompressionEnabled());
+
+            mX.enableFileCompression();
+            ASSERT(true  == X.isFileCompressionEnabled());
+
+            mX.disableFileCompression();
+            ASSERT(false == X.isFileCompressionEnabled());
+
+            mX.enableFileCompression();
+            mX.setOnFileRotationCallback(cb);
+            mX.setOnFileCompressionCallback(
+                                  CompressionCallback(&status,
+                                                      &compressedFileName,
+                                                      &semaphore));
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        3,
+                                        "CATEGORY",
+                                        ball::Severity::e_WARN,
+                                        "compressed record");
+
+            mX.publish(ball::Record(attr, ball::UserFields()),
+                       ball::Context(ball::Transmission::e_PASSTHROUGH, 0, 1));
+
+            // Wait for the name of the rotated file to differ from the name
+            // of the new log file.
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+
+            mX.forceRotation();
+
+            ASSERT(1 == cb.numInvocations());
+            ASSERT(0 == cb.status());
+
+            semaphore.wait();
+
+            if (veryVerbose) { T_ P_(status) P(compressedFileName) }
+
+            ASSERTV(status, 0 == status);
+            ASSERTV(compressedFileName, cb.rotatedFileName(),
+                    cb.rotatedFileName() + ".gz" == compressedFileName);
+            ASSERT(false == FsUtil::exists(cb.rotatedFileName()));
+            ASSERT(FsUtil::getFileSize(compressedFileName) > 0);
+
+            mX.disableFileLogging();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the same content to 'stdout', and to the
+        //:   log file, as calling 'publish' for each record of the batch, in
+        //:   order.
+        //:
+        //: 2 Only the records having a severity at least as severe as the
+        //:   'stdout' threshold are written to 'stdout'.
+        //:
+        //: 3 'publishBatch' writes nothing if the batch is empty.
+        //
+        // Plan:
+        //: 1 Redirect 'stdout' to a file.  Publish a set of records having
+        //:   various severities with 'publish' to one observer, and with
+        //:   'publishBatch' to another, having the same 'stdout' threshold
+        //:   and format, and compare the output to 'stdout' and to the log
+        //:   file of each observer.  (C-1..2)
+        //:
+        //: 2 Call 'publishBatch' with an empty batch, and verify that nothing
+        //:   is written to 'stdout'.  (C-3)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, size_t num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string stdoutName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&stdoutName, "stdout");
+
+        bsl::string individualName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&individualName, "individual");
+
+        bsl::string batchName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&batchName, "batch");
+
+        {
+            const FILE *out = stdout;
+            ASSERT(out == freopen(stdoutName.c_str(), "w", stdout));
+            fflush(stdout);
+        }
+
+        enum { k_NUM_RECORDS = 60 };
+
+        const ball::Severity::Level SEVERITIES[] = {
+            ball::Severity::e_FATAL,
+            ball::Severity::e_ERROR,
+            ball::Severity::e_WARN,
+            ball::Severity::e_INFO,
+            ball::Severity::e_DEBUG,
+            ball::Severity::e_TRACE
+        };
+        const int NUM_SEVERITIES = sizeof SEVERITIES / sizeof *SEVERITIES;
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records;
+        bsl::vector<const ball::Record *>           pointers;
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            const bdlt::Datetime timestamp(2026, 1, 1, 0, 0, i);
+            const bsl::string    message(i, static_cast<char>('a' + i % 26));
+
+            ball::RecordAttributes attr(timestamp,
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        SEVERITIES[i % NUM_SEVERITIES],
+                                        message.c_str());
+
+            records.push_back(bsl::make_shared<ball::Record>(
+                                                        attr,
+                                                        ball::UserFields()));
+            pointers.push_back(records.back().get());
+        }
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        Obj individual(ball::Severity::e_WARN);
+        Obj batch(ball::Severity::e_WARN);
+
+        individual.disablePublishInLocalTime();
+        batch.disablePublishInLocalTime();
+
+        ASSERT(0 == individual.enableFileLogging(individualName.c_str()));
+        ASSERT(0 == batch.enableFileLogging(batchName.c_str()));
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            individual.publish(*records[i], context);
+        }
+
+        const FsUtil::Offset offset = FsUtil::getFileSize(stdoutName);
+
+        batch.publishBatch(pointers.data(), 0);
+        ASSERT(offset == FsUtil::getFileSize(stdoutName));
+
+        batch.publishBatch(pointers.data(), 1);
+        batch.publishBatch(pointers.data() + 1, k_NUM_RECORDS - 1);
+
+        individual.disableFileLogging();
+        batch.disableFileLogging();
+
+        const bsl::string stdoutContent = readPartialFile(stdoutName, 0);
+
+        const bsl::string individualStdout(stdoutContent, 0, offset);
+        const bsl::string batchStdout(stdoutContent, offset);
+
+        if (veryVerbose) { P(individualStdout); }
+
+        ASSERT(!individualStdout.empty());
+        ASSERT(individualStdout == batchStdout);
+        ASSERTV(individualStdout,
+                bsl::string::npos == individualStdout.find("INFO"));
+        ASSERTV(individualStdout,
+                bsl::string::npos != individualStdout.find("WARN"));
+
+        const bsl::string individualContent =
+                                          readPartialFile(individualName, 0);
+        const bsl::string batchContent = readPartialFile(batchName, 0);
+
+        ASSERT(!individualContent.empty());
+        ASSERT(individualContent == batchContent);
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // CONSTRUCTOR, MAKE_SHARED, AND ALLOCATE_SHARED TEST
@@ -358,6 +358,62 @@ static bdlt::Datetime computeNextRotationTime(
     return resultUtc;
 }
 
+                          // =====================
+                          // class NoSyncStreamBuf
+                          // =====================
+
+class NoSyncStreamBuf : public bsl::streambuf {
+    // This class provides a stream buffer that forwards the characters written
+    // to it to another stream buffer, but ignores requests to synchronize
+    // (i.e., flush) it.  It allows a batch of records to be formatted, by a
+    // formatting functor that flushes its stream after each record, into the
+    // buffer of a file stream that is then flushed once.
+
+    // DATA
+    bsl::streambuf *d_target_p;  // stream buffer written to (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    NoSyncStreamBuf(const NoSyncStreamBuf&);
+    NoSyncStreamBuf& operator=(const NoSyncStreamBuf&);
+
+  protected:
+    // PROTECTED MANIPULATORS
+    virtual int_type overflow(int_type character)
+        // Write the specified 'character' to the target stream buffer, unless
+        // it is 'eof'.  Return 'character' (or a value other than 'eof' if
+        // 'character' is 'eof') on success, and 'eof' otherwise.
+    {
+        if (traits_type::eq_int_type(character, traits_type::eof())) {
+            return traits_type::not_eof(character);                   // RETURN
+        }
+        return d_target_p->sputc(traits_type::to_char_type(character));
+    }
+
+    virtual int sync()
+        // Return 0, with no effect.
+    {
+        return 0;
+    }
+
+    virtual bsl::streamsize xsputn(const char      *buffer,
+                                   bsl::streamsize  numBytes)
+        // Write the specified 'numBytes' characters from the specified
+        // 'buffer' to the target stream buffer.  Return the number of
+        // characters written.
+    {
+        return d_target_p->sputn(buffer, numBytes);
+    }
+
+  public:
+    // CREATORS
+    explicit NoSyncStreamBuf(bsl::streambuf *target)
+        // Create a stream buffer forwarding to the specified 'target'.
+    : d_target_p(target)
+    {
+    }
+};
+
 }  // close unnamed namespace
 
                           // -------------------
@@ -365,6 +421,26 @@ static bdlt::Datetime computeNextRotationTime(
                           // -------------------
 
 // PRIVATE MANIPULATORS
+void FileObserver2::handleRotation(int                rotationStatus,
+                                   const bsl::string& rotatedFileName)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+    if (d_onRotationCb) {
+        d_onRotationCb(rotationStatus, rotatedFileName);
+    }
+
+    if (0 == rotationStatus
+     && d_compressRotatedFiles
+     && 0 != d_compressor.compressFile(rotatedFileName)) {
+        bsls::Log::platformDefaultMessageHandler(
+                           bsls::LogSeverity::e_ERROR,
+                           __FILE__,
+                           __LINE__,
+                           "Unable to start the log file compression thread.");
+    }
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -420,6 +496,23 @@ void FileObserver2::logRecordDefault(bsl::ostream& stream,
     stream.flush();
 }
 
+void FileObserver2::reportLogStreamError()
+{
+    char errorBuffer[256];
+
+    snprintf(errorBuffer,
+             sizeof errorBuffer,
+             "Error on file stream for %s: %s.",
+             d_logFileName.c_str(),
+             bsl::strerror(getErrorCode()));
+    bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                             __FILE__,
+                                             __LINE__,
+                                             errorBuffer);
+
+    d_logStreamBuf.clear();
+}
+
 int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
 {
     BSLS_ASSERT(rotatedLogFileName);
@@ -563,7 +656,9 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 , d_onRotationCb(bsl::allocator_arg_t(),
                  bsl::allocator<FileObserver2::OnFileRotationCallback>(
                                                                basicAllocator))
+, d_compressRotatedFiles(false)
 , d_rotationCbMutex()
+, d_compressor(basicAllocator)
 {
 }
 
@@ -575,6 +670,12 @@ FileObserver2::~FileObserver2()
 }
 
 // MANIPULATORS
+void FileObserver2::disableFileCompression()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+    d_compressRotatedFiles = false;
+}
+
 void FileObserver2::disableFileLogging()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -610,6 +711,12 @@ void FileObserver2::disableTimeIntervalRotation()
     d_rotationInterval.setTotalSeconds(0);
 }
 
+void FileObserver2::enableFileCompression()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+    d_compressRotatedFiles = true;
+}
+
 int FileObserver2::enableFileLogging(const char *logFilenamePattern)
 {
     BSLS_ASSERT(logFilenamePattern);
@@ -672,10 +779,7 @@ void FileObserver2::forceRotation()
     // to allow the callback to invoke other manipulators on this object.
 
     if (0 >= rotationStatus) {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
-        if (d_onRotationCb) {
-            d_onRotationCb(rotationStatus, rotatedLogFileName);
-        }
+        handleRotation(rotationStatus, rotatedLogFileName);
     }
 }
 
@@ -699,29 +803,61 @@ void FileObserver2::publish(const Record& record, const Context&)
             d_logFileFunctor(d_logOutStream, record);
 
             if (!d_logOutStream) {
-                char errorBuffer[256];
-
-                snprintf(errorBuffer,
-                         sizeof errorBuffer,
-                         "Error on file stream for %s: %s.",
-                         d_logFileName.c_str(),
-                         bsl::strerror(getErrorCode()));
-                bsls::Log::platformDefaultMessageHandler(
-                                                    bsls::LogSeverity::e_ERROR,
-                                                    __FILE__,
-                                                    __LINE__,
-                                                    errorBuffer);
-
-                d_logStreamBuf.clear();
+                reportLogStreamError();
             }
         }
     }
 
     if (0 >= rotationStatus) {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+        handleRotation(rotationStatus, rotatedFileName);
+    }
+}
+
+void FileObserver2::publishBatch(const Record *const *records,
+                                 bsl::size_t          numRecords)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
 
-        if (d_onRotationCb) {
-            d_onRotationCb(rotationStatus, rotatedFileName);
+    bsl::size_t index = 0;
+
+    while (index < numRecords) {
+        bsl::string rotatedFileName;
+        int         rotationStatus = 1;
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            // Format the records through a stream that does not flush the log
+            // file, and flush it once.  Stop after a rotation is attempted, so
+            // that the rotation callback is invoked before the next record is
+            // written.
+
+            NoSyncStreamBuf batchStreamBuf(&d_logStreamBuf);
+            bsl::ostream    batchStream(&batchStreamBuf);
+
+            while (index < numRecords && 0 < rotationStatus) {
+                const Record& record = *records[index++];
+
+                rotationStatus = rotateIfNecessary(
+                                            &rotatedFileName,
+                                            record.fixedFields().timestamp());
+
+                if (d_logStreamBuf.isOpened()) {
+                    d_logFileFunctor(batchStream, record);
+                }
+            }
+
+            if (d_logStreamBuf.isOpened()) {
+                d_logOutStream.flush();
+
+                if (!batchStream || !d_logOutStream) {
+                    reportLogStreamError();
+                }
+            }
+        }
+
+        if (0 >= rotationStatus) {
+            handleRotation(rotationStatus, rotatedFileName);
         }
     }
 }
@@ -777,6 +913,12 @@ void FileObserver2::setLogFileFunctor(const LogRecordFunctor& logFileFunctor)
     d_logFileFunctor = logFileFunctor;
 }
 
+void FileObserver2::setOnFileCompressionCallback(
+                        const OnFileCompressionCallback& onCompressionCallback)
+{
+    d_compressor.setOnCompressionCallback(onCompressionCallback);
+}
+
 void FileObserver2::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
 {
@@ -785,6 +927,13 @@ void FileObserver2::setOnFileRotationCallback(
 }
 
 // ACCESSORS
+bool FileObserver2::isFileCompressionEnabled() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+
+    return d_compressRotatedFiles;
+}
+
 bool FileObserver2::isFileLoggingEnabled() const
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -12,7 +12,7 @@ BSLS_IDENT("$Id: $")
 //  ball::FileObserver2: observer that outputs log records to a file
 //
 //@SEE_ALSO: ball_record, ball_context, ball_observer,
-//           ball_recordstringformatter
+//           ball_recordstringformatter, ball_logfilecompressor
 //
 //@DESCRIPTION: This component provides a concrete implementation of the
 // 'ball::Observer' protocol, 'ball::FileObserver2', for publishing log records
@@ -23,17 +23,22 @@ BSLS_IDENT("$Id: $")
 //               ( ball::FileObserver2 )
 //                `-------------------'
 //                         |              ctor
+//                         |              disableFileCompression
 //                         |              disableFileLogging
 //                         |              disableTimeIntervalRotation
 //                         |              disableSizeRotation
 //                         |              disablePublishInLocalTime
+//                         |              enableFileCompression
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
+//                         |              setOnFileCompressionCallback
 //                         |              setOnFileRotationCallback
+//                         |              isFileCompressionEnabled
 //                         |              isFileLoggingEnabled
 //                         |              isPublishInLocalTimeEnabled
 //                         |              rotationLifetime
@@ -52,7 +57,8 @@ BSLS_IDENT("$Id: $")
 // logging to a file is initially disabled following construction.  The format
 // of published log records is user-configurable (see {Log Record Formatting}
 // below).  In addition, a file observer may be configured to perform automatic
-// log file rotation (see {Log File Rotation} below).
+// log file rotation (see {Log File Rotation} below), and to compress the
+// rotated log files (see {Rotated Log File Compression} below).
 //
 ///File Observer Configuration Synopsis
 ///------------------------------------
@@ -80,6 +86,10 @@ BSLS_IDENT("$Id: $")
 // |             | disableTimeIntervalRotation |                              |
 // |             | setOnFileRotationCallback   |                              |
 // +-------------+-----------------------------+------------------------------+
+// | Rotated Log | enableFileCompression       | isFileCompressionEnabled     |
+// | File        | disableFileCompression      |                              |
+// | Compression | setOnFileCompressionCallback|                              |
+// +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::FileObserver2' object can be dynamically configured
 // throughout its lifetime (in particular, before or after being registered
@@ -238,6 +248,22 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Rotated Log File Compression
+///----------------------------
+// A 'ball::FileObserver2' may be configured, by calling
+// 'enableFileCompression', to compress each log file it successfully rotates
+// in the gzip format.  The compression is performed by a
+// 'ball::LogFileCompressor' on a background thread of low priority, so that
+// the logging thread performing the rotation does not wait for the
+// compression: the rotated log file, 'F', is replaced by the compressed file
+// 'F.gz' once the compression completes (see 'ball_logfilecompressor').  The
+// callback supplied to 'setOnFileCompressionCallback', if any, is invoked on
+// that background thread once each rotated log file is processed.
+//
+// Note that the log files rotated while compression is enabled, and that are
+// not yet compressed when the file observer is destroyed, are left
+// uncompressed.
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -302,6 +328,7 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <ball_logfilecompressor.h>
 #include <ball_observer.h>
 #include <ball_severity.h>
 
@@ -317,6 +344,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_fstream.h>
 #include <bsl_functional.h>
 #include <bsl_iosfwd.h>
@@ -360,6 +388,20 @@ class FileObserver2 : public Observer {
         //                         const bsl::string& rotatedLogFileName);
         //..
 
+    typedef LogFileCompressor::OnCompressionCallback
+                                                     OnFileCompressionCallback;
+        // 'OnFileCompressionCallback' is an alias for a user-supplied callback
+        // function that is invoked, on a background thread, after the file
+        // observer attempts to compress a rotated log file.  The callback
+        // takes three arguments: (1) an integer status value where 0 indicates
+        // the file was successfully compressed, (2) the name of the rotated
+        // log file, and (3) the name of the compressed file.  E.g.:
+        //..
+        //  void onLogFileCompression(int                compressionStatus,
+        //                            const bsl::string& rotatedLogFileName,
+        //                            const bsl::string& compressedFileName);
+        //..
+
   private:
     // DATA
     bdls::FdStreamBuf      d_logStreamBuf;             // stream buffer for
@@ -412,13 +454,22 @@ class FileObserver2 : public Observer {
                                                        // invoked following
                                                        // file rotation
 
+    bool                   d_compressRotatedFiles;     // 'true' if rotated
+                                                       // log files are
+                                                       // compressed
+
     mutable bslmt::Mutex   d_rotationCbMutex;          // serialize access to
-                                                       // 'd_onRotationCb';
+                                                       // 'd_onRotationCb' and
+                                                       // the compression flag;
                                                        // required because
                                                        // callback must be
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    LogFileCompressor      d_compressor;               // compresses rotated
+                                                       // log files on a
+                                                       // background thread
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
@@ -426,10 +477,23 @@ class FileObserver2 : public Observer {
 
   private:
     // PRIVATE MANIPULATORS
+    void handleRotation(int                rotationStatus,
+                        const bsl::string& rotatedFileName);
+        // Invoke the file-rotation callback, if any, with the specified
+        // 'rotationStatus' and 'rotatedFileName', and queue the file named
+        // 'rotatedFileName' for compression if 'rotationStatus' is 0 and
+        // compression of rotated log files is enabled.  The behavior is
+        // undefined if the caller acquired the lock for this object.
+
     void logRecordDefault(bsl::ostream& stream, const Record& record);
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
 
+    void reportLogStreamError();
+        // Report the failure of the log file stream, and clear its state.  The
+        // behavior is undefined unless the caller acquired the lock for this
+        // object.
+
     int rotateFile(bsl::string *rotatedLogFileName);
         // Perform a log file rotation by closing the current log file of this
         // file observer, renaming the closed log file if necessary, and
@@ -470,9 +534,17 @@ class FileObserver2 : public Observer {
 
     ~FileObserver2();
         // Close the log file of this file observer if file logging is enabled,
-        // and destroy this file observer.
+        // and destroy this file observer.  Wait for the compression of the
+        // rotated log file being compressed, if any, to complete; rotated log
+        // files not yet being compressed are left uncompressed.
 
     // MANIPULATORS
+    void disableFileCompression();
+        // Disable the compression of the log files subsequently rotated by
+        // this file observer.  This method has no effect if compression is not
+        // enabled.  Note that the rotated log files already queued for
+        // compression are still compressed.
+
     void disableFileLogging();
         // Disable file logging for this file observer.  This method has no
         // effect if file logging is not enabled.  Note that records
@@ -503,6 +575,14 @@ class FileObserver2 : public Observer {
         // enabled.  Note that this method also affects log filenames (see {Log
         // Filename Patterns}).
 
+    void enableFileCompression();
+        // Enable the compression, in the gzip format and on a background
+        // thread, of each log file subsequently rotated (successfully) by this
+        // file observer.  The rotated log file, 'F', is replaced by a
+        // compressed file named 'F.gz' once the compression completes.  This
+        // method has no effect if compression is already enabled.  See
+        // {Rotated Log File Compression}.
+
     int enableFileLogging(const char *logFilenamePattern);
         // Enable logging of all records published to this file observer to a
         // file whose name is derived from the specified 'logFilenamePattern'.
@@ -565,6 +645,17 @@ class FileObserver2 : public Observer {
         // enabled for this file observer.  The method has no effect if file
         // logging is not enabled, in which case 'record' is dropped.
 
+    void publishBatch(const Record *const *records, bsl::size_t numRecords);
+        // Process the specified 'numRecords' log records addressed by the
+        // elements of the specified 'records' array, in order, by writing
+        // them to the current log file if file logging is enabled for this
+        // file observer.  This method has the same effect as calling
+        // 'publish' for each record, except that the log file is flushed once
+        // per batch (and once per log file rotation) rather than once per
+        // record, so that the records are typically written to the file by a
+        // single system call.  The behavior is undefined unless 'records'
+        // refers to an array of at least 'numRecords' non-null pointers.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
@@ -617,6 +708,14 @@ class FileObserver2 : public Observer {
         // behavior.
 
 
+    void setOnFileCompressionCallback(
+                       const OnFileCompressionCallback& onCompressionCallback);
+        // Set the specified 'onCompressionCallback' to be invoked, on the
+        // background thread compressing the rotated log files, after each
+        // time this file observer attempts to compress a rotated log file.
+        // The behavior is undefined if the supplied function calls
+        // 'setOnFileCompressionCallback' on this file observer.
+
     void setOnFileRotationCallback(
                              const OnFileRotationCallback& onRotationCallback);
         // Set the specified 'onRotationCallback' to be invoked after each time
@@ -627,6 +726,10 @@ class FileObserver2 : public Observer {
         // write to the 'ball' log).
 
     // ACCESSORS
+    bool isFileCompressionEnabled() const;
+        // Return 'true' if the log files rotated by this file observer are
+        // compressed, and 'false' otherwise.
+
     bool isFileLoggingEnabled() const;
     bool isFileLoggingEnabled(bsl::string *result) const;
         // Return 'true' if file logging is enabled for this file observer, and
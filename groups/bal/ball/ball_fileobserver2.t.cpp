@@ -34,6 +34,7 @@
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
 
 #include <bslstl_stringref.h>
@@ -51,7 +52,9 @@
 #include <bsl_ctime.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
+#include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -91,32 +94,37 @@ using bsl::flush;
 // [ 1] ~FileObserver2();
 //
 // MANIPULATORS
+// [15] void disableFileCompression();
 // [ 1] void disableFileLogging();
 // [ 2] void disableLifetimeRotation();
 // [ 1] void disablePublishInLocalTime();
 // [ 2] void disableSizeRotation();
 // [ 8] void disableTimeIntervalRotation();
+// [15] void enableFileCompression();
 // [ 1] int  enableFileLogging(const char *fileName);
 // [ 1] int  enableFileLogging(const char *fileName, bool timestampFlag);
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [14] void publishBatch(const Record *const *records, size_t num);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
 // [ 8] void rotateOnTimeInterval(const DatetimeInterval& interval);
 // [ 9] void rotateOnTimeInterval(const DtInterval& i, const Datetime& s);
 // [ 1] void setLogFileFunctor(const logRecordFunctor& logFileFunctor);
+// [15] void setOnFileCompressionCallback(const OnFileCompressionCb&);
 // [ 5] void setOnFileRotationCallback(const OnFileRotationCallback&);
 //
 // ACCESSORS
+// [15] bool isFileCompressionEnabled() const;
 // [ 1] bool isFileLoggingEnabled() const;
 // [ 1] bool isFileLoggingEnabled(bsl::string *result) const;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -575,6 +583,85 @@ int getNumLines(const char *fileName)
     return numLines;
 }
 
+class LineCountingRotationCallback {
+    // This class can be used as a functor matching the signature of
+    // 'ball::FileObserver2::OnFileRotationCallback'.  This class implements
+    // the function-call operator, that counts the rotations, and the lines of
+    // each rotated log file (at the time of the rotation), into the counters
+    // supplied at construction.
+
+    // DATA
+    int *d_numRotations_p;  // number of successful rotations
+    int *d_numLines_p;      // number of lines in the rotated files
+
+  public:
+    // CREATORS
+    LineCountingRotationCallback(int *numRotations, int *numLines)
+        // Create a rotation callback counting the rotations into the
+        // specified 'numRotations' and the lines of the rotated files into
+        // the specified 'numLines'.
+    : d_numRotations_p(numRotations)
+    , d_numLines_p(numLines)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(int status, const bsl::string& rotatedFileName) const
+        // Count the rotation, and the lines of the specified
+        // 'rotatedFileName', if the specified 'status' is 0.
+    {
+        ASSERTV(status, 0 == status);
+
+        if (0 == status) {
+            ++*d_numRotations_p;
+            *d_numLines_p += getNumLines(rotatedFileName.c_str());
+        }
+    }
+};
+
+class CompressionCallback {
+    // This class can be used as a functor matching the signature of
+    // 'ball::FileObserver2::OnFileCompressionCallback'.  This class implements
+    // the function-call operator, that records the arguments of the latest
+    // invocation into the variables supplied at construction, and posts the
+    // semaphore supplied at construction.
+
+    // DATA
+    int              *d_status_p;          // latest status
+    bsl::string      *d_fileName_p;        // latest rotated file name
+    bsl::string      *d_compressedName_p;  // latest compressed file name
+    bslmt::Semaphore *d_semaphore_p;       // posted on each invocation
+
+  public:
+    // CREATORS
+    CompressionCallback(int              *status,
+                        bsl::string      *fileName,
+                        bsl::string      *compressedName,
+                        bslmt::Semaphore *semaphore)
+        // Create a compression callback recording the arguments of each
+        // invocation into the specified 'status', 'fileName', and
+        // 'compressedName', and posting the specified 'semaphore'.
+    : d_status_p(status)
+    , d_fileName_p(fileName)
+    , d_compressedName_p(compressedName)
+    , d_semaphore_p(semaphore)
+    {
+    }
+
+    // ACCESSORS
+    void operator()(int                status,
+                    const bsl::string& fileName,
+                    const bsl::string& compressedName) const
+        // Record the specified 'status', 'fileName', and 'compressedName', and
+        // post the semaphore supplied at construction.
+    {
+        *d_status_p         = status;
+        *d_fileName_p       = fileName;
+        *d_compressedName_p = compressedName;
+        d_semaphore_p->post();
+    }
+};
+
 struct TestCurrentTimeCallback {
   private:
     // DATA
@@ -712,7 +799,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -788,6 +875,287 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING ROTATED LOG FILE COMPRESSION
+        //
+        // Concerns:
+        //: 1 Compression of rotated log files is initially disabled, and
+        //:   'isFileCompressionEnabled' reflects the latest call to
+        //:   'enableFileCompression' or 'disableFileCompression'.
+        //:
+        //: 2 When compression is enabled, each rotated log file, 'F', is
+        //:   replaced by the compressed file 'F.gz', and the compression
+        //:   callback is invoked with the status of the compression, 'F', and
+        //:   'F.gz'.
+        //:
+        //: 3 The rotation callback is still invoked when compression is
+        //:   enabled.
+        //:
+        //: 4 When compression is disabled, rotated log files are left
+        //:   uncompressed.
+        //
+        // Plan:
+        //: 1 Enable and disable compression, and verify the value returned by
+        //:   'isFileCompressionEnabled'.  (C-1)
+        //:
+        //: 2 Enable compression, publish a record, and force a rotation.
+        //:   Wait for the compression callback, and verify its arguments and
+        //:   the files in the log directory.  (C-2..3)
+        //:
+        //: 3 Disable compression, publish a record, force a rotation, and
+        //:   destroy the observer.  Verify that the rotated file is not
+        //:   compressed.  (C-4)
+        //
+        // Testing:
+        //   void disableFileCompression();
+        //   void enableFileCompression();
+        //   void setOnFileCompressionCallback(const OnFileCompressionCb&);
+        //   bool isFileCompressionEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ROTATED LOG FILE COMPRESSION"
+                          << "\n====================================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string fileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&fileName, "compressed.%T");
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        int              status = -1;
+        bsl::string      compressedFileName;
+        bsl::string      rotatedFileName;
+        bslmt::Semaphore semaphore;
+
+        bsl::string uncompressedFileName;
+        {
+            RotCb rotCb(&ta);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            if (verbose) cout << "\tEnabling and disabling." << endl;
+
+            ASSERT(false == X.isFileCompressionEnabled());
+
+            mX.enableFileCompression();
+            ASSERT(true  == X.isFileCompressionEnabled());
+
+            mX.enableFileCompression();
+            ASSERT(true  == X.isFileCompressionEnabled());
+
+            mX.disableFileCompression();
+            ASSERT(false == X.isFileCompressionEnabled());
+
+            if (verbose) cout << "\tCompressing a rotated file." << endl;
+
+            mX.enableFileCompression();
+            mX.setOnFileRotationCallback(rotCb);
+            mX.setOnFileCompressionCallback(
+                                  CompressionCallback(&status,
+                                                      &rotatedFileName,
+                                                      &compressedFileName,
+                                                      &semaphore));
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            publishRecord(&mX, "compressed record");
+
+            // Wait for the name of the rotated file to differ from the name
+            // of the new log file.
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+
+            mX.forceRotation();
+
+            ASSERT(1 == rotCb.numInvocations());
+            ASSERT(0 == rotCb.status());
+
+            semaphore.wait();
+
+            if (veryVerbose) {
+                T_ P_(status) P_(rotatedFileName) P(compressedFileName)
+            }
+
+            ASSERTV(status, 0 == status);
+            ASSERTV(rotatedFileName, rotCb.rotatedFileName(),
+                    rotCb.rotatedFileName() == rotatedFileName);
+            ASSERTV(compressedFileName,
+                    rotatedFileName + ".gz" == compressedFileName);
+
+            ASSERT(false == FsUtil::exists(rotatedFileName));
+            ASSERT(FsUtil::getFileSize(compressedFileName) > 0);
+
+            bsl::ifstream compressed(compressedFileName.c_str(),
+                                     bsl::ios_base::binary);
+            ASSERT(0x1f == compressed.get());
+            ASSERT(0x8b == compressed.get());
+
+            if (verbose) cout << "\tDisabling compression." << endl;
+
+            mX.disableFileCompression();
+
+            publishRecord(&mX, "uncompressed record");
+
+            bslmt::ThreadUtil::microSleep(0, 1);
+
+            mX.forceRotation();
+
+            ASSERT(2 == rotCb.numInvocations());
+            ASSERT(0 == rotCb.status());
+
+            uncompressedFileName = rotCb.rotatedFileName();
+
+            mX.disableFileLogging();
+        }
+
+        ASSERT(true  == FsUtil::exists(uncompressedFileName));
+        ASSERT(false == FsUtil::exists(uncompressedFileName + ".gz"));
+        ASSERT(0 != semaphore.tryWait());
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the same content to the log file as
+        //:   calling 'publish' for each record of the batch, in order.
+        //:
+        //: 2 'publishBatch' rotates the log file as 'publish' does, within a
+        //:   batch, and invokes the rotation callback once per rotation,
+        //:   before the records following the rotation are written.
+        //:
+        //: 3 No record is lost or duplicated across rotations.
+        //:
+        //: 4 'publishBatch' has no effect if file logging is disabled, or if
+        //:   the batch is empty.
+        //
+        // Plan:
+        //: 1 Publish a set of records with 'publish' to one file, and with
+        //:   'publishBatch' to another, and compare the files.  (C-1)
+        //:
+        //: 2 Enable rotation on size, and publish batches of records larger
+        //:   than the rotation size.  Count the lines of each rotated file
+        //:   from the rotation callback, and verify that the total number of
+        //:   lines is the number of records published.  (C-2..3)
+        //:
+        //: 3 Call 'publishBatch' with logging disabled, and with an empty
+        //:   batch.  (C-4)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, size_t num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        TempDirectoryGuard tempDirGuard;
+
+        enum {
+            k_NUM_RECORDS   = 100,
+            k_LINES_PER_REC = 2     // the default format starts with '\n'
+        };
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records;
+        bsl::vector<const ball::Record *>           pointers;
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::string message(i, static_cast<char>('a' + i % 26));
+
+            const bdlt::Datetime timestamp(2026, 1, 1, 0, i / 60, i % 60);
+
+            ball::RecordAttributes attr(timestamp,
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        32,
+                                        message.c_str());
+
+            records.push_back(bsl::make_shared<ball::Record>(
+                                                        attr,
+                                                        ball::UserFields()));
+            pointers.push_back(records.back().get());
+        }
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (verbose) cout << "\tComparing with 'publish'." << endl;
+        {
+            bsl::string individualName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&individualName, "individual");
+
+            bsl::string batchName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&batchName, "batch");
+
+            Obj individual;
+            Obj batch;
+
+            ASSERT(0 == individual.enableFileLogging(individualName.c_str()));
+            ASSERT(0 == batch.enableFileLogging(batchName.c_str()));
+
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                individual.publish(*records[i], context);
+            }
+
+            batch.publishBatch(pointers.data(), 0);
+            batch.publishBatch(pointers.data(), 1);
+            batch.publishBatch(pointers.data() + 1, k_NUM_RECORDS - 1);
+
+            individual.disableFileLogging();
+            batch.disableFileLogging();
+
+            batch.publishBatch(pointers.data(), k_NUM_RECORDS);
+
+            bsl::string individualContent;
+            bsl::string batchContent;
+
+            const int k_NUM_LINES = k_LINES_PER_REC * k_NUM_RECORDS;
+
+            ASSERT(k_NUM_LINES == readFileIntoString(__LINE__,
+                                                     individualName,
+                                                     individualContent));
+            ASSERT(k_NUM_LINES == readFileIntoString(__LINE__,
+                                                     batchName,
+                                                     batchContent));
+            ASSERT(individualContent == batchContent);
+        }
+
+        if (verbose) cout << "\tRotation within a batch." << endl;
+        {
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName, "rotating");
+
+            int numRotations = 0;
+            int numLines     = 0;
+
+            Obj mX;
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            mX.rotateOnSize(1);
+            mX.setOnFileRotationCallback(
+                       LineCountingRotationCallback(&numRotations, &numLines));
+
+            for (int i = 0; i < 3; ++i) {
+                mX.publishBatch(pointers.data(), k_NUM_RECORDS);
+            }
+
+            bsl::string currentName;
+            ASSERT(mX.isFileLoggingEnabled(&currentName));
+
+            mX.disableFileLogging();
+
+            numLines += getNumLines(currentName.c_str());
+
+            if (veryVerbose) { T_ P_(numRotations) P(numLines) }
+
+            ASSERTV(numRotations, 3 < numRotations);
+            ASSERTV(numLines, 3 * k_LINES_PER_REC * k_NUM_RECORDS == numLines);
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
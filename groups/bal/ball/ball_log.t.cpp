@@ -2917,6 +2917,34 @@ void *workerThreadPerformance(void *)
 
 }  // close namespace BALL_LOG_TEST_CASE_MINUS_2
 
+namespace BALL_LOG_TEST_CASE_MINUS_3 {
+
+enum {
+    NUM_ITERATIONS = 10000000
+};
+
+double measureDisabledStatements()
+    // Return the average time, in nanoseconds, of a 'BALL_LOG_TRACE' and a
+    // 'BALL_LOG_DEBUG' statement that are disabled by the threshold levels of
+    // their category and by the logging rules active in the current thread.
+{
+    BALL_LOG_SET_CATEGORY("DISABLED.CATEGORY");
+
+    BloombergLP::bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < NUM_ITERATIONS; ++i) {
+        BALL_LOG_TRACE << "trace " << i;
+        BALL_LOG_DEBUG << "debug " << i;
+    }
+
+    timer.stop();
+
+    return timer.accumulatedWallTime() * 1e9 / (2.0 * NUM_ITERATIONS);
+}
+
+}  // close namespace BALL_LOG_TEST_CASE_MINUS_3
+
 // ============================================================================
 //                              MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -11968,6 +11996,69 @@ if (verbose) bsl::cout << "printf-style macro usage" << bsl::endl;
                   << " seconds."
                   << bsl::endl;
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DISABLED STATEMENTS WITH ACTIVE RULES
+        //
+        // Concerns:
+        //: 1 This test measures the cost of logging statements that are
+        //:   disabled, both without any logging rule and with a relevant
+        //:   logging rule that raises the threshold of the category holder
+        //:   but is not active in the logging thread, which makes it possible
+        //:   to compare the performance of different implementations.
+        //
+        // Plan
+        //: 1 Measure the average time of a disabled logging statement with no
+        //:   logging rule, then with a relevant logging rule whose predicate
+        //:   is not satisfied, and then with that rule active but having
+        //:   thresholds that do not enable the statements, and publish them.
+        // --------------------------------------------------------------------
+
+        using namespace BloombergLP;    // OK here
+        using namespace BALL_LOG_TEST_CASE_MINUS_3;
+
+        TestAllocator ta(veryVeryVeryVerbose);
+
+        ball::LoggerManagerConfiguration lmc;
+        lmc.setDefaultThresholdLevelsIfValid(
+                    ball::Severity::e_ERROR,  // record level
+                    ball::Severity::e_OFF,    // passthrough level
+                    ball::Severity::e_OFF,    // trigger level
+                    ball::Severity::e_OFF);   // triggerAll level
+        ball::LoggerManagerScopedGuard   lmg(lmc, &ta);
+
+        bsl::shared_ptr<TestObserver> observer(
+                                  new (ta) TestObserver(&bsl::cout, &ta), &ta);
+        LoggerManager& manager = LoggerManager::singleton();
+
+        ASSERT(0 == manager.registerObserver(observer, "test"));
+
+        measureDisabledStatements();  // warm up
+
+        bsl::cout << "No rule:                 "
+                  << measureDisabledStatements()
+                  << " ns per statement." << bsl::endl;
+
+        ball::Rule inactiveRule("DISABLED*", 0, Sev::e_TRACE, 0, 0);
+        inactiveRule.addPredicate(ball::Predicate("requestId", 42));
+        manager.addRule(inactiveRule);
+
+        bsl::cout << "Inactive relevant rule:  "
+                  << measureDisabledStatements()
+                  << " ns per statement." << bsl::endl;
+
+        ball::Rule activeRule("DISABLED*", 0, Sev::e_INFO, 0, 0);
+        activeRule.addPredicate(ball::Predicate("requestId", 7));
+        manager.addRule(activeRule);
+
+        ball::ScopedAttribute attribute("requestId", 7);
+
+        bsl::cout << "Active rule (INFO):      "
+                  << measureDisabledStatements()
+                  << " ns per statement." << bsl::endl;
+
+        ASSERT(0 == observer->numPublishedRecords());
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
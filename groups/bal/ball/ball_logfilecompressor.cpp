@@ -0,0 +1,235 @@
+// ball_logfilecompressor.cpp                                         -*-C++-*-
+#include <ball_logfilecompressor.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_logfilecompressor_cpp,"$Id$ $CSID$")
+
+#include <bdlde_gziputil.h>
+
+#include <bdlf_memfn.h>
+
+#include <bdls_fdstreambuf.h>
+#include <bdls_filesystemutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                          // -----------------------
+                          // class LogFileCompressor
+                          // -----------------------
+
+// PRIVATE CLASS METHODS
+int LogFileCompressor::compressImp(const bsl::string&  fileName,
+                                   const bsl::string&  compressedFileName,
+                                   bslma::Allocator   *allocator)
+{
+    typedef bdls::FilesystemUtil FileUtil;
+
+    FileUtil::FileDescriptor inputFd = FileUtil::open(fileName,
+                                                      FileUtil::e_OPEN,
+                                                      FileUtil::e_READ_ONLY);
+    if (FileUtil::k_INVALID_FD == inputFd) {
+        return -1;                                                    // RETURN
+    }
+
+    bdls::FdStreamBuf input(inputFd, false, true, true, allocator);
+
+    FileUtil::FileDescriptor outputFd = FileUtil::open(
+                                                   compressedFileName,
+                                                   FileUtil::e_OPEN_OR_CREATE,
+                                                   FileUtil::e_WRITE_ONLY,
+                                                   FileUtil::e_TRUNCATE);
+    if (FileUtil::k_INVALID_FD == outputFd) {
+        return -2;                                                    // RETURN
+    }
+
+    int rc;
+    {
+        bdls::FdStreamBuf output(outputFd, true, true, true, allocator);
+
+        rc = bdlde::GzipUtil::compress(&output, &input, allocator);
+
+        if (0 != output.clear()) {
+            rc = -3;
+        }
+    }
+
+    if (0 != rc) {
+        FileUtil::remove(compressedFileName);
+        return -3;                                                    // RETURN
+    }
+
+    input.clear();
+
+    return 0 == FileUtil::remove(fileName) ? 0 : -4;
+}
+
+// PRIVATE MANIPULATORS
+void LogFileCompressor::threadEntryPoint()
+{
+    bsl::string           fileName(d_allocator_p);
+    bsl::string           compressedFileName(d_allocator_p);
+    OnCompressionCallback callback(bsl::allocator_arg, d_allocator_p);
+
+    for (;;) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            while (d_fileNames.empty() && !d_isStopping) {
+                d_queueCondition.wait(&d_mutex);
+            }
+
+            if (d_isStopping) {
+                return;                                               // RETURN
+            }
+
+            fileName.swap(d_fileNames.front());
+            d_fileNames.pop_front();
+
+            callback = d_onCompressionCb;
+        }
+
+        compressedFileName  = fileName;
+        compressedFileName += ".gz";
+
+        const int status = compressImp(fileName,
+                                       compressedFileName,
+                                       d_allocator_p);
+
+        if (callback) {
+            callback(status, fileName, compressedFileName);
+        }
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            if (0 == --d_numPendingFiles) {
+                d_drainCondition.broadcast();
+            }
+        }
+    }
+}
+
+// CREATORS
+LogFileCompressor::LogFileCompressor(bslma::Allocator *basicAllocator)
+: d_fileNames(basicAllocator)
+, d_onCompressionCb(bsl::allocator_arg, basicAllocator)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_isThreadRunning(false)
+, d_isStopping(false)
+, d_numPendingFiles(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+LogFileCompressor::~LogFileCompressor()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_numPendingFiles -= static_cast<int>(d_fileNames.size());
+        d_fileNames.clear();
+        d_isStopping = true;
+    }
+    d_queueCondition.broadcast();
+
+    if (d_isThreadRunning) {
+        bslmt::ThreadUtil::join(d_threadHandle);
+    }
+}
+
+// MANIPULATORS
+int LogFileCompressor::compressFile(const bsl::string& fileName)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (!d_isThreadRunning) {
+            bslmt::ThreadAttributes attributes;
+
+            attributes.setInheritSchedule(false);
+            attributes.setSchedulingPolicy(
+                                     bslmt::ThreadAttributes::e_SCHED_OTHER);
+            attributes.setSchedulingPriority(
+                                bslmt::ThreadUtil::getMinSchedulingPriority(
+                                     bslmt::ThreadAttributes::e_SCHED_OTHER));
+            attributes.setThreadName("ball.compress");
+
+            bsl::function<void()> entryPoint(
+                   bsl::allocator_arg,
+                   d_allocator_p,
+                   bdlf::MemFnUtil::memFn(&LogFileCompressor::threadEntryPoint,
+                                          this));
+
+            // Fall back to the default attributes if the thread cannot be
+            // created with the lowest priority.
+
+            if (0 != bslmt::ThreadUtil::create(&d_threadHandle,
+                                               attributes,
+                                               entryPoint)
+             && 0 != bslmt::ThreadUtil::create(&d_threadHandle,
+                                               entryPoint)) {
+                return -1;                                            // RETURN
+            }
+
+            d_isThreadRunning = true;
+        }
+
+        d_fileNames.push_back(fileName);
+        ++d_numPendingFiles;
+    }
+    d_queueCondition.signal();
+
+    return 0;
+}
+
+void LogFileCompressor::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (0 < d_numPendingFiles) {
+        d_drainCondition.wait(&d_mutex);
+    }
+}
+
+void LogFileCompressor::setOnCompressionCallback(
+                                         const OnCompressionCallback& callback)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_onCompressionCb = callback;
+}
+
+// ACCESSORS
+int LogFileCompressor::numPendingFiles() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numPendingFiles;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
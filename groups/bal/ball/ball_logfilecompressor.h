@@ -0,0 +1,241 @@
+// ball_logfilecompressor.h                                           -*-C++-*-
+#ifndef INCLUDED_BALL_LOGFILECOMPRESSOR
+#define INCLUDED_BALL_LOGFILECOMPRESSOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mechanism compressing log files on a background thread.
+//
+//@CLASSES:
+//  ball::LogFileCompressor: compresses log files in the gzip format
+//
+//@SEE_ALSO: ball_fileobserver2, ball_logfilecleanerutil, bdlde_gziputil
+//
+//@DESCRIPTION: This component provides a mechanism,
+// 'ball::LogFileCompressor', that compresses files (typically, log files that
+// were rotated by a 'ball::FileObserver2') in the gzip format, on a background
+// thread of low priority, so that the thread requesting the compression (e.g.,
+// a logging thread) never waits for the compression to complete.
+//
+// Calling 'compressFile' with the name of a file, 'F', adds 'F' to a queue of
+// files to compress, and returns immediately.  The background thread, created
+// by the first call to 'compressFile', compresses each file of the queue in
+// turn: 'F' is compressed (using 'bdlde::GzipUtil') into a file named 'F.gz'
+// (replacing any such existing file), and 'F' is then removed.  If the
+// compression fails, the partially written 'F.gz' is removed instead, and 'F'
+// is left unmodified.  Once a file is processed, the callback supplied to
+// 'setOnCompressionCallback', if any, is invoked on the background thread
+// with the status of the compression, the name of the file, and the name of
+// the compressed file.
+//
+// The background thread is created with the lowest scheduling priority of the
+// default scheduling policy (which, on some platforms, is the same as the
+// default priority), and, if it cannot be created with that priority, with
+// the default thread attributes.
+//
+// Note that, the name of a compressed file starting with the name of the
+// original file, the compressed log files are removed by
+// 'ball::LogFileCleanerUtil' according to the same file name pattern as the
+// log files themselves.
+//
+///Thread Safety
+///-------------
+// All methods of 'ball::LogFileCompressor' are thread-safe, and can be called
+// concurrently by multiple threads, except that the destructor must not be
+// invoked concurrently with any other method.  The callback supplied to
+// 'setOnCompressionCallback' must not invoke the destructor of the compressor.
+//
+///Destruction
+///-----------
+// The destructor of a 'ball::LogFileCompressor' waits for the compression of
+// the file being compressed, if any, to complete, but discards the files that
+// are queued and not yet being compressed: these files are left uncompressed.
+// Call 'drain' before destroying the compressor to compress all of the queued
+// files.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a Rotated Log File
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose a log file, "/var/log/myapp.log.20260101_000000", was just rotated
+// and closed, and we want it compressed without delaying the application.
+//
+// First, we create a compressor, and set a callback to be notified of the
+// outcome of the compression:
+//..
+//  void onCompression(int                status,
+//                     const bsl::string& fileName,
+//                     const bsl::string& compressedFileName)
+//      // Report the outcome of the compression of the specified 'fileName'
+//      // into the specified 'compressedFileName', indicated by the specified
+//      // 'status'.
+//  {
+//      if (0 != status) {
+//          bsl::cerr << "Failed to compress " << fileName << bsl::endl;
+//      }
+//      else {
+//          bsl::cout << "Compressed " << compressedFileName << bsl::endl;
+//      }
+//  }
+//
+//  ball::LogFileCompressor compressor;
+//  compressor.setOnCompressionCallback(&onCompression);
+//..
+// Then, we schedule the compression of the file, which is performed on the
+// background thread of the compressor:
+//..
+//  int rc = compressor.compressFile("/var/log/myapp.log.20260101_000000");
+//  assert(0 == rc);
+//..
+// Finally, before the compressor is destroyed, we wait for the compression to
+// complete, after which "/var/log/myapp.log.20260101_000000.gz" exists, and
+// the original file is removed (if the compression succeeded):
+//..
+//  compressor.drain();
+//  assert(0 == compressor.numPendingFiles());
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_string.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                          // =======================
+                          // class LogFileCompressor
+                          // =======================
+
+class LogFileCompressor {
+    // This class provides a mechanism compressing files in the gzip format on
+    // a background thread.
+
+  public:
+    // TYPES
+    typedef bsl::function<void(int, const bsl::string&, const bsl::string&)>
+                                                         OnCompressionCallback;
+        // 'OnCompressionCallback' is an alias for a callback invoked once a
+        // file is processed, with the status of the compression (0 on
+        // success), the name of the file, and the name of the compressed
+        // file.
+
+  private:
+    // DATA
+    bsl::deque<bsl::string>   d_fileNames;       // files to compress
+
+    OnCompressionCallback     d_onCompressionCb; // callback invoked once a
+                                                 // file is processed
+
+    bslmt::ThreadUtil::Handle d_threadHandle;    // background thread
+
+    bool                      d_isThreadRunning; // 'true' if the thread was
+                                                 // created
+
+    bool                      d_isStopping;      // 'true' if the thread must
+                                                 // exit
+
+    int                       d_numPendingFiles; // files queued, or being
+                                                 // compressed
+
+    mutable bslmt::Mutex      d_mutex;           // guard the members above
+
+    bslmt::Condition          d_queueCondition;  // signaled when a file is
+                                                 // queued, or on stop
+
+    bslmt::Condition          d_drainCondition;  // signaled when no file is
+                                                 // pending
+
+    bslma::Allocator         *d_allocator_p;     // memory allocator (held,
+                                                 // not owned)
+
+    // NOT IMPLEMENTED
+    LogFileCompressor(const LogFileCompressor&);
+    LogFileCompressor& operator=(const LogFileCompressor&);
+
+    // PRIVATE CLASS METHODS
+    static int compressImp(const bsl::string&  fileName,
+                           const bsl::string&  compressedFileName,
+                           bslma::Allocator   *allocator);
+        // Compress the file having the specified 'fileName' into a file
+        // having the specified 'compressedFileName', and remove the file named
+        // 'fileName' on success, using the specified 'allocator' to supply
+        // temporary memory.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    // PRIVATE MANIPULATORS
+    void threadEntryPoint();
+        // Compress the queued files until 'd_isStopping' is set.  Note that
+        // this function is the entry point of the background thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LogFileCompressor,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit LogFileCompressor(bslma::Allocator *basicAllocator = 0);
+        // Create a compressor having no queued file and no callback.  The
+        // background thread is not created until a file is queued.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~LogFileCompressor();
+        // Discard the queued files not yet being compressed, wait for the
+        // compression of the file being compressed, if any, to complete, and
+        // destroy this object.
+
+    // MANIPULATORS
+    int compressFile(const bsl::string& fileName);
+        // Queue the file having the specified 'fileName' for compression into
+        // a file named 'fileName' followed by ".gz", on the background thread,
+        // creating that thread if it does not exist.  Return 0 on success, and
+        // a non-zero value (with no effect) if the background thread cannot
+        // be created.
+
+    void drain();
+        // Block until all of the queued files are processed.
+
+    void setOnCompressionCallback(const OnCompressionCallback& callback);
+        // Set the specified 'callback' to be invoked, on the background
+        // thread, once each file is processed.
+
+    // ACCESSORS
+    int numPendingFiles() const;
+        // Return the number of files that are queued or being compressed.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,758 @@
+// ball_logfilecompressor.t.cpp                                       -*-C++-*-
+#include <ball_logfilecompressor.h>
+
+#include <bdlde_crc32.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_platform.h>
+#include <bsls_review.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_cstdlib.h>     // atoi(), getenv()
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism compressing files on a background
+// thread.  The content of the compressed files is verified by
+// 'bdlde_gziputil'; here, we verify the files created and removed, the gzip
+// header and trailer of the compressed files, and the interaction with the
+// background thread.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] LogFileCompressor(bslma::Allocator *basicAllocator = 0);
+// [ 3] ~LogFileCompressor();
+//
+// MANIPULATORS
+// [ 2] int compressFile(const bsl::string& fileName);
+// [ 2] void drain();
+// [ 2] void setOnCompressionCallback(const OnCompressionCallback& callback);
+//
+// ACCESSORS
+// [ 2] int numPendingFiles() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::LogFileCompressor Obj;
+typedef bdls::FilesystemUtil    FsUtil;
+
+//=============================================================================
+//                       HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+                         // ========================
+                         // class TempDirectoryGuard
+                         // ========================
+
+class TempDirectoryGuard {
+    // This class implements a scoped temporary directory guard.  The guard
+    // tries to create a temporary directory in the system-wide temp directory
+    // and falls back to the current directory.
+
+    // DATA
+    bsl::string d_dirName;  // path to the created directory
+
+  private:
+    // NOT IMPLEMENTED
+    TempDirectoryGuard(const TempDirectoryGuard&);
+    TempDirectoryGuard& operator=(const TempDirectoryGuard&);
+
+  public:
+    // CREATORS
+    TempDirectoryGuard()
+        // Create temporary directory in the system-wide temp or current
+        // directory.
+    {
+        bsl::string tmpPath;
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        char tmpPathBuf[MAX_PATH];
+        GetTempPath(MAX_PATH, tmpPathBuf);
+        tmpPath.assign(tmpPathBuf);
+#else
+        const char *envTmpPath = bsl::getenv("TMPDIR");
+        if (envTmpPath) {
+            tmpPath.assign(envTmpPath);
+        }
+#endif
+
+        int res = bdls::PathUtil::appendIfValid(&tmpPath, "ball_");
+        ASSERTV(tmpPath, 0 == res);
+
+        res = FsUtil::createTemporaryDirectory(&d_dirName, tmpPath);
+        ASSERTV(tmpPath, 0 == res);
+    }
+
+    ~TempDirectoryGuard()
+        // Destroy this object and remove the temporary directory (recursively)
+        // created at construction.
+    {
+        FsUtil::remove(d_dirName, true);
+    }
+
+    // ACCESSORS
+    bsl::string path(const char *name) const
+        // Return the path of the file having the specified 'name' in the
+        // temporary directory.
+    {
+        bsl::string result(d_dirName);
+
+        int res = bdls::PathUtil::appendIfValid(&result, name);
+        ASSERTV(result, 0 == res);
+
+        return result;
+    }
+};
+
+                         // =====================
+                         // class CompressionLog
+                         // =====================
+
+class CompressionLog {
+    // This class records the invocations of a compression callback, and can
+    // optionally block the callback until released.
+
+    // DATA
+    bsl::vector<int>         d_statuses;          // status of each call
+    bsl::vector<bsl::string> d_fileNames;         // file name of each call
+    bsl::vector<bsl::string> d_compressedNames;   // compressed file names
+    bool                     d_isBlocking;        // 'true' if the callback
+                                                  // blocks
+    bslmt::Semaphore         d_enteredSemaphore;  // posted on each call
+    bslmt::Semaphore         d_releaseSemaphore;  // releases a blocked call
+    mutable bslmt::Mutex     d_mutex;             // guard the vectors
+
+  private:
+    // NOT IMPLEMENTED
+    CompressionLog(const CompressionLog&);
+    CompressionLog& operator=(const CompressionLog&);
+
+  public:
+    // CREATORS
+    explicit CompressionLog(bool isBlocking = false)
+        // Create an empty log.  Optionally specify 'isBlocking' to make each
+        // invocation of the callback block until 'release' is called.
+    : d_isBlocking(isBlocking)
+    {
+    }
+
+    // MANIPULATORS
+    void onCompression(int                status,
+                       const bsl::string& fileName,
+                       const bsl::string& compressedFileName)
+        // Record the specified 'status', 'fileName', and
+        // 'compressedFileName'.
+    {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_statuses.push_back(status);
+            d_fileNames.push_back(fileName);
+            d_compressedNames.push_back(compressedFileName);
+        }
+
+        d_enteredSemaphore.post();
+
+        if (d_isBlocking) {
+            d_releaseSemaphore.wait();
+        }
+    }
+
+    void release()
+        // Release one blocked invocation of the callback.
+    {
+        d_releaseSemaphore.post();
+    }
+
+    void waitForCall()
+        // Block until the callback is invoked.
+    {
+        d_enteredSemaphore.wait();
+    }
+
+    // ACCESSORS
+    bsl::string compressedFileName(int index) const
+        // Return the compressed file name of the call having the specified
+        // 'index'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_compressedNames[index];
+    }
+
+    bsl::string fileName(int index) const
+        // Return the file name of the call having the specified 'index'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_fileNames[index];
+    }
+
+    int numCalls() const
+        // Return the number of calls recorded.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return static_cast<int>(d_statuses.size());
+    }
+
+    int status(int index) const
+        // Return the status of the call having the specified 'index'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_statuses[index];
+    }
+};
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+void writeFile(const bsl::string& fileName, int numLines)
+    // Create the file having the specified 'fileName', holding the specified
+    // 'numLines' lines of text.
+{
+    bsl::ofstream os(fileName.c_str());
+
+    for (int i = 0; i < numLines; ++i) {
+        os << "16OCT2026_12:00:00.000 4242:1 INFO file.cpp:" << i
+           << " CATEGORY message number " << i << '\n';
+    }
+    ASSERTV(fileName, os);
+}
+
+void releaseAfterDelay(CompressionLog *log)
+    // Release one blocked invocation of the callback of the specified 'log'
+    // after a delay of 200 milliseconds.
+{
+    bslmt::ThreadUtil::microSleep(200 * 1000);
+    log->release();
+}
+
+bool readFile(bsl::string *result, const bsl::string& fileName)
+    // Load the content of the file having the specified 'fileName' into the
+    // specified 'result'.  Return 'true' on success, and 'false' otherwise.
+{
+    bsl::ifstream is(fileName.c_str(), bsl::ios_base::binary);
+
+    if (!is) {
+        return false;                                                 // RETURN
+    }
+
+    result->assign(bsl::istreambuf_iterator<char>(is),
+                   bsl::istreambuf_iterator<char>());
+    return true;
+}
+
+unsigned int readUint32(const bsl::string& data, bsl::size_t offset)
+    // Return the 32-bit value stored, least-significant byte first, at the
+    // specified 'offset' in the specified 'data'.
+{
+    unsigned int result = 0;
+
+    for (int i = 3; 0 <= i; --i) {
+        result = (result << 8)
+               | static_cast<unsigned char>(data[offset + i]);
+    }
+    return result;
+}
+
+bool isGzipOf(const bsl::string& compressed, const bsl::string& original)
+    // Return 'true' if the specified 'compressed' data has a gzip header, and
+    // a trailer holding the CRC-32 checksum and the size of the specified
+    // 'original' data, and 'false' otherwise.
+{
+    const bsl::size_t size = compressed.size();
+
+    if (size < 18
+     || '\x1f' != compressed[0]
+     || '\x8b' != compressed[1]
+     || '\x08' != compressed[2]) {
+        return false;                                                 // RETURN
+    }
+
+    const bdlde::Crc32 crc(original.data(), original.size());
+
+    return readUint32(compressed, size - 8) == crc.checksum()
+        && readUint32(compressed, size - 4) == original.size();
+}
+
+//=============================================================================
+//                                USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a Rotated Log File
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose a log file, "/var/log/myapp.log.20260101_000000", was just rotated
+// and closed, and we want it compressed without delaying the application.
+//
+// First, we create a compressor, and set a callback to be notified of the
+// outcome of the compression:
+//..
+    void onCompression(int                status,
+                       const bsl::string& fileName,
+                       const bsl::string& compressedFileName)
+        // Report the outcome of the compression of the specified 'fileName'
+        // into the specified 'compressedFileName', indicated by the specified
+        // 'status'.
+    {
+        if (0 != status) {
+            bsl::cerr << "Failed to compress " << fileName << bsl::endl;
+        }
+        else {
+            bsl::cout << "Compressed " << compressedFileName << bsl::endl;
+        }
+    }
+//..
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT',
+        //:   using a file of a temporary directory.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                             "\n=============" << endl;
+
+        TempDirectoryGuard tempDir;
+
+        const bsl::string fileName = tempDir.path("myapp.log.20260101_000000");
+        writeFile(fileName, 100);
+
+        ball::LogFileCompressor compressor;
+        compressor.setOnCompressionCallback(&onCompression);
+//..
+// Then, we schedule the compression of the file, which is performed on the
+// background thread of the compressor:
+//..
+        int rc = compressor.compressFile(fileName);
+        ASSERT(0 == rc);
+//..
+// Finally, before the compressor is destroyed, we wait for the compression to
+// complete, after which "/var/log/myapp.log.20260101_000000.gz" exists, and
+// the original file is removed (if the compression succeeded):
+//..
+        compressor.drain();
+        ASSERT(0 == compressor.numPendingFiles());
+//..
+
+        ASSERT(!FsUtil::exists(fileName));
+        ASSERT( FsUtil::exists(fileName + ".gz"));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 The destructor waits for the compression of the file being
+        //:   compressed, and for the invocation of the callback.
+        //:
+        //: 2 The destructor discards the queued files not yet being
+        //:   compressed, leaving them uncompressed.
+        //:
+        //: 3 Destroying a compressor having never queued a file creates no
+        //:   thread, and has no effect.
+        //
+        // Plan:
+        //: 1 Set a callback that blocks until released.  Queue a file, wait
+        //:   for the callback to be invoked, and queue more files.  Destroy
+        //:   the compressor, while another thread releases the callback after
+        //:   a delay.  Verify that the first file is compressed, and that the
+        //:   others are left unmodified.  (C-1..2)
+        //:
+        //: 2 Create and destroy a compressor.  (C-3)
+        //
+        // Testing:
+        //   ~LogFileCompressor();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING DESTRUCTOR"
+                             "\n==================" << endl;
+
+        TempDirectoryGuard tempDir;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const bsl::string name0 = tempDir.path("file0");
+        const bsl::string name1 = tempDir.path("file1");
+        const bsl::string name2 = tempDir.path("file2");
+
+        writeFile(name0, 1000);
+        writeFile(name1, 1000);
+        writeFile(name2, 1000);
+
+        CompressionLog            log(true);
+        bslmt::ThreadUtil::Handle releaser;
+        {
+            Obj mX(&oa);
+
+            mX.setOnCompressionCallback(
+                      bdlf::BindUtil::bind(&CompressionLog::onCompression,
+                                           &log,
+                                           bdlf::PlaceHolders::_1,
+                                           bdlf::PlaceHolders::_2,
+                                           bdlf::PlaceHolders::_3));
+
+            ASSERT(0 == mX.compressFile(name0));
+
+            log.waitForCall();
+
+            ASSERT(0 == mX.compressFile(name1));
+            ASSERT(0 == mX.compressFile(name2));
+
+            ASSERT(3 == mX.numPendingFiles());
+
+            // Release the callback after a delay, while the destructor is
+            // waiting for the background thread.
+
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                            &releaser,
+                            bdlf::BindUtil::bind(&releaseAfterDelay, &log)));
+        }
+        bslmt::ThreadUtil::join(releaser);
+
+        ASSERTV(log.numCalls(), 1 == log.numCalls());
+        ASSERT(0 == log.status(0));
+        ASSERT(!FsUtil::exists(name0));
+        ASSERT( FsUtil::exists(name0 + ".gz"));
+        ASSERT( FsUtil::exists(name1));
+        ASSERT(!FsUtil::exists(name1 + ".gz"));
+        ASSERT( FsUtil::exists(name2));
+        ASSERT(!FsUtil::exists(name2 + ".gz"));
+
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tNo file queued." << endl;
+        {
+            Obj mX(&oa);
+
+            ASSERT(0 == mX.numPendingFiles());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'compressFile'
+        //
+        // Concerns:
+        //: 1 Each queued file, 'F', is compressed into 'F.gz', in the gzip
+        //:   format, and 'F' is removed.
+        //:
+        //: 2 An existing 'F.gz' is replaced.
+        //:
+        //: 3 If 'F' cannot be read, or 'F.gz' cannot be created, the status
+        //:   supplied to the callback is non-zero, 'F' is left unmodified, and
+        //:   no 'F.gz' is left behind.
+        //:
+        //: 4 The callback is invoked once per file, in the order the files
+        //:   are queued, with the name of 'F' and 'F.gz'.
+        //:
+        //: 5 'drain' waits for all of the queued files to be processed, and
+        //:   'numPendingFiles' reports the number of files queued or being
+        //:   compressed.
+        //:
+        //: 6 Files are compressed without a callback.
+        //:
+        //: 7 All memory is supplied by the object allocator.
+        //
+        // Plan:
+        //: 1 Queue a set of files, including a missing file, a file whose
+        //:   compressed file name is a directory, and a file whose compressed
+        //:   file already exists.  Drain the compressor, and verify the files,
+        //:   the callback invocations, and the allocators.  (C-1..7)
+        //
+        // Testing:
+        //   LogFileCompressor(bslma::Allocator *basicAllocator = 0);
+        //   int compressFile(const bsl::string& fileName);
+        //   void drain();
+        //   void setOnCompressionCallback(const OnCompressionCallback&);
+        //   int numPendingFiles() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'compressFile'"
+                             "\n======================" << endl;
+
+        TempDirectoryGuard tempDir;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        const bsl::string plain    = tempDir.path("plain");
+        const bsl::string missing  = tempDir.path("missing");
+        const bsl::string blocked  = tempDir.path("blocked");
+        const bsl::string replaced = tempDir.path("replaced");
+        const bsl::string silent   = tempDir.path("silent");
+
+        writeFile(plain,    10000);
+        writeFile(blocked,  10);
+        writeFile(replaced, 10);
+        writeFile(replaced + ".gz", 10);
+        writeFile(silent,   10);
+
+        ASSERT(0 == FsUtil::createDirectories(blocked + ".gz", true));
+
+        bsl::string plainContent;
+        bsl::string replacedContent;
+        bsl::string silentContent;
+
+        ASSERT(readFile(&plainContent,    plain));
+        ASSERT(readFile(&replacedContent, replaced));
+        ASSERT(readFile(&silentContent,   silent));
+
+        CompressionLog log;
+        {
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == X.numPendingFiles());
+
+            mX.setOnCompressionCallback(
+                      bdlf::BindUtil::bind(&CompressionLog::onCompression,
+                                           &log,
+                                           bdlf::PlaceHolders::_1,
+                                           bdlf::PlaceHolders::_2,
+                                           bdlf::PlaceHolders::_3));
+
+            ASSERT(0 == mX.compressFile(plain));
+            ASSERT(0 == mX.compressFile(missing));
+            ASSERT(0 == mX.compressFile(blocked));
+            ASSERT(0 == mX.compressFile(replaced));
+
+            ASSERT(0 < X.numPendingFiles());
+
+            mX.drain();
+
+            ASSERT(0 == X.numPendingFiles());
+            ASSERTV(log.numCalls(), 4 == log.numCalls());
+
+            mX.setOnCompressionCallback(Obj::OnCompressionCallback());
+
+            ASSERT(0 == mX.compressFile(silent));
+
+            mX.drain();
+
+            ASSERTV(log.numCalls(), 4 == log.numCalls());
+
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        const bsl::string NAMES[] = { plain, missing, blocked, replaced };
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERTV(i, NAMES[i]         == log.fileName(i));
+            ASSERTV(i, NAMES[i] + ".gz" == log.compressedFileName(i));
+
+            if (veryVerbose) { T_ P_(i) P(log.status(i)) }
+        }
+
+        ASSERT(0 == log.status(0));
+        ASSERT(0 != log.status(1));
+        ASSERT(0 != log.status(2));
+        ASSERT(0 == log.status(3));
+
+        bsl::string compressed;
+
+        ASSERT(!FsUtil::exists(plain));
+        ASSERT(readFile(&compressed, plain + ".gz"));
+        ASSERT(isGzipOf(compressed, plainContent));
+        ASSERTV(compressed.size(), plainContent.size(),
+                compressed.size() < plainContent.size() / 4);
+
+        ASSERT(!FsUtil::exists(missing));
+        ASSERT(!FsUtil::exists(missing + ".gz"));
+
+        ASSERT(FsUtil::exists(blocked));
+        ASSERT(FsUtil::isDirectory(blocked + ".gz"));
+
+        ASSERT(!FsUtil::exists(replaced));
+        ASSERT(readFile(&compressed, replaced + ".gz"));
+        ASSERT(isGzipOf(compressed, replacedContent));
+
+        ASSERT(!FsUtil::exists(silent));
+        ASSERT(readFile(&compressed, silent + ".gz"));
+        ASSERT(isGzipOf(compressed, silentContent));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compress a file, and verify that it is replaced by a compressed
+        //:   file.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                             "\n==============" << endl;
+
+        TempDirectoryGuard tempDir;
+
+        const bsl::string fileName = tempDir.path("test.log");
+        writeFile(fileName, 100);
+
+        bsl::string content;
+        ASSERT(readFile(&content, fileName));
+
+        {
+            Obj mX;
+
+            ASSERT(0 == mX.compressFile(fileName));
+
+            mX.drain();
+        }
+
+        bsl::string compressed;
+        ASSERT(!FsUtil::exists(fileName));
+        ASSERT(readFile(&compressed, fileName + ".gz"));
+        ASSERT(isGzipOf(compressed, content));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
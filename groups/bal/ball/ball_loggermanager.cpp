@@ -9,6 +9,7 @@ BSLS_IDENT_RCSID(ball_loggermanager_cpp,"$Id$ $CSID$")
 #include <ball_fixedsizerecordbuffer.h>
 #include <ball_loggermanagerdefaults.h>
 #include <ball_recordattributes.h>
+#include <ball_ringrecordbuffer.h>
 #include <ball_severity.h>
 #include <ball_streamobserver.h>           // for testing only
 #include <ball_testobserver.h>             // for testing only
@@ -338,13 +339,23 @@ void Logger::logMessage(const Category&            category,
         d_populator(&record->customFields());
     }
 
-    bsl::shared_ptr<Record> handle(record, &d_recordPool, d_allocator_p);
+    // A handle to 'record' is created only if it is published or stored in a
+    // record buffer that does not accept a copy of it (see 'pushBackCopy'),
+    // so that recording a record in a buffer that does accept a copy does not
+    // allocate memory.
 
-    if (levels.recordLevel() >= severity) {
+    bsl::shared_ptr<Record> handle;
+
+    if (levels.recordLevel() >= severity
+     && 0 != d_recordBuffer_p->pushBackCopy(*record)) {
+        handle.reset(record, &d_recordPool, d_allocator_p);
         d_recordBuffer_p->pushBack(handle);
     }
 
     if (levels.passLevel() >= severity) {
+        if (!handle) {
+            handle.reset(record, &d_recordPool, d_allocator_p);
+        }
 
         // Publish this record.
 
@@ -424,6 +435,10 @@ void Logger::logMessage(const Category&            category,
             d_publishAll(Transmission::e_TRIGGER_ALL);
         }
     }
+
+    if (!handle) {
+        d_recordPool.deleteObject(record);
+    }
 }
 
 void Logger::publish(Transmission::Cause cause)
@@ -638,9 +653,17 @@ void LoggerManager::constructObject(
       bdlf::MemFnUtil::memFn(&LoggerManager::publishAllImp, this));
 
     int recordBufferSize = configuration.defaults().defaultRecordBufferSize();
-    d_recordBuffer_p     = new(*d_allocator_p) FixedSizeRecordBuffer(
+    if (LoggerManagerConfiguration::e_RING_RECORD_BUFFER ==
+                                           configuration.recordBufferType()) {
+        d_recordBuffer_p = new(*d_allocator_p) RingRecordBuffer(
                                                               recordBufferSize,
                                                               d_allocator_p);
+    }
+    else {
+        d_recordBuffer_p = new(*d_allocator_p) FixedSizeRecordBuffer(
+                                                              recordBufferSize,
+                                                              d_allocator_p);
+    }
 
     d_logger_p = new(*d_allocator_p) Logger(d_observer,
                                             d_recordBuffer_p,
@@ -1426,10 +1449,7 @@ bool LoggerManager::isCategoryEnabled(const Category *category,
 {
     if (category->relevantRuleMask()) {
         AttributeContext *context = AttributeContext::getContext();
-        ThresholdAggregate levels;
-        context->determineThresholdLevels(&levels, category);
-        int threshold = ThresholdAggregate::maxLevel(levels);
-        return threshold >= severity;                                 // RETURN
+        return context->isCategoryEnabled(category, severity);        // RETURN
     }
     return category->maxLevel() >= severity;
 }
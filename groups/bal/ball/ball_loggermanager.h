@@ -69,11 +69,15 @@ BSLS_IDENT("$Id: $")
 // details), whereby continuous logging (without publication of logged records)
 // can result in older records being overwritten by newer ones.  A circular
 // buffer provides an efficient "trace-back" strategy, wherein only log records
-// proximate to a user-specified logging event (see below) are published.  Such
-// a circular buffer may not be appropriate for all situations; the user can
-// change the behavior of the default logger by adjusting the logging threshold
-// levels (see below) or can install a logger that uses a different kind of
-// record buffer.
+// proximate to a user-specified logging event (see below) are published.  If
+// the 'recordBufferType' attribute of the 'ball::LoggerManagerConfiguration'
+// is 'e_RING_RECORD_BUFFER', the default record buffer stores copies of the
+// records in a 'ball::RingRecordBuffer', so that storing a record that is not
+// also published neither allocates memory nor acquires a lock (see
+// 'ball_ringrecordbuffer').  Such a circular buffer may not be appropriate for
+// all situations; the user can change the behavior of the default logger by
+// adjusting the logging threshold levels (see below) or can install a logger
+// that uses a different kind of record buffer.
 //
 ///Logger Manager Singleton Initialization
 ///---------------------------------------
@@ -212,6 +212,7 @@ using namespace bdlf::PlaceHolders;
 // [40] USAGE EXAMPLE #3
 // [41] USAGE EXAMPLE #4
 // [37] CONCERN: RECORD POOL MEMORY CONSUMPTION
+// [44] CONCERN: RECORD OWNERSHIP WITH A RING RECORD BUFFER
 // [19] CONCERN: PERFORMANCE IMPLICATIONS
 // [12] CONCERN: USER FIELDS POPULATOR CALLBACK
 // [11] CONCERN: INTERNAL BROADCAST OBSERVER
@@ -1752,6 +1753,72 @@ void testUserFieldsPopulatorCb(ball::UserFields *list)
 
 }  // close unnamed namespace
 
+// ============================================================================
+//                         CASE 44 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace BALL_LOGGERMANAGER_TEST_CASE_44 {
+
+class RecordingObserver : public ball::Observer {
+    // This concrete implementation of 'ball::Observer' keeps the message and
+    // the transmission cause of each record published to it, in the order of
+    // publication.
+
+    // PRIVATE TYPES
+    typedef ball::Transmission::Cause Cause;
+
+    // DATA
+    bsl::vector<bsl::string> d_messages;  // published messages
+    bsl::vector<Cause>       d_causes;    // published transmission causes
+
+  public:
+    // CREATORS
+    explicit
+    RecordingObserver(bslma::Allocator *basicAllocator = 0)
+    : d_messages(basicAllocator)
+    , d_causes(basicAllocator)
+        // Create an observer to which no record has been published.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    void publish(const ball::Record& record, const ball::Context& context)
+        // Append the message of the specified 'record' and the transmission
+        // cause of the specified 'context' to those kept by this observer.
+    {
+        d_messages.push_back(record.fixedFields().messageRef());
+        d_causes.push_back(context.transmissionCause());
+    }
+
+    // ACCESSORS
+    ball::Transmission::Cause cause(int index) const
+        // Return the transmission cause of the record at the specified
+        // 'index' in the order of publication.
+    {
+        return d_causes[index];
+    }
+
+    const bsl::string& message(int index) const
+        // Return a reference to the non-modifiable message of the record at
+        // the specified 'index' in the order of publication.
+    {
+        return d_messages[index];
+    }
+
+    int numPublishedRecords() const
+        // Return the number of records published to this observer.
+    {
+        return static_cast<int>(d_messages.size());
+    }
+};
+
+}  // close namespace BALL_LOGGERMANAGER_TEST_CASE_44
+
 // ============================================================================
 //                              MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1767,6 +1834,181 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 44: {
+        // --------------------------------------------------------------------
+        // TESTING 'logMessage' WITH A RING RECORD BUFFER
+        //
+        // Concerns:
+        //: 1 A record that is only recorded is copied into the ring record
+        //:   buffer, and is published, with the 'e_TRIGGER' cause, only when
+        //:   a trigger occurs.
+        //:
+        //: 2 A record that is only passed is published once, with the
+        //:   'e_PASSTHROUGH' cause, and is not recorded.
+        //:
+        //: 3 A record that is both recorded and passed is published once
+        //:   when logged and once more when a trigger occurs.
+        //:
+        //: 4 A trigger publishes the recorded records, including the
+        //:   triggering record, in the order in which they were logged, and
+        //:   empties the record buffer.
+        //:
+        //: 5 Every record obtained from the record pool is returned to it
+        //:   after 'logMessage' returns, whether or not a handle to the record
+        //:   was created.
+        //:
+        //: 6 Recording a record in the ring record buffer, after the record
+        //:   pool holds a free record, allocates no memory.
+        //:
+        //: 7 All memory supplied by the allocator of the logger manager is
+        //:   returned to it when the logger manager is destroyed.
+        //
+        // Plan:
+        //: 1 Create a logger manager using a test allocator and a
+        //:   configuration specifying a ring record buffer, FIFO log order,
+        //:   and no trigger markers, and register an observer that keeps the
+        //:   message and transmission cause of each published record.
+        //:
+        //: 2 Add four categories whose threshold levels cause a record of
+        //:   severity 'e_INFO' to be recorded only, passed only, both
+        //:   recorded and passed, and recorded then trigger publication,
+        //:   respectively.
+        //:
+        //: 3 Log records in each category, verifying the records published
+        //:   after each call, that 'numRecordsInUse' is 0, and that recording
+        //:   a record allocates no memory.  (C-1..6)
+        //:
+        //: 4 Destroy the logger manager, and verify that the test allocator
+        //:   has no blocks in use.  (C-7)
+        //
+        // Testing:
+        //   CONCERN: RECORD OWNERSHIP WITH A RING RECORD BUFFER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'logMessage' WITH A RING RECORD BUFFER"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        using namespace BALL_LOGGERMANAGER_TEST_CASE_44;
+
+        typedef ball::LoggerManagerConfiguration Config;
+        typedef ball::Transmission               Tr;
+
+        bslma::TestAllocator oa("object",   veryVeryVerbose);
+        bslma::TestAllocator sa("observer", veryVeryVerbose);
+
+        bsl::shared_ptr<RecordingObserver> observer(
+                                               new (sa) RecordingObserver(&sa),
+                                               &sa);
+        const RecordingObserver& O = *observer;
+
+        {
+            Config mLMC;
+            mLMC.setRecordBufferType(Config::e_RING_RECORD_BUFFER);
+            mLMC.setLogOrder(Config::e_FIFO);
+            mLMC.setTriggerMarkers(Config::e_NO_MARKERS);
+
+            bslma::ManagedPtr<Obj> mp;
+            Obj::createLoggerManager(&mp, mLMC, &oa);
+
+            Obj& mX = *mp;
+            ASSERT(0 == mX.registerObserver(observer, "recording"));
+
+            const int INFO  = ball::Severity::e_INFO;
+            const int TRACE = ball::Severity::e_TRACE;
+
+            const Cat *RECORDED  = mX.setCategory("Recorded", TRACE, 0, 0, 0);
+            const Cat *PASSED    = mX.setCategory("Passed",   0, TRACE, 0, 0);
+            const Cat *BOTH      = mX.setCategory("Both", TRACE, TRACE, 0, 0);
+            const Cat *TRIGGERED = mX.setCategory("Triggered",
+                                                  TRACE,
+                                                  0,
+                                                  TRACE,
+                                                  0);
+
+            ASSERT(RECORDED);  ASSERT(PASSED);  ASSERT(BOTH);
+            ASSERT(TRIGGERED);
+
+            ball::Logger& logger = mX.getLogger();
+
+            if (veryVerbose) cout << "\tRecorded only." << endl;
+
+            logger.logMessage(*RECORDED, INFO, "F", 1, "R1");
+            ASSERTV(O.numPublishedRecords(), 0 == O.numPublishedRecords());
+            ASSERTV(logger.numRecordsInUse(), 0 == logger.numRecordsInUse());
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            logger.logMessage(*RECORDED, INFO, "F", 2, "R2");
+            ASSERTV(O.numPublishedRecords(), 0 == O.numPublishedRecords());
+            ASSERTV(logger.numRecordsInUse(), 0 == logger.numRecordsInUse());
+            ASSERTV(NUM_ALLOCATIONS,   oa.numAllocations(),
+                    NUM_ALLOCATIONS == oa.numAllocations());
+
+            if (veryVerbose) cout << "\tPassed only." << endl;
+
+            logger.logMessage(*PASSED, INFO, "F", 3, "P1");
+            ASSERTV(O.numPublishedRecords(), 1 == O.numPublishedRecords());
+            ASSERTV(logger.numRecordsInUse(), 0 == logger.numRecordsInUse());
+
+            if (veryVerbose) cout << "\tRecorded and passed." << endl;
+
+            logger.logMessage(*BOTH, INFO, "F", 4, "B1");
+            ASSERTV(O.numPublishedRecords(), 2 == O.numPublishedRecords());
+            ASSERTV(logger.numRecordsInUse(), 0 == logger.numRecordsInUse());
+
+            if (veryVerbose) cout << "\tTriggered." << endl;
+
+            logger.logMessage(*TRIGGERED, INFO, "F", 5, "T1");
+            ASSERTV(O.numPublishedRecords(), 6 == O.numPublishedRecords());
+            ASSERTV(logger.numRecordsInUse(), 0 == logger.numRecordsInUse());
+
+            // The record buffer was emptied by the first trigger.
+
+            logger.logMessage(*TRIGGERED, INFO, "F", 6, "T2");
+            ASSERTV(O.numPublishedRecords(), 7 == O.numPublishedRecords());
+            ASSERTV(logger.numRecordsInUse(), 0 == logger.numRecordsInUse());
+
+            static const struct {
+                int         d_line;     // source line number
+                const char *d_message;  // expected message
+                Tr::Cause   d_cause;    // expected transmission cause
+            } DATA[] = {
+                //LINE  MESSAGE  CAUSE
+                //----  -------  -----------------
+                { L_,   "P1",    Tr::e_PASSTHROUGH },
+                { L_,   "B1",    Tr::e_PASSTHROUGH },
+                { L_,   "R1",    Tr::e_TRIGGER     },
+                { L_,   "R2",    Tr::e_TRIGGER     },
+                { L_,   "B1",    Tr::e_TRIGGER     },
+                { L_,   "T1",    Tr::e_TRIGGER     },
+                { L_,   "T2",    Tr::e_TRIGGER     },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            ASSERTV(O.numPublishedRecords(),
+                    NUM_DATA == O.numPublishedRecords());
+
+            for (int ti = 0; ti < NUM_DATA && ti < O.numPublishedRecords();
+                                                                        ++ti) {
+                const int   LINE    = DATA[ti].d_line;
+                const char *MESSAGE = DATA[ti].d_message;
+                const int   CAUSE   = DATA[ti].d_cause;
+
+                if (veryVerbose) { P_(LINE) P_(MESSAGE) P(CAUSE) }
+
+                ASSERTV(LINE, MESSAGE, O.message(ti),
+                        MESSAGE == O.message(ti));
+                ASSERTV(LINE, CAUSE, O.cause(ti), CAUSE == O.cause(ti));
+            }
+
+            ASSERTV(oa.numBlocksInUse(), 0 < oa.numBlocksInUse());
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED
       case 43: {
         // --------------------------------------------------------------------
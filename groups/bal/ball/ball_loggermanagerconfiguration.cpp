@@ -58,6 +58,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 bsl::allocator<DefaultThresholdLevelsCallback>(basicAllocator))
 , d_logOrder(e_LIFO)
 , d_triggerMarkers(e_BEGIN_END_MARKERS)
+, d_recordBufferType(e_FIXED_SIZE_RECORD_BUFFER)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -79,6 +80,7 @@ LoggerManagerConfiguration::LoggerManagerConfiguration(
                 original.d_defaultThresholdsCb)
 , d_logOrder(original.d_logOrder)
 , d_triggerMarkers(original.d_triggerMarkers)
+, d_recordBufferType(original.d_recordBufferType)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
@@ -93,6 +95,7 @@ LoggerManagerConfiguration::operator=(const LoggerManagerConfiguration& rhs)
     d_defaultThresholdsCb = rhs.d_defaultThresholdsCb;
     d_logOrder            = rhs.d_logOrder;
     d_triggerMarkers      = rhs.d_triggerMarkers;
+    d_recordBufferType    = rhs.d_recordBufferType;
 
     return *this;
 }
@@ -159,6 +162,11 @@ void LoggerManagerConfiguration::setTriggerMarkers(TriggerMarkers value)
     d_triggerMarkers = value;
 }
 
+void LoggerManagerConfiguration::setRecordBufferType(RecordBufferType value)
+{
+    d_recordBufferType = value;
+}
+
 // ACCESSORS
 const LoggerManagerDefaults& LoggerManagerConfiguration::defaults() const
 {
@@ -225,6 +233,12 @@ LoggerManagerConfiguration::triggerMarkers() const
     return d_triggerMarkers;
 }
 
+LoggerManagerConfiguration::RecordBufferType
+LoggerManagerConfiguration::recordBufferType() const
+{
+    return d_recordBufferType;
+}
+
 bsl::ostream&
 LoggerManagerConfiguration::print(bsl::ostream& stream,
                                   int           level,
@@ -272,6 +286,13 @@ LoggerManagerConfiguration::print(bsl::ostream& stream,
                                                  : "BEGIN_END_MARKERS";
     stream << "Trigger markers are " << triggerMarker << NL;
 
+    bdlb::Print::indent(stream, level + 1, spacesPerLevel);
+    const char *recordBufferType =
+                               d_recordBufferType == e_RING_RECORD_BUFFER
+                                                 ? "RING_RECORD_BUFFER"
+                                                 : "FIXED_SIZE_RECORD_BUFFER";
+    stream << "Record buffer type is " << recordBufferType << NL;
+
     bdlb::Print::indent(stream, level, spacesPerLevel);
     stream << ']' << NL;
 
@@ -295,7 +316,8 @@ bool ball::operator==(const ball::LoggerManagerConfiguration& lhs,
         && (bool)lhs.d_categoryNameFilter  == (bool)rhs.d_categoryNameFilter
         && (bool)lhs.d_defaultThresholdsCb == (bool)rhs.d_defaultThresholdsCb
         && lhs.d_logOrder                  == rhs.d_logOrder
-        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers;
+        && lhs.d_triggerMarkers            == rhs.d_triggerMarkers
+        && lhs.d_recordBufferType          == rhs.d_recordBufferType;
 }
 
 bool ball::operator!=(const ball::LoggerManagerConfiguration& lhs,
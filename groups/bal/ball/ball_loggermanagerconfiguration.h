@@ -62,6 +62,8 @@ BSLS_IDENT("$Id: $")
 //
 //  TriggerMarkers                               triggerMarkers
 //
+//  RecordBufferType                             recordBufferType
+//
 //  NAME                            DESCRIPTION
 //  -------------------             -------------------------------------------
 //  defaults                        constrained defaults for buffer size and
@@ -90,6 +92,17 @@ BSLS_IDENT("$Id: $")
 //                                  sequence of records logged due to a Trigger
 //                                  or Trigger-All event; default is
 //                                  'e_BEGIN_END_MARKERS'.
+//
+//  recordBufferType                defines the type of record buffer used by
+//                                  the default logger to store log records
+//                                  for Trigger and Trigger-All events; if
+//                                  this attribute is 'e_RING_RECORD_BUFFER',
+//                                  records are stored as copies in a
+//                                  'ball::RingRecordBuffer', which neither
+//                                  allocates memory nor acquires a lock to
+//                                  store a record (see
+//                                  'ball_ringrecordbuffer'); default is
+//                                  'e_FIXED_SIZE_RECORD_BUFFER'.
 //..
 // The constraints are as follows:
 //..
@@ -107,6 +120,8 @@ BSLS_IDENT("$Id: $")
 //  +--------------------------------+--------------------------------+
 //  | triggerMarkers                 | (none)                         |
 //  +--------------------------------+--------------------------------+
+//  | recordBufferType               | (none)                         |
+//  +--------------------------------+--------------------------------+
 //..
 // For convenience, the 'ball::LoggerManagerConfiguration' interface contains
 // manipulators and accessors to configure and inspect the value of its
@@ -201,6 +216,7 @@ BSLS_IDENT("$Id: $")
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Record buffer type is FIXED_SIZE_RECORD_BUFFER
 //  ]
 //..
 
@@ -301,6 +317,19 @@ class LoggerManagerConfiguration {
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
+    enum RecordBufferType {
+        // The 'RecordBufferType' enumeration defines the type of record
+        // buffer used by the default logger to store the log records that are
+        // published in the case of Trigger and Trigger-All events.  The
+        // default value of this attribute is 'e_FIXED_SIZE_RECORD_BUFFER'.
+
+        e_FIXED_SIZE_RECORD_BUFFER,  // store handles to records in a
+                                     // 'FixedSizeRecordBuffer' (default)
+
+        e_RING_RECORD_BUFFER         // store copies of records in a
+                                     // 'RingRecordBuffer'
+    };
+
   private:
     // DATA
     LoggerManagerDefaults d_defaults;             // default buffer size for
@@ -328,6 +357,8 @@ class LoggerManagerConfiguration {
 
     TriggerMarkers        d_triggerMarkers;       // trigger marker
 
+    RecordBufferType      d_recordBufferType;     // record buffer type
+
     bslma::Allocator     *d_allocator_p;          // memory allocator (held,
                                                   // not owned)
 
@@ -450,6 +481,10 @@ class LoggerManagerConfiguration {
         // Set the trigger marker attribute of this object to the specified
         // 'value'.
 
+    void setRecordBufferType(RecordBufferType value);
+        // Set the record buffer type attribute of this object to the specified
+        // 'value'.
+
     // ACCESSORS
     const LoggerManagerDefaults& defaults() const;
         // Return a reference to the non-modifiable defaults object attribute
@@ -500,6 +535,10 @@ class LoggerManagerConfiguration {
         // Return the trigger marker attribute of this object.  See attributes
         // description for effects of the trigger markers.
 
+    RecordBufferType recordBufferType() const;
+        // Return the record buffer type attribute of this object.  See
+        // attributes description for effects of the record buffer type.
+
     bsl::ostream& print(bsl::ostream& stream,
                         int           level          = 0,
                         int           spacesPerLevel = 4) const;
@@ -54,6 +54,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] void setDefaultValues(const ball::LMD& defaults);
 // [ 5] void setLogOrder(LogOrder value);
 // [ 6] void setTriggerMarkers(TriggerMarkers value);
+// [ 7] void setRecordBufferType(RecordBufferType value);
 // [ 1] void setUserFieldsPopulatorCallback(const Populator&);
 // [ 1] void setCategoryNameFilterCallback(const CNF& nameFilter);
 // [ 1] void setDefaultThresholdLevelsCallback(const DTC& );
@@ -61,6 +62,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] const ball::LMD& defaults() const;
 // [ 5] const LogOrder logOrder() const;
 // [ 6] const TriggerMarkers triggerMarkers() const;
+// [ 7] RecordBufferType recordBufferType() const;
 // [ 1] const Populator& userFieldsPopulatorCallback() const;
 // [ 1] const CNF& categoryNameFilterCallback() const;
 // [ 1] const DTC& defaultThresholdLevelsCallback() const;
@@ -70,7 +72,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] bool operator!=(const ball::LMC& lhs, const ball::LMC& rhs);
 // [ 1] bsl::ostream& operator<<(bsl::ostream&, const ball::LMC);
 //-----------------------------------------------------------------------------
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -223,6 +225,7 @@ typedef bsl::function<void(int *, int *, int *, int *, const char*)> DtCb;
 //      Default Threshold Callback functor is null
 //      Logging order is FIFO
 //      Trigger markers are NO_MARKERS
+//      Record buffer type is FIXED_SIZE_RECORD_BUFFER
 //  ]
 //..
 
@@ -309,7 +312,7 @@ int main(int argc, char *argv[])
     const DtCb   DTCB1(dtCb1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -328,6 +331,53 @@ int main(int argc, char *argv[])
 
         initializeConfiguration(verbose);
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING  'setRecordBufferType' AND 'recordBufferType':
+        //   Verify 'setRecordBufferType' and 'recordBufferType'.
+        //
+        // Concern:
+        //   That 'setRecordBufferType' and 'recordBufferType' works
+        //   correctly, and that the record buffer type is part of the value
+        //   of the object.
+        //
+        // Plan:
+        //   1. Create a logger manager configuration and verify
+        //      'recordBufferType'.
+        //   2. Invoke 'setRecordBufferType' with 'e_RING_RECORD_BUFFER' and
+        //      verify 'recordBufferType', and that the object no longer
+        //      compares equal to a default object, but compares equal to a
+        //      copy of itself.
+        //   3. Invoke 'setRecordBufferType' with 'e_FIXED_SIZE_RECORD_BUFFER'
+        //      and verify 'recordBufferType'.
+        //
+        // Testing:
+        //   void setRecordBufferType(RecordBufferType value);
+        //   RecordBufferType recordBufferType() const;
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nTESTING  'setRecordBufferType' AND 'recordBufferType'"
+                 << "\n===================================================\n";
+
+        const Obj X;
+
+        Obj lmc;
+        ASSERT(lmc.recordBufferType() == Obj::e_FIXED_SIZE_RECORD_BUFFER);
+
+        lmc.setRecordBufferType(Obj::e_RING_RECORD_BUFFER);
+        ASSERT(lmc.recordBufferType() == Obj::e_RING_RECORD_BUFFER);
+        ASSERT(X != lmc);
+
+        const Obj Y(lmc);
+        ASSERT(Y == lmc);
+        ASSERT(Y.recordBufferType() == Obj::e_RING_RECORD_BUFFER);
+
+        lmc.setRecordBufferType(Obj::e_FIXED_SIZE_RECORD_BUFFER);
+        ASSERT(lmc.recordBufferType() == Obj::e_FIXED_SIZE_RECORD_BUFFER);
+        ASSERT(X == lmc);
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
@@ -18,6 +18,12 @@ RecordBuffer::~RecordBuffer()
 {
 }
 
+// MANIPULATORS
+int RecordBuffer::pushBackCopy(const Record&)
+{
+    return -1;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  ball::RecordBuffer: protocol class for managing log record handles
 //
-//@SEE_ALSO: ball_record, ball_fixedsizerecordbuffer
+//@SEE_ALSO: ball_record, ball_fixedsizerecordbuffer, ball_ringrecordbuffer
 //
 //@DESCRIPTION: This component defines the base-level protocol,
 // 'ball::RecordBuffer', for managing record handles (specifically instances of
@@ -37,7 +37,9 @@ BSLS_IDENT("$Id: $")
 // records from the buffer in order to attempt to accommodate a push request
 // (which implies that, after a successful call to a push method, 'length' is
 // not guaranteed to be more than one, and an unsuccessful call to a push
-// method is permitted to leave the buffer empty).
+// method is permitted to leave the buffer empty).  Concrete implementations
+// that store copies of records may also accept a record without a handle
+// through the 'pushBackCopy' method, whose default implementation fails.
 //
 ///Usage
 ///-----
@@ -276,6 +278,14 @@ class RecordBuffer {
         // is not guaranteed to be more than one, and an unsuccessful call to
         // 'pushBack' is permitted to leave the buffer empty).
 
+    virtual int pushBackCopy(const Record& record);
+        // Append a copy of the specified 'record' to the back of this record
+        // buffer.  Return 0 on success, and a non-zero value otherwise.  The
+        // default implementation of this method returns a non-zero value with
+        // no effect; concrete implementations that store copies of records,
+        // rather than handles to them, may override it so that a record can
+        // be stored without creating a handle (see 'ball_ringrecordbuffer').
+
     virtual int pushFront(const bsl::shared_ptr<Record>& handle) = 0;
         // Insert the specified 'handle' at the front of this record buffer.
         // Return 0 on success, and a non-zero value otherwise.  Note that
@@ -49,6 +49,7 @@ using namespace bsl;  // automatically added by script
 // [ 1] virtual void popBack() = 0;
 // [ 1] virtual void popFront() = 0;
 // [ 1] virtual int pushBack(const bsl::shared_ptr<ball::Record>&) = 0;
+// [ 1] virtual int pushBackCopy(const ball::Record&);
 // [ 1] virtual int pushFront(const bsl::shared_ptr<ball::Record>&)= 0;
 // [ 1] virtual void removeAll() = 0;
 // [ 1] virtual const bsl::shared_ptr<const ball::Record>& back() const = 0;
@@ -402,6 +403,7 @@ struct RecordBufferTest : bsls::ProtocolTestImp<ball::RecordBuffer> {
     void popBack()                                     { markDone(); }
     void popFront()                                    { markDone(); }
     int pushBack(const bsl::shared_ptr<ball::Record>&)  { return markDone(); }
+    int pushBackCopy(const ball::Record&)              { return markDone(); }
     int pushFront(const bsl::shared_ptr<ball::Record>&) { return markDone(); }
     void removeAll()                                   { markDone(); }
     void beginSequence()                               { markDone(); }
@@ -481,7 +483,8 @@ int main(int argc, char *argv[])
         //   Construct an object of a class derived from 'ball::RecordBuffer'
         //   and bind a 'ball::RecordBuffer' reference to the object.  Using
         //   the base class reference, invoke the 'beginSequence',
-        //   'endSequence', 'popBack', 'popFront', 'pushBack', 'pushFront',
+        //   'endSequence', 'popBack', 'popFront', 'pushBack', 'pushBackCopy',
+        //   'pushFront',
         //   'removeAll', 'back', 'front' and 'length' methods.  Verify that
         //   the correct implementations of the methods are called.
         //
@@ -492,6 +495,7 @@ int main(int argc, char *argv[])
         //   virtual void popBack() = 0;
         //   virtual void popFront() = 0;
         //   virtual int pushBack(const bsl::shared_ptr<ball::Record>&) = 0;
+        //   virtual int pushBackCopy(const ball::Record&);
         //   virtual int pushFront(const bsl::shared_ptr<ball::Record>&)= 0;
         //   virtual void removeAll() = 0;
         //   virtual const ball::Record& back() const = 0;
@@ -511,6 +515,7 @@ int main(int argc, char *argv[])
         BSLS_PROTOCOLTEST_ASSERT(t, popBack());
         BSLS_PROTOCOLTEST_ASSERT(t, popFront());
         BSLS_PROTOCOLTEST_ASSERT(t, pushBack(bsl::shared_ptr<ball::Record>()));
+        BSLS_PROTOCOLTEST_ASSERT(t, pushBackCopy(ball::Record()));
         BSLS_PROTOCOLTEST_ASSERT(t,
                                  pushFront(bsl::shared_ptr<ball::Record>()));
         BSLS_PROTOCOLTEST_ASSERT(t, removeAll());
@@ -13,6 +13,14 @@
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The format specification is compiled into 'd_program' whenever it changes,
+// so that 'operator()' needs only to dispatch on the type of each instruction.
+// Numbers are converted by hand rather than by 'snprintf', and the
+// 'DDMonYYYY_HH:MM:SS' prefix of the most recent '%d' (or '%D') timestamp is
+// cached in the formatter.  As 'operator()' is 'const' and may be invoked
+// concurrently, the cache is guarded by a spin lock that is only ever
+// *tried*: a thread that fails to acquire it generates the prefix itself.
 
 #include <ball_recordstringformatter.h>
 
@@ -42,9 +50,8 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bslstl_stringref.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstring.h>   // for 'bsl::strcmp'
+#include <bsl_cstring.h>   // for 'bsl::strcmp', 'bsl::memcpy'
 #include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
 
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
@@ -59,61 +66,66 @@ const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 namespace BloombergLP {
 
 // STATIC HELPER FUNCTIONS
-static void appendToString(bsl::string *result, int value)
-    // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
+static char *writeDigits(char *buffer, int value, int numDigits)
+    // Write the specified 'numDigits' least-significant decimal digits of the
+    // specified non-negative 'value', padded with leading zeros, to the
+    // specified 'buffer', and return the address one past the last digit
+    // written.
 {
-    char buffer[16];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, "%d", value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    *result += buffer;
+    for (int i = numDigits - 1; i >= 0; --i) {
+        buffer[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return buffer + numDigits;
 }
 
 static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
     // Convert the specified 'value' into ASCII characters and append it to the
     // specified 'result.
 {
-    char buffer[32];
+    char  buffer[32];
+    char *end  = buffer + sizeof buffer;
+    char *iter = end;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, "%llu", value);
+    do {
+        *--iter = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    result->append(iter, end);
+}
 
-    *result += buffer;
+static void appendToString(bsl::string *result, int value)
+    // Convert the specified 'value' into ASCII characters and append it to the
+    // specified 'result.
+{
+    if (value < 0) {
+        *result += '-';
+        appendToString(result,
+                       static_cast<bsls::Types::Uint64>(-static_cast<
+                                               bsls::Types::Int64>(value)));
+    }
+    else {
+        appendToString(result, static_cast<bsls::Types::Uint64>(value));
+    }
 }
 
 static void appendToStringAsHex(bsl::string *result, bsls::Types::Uint64 value)
     // Convert the specified 'value' into hexadecimal and append it to the
     // specified 'result'.
 {
-    char buffer[32];
+    static const char k_DIGITS[] = "0123456789ABCDEF";
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof(buffer), "%llX", value);
+    char  buffer[32];
+    char *end  = buffer + sizeof buffer;
+    char *iter = end;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    do {
+        *--iter = k_DIGITS[value & 0xF];
+        value >>= 4;
+    } while (value);
 
-    *result += buffer;
+    result->append(iter, end);
 }
 
 namespace ball {
@@ -130,18 +142,250 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 // appear in practice.  Real values are (always?) less than one day (plus or
 // minus).
 
+// PRIVATE CLASS METHODS
+void RecordStringFormatter::compile(bsl::vector<Instruction> *program,
+                                    bsl::string              *literals,
+                                    bool                     *hasTimestamp,
+                                    const bsl::string&        format)
+{
+    program->clear();
+    literals->clear();
+    *hasTimestamp = false;
+
+    Instruction instruction;
+    instruction.d_offset = 0;
+    instruction.d_length = 0;
+
+    const char *iter = format.data();
+    const char *end  = iter + format.length();
+
+    while (iter != end) {
+        // Resolve the next conversion specification or escape sequence into
+        // either an instruction or literal text.  Note that a trailing '%' or
+        // '\' produces no output.
+
+        const char *text = iter;
+        int         textLength = 1;
+
+        instruction.d_type = e_LITERAL;
+
+        if ('%' == *iter) {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': {
+                text = iter;
+              } break;
+              case 'd': {
+                instruction.d_type = e_DATETIME;
+              } break;
+              case 'D': {
+                instruction.d_type = e_DATETIME_MICROSECONDS;
+              } break;
+              case 'i': {
+                instruction.d_type = e_ISO8601;
+              } break;
+              case 'I': {
+                instruction.d_type = e_ISO8601_MILLISECONDS;
+              } break;
+              case 'O': {
+                instruction.d_type = e_ISO8601_MICROSECONDS;
+              } break;
+              case 'p': {
+                instruction.d_type = e_PROCESS_ID;
+              } break;
+              case 't': {
+                instruction.d_type = e_THREAD_ID;
+              } break;
+              case 'T': {
+                instruction.d_type = e_THREAD_ID_HEX;
+              } break;
+              case 's': {
+                instruction.d_type = e_SEVERITY;
+              } break;
+              case 'f': {
+                instruction.d_type = e_FILENAME;
+              } break;
+              case 'F': {
+                instruction.d_type = e_FILENAME_BASE;
+              } break;
+              case 'l': {
+                instruction.d_type = e_LINE;
+              } break;
+              case 'c': {
+                instruction.d_type = e_CATEGORY;
+              } break;
+              case 'm': {
+                instruction.d_type = e_MESSAGE;
+              } break;
+              case 'x': {
+                instruction.d_type = e_MESSAGE_PRINTABLE;
+              } break;
+              case 'X': {
+                instruction.d_type = e_MESSAGE_HEX;
+              } break;
+              case 'u': {
+                instruction.d_type = e_USER_FIELDS;
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                textLength = 2;
+              }
+            }
+        }
+        else if ('\\' == *iter) {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n': {
+                text = "\n";
+              } break;
+              case 't': {
+                text = "\t";
+              } break;
+              case '\\': {
+                text = iter;
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                textLength = 2;
+              }
+            }
+        }
+        ++iter;
+
+        if (e_LITERAL != instruction.d_type) {
+            switch (instruction.d_type) {
+              case e_DATETIME:               BSLS_ANNOTATION_FALLTHROUGH;
+              case e_DATETIME_MICROSECONDS:  BSLS_ANNOTATION_FALLTHROUGH;
+              case e_ISO8601:                BSLS_ANNOTATION_FALLTHROUGH;
+              case e_ISO8601_MILLISECONDS:   BSLS_ANNOTATION_FALLTHROUGH;
+              case e_ISO8601_MICROSECONDS: {
+                *hasTimestamp = true;
+              } break;
+              default: {
+              } break;
+            }
+            program->push_back(instruction);
+        }
+        else if (!program->empty() && e_LITERAL == program->back().d_type) {
+            // Extend the preceding literal text.
+
+            literals->append(text, textLength);
+            program->back().d_length += textLength;
+        }
+        else {
+            instruction.d_offset = static_cast<int>(literals->length());
+            instruction.d_length = textLength;
+            literals->append(text, textLength);
+            program->push_back(instruction);
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+void RecordStringFormatter::appendDatetime(
+                              bsl::string           *output,
+                              const bdlt::Datetime&  datetime,
+                              int                    fractionalSecondPrecision)
+                                                                          const
+{
+    static const char *const k_MONTHS[] = {
+        0,
+        "JAN", "FEB", "MAR", "APR",
+        "MAY", "JUN", "JUL", "AUG",
+        "SEP", "OCT", "NOV", "DEC"
+    };
+
+    int hour;
+    int minute;
+    int second;
+    int millisecond;
+    int microsecond;
+
+    datetime.getTime(&hour, &minute, &second, &millisecond, &microsecond);
+
+    const bdlt::Date date        = datetime.date();
+    const int        secondOfDay = (hour * 60 + minute) * 60 + second;
+
+    // Produce the output of 'bdlt::Datetime::printToBuffer', i.e.,
+    // "%02d%s%04d_%02d:%02d:%02d.%0Nd", regenerating only the parts of the
+    // cached prefix that are out of date.
+
+    char  buffer[k_PREFIX_SIZE + 8];
+    bool  locked = 0 == d_cacheLock.tryLock();
+    char *prefix = locked ? d_cachedPrefix : buffer;
+
+    if (!locked || date != d_cachedDate || secondOfDay != d_cachedSecond) {
+        if (!locked || date != d_cachedDate || d_cachedSecond < 0) {
+            int year;
+            int month;
+            int day;
+
+            date.getYearMonthDay(&year, &month, &day);
+
+            char *iter = writeDigits(prefix, day, 2);
+            bsl::memcpy(iter, k_MONTHS[month], 3);
+            iter = writeDigits(iter + 3, year, 4);
+            *iter = '_';
+        }
+
+        char *iter = writeDigits(prefix + 10, hour, 2);
+        *iter = ':';
+        iter = writeDigits(iter + 1, minute, 2);
+        *iter = ':';
+        writeDigits(iter + 1, second, 2);
+
+        if (locked) {
+            d_cachedDate   = date;
+            d_cachedSecond = secondOfDay;
+        }
+    }
+
+    if (locked) {
+        bsl::memcpy(buffer, d_cachedPrefix, k_PREFIX_SIZE - 1);
+        d_cacheLock.unlock();
+    }
+
+    char *iter = buffer + k_PREFIX_SIZE - 1;
+
+    *iter++ = '.';
+    if (3 == fractionalSecondPrecision) {
+        iter = writeDigits(iter, millisecond, 3);
+    }
+    else {
+        iter = writeDigits(iter, millisecond * 1000 + microsecond, 6);
+    }
+
+    output->append(buffer, iter);
+}
+
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    compile(&d_program, &d_literals, &d_hasTimestamp, d_formatSpec);
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    compile(&d_program, &d_literals, &d_hasTimestamp, d_formatSpec);
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -149,7 +393,12 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    compile(&d_program, &d_literals, &d_hasTimestamp, d_formatSpec);
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -163,7 +412,12 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    compile(&d_program, &d_literals, &d_hasTimestamp, d_formatSpec);
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -172,7 +426,12 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    compile(&d_program, &d_literals, &d_hasTimestamp, d_formatSpec);
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -187,7 +446,12 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_program(basicAllocator)
+, d_literals(basicAllocator)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
+    compile(&d_program, &d_literals, &d_hasTimestamp, d_formatSpec);
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -195,6 +459,11 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_program(original.d_program, basicAllocator)
+, d_literals(original.d_literals, basicAllocator)
+, d_hasTimestamp(original.d_hasTimestamp)
+, d_cacheLock(bsls::SpinLock::s_unlocked)
+, d_cachedSecond(-1)
 {
 }
 
@@ -205,37 +474,59 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        d_program         = rhs.d_program;
+        d_literals        = rhs.d_literals;
+        d_hasTimestamp    = rhs.d_hasTimestamp;
     }
 
     return *this;
 }
 
+void RecordStringFormatter::setFormat(const char *format)
+{
+    bslma::Allocator *allocator = d_formatSpec.get_allocator().mechanism();
+
+    bsl::string              formatSpec(format, allocator);
+    bsl::vector<Instruction> program(allocator);
+    bsl::string              literals(allocator);
+    bool                     hasTimestamp;
+
+    compile(&program, &literals, &hasTimestamp, formatSpec);
+
+    // Assign, rather than swap, the specification so that its storage is
+    // reused when it has sufficient capacity.
+
+    d_formatSpec = formatSpec;
+    d_program.swap(program);
+    d_literals.swap(literals);
+    d_hasTimestamp = hasTimestamp;
+}
+
 // ACCESSORS
 void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
 
 {
     const RecordAttributes& fixedFields = record.fixedFields();
-    bdlt::DatetimeInterval  offset;
+    bdlt::DatetimeTz        timestamp;
+
+    if (d_hasTimestamp) {
+        bdlt::DatetimeInterval offset;
 
-    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
+        if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
                                        d_timestampOffset.totalMilliseconds()) {
-        bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
+            bsls::Types::Int64 localTimeOffsetInSeconds =
+                bdlt::LocalTimeOffset::localTimeOffset(
                                        fixedFields.timestamp()).totalSeconds();
-        offset.setTotalSeconds(localTimeOffsetInSeconds);
-    } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
+            offset.setTotalSeconds(localTimeOffsetInSeconds);
+        } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
                                        d_timestampOffset.totalMilliseconds()) {
-        offset = d_timestampOffset;
-    }
-
-    bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
-
-    // Step through the format string, outputting the required elements.
+            offset = d_timestampOffset;
+        }
 
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
+        timestamp.setDatetimeTz(fixedFields.timestamp() + offset,
+                                static_cast<int>(offset.totalMinutes()));
+    }
 
     // Create a buffer on the stack for formatting the record.  Note that the
     // size of the buffer should be slightly larger than the amount we reserve
@@ -251,173 +542,131 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bsl::string output(&stringAllocator);
     output.reserve(STRING_RESERVATION);
 
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'D': {
-                const int fractionalSecondPrecision = 'd' == *iter ? 3 : 6;
-
-                char buffer[32];
-                timestamp.localDatetime().printToBuffer(
-                                                    buffer,
-                                                    sizeof buffer,
-                                                    fractionalSecondPrecision);
+    // Execute the compiled format specification.
 
-                output += buffer;
-              } break;
-              case 'I': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'O': BSLS_ANNOTATION_FALLTHROUGH;
-              case 'i': {
-                // Use ISO8601 "extended" format.
+    const Instruction *iter = d_program.data();
+    const Instruction *end  = iter + d_program.size();
 
-                const int fractionalSecondPrecision = 'O' == *iter ? 6 : 3;
+    for (; iter != end; ++iter) {
+        switch (iter->d_type) {
+          case e_LITERAL: {
+            output.append(d_literals.data() + iter->d_offset, iter->d_length);
+          } break;
+          case e_DATETIME: {
+            appendDatetime(&output, timestamp.localDatetime(), 3);
+          } break;
+          case e_DATETIME_MICROSECONDS: {
+            appendDatetime(&output, timestamp.localDatetime(), 6);
+          } break;
+          case e_ISO8601:                BSLS_ANNOTATION_FALLTHROUGH;
+          case e_ISO8601_MILLISECONDS:   BSLS_ANNOTATION_FALLTHROUGH;
+          case e_ISO8601_MICROSECONDS: {
+            // Use ISO8601 "extended" format.
 
-                bdlt::Iso8601UtilConfiguration config;
-                config.setFractionalSecondPrecision(fractionalSecondPrecision);
-                config.setUseZAbbreviationForUtc(true);
+            const int fractionalSecondPrecision =
+                               e_ISO8601_MICROSECONDS == iter->d_type ? 6 : 3;
 
-                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+            bdlt::Iso8601UtilConfiguration config;
+            config.setFractionalSecondPrecision(fractionalSecondPrecision);
+            config.setUseZAbbreviationForUtc(true);
 
-                int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                                  timestamp,
-                                                                  config);
+            char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
 
-                if ('i' == *iter) {
-                    // Remove milliseconds part.
+            int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
+                                                              timestamp,
+                                                              config);
 
-                    enum { k_DECIMAL_SIGN_OFFSET = 19,
-                           k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-                    bslstl::StringRef head(buffer, k_DECIMAL_SIGN_OFFSET);
+            if (e_ISO8601 == iter->d_type) {
+                // Remove milliseconds part.
 
-                    bslstl::StringRef tail(buffer + k_TZINFO_OFFSET,
-                                           outputLength - k_TZINFO_OFFSET);
+                enum { k_DECIMAL_SIGN_OFFSET = 19,
+                       k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
 
-                    output += head + tail;
-                }
-                else {
-                    output.append(buffer, outputLength);
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 'T': {
-                appendToStringAsHex(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
+                output.append(buffer, k_DECIMAL_SIGN_OFFSET);
+                output.append(buffer + k_TZINFO_OFFSET,
+                              outputLength - k_TZINFO_OFFSET);
+            }
+            else {
+                output.append(buffer, outputLength);
+            }
+          } break;
+          case e_PROCESS_ID: {
+            appendToString(&output, fixedFields.processID());
+          } break;
+          case e_THREAD_ID: {
+            appendToString(&output, fixedFields.threadID());
+          } break;
+          case e_THREAD_ID_HEX: {
+            appendToStringAsHex(&output, fixedFields.threadID());
+          } break;
+          case e_SEVERITY: {
+            output += Severity::toAscii(
                                  (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
+          } break;
+          case e_FILENAME: {
+            output += fixedFields.fileName();
+          } break;
+          case e_FILENAME_BASE: {
+            const bsl::string& filename = fixedFields.fileName();
+            bsl::string::size_type rightmostSlashIndex =
 #ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
+                filename.rfind('\\');
 #else
-                    filename.rfind('/');
+                filename.rfind('/');
 #endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            if (bsl::string::npos == rightmostSlashIndex) {
+                output += filename;
+            }
+            else {
+                output.append(filename, rightmostSlashIndex + 1,
+                              bsl::string::npos);
+            }
+          } break;
+          case e_LINE: {
+            appendToString(&output, fixedFields.lineNumber());
+          } break;
+          case e_CATEGORY: {
+            output += fixedFields.category();
+          } break;
+          case e_MESSAGE: {
+            bslstl::StringRef message = fixedFields.messageRef();
+            output.append(message.data(), message.length());
+          } break;
+          case e_MESSAGE_PRINTABLE: {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
+            bdlb::Print::printString(ss,
+                                    fixedFields.message(),
+                                    length,
+                                    false);
+            output += ss.str();
+          } break;
+          case e_MESSAGE_HEX: {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
                                       fixedFields.messageStreamBuf().length());
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& customFields = record.customFields();
-                const int numCustomFields  = customFields.length();
-
-                if (numCustomFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = customFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != customFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
-
-                output += '%';
-                output += *iter;
-              }
-            }
-            ++iter;
+            bdlb::Print::singleLineHexDump(ss,
+                                          fixedFields.message(),
+                                          length);
+            output += ss.str();
           } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+          case e_USER_FIELDS: {
+            typedef ball::UserFields Values;
+            const Values& customFields = record.customFields();
+            const int numCustomFields  = customFields.length();
 
-                output += '\\';
-                output += *iter;
-              }
+            if (numCustomFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = customFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != customFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                output += ss.str();
             }
-            ++iter;
           } break;
-          default: {
-            output += *iter;
-            ++iter;
-          }
         }
     }
 
@@ -93,6 +93,19 @@ BSLS_IDENT("$Id: $")
 // 27AUG2007_16:09:46.161 2040:1 WARN subdir/process.cpp:542 FOO.BAR.BAZ <text>
 //..
 //
+///Performance
+///-----------
+// The format specification of a record formatter is compiled, when it is
+// supplied (at construction, or by 'setFormat'), into a sequence of
+// instructions, each outputting either a run of literal text or one attribute
+// of a record.  'operator()' executes those instructions, writing directly
+// into a local buffer, without re-examining the format specification.  In
+// addition, the 'DDMonYYYY_HH:MM:SS' prefix of the '%d' and '%D' timestamps
+// is cached, and only its time (or, on a change of day, its date) portion is
+// regenerated when records having a different timestamp are formatted.  The
+// local time offset of a record is computed only if the format specification
+// contains a timestamp.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -129,6 +142,8 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
@@ -136,8 +151,11 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_spinlock.h>
+
 #include <bsl_iosfwd.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -177,9 +195,90 @@ class RecordStringFormatter {
                                               // adjusted to the current local
                                               // time.
 
+    // PRIVATE TYPES
+    enum InstructionType {
+        // This enumeration defines the operations of a compiled format
+        // specification.
+
+        e_LITERAL,                 // literal text
+        e_DATETIME,                // '%d'
+        e_DATETIME_MICROSECONDS,   // '%D'
+        e_ISO8601,                 // '%i'
+        e_ISO8601_MILLISECONDS,    // '%I'
+        e_ISO8601_MICROSECONDS,    // '%O'
+        e_PROCESS_ID,              // '%p'
+        e_THREAD_ID,               // '%t'
+        e_THREAD_ID_HEX,           // '%T'
+        e_SEVERITY,                // '%s'
+        e_FILENAME,                // '%f'
+        e_FILENAME_BASE,           // '%F'
+        e_LINE,                    // '%l'
+        e_CATEGORY,                // '%c'
+        e_MESSAGE,                 // '%m'
+        e_MESSAGE_PRINTABLE,       // '%x'
+        e_MESSAGE_HEX,             // '%X'
+        e_USER_FIELDS              // '%u'
+    };
+
+    struct Instruction {
+        // This 'struct' describes one operation of a compiled format
+        // specification.  For 'e_LITERAL', 'd_offset' and 'd_length' identify
+        // the text to output within 'd_literals'; they are unused otherwise.
+
+        InstructionType d_type;    // operation
+        int             d_offset;  // offset of literal text
+        int             d_length;  // length of literal text
+    };
+
+    enum {
+        k_PREFIX_SIZE = 19  // size of 'DDMonYYYY_HH:MM:SS' plus a null
+    };
+
     // DATA
-    bsl::string            d_formatSpec;       // 'printf'-style format spec.
-    bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
+    bsl::string              d_formatSpec;       // 'printf'-style format spec.
+
+    bdlt::DatetimeInterval   d_timestampOffset;  // offset added to timestamps
+
+    bsl::vector<Instruction> d_program;          // compiled 'd_formatSpec'
+
+    bsl::string              d_literals;         // literal text of
+                                                 // 'd_program', with escape
+                                                 // sequences resolved
+
+    bool                     d_hasTimestamp;     // 'true' if 'd_program'
+                                                 // outputs a timestamp
+
+    mutable bsls::SpinLock   d_cacheLock;        // guard the cached prefix
+
+    mutable bdlt::Date       d_cachedDate;       // date of 'd_cachedPrefix'
+
+    mutable int              d_cachedSecond;     // second of the day of
+                                                 // 'd_cachedPrefix', or -1 if
+                                                 // it has no time
+
+    mutable char             d_cachedPrefix[k_PREFIX_SIZE];
+                                                 // last 'DDMonYYYY_HH:MM:SS'
+                                                 // prefix generated
+
+    // PRIVATE CLASS METHODS
+    static void compile(bsl::vector<Instruction> *program,
+                        bsl::string              *literals,
+                        bool                     *hasTimestamp,
+                        const bsl::string&        format);
+        // Load into the specified 'program' the instructions, and into the
+        // specified 'literals' the literal text, implementing the specified
+        // 'format' specification, and load into the specified 'hasTimestamp'
+        // whether 'program' outputs a timestamp.
+
+    // PRIVATE ACCESSORS
+    void appendDatetime(bsl::string           *output,
+                        const bdlt::Datetime&  datetime,
+                        int                    fractionalSecondPrecision)
+                                                                         const;
+        // Append to the specified 'output' the specified 'datetime' in the
+        // 'DDMonYYYY_HH:MM:SS.fff' format, having the specified
+        // 'fractionalSecondPrecision' (3 or 6) fractional digits, using the
+        // cached prefix if it is available and up to date.
 
   public:
     // TRAITS
@@ -355,12 +454,6 @@ void RecordStringFormatter::enablePublishInLocalTime()
     d_timestampOffset.setTotalMilliseconds(k_ENABLE_PUBLISH_IN_LOCALTIME);
 }
 
-inline
-void RecordStringFormatter::setFormat(const char *format)
-{
-    d_formatSpec = format;
-}
-
 inline
 void RecordStringFormatter::setTimestampOffset(
                                           const bdlt::DatetimeInterval& offset)
@@ -6,9 +6,13 @@
 #include <ball_severity.h>
 #include <ball_userfields.h>
 
+#include <bdlb_print.h>
+
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
 #include <bdlt_localtimeoffset.h>
 
 #include <bslim_testutil.h>
@@ -89,6 +93,7 @@ using bsl::uppercase;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [14] CONCERN: compiled format produces the reference output
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -246,6 +251,166 @@ bool compareText(bslstl::StringRef lhs, bslstl::StringRef rhs)
 
 namespace {
 
+void referenceFormat(bsl::ostream&                 stream,
+                     const char                   *format,
+                     const bdlt::DatetimeInterval&  offset,
+                     const ball::Record&           record)
+    // Format the specified 'record' according to the specified 'format'
+    // specification, biasing its timestamp by the specified 'offset', and
+    // output the result to the specified 'stream', by interpreting 'format'
+    // directly, using streams.
+{
+    const ball::RecordAttributes& fixedFields = record.fixedFields();
+
+    bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
+                               static_cast<int>(offset.totalMinutes()));
+
+    const int messageLength =
+                      static_cast<int>(fixedFields.messageStreamBuf().length());
+
+    for (const char *iter = format; *iter; ++iter) {
+        if ('%' == *iter) {
+            if (0 == *++iter) {
+                break;
+            }
+            switch (*iter) {
+              case '%': {
+                stream << '%';
+              } break;
+              case 'd':
+              case 'D': {
+                char buffer[32];
+                timestamp.localDatetime().printToBuffer(buffer,
+                                                        sizeof buffer,
+                                                        'd' == *iter ? 3 : 6);
+                stream << buffer;
+              } break;
+              case 'i':
+              case 'I':
+              case 'O': {
+                bdlt::Iso8601UtilConfiguration config;
+                config.setFractionalSecondPrecision('O' == *iter ? 6 : 3);
+                config.setUseZAbbreviationForUtc(true);
+
+                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+                int  length = bdlt::Iso8601Util::generateRaw(buffer,
+                                                             timestamp,
+                                                             config);
+                bsl::string result(buffer, length);
+                if ('i' == *iter) {
+                    result.erase(19, 4);
+                }
+                stream << result;
+              } break;
+              case 'p': {
+                stream << fixedFields.processID();
+              } break;
+              case 't': {
+                stream << fixedFields.threadID();
+              } break;
+              case 'T': {
+                stream << hex << uppercase << fixedFields.threadID()
+                       << nouppercase << dec;
+              } break;
+              case 's': {
+                stream << ball::Severity::toAscii(
+                       static_cast<ball::Severity::Level>(
+                                                     fixedFields.severity()));
+              } break;
+              case 'f': {
+                stream << fixedFields.fileName();
+              } break;
+              case 'F': {
+                const bsl::string& name  = fixedFields.fileName();
+                bsl::size_t        slash = name.rfind('/');
+                stream << (bsl::string::npos == slash
+                           ? name
+                           : name.substr(slash + 1));
+              } break;
+              case 'l': {
+                stream << fixedFields.lineNumber();
+              } break;
+              case 'c': {
+                stream << fixedFields.category();
+              } break;
+              case 'm': {
+                stream << fixedFields.messageRef();
+              } break;
+              case 'x': {
+                bdlb::Print::printString(stream,
+                                         fixedFields.message(),
+                                         messageLength,
+                                         false);
+              } break;
+              case 'X': {
+                bdlb::Print::singleLineHexDump(stream,
+                                               fixedFields.message(),
+                                               messageLength);
+              } break;
+              case 'u': {
+                const ball::UserFields& fields = record.customFields();
+                for (int i = 0; i < fields.length(); ++i) {
+                    stream << (i ? " " : "") << fields[i];
+                }
+              } break;
+              default: {
+                stream << '%' << *iter;
+              }
+            }
+        }
+        else if ('\\' == *iter) {
+            if (0 == *++iter) {
+                break;
+            }
+            switch (*iter) {
+              case 'n':  stream << '\n';          break;
+              case 't':  stream << '\t';          break;
+              case '\\': stream << '\\';         break;
+              default:   stream << '\\' << *iter;
+            }
+        }
+        else {
+            stream << *iter;
+        }
+    }
+}
+
+struct ThreadArgs {
+    // This 'struct' holds the arguments of 'formatTimestamps'.
+
+    const Obj *d_formatter_p;  // shared formatter
+    int        d_id;           // distinguishes the timestamps of each thread
+};
+
+extern "C" void *formatTimestamps(void *arg)
+    // Format, using the formatter described by the specified 'arg', records
+    // having timestamps that differ from those of the other threads, and
+    // verify the result against 'referenceFormat'.
+{
+    const ThreadArgs& args = *static_cast<ThreadArgs *>(arg);
+
+    ball::Record record;
+
+    for (int i = 0; i < 2000; ++i) {
+        record.fixedFields().setTimestamp(
+                  bdlt::Datetime(2000 + args.d_id, 1 + i % 12, 1 + i % 28,
+                                 i % 24, i % 60, (i / 3) % 60, i % 1000));
+
+        ostringstream actual;
+        ostringstream expected;
+
+        (*args.d_formatter_p)(actual, record);
+        referenceFormat(expected,
+                        args.d_formatter_p->format(),
+                        args.d_formatter_p->timestampOffset(),
+                        record);
+
+        ASSERTV(args.d_id, i, expected.str(), actual.str(),
+                expected.str() == actual.str());
+    }
+    return 0;
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -263,6 +428,175 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING COMPILED FORMAT
+        //   The format specification is compiled when it is set, and the
+        //   timestamp prefix is cached between calls to 'operator()'.
+        //
+        // Concerns:
+        //: 1 For every format specification (including ones having undefined
+        //:   conversions and escape sequences, and ones ending with a '%' or a
+        //:   '\'), the output of 'operator()' is identical to that obtained
+        //:   by interpreting the specification directly.
+        //:
+        //: 2 The cached timestamp prefix is regenerated when the second, or
+        //:   the day, of the formatted timestamp changes, in either direction.
+        //:
+        //: 3 Copies, assignment, and 'setFormat' produce formatters whose
+        //:   compiled format matches their specification.
+        //:
+        //: 4 'operator()' may be invoked concurrently on the same formatter.
+        //
+        // Plan:
+        //: 1 For a table of format specifications and a sequence of records
+        //:   having timestamps that vary in each field, compare the output of
+        //:   'operator()' with that of 'referenceFormat'.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 using formatters obtained by copy construction,
+        //:   assignment, and 'setFormat'.  (C-3)
+        //:
+        //: 3 Format records having distinct timestamps on several threads
+        //:   sharing one formatter and compare with 'referenceFormat'.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: compiled format produces the reference output
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COMPILED FORMAT" << endl
+                          << "=======================" << endl;
+
+        static const char *const FORMATS[] = {
+            "",
+            "plain text only",
+            "\n%d %p:%t %s %f:%l %c %m %u\n",
+            "%d%D%i%I%O",
+            "[%D] [%O] [%i]",
+            "%p %t %T %s %f %F %l %c",
+            "%m|%x|%X|%u",
+            "%%%%d %%",
+            "%z %\\ \\q \\\\ \\t",
+            "trailing %",
+            "trailing \\",
+            "%",
+            "\\",
+            "%d%d%d"
+        };
+        const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+        const bdlt::Datetime TIMESTAMPS[] = {
+            bdlt::Datetime(),
+            bdlt::Datetime(2007,  8, 27, 16,  9, 46, 161, 324),
+            bdlt::Datetime(2007,  8, 27, 16,  9, 46, 999, 999),
+            bdlt::Datetime(2007,  8, 27, 16,  9, 47,   0,   1),
+            bdlt::Datetime(2007,  8, 27, 16,  9, 46,   5,  17),
+            bdlt::Datetime(2007,  8, 28, 16,  9, 46,   5,  17),
+            bdlt::Datetime(2007,  8, 27, 23, 59, 59, 999, 999),
+            bdlt::Datetime(2007,  8, 28,  0,  0,  0,   0,   0),
+            bdlt::Datetime( 999, 12, 31,  1,  2,  3,   4,   5),
+            bdlt::Datetime(9999, 12, 30, 22, 59, 59, 999, 999),
+            bdlt::Datetime(2024,  2, 29, 12,  0,  0,  50, 500)
+        };
+        const int NUM_TIMESTAMPS = sizeof TIMESTAMPS / sizeof *TIMESTAMPS;
+
+        const bdlt::DatetimeInterval OFFSETS[] = { T0, TA, TB };
+        const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+        ball::RecordAttributes fixedFields(bdlt::Datetime(),
+                                           -4321,
+                                           0xDEADBEEFULL,
+                                           "dir/sub\\dir/file.cpp",
+                                           -7,
+                                           "CATEGORY",
+                                           ball::Severity::e_ERROR,
+                                           "a\tmessage\x01\xff");
+
+        ball::UserFields userFields;
+        userFields.appendString("string");
+        userFields.appendInt64(-12);
+
+        ball::Record mRecord(fixedFields, userFields);
+        const ball::Record& record = mRecord;
+
+        if (verbose) cout << "\nCompare with the reference output." << endl;
+
+        for (int ti = 0; ti < NUM_FORMATS; ++ti) {
+            const char *const FORMAT = FORMATS[ti];
+
+            for (int oi = 0; oi < NUM_OFFSETS; ++oi) {
+                const bdlt::DatetimeInterval& OFFSET = OFFSETS[oi];
+
+                bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                Obj mX(FORMAT, OFFSET, &sa);  const Obj& X = mX;
+                Obj mY(X, &sa);               const Obj& Y = mY;
+                Obj mZ(&sa);                  const Obj& Z = mZ;
+                Obj mW(&sa);                  const Obj& W = mW;
+
+                mZ = X;
+                mW.setFormat(FORMAT);
+                mW.setTimestampOffset(OFFSET);
+
+                const Obj *const OBJECTS[] = { &X, &Y, &Z, &W };
+
+                for (int k = 0; k < 4; ++k) {
+                    const Obj& OBJ = *OBJECTS[k];
+
+                    // Visit the timestamps forward, then backward, to exercise
+                    // the cached prefix.
+
+                    for (int j = 0; j < 2 * NUM_TIMESTAMPS; ++j) {
+                        const int tj = j < NUM_TIMESTAMPS
+                                       ? j
+                                       : 2 * NUM_TIMESTAMPS - j - 1;
+
+                        if (0 == tj && 0 != oi) {
+                            // The default timestamp cannot be offset.
+
+                            continue;
+                        }
+
+                        mRecord.fixedFields().setTimestamp(TIMESTAMPS[tj]);
+
+                        ostringstream actual;
+                        ostringstream expected;
+
+                        OBJ(actual, record);
+                        referenceFormat(expected, FORMAT, OFFSET, record);
+
+                        if (veryVeryVerbose) {
+                            T_ P_(ti) P_(oi) P_(k) P_(tj) P(actual.str())
+                        }
+
+                        ASSERTV(ti, oi, k, tj, expected.str(), actual.str(),
+                                compareText(actual.str(), expected.str()));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nConcurrent formatting." << endl;
+        {
+            enum { k_NUM_THREADS = 4 };
+
+            const Obj X("%d|%D|%m");
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            ThreadArgs                args[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_formatter_p = &X;
+                args[i].d_id          = i;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      formatTimestamps,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -0,0 +1,614 @@
+// ball_ringrecordbuffer.cpp                                          -*-C++-*-
+#include <ball_ringrecordbuffer.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_ringrecordbuffer_cpp,"$Id$ $CSID$")
+
+#include <ball_recordattributes.h>
+#include <ball_userfields.h>
+#include <ball_userfieldtype.h>
+#include <ball_userfieldvalue.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstring.h>
+#include <bsl_new.h>
+#include <bsl_vector.h>
+
+///Implementation Notes
+///--------------------
+// Each slot of 'd_ring_p' is paired with a stamp in 'd_stamps_p' encoding the
+// sequence number of the record last written to the slot (the sequence number
+// of a record is the value of the write cursor, 'd_nextSequence', claimed by
+// its writer) and the state of the slot.  A writer claims the slot selected by
+// its sequence number by changing the stamp of the slot from the (completed)
+// record of an older sequence number to the writing state of its own sequence
+// number, and publishes the record by storing the ready state.  A writer
+// discards its record if another writer (of an older or newer record) is
+// writing to the slot, or if the slot already holds a newer record, so that at
+// most one writer writes to a slot at any time.
+//
+// 'drain' copies the ready records in sequence order to the staging slots,
+// and validates each copy by changing the stamp from the ready state to the
+// empty state: if a writer claimed the slot during the copy, the stamp no
+// longer has the ready state of the copied sequence number and the copy is
+// discarded.  'drain' skips a record that is still being written, so that the
+// completed records following it (in particular, a record pushed by the thread
+// that then locks the buffer to publish it) are moved to the staging slots,
+// and the next call resumes from the first skipped record.  Records already
+// moved by the previous call are then recognized by their empty stamps and
+// ignored, and a skipped record whose slot has since been claimed by a newer
+// writer is recognized as overwritten by the sequence number of its stamp.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+enum SlotState {
+    // Enumerate the states of a slot written by 'pushBackCopy'.
+
+    e_EMPTY   = 0,  // the slot holds no record, or its record was moved
+    e_WRITING = 1,  // a record is being written to the slot
+    e_READY   = 2   // the slot holds a record
+};
+
+inline
+bsls::Types::Int64 makeStamp(bsls::Types::Int64 sequence, SlotState state)
+    // Return the stamp of a slot holding the record having the specified
+    // 'sequence' number in the specified 'state'.
+{
+    return (sequence + 1) * 4 + state;
+}
+
+inline
+bsls::Types::Int64 stampSequence(bsls::Types::Int64 stamp)
+    // Return the sequence number encoded in the specified 'stamp'.
+{
+    return stamp / 4 - 1;
+}
+
+inline
+int stampState(bsls::Types::Int64 stamp)
+    // Return the slot state encoded in the specified 'stamp'.
+{
+    return static_cast<int>(stamp % 4);
+}
+
+struct SerializedHeader {
+    // This 'struct' holds the fixed-size attributes of a serialized record,
+    // which are followed in the slot by the file name and category (each
+    // null-terminated), the user fields, and the message.
+
+    bdlt::Datetime      d_timestamp;       // creation date and time
+    bsls::Types::Uint64 d_threadID;        // thread id of creator
+    int                 d_processID;       // process id of creator
+    int                 d_lineNumber;      // line number of creator
+    int                 d_severity;        // severity
+    int                 d_fileNameLength;  // length of file name
+    int                 d_categoryLength;  // length of category
+    int                 d_numUserFields;   // number of user fields
+    int                 d_messageLength;   // length of (truncated) message
+};
+
+class SlotWriter {
+    // This class provides a mechanism for writing a sequence of bytes to a
+    // fixed-size buffer.
+
+    // DATA
+    char *d_cursor_p;  // next byte to write
+    char *d_end_p;     // end of the buffer
+
+  public:
+    // CREATORS
+    SlotWriter(char *buffer, bsl::size_t size)
+        // Create a writer of the specified 'buffer' of the specified 'size'.
+    : d_cursor_p(buffer)
+    , d_end_p(buffer + size)
+    {
+    }
+
+    // MANIPULATORS
+    int write(const void *data, bsl::size_t length)
+        // Write the specified 'length' bytes at the specified 'data' to the
+        // buffer.  Return 0 on success, and a non-zero value, with no effect,
+        // if fewer than 'length' bytes remain available in the buffer.
+    {
+        if (available() < length) {
+            return -1;                                                // RETURN
+        }
+        if (length) {
+            bsl::memcpy(d_cursor_p, data, length);
+            d_cursor_p += length;
+        }
+        return 0;
+    }
+
+    int writeLength(bsl::size_t length)
+        // Write the specified 'length' as an 'int' to the buffer.  Return 0
+        // on success, and a non-zero value otherwise.
+    {
+        const int value = static_cast<int>(length);
+        return write(&value, sizeof value);
+    }
+
+    // ACCESSORS
+    bsl::size_t available() const
+        // Return the number of bytes that remain available in the buffer.
+    {
+        return d_end_p - d_cursor_p;
+    }
+};
+
+template <class TYPE>
+inline
+const char *read(TYPE *value, const char *cursor)
+    // Load into the specified 'value' the object serialized at the specified
+    // 'cursor', and return the address following it.
+{
+    bsl::memcpy(static_cast<void *>(value), cursor, sizeof(TYPE));
+    return cursor + sizeof(TYPE);
+}
+
+int serializeUserField(SlotWriter *writer, const UserFieldValue& value)
+    // Write the specified 'value' using the specified 'writer'.  Return 0 on
+    // success, and a non-zero value otherwise.
+{
+    const int type = value.type();
+    if (0 != writer->write(&type, sizeof type)) {
+        return -1;                                                    // RETURN
+    }
+
+    switch (value.type()) {
+      case UserFieldType::e_VOID: {
+        return 0;                                                     // RETURN
+      }
+      case UserFieldType::e_INT64: {
+        return writer->write(&value.theInt64(), sizeof(bsls::Types::Int64));
+                                                                      // RETURN
+      }
+      case UserFieldType::e_DOUBLE: {
+        return writer->write(&value.theDouble(), sizeof(double));     // RETURN
+      }
+      case UserFieldType::e_STRING: {
+        const bsl::string& string = value.theString();
+        return writer->writeLength(string.length())
+             | writer->write(string.data(), string.length());         // RETURN
+      }
+      case UserFieldType::e_DATETIMETZ: {
+        return writer->write(&value.theDatetimeTz(),
+                             sizeof(bdlt::DatetimeTz));               // RETURN
+      }
+      case UserFieldType::e_CHAR_ARRAY: {
+        const bsl::vector<char>& array = value.theCharArray();
+        return writer->writeLength(array.size())
+             | writer->write(array.data(), array.size());             // RETURN
+      }
+    }
+    return -1;
+}
+
+int serializeRecord(char *slot, int slotSize, const Record& record)
+    // Write the specified 'record' to the specified 'slot' of the specified
+    // 'slotSize', truncating its message if needed.  Return 0 on success, and
+    // a non-zero value if the attributes of 'record' other than its message
+    // do not fit in 'slot'.
+{
+    if (slotSize < static_cast<int>(sizeof(SerializedHeader))) {
+        return -1;                                                    // RETURN
+    }
+
+    const RecordAttributes& fixedFields  = record.fixedFields();
+    const UserFields&       customFields = record.customFields();
+
+    const char *fileName = fixedFields.fileName();
+    const char *category = fixedFields.category();
+
+    SerializedHeader header;
+    header.d_timestamp      = fixedFields.timestamp();
+    header.d_threadID       = fixedFields.threadID();
+    header.d_processID      = fixedFields.processID();
+    header.d_lineNumber     = fixedFields.lineNumber();
+    header.d_severity       = fixedFields.severity();
+    header.d_fileNameLength = static_cast<int>(bsl::strlen(fileName));
+    header.d_categoryLength = static_cast<int>(bsl::strlen(category));
+    header.d_numUserFields  = customFields.length();
+
+    SlotWriter writer(slot + sizeof header, slotSize - sizeof header);
+
+    if (0 != writer.write(fileName, header.d_fileNameLength + 1)
+     || 0 != writer.write(category, header.d_categoryLength + 1)) {
+        return -1;                                                    // RETURN
+    }
+
+    for (UserFields::ConstIterator it  = customFields.begin();
+                                   it != customFields.end();
+                                 ++it) {
+        if (0 != serializeUserField(&writer, *it)) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    const bslstl::StringRef message = fixedFields.messageRef();
+    const bsl::size_t       length  = bsl::min(message.length(),
+                                               writer.available());
+
+    writer.write(message.data(), length);
+    header.d_messageLength = static_cast<int>(length);
+
+    bsl::memcpy(static_cast<void *>(slot), &header, sizeof header);
+    return 0;
+}
+
+void deserializeRecord(Record *record, const char *slot)
+    // Load into the specified 'record' the record serialized in the specified
+    // 'slot'.  The behavior is undefined unless 'record' is in the default
+    // state.
+{
+    SerializedHeader header;
+    const char *cursor = read(&header, slot);
+
+    RecordAttributes& fixedFields = record->fixedFields();
+    fixedFields.setTimestamp(header.d_timestamp);
+    fixedFields.setThreadID(header.d_threadID);
+    fixedFields.setProcessID(header.d_processID);
+    fixedFields.setLineNumber(header.d_lineNumber);
+    fixedFields.setSeverity(header.d_severity);
+
+    fixedFields.setFileName(cursor);
+    cursor += header.d_fileNameLength + 1;
+
+    fixedFields.setCategory(cursor);
+    cursor += header.d_categoryLength + 1;
+
+    UserFields& customFields = record->customFields();
+    for (int i = 0; i < header.d_numUserFields; ++i) {
+        int type;
+        cursor = read(&type, cursor);
+
+        switch (type) {
+          case UserFieldType::e_VOID: {
+            customFields.appendNull();
+          } break;
+          case UserFieldType::e_INT64: {
+            bsls::Types::Int64 value;
+            cursor = read(&value, cursor);
+            customFields.appendInt64(value);
+          } break;
+          case UserFieldType::e_DOUBLE: {
+            double value;
+            cursor = read(&value, cursor);
+            customFields.appendDouble(value);
+          } break;
+          case UserFieldType::e_STRING: {
+            int length;
+            cursor = read(&length, cursor);
+            customFields.appendString(bslstl::StringRef(cursor, length));
+            cursor += length;
+          } break;
+          case UserFieldType::e_DATETIMETZ: {
+            bdlt::DatetimeTz value;
+            cursor = read(&value, cursor);
+            customFields.appendDatetimeTz(value);
+          } break;
+          case UserFieldType::e_CHAR_ARRAY: {
+            int length;
+            cursor = read(&length, cursor);
+            customFields.appendCharArray(
+                         bsl::vector<char>(cursor,
+                                           cursor + length,
+                                           customFields.allocator()));
+            cursor += length;
+          } break;
+          default: {
+            BSLS_ASSERT(!"Unexpected user field type");
+          } break;
+        }
+    }
+
+    fixedFields.messageStreamBuf().sputn(cursor, header.d_messageLength);
+}
+
+}  // close unnamed namespace
+
+                           // ----------------------
+                           // class RingRecordBuffer
+                           // ----------------------
+
+// PRIVATE MANIPULATORS
+void RingRecordBuffer::init(int maxTotalSize, int maxRecordSize)
+{
+    BSLS_ASSERT(0 < maxTotalSize);
+    BSLS_ASSERT(0 < maxRecordSize);
+
+    const bsls::Types::Int64 bytesPerSlot =
+                 2 * static_cast<bsls::Types::Int64>(maxRecordSize)
+                                                 + sizeof(bsls::AtomicInt64);
+
+    d_slotSize = maxRecordSize;
+    d_numSlots = static_cast<int>(bsl::max<bsls::Types::Int64>(
+                                               maxTotalSize / bytesPerSlot,
+                                               1));
+
+    void *memory = d_allocator_p->allocate(d_numSlots * bytesPerSlot);
+
+    d_stamps_p = static_cast<bsls::AtomicInt64 *>(memory);
+    for (int i = 0; i < d_numSlots; ++i) {
+        new (d_stamps_p + i) bsls::AtomicInt64(makeStamp(-1, e_EMPTY));
+    }
+
+    d_ring_p    = reinterpret_cast<char *>(d_stamps_p + d_numSlots);
+    d_staging_p = d_ring_p + static_cast<bsls::Types::Int64>(d_numSlots)
+                                                                  * d_slotSize;
+}
+
+// PRIVATE ACCESSORS
+void RingRecordBuffer::drain() const
+{
+    const bsls::Types::Int64 end = d_nextSequence.loadAcquire();
+
+    bsls::Types::Int64 resume = end;   // first sequence number not moved
+    bool               moved  = false;
+
+    for (bsls::Types::Int64 sequence = bsl::max(d_drainSequence,
+                                                end - d_numSlots);
+         sequence < end;
+         ++sequence) {
+        bsls::AtomicInt64& stamp =
+                      d_stamps_p[static_cast<int>(sequence % d_numSlots)];
+        const char        *slot  =
+                      d_ring_p + (sequence % d_numSlots) * d_slotSize;
+
+        const bsls::Types::Int64 current = stamp.loadAcquire();
+        if (stampSequence(current) == sequence
+         && e_WRITING == stampState(current)) {
+            // The record is still being written; move the records following
+            // it, and move it on a later call.
+
+            resume = bsl::min(resume, sequence);
+            continue;
+        }
+        if (makeStamp(sequence, e_READY) != current) {
+            // The record was discarded, overwritten, or already moved.
+
+            continue;
+        }
+
+        if (d_stagingLength == d_numSlots) {
+            d_stagingFront = (d_stagingFront + 1) % d_numSlots;
+            --d_stagingLength;
+        }
+
+        char *target = stagingSlot(d_stagingLength);
+        bsl::memcpy(target, slot, d_slotSize);
+        moved = true;
+
+        if (current == stamp.testAndSwap(current,
+                                         makeStamp(sequence, e_EMPTY))) {
+            ++d_stagingLength;
+        }
+    }
+
+    d_drainSequence = resume;
+    if (moved) {
+        d_frontRecord.reset();
+        d_backRecord.reset();
+    }
+}
+
+void RingRecordBuffer::lock() const
+{
+    d_mutex.lock();
+    if (0 == d_lockDepth++) {
+        drain();
+    }
+}
+
+// CREATORS
+RingRecordBuffer::RingRecordBuffer(int               maxTotalSize,
+                                   bslma::Allocator *basicAllocator)
+: d_slotSize(0)
+, d_numSlots(0)
+, d_nextSequence(0)
+, d_stamps_p(0)
+, d_ring_p(0)
+, d_staging_p(0)
+, d_lockDepth(0)
+, d_drainSequence(0)
+, d_stagingFront(0)
+, d_stagingLength(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(maxTotalSize, k_DEFAULT_MAX_RECORD_SIZE);
+}
+
+RingRecordBuffer::RingRecordBuffer(int               maxTotalSize,
+                                   int               maxRecordSize,
+                                   bslma::Allocator *basicAllocator)
+: d_slotSize(0)
+, d_numSlots(0)
+, d_nextSequence(0)
+, d_stamps_p(0)
+, d_ring_p(0)
+, d_staging_p(0)
+, d_lockDepth(0)
+, d_drainSequence(0)
+, d_stagingFront(0)
+, d_stagingLength(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(maxTotalSize, maxRecordSize);
+}
+
+RingRecordBuffer::~RingRecordBuffer()
+{
+    d_frontRecord.reset();
+    d_backRecord.reset();
+    d_allocator_p->deallocate(d_stamps_p);
+}
+
+// MANIPULATORS
+void RingRecordBuffer::popBack()
+{
+    lock();
+
+    BSLS_ASSERT(0 < d_stagingLength);
+
+    --d_stagingLength;
+    d_frontRecord.reset();
+    d_backRecord.reset();
+
+    unlock();
+}
+
+void RingRecordBuffer::popFront()
+{
+    lock();
+
+    BSLS_ASSERT(0 < d_stagingLength);
+
+    d_stagingFront = (d_stagingFront + 1) % d_numSlots;
+    --d_stagingLength;
+    d_frontRecord.reset();
+    d_backRecord.reset();
+
+    unlock();
+}
+
+int RingRecordBuffer::pushBackCopy(const Record& record)
+{
+    const bsls::Types::Int64 sequence = d_nextSequence.addAcqRel(1) - 1;
+
+    bsls::AtomicInt64& stamp = d_stamps_p[static_cast<int>(
+                                                      sequence % d_numSlots)];
+    char              *slot  = d_ring_p + (sequence % d_numSlots) * d_slotSize;
+
+    bsls::Types::Int64 current = stamp.loadRelaxed();
+    for (;;) {
+        if (e_WRITING == stampState(current)
+         || stampSequence(current) >= sequence) {
+            // Another writer is writing to the slot, or the slot already
+            // holds a newer record.
+
+            return -1;                                                // RETURN
+        }
+
+        const bsls::Types::Int64 previous = stamp.testAndSwap(
+                                             current,
+                                             makeStamp(sequence, e_WRITING));
+        if (previous == current) {
+            break;
+        }
+        current = previous;
+    }
+
+    if (0 != serializeRecord(slot, d_slotSize, record)) {
+        stamp.storeRelease(makeStamp(sequence, e_EMPTY));
+        return -1;                                                    // RETURN
+    }
+
+    stamp.storeRelease(makeStamp(sequence, e_READY));
+    return 0;
+}
+
+int RingRecordBuffer::pushFront(const bsl::shared_ptr<Record>& handle)
+{
+    lock();
+
+    int rc = -1;
+    if (d_stagingLength < d_numSlots) {
+        const int front = (d_stagingFront + d_numSlots - 1) % d_numSlots;
+        char     *slot  = d_staging_p
+                        + static_cast<bsls::Types::Int64>(front) * d_slotSize;
+
+        rc = serializeRecord(slot, d_slotSize, *handle);
+        if (0 == rc) {
+            d_stagingFront = front;
+            ++d_stagingLength;
+            d_frontRecord.reset();
+            d_backRecord.reset();
+        }
+    }
+
+    unlock();
+    return rc;
+}
+
+void RingRecordBuffer::removeAll()
+{
+    lock();
+
+    d_drainSequence = d_nextSequence.loadAcquire();
+    d_stagingLength = 0;
+    d_frontRecord.reset();
+    d_backRecord.reset();
+
+    unlock();
+}
+
+// ACCESSORS
+const bsl::shared_ptr<Record>& RingRecordBuffer::back() const
+{
+    lock();
+
+    BSLS_ASSERT(0 < d_stagingLength);
+
+    if (!d_backRecord) {
+        d_backRecord.createInplace(d_allocator_p, d_allocator_p);
+        deserializeRecord(d_backRecord.get(),
+                          stagingSlot(d_stagingLength - 1));
+    }
+
+    unlock();
+    return d_backRecord;
+}
+
+const bsl::shared_ptr<Record>& RingRecordBuffer::front() const
+{
+    lock();
+
+    BSLS_ASSERT(0 < d_stagingLength);
+
+    if (!d_frontRecord) {
+        d_frontRecord.createInplace(d_allocator_p, d_allocator_p);
+        deserializeRecord(d_frontRecord.get(), stagingSlot(0));
+    }
+
+    unlock();
+    return d_frontRecord;
+}
+
+int RingRecordBuffer::length() const
+{
+    lock();
+    const int length = d_stagingLength;
+    unlock();
+
+    return length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,427 @@
+// ball_ringrecordbuffer.h                                            -*-C++-*-
+#ifndef INCLUDED_BALL_RINGRECORDBUFFER
+#define INCLUDED_BALL_RINGRECORDBUFFER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size record buffer storing copies of records.
+//
+//@CLASSES:
+//  ball::RingRecordBuffer: fixed-size ring buffer of serialized records
+//
+//@SEE_ALSO: ball_recordbuffer, ball_fixedsizerecordbuffer
+//
+//@DESCRIPTION: This component provides a concrete thread-safe implementation
+// of the 'ball::RecordBuffer' protocol, 'ball::RingRecordBuffer':
+//..
+//              ( ball::RingRecordBuffer )
+//                            |              ctor
+//                            V
+//                  ( ball::RecordBuffer )
+//                                           dtor
+//                                           beginSequence
+//                                           endSequence
+//                                           popBack
+//                                           popFront
+//                                           pushBack
+//                                           pushBackCopy
+//                                           pushFront
+//                                           removeAll
+//                                           length
+//                                           back
+//                                           front
+//..
+// Unlike 'ball::FixedSizeRecordBuffer', which holds handles to (shared) log
+// records, 'ball::RingRecordBuffer' stores a serialized copy of each record
+// in a fixed array of equally-sized slots that is allocated when the buffer is
+// created.  A record pushed at the back of the buffer (using 'pushBack' or
+// 'pushBackCopy') is written to the slot following the most recently written
+// one, overwriting the oldest record in the buffer once every slot is in use.
+// Pushing a record at the back of the buffer neither allocates memory nor
+// acquires a lock: each writer claims its slot by atomically advancing a
+// shared write cursor, and concurrent writers therefore never write to the
+// same slot.  This makes a 'ball::RingRecordBuffer' well suited to the "record
+// all, publish on error" (trigger) mode of 'ball::LoggerManager' (see
+// 'ball_loggermanagerconfiguration'), where most records stored in the buffer
+// are never published.
+//
+// The remaining operations, which are used to publish the contents of the
+// buffer, are synchronized by a recursive mutex.  When the buffer is locked
+// (by 'beginSequence', or by any other such operation invoked outside of a
+// sequence), the records written to the slots since the buffer was last
+// locked are moved to a second array of slots, from which they are read and
+// removed by 'back', 'front', 'popBack', and 'popFront'.  The contents of
+// the buffer therefore do not change during a sequence, although records may
+// be pushed at its back concurrently; those records are part of the buffer
+// when it is next locked.  Every record whose 'pushBackCopy' returned before
+// the buffer is locked is part of the buffer once it is locked, even if a
+// record pushed earlier by another thread is still being written; that record
+// is added to the back of the buffer when the buffer is next locked after its
+// 'pushBackCopy' returns (so that it may follow records pushed after it).  The
+// 'back' and 'front' methods return a handle to a newly allocated copy of the
+// respective record.
+//
+///Record Size
+///-----------
+// Each slot holds at most the 'maxRecordSize' bytes supplied at construction
+// (512 by default).  A record whose fixed fields (other than its message) and
+// user fields do not fit in a slot is discarded, and a message that does not
+// fit in the remainder of the slot is truncated.  At any time the memory
+// allocated for the slots of a 'ball::RingRecordBuffer' is less than or equal
+// to the 'maxTotalSize' supplied at construction, provided that it is large
+// enough to accommodate at least one record (in which case the buffer has a
+// capacity of 'maxTotalSize / (2 * maxRecordSize + 8)' records, as each slot
+// is paired with a slot used during publication and a sequence number).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Capturing Records for Later Publication
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we store a series of records in a ring record buffer, and
+// later publish the most recent of them.
+//
+// First, we create a record buffer that has room for 4 records of up to 256
+// bytes each:
+//..
+//  ball::RingRecordBuffer buffer(4 * (2 * 256 + 8), 256);
+//  assert(4 == buffer.capacity());
+//..
+// Then, we store copies of 6 records in the buffer.  Note that no memory is
+// allocated by the buffer to store the records, and that the record object
+// can be reused once it is stored:
+//..
+//  ball::Record record;
+//  record.fixedFields().setCategory("MyCategory");
+//  record.fixedFields().setSeverity(ball::Severity::e_TRACE);
+//
+//  for (int i = 0; i < 6; ++i) {
+//      bsl::ostringstream message;
+//      message << "message " << i;
+//      record.fixedFields().setMessage(message.str().c_str());
+//
+//      int rc = buffer.pushBackCopy(record);
+//      assert(0 == rc);
+//  }
+//..
+// Finally, we publish the records remaining in the buffer (i.e., the 4 most
+// recent ones) in FIFO order:
+//..
+//  buffer.beginSequence();
+//  assert(4 == buffer.length());
+//
+//  assert(bsl::string("message 2") ==
+//                                buffer.front()->fixedFields().messageRef());
+//
+//  while (0 < buffer.length()) {
+//      bsl::cout << buffer.front()->fixedFields().message() << bsl::endl;
+//      buffer.popFront();
+//  }
+//  buffer.endSequence();
+//..
+// This prints:
+//..
+//  message 2
+//  message 3
+//  message 4
+//  message 5
+//..
+
+#include <balscm_version.h>
+
+#include <ball_record.h>
+#include <ball_recordbuffer.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_recursivemutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ball {
+
+                           // ======================
+                           // class RingRecordBuffer
+                           // ======================
+
+class RingRecordBuffer : public RecordBuffer {
+    // This class provides a concrete, thread-safe implementation of the
+    // 'RecordBuffer' protocol that stores serialized copies of records in a
+    // fixed number of fixed-size slots.  Pushing a record at the back of the
+    // buffer does not allocate memory or acquire a lock, and overwrites the
+    // oldest record if the buffer is full.  The class is thread-safe, except
+    // that the methods 'front' and 'back' must be called after locking the
+    // buffer by invoking 'beginSequence'.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_MAX_RECORD_SIZE = 512  // default maximum size of a
+                                         // serialized record
+    };
+
+  private:
+    // DATA
+    int                           d_slotSize;       // size of a slot
+
+    int                           d_numSlots;       // number of slots in
+                                                    // each array of slots
+
+    bsls::AtomicInt64             d_nextSequence;   // write cursor: sequence
+                                                    // number of the next
+                                                    // record pushed at the
+                                                    // back
+
+    bsls::AtomicInt64            *d_stamps_p;       // sequence number and
+                                                    // state of the record in
+                                                    // each slot of 'd_ring_p'
+
+    char                         *d_ring_p;         // slots written by
+                                                    // 'pushBack'
+
+    char                         *d_staging_p;      // slots holding the
+                                                    // records read by
+                                                    // 'back', 'front', etc.
+
+    mutable bslmt::RecursiveMutex d_mutex;          // synchronizes access to
+                                                    // the staging slots
+
+    mutable int                   d_lockDepth;      // number of times
+                                                    // 'd_mutex' is locked
+                                                    // by its owner
+
+    mutable bsls::Types::Int64    d_drainSequence;  // sequence number of the
+                                                    // next record to move to
+                                                    // the staging slots
+
+    mutable int                   d_stagingFront;   // index of the front
+                                                    // staging slot
+
+    mutable int                   d_stagingLength;  // number of records in
+                                                    // the staging slots
+
+    mutable bsl::shared_ptr<Record>
+                                  d_frontRecord;    // copy of the front
+                                                    // record, if loaded
+
+    mutable bsl::shared_ptr<Record>
+                                  d_backRecord;     // copy of the back
+                                                    // record, if loaded
+
+    bslma::Allocator             *d_allocator_p;    // memory allocator (held,
+                                                    // not owned)
+
+    // NOT IMPLEMENTED
+    RingRecordBuffer(const RingRecordBuffer&);
+    RingRecordBuffer& operator=(const RingRecordBuffer&);
+
+    // PRIVATE MANIPULATORS
+    void init(int maxTotalSize, int maxRecordSize);
+        // Allocate the slots of this buffer such that their total size does
+        // not exceed the specified 'maxTotalSize' and each slot has a size of
+        // at least the specified 'maxRecordSize'.
+
+    // PRIVATE ACCESSORS
+    void drain() const;
+        // Move the records pushed at the back of this buffer since the last
+        // call to this method to the back of the staging slots, removing the
+        // records at the front of the staging slots as needed.  Note that
+        // this method must be invoked with 'd_mutex' locked.
+
+    void lock() const;
+        // Lock 'd_mutex' and, if it was not already locked by the calling
+        // thread, 'drain' this buffer.
+
+    void unlock() const;
+        // Unlock 'd_mutex'.  The behavior is undefined unless 'd_mutex' is
+        // locked by the calling thread.
+
+    char *stagingSlot(int index) const;
+        // Return the address of the staging slot holding the record at the
+        // specified 'index' from the front of the buffer.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RingRecordBuffer,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit RingRecordBuffer(int               maxTotalSize,
+                              bslma::Allocator *basicAllocator = 0);
+    RingRecordBuffer(int               maxTotalSize,
+                     int               maxRecordSize,
+                     bslma::Allocator *basicAllocator = 0);
+        // Create a ring record buffer such that the memory allocated for its
+        // slots does not exceed the specified 'maxTotalSize' (unless that
+        // size cannot accommodate a single record), and each record it holds
+        // has a serialized size of at most the optionally specified
+        // 'maxRecordSize' bytes.  If 'maxRecordSize' is not specified,
+        // 'k_DEFAULT_MAX_RECORD_SIZE' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 < maxTotalSize' and '0 < maxRecordSize'.
+
+    virtual ~RingRecordBuffer();
+        // Remove all records from this record buffer and destroy this record
+        // buffer.
+
+    // MANIPULATORS
+    virtual void beginSequence();
+        // *Lock* this record buffer so that a sequence of method invocations
+        // on this record buffer can occur uninterrupted by other threads.  The
+        // buffer will remain *locked* until 'endSequence' is called.  It is
+        // valid to invoke other methods on this record buffer between the
+        // calls to 'beginSequence' and 'endSequence' (the implementation
+        // guarantees this by employing a recursive mutex).  Note that records
+        // pushed at the back of this buffer by other threads while it is
+        // locked are not accessible until it is next locked.
+
+    virtual void endSequence();
+        // *Unlock* this record buffer, thus allowing other threads to access
+        // it.  The behavior is undefined unless the buffer is already *locked*
+        // by 'beginSequence'.
+
+    virtual void popBack();
+        // Remove from this record buffer the record positioned at the back
+        // end of the buffer.  The behavior is undefined unless
+        // '0 < length()'.
+
+    virtual void popFront();
+        // Remove from this record buffer the record positioned at the front
+        // end of the buffer.  The behavior is undefined unless
+        // '0 < length()'.
+
+    virtual int pushBack(const bsl::shared_ptr<Record>& handle);
+        // Store a copy of the record referred to by the specified 'handle' at
+        // the back end of this record buffer.  Return 0 on success, and a
+        // non-zero value otherwise.  This method is equivalent to
+        // 'pushBackCopy(*handle)'.
+
+    virtual int pushBackCopy(const Record& record);
+        // Store a copy of the specified 'record' at the back end of this
+        // record buffer, removing the record at the front end of the buffer
+        // if it is full.  Return 0 on success, and a non-zero value if
+        // 'record' cannot be accommodated in a slot (see {Record Size}), or if
+        // the slot to which it would be written is still being written by
+        // another thread.  This method neither allocates memory nor acquires
+        // a lock.
+
+    virtual int pushFront(const bsl::shared_ptr<Record>& handle);
+        // Store a copy of the record referred to by the specified 'handle' at
+        // the front end of this record buffer.  Return 0 on success, and a
+        // non-zero value if the record cannot be accommodated in a slot, or
+        // if the buffer is full.
+
+    virtual void removeAll();
+        // Remove all records stored in this record buffer.  Note that
+        // 'length()' is now 0.
+
+    // ACCESSORS
+    virtual const bsl::shared_ptr<Record>& back() const;
+        // Return a reference of the shared pointer referring to a copy of the
+        // record positioned at the back end of this record buffer.  The
+        // behavior is undefined unless this record buffer has been locked by
+        // the 'beginSequence' method and unless '0 < length()'.
+
+    virtual const bsl::shared_ptr<Record>& front() const;
+        // Return a reference of the shared pointer referring to a copy of the
+        // record positioned at the front end of this record buffer.  The
+        // behavior is undefined unless this record buffer has been locked by
+        // the 'beginSequence' method and unless '0 < length()'.
+
+    virtual int length() const;
+        // Return the number of records in this record buffer.
+
+    int capacity() const;
+        // Return the maximum number of records this record buffer can hold.
+
+    int maxRecordSize() const;
+        // Return the maximum size of a serialized record held by this record
+        // buffer.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class RingRecordBuffer
+                           // ----------------------
+
+// PRIVATE ACCESSORS
+inline
+void RingRecordBuffer::unlock() const
+{
+    --d_lockDepth;
+    d_mutex.unlock();
+}
+
+inline
+char *RingRecordBuffer::stagingSlot(int index) const
+{
+    return d_staging_p + static_cast<bsls::Types::Int64>(
+                     (d_stagingFront + index) % d_numSlots) * d_slotSize;
+}
+
+// MANIPULATORS
+inline
+void RingRecordBuffer::beginSequence()
+{
+    lock();
+}
+
+inline
+void RingRecordBuffer::endSequence()
+{
+    unlock();
+}
+
+inline
+int RingRecordBuffer::pushBack(const bsl::shared_ptr<Record>& handle)
+{
+    return pushBackCopy(*handle);
+}
+
+// ACCESSORS
+inline
+int RingRecordBuffer::capacity() const
+{
+    return d_numSlots;
+}
+
+inline
+int RingRecordBuffer::maxRecordSize() const
+{
+    return d_slotSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
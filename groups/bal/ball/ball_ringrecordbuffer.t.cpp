@@ -0,0 +1,970 @@
+// ball_ringrecordbuffer.t.cpp                                        -*-C++-*-
+#include <ball_ringrecordbuffer.h>
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_userfields.h>
+
+#include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>     // atoi()
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a record buffer storing serialized copies of
+// records in fixed-size slots.  We verify that the records read from the
+// buffer have the value of the records stored, that the buffer behaves as a
+// double-ended queue of bounded capacity that overwrites its oldest records,
+// that storing a record at the back does not allocate memory, and that
+// records stored concurrently by multiple threads are read back intact,
+// including those stored after a record that is still being written.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit RingRecordBuffer(int maxTotalSize, Allocator *ba = 0);
+// [ 2] RingRecordBuffer(int maxTotalSize, int maxRecordSize, Allocator *);
+// [ 2] virtual ~RingRecordBuffer();
+//
+// MANIPULATORS
+// [ 4] virtual void beginSequence();
+// [ 4] virtual void endSequence();
+// [ 4] virtual void popBack();
+// [ 4] virtual void popFront();
+// [ 3] virtual int pushBack(const bsl::shared_ptr<Record>& handle);
+// [ 3] virtual int pushBackCopy(const Record& record);
+// [ 4] virtual int pushFront(const bsl::shared_ptr<Record>& handle);
+// [ 4] virtual void removeAll();
+//
+// ACCESSORS
+// [ 3] virtual const bsl::shared_ptr<Record>& back() const;
+// [ 3] virtual const bsl::shared_ptr<Record>& front() const;
+// [ 4] virtual int length() const;
+// [ 2] int capacity() const;
+// [ 2] int maxRecordSize() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENT PUSHES
+// [ 7] CONCERN: RECORDS FOLLOWING A RECORD BEING WRITTEN ARE DRAINED
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::RingRecordBuffer Obj;
+
+enum { k_SLOT_OVERHEAD = 8 };  // size of the sequence number of a slot
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+int totalSize(int numRecords, int maxRecordSize)
+    // Return the maximum total size of a buffer having a capacity of the
+    // specified 'numRecords' records of the specified 'maxRecordSize'.
+{
+    return numRecords * (2 * maxRecordSize + k_SLOT_OVERHEAD);
+}
+
+static
+void setMessage(ball::Record *record, int value)
+    // Set the message of the specified 'record' to a string representation
+    // of the specified 'value'.
+{
+    char buffer[32];
+    bsl::sprintf(buffer, "message %d", value);
+    record->fixedFields().setMessage(buffer);
+}
+
+static
+bsl::string messageOf(const bsl::shared_ptr<ball::Record>& handle)
+    // Return the message of the record referred to by the specified 'handle'.
+{
+    return handle->fixedFields().messageRef();
+}
+
+//=============================================================================
+//                          CONCURRENCY TEST SUPPORT
+//-----------------------------------------------------------------------------
+
+namespace CONCURRENCY {
+
+enum {
+    k_NUM_THREADS    = 4,
+    k_NUM_ITERATIONS = 20000
+};
+
+Obj                *buffer;
+bslmt::Barrier     *barrier;
+bsls::AtomicInt     numStored(0);
+bsls::AtomicInt     numFinished(0);
+
+extern "C" void *writerThread(void *arg)
+    // Store 'k_NUM_ITERATIONS' records, whose message and user fields identify
+    // the thread and the iteration, in 'buffer'.
+{
+    const int id = static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(
+                                                                        arg));
+
+    ball::Record record;
+    record.fixedFields().setCategory("CONCURRENCY");
+    record.fixedFields().setThreadID(id);
+
+    barrier->wait();
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        char message[64];
+        bsl::sprintf(message, "thread %d iteration %d", id, i);
+        record.fixedFields().setMessage(message);
+        record.fixedFields().setLineNumber(i);
+
+        record.customFields().removeAll();
+        record.customFields().appendInt64(id);
+        record.customFields().appendInt64(i);
+
+        if (0 == buffer->pushBackCopy(record)) {
+            ++numStored;
+        }
+    }
+    ++numFinished;
+    return 0;
+}
+
+}  // close namespace CONCURRENCY
+
+//=============================================================================
+//                         IN-FLIGHT RECORD TEST SUPPORT
+//-----------------------------------------------------------------------------
+
+namespace IN_FLIGHT {
+
+// The stamp of a slot, held in an array of 'bsls::AtomicInt64' at the start
+// of the memory allocated by a buffer, encodes the sequence number of the
+// record last written to the slot and the state of the slot (see the
+// implementation notes of the component).
+
+enum {
+    k_WRITING = 1,  // a record is being written to the slot
+    k_READY   = 2   // the slot holds a record
+};
+
+bsls::Types::Int64 makeStamp(bsls::Types::Int64 sequence, int state)
+    // Return the stamp of a slot holding the record having the specified
+    // 'sequence' number in the specified 'state'.
+{
+    return (sequence + 1) * 4 + state;
+}
+
+struct PublisherArgs {
+    // This 'struct' holds the arguments and results of 'publisherThread'.
+
+    Obj                      *d_buffer_p;    // buffer to push to and drain
+    int                       d_value;       // value of the record to push
+    bsl::vector<bsl::string>  d_messages;    // messages read from the buffer
+};
+
+extern "C" void *publisherThread(void *arg)
+    // Push a record whose message identifies the 'd_value' of the specified
+    // 'arg' to its buffer, then lock the buffer and pop every record from its
+    // front, appending their messages to the 'd_messages' of 'arg'.
+{
+    PublisherArgs *args = static_cast<PublisherArgs *>(arg);
+
+    ball::Record record;
+    setMessage(&record, args->d_value);
+    ASSERT(0 == args->d_buffer_p->pushBackCopy(record));
+
+    args->d_buffer_p->beginSequence();
+    while (0 < args->d_buffer_p->length()) {
+        args->d_messages.push_back(messageOf(args->d_buffer_p->front()));
+        args->d_buffer_p->popFront();
+    }
+    args->d_buffer_p->endSequence();
+
+    return 0;
+}
+
+}  // close namespace IN_FLIGHT
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test                = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose             = argc > 2;
+    const bool veryVerbose         = argc > 3;
+    const bool veryVeryVerbose     = argc > 4;
+    const bool veryVeryVeryVerbose = argc > 5;
+
+    (void) veryVerbose;      // Supress compiler warning.
+    (void) veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCERN: RECORDS FOLLOWING A RECORD BEING WRITTEN ARE DRAINED
+        //
+        // Concerns:
+        //: 1 A record pushed by a thread is part of the buffer when that
+        //:   thread next locks the buffer, even if a record pushed earlier by
+        //:   another thread is still being written.
+        //:
+        //: 2 The record that was being written is part of the buffer when it
+        //:   is next locked after the record is written, and is read back at
+        //:   most once.
+        //
+        // Plan:
+        //: 1 Push a record, and change the stamp of its slot to the writing
+        //:   state of its sequence number, as if its writer had not finished
+        //:   writing it.  In another thread, push a second record, then lock
+        //:   the buffer and pop every record from its front.  Verify that the
+        //:   second record, and only that record, was read.  (C-1)
+        //:
+        //: 2 Restore the ready state of the first slot, as its writer would,
+        //:   and pop every record from the front of the buffer.  Verify that
+        //:   the first record, and only that record, is read, and that the
+        //:   buffer is then empty.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: RECORDS FOLLOWING A RECORD BEING WRITTEN ARE DRAINED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: RECORDS FOLLOWING A RECORD BEING "
+                             "WRITTEN ARE DRAINED"
+                          << "\n========================================="
+                             "===================" << endl;
+
+        using namespace IN_FLIGHT;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(totalSize(4, 256), 256, &ta);  const Obj& X = mX;
+        ASSERT(4 == X.capacity());
+
+        bsls::AtomicInt64 *stamps = static_cast<bsls::AtomicInt64 *>(
+                                                   ta.lastAllocatedAddress());
+
+        ball::Record record;
+        setMessage(&record, 0);
+        ASSERT(0 == mX.pushBackCopy(record));
+        ASSERTV(stamps[0].load(), makeStamp(0, k_READY) == stamps[0].load());
+
+        if (veryVerbose) cout << "\tHold the first slot being written."
+                              << endl;
+
+        stamps[0].storeRelease(makeStamp(0, k_WRITING));
+
+        PublisherArgs args;
+        args.d_buffer_p = &mX;
+        args.d_value    = 1;
+
+        bslmt::ThreadUtil::Handle handle;
+        ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                              publisherThread,
+                                              &args));
+        ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+        ASSERTV(args.d_messages.size(), 1 == args.d_messages.size());
+        if (1 == args.d_messages.size()) {
+            ASSERTV(args.d_messages[0], "message 1" == args.d_messages[0]);
+        }
+
+        if (veryVerbose) cout << "\tFinish writing the first slot." << endl;
+
+        stamps[0].storeRelease(makeStamp(0, k_READY));
+
+        bsl::vector<bsl::string> messages;
+
+        mX.beginSequence();
+        while (0 < mX.length()) {
+            messages.push_back(messageOf(mX.front()));
+            mX.popFront();
+        }
+        mX.endSequence();
+
+        ASSERTV(messages.size(), 1 == messages.size());
+        if (1 == messages.size()) {
+            ASSERTV(messages[0], "message 0" == messages[0]);
+        }
+
+        ASSERT(0 == X.length());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+        ball::RingRecordBuffer buffer(4 * (2 * 256 + 8), 256);
+        ASSERT(4 == buffer.capacity());
+
+        ball::Record record;
+        record.fixedFields().setCategory("MyCategory");
+        record.fixedFields().setSeverity(ball::Severity::e_TRACE);
+
+        for (int i = 0; i < 6; ++i) {
+            bsl::ostringstream message;
+            message << "message " << i;
+            record.fixedFields().setMessage(message.str().c_str());
+
+            int rc = buffer.pushBackCopy(record);
+            ASSERT(0 == rc);
+        }
+
+        buffer.beginSequence();
+        ASSERT(4 == buffer.length());
+
+        ASSERT(bsl::string("message 2") ==
+                                  buffer.front()->fixedFields().messageRef());
+
+        while (0 < buffer.length()) {
+            if (verbose) {
+                bsl::cout << buffer.front()->fixedFields().message()
+                          << bsl::endl;
+            }
+            buffer.popFront();
+        }
+        buffer.endSequence();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENT PUSHES
+        //
+        // Concerns:
+        //: 1 Records stored concurrently by multiple threads are read back
+        //:   intact, while the buffer is concurrently drained.
+        //:
+        //: 2 The records stored by a given thread are read back in the order
+        //:   in which they were stored.
+        //:
+        //: 3 Every record stored is read back at most once.
+        //
+        // Plan:
+        //: 1 Store records identifying their thread and iteration from
+        //:   several threads, while repeatedly popping every record from the
+        //:   front of the buffer in the main thread.  Verify that the fields
+        //:   of each record popped are consistent, and that the iterations of
+        //:   the records of a thread are increasing.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENT PUSHES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCURRENT PUSHES"
+                          << "\n=================" << endl;
+
+        using namespace CONCURRENCY;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj            mX(totalSize(64, 256), 256, &ta);
+        bslmt::Barrier mBarrier(k_NUM_THREADS + 1);
+
+        buffer  = &mX;
+        barrier = &mBarrier;
+
+        bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            void *arg = reinterpret_cast<void *>(
+                                         static_cast<bsls::Types::IntPtr>(i));
+            ASSERT(0 == bslmt::ThreadUtil::create(&threads[i],
+                                                  writerThread,
+                                                  arg));
+        }
+
+        int lastIteration[k_NUM_THREADS];
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            lastIteration[i] = -1;
+        }
+
+        int numRead = 0;
+
+        mBarrier.wait();
+        for (bool done = false; !done; ) {
+            done = k_NUM_THREADS == numFinished;
+
+            mX.beginSequence();
+            while (0 < mX.length()) {
+                const ball::Record& record = *mX.front();
+
+                const int id = static_cast<int>(
+                                             record.fixedFields().threadID());
+                const int iteration = record.fixedFields().lineNumber();
+
+                ASSERTV(id, 0 <= id && id < k_NUM_THREADS);
+                if (0 <= id && id < k_NUM_THREADS) {
+                    ASSERTV(id, iteration, lastIteration[id],
+                            lastIteration[id] < iteration);
+                    lastIteration[id] = iteration;
+                }
+
+                char message[64];
+                bsl::sprintf(message, "thread %d iteration %d", id, iteration);
+                ASSERTV(message, record.fixedFields().message(),
+                        bsl::string(message) ==
+                                           record.fixedFields().messageRef());
+
+                ASSERT(bsl::string("CONCURRENCY") ==
+                                             record.fixedFields().category());
+                ASSERT(2         == record.customFields().length());
+                ASSERT(id        == record.customFields()[0].theInt64());
+                ASSERT(iteration == record.customFields()[1].theInt64());
+
+                mX.popFront();
+                ++numRead;
+            }
+            mX.endSequence();
+
+            bslmt::ThreadUtil::yield();
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(threads[i]));
+        }
+
+        if (veryVerbose) {
+            P_(numStored) P(numRead)
+        }
+        ASSERTV(numRead, numStored, numRead <= numStored);
+        ASSERT(0 < numRead);
+        ASSERT(0 == mX.length());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING DOUBLE-ENDED QUEUE OPERATIONS
+        //
+        // Concerns:
+        //: 1 Records are read from the front and back of the buffer in the
+        //:   order in which they were pushed, and 'popFront' and 'popBack'
+        //:   remove the respective record.
+        //:
+        //: 2 Once the buffer holds 'capacity()' records, pushing a record at
+        //:   the back removes the record at the front.
+        //:
+        //: 3 'pushFront' stores a record at the front, and fails if the buffer
+        //:   is full.
+        //:
+        //: 4 Records pushed at the back during a sequence do not change the
+        //:   contents of the buffer until the end of the sequence.
+        //:
+        //: 5 'removeAll' removes every record.
+        //
+        // Plan:
+        //: 1 Push records at both ends of the buffer, and verify the results
+        //:   of 'length', 'front', and 'back' after each operation.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   virtual void beginSequence();
+        //   virtual void endSequence();
+        //   virtual void popBack();
+        //   virtual void popFront();
+        //   virtual int pushFront(const bsl::shared_ptr<Record>& handle);
+        //   virtual void removeAll();
+        //   virtual int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING DOUBLE-ENDED QUEUE OPERATIONS"
+                          << "\n=====================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(totalSize(4, 128), 128, &ta);  const Obj& X = mX;
+        ASSERT(4 == X.capacity());
+
+        ball::Record record(&ta);
+
+        if (verbose) cout << "\tPush, pop, and overwrite." << endl;
+        {
+            for (int i = 0; i < 3; ++i) {
+                setMessage(&record, i);
+                ASSERT(0 == mX.pushBackCopy(record));
+                ASSERTV(i, i + 1 == X.length());
+            }
+
+            mX.beginSequence();
+            ASSERT("message 0" == messageOf(X.front()));
+            ASSERT("message 2" == messageOf(X.back()));
+            mX.popBack();
+            ASSERT(2 == X.length());
+            ASSERT("message 1" == messageOf(X.back()));
+            mX.popFront();
+            ASSERT(1 == X.length());
+            ASSERT("message 1" == messageOf(X.front()));
+            ASSERT("message 1" == messageOf(X.back()));
+            mX.endSequence();
+
+            for (int i = 3; i < 10; ++i) {
+                setMessage(&record, i);
+                ASSERT(0 == mX.pushBackCopy(record));
+            }
+
+            mX.beginSequence();
+            ASSERT(4 == X.length());
+            ASSERT("message 6" == messageOf(X.front()));
+            ASSERT("message 9" == messageOf(X.back()));
+            mX.endSequence();
+        }
+
+        if (verbose) cout << "\tPush at the back during a sequence." << endl;
+        {
+            mX.beginSequence();
+            ASSERT(4 == X.length());
+
+            setMessage(&record, 10);
+            ASSERT(0 == mX.pushBackCopy(record));
+
+            ASSERT(4 == X.length());
+            ASSERT("message 9" == messageOf(X.back()));
+            mX.endSequence();
+
+            mX.beginSequence();
+            ASSERT(4 == X.length());
+            ASSERT("message 7"  == messageOf(X.front()));
+            ASSERT("message 10" == messageOf(X.back()));
+            mX.endSequence();
+        }
+
+        if (verbose) cout << "\tPush at the front." << endl;
+        {
+            bsl::shared_ptr<ball::Record> handle;
+            handle.createInplace(&ta, &ta);
+            setMessage(handle.get(), 100);
+
+            ASSERT(0 != mX.pushFront(handle));  // full
+            ASSERT(4 == X.length());
+
+            mX.popFront();
+            mX.popFront();
+            ASSERT(2 == X.length());
+
+            ASSERT(0 == mX.pushFront(handle));
+            ASSERT(3 == X.length());
+
+            mX.beginSequence();
+            ASSERT("message 100" == messageOf(X.front()));
+            ASSERT("message 10"  == messageOf(X.back()));
+            mX.popFront();
+            ASSERT("message 9"   == messageOf(X.front()));
+            mX.endSequence();
+        }
+
+        if (verbose) cout << "\tRemove all." << endl;
+        {
+            setMessage(&record, 11);
+            ASSERT(0 == mX.pushBackCopy(record));
+            ASSERT(3 == X.length());
+
+            mX.removeAll();
+            ASSERT(0 == X.length());
+
+            setMessage(&record, 12);
+            ASSERT(0 == mX.pushBackCopy(record));
+            ASSERT(1 == X.length());
+
+            mX.beginSequence();
+            ASSERT("message 12" == messageOf(X.front()));
+            mX.endSequence();
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING RECORD COPIES
+        //
+        // Concerns:
+        //: 1 The records read from the buffer have the value of the records
+        //:   stored, including every type of user field.
+        //:
+        //: 2 'pushBack' stores a copy of the record referred to by its handle.
+        //:
+        //: 3 A message that does not fit in a slot is truncated.
+        //:
+        //: 4 A record whose attributes other than its message do not fit in
+        //:   a slot is rejected.
+        //:
+        //: 5 Storing a record neither allocates memory from the object
+        //:   allocator nor from the default allocator.
+        //:
+        //: 6 The records returned by 'front' and 'back' are not allocated
+        //:   from the default allocator, and remain valid after they are
+        //:   removed from the buffer.
+        //
+        // Plan:
+        //: 1 Store records having each type of user field, read them, and
+        //:   compare them with the original records.  (C-1..2, 6)
+        //:
+        //: 2 Store records having long messages and user fields.  (C-3..4)
+        //:
+        //: 3 Verify the number of allocations of the object and default
+        //:   allocators around 'pushBackCopy'.  (C-5)
+        //
+        // Testing:
+        //   virtual int pushBack(const bsl::shared_ptr<Record>& handle);
+        //   virtual int pushBackCopy(const Record& record);
+        //   virtual const bsl::shared_ptr<Record>& back() const;
+        //   virtual const bsl::shared_ptr<Record>& front() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING RECORD COPIES"
+                          << "\n=====================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tRound trip of every attribute." << endl;
+        {
+            Obj mX(totalSize(8, 512), 512, &ta);  const Obj& X = mX;
+
+            bsl::shared_ptr<ball::Record> handle;
+            handle.createInplace(&sa, &sa);
+
+            ball::RecordAttributes& fixed = handle->fixedFields();
+            fixed.setTimestamp(bdlt::Datetime(2026, 10, 16, 12, 34, 56, 789));
+            fixed.setProcessID(1234);
+            fixed.setThreadID(0x123456789ULL);
+            fixed.setFileName("ball_ringrecordbuffer.t.cpp");
+            fixed.setLineNumber(42);
+            fixed.setCategory("RING.TEST");
+            fixed.setSeverity(ball::Severity::e_WARN);
+            fixed.setMessage("a message");
+
+            bsl::vector<char> array(&sa);
+            array.push_back('a');
+            array.push_back('\0');
+            array.push_back('b');
+
+            ball::UserFields& fields = handle->customFields();
+            fields.appendNull();
+            fields.appendInt64(-17);
+            fields.appendDouble(1.5);
+            fields.appendString("a string");
+            fields.appendDatetimeTz(bdlt::DatetimeTz(
+                                           bdlt::Datetime(2000, 1, 2, 3, 4, 5),
+                                           -300));
+            fields.appendCharArray(array);
+            fields.appendString("");
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+            const bsls::Types::Int64 numDefault     =
+                                           defaultAllocator.numAllocations();
+
+            ASSERT(0 == mX.pushBack(handle));
+            ASSERT(0 == mX.pushBackCopy(*handle));
+
+            ASSERT(numAllocations == ta.numAllocations());
+            ASSERT(numDefault     == defaultAllocator.numAllocations());
+
+            bsl::shared_ptr<ball::Record> front, back;
+
+            mX.beginSequence();
+            ASSERT(2 == X.length());
+
+            front = X.front();
+            back  = X.back();
+            ASSERT(front != back);
+            ASSERT(front == X.front());
+
+            ASSERT(*handle == *front);
+            ASSERT(*handle == *back);
+            ASSERT(numDefault == defaultAllocator.numAllocations());
+
+            mX.popFront();
+            mX.popBack();
+            ASSERT(0 == X.length());
+            mX.endSequence();
+
+            ASSERT(*handle == *front);
+            ASSERT(*handle == *back);
+        }
+
+        if (verbose) cout << "\tTruncated message." << endl;
+        {
+            Obj mX(totalSize(2, 256), 256, &ta);  const Obj& X = mX;
+            ASSERT(256 == X.maxRecordSize());
+
+            ball::Record record(&sa);
+            record.fixedFields().setCategory("TRUNCATED");
+            record.fixedFields().setFileName("file.cpp");
+
+            const bsl::string message(1000, 'x', &sa);
+            record.fixedFields().setMessage(message.c_str());
+
+            ASSERT(0 == mX.pushBackCopy(record));
+
+            mX.beginSequence();
+            ASSERT(1 == X.length());
+
+            const bsl::string copy = messageOf(X.front());
+            ASSERTV(copy.length(), 0 < copy.length());
+            ASSERTV(copy.length(), copy.length() < 256);
+            ASSERT(copy == message.substr(0, copy.length()));
+            ASSERT(bsl::string("TRUNCATED") ==
+                                        X.front()->fixedFields().category());
+            mX.endSequence();
+        }
+
+        if (verbose) cout << "\tRejected record." << endl;
+        {
+            Obj mX(totalSize(2, 256), 256, &ta);  const Obj& X = mX;
+
+            ball::Record record(&sa);
+            record.customFields().appendString(bsl::string(300, 'y', &sa));
+
+            ASSERT(0 != mX.pushBackCopy(record));
+            ASSERT(0 == X.length());
+
+            record.customFields().removeAll();
+            ASSERT(0 == mX.pushBackCopy(record));
+            ASSERT(1 == X.length());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS AND CAPACITY
+        //
+        // Concerns:
+        //: 1 The capacity of the buffer is the number of slots that fit in
+        //:   the maximum total size, and is at least 1.
+        //:
+        //: 2 The memory allocated by the buffer does not exceed the maximum
+        //:   total size, and is allocated from the supplied allocator.
+        //:
+        //: 3 The default maximum record size is 'k_DEFAULT_MAX_RECORD_SIZE'.
+        //:
+        //: 4 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Create buffers of various sizes and verify 'capacity',
+        //:   'maxRecordSize', and the memory in use by the object allocator.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   explicit RingRecordBuffer(int maxTotalSize, Allocator *ba = 0);
+        //   RingRecordBuffer(int maxTotalSize, int maxRecordSize, Alloc *);
+        //   virtual ~RingRecordBuffer();
+        //   int capacity() const;
+        //   int maxRecordSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING CREATORS AND CAPACITY"
+                          << "\n=============================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_maxTotalSize;
+            int d_maxRecordSize;
+            int d_capacity;
+        } DATA[] = {
+            //LINE  TOTAL                  RECORD  CAPACITY
+            //----  ---------------------  ------  --------
+            { L_,                      1,    128,        1 },
+            { L_,     totalSize(1, 128),    128,        1 },
+            { L_, totalSize(2, 128) - 1,    128,        1 },
+            { L_,     totalSize(2, 128),    128,        2 },
+            { L_,                 32768,    512,       31 },
+            { L_,                 32768,     64,      240 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int TOTAL    = DATA[ti].d_maxTotalSize;
+            const int RECORD   = DATA[ti].d_maxRecordSize;
+            const int CAPACITY = DATA[ti].d_capacity;
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(TOTAL, RECORD, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, CAPACITY, X.capacity(),
+                        CAPACITY == X.capacity());
+                ASSERTV(LINE, RECORD == X.maxRecordSize());
+                ASSERTV(LINE, 0 == X.length());
+                ASSERTV(LINE, 1 == ta.numBlocksInUse());
+                ASSERTV(LINE, TOTAL, ta.numBytesInUse(),
+                        TOTAL < totalSize(1, RECORD)
+                                            || ta.numBytesInUse() <= TOTAL);
+                ASSERTV(LINE, 0 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            Obj mX(32768, &ta);  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_MAX_RECORD_SIZE == X.maxRecordSize());
+            ASSERT(32768 / totalSize(1, Obj::k_DEFAULT_MAX_RECORD_SIZE)
+                                                              == X.capacity());
+        }
+        {
+            Obj mX(32768);  const Obj& X = mX;
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+            ASSERT(0 == X.length());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Store a few records, and read them back from both ends.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(8192, &ta);  const Obj& X = mX;
+        ASSERT(0 == X.length());
+
+        ball::Record record(&ta);
+        record.fixedFields().setCategory("BREATHING");
+
+        setMessage(&record, 1);
+        ASSERT(0 == mX.pushBackCopy(record));
+        setMessage(&record, 2);
+        ASSERT(0 == mX.pushBackCopy(record));
+        ASSERT(2 == X.length());
+
+        mX.beginSequence();
+        ASSERT("message 1" == messageOf(X.front()));
+        ASSERT("message 2" == messageOf(X.back()));
+        mX.popBack();
+        ASSERT("message 1" == messageOf(X.back()));
+        mX.popBack();
+        ASSERT(0 == X.length());
+        mX.endSequence();
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
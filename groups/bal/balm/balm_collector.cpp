@@ -12,12 +12,116 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collector_cpp,"$Id$ $CSID$")
 
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
+#include <new>
+
 namespace BloombergLP {
+namespace balm {
+
+BSLMF_ASSERT(sizeof(Collector_Cell) == Collector_Cell::k_CACHE_LINE_SIZE);
 
                               // ---------------
                               // class Collector
                               // ---------------
 
+// PRIVATE MANIPULATORS
+void Collector::resetAll()
+{
+    for (int i = 0; i <= d_cellMask; ++i) {
+        d_cells_p[i].reset();
+    }
+}
+
+// PRIVATE ACCESSORS
+void Collector::lockAll() const
+{
+    for (int i = 0; i <= d_cellMask; ++i) {
+        d_cells_p[i].d_lock.lock();
+    }
+}
+
+void Collector::unlockAll() const
+{
+    for (int i = 0; i <= d_cellMask; ++i) {
+        d_cells_p[i].d_lock.unlock();
+    }
+}
+
+void Collector::merge(MetricRecord *record) const
+{
+    // Start from the first cell, which holds the values supplied to
+    // 'setCountTotalMinMax', so that those values are loaded unchanged when
+    // no other cell has been updated.
+
+    record->metricId() = d_metricId;
+    record->count()    = d_cells_p[0].d_count;
+    record->total()    = d_cells_p[0].d_total;
+    record->min()      = d_cells_p[0].d_min;
+    record->max()      = d_cells_p[0].d_max;
+
+    for (int i = 1; i <= d_cellMask; ++i) {
+        const Collector_Cell& cell = d_cells_p[i];
+
+        record->count() += cell.d_count;
+        record->total() += cell.d_total;
+        record->min()   =  bsl::min(record->min(), cell.d_min);
+        record->max()   =  bsl::max(record->max(), cell.d_max);
+    }
+}
+
+// CREATORS
+Collector::Collector(const MetricId&   metricId,
+                     bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_buffer_p(0)
+, d_cells_p(0)
+, d_cellMask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Use one cell per concurrent thread supported by the host, up to
+    // 'k_MAX_NUM_CELLS', and over-allocate by enough to align the cells on a
+    // cache line, which the allocator does not guarantee.
+
+    const unsigned int concurrency = bslmt::ThreadUtil::hardwareConcurrency();
+
+    int numCells = 1;
+    while (numCells < k_MAX_NUM_CELLS
+        && static_cast<unsigned int>(numCells) < concurrency) {
+        numCells *= 2;
+    }
+
+    d_buffer_p = d_allocator_p->allocate(
+                                   numCells * sizeof(Collector_Cell)
+                                   + Collector_Cell::k_CACHE_LINE_SIZE - 1);
+
+    char *cells = static_cast<char *>(d_buffer_p)
+                + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                          d_buffer_p,
+                                          Collector_Cell::k_CACHE_LINE_SIZE);
+
+    d_cells_p  = reinterpret_cast<Collector_Cell *>(cells);
+    d_cellMask = numCells - 1;
+
+    BSLS_ASSERT(0 == reinterpret_cast<bsls::Types::UintPtr>(d_cells_p)
+                                          % Collector_Cell::k_CACHE_LINE_SIZE);
+
+    for (int i = 0; i < numCells; ++i) {
+        new (d_cells_p + i) Collector_Cell();
+    }
+}
+
+Collector::~Collector()
+{
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+}  // close package namespace
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
@@ -45,6 +45,25 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // operations on a given instance can be safely invoked simultaneously from
 // multiple threads.
 //
+///Performance
+///-----------
+// A 'balm::Collector' distributes its aggregated values over a number of
+// cells, each occupying its own cache line and guarded by its own spin lock,
+// and 'update' and 'accumulateCountTotalMinMax' lock only the cell selected by
+// a hash of the identifier of the calling thread.  Threads updating the same
+// collector contend only when their identifiers select the same cell.  The
+// cells are merged by 'load' and 'loadAndReset' (i.e., when metrics are
+// published), which lock every cell, so these operations are more expensive
+// than 'update'.
+//
+// The number of cells is the number of concurrent threads supported by the
+// host (see 'bslmt::ThreadUtil::hardwareConcurrency'), rounded up to a power
+// of two, but at most 16.  The cells are allocated, from the allocator
+// supplied at construction, as a single block of one cache line (64 bytes)
+// per cell, plus the slack needed to align that block on a cache line;
+// e.g., a collector on a host supporting 16 or more concurrent threads
+// allocates 1087 bytes.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::Collector', modifies its values, then
@@ -85,8 +104,15 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 #include <balm_metricrecord.h>
 #include <balm_metricid.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_spinlock.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 
@@ -95,6 +121,46 @@ namespace BloombergLP {
 
 namespace balm {
 
+                            // ====================
+                            // class Collector_Cell
+                            // ====================
+
+struct Collector_Cell {
+    // This component-private 'struct' provides the aggregated values of a
+    // metric updated by a subset of the threads updating a 'Collector',
+    // along with the lock synchronizing access to them.  Each cell is padded
+    // to the size of a cache line, and 'Collector' aligns its cells on cache
+    // line boundaries, so that threads updating different cells of a
+    // collector do not contend.
+
+    // PUBLIC TYPES
+    enum { k_CACHE_LINE_SIZE = 64 };  // assumed size of a cache line
+
+    // PUBLIC DATA
+    bsls::SpinLock d_lock;   // synchronizes access to the other members
+    int            d_count;  // aggregated count of events
+    double         d_total;  // total of values across events
+    double         d_min;    // minimum value across events
+    double         d_max;    // maximum value across events
+    char           d_padding[k_CACHE_LINE_SIZE
+                           - sizeof(bsls::SpinLock)
+                           - sizeof(int)
+                           - 3 * sizeof(double)];
+                             // pad to a cache line
+
+    // CREATORS
+    Collector_Cell();
+        // Create a cell having a count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', and max of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum values of this cell to
+        // their default states.  The behavior is undefined unless the calling
+        // thread holds 'd_lock'.
+};
+
                               // ===============
                               // class Collector
                               // ===============
@@ -102,28 +168,83 @@ namespace balm {
 class Collector {
     // This class provides a mechanism for collecting and aggregating the
     // value of a metric over a period of time.  The collector contains a
-    // 'MetricRecord' object that holds the identity of the metric being
-    // collected, the number of times an event occurred, and the total,
+    // 'MetricId' object identifying the metric being collected, and
+    // aggregates the number of times an event occurred, and the total,
     // minimum, and maximum aggregates of the associated measurement value.
     // The default value for the count is 0, the default value for the total
     // is 0.0, the default minimum value is 'MetricRecord::k_DEFAULT_MIN', and
     // the default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
+    //
+    // The aggregated values are distributed over an array of cells, each
+    // guarded by its own spin lock: 'update' and 'accumulateCountTotalMinMax'
+    // only lock the cell selected by the identifier of the calling thread, so
+    // that threads concurrently updating the same metric rarely contend,
+    // while the other operations lock every cell (always in the same order)
+    // and merge or reset their values, so that they remain atomic with
+    // respect to one another.
+
+    // PRIVATE TYPES
+    enum {
+        k_MAX_NUM_CELLS_LOG2 = 4,                         // log2 of
+                                                          // 'k_MAX_NUM_CELLS'
+
+        k_MAX_NUM_CELLS      = 1 << k_MAX_NUM_CELLS_LOG2  // maximum number of
+                                                          // cells
+    };
 
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricId          d_metricId;     // metric identifier
+
+    void             *d_buffer_p;     // memory holding the cells (owned)
+
+    Collector_Cell   *d_cells_p;      // cache-line-aligned array of cells,
+                                      // within 'd_buffer_p'
+
+    int               d_cellMask;     // number of cells minus one
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
     Collector& operator=(const Collector&);
 
+    // PRIVATE ACCESSORS
+    int cellIndex() const;
+        // Return the index of the cell updated by the calling thread.
+
+    // PRIVATE MANIPULATORS
+    void resetAll();
+        // Reset the values of every cell of this collector to their default
+        // states.  The behavior is undefined unless the calling thread holds
+        // the lock of every cell.
+
+    void lockAll() const;
+        // Acquire the lock of every cell of this collector, in increasing
+        // order of index.
+
+    void unlockAll() const;
+        // Release the lock of every cell of this collector.  The behavior is
+        // undefined unless the calling thread holds the lock of every cell.
+
+    void merge(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the count, total, minimum, and maximum values
+        // aggregated over every cell of this collector.  The behavior is
+        // undefined unless the calling thread holds the lock of every cell.
+
   public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Collector, bslma::UsesBslmaAllocator);
+
      // CREATORS
-    Collector(const MetricId& metricId);
+    Collector(const MetricId&   metricId,
+              bslma::Allocator *basicAllocator = 0);
         // Create a collector for a metric having the specified 'metricId',
         // and having an initial count of 0, total of 0.0, min of
         // 'MetricRecord::k_DEFAULT_MIN', and max of
-        // 'MetricRecord::k_DEFAULT_MAX'.
+        // 'MetricRecord::k_DEFAULT_MAX'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
 
     ~Collector();
         // Destroy this object.
@@ -183,53 +304,79 @@ class Collector {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
-                              // ---------------
-                              // class Collector
-                              // ---------------
+                            // --------------------
+                            // class Collector_Cell
+                            // --------------------
 
 // CREATORS
 inline
-Collector::Collector(const MetricId& metricId)
-: d_record(metricId)
-, d_lock()
+Collector_Cell::Collector_Cell()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_count(0)
+, d_total(0.0)
+, d_min(MetricRecord::k_DEFAULT_MIN)
+, d_max(MetricRecord::k_DEFAULT_MAX)
+{
+}
+
+// MANIPULATORS
+inline
+void Collector_Cell::reset()
 {
+    d_count = 0;
+    d_total = 0.0;
+    d_min   = MetricRecord::k_DEFAULT_MIN;
+    d_max   = MetricRecord::k_DEFAULT_MAX;
 }
 
+                              // ---------------
+                              // class Collector
+                              // ---------------
+
+// PRIVATE ACCESSORS
 inline
-Collector::~Collector()
+int Collector::cellIndex() const
 {
+    // Thread identifiers are typically aligned addresses sharing their
+    // low-order bits, so use the high-order bits of a multiplicative hash of
+    // the identifier.
+
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * k_MULTIPLIER;
+
+    return static_cast<int>(hash >> (64 - k_MAX_NUM_CELLS_LOG2)) & d_cellMask;
 }
 
 // MANIPULATORS
 inline
 void Collector::reset()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    lockAll();
+    resetAll();
+    unlockAll();
 }
 
 inline
 void Collector::loadAndReset(MetricRecord *record)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record          = d_record;
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    lockAll();
+    merge(record);
+    resetAll();
+    unlockAll();
 }
 
 inline
 void Collector::update(double value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    ++d_record.count();
-    d_record.total() += value;
-    d_record.min()   =  bsl::min(d_record.min(), value);
-    d_record.max()   =  bsl::max(d_record.max(), value);
+    Collector_Cell& cell = d_cells_p[cellIndex()];
+
+    bsls::SpinLockGuard guard(&cell.d_lock);
+    ++cell.d_count;
+    cell.d_total += value;
+    cell.d_min   =  bsl::min(cell.d_min, value);
+    cell.d_max   =  bsl::max(cell.d_max, value);
 }
 
 inline
@@ -238,11 +385,13 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() += count;
-    d_record.total() += total;
-    d_record.min()   =  bsl::min(d_record.min(), min);
-    d_record.max()   =  bsl::max(d_record.max(), max);
+    Collector_Cell& cell = d_cells_p[cellIndex()];
+
+    bsls::SpinLockGuard guard(&cell.d_lock);
+    cell.d_count += count;
+    cell.d_total += total;
+    cell.d_min   =  bsl::min(cell.d_min, min);
+    cell.d_max   =  bsl::max(cell.d_max, max);
 }
 
 inline
@@ -251,25 +400,28 @@ void Collector::setCountTotalMinMax(int    count,
                                     double min,
                                     double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = count;
-    d_record.total() = total;
-    d_record.min()   = min;
-    d_record.max()   = max;
+    lockAll();
+    resetAll();
+    d_cells_p[0].d_count = count;
+    d_cells_p[0].d_total = total;
+    d_cells_p[0].d_min   = min;
+    d_cells_p[0].d_max   = max;
+    unlockAll();
 }
 
 // ACCESSORS
 inline
 const MetricId& Collector::metricId() const
 {
-    return d_record.metricId();
+    return d_metricId;
 }
 
 inline
 void Collector::load(MetricRecord *record) const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record = d_record;
+    lockAll();
+    merge(record);
+    unlockAll();
 }
 }  // close package namespace
 
@@ -47,7 +47,7 @@ using bsl::flush;
 // out of the container, and that the operations are thread safe.
 // ----------------------------------------------------------------------------
 // CREATORS
-// [ 3]  balm::Collector(const balm::MetricId& metric);
+// [ 3]  balm::Collector(const MetricId& metric, Allocator *ba = 0);
 // [ 3]  ~balm::Collector();
 //
 // MANIPULATORS
@@ -67,7 +67,8 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] CONCERN: CONCURRENT UPDATES OF BOTH KINDS ARE MERGED EXACTLY
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -219,6 +220,31 @@ void ConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+enum { k_NUM_UPDATES = 20000 };  // number of updates per thread in case 9
+
+void updateJob(Obj *collector, bslmt::Barrier *barrier, int threadIndex)
+    // Wait on the specified 'barrier', then supply to the specified
+    // 'collector' the values 'n + 0.5' for each 'n' in the range
+    // '[1 .. k_NUM_UPDATES]' offset by 'k_NUM_UPDATES' times the specified
+    // 'threadIndex', in increasing order, alternately using 'update' and
+    // 'accumulateCountTotalMinMax'.
+{
+    const int base = threadIndex * k_NUM_UPDATES;
+
+    barrier->wait();
+    for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+        const double value = base + i + 0.5;
+
+        if (i % 2) {
+            collector->update(value);
+        }
+        else {
+            collector->accumulateCountTotalMinMax(1, value, value, value);
+        }
+    }
+}
+
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -248,7 +274,7 @@ int main(int argc, char *argv[])
     Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -302,6 +328,94 @@ int main(int argc, char *argv[])
         ASSERT(3.0      == record.max());
 //..
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT UPDATES OF BOTH KINDS ARE MERGED EXACTLY
+        //
+        // Concerns:
+        //: 1 Values supplied to 'update' and to 'accumulateCountTotalMinMax'
+        //:   from many threads concurrently are all accounted for exactly once
+        //:   by the records loaded by 'loadAndReset', including while
+        //:   'loadAndReset' is concurrently invoked.
+        //:
+        //: 2 Non-integral values are accumulated in the total without loss
+        //:   (when exactly representable).
+        //:
+        //: 3 The minimum and maximum values loaded are those of the values
+        //:   supplied since the previous call to 'loadAndReset'.
+        //
+        // Plan:
+        //: 1 Update a collector from several threads with disjoint ranges of
+        //:   values, each having a fractional part of 0.5, alternately using
+        //:   'update' and 'accumulateCountTotalMinMax', while the main thread
+        //:   repeatedly calls 'loadAndReset', and verify that the sums of the
+        //:   counts and totals of the loaded records, and the extrema of their
+        //:   minima and maxima, are those of all the values supplied.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT UPDATES OF BOTH KINDS ARE MERGED EXACTLY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "CONCURRENT UPDATES OF BOTH KINDS ARE MERGED EXACTLY"
+                   << endl
+                   << "==================================================="
+                   << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        bslma::TestAllocator defaultAllocator;
+        bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+        Obj mX(METRIC_A);
+
+        bslmt::Barrier         barrier(k_NUM_THREADS + 1);
+        bdlmt::FixedThreadPool pool(k_NUM_THREADS, k_NUM_THREADS);
+        pool.start();
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            pool.enqueueJob(bdlf::BindUtil::bind(&updateJob,
+                                                 &mX,
+                                                 &barrier,
+                                                 i));
+        }
+
+        bsls::Types::Int64 count = 0;
+        double             total = 0.0;
+        double             min   = Rec::k_DEFAULT_MIN;
+        double             max   = Rec::k_DEFAULT_MAX;
+
+        barrier.wait();
+        for (int i = 0; i < 1000 || 0 < pool.numActiveThreads(); ++i) {
+            Rec record;
+            mX.loadAndReset(&record);
+
+            count += record.count();
+            total += record.total();
+            min    = bsl::min(min, record.min());
+            max    = bsl::max(max, record.max());
+        }
+        pool.drain();
+
+        Rec record;
+        mX.loadAndReset(&record);
+
+        count += record.count();
+        total += record.total();
+        min    = bsl::min(min, record.min());
+        max    = bsl::max(max, record.max());
+
+        const bsls::Types::Int64 N = k_NUM_THREADS * k_NUM_UPDATES;
+
+        ASSERTV(count, N                       == count);
+        ASSERTV(total, N * (N + 1) / 2 + N / 2 == total);
+        ASSERTV(min,   1.5                     == min);
+        ASSERTV(max,   N + 0.5                 == max);
+
+        mX.load(&record);
+        ASSERT(Rec(METRIC_A) == record);
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -589,13 +703,21 @@ int main(int argc, char *argv[])
         // Concerns:
         //   Test the constructor arguments
         //
+        //   The cells are allocated, as one block of at most 16 cache lines
+        //   (plus alignment slack), from the allocator supplied at
+        //   construction, or from the default allocator if none is supplied,
+        //   and deallocated on destruction.
+        //
         // Plan:
         //   Verify the constructor by passing a value from a table of values
         //   and verifying the object is initialized with the value..
         //
+        //   Create collectors with and without a test allocator, with another
+        //   test allocator installed as the default, and verify the blocks
+        //   and bytes in use by each allocator.
         //
         // Testing:
-        //   balm::Collector(const balm::MetricId&  )
+        //   balm::Collector(const MetricId& metric, Allocator *ba = 0);
         //   ~balm::Collector()
         // --------------------------------------------------------------------
 
@@ -611,6 +733,39 @@ int main(int argc, char *argv[])
             ASSERT(IDS[i] == MX.metricId());
         }
 
+        if (verbose) cout << "\nTesting allocator." << endl;
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        {
+            bslma::TestAllocator defaultAllocator("default");
+            bslma::TestAllocator objectAllocator("object");
+
+            bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+            {
+                Obj mX(METRIC_A, &objectAllocator); const Obj& MX = mX;
+
+                ASSERT(METRIC_A == MX.metricId());
+                ASSERT(1 == objectAllocator.numBlocksInUse());
+                ASSERTV(objectAllocator.numBytesInUse(),
+                        16 * 64 + 63 >= objectAllocator.numBytesInUse());
+                ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+                mX.update(1.0);
+                mX.update(2.0);
+
+                Rec record;
+                MX.load(&record);
+                ASSERT(Rec(METRIC_A, 2, 3.0, 1.0, 2.0) == record);
+            }
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+
+            {
+                Obj mX(METRIC_A);
+
+                ASSERT(1 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
       } break;
       case 2: {
         // --------------------------------------------------------------------
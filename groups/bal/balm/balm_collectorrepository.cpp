@@ -14,16 +14,20 @@ BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 
 #include <balm_metricid.h>
 
+#include <bslalg_constructorproxy.h>
+
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_managedptr.h>
 #include <bsls_assert.h>
 
 #include <bsl_algorithm.h>   // for 'bsl::min' and 'bsl::max'
 #include <bsl_ostream.h>
 #include <bsl_set.h>
+#include <bsl_sstream.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
 
@@ -33,6 +37,10 @@ namespace BloombergLP {
 
 namespace {
 
+const double k_DEFAULT_PERCENTILES[] = { 50.0, 90.0, 99.0, 99.9 };
+    // percentiles published for a metric collected by histogram collectors,
+    // unless configured otherwise by 'setHistogramPercentiles'
+
 inline
 void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
 {
@@ -43,6 +51,12 @@ void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
     record->max()      = bsl::max(record->max(), value.max());
 }
 
+inline
+void combine(balm::Histogram *histogram, const balm::Histogram& value)
+{
+    histogram->merge(value);
+}
+
 }  // close unnamed namespace
 
 namespace balm {
@@ -56,8 +70,8 @@ class CollectorRepository_Collectors {
     // This implementation class provides a container mechanism for managing a
     // set of objects of templatized type 'COLLECTOR' that are all associated
     // with a single metric.  The behavior is undefined unless the templatized
-    // type 'COLLECTOR' is either 'Collector' or
-    // 'IntegerCollector'.  A 'CollectorRepository_Collectors'
+    // type 'COLLECTOR' is 'Collector', 'IntegerCollector', or
+    // 'HistogramCollector'.  A 'CollectorRepository_Collectors'
     // object is supplied a 'MetricId' at construction, and provides a
     // default 'COLLECTOR' as well as a set of additional 'COLLECTOR' objects
     // for the identified metric.  Additional 'COLLECTOR' objects (beyond the
@@ -76,7 +90,8 @@ class CollectorRepository_Collectors {
         // templatized type 'COLLECTOR'.
 
     // DATA
-    COLLECTOR         d_defaultCollector;  // default collector
+    bslalg::ConstructorProxy<COLLECTOR>
+                      d_defaultCollector;  // default collector
     CollectorSet      d_addedCollectors;   // added collectors
     bslma::Allocator *d_allocator_p;       // allocator (held, not owned)
 
@@ -98,8 +113,8 @@ class CollectorRepository_Collectors {
         // 'metricId'.   Optionally specify a 'basicAllocator' used to supply
         // memory.  If 'basicAllocator' is 0, the currently installed default
         // allocator is used.  The behavior is undefined unless the
-        // templatized type 'COLLECTOR' is either 'Collector' or
-        // 'IntegerCollector', and 'metricId.isValid()' is 'true'.
+        // templatized type 'COLLECTOR' is 'Collector', 'IntegerCollector', or
+        // 'HistogramCollector', and 'metricId.isValid()' is 'true'.
 
     ~CollectorRepository_Collectors();
         // Destroy this object.
@@ -120,21 +135,27 @@ class CollectorRepository_Collectors {
         // call to 'addCollector' on this object, or has previously been
         // removed.
 
-    void collectAndReset(MetricRecord *record);
+    template <class RECORD>
+    void collectAndReset(RECORD *record);
         // Load into the specified 'record' the aggregate value of all the
         // records collected by the collectors owned by this object; then
         // reset those collectors to their default values.  Note that all
         // collectors within this object record values for the same metric id,
-        // so they can be aggregated into a single record.
+        // so they can be aggregated into a single record.  The behavior is
+        // undefined unless the templatized type 'RECORD' is 'Histogram' if
+        // 'COLLECTOR' is 'HistogramCollector', and 'MetricRecord' otherwise.
 
-    void collect(MetricRecord *record);
+    template <class RECORD>
+    void collect(RECORD *record);
         // Load into the specified 'record' the aggregate value of all the
         // records collected by the collectors owned by this object.  Note
         // that all collectors within this object record values for the same
         // metric id, so they can be aggregated into a single record.  Also
         // note that because this operation does not reset the collectors,
         // subsequent 'collect' invocations will effectively re-collect the
-        // current values.
+        // current values.  The behavior is undefined unless the templatized
+        // type 'RECORD' is 'Histogram' if 'COLLECTOR' is
+        // 'HistogramCollector', and 'MetricRecord' otherwise.
 
     // ACCESSORS
     int getAddedCollectors(
@@ -159,7 +180,7 @@ template <class COLLECTOR>
 CollectorRepository_Collectors<COLLECTOR>::
       CollectorRepository_Collectors(const MetricId&   metricId,
                                      bslma::Allocator *basicAllocator)
-: d_defaultCollector(metricId)
+: d_defaultCollector(metricId, basicAllocator)
 , d_addedCollectors(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -178,16 +199,16 @@ inline
 COLLECTOR *
 CollectorRepository_Collectors<COLLECTOR>::defaultCollector()
 {
-    return &d_defaultCollector;
+    return &d_defaultCollector.object();
 }
 
 template <class COLLECTOR>
 bsl::shared_ptr<COLLECTOR>
 CollectorRepository_Collectors<COLLECTOR>::addCollector()
 {
-    Collector collectorPtr(
-                new (*d_allocator_p) COLLECTOR(d_defaultCollector.metricId()),
-                d_allocator_p);
+    Collector collectorPtr = bsl::allocate_shared<COLLECTOR>(
+                                       d_allocator_p,
+                                       d_defaultCollector.object().metricId());
     d_addedCollectors.insert(collectorPtr);
     return collectorPtr;
 }
@@ -202,29 +223,38 @@ int CollectorRepository_Collectors<COLLECTOR>::removeCollector(
 }
 
 template <class COLLECTOR>
+template <class RECORD>
 void
-CollectorRepository_Collectors<COLLECTOR>::collectAndReset(
-                                                          MetricRecord *record)
+CollectorRepository_Collectors<COLLECTOR>::collectAndReset(RECORD *record)
 {
-    d_defaultCollector.loadAndReset(record);
+    d_defaultCollector.object().loadAndReset(record);
+    if (d_addedCollectors.empty()) {
+        return;                                                       // RETURN
+    }
+
+    bslalg::ConstructorProxy<RECORD> tempRecord(d_allocator_p);
     typename CollectorSet::iterator it = d_addedCollectors.begin();
     for (; it != d_addedCollectors.end(); ++it) {
-        MetricRecord tempRecord;
-        (*it)->loadAndReset(&tempRecord);
-        combine(record, tempRecord);
+        (*it)->loadAndReset(&tempRecord.object());
+        combine(record, tempRecord.object());
     }
 }
 
 template <class COLLECTOR>
+template <class RECORD>
 void
-CollectorRepository_Collectors<COLLECTOR>::collect(MetricRecord *record)
+CollectorRepository_Collectors<COLLECTOR>::collect(RECORD *record)
 {
-    d_defaultCollector.load(record);
+    d_defaultCollector.object().load(record);
+    if (d_addedCollectors.empty()) {
+        return;                                                       // RETURN
+    }
+
+    bslalg::ConstructorProxy<RECORD> tempRecord(d_allocator_p);
     typename CollectorSet::iterator it = d_addedCollectors.begin();
     for (; it != d_addedCollectors.end(); ++it) {
-        MetricRecord tempRecord;
-        (*it)->load(&tempRecord);
-        combine(record, tempRecord);
+        (*it)->load(&tempRecord.object());
+        combine(record, tempRecord.object());
     }
 }
 
@@ -247,7 +277,7 @@ inline
 const MetricId&
 CollectorRepository_Collectors<COLLECTOR>::metricId() const
 {
-    return d_defaultCollector.metricId();
+    return d_defaultCollector.object().metricId();
 }
 
                  // ==========================================
@@ -256,23 +286,55 @@ CollectorRepository_Collectors<COLLECTOR>::metricId() const
 
 class CollectorRepository_MetricCollectors {
     // This implementation class provides a container mechanism for managing
-    // the 'Collector' and 'IntegerCollector' objects associated with a single
-    // metric.  The 'collector' and 'intCollector' methods are provided to
-    // access the individual containers for 'Collector' objects and
-    // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
-    // obtains the aggregate value of all the owned collectors and integer
-    // collectors, and then resets those collectors and integer collectors to
-    // their default state.
+    // the 'Collector', 'IntegerCollector', and 'HistogramCollector' objects
+    // associated with a single metric.  The 'collector', 'intCollector', and
+    // 'histogramCollectors' methods are provided to access the individual
+    // containers for 'Collector' objects, 'IntegerCollector' objects, and
+    // 'HistogramCollector' objects, respectively.  Note that the container
+    // for 'HistogramCollector' objects, which are comparatively large, is
+    // only created when first accessed.  The 'collectAndReset' method
+    // obtains the aggregate value of all the owned collectors, and then
+    // resets those collectors to their default state.
 
     // PRIVATE TYPES
     typedef CollectorRepository_Collectors<Collector>
                                                         Collectors;
     typedef CollectorRepository_Collectors<IntegerCollector>
                                                         IntCollectors;
+    typedef CollectorRepository_Collectors<HistogramCollector>
+                                                        HistogramCollectors;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors                           d_collectors;
+                                             // collector objects
+
+    IntCollectors                        d_intCollectors;
+                                             // integer collector objects
+
+    bslma::ManagedPtr<HistogramCollectors>
+                                         d_histogramCollectors;
+                                             // histogram collector objects,
+                                             // or null if none was requested
+
+    bool                                 d_hasPercentiles;
+                                             // 'true' if 'setPercentiles' was
+                                             // called
+
+    bsl::vector<double>                  d_percentiles;
+                                             // published percentiles
+
+    bsl::vector<MetricId>                d_percentileIds;
+                                             // ids of the published
+                                             // percentiles
+
+    bslma::Allocator                    *d_allocator_p;
+                                             // allocator (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    void appendPercentiles(bsl::vector<MetricRecord> *records,
+                           const Histogram&           histogram);
+        // Append to the specified 'records' a record for each published
+        // percentile of the values recorded in the specified 'histogram'.
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
@@ -306,21 +368,43 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
-    void collectAndReset(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object; then
-        // reset those collectors to their default values.  Note that all
-        // collectors within this object record values for the same metric id,
-        // so they can be aggregated into a single record.
-
-    void collect(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object.  Note
-        // that all collectors within this object record values for the same
-        // metric id, so they can be aggregated into a single record.  Also
-        // note that because this operation does not reset the collectors,
-        // subsequent 'collect' invocations will effectively re-collect the
-        // current values.
+    CollectorRepository_Collectors<HistogramCollector>&
+                                                        histogramCollectors();
+        // Return a reference to the modifiable container of
+        // 'HistogramCollector' objects, creating it if it does not exist.
+
+    CollectorRepository_Collectors<HistogramCollector> *
+                                                    findHistogramCollectors();
+        // Return the address of the modifiable container of
+        // 'HistogramCollector' objects, or 0 if it has not been created.
+
+    void setPercentiles(const bsl::vector<double>&   percentiles,
+                        const bsl::vector<MetricId>& percentileIds);
+        // Set the percentiles of the values recorded by the histogram
+        // collectors of this object that are published to the specified
+        // 'percentiles', identified by the respective elements of the
+        // specified 'percentileIds'.  The behavior is undefined unless
+        // 'percentiles.size() == percentileIds.size()'.
+
+    void collectAndReset(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' a record holding the aggregate
+        // value of all the records collected by the collectors owned by this
+        // object, followed by a record for each published percentile of the
+        // values collected by the histogram collectors owned by this object
+        // (if any); then reset those collectors to their default values.
+        // Note that all collectors within this object record values for the
+        // same metric id, so they can be aggregated into a single record.
+
+    void collect(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' a record holding the aggregate
+        // value of all the records collected by the collectors owned by this
+        // object, followed by a record for each published percentile of the
+        // values collected by the histogram collectors owned by this object
+        // (if any).  Note that all collectors within this object record
+        // values for the same metric id, so they can be aggregated into a
+        // single record.  Also note that because this operation does not
+        // reset the collectors, subsequent 'collect' invocations will
+        // effectively re-collect the current values.
 
     // ACCESSORS
     const CollectorRepository_Collectors<Collector>& collectors() const;
@@ -332,6 +416,10 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the non-modifiable container of
         // 'IntegerCollector' objects.
 
+    bool hasPercentiles() const;
+        // Return 'true' if the published percentiles were set by
+        // 'setPercentiles', and 'false' otherwise.
+
     const MetricId& metricId() const;
         // Return a reference to the non-modifiable 'MetricId' object
         // identifying the metric for which the collectors in this container
@@ -349,6 +437,11 @@ CollectorRepository_MetricCollectors(const MetricId&   id,
                                      bslma::Allocator *basicAllocator)
 : d_collectors(id, basicAllocator)
 , d_intCollectors(id, basicAllocator)
+, d_histogramCollectors()
+, d_hasPercentiles(false)
+, d_percentiles(basicAllocator)
+, d_percentileIds(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -373,21 +466,112 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+CollectorRepository_Collectors<HistogramCollector>&
+CollectorRepository_MetricCollectors::histogramCollectors()
+{
+    if (!d_histogramCollectors) {
+        d_histogramCollectors.load(
+                          new (*d_allocator_p) HistogramCollectors(
+                                                               metricId(),
+                                                               d_allocator_p),
+                          d_allocator_p);
+    }
+    return *d_histogramCollectors;
+}
+
+inline
+CollectorRepository_Collectors<HistogramCollector> *
+CollectorRepository_MetricCollectors::findHistogramCollectors()
+{
+    return d_histogramCollectors.get();
+}
+
+void CollectorRepository_MetricCollectors::setPercentiles(
+                                   const bsl::vector<double>&   percentiles,
+                                   const bsl::vector<MetricId>& percentileIds)
+{
+    BSLS_ASSERT(percentiles.size() == percentileIds.size());
+
+    d_percentiles    = percentiles;
+    d_percentileIds  = percentileIds;
+    d_hasPercentiles = true;
+}
+
+void CollectorRepository_MetricCollectors::appendPercentiles(
+                                    bsl::vector<MetricRecord> *records,
+                                    const Histogram&           histogram)
+{
+    // Each percentile is published as a record whose count is the number of
+    // recorded values and whose minimum, maximum, and average are the
+    // estimated percentile, so that it can be published (and aggregated) as
+    // any other metric.
+
+    const int count = static_cast<int>(histogram.count());
+    for (bsl::size_t i = 0; i < d_percentiles.size(); ++i) {
+        if (0 == count) {
+            records->push_back(MetricRecord(d_percentileIds[i]));
+        }
+        else {
+            const double value = histogram.percentile(d_percentiles[i]);
+            records->push_back(MetricRecord(d_percentileIds[i],
+                                            count,
+                                            value * count,
+                                            value,
+                                            value));
+        }
+    }
+}
+
 void CollectorRepository_MetricCollectors::collectAndReset(
-                                                          MetricRecord *record)
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collectAndReset(record);
+    MetricRecord record;
+    d_collectors.collectAndReset(&record);
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+
+    if (!d_histogramCollectors) {
+        records->push_back(record);
+        return;                                                       // RETURN
+    }
+
+    Histogram histogram(d_allocator_p);
+    d_histogramCollectors->collectAndReset(&histogram);
+    combine(&record,
+            MetricRecord(metricId(),
+                         static_cast<int>(histogram.count()),
+                         histogram.total(),
+                         histogram.min(),
+                         histogram.max()));
+    records->push_back(record);
+    appendPercentiles(records, histogram);
 }
 
-void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
+void CollectorRepository_MetricCollectors::collect(
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collect(record);
+    MetricRecord record;
+    d_collectors.collect(&record);
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+
+    if (!d_histogramCollectors) {
+        records->push_back(record);
+        return;                                                       // RETURN
+    }
+
+    Histogram histogram(d_allocator_p);
+    d_histogramCollectors->collect(&histogram);
+    combine(&record,
+            MetricRecord(metricId(),
+                         static_cast<int>(histogram.count()),
+                         histogram.total(),
+                         histogram.min(),
+                         histogram.max()));
+    records->push_back(record);
+    appendPercentiles(records, histogram);
 }
 
 // ACCESSORS
@@ -405,6 +589,12 @@ CollectorRepository_MetricCollectors::intCollectors() const
     return d_intCollectors;
 }
 
+inline
+bool CollectorRepository_MetricCollectors::hasPercentiles() const
+{
+    return d_hasPercentiles;
+}
+
 inline
 const MetricId&
 CollectorRepository_MetricCollectors::metricId() const
@@ -446,6 +636,48 @@ CollectorRepository::getMetricCollectors(const MetricId& metricId)
     return *cIt->second.get();
 }
 
+void CollectorRepository::setPercentiles(
+                                   MetricCollectors           *collectors,
+                                   const bsl::vector<double>&  percentiles)
+{
+    // Each percentile is identified by a metric in the same category as the
+    // collected metric, named after the collected metric and the percentile
+    // (e.g., "RequestLatency.p99.9").
+
+    bsl::vector<MetricId> percentileIds(d_allocator_p);
+    percentileIds.reserve(percentiles.size());
+
+    const MetricId& metricId = collectors->metricId();
+    for (bsl::size_t i = 0; i < percentiles.size(); ++i) {
+        BSLS_ASSERT(0.0 <= percentiles[i]);
+        BSLS_ASSERT(percentiles[i] <= 100.0);
+
+        bsl::ostringstream name(d_allocator_p);
+        name << metricId.metricName() << ".p" << percentiles[i];
+        percentileIds.push_back(d_registry_p->getId(metricId.categoryName(),
+                                                    name.str().c_str()));
+    }
+    collectors->setPercentiles(percentiles, percentileIds);
+}
+
+CollectorRepository::MetricCollectors&
+CollectorRepository::getHistogramMetricCollectors(const MetricId& metricId)
+{
+    MetricCollectors& collectors = getMetricCollectors(metricId);
+    if (!collectors.findHistogramCollectors()) {
+        if (!collectors.hasPercentiles()) {
+            const bsl::vector<double> percentiles(
+                   k_DEFAULT_PERCENTILES,
+                   k_DEFAULT_PERCENTILES + sizeof k_DEFAULT_PERCENTILES
+                                             / sizeof *k_DEFAULT_PERCENTILES,
+                   d_allocator_p);
+            setPercentiles(&collectors, percentiles);
+        }
+        collectors.histogramCollectors();
+    }
+    return collectors;
+}
+
 // MANIPULATORS
 void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
                                           const Category            *category)
@@ -463,9 +695,7 @@ void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collectAndReset(&record);
-            records->push_back(record);
+            (*metricIt)->collectAndReset(records);
         }
     }
 }
@@ -487,9 +717,7 @@ void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collect(&record);
-            records->push_back(record);
+            (*metricIt)->collect(records);
         }
     }
 }
@@ -545,6 +773,46 @@ CollectorRepository::addIntegerCollector(const MetricId& metricId)
     return getMetricCollectors(metricId).intCollectors().addCollector();
 }
 
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the histogram collectors for
+    // 'metricId' already exist.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end()) {
+            CollectorRepository_Collectors<HistogramCollector> *histograms =
+                                       it->second->findHistogramCollectors();
+            if (histograms) {
+                return histograms->defaultCollector();                // RETURN
+            }
+        }
+    }
+
+    // Use 'getHistogramMetricCollectors' to create the histogram collectors
+    // (if they have not been created since the read-lock was released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getHistogramMetricCollectors(metricId).histogramCollectors()
+                                                         .defaultCollector();
+}
+
+bsl::shared_ptr<HistogramCollector>
+CollectorRepository::addHistogramCollector(const MetricId& metricId)
+{
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getHistogramMetricCollectors(metricId).histogramCollectors()
+                                                             .addCollector();
+}
+
+void CollectorRepository::setHistogramPercentiles(
+                                       const MetricId&            metricId,
+                                       const bsl::vector<double>& percentiles)
+{
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    setPercentiles(&getMetricCollectors(metricId), percentiles);
+}
+
 int CollectorRepository::getAddedCollectors(
                bsl::vector<bsl::shared_ptr<Collector> >         *collectors,
                bsl::vector<bsl::shared_ptr<IntegerCollector> >  *intCollectors,
@@ -18,25 +18,45 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_histogramcollector,
+//           balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
-// that serves as a repository for 'balm::Collector' and
-// 'balm::IntegerCollector' objects.  The collector repository supports
-// operations to create and lookup collectors, as well as an operation to
-// collect metric records from the collectors in the repository.  Collectors
-// are identified by a metric id, which uniquely identifies the metric for
-// which they collect values.  The 'getDefaultCollector' (and
-// 'getDefaultIntegerCollector') operations return the default collector (or
-// integer collector) for the supplied metric.  The 'addCollector' (and
-// 'addIntegerCollector') operations create and return a new collector (or
-// integer collector) for the specified metric.  Each collector instance can
-// can safely collect values from multiple threads, however, the collector does
-// use a mutex: Applications anticipating high contention for that lock can use
-// 'addCollector' (and 'addIntegerCollector') to obtain multiple collectors and
-// thereby reduce contention.  Finally, the 'collectAndReset' operation
-// collects and returns metric records from each of the collectors in the
-// repository.
+// that serves as a repository for 'balm::Collector',
+// 'balm::IntegerCollector', and 'balm::HistogramCollector' objects.  The
+// collector repository supports operations to create and lookup collectors,
+// as well as an operation to collect metric records from the collectors in
+// the repository.  Collectors are identified by a metric id, which uniquely
+// identifies the metric for which they collect values.  The
+// 'getDefaultCollector' (and 'getDefaultIntegerCollector') operations return
+// the default collector (or integer collector) for the supplied metric.  The
+// 'addCollector' (and 'addIntegerCollector') operations create and return a
+// new collector (or integer collector) for the specified metric.  Each
+// collector instance can safely collect values from multiple threads, and
+// distributes its values over several independently locked cells so that
+// concurrent updates rarely contend; applications can nevertheless use
+// 'addCollector' (and 'addIntegerCollector') to obtain multiple collectors
+// for the same metric.  Finally, the 'collectAndReset' operation collects and
+// returns metric records from each of the collectors in the repository.
+//
+///Histogram Collectors
+///--------------------
+// The 'getDefaultHistogramCollector' and 'addHistogramCollector' operations
+// return a 'balm::HistogramCollector' for the supplied metric, which records
+// the distribution of the values of the metric (typically a latency) in
+// addition to their count, total, minimum, and maximum.  When records are
+// collected from the repository, the values recorded by the histogram
+// collectors of a metric are aggregated into the record for that metric
+// (along with the values recorded by its other collectors, if any), and
+// estimates of a configurable set of percentiles of those values are
+// appended as additional records.  Each percentile is identified by a metric
+// in the same category, whose name is the name of the metric followed by
+// ".p" and the percentile (e.g., "RequestLatency.p99.9").  The minimum,
+// maximum, and average of a percentile record are the estimated percentile,
+// and its count is the number of recorded values, so that percentiles are
+// published by any 'balm::Publisher' (e.g., 'balm::StreamPublisher') like any
+// other metric.  The published percentiles are the 50th, 90th, 99th, and
+// 99.9th, unless configured otherwise using 'setHistogramPercentiles'.
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
@@ -105,10 +125,60 @@ BSLS_IDENT("$Id: $")
 //  [ Test.C3: 1 5 5 5 ]
 //  [ Test.C4: 1 6 6 6 ]
 //..
+//
+///Example 2: Collecting Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - -
+// The following example illustrates collecting percentiles of latencies
+// using a 'balm::HistogramCollector'.  We start by creating a repository,
+// configuring the percentiles published for the "Test.Latency" metric, and
+// looking up the default histogram collector for that metric:
+//..
+//  balm::MetricRegistry      registry(allocator);
+//  balm::CollectorRepository histograms(&registry, allocator);
+//
+//  bsl::vector<double> percentiles(allocator);
+//  percentiles.push_back(50.0);
+//  percentiles.push_back(99.0);
+//  histograms.setHistogramPercentiles(registry.getId("Test", "Latency"),
+//                                     percentiles);
+//
+//  balm::HistogramCollector *latency =
+//                  histograms.getDefaultHistogramCollector("Test", "Latency");
+//..
+// Then, we record 100 latencies, of which one is much longer than the
+// others:
+//..
+//  for (int i = 0; i < 99; ++i) {
+//      latency->update(0.25);
+//  }
+//  latency->update(8.0);
+//..
+// Finally, we collect the records from the repository.  In addition to the
+// record for "Test.Latency", a record is collected for each of the
+// configured percentiles, in the order they were supplied:
+//..
+//  bsl::vector<balm::MetricRecord> latencyRecords(allocator);
+//  histograms.collectAndReset(&latencyRecords, registry.getCategory("Test"));
+//
+//  assert(3 == latencyRecords.size());
+//  assert(100  == latencyRecords[0].count());
+//  assert(8.0  == latencyRecords[0].max());
+//
+//  assert(registry.getId("Test", "Latency.p50") ==
+//                                               latencyRecords[1].metricId());
+//  assert(0.25 <= latencyRecords[1].max());
+//  assert(latencyRecords[1].max() <= 0.25 * (1 + 1.0 / 64));
+//
+//  assert(registry.getId("Test", "Latency.p99") ==
+//                                               latencyRecords[2].metricId());
+//  assert(0.25 <= latencyRecords[2].max());
+//  assert(latencyRecords[2].max() <= 0.25 * (1 + 1.0 / 64));
+//..
 
 #include <balscm_version.h>
 
 #include <balm_collector.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
@@ -137,7 +207,8 @@ class CollectorRepository_MetricCollectors;  // defined in implementation
 
 class CollectorRepository {
     // This class defines a fully thread-safe repository mechanism for
-    // 'Collector' and 'IntegerCollector' objects.  Collectors are identified
+    // 'Collector', 'IntegerCollector', and 'HistogramCollector' objects.
+    // Collectors are identified
     // in the repository by a 'MetricId' object and also grouped together
     // according to the category of the metric.  This repository supports
     // operations to create, find, and collect metric records from the
@@ -186,6 +257,24 @@ class CollectorRepository {
         // unless the calling thread has a *write* *lock* to 'd_rwMutex' and
         // 'metricId' is valid.
 
+    MetricCollectors& getHistogramMetricCollectors(const MetricId& metricId);
+        // Return a reference to the modifiable collectors associated with the
+        // specified 'metricId', as 'getMetricCollectors' does, and create the
+        // container of their histogram collectors if it does not already
+        // exist, setting the published percentiles to their default values
+        // unless they were set by 'setHistogramPercentiles'.  The behavior is
+        // undefined unless the calling thread has a *write* *lock* to
+        // 'd_rwMutex' and 'metricId' is valid.
+
+    void setPercentiles(MetricCollectors           *collectors,
+                        const bsl::vector<double>&  percentiles);
+        // Set the percentiles published for the histogram collectors in the
+        // specified 'collectors' to the specified 'percentiles', registering
+        // the metric identifying each percentile if necessary.  The behavior
+        // is undefined unless the calling thread has a *write* *lock* to
+        // 'd_rwMutex', and each element of 'percentiles' is in the range
+        // '[0.0, 100.0]'.
+
   public:
     // PUBLIC TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(CollectorRepository,
@@ -208,16 +297,19 @@ class CollectorRepository {
                          const Category            *category);
         // Append to the specified 'records' the collected metric record
         // values from the collectors in this repository belonging to the
-        // specified 'category'; then reset those collectors to their default
-        // values.
+        // specified 'category', followed, for each metric having histogram
+        // collectors, by the records of its published percentiles; then
+        // reset those collectors to their default values.
 
     void collect(bsl::vector<MetricRecord> *records,
                  const Category            *category);
         // Append to the specified 'records' the collected metric record
         // values from the collectors in this repository belonging to the
-        // specified 'category'.  Note that this operation does not reset the
-        // managed collectors, so subsequent collection operations will
-        // effectively re-collect the current values.
+        // specified 'category', followed, for each metric having histogram
+        // collectors, by the records of its published percentiles.  Note
+        // that this operation does not reset the managed collectors, so
+        // subsequent collection operations will effectively re-collect the
+        // current values.
 
     Collector *getDefaultCollector(const char *category,
                                    const char *metricName);
@@ -261,6 +353,31 @@ class CollectorRepository {
         // repository, create one, add it to the repository, and return its
         // address.
 
+    HistogramCollector *getDefaultHistogramCollector(const char *category,
+                                                     const char *metricName);
+        // Return the address of the modifiable default histogram collector
+        // identified by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a default histogram collector for the identified
+        // metric does not already exist in the repository, create one, add
+        // it to the repository, and return its address.  In addition, if the
+        // identified metric has not already been registered, add the
+        // identified metric to the 'metricRegistry' supplied at construction.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(registry().getId(category,
+        //                                                metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(
+                                                     const MetricId& metricId);
+        // Return the address of the modifiable default histogram collector
+        // identified by the specified 'metricId'.  If a default histogram
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, and return its
+        // address.  Note that creating the first histogram collector for a
+        // metric registers the metrics identifying its published percentiles
+        // (see {Histogram Collectors}).
+
     bsl::shared_ptr<Collector> addCollector(const char *category,
                                             const char *metricName);
         // Return a shared pointer to a newly-created modifiable collector
@@ -300,6 +417,40 @@ class CollectorRepository {
         // repository.  The behavior is undefined unless 'metricId' is a valid
         // id returned by the 'MetricRepository' supplied at construction.
 
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                                       const char *category,
+                                                       const char *metricName);
+        // Return a shared pointer to a newly-created modifiable histogram
+        // collector identified by the specified null-terminated strings
+        // 'category' and 'metricName', and add that collector to the
+        // repository.  If is not already registered, also add the identified
+        // metric to the 'metricRegistry' supplied at construction.  Note that
+        // this operation is logically equivalent to:
+        //..
+        //  addHistogramCollector(registry().getId(category, metricName))
+        //..
+
+    bsl::shared_ptr<HistogramCollector> addHistogramCollector(
+                                                     const MetricId& metricId);
+        // Return a shared pointer to a newly-created modifiable histogram
+        // collector identified by the specified 'metricId' and add that
+        // collector to the repository.  The behavior is undefined unless
+        // 'metricId' is a valid id returned by the 'MetricRepository'
+        // supplied at construction.
+
+    void setHistogramPercentiles(const MetricId&            metricId,
+                                 const bsl::vector<double>& percentiles);
+        // Set the percentiles of the values recorded by the histogram
+        // collectors for the metric identified by the specified 'metricId'
+        // that are collected from this repository to the specified
+        // 'percentiles' (in that order), and register the metrics identifying
+        // those percentiles if they have not already been registered (see
+        // {Histogram Collectors}).  The behavior is undefined unless
+        // 'metricId' is a valid id returned by the 'MetricRepository'
+        // supplied at construction, and each element of 'percentiles' is in
+        // the range '[0.0, 100.0]'.  Note that an empty 'percentiles'
+        // disables the publication of percentiles for the metric.
+
     int getAddedCollectors(
                bsl::vector<bsl::shared_ptr<Collector> >         *collectors,
                bsl::vector<bsl::shared_ptr<IntegerCollector> >  *intCollectors,
@@ -366,6 +517,15 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
@@ -382,6 +542,14 @@ CollectorRepository::addIntegerCollector(const char *category,
     return addIntegerCollector(d_registry_p->getId(category, metricName));
 }
 
+inline
+bsl::shared_ptr<HistogramCollector>
+CollectorRepository::addHistogramCollector(const char *category,
+                                           const char *metricName)
+{
+    return addHistogramCollector(d_registry_p->getId(category, metricName));
+}
+
 inline
 MetricRegistry& CollectorRepository::registry()
 {
@@ -21,6 +21,7 @@
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cmath.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_functional.h>
@@ -65,6 +66,11 @@ using bsl::flush;
 // [ 2] addCollector(const MetricId& metricId);
 // [ 5] addIntegerCollector(const StringRef&, const StringRef&);
 // [ 2] addIntegerCollector(const MetricId&);
+// [ 9] getDefaultHistogramCollector(const char *, const char *);
+// [ 9] getDefaultHistogramCollector(const MetricId&);
+// [ 9] addHistogramCollector(const char *, const char *);
+// [ 9] addHistogramCollector(const MetricId&);
+// [ 9] void setHistogramPercentiles(const MetricId&, const v<double>&);
 // [ 2] int getAddedCollectors(v<C *> *, v<IC *> *, const MetricId&);
 // [ 2] MetricRegistry &registry();
 // [ 4] void collectAndReset(v<MetricRecord> *, const Category *);
@@ -74,7 +80,7 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -399,7 +405,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -474,7 +480,271 @@ int main(int argc, char *argv[])
 //  [ Test.C3: 1 5 5 5 ]
 //  [ Test.C4: 1 6 6 6 ]
 //..
+//
+///Example 2: Collecting Latency Percentiles
+///- - - - - - - - - - - - - - - - - - - - -
+// The following example illustrates collecting percentiles of latencies
+// using a 'balm::HistogramCollector'.  We start by creating a repository,
+// configuring the percentiles published for the "Test.Latency" metric, and
+// looking up the default histogram collector for that metric:
+//..
+    balm::MetricRegistry      registry(allocator);
+    balm::CollectorRepository histograms(&registry, allocator);
+
+    bsl::vector<double> percentiles(allocator);
+    percentiles.push_back(50.0);
+    percentiles.push_back(99.0);
+    histograms.setHistogramPercentiles(registry.getId("Test", "Latency"),
+                                       percentiles);
+
+    balm::HistogramCollector *latency =
+                    histograms.getDefaultHistogramCollector("Test", "Latency");
+//..
+// Then, we record 100 latencies, of which one is much longer than the
+// others:
+//..
+    for (int i = 0; i < 99; ++i) {
+        latency->update(0.25);
+    }
+    latency->update(8.0);
+//..
+// Finally, we collect the records from the repository.  In addition to the
+// record for "Test.Latency", a record is collected for each of the
+// configured percentiles, in the order they were supplied:
+//..
+    bsl::vector<balm::MetricRecord> latencyRecords(allocator);
+    histograms.collectAndReset(&latencyRecords, registry.getCategory("Test"));
+
+    ASSERT(3 == latencyRecords.size());
+    ASSERT(100  == latencyRecords[0].count());
+    ASSERT(8.0  == latencyRecords[0].max());
+
+    ASSERT(registry.getId("Test", "Latency.p50") ==
+                                                 latencyRecords[1].metricId());
+    ASSERT(0.25 <= latencyRecords[1].max());
+    ASSERT(latencyRecords[1].max() <= 0.25 * (1 + 1.0 / 64));
+
+    ASSERT(registry.getId("Test", "Latency.p99") ==
+                                                 latencyRecords[2].metricId());
+    ASSERT(0.25 <= latencyRecords[2].max());
+    ASSERT(latencyRecords[2].max() <= 0.25 * (1 + 1.0 / 64));
+//..
+
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTORS
+        //
+        // Concerns:
+        //: 1 'getDefaultHistogramCollector' returns the same collector for a
+        //:   metric when called repeatedly (using either overload), and
+        //:   'addHistogramCollector' returns a new collector each time.
+        //:
+        //: 2 The metrics identifying the default percentiles are registered
+        //:   when the first histogram collector of a metric is created, and
+        //:   not before.
+        //:
+        //: 3 'collectAndReset' appends the record of a metric aggregating the
+        //:   values of all of its collectors (including non-histogram
+        //:   collectors), followed by a record for each percentile, in
+        //:   order, and resets the histogram collectors.
+        //:
+        //: 4 The percentile records of a metric having no recorded values
+        //:   have the default value.
+        //:
+        //: 5 'collect' appends the same records as 'collectAndReset', but
+        //:   does not reset the collectors.
+        //:
+        //: 6 'setHistogramPercentiles' replaces the published percentiles
+        //:   whether it is called before or after the histogram collectors
+        //:   are created, and an empty set of percentiles disables the
+        //:   percentile records.
+        //:
+        //: 7 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Obtain default and added histogram collectors, and compare their
+        //:   addresses.  (C-1)
+        //:
+        //: 2 Verify, using 'findId', the registration of the percentile
+        //:   metrics.  (C-2)
+        //:
+        //: 3 Record values in the histogram collectors of a metric and in a
+        //:   collector for the same metric, collect the records, and verify
+        //:   them against a 'balm::Histogram' holding the same values.
+        //:   (C-3..5)
+        //:
+        //: 4 Configure the percentiles of metrics, before and after creating
+        //:   their collectors, and verify the collected records.  (C-6)
+        //:
+        //: 5 Verify that the default allocator was not used.  (C-7)
+        //
+        // Testing:
+        //   getDefaultHistogramCollector(const char *, const char *);
+        //   getDefaultHistogramCollector(const MetricId&);
+        //   addHistogramCollector(const char *, const char *);
+        //   addHistogramCollector(const MetricId&);
+        //   void setHistogramPercentiles(const MetricId&, const v<double>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING HISTOGRAM COLLECTORS" << endl
+                                  << "============================" << endl;
+
+        typedef balm::MetricRecord Rec;
+
+        Registry registry(Z);
+        Obj      mX(&registry, Z);
+
+        const balm::Category *CATEGORY = registry.getCategory("A");
+
+        if (veryVerbose) cout << "	Testing collector lookup." << endl;
+
+        ASSERT(!registry.findId("A", "Latency.p50").isValid());
+
+        const balm::MetricId ID = registry.getId("A", "Latency");
+
+        balm::HistogramCollector *DEFAULT =
+                               mX.getDefaultHistogramCollector("A", "Latency");
+        ASSERT(0       != DEFAULT);
+        ASSERT(ID      == DEFAULT->metricId());
+        ASSERT(DEFAULT == mX.getDefaultHistogramCollector(ID));
+        ASSERT(DEFAULT == mX.getDefaultHistogramCollector("A", "Latency"));
+
+        bsl::shared_ptr<balm::HistogramCollector> added1 =
+                                      mX.addHistogramCollector("A", "Latency");
+        bsl::shared_ptr<balm::HistogramCollector> added2 =
+                                      mX.addHistogramCollector(ID);
+        ASSERT(added1.get() != DEFAULT);
+        ASSERT(added2.get() != DEFAULT);
+        ASSERT(added1       != added2);
+        ASSERT(ID           == added1->metricId());
+
+        const char *PERCENTILE_NAMES[] = { "Latency.p50", "Latency.p90",
+                                           "Latency.p99", "Latency.p99.9" };
+        const double PERCENTILES[]     = { 50.0, 90.0, 99.0, 99.9 };
+        const int    NUM_PERCENTILES   = sizeof PERCENTILES
+                                                         / sizeof *PERCENTILES;
+
+        for (int i = 0; i < NUM_PERCENTILES; ++i) {
+            ASSERTV(i, registry.findId("A", PERCENTILE_NAMES[i]).isValid());
+        }
+
+        if (veryVerbose) cout << "	Testing collection." << endl;
+
+        balm::Histogram expected(Z);
+        for (int i = 1; i <= 1000; ++i) {
+            const double VALUE = i * 0.01;
+            switch (i % 3) {
+              case 0: DEFAULT->update(VALUE); break;
+              case 1: added1->update(VALUE);  break;
+              case 2: added2->update(VALUE);  break;
+            }
+            expected.update(VALUE);
+        }
+
+        // A value recorded by a (non-histogram) collector for the same metric
+        // is aggregated in the record of the metric, but not in its
+        // percentiles.
+
+        mX.getDefaultCollector(ID)->update(100.0);
+
+        for (int pass = 0; pass < 2; ++pass) {
+            // Collect twice using 'collect' (which does not reset), then
+            // once using 'collectAndReset'.
+
+            bsl::vector<Rec> records(Z);
+            if (pass) {
+                mX.collectAndReset(&records, CATEGORY);
+            }
+            else {
+                mX.collect(&records, CATEGORY);
+            }
+
+            ASSERTV(pass, records.size(), 1 + NUM_PERCENTILES ==
+                                                               records.size());
+            ASSERTV(pass, ID                   == records[0].metricId());
+            ASSERTV(pass, expected.count() + 1 == records[0].count());
+            ASSERTV(pass, expected.min()       == records[0].min());
+            ASSERTV(pass, 100.0                == records[0].max());
+            ASSERTV(pass, bsl::fabs(expected.total() + 100.0
+                                              - records[0].total()) < 1e-6);
+
+            for (int i = 0; i < NUM_PERCENTILES; ++i) {
+                const Rec&   R        = records[i + 1];
+                const double EXPECTED = expected.percentile(PERCENTILES[i]);
+
+                ASSERTV(pass, i, registry.findId("A", PERCENTILE_NAMES[i]) ==
+                                                                R.metricId());
+                ASSERTV(pass, i, expected.count()    == R.count());
+                ASSERTV(pass, i, EXPECTED            == R.min());
+                ASSERTV(pass, i, EXPECTED            == R.max());
+                ASSERTV(pass, i, EXPECTED * R.count() == R.total());
+            }
+        }
+
+        {
+            // The collectors were reset.
+
+            bsl::vector<Rec> records(Z);
+            mX.collectAndReset(&records, CATEGORY);
+
+            ASSERTV(records.size(), 1 + NUM_PERCENTILES == records.size());
+            ASSERT(Rec(ID) == records[0]);
+            for (int i = 0; i < NUM_PERCENTILES; ++i) {
+                ASSERTV(i, Rec(registry.findId("A", PERCENTILE_NAMES[i])) ==
+                                                               records[i + 1]);
+            }
+        }
+
+        if (veryVerbose) cout << "	Testing 'setHistogramPercentiles'."
+                              << endl;
+
+        {
+            const balm::MetricId ID_B = registry.getId("A", "B");
+            const balm::MetricId ID_C = registry.getId("A", "C");
+
+            bsl::vector<double> percentiles(Z);
+            percentiles.push_back(75.0);
+            percentiles.push_back(99.99);
+
+            mX.setHistogramPercentiles(ID_B, percentiles);
+            mX.getDefaultHistogramCollector(ID_B)->update(1.0);
+
+            ASSERT(!registry.findId("A", "B.p50").isValid());
+
+            mX.getDefaultHistogramCollector(ID_C)->update(2.0);
+            ASSERT(registry.findId("A", "C.p50").isValid());
+
+            mX.setHistogramPercentiles(ID_C, bsl::vector<double>(Z));
+            mX.setHistogramPercentiles(ID, percentiles);
+
+            bsl::vector<Rec> records(Z);
+            mX.collectAndReset(&records, CATEGORY);
+
+            // The records of 'ID', 'ID_B', and 'ID_C' are collected in the
+            // order the metrics were added to the repository.
+
+            ASSERTV(records.size(), 3 + 3 + 1 == records.size());
+
+            ASSERT(ID                                == records[0].metricId());
+            ASSERT(registry.findId("A", "Latency.p75") ==
+                                                        records[1].metricId());
+            ASSERT(registry.findId("A", "Latency.p99.99") ==
+                                                        records[2].metricId());
+
+            ASSERT(ID_B                              == records[3].metricId());
+            ASSERT(1                                 == records[3].count());
+            ASSERT(registry.findId("A", "B.p75")     == records[4].metricId());
+            ASSERT(Rec(records[4].metricId(), 1, 1.0, 1.0, 1.0) ==
+                                                                   records[4]);
+            ASSERT(registry.findId("A", "B.p99.99")  == records[5].metricId());
+            ASSERT(Rec(records[5].metricId(), 1, 1.0, 1.0, 1.0) ==
+                                                                   records[5]);
+
+            ASSERT(Rec(ID_C, 1, 2.0, 2.0, 2.0)       == records[6]);
+        }
 
+        ASSERT(0 == defaultAllocator.numAllocations());
       } break;
       case 8: {
         // --------------------------------------------------------------------
@@ -0,0 +1,188 @@
+// balm_histogram.cpp                                                 -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogram_cpp,"$Id$ $CSID$")
+
+#include <bsl_cmath.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// CLASS METHODS
+double Histogram::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (k_UNDERFLOW_INDEX == index) {
+        return MetricRecord::k_DEFAULT_MAX;                           // RETURN
+    }
+    if (k_OVERFLOW_INDEX == index) {
+        return bsl::ldexp(1.0, k_MAX_EXPONENT);                       // RETURN
+    }
+
+    const int exponent  = (index - 1) / k_NUM_SUB_BUCKETS + k_MIN_EXPONENT;
+    const int subBucket = (index - 1) % k_NUM_SUB_BUCKETS;
+
+    return bsl::ldexp(
+                   1.0 + static_cast<double>(subBucket) / k_NUM_SUB_BUCKETS,
+                   exponent);
+}
+
+double Histogram::bucketUpperBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (k_OVERFLOW_INDEX == index) {
+        return MetricRecord::k_DEFAULT_MIN;                           // RETURN
+    }
+    return bucketLowerBound(index + 1);
+}
+
+// CREATORS
+Histogram::Histogram(bslma::Allocator *basicAllocator)
+: d_buckets(k_NUM_BUCKETS, 0, basicAllocator)
+, d_count(0)
+, d_total(0.0)
+, d_min(MetricRecord::k_DEFAULT_MIN)
+, d_max(MetricRecord::k_DEFAULT_MAX)
+{
+}
+
+Histogram::Histogram(const Histogram&  original,
+                     bslma::Allocator *basicAllocator)
+: d_buckets(original.d_buckets, basicAllocator)
+, d_count(original.d_count)
+, d_total(original.d_total)
+, d_min(original.d_min)
+, d_max(original.d_max)
+{
+}
+
+// MANIPULATORS
+Histogram& Histogram::operator=(const Histogram& rhs)
+{
+    d_buckets = rhs.d_buckets;
+    d_count   = rhs.d_count;
+    d_total   = rhs.d_total;
+    d_min     = rhs.d_min;
+    d_max     = rhs.d_max;
+    return *this;
+}
+
+void Histogram::merge(const Histogram& other)
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i] += other.d_buckets[i];
+    }
+    d_count += other.d_count;
+    accumulateTotalMinMax(other.d_total, other.d_min, other.d_max);
+}
+
+void Histogram::reset()
+{
+    bsl::fill(d_buckets.begin(), d_buckets.end(), 0);
+    d_count = 0;
+    d_total = 0.0;
+    d_min   = MetricRecord::k_DEFAULT_MIN;
+    d_max   = MetricRecord::k_DEFAULT_MAX;
+}
+
+// ACCESSORS
+double Histogram::percentile(double percent) const
+{
+    BSLS_ASSERT(0.0 <= percent);
+    BSLS_ASSERT(percent <= 100.0);
+
+    if (0 == d_count) {
+        return 0.0;                                                   // RETURN
+    }
+    if (0.0 == percent) {
+        return d_min;                                                 // RETURN
+    }
+
+    const bsls::Types::Int64 rank = static_cast<bsls::Types::Int64>(
+                   bsl::ceil(percent * static_cast<double>(d_count) / 100.0));
+    if (rank >= d_count) {
+        return d_max;                                                 // RETURN
+    }
+
+    int                index      = 0;
+    bsls::Types::Int64 cumulative = d_buckets[0];
+    while (cumulative < rank) {
+        cumulative += d_buckets[++index];
+    }
+
+    double estimate;
+    if (k_UNDERFLOW_INDEX == index) {
+        estimate = 0.0;
+    }
+    else if (k_OVERFLOW_INDEX == index) {
+        estimate = bsl::max(d_max, bucketLowerBound(index));
+    }
+    else {
+        estimate = (bucketLowerBound(index) + bucketUpperBound(index)) / 2;
+    }
+
+    // The minimum and maximum may not account for every value counted in the
+    // buckets if they were supplied separately (see 'accumulateBucket'), in
+    // which case the estimate is not bounded by them.
+
+    if (d_min <= d_max) {
+        estimate = bsl::max(d_min, bsl::min(d_max, estimate));
+    }
+    return estimate;
+}
+
+bsl::ostream& Histogram::print(bsl::ostream& stream) const
+{
+    stream << "[ " << d_count
+           << " " << d_total
+           << " " << d_min
+           << " " << d_max
+           << " {";
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        if (d_buckets[i]) {
+            stream << " " << i << ":" << d_buckets[i];
+        }
+    }
+    stream << " } ]";
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool balm::operator==(const Histogram& lhs, const Histogram& rhs)
+{
+    return lhs.d_count   == rhs.d_count
+        && lhs.d_total   == rhs.d_total
+        && lhs.d_min     == rhs.d_min
+        && lhs.d_max     == rhs.d_max
+        && lhs.d_buckets == rhs.d_buckets;
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,420 @@
+// balm_histogram.h                                                   -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAM
+#define INCLUDED_BALM_HISTOGRAM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size, mergeable log-linear histogram of values.
+//
+//@CLASSES:
+//   balm::Histogram: a log-linear histogram of metric values
+//
+//@SEE_ALSO: balm_histogramcollector, balm_collectorrepository
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'balm::Histogram', that records the distribution of a set of 'double'
+// values (typically latencies) in a fixed number of buckets, so that
+// percentiles (e.g., the median, or the 99th percentile) of the recorded
+// values can be estimated.  In addition to the bucket counts, a
+// 'balm::Histogram' maintains the exact count, total, minimum, and maximum of
+// the recorded values.
+//
+// The buckets are laid out in the same log-linear fashion as an "HDR"
+// histogram: the range of positive values '[2^-40, 2^40)' is divided into one
+// group of buckets per power of two, and each of those groups is divided into
+// 32 equally sized buckets.  The width of a bucket is therefore at most 1/32
+// of its lower bound, and the bucket a value belongs to is computed directly
+// from the exponent and the leading bits of the mantissa of its
+// representation (i.e., without any search).  Two additional buckets hold,
+// respectively, the values below '2^-40' (including zero, negative values,
+// and NaN) and the values greater than or equal to '2^40'.  Because the
+// bucket boundaries do not depend on the recorded values, two histograms can
+// be merged by adding their bucket counts, which makes 'balm::Histogram'
+// suitable for aggregating values recorded by several collectors.
+//
+// The 'percentile' accessor estimates a percentile of the recorded values
+// using the nearest-rank method: the bucket holding the value of the
+// requested rank is found by accumulating the bucket counts, and the midpoint
+// of that bucket (bounded by the exact minimum and maximum of the recorded
+// values) is returned.  The relative error of the estimate of a value within
+// '[2^-40, 2^40)' is therefore at most 1/64 (about 1.6%).  Note that the
+// 0th and the 100th percentiles are the exact minimum and maximum values.
+//
+///Thread Safety
+///-------------
+// 'balm::Histogram' is *const* *thread-safe*, meaning that accessors may be
+// invoked concurrently from different threads, but it is not safe to access
+// or modify a 'balm::Histogram' in one thread while another thread modifies
+// the same object.  See 'balm_histogramcollector' for a thread-safe mechanism
+// recording values into a histogram.
+//
+///Usage
+///-----
+// The following example demonstrates how to record a set of latencies into a
+// 'balm::Histogram' and estimate percentiles of the recorded latencies.
+//
+// First, we create a histogram and record the latencies, in milliseconds, of
+// 100 requests, where one in ten requests takes 50 times longer than the
+// others:
+//..
+//  balm::Histogram histogram;
+//
+//  for (int i = 0; i < 100; ++i) {
+//      histogram.update(i % 10 == 9 ? 100.0 : 2.0);
+//  }
+//..
+// Then, we verify the exact aggregates maintained by the histogram:
+//..
+//  assert(100    == histogram.count());
+//  assert(1180.0 == histogram.total());
+//  assert(2.0    == histogram.min());
+//  assert(100.0  == histogram.max());
+//..
+// Finally, we estimate the median and the 95th percentile of the latencies.
+// The estimates are within the precision of a bucket (1/64 of the value) of
+// the actual percentiles:
+//..
+//  const double median = histogram.percentile(50.0);
+//  const double p95    = histogram.percentile(95.0);
+//
+//  assert(2.0  <= median && median <= 2.0  * (1 + 1.0 / 64));
+//  assert(98.0 <= p95    && p95    <= 100.0);
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricrecord.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_iosfwd.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                              // ===============
+                              // class Histogram
+                              // ===============
+
+class Histogram {
+    // This class provides a value-semantic type recording the distribution
+    // of a set of values in a fixed number of log-linear buckets, as well as
+    // the exact count, total, minimum, and maximum of those values.  The
+    // default value of a histogram has no recorded values: a count of 0, a
+    // total of 0.0, a minimum of 'MetricRecord::k_DEFAULT_MIN' (positive
+    // infinity), a maximum of 'MetricRecord::k_DEFAULT_MAX' (negative
+    // infinity), and every bucket count equal to 0.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_MIN_EXPONENT    = -40,  // binary exponent of the lowest value
+                                  // having its own bucket
+
+        k_MAX_EXPONENT    =  40,  // binary exponent of the lowest value
+                                  // held in the overflow bucket
+
+        k_SUB_BUCKET_BITS =   5,  // number of mantissa bits selecting a
+                                  // bucket within a power of two
+
+        k_NUM_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS,
+                                  // number of buckets per power of two
+
+        k_UNDERFLOW_INDEX = 0,    // index of the bucket holding the values
+                                  // less than '2^k_MIN_EXPONENT'
+
+        k_OVERFLOW_INDEX  = 1 + (k_MAX_EXPONENT - k_MIN_EXPONENT)
+                                                         * k_NUM_SUB_BUCKETS,
+                                  // index of the bucket holding the values
+                                  // not less than '2^k_MAX_EXPONENT'
+
+        k_NUM_BUCKETS     = k_OVERFLOW_INDEX + 1
+                                  // total number of buckets
+    };
+
+  private:
+    // DATA
+    bsl::vector<bsls::Types::Int64> d_buckets;  // count of values per bucket
+    bsls::Types::Int64              d_count;    // count of values
+    double                          d_total;    // total of values
+    double                          d_min;      // minimum value
+    double                          d_max;      // maximum value
+
+    // FRIENDS
+    friend bool operator==(const Histogram&, const Histogram&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Histogram, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int bucketIndex(double value);
+        // Return the index of the bucket holding the specified 'value'.
+
+    static double bucketLowerBound(int index);
+        // Return the lowest value held in the bucket having the specified
+        // 'index', or negative infinity if 'index' is 'k_UNDERFLOW_INDEX'.
+        // The behavior is undefined unless '0 <= index < k_NUM_BUCKETS'.
+
+    static double bucketUpperBound(int index);
+        // Return the lowest value greater than every value held in the
+        // bucket having the specified 'index', or positive infinity if
+        // 'index' is 'k_OVERFLOW_INDEX'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    explicit Histogram(bslma::Allocator *basicAllocator = 0);
+        // Create a histogram having no recorded values.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    Histogram(const Histogram&  original,
+              bslma::Allocator *basicAllocator = 0);
+        // Create a histogram having the same value as the specified
+        // 'original' histogram.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    //! ~Histogram() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    Histogram& operator=(const Histogram& rhs);
+        // Assign to this histogram the value of the specified 'rhs'
+        // histogram, and return a reference to this modifiable histogram.
+
+    void accumulateBucket(int index, bsls::Types::Int64 count);
+        // Add the specified 'count' to the count of the bucket having the
+        // specified 'index' and to the count of values of this histogram.
+        // The behavior is undefined unless '0 <= index < k_NUM_BUCKETS' and
+        // '0 <= count'.  Note that this method does not update the total,
+        // minimum, and maximum of this histogram (see
+        // 'accumulateTotalMinMax').
+
+    void accumulateTotalMinMax(double total, double min, double max);
+        // Add the specified 'total' to the total of this histogram, if the
+        // specified 'min' is less than the minimum value, set 'min' to be the
+        // minimum value, and if the specified 'max' is greater than the
+        // maximum value, set 'max' to be the maximum value.  Note that this
+        // method does not update the count of values of this histogram (see
+        // 'accumulateBucket').
+
+    void merge(const Histogram& other);
+        // Add the values recorded by the specified 'other' histogram to this
+        // histogram.
+
+    void reset();
+        // Reset this histogram to its default value (i.e., having no recorded
+        // values).
+
+    void update(double value);
+        // Record the specified 'value' in this histogram.
+
+    // ACCESSORS
+    bsls::Types::Int64 bucketCount(int index) const;
+        // Return the number of recorded values held in the bucket having the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    bsls::Types::Int64 count() const;
+        // Return the number of recorded values.
+
+    double total() const;
+        // Return the total of the recorded values.
+
+    double min() const;
+        // Return the minimum recorded value, or 'MetricRecord::k_DEFAULT_MIN'
+        // if no value was recorded.
+
+    double max() const;
+        // Return the maximum recorded value, or 'MetricRecord::k_DEFAULT_MAX'
+        // if no value was recorded.
+
+    double percentile(double percent) const;
+        // Return an estimate of the specified 'percent' percentile of the
+        // recorded values, or 0.0 if no value was recorded.  The estimate is
+        // the midpoint of the bucket holding the recorded value of rank
+        // 'ceil(percent / 100 * count())' (or of rank 1 if that is 0),
+        // bounded by 'min()' and 'max()'; the 0th and 100th percentiles are
+        // 'min()' and 'max()' respectively.  The behavior is undefined unless
+        // '0 <= percent <= 100'.
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Print to the specified 'stream' a single-line description of the
+        // count, total, minimum, maximum, and non-empty buckets of this
+        // histogram, and return a reference to the modifiable 'stream'.
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// FREE OPERATORS
+bool operator==(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms have the same
+    // value, and 'false' otherwise.  Two histograms have the same value if
+    // they have the same count, total, minimum, maximum, and bucket counts.
+
+bool operator!=(const Histogram& lhs, const Histogram& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' histograms do not have
+    // the same value, and 'false' otherwise.  Two histograms do not have the
+    // same value if they differ in their count, total, minimum, maximum, or
+    // any of their bucket counts.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const Histogram& rhs);
+    // Write a description of the specified 'rhs' histogram to the specified
+    // 'stream' in some human-readable format, and return a reference to the
+    // modifiable 'stream'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // ---------------
+                              // class Histogram
+                              // ---------------
+
+// CLASS METHODS
+inline
+int Histogram::bucketIndex(double value)
+{
+    // The bounds of the bucketed range are powers of two, so the bucket of a
+    // value within that range is selected by the exponent and the leading
+    // bits of the mantissa of its IEEE-754 representation.
+
+    const bsls::Types::Uint64 k_ONE = 1;
+    const double              k_LOWER = 1.0 / static_cast<double>(
+                                                k_ONE << -k_MIN_EXPONENT);
+    const double              k_UPPER = static_cast<double>(
+                                                 k_ONE << k_MAX_EXPONENT);
+
+    if (!(value >= k_LOWER)) {  // also true if 'value' is NaN
+        return k_UNDERFLOW_INDEX;                                     // RETURN
+    }
+    if (value >= k_UPPER) {
+        return k_OVERFLOW_INDEX;                                      // RETURN
+    }
+
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+
+    const int exponent  = static_cast<int>(bits >> 52) - 1023;
+    const int subBucket = static_cast<int>(bits >> (52 - k_SUB_BUCKET_BITS))
+                        & (k_NUM_SUB_BUCKETS - 1);
+
+    return 1 + (exponent - k_MIN_EXPONENT) * k_NUM_SUB_BUCKETS + subBucket;
+}
+
+// MANIPULATORS
+inline
+void Histogram::accumulateBucket(int index, bsls::Types::Int64 count)
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+    BSLS_ASSERT_SAFE(0 <= count);
+
+    d_buckets[index] += count;
+    d_count          += count;
+}
+
+inline
+void Histogram::accumulateTotalMinMax(double total, double min, double max)
+{
+    d_total += total;
+    d_min   =  bsl::min(d_min, min);
+    d_max   =  bsl::max(d_max, max);
+}
+
+inline
+void Histogram::update(double value)
+{
+    ++d_buckets[bucketIndex(value)];
+    ++d_count;
+    d_total += value;
+    d_min   =  bsl::min(d_min, value);
+    d_max   =  bsl::max(d_max, value);
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 Histogram::bucketCount(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < k_NUM_BUCKETS);
+
+    return d_buckets[index];
+}
+
+inline
+bsls::Types::Int64 Histogram::count() const
+{
+    return d_count;
+}
+
+inline
+double Histogram::total() const
+{
+    return d_total;
+}
+
+inline
+double Histogram::min() const
+{
+    return d_min;
+}
+
+inline
+double Histogram::max() const
+{
+    return d_max;
+}
+
+inline
+bslma::Allocator *Histogram::allocator() const
+{
+    return d_buckets.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool balm::operator!=(const Histogram& lhs, const Histogram& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& balm::operator<<(bsl::ostream& stream, const Histogram& rhs)
+{
+    return rhs.print(stream);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,802 @@
+// balm_histogram.t.cpp                                               -*-C++-*-
+#include <balm_histogram.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::Histogram' is a value-semantic type recording values in log-linear
+// buckets.  We verify that the bucket of a value is consistent with the
+// bounds of the buckets, that the exact aggregates and bucket counts are
+// maintained by the manipulators, and that the estimated percentiles are
+// within the precision of a bucket of the exact percentiles.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int bucketIndex(double value);
+// [ 2] static double bucketLowerBound(int index);
+// [ 2] static double bucketUpperBound(int index);
+//
+// CREATORS
+// [ 3] explicit Histogram(bslma::Allocator *basicAllocator = 0);
+// [ 4] Histogram(const Histogram& original, bslma::Allocator *ba = 0);
+//
+// MANIPULATORS
+// [ 4] Histogram& operator=(const Histogram& rhs);
+// [ 5] void accumulateBucket(int index, bsls::Types::Int64 count);
+// [ 5] void accumulateTotalMinMax(double total, double min, double max);
+// [ 5] void merge(const Histogram& other);
+// [ 3] void reset();
+// [ 3] void update(double value);
+//
+// ACCESSORS
+// [ 3] bsls::Types::Int64 bucketCount(int index) const;
+// [ 3] bsls::Types::Int64 count() const;
+// [ 3] double total() const;
+// [ 3] double min() const;
+// [ 3] double max() const;
+// [ 6] double percentile(double percent) const;
+// [ 7] bsl::ostream& print(bsl::ostream& stream) const;
+// [ 3] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const Histogram& lhs, const Histogram& rhs);
+// [ 4] bool operator!=(const Histogram& lhs, const Histogram& rhs);
+// [ 7] bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::Histogram    Obj;
+typedef bsls::Types::Int64 Int64;
+
+const double k_INF       = bsl::numeric_limits<double>::infinity();
+const double k_NAN       = bsl::numeric_limits<double>::quiet_NaN();
+const double k_PRECISION = 1.0 / 64;  // relative precision of an estimate
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+double exactPercentile(bsl::vector<double> values, double percent)
+    // Return the specified 'percent' percentile of the specified 'values',
+    // computed using the nearest-rank method.  The behavior is undefined
+    // unless 'values' is not empty.
+{
+    bsl::sort(values.begin(), values.end());
+    Int64 rank = static_cast<Int64>(
+                       bsl::ceil(percent * static_cast<double>(values.size())
+                                                                     / 100.0));
+    rank = bsl::max<Int64>(rank, 1);
+    return values[static_cast<bsl::size_t>(rank - 1)];
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// The following example demonstrates how to record a set of latencies into a
+// 'balm::Histogram' and estimate percentiles of the recorded latencies.
+//
+// First, we create a histogram and record the latencies, in milliseconds, of
+// 100 requests, where one in ten requests takes 50 times longer than the
+// others:
+//..
+    balm::Histogram histogram;
+
+    for (int i = 0; i < 100; ++i) {
+        histogram.update(i % 10 == 9 ? 100.0 : 2.0);
+    }
+//..
+// Then, we verify the exact aggregates maintained by the histogram:
+//..
+    ASSERT(100    == histogram.count());
+    ASSERT(1180.0 == histogram.total());
+    ASSERT(2.0    == histogram.min());
+    ASSERT(100.0  == histogram.max());
+//..
+// Finally, we estimate the median and the 95th percentile of the latencies.
+// The estimates are within the precision of a bucket (1/64 of the value) of
+// the actual percentiles:
+//..
+    const double median = histogram.percentile(50.0);
+    const double p95    = histogram.percentile(95.0);
+
+    ASSERT(2.0  <= median && median <= 2.0  * (1 + 1.0 / 64));
+    ASSERT(98.0 <= p95    && p95    <= 100.0);
+//..
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING: 'print' and 'operator<<'
+        //
+        // Concerns:
+        //: 1 'print' writes the count, total, minimum, and maximum, followed
+        //:   by the index and count of each non-empty bucket.
+        //:
+        //: 2 'operator<<' produces the same output as 'print'.
+        //
+        // Plan:
+        //: 1 Print a default object and an object having recorded values,
+        //:   and compare the output to the expected strings.  (C-1..2)
+        //
+        // Testing:
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        //   bsl::ostream& operator<<(bsl::ostream&, const Histogram&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: 'print' and 'operator<<'"
+                          << endl << "================================="
+                          << endl;
+
+        Obj mX; const Obj& X = mX;
+
+        {
+            bsl::ostringstream os;
+            X.print(os);
+            ASSERTV(os.str(), "[ 0 0 inf -inf { } ]" == os.str());
+        }
+
+        mX.update(1.0);
+        mX.update(1.0);
+        mX.update(3.0);
+
+        const int INDEX_1 = Obj::bucketIndex(1.0);
+        const int INDEX_3 = Obj::bucketIndex(3.0);
+
+        bsl::ostringstream expected;
+        expected << "[ 3 5 1 3 { " << INDEX_1 << ":2 " << INDEX_3 << ":1 } ]";
+
+        bsl::ostringstream os1, os2;
+        X.print(os1);
+        os2 << X;
+
+        ASSERTV(os1.str(), expected.str() == os1.str());
+        ASSERTV(os2.str(), expected.str() == os2.str());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING: 'percentile'
+        //
+        // Concerns:
+        //: 1 'percentile' returns 0.0 if no value was recorded.
+        //:
+        //: 2 The 0th and 100th percentiles are the exact minimum and maximum.
+        //:
+        //: 3 Other percentiles are within the precision of a bucket of the
+        //:   exact percentile computed using the nearest-rank method, and
+        //:   are bounded by the minimum and maximum.
+        //:
+        //: 4 Percentiles falling in the underflow bucket are estimated as 0
+        //:   (bounded by the minimum and maximum), and percentiles falling in
+        //:   the overflow bucket as the maximum.
+        //
+        // Plan:
+        //: 1 Call 'percentile' on a default object.  (C-1)
+        //:
+        //: 2 For a set of distributions of values, record the values and
+        //:   compare the estimated percentiles to the exact percentiles for a
+        //:   set of percents.  (C-2..3)
+        //:
+        //: 3 Record values below and above the bucketed range, and verify
+        //:   the estimated percentiles.  (C-4)
+        //
+        // Testing:
+        //   double percentile(double percent) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: 'percentile'"
+                          << endl << "====================="
+                          << endl;
+
+        {
+            Obj mX; const Obj& X = mX;
+
+            ASSERT(0.0 == X.percentile(0.0));
+            ASSERT(0.0 == X.percentile(50.0));
+            ASSERT(0.0 == X.percentile(100.0));
+        }
+
+        const double PERCENTS[] = { 0.0, 1.0, 10.0, 25.0, 50.0, 75.0,
+                                    90.0, 99.0, 99.9, 100.0 };
+        const int    NUM_PERCENTS = sizeof PERCENTS / sizeof *PERCENTS;
+
+        enum { k_UNIFORM, k_EXPONENTIAL, k_BIMODAL, k_CONSTANT,
+               k_NUM_DISTRIBUTIONS };
+
+        for (int d = 0; d < k_NUM_DISTRIBUTIONS; ++d) {
+            Obj                 mX; const Obj& X = mX;
+            bsl::vector<double> values;
+
+            for (int i = 1; i <= 1000; ++i) {
+                double value = 0;
+                switch (d) {
+                  case k_UNIFORM:     value = i * 0.37;                break;
+                  case k_EXPONENTIAL: value = bsl::exp(i / 50.0) / 1e6; break;
+                  case k_BIMODAL:     value = i % 7 ? 1e-3 + i * 1e-9
+                                                    : 2.5 + i * 1e-6;  break;
+                  case k_CONSTANT:    value = 42.0;                    break;
+                }
+                values.push_back(value);
+                mX.update(value);
+            }
+
+            for (int j = 0; j < NUM_PERCENTS; ++j) {
+                const double PERCENT  = PERCENTS[j];
+                const double EXPECTED = exactPercentile(values, PERCENT);
+                const double ESTIMATE = X.percentile(PERCENT);
+
+                if (veryVerbose) {
+                    P_(d) P_(PERCENT) P_(EXPECTED) P(ESTIMATE);
+                }
+
+                if (0.0 == PERCENT) {
+                    ASSERTV(d, X.min() == ESTIMATE);
+                }
+                else if (100.0 == PERCENT) {
+                    ASSERTV(d, X.max() == ESTIMATE);
+                }
+                ASSERTV(d, PERCENT, EXPECTED, ESTIMATE,
+                        bsl::fabs(ESTIMATE - EXPECTED)
+                                               <= EXPECTED * k_PRECISION);
+                ASSERTV(d, PERCENT, X.min() <= ESTIMATE);
+                ASSERTV(d, PERCENT, ESTIMATE <= X.max());
+            }
+        }
+
+        {
+            Obj mX; const Obj& X = mX;
+
+            mX.update(-5.0);
+            mX.update(0.0);
+            mX.update(1e-20);
+            mX.update(1.0);
+            mX.update(1e20);
+            mX.update(2e20);
+
+            ASSERTV(X.percentile(10.0),  0.0 == X.percentile(10.0));
+            ASSERTV(X.percentile(30.0),  0.0 == X.percentile(30.0));
+            ASSERTV(X.percentile(45.0),  0.0 == X.percentile(45.0));
+            ASSERTV(X.percentile(60.0),
+                    bsl::fabs(X.percentile(60.0) - 1.0) <= k_PRECISION);
+            ASSERTV(X.percentile(80.0), 2e20 == X.percentile(80.0));
+            ASSERTV(X.percentile(100.0), 2e20 == X.percentile(100.0));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING: 'accumulateBucket', 'accumulateTotalMinMax', 'merge'
+        //
+        // Concerns:
+        //: 1 'accumulateBucket' adds to the count of the bucket and to the
+        //:   count of the histogram, and does not modify the total, minimum,
+        //:   or maximum.
+        //:
+        //: 2 'accumulateTotalMinMax' adds to the total and updates the
+        //:   minimum and maximum, and does not modify the counts.
+        //:
+        //: 3 Merging two histograms produces the same value as recording the
+        //:   values of both histograms in a single histogram.
+        //
+        // Plan:
+        //: 1 Call 'accumulateBucket' and 'accumulateTotalMinMax' on a default
+        //:   object and verify its value.  (C-1..2)
+        //:
+        //: 2 Record disjoint sets of values in two histograms and in a third
+        //:   histogram, merge the first two, and compare the result to the
+        //:   third.  (C-3)
+        //
+        // Testing:
+        //   void accumulateBucket(int index, bsls::Types::Int64 count);
+        //   void accumulateTotalMinMax(double total, double min, double max);
+        //   void merge(const Histogram& other);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: 'accumulateBucket', "
+                          << "'accumulateTotalMinMax', 'merge'"
+                          << endl << "============================"
+                          << "================================"
+                          << endl;
+
+        {
+            Obj mX; const Obj& X = mX;
+
+            mX.accumulateBucket(17, 3);
+            mX.accumulateBucket(Obj::k_OVERFLOW_INDEX, 2);
+            mX.accumulateBucket(17, 1);
+
+            ASSERT(6                      == X.count());
+            ASSERT(4                      == X.bucketCount(17));
+            ASSERT(2                      == X.bucketCount(
+                                                     Obj::k_OVERFLOW_INDEX));
+            ASSERT(0.0                    == X.total());
+            ASSERT(balm::MetricRecord::k_DEFAULT_MIN == X.min());
+            ASSERT(balm::MetricRecord::k_DEFAULT_MAX == X.max());
+
+            mX.accumulateTotalMinMax(10.0, 2.0, 3.0);
+            mX.accumulateTotalMinMax(5.0, 1.0, 2.5);
+
+            ASSERT(6    == X.count());
+            ASSERT(15.0 == X.total());
+            ASSERT(1.0  == X.min());
+            ASSERT(3.0  == X.max());
+        }
+
+        {
+            Obj mA; const Obj& A = mA;
+            Obj mB; const Obj& B = mB;
+            Obj mC; const Obj& C = mC;
+
+            for (int i = 0; i < 100; ++i) {
+                const double VALUE = (i - 10) * 1.5;
+                if (i % 3) {
+                    mA.update(VALUE);
+                }
+                else {
+                    mB.update(VALUE);
+                }
+                mC.update(VALUE);
+            }
+            ASSERT(A != C);
+            ASSERT(B != C);
+
+            mA.merge(B);
+            ASSERT(A == C);
+
+            Obj mD; const Obj& D = mD;
+            mD.merge(C);
+            ASSERT(D == C);
+
+            mD.merge(Obj());
+            ASSERT(D == C);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING: COPY CONSTRUCTOR, ASSIGNMENT, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Two histograms compare equal if and only if they have the same
+        //:   count, total, minimum, maximum, and bucket counts.
+        //:
+        //: 2 The copy constructor and the assignment operator produce an
+        //:   object having the same value as the source, and the copy uses
+        //:   the supplied allocator.
+        //
+        // Plan:
+        //: 1 Create objects recording different sets of values, and compare
+        //:   them.  Also compare objects differing only in the total, or in
+        //:   the bucket counts.  (C-1)
+        //:
+        //: 2 Copy and assign each object, and compare the result to the
+        //:   source.  (C-2)
+        //
+        // Testing:
+        //   Histogram(const Histogram& original, bslma::Allocator *ba = 0);
+        //   Histogram& operator=(const Histogram& rhs);
+        //   bool operator==(const Histogram& lhs, const Histogram& rhs);
+        //   bool operator!=(const Histogram& lhs, const Histogram& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: COPY CONSTRUCTOR, ASSIGNMENT, EQUALITY"
+                          << endl
+                          << "=============================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        const double VALUES[] = { 0.0, 1.0, 2.0, 1e9, -3.0 };
+        const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        bsl::vector<Obj> objects;
+        for (int i = 0; i <= NUM_VALUES; ++i) {
+            Obj mX;
+            for (int j = 0; j < i; ++j) {
+                mX.update(VALUES[j]);
+            }
+            objects.push_back(mX);
+        }
+
+        for (int i = 0; i < static_cast<int>(objects.size()); ++i) {
+            for (int j = 0; j < static_cast<int>(objects.size()); ++j) {
+                ASSERTV(i, j, (i == j) == (objects[i] == objects[j]));
+                ASSERTV(i, j, (i != j) == (objects[i] != objects[j]));
+            }
+
+            const Obj& X = objects[i];
+
+            Obj mY(X, &ta); const Obj& Y = mY;
+            ASSERTV(i, X == Y);
+            ASSERTV(i, &ta == Y.allocator());
+
+            Obj mZ(&ta); const Obj& Z = mZ;
+            mZ.update(12345.0);
+            mZ = X;
+            ASSERTV(i, X == Z);
+            ASSERTV(i, &ta == Z.allocator());
+        }
+
+        {
+            Obj mX; const Obj& X = mX;
+            Obj mY; const Obj& Y = mY;
+
+            mX.update(1.0);
+            mY.accumulateBucket(Obj::bucketIndex(1.0), 1);
+            ASSERT(X != Y);
+            mY.accumulateTotalMinMax(1.0, 1.0, 1.0);
+            ASSERT(X == Y);
+
+            mY.accumulateTotalMinMax(0.5, 1.0, 1.0);
+            ASSERT(X != Y);
+        }
+        ASSERT(0 < ta.numAllocations());
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING: PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default object has no recorded values.
+        //:
+        //: 2 The memory of the object is supplied by the supplied allocator,
+        //:   or by the default allocator if none is supplied, and is
+        //:   allocated at construction only.
+        //:
+        //: 3 'update' increments the count and the count of the bucket of the
+        //:   value, adds the value to the total, and updates the minimum and
+        //:   maximum.
+        //:
+        //: 4 'reset' restores the default value.
+        //
+        // Plan:
+        //: 1 Create an object with and without a test allocator, and verify
+        //:   its value and its allocations.  (C-1..2)
+        //:
+        //: 2 Record a sequence of values, and verify the value of the object
+        //:   after each update.  (C-3)
+        //:
+        //: 3 Reset the object and verify its value.  (C-4)
+        //
+        // Testing:
+        //   explicit Histogram(bslma::Allocator *basicAllocator = 0);
+        //   void reset();
+        //   void update(double value);
+        //   bsls::Types::Int64 bucketCount(int index) const;
+        //   bsls::Types::Int64 count() const;
+        //   double total() const;
+        //   double min() const;
+        //   double max() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: PRIMARY MANIPULATORS AND ACCESSORS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::TestAllocator         ta("test", veryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        {
+            Obj mX; const Obj& X = mX;
+            ASSERT(&da == X.allocator());
+            ASSERT(1   == da.numAllocations());
+        }
+
+        Obj mX(&ta); const Obj& X = mX;
+
+        ASSERT(&ta == X.allocator());
+        ASSERT(1   == ta.numAllocations());
+        ASSERT(1   == da.numAllocations());
+
+        ASSERT(0                                 == X.count());
+        ASSERT(0.0                               == X.total());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MIN == X.min());
+        ASSERT(balm::MetricRecord::k_DEFAULT_MAX == X.max());
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            ASSERTV(i, 0 == X.bucketCount(i));
+        }
+
+        const struct {
+            int    d_line;
+            double d_value;
+            Int64  d_count;
+            double d_total;
+            double d_min;
+            double d_max;
+        } DATA[] = {
+            // LINE  VALUE  COUNT  TOTAL  MIN   MAX
+            // ----  -----  -----  -----  ---   ---
+            {  L_,    2.0,      1,   2.0,  2.0,  2.0 },
+            {  L_,    2.0,      2,   4.0,  2.0,  2.0 },
+            {  L_,    0.5,      3,   4.5,  0.5,  2.0 },
+            {  L_,   -1.5,      4,   3.0, -1.5,  2.0 },
+            {  L_,   10.0,      5,  13.0, -1.5, 10.0 },
+            {  L_,    0.0,      6,  13.0, -1.5, 10.0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int    LINE  = DATA[i].d_line;
+            const double VALUE = DATA[i].d_value;
+            const int    INDEX = Obj::bucketIndex(VALUE);
+            const Int64  PREV  = X.bucketCount(INDEX);
+
+            mX.update(VALUE);
+
+            ASSERTV(LINE, DATA[i].d_count == X.count());
+            ASSERTV(LINE, DATA[i].d_total == X.total());
+            ASSERTV(LINE, DATA[i].d_min   == X.min());
+            ASSERTV(LINE, DATA[i].d_max   == X.max());
+            ASSERTV(LINE, PREV + 1        == X.bucketCount(INDEX));
+        }
+        ASSERT(2 == X.bucketCount(Obj::bucketIndex(2.0)));
+        ASSERT(2 == X.bucketCount(Obj::k_UNDERFLOW_INDEX));
+
+        mX.reset();
+
+        ASSERT(Obj(&ta) == X);
+        ASSERT(2 == ta.numAllocations());  // including the temporary
+        ASSERT(1 == da.numAllocations());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING: CLASS METHODS
+        //
+        // Concerns:
+        //: 1 Every value within the bucketed range is assigned to the bucket
+        //:   whose bounds enclose it.
+        //:
+        //: 2 The buckets are contiguous, increasing, and their width is at
+        //:   most 1/32 of their lower bound.
+        //:
+        //: 3 Zero, negative values, NaN, and values below the bucketed range
+        //:   are assigned to the underflow bucket; values above the range,
+        //:   including infinity, to the overflow bucket.
+        //
+        // Plan:
+        //: 1 For each bucket, verify that its lower bound, the value
+        //:   immediately below its upper bound, and its midpoint are assigned
+        //:   to it, and that its bounds are consistent with its neighbours.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify the bucket of a set of special values.  (C-3)
+        //
+        // Testing:
+        //   static int bucketIndex(double value);
+        //   static double bucketLowerBound(int index);
+        //   static double bucketUpperBound(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: CLASS METHODS"
+                          << endl << "======================"
+                          << endl;
+
+        ASSERT(1 + 80 * 32 == Obj::k_OVERFLOW_INDEX);
+        ASSERT(Obj::k_OVERFLOW_INDEX + 1 == Obj::k_NUM_BUCKETS);
+
+        for (int i = 1; i < Obj::k_OVERFLOW_INDEX; ++i) {
+            const double LOWER = Obj::bucketLowerBound(i);
+            const double UPPER = Obj::bucketUpperBound(i);
+            const double BELOW_UPPER = bsl::nextafter(UPPER, 0.0);
+
+            ASSERTV(i, LOWER < UPPER);
+            ASSERTV(i, UPPER - LOWER <= LOWER / 32);
+            ASSERTV(i, LOWER == Obj::bucketUpperBound(i - 1));
+            ASSERTV(i, i == Obj::bucketIndex(LOWER));
+            ASSERTV(i, i == Obj::bucketIndex(BELOW_UPPER));
+            ASSERTV(i, i == Obj::bucketIndex((LOWER + UPPER) / 2));
+            ASSERTV(i, i + 1 == Obj::bucketIndex(UPPER));
+        }
+
+        ASSERT(-k_INF == Obj::bucketLowerBound(Obj::k_UNDERFLOW_INDEX));
+        ASSERT(bsl::ldexp(1.0, -40) ==
+                                Obj::bucketUpperBound(Obj::k_UNDERFLOW_INDEX));
+        ASSERT(bsl::ldexp(1.0,  40) ==
+                                 Obj::bucketLowerBound(Obj::k_OVERFLOW_INDEX));
+        ASSERT(k_INF == Obj::bucketUpperBound(Obj::k_OVERFLOW_INDEX));
+
+        const struct {
+            int    d_line;
+            double d_value;
+            int    d_index;
+        } DATA[] = {
+            // LINE  VALUE                            INDEX
+            // ----  -----                            -----
+            {  L_,   0.0,                             Obj::k_UNDERFLOW_INDEX },
+            {  L_,   -0.0,                            Obj::k_UNDERFLOW_INDEX },
+            {  L_,   -1.0,                            Obj::k_UNDERFLOW_INDEX },
+            {  L_,   -k_INF,                          Obj::k_UNDERFLOW_INDEX },
+            {  L_,   k_NAN,                           Obj::k_UNDERFLOW_INDEX },
+            {  L_,   1e-300,                          Obj::k_UNDERFLOW_INDEX },
+            {  L_,   bsl::ldexp(1.0, -41),            Obj::k_UNDERFLOW_INDEX },
+            {  L_,   bsl::ldexp(1.0, -40),            1                      },
+            {  L_,   1.0,                             1 + 40 * 32            },
+            {  L_,   1.5,                             1 + 40 * 32 + 16       },
+            {  L_,   2.0,                             1 + 41 * 32            },
+            {  L_,   bsl::ldexp(1.0, 40),             Obj::k_OVERFLOW_INDEX  },
+            {  L_,   1e300,                           Obj::k_OVERFLOW_INDEX  },
+            {  L_,   k_INF,                           Obj::k_OVERFLOW_INDEX  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const int    LINE  = DATA[i].d_line;
+            const double VALUE = DATA[i].d_value;
+            const int    INDEX = DATA[i].d_index;
+
+            ASSERTV(LINE, INDEX, Obj::bucketIndex(VALUE),
+                    INDEX == Obj::bucketIndex(VALUE));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Record values, estimate percentiles, merge, and reset.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST"
+                          << endl << "==============" << endl;
+
+        Obj mX; const Obj& X = mX;
+        Obj mY; const Obj& Y = mY;
+
+        ASSERT(X == Y);
+
+        for (int i = 1; i <= 100; ++i) {
+            mX.update(i);
+        }
+        ASSERT(X != Y);
+        ASSERT(100    == X.count());
+        ASSERT(5050.0 == X.total());
+        ASSERT(1.0    == X.min());
+        ASSERT(100.0  == X.max());
+
+        const double MEDIAN = X.percentile(50.0);
+        ASSERTV(MEDIAN, bsl::fabs(MEDIAN - 50.0) <= 50.0 * k_PRECISION);
+
+        mY.merge(X);
+        ASSERT(X == Y);
+
+        mY.merge(X);
+        ASSERT(200 == Y.count());
+        ASSERT(MEDIAN == Y.percentile(50.0));
+
+        mX.reset();
+        ASSERT(X == Obj());
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,82 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_total(toBits(0.0))
+, d_min(toBits(MetricRecord::k_DEFAULT_MIN))
+, d_max(toBits(MetricRecord::k_DEFAULT_MAX))
+{
+}
+
+// MANIPULATORS
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(0);
+    }
+    d_total.storeRelaxed(toBits(0.0));
+    d_min.storeRelaxed(toBits(MetricRecord::k_DEFAULT_MIN));
+    d_max.storeRelaxed(toBits(MetricRecord::k_DEFAULT_MAX));
+}
+
+void HistogramCollector::loadAndReset(Histogram *result)
+{
+    result->reset();
+    for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+        // Most buckets are typically empty, so avoid writing to them.
+
+        if (0 != d_buckets[i].loadRelaxed()) {
+            result->accumulateBucket(i, d_buckets[i].swapAcqRel(0));
+        }
+    }
+    result->accumulateTotalMinMax(
+              fromBits(d_total.swapAcqRel(toBits(0.0))),
+              fromBits(d_min.swapAcqRel(toBits(MetricRecord::k_DEFAULT_MIN))),
+              fromBits(d_max.swapAcqRel(toBits(MetricRecord::k_DEFAULT_MAX))));
+}
+
+// ACCESSORS
+void HistogramCollector::load(Histogram *result) const
+{
+    result->reset();
+    for (int i = 0; i < Histogram::k_NUM_BUCKETS; ++i) {
+        const bsls::Types::Int64 count = d_buckets[i].loadAcquire();
+        if (0 != count) {
+            result->accumulateBucket(i, count);
+        }
+    }
+    result->accumulateTotalMinMax(fromBits(d_total.loadAcquire()),
+                                  fromBits(d_min.loadAcquire()),
+                                  fromBits(d_max.loadAcquire()));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,271 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free container collecting a histogram of values.
+//
+//@CLASSES:
+//   balm::HistogramCollector: a lock-free collector of a histogram of values
+//
+//@SEE_ALSO: balm_histogram, balm_collectorrepository,
+//           balm_stopwatchscopedguard
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// for collecting the distribution of the values of a metric (typically a
+// latency), so that percentiles of those values can be published in addition
+// to their count, total, minimum, and maximum.  A 'balm::HistogramCollector'
+// holds the same fixed set of log-linear buckets as a 'balm::Histogram' (see
+// 'balm_histogram'), as well as the aggregated total, minimum, and maximum of
+// the recorded values.  The collector provides an 'update' operation that
+// records a value, a 'load' operation that populates a 'balm::Histogram' with
+// the current state of the collector, a 'reset' operation that resets the
+// current state of the collector, and a combined 'loadAndReset' operation.
+// Note that in practice, most clients should not need to access a
+// 'balm::HistogramCollector' directly, but instead obtain one from a
+// 'balm::CollectorRepository' (which publishes the percentiles of the
+// collected values) and record values through a 'balm::StopwatchScopedGuard'.
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.
+//
+///Performance
+///-----------
+// A 'balm::HistogramCollector' occupies a fixed amount of memory (one 64-bit
+// counter per bucket, about 20KB) and records a value without acquiring any
+// lock: 'update' atomically increments the counter of the bucket selected by
+// the value, atomically adds the value to the total, and atomically updates
+// the minimum and maximum only when the value is a new extremum (which
+// quickly becomes rare).  The 'load' and 'loadAndReset' operations read (and
+// reset) every counter, and are therefore more expensive than 'update'.
+//
+// Because the counters are updated and reset individually, 'loadAndReset' is
+// not atomic with respect to a concurrent 'update': each recorded value is
+// counted in exactly one loaded histogram, but the total, minimum, and
+// maximum of a value recorded concurrently with 'loadAndReset' may be
+// attributed to the next loaded histogram.
+//
+///Usage
+///-----
+// The following example creates a 'balm::HistogramCollector', records values
+// with it, then loads the collected 'balm::Histogram'.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' object for 'myMetric' and use the
+// 'update' method to record latencies (in seconds):
+//..
+//  balm::HistogramCollector collector(myMetric);
+//
+//  for (int i = 1; i <= 100; ++i) {
+//      collector.update(i * 0.001);
+//  }
+//..
+// Finally, we load the collected values into a 'balm::Histogram' and estimate
+// the 99th percentile of the recorded latencies:
+//..
+//  balm::Histogram histogram;
+//  collector.loadAndReset(&histogram);
+//
+//  assert(100   == histogram.count());
+//  assert(0.001 == histogram.min());
+//  assert(0.1   == histogram.max());
+//
+//  const double p99 = histogram.percentile(99.0);
+//  assert(0.099 * (1 - 1.0 / 32) <= p99 && p99 <= 0.099 * (1 + 1.0 / 32));
+//..
+
+#include <balscm_version.h>
+
+#include <balm_histogram.h>
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism for collecting the distribution of the
+    // values of a metric in the buckets of a 'Histogram', along with the
+    // total, minimum, and maximum of those values, without acquiring any
+    // lock.  The collector contains a 'MetricId' object identifying the metric
+    // being collected.  The default state of a collector has no recorded
+    // values (see 'Histogram').
+
+    // DATA
+    MetricId          d_metricId;                        // metric identifier
+
+    bsls::AtomicInt64 d_buckets[Histogram::k_NUM_BUCKETS];
+                                                         // count of values
+                                                         // per bucket
+
+    bsls::AtomicInt64 d_total;                           // representation
+                                                         // of the total
+
+    bsls::AtomicInt64 d_min;                             // representation
+                                                         // of the minimum
+
+    bsls::AtomicInt64 d_max;                             // representation
+                                                         // of the maximum
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+    // PRIVATE CLASS METHODS
+    static bsls::Types::Int64 toBits(double value);
+        // Return the representation of the specified 'value' stored by this
+        // collector.
+
+    static double fromBits(bsls::Types::Int64 bits);
+        // Return the value having the specified 'bits' representation.
+
+  public:
+    // CREATORS
+    explicit HistogramCollector(const MetricId& metricId);
+        // Create a collector for a metric having the specified 'metricId' and
+        // having no recorded values.
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset();
+        // Reset this collector to its default state (i.e., having no recorded
+        // values).
+
+    void loadAndReset(Histogram *result);
+        // Load into the specified 'result' the values recorded by this
+        // collector, and reset this collector to its default state.  Note
+        // that this operation is not atomic with respect to a concurrent
+        // 'update' (see {Performance}).
+
+    void update(double value);
+        // Record the specified 'value'.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    void load(Histogram *result) const;
+        // Load into the specified 'result' the values recorded by this
+        // collector.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// PRIVATE CLASS METHODS
+inline
+bsls::Types::Int64 HistogramCollector::toBits(double value)
+{
+    bsls::Types::Int64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+inline
+double HistogramCollector::fromBits(bsls::Types::Int64 bits)
+{
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+// CREATORS
+inline
+HistogramCollector::~HistogramCollector()
+{
+}
+
+// MANIPULATORS
+inline
+void HistogramCollector::update(double value)
+{
+    d_buckets[Histogram::bucketIndex(value)].addRelaxed(1);
+
+    bsls::Types::Int64 expected = d_total.loadRelaxed();
+    for (;;) {
+        const bsls::Types::Int64 previous = d_total.testAndSwap(
+                                         expected,
+                                         toBits(fromBits(expected) + value));
+        if (previous == expected) {
+            break;
+        }
+        expected = previous;
+    }
+
+    expected = d_min.loadRelaxed();
+    while (value < fromBits(expected)) {
+        const bsls::Types::Int64 previous = d_min.testAndSwap(expected,
+                                                              toBits(value));
+        if (previous == expected) {
+            break;
+        }
+        expected = previous;
+    }
+
+    expected = d_max.loadRelaxed();
+    while (value > fromBits(expected)) {
+        const bsls::Types::Int64 previous = d_max.testAndSwap(expected,
+                                                              toBits(value));
+        if (previous == expected) {
+            break;
+        }
+        expected = previous;
+    }
+}
+
+// ACCESSORS
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
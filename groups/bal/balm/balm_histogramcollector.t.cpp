@@ -0,0 +1,472 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bdlf_bind.h>
+#include <bdlmt_fixedthreadpool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::HistogramCollector' is a mechanism recording values into the buckets
+// of a 'balm::Histogram' without locking.  We verify that the loaded
+// histograms are those obtained by recording the same values in a
+// 'balm::Histogram', and that values recorded concurrently from several
+// threads are each loaded exactly once.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit HistogramCollector(const MetricId& metricId);
+// [ 2] ~HistogramCollector();
+//
+// MANIPULATORS
+// [ 3] void reset();
+// [ 3] void loadAndReset(Histogram *result);
+// [ 2] void update(double value);
+//
+// ACCESSORS
+// [ 2] const MetricId& metricId() const;
+// [ 2] void load(Histogram *result) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: CONCURRENT UPDATES ARE LOADED EXACTLY ONCE
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        bsl::cout << "Error " << __FILE__ << "(" << i << "): " << s
+                  << "    (failed)" << bsl::endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::Histogram          Histogram;
+typedef balm::MetricDescription  Desc;
+typedef balm::MetricId           Id;
+
+enum { k_NUM_UPDATES = 20000 };  // number of updates per thread in case 4
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void updateJob(Obj *collector, bslmt::Barrier *barrier, int threadIndex)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // with the values in the range '[1 .. k_NUM_UPDATES]' offset by
+    // 'k_NUM_UPDATES' times the specified 'threadIndex', in increasing order.
+{
+    const int base = threadIndex * k_NUM_UPDATES;
+
+    barrier->wait();
+    for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+        collector->update(base + i);
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING USAGE EXAMPLE
+        //
+        // Concerns:
+        //   The usage example provided in the component header file must
+        //   compile, link, and run on all platforms as shown.
+        //
+        // Plan:
+        //   Incorporate usage example from header into driver, remove leading
+        //   comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Usage Example"
+                          << "\n=====================" << endl;
+
+///Usage
+///-----
+// The following example creates a 'balm::HistogramCollector', records values
+// with it, then loads the collected 'balm::Histogram'.
+//
+// We start by creating a 'balm::MetricId' object by hand, but in practice, an
+// id should be obtained from a 'balm::MetricRegistry' object (such as the one
+// owned by a 'balm::MetricsManager'):
+//..
+    balm::Category           myCategory("MyCategory");
+    balm::MetricDescription  description(&myCategory, "RequestLatency");
+    balm::MetricId           myMetric(&description);
+//..
+// Now we create a 'balm::HistogramCollector' object for 'myMetric' and use the
+// 'update' method to record latencies (in seconds):
+//..
+    balm::HistogramCollector collector(myMetric);
+
+    for (int i = 1; i <= 100; ++i) {
+        collector.update(i * 0.001);
+    }
+//..
+// Finally, we load the collected values into a 'balm::Histogram' and estimate
+// the 99th percentile of the recorded latencies:
+//..
+    balm::Histogram histogram;
+    collector.loadAndReset(&histogram);
+
+    ASSERT(100   == histogram.count());
+    ASSERT(0.001 == histogram.min());
+    ASSERT(0.1   == histogram.max());
+
+    const double p99 = histogram.percentile(99.0);
+    ASSERT(0.099 * (1 - 1.0 / 32) <= p99 && p99 <= 0.099 * (1 + 1.0 / 32));
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT UPDATES ARE LOADED EXACTLY ONCE
+        //
+        // Concerns:
+        //: 1 Values supplied to 'update' from many threads concurrently are
+        //:   each counted exactly once by the histograms loaded by
+        //:   'loadAndReset', including while 'loadAndReset' is concurrently
+        //:   invoked.
+        //:
+        //: 2 The totals, minima, and maxima of the loaded histograms
+        //:   aggregate to those of all the values supplied.
+        //
+        // Plan:
+        //: 1 Update a collector from several threads with disjoint ranges of
+        //:   values while the main thread repeatedly calls 'loadAndReset',
+        //:   merge the loaded histograms, and verify that the result is the
+        //:   histogram of all the values supplied.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT UPDATES ARE LOADED EXACTLY ONCE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT UPDATES ARE LOADED EXACTLY ONCE"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        Obj mX(METRIC_A);
+
+        bslmt::Barrier         barrier(k_NUM_THREADS + 1);
+        bdlmt::FixedThreadPool pool(k_NUM_THREADS, k_NUM_THREADS);
+        pool.start();
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            pool.enqueueJob(bdlf::BindUtil::bind(&updateJob,
+                                                 &mX,
+                                                 &barrier,
+                                                 i));
+        }
+
+        Histogram merged;
+        Histogram histogram;
+
+        barrier.wait();
+        for (int i = 0; i < 1000 || 0 < pool.numActiveThreads(); ++i) {
+            mX.loadAndReset(&histogram);
+            merged.merge(histogram);
+        }
+        pool.drain();
+
+        mX.loadAndReset(&histogram);
+        merged.merge(histogram);
+
+        Histogram expected;
+        for (int i = 1; i <= k_NUM_THREADS * k_NUM_UPDATES; ++i) {
+            expected.update(i);
+        }
+
+        if (veryVerbose) {
+            P_(merged.count()) P_(merged.total()) P(expected.total());
+        }
+
+        ASSERT(expected == merged);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING: 'reset' and 'loadAndReset'
+        //
+        // Concerns:
+        //: 1 'loadAndReset' loads the recorded values and resets the
+        //:   collector to its default state.
+        //:
+        //: 2 'reset' resets the collector to its default state.
+        //:
+        //: 3 The value previously held by the loaded histogram is replaced.
+        //
+        // Plan:
+        //: 1 Record values, call 'loadAndReset' into a histogram holding
+        //:   other values, and verify the loaded histogram and the state of
+        //:   the collector.  (C-1, 3)
+        //:
+        //: 2 Record values, call 'reset', and verify the state of the
+        //:   collector.  (C-2)
+        //
+        // Testing:
+        //   void reset();
+        //   void loadAndReset(Histogram *result);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING: 'reset' and 'loadAndReset'"
+                          << endl << "==================================="
+                          << endl;
+
+        const Histogram EMPTY;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+
+        Histogram expected;
+        for (int i = -5; i < 100; ++i) {
+            mX.update(i * 0.5);
+            expected.update(i * 0.5);
+        }
+
+        Histogram result;
+        result.update(1e6);
+
+        mX.loadAndReset(&result);
+        ASSERT(expected == result);
+
+        X.load(&result);
+        ASSERT(EMPTY == result);
+
+        mX.loadAndReset(&result);
+        ASSERT(EMPTY == result);
+
+        mX.update(3.0);
+        mX.update(-1.0);
+        mX.reset();
+
+        X.load(&result);
+        ASSERT(EMPTY == result);
+
+        mX.update(2.0);
+        expected.reset();
+        expected.update(2.0);
+        mX.loadAndReset(&result);
+        ASSERT(expected == result);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING: PRIMARY MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A collector is created for the supplied metric id, and has no
+        //:   recorded values.
+        //:
+        //: 2 'update' records a value as 'Histogram::update' does, including
+        //:   for values outside the bucketed range.
+        //:
+        //: 3 'load' does not modify the collector.
+        //:
+        //: 4 The collector does not allocate memory.
+        //
+        // Plan:
+        //: 1 Create collectors, and verify their metric id and the histogram
+        //:   they load.  (C-1)
+        //:
+        //: 2 Record a sequence of values in a collector and in a histogram,
+        //:   and compare the histogram loaded from the collector to the
+        //:   histogram after each update.  (C-2..3)
+        //:
+        //: 3 Install a test allocator as the default allocator, and verify
+        //:   that no memory is allocated by the collector.  (C-4)
+        //
+        // Testing:
+        //   explicit HistogramCollector(const MetricId& metricId);
+        //   ~HistogramCollector();
+        //   void update(double value);
+        //   const MetricId& metricId() const;
+        //   void load(Histogram *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: PRIMARY MANIPULATORS AND ACCESSORS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVerbose);
+
+        Histogram expected(&ta);
+        Histogram result(&ta);
+
+        bslma::TestAllocator         da("default", veryVerbose);
+        bslma::DefaultAllocatorGuard guard(&da);
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+        Obj mY(METRIC_B); const Obj& Y = mY;
+
+        ASSERT(METRIC_A == X.metricId());
+        ASSERT(METRIC_B == Y.metricId());
+
+        X.load(&result);
+        ASSERT(expected == result);
+
+        const double VALUES[] = { 1.0, 2.5, 2.5, -3.0, 0.0, 1e-30, 1e30,
+                                  123.456, 0.001 };
+        const int    NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX.update(VALUES[i]);
+            expected.update(VALUES[i]);
+
+            X.load(&result);
+            ASSERTV(i, expected == result);
+
+            X.load(&result);
+            ASSERTV(i, expected == result);
+        }
+
+        Y.load(&result);
+        ASSERT(Histogram(&ta) == result);
+
+        ASSERT(0 == da.numAllocations());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Update a collector, load its histogram, and reset it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BREATHING TEST"
+                          << endl << "==============" << endl;
+
+        Obj mX(METRIC_A); const Obj& X = mX;
+
+        Histogram histogram;
+
+        mX.update(1.0);
+        mX.update(3.0);
+
+        X.load(&histogram);
+        ASSERT(2   == histogram.count());
+        ASSERT(4.0 == histogram.total());
+        ASSERT(1.0 == histogram.min());
+        ASSERT(3.0 == histogram.max());
+
+        mX.loadAndReset(&histogram);
+        ASSERT(2   == histogram.count());
+
+        X.load(&histogram);
+        ASSERT(0   == histogram.count());
+        ASSERT(Histogram() == histogram);
+      } break;
+      default: {
+        bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        bsl::cerr << "Error, non-zero test status = " << testStatus << "."
+                  << bsl::endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
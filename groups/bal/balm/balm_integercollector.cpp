@@ -12,10 +12,18 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_integercollector_cpp,"$Id$ $CSID$")
 
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
 
+#include <new>
+
 namespace BloombergLP {
 
                         // ----------------------------
@@ -31,54 +39,49 @@ const int balm::IntegerCollector::DEFAULT_MAX = INT_MIN;
 #endif
 
 namespace balm {
-// MANIPULATORS
-void IntegerCollector::loadAndReset(MetricRecord *records)
+
+BSLMF_ASSERT(sizeof(IntegerCollector_Cell) ==
+                                     IntegerCollector_Cell::k_CACHE_LINE_SIZE);
+
+// PRIVATE MANIPULATORS
+void IntegerCollector::resetAll()
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-
-        d_count = 0;
-        d_total = 0;
-        d_min   = k_DEFAULT_MIN;
-        d_max   = k_DEFAULT_MAX;
+    for (int i = 0; i <= d_cellMask; ++i) {
+        d_cells_p[i].reset();
     }
-    // Perform the conversion to double values outside of the lock.
-    records->metricId() = d_metricId;
-    records->count()    = count;
-    records->total()    = static_cast<double>(total);
-    records->min()      = (k_DEFAULT_MIN == min)
-                        ? MetricRecord::k_DEFAULT_MIN
-                        : min;
-    records->max()      = (k_DEFAULT_MAX == max)
-                        ? MetricRecord::k_DEFAULT_MAX
-                        : max;
 }
 
-// ACCESSORS
-void IntegerCollector::load(MetricRecord *record) const
+// PRIVATE ACCESSORS
+void IntegerCollector::lockAll() const
+{
+    for (int i = 0; i <= d_cellMask; ++i) {
+        d_cells_p[i].d_lock.lock();
+    }
+}
+
+void IntegerCollector::unlockAll() const
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
+    for (int i = 0; i <= d_cellMask; ++i) {
+        d_cells_p[i].d_lock.unlock();
+    }
+}
+
+void IntegerCollector::merge(MetricRecord *record) const
+{
+    int                count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i <= d_cellMask; ++i) {
+        const IntegerCollector_Cell& cell = d_cells_p[i];
+
+        count += cell.d_count;
+        total += cell.d_total;
+        min   =  bsl::min(min, cell.d_min);
+        max   =  bsl::max(max, cell.d_max);
     }
 
-    // Perform the conversion to double values outside of the lock.
     record->metricId() = d_metricId;
     record->count()    = count;
     record->total()    = static_cast<double>(total);
@@ -90,6 +93,69 @@ void IntegerCollector::load(MetricRecord *record) const
                        : max;
 }
 
+// CREATORS
+IntegerCollector::IntegerCollector(const MetricId&   metricId,
+                                   bslma::Allocator *basicAllocator)
+: d_metricId(metricId)
+, d_buffer_p(0)
+, d_cells_p(0)
+, d_cellMask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Use one cell per concurrent thread supported by the host, up to
+    // 'k_MAX_NUM_CELLS', and over-allocate by enough to align the cells on a
+    // cache line, which the allocator does not guarantee.
+
+    const unsigned int concurrency = bslmt::ThreadUtil::hardwareConcurrency();
+
+    int numCells = 1;
+    while (numCells < k_MAX_NUM_CELLS
+        && static_cast<unsigned int>(numCells) < concurrency) {
+        numCells *= 2;
+    }
+
+    d_buffer_p = d_allocator_p->allocate(
+                            numCells * sizeof(IntegerCollector_Cell)
+                            + IntegerCollector_Cell::k_CACHE_LINE_SIZE - 1);
+
+    char *cells = static_cast<char *>(d_buffer_p)
+                + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                   d_buffer_p,
+                                   IntegerCollector_Cell::k_CACHE_LINE_SIZE);
+
+    d_cells_p  = reinterpret_cast<IntegerCollector_Cell *>(cells);
+    d_cellMask = numCells - 1;
+
+    BSLS_ASSERT(0 == reinterpret_cast<bsls::Types::UintPtr>(d_cells_p)
+                                   % IntegerCollector_Cell::k_CACHE_LINE_SIZE);
+
+    for (int i = 0; i < numCells; ++i) {
+        new (d_cells_p + i) IntegerCollector_Cell();
+    }
+}
+
+IntegerCollector::~IntegerCollector()
+{
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+// MANIPULATORS
+void IntegerCollector::loadAndReset(MetricRecord *records)
+{
+    lockAll();
+    merge(records);
+    resetAll();
+    unlockAll();
+}
+
+// ACCESSORS
+void IntegerCollector::load(MetricRecord *record) const
+{
+    lockAll();
+    merge(record);
+    unlockAll();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
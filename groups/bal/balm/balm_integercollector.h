@@ -44,6 +44,23 @@ BSLS_IDENT("$Id: $")
 // non-creator operations on a given instance can be safely invoked
 // simultaneously from multiple threads.
 //
+///Performance
+///-----------
+// A 'balm::IntegerCollector' distributes its aggregated values over a number
+// of cells, each occupying its own cache line and guarded by its own spin
+// lock, and 'update' and 'accumulateCountTotalMinMax' lock only the cell
+// selected by a hash of the identifier of the calling thread.  Threads
+// updating the same collector contend only when their identifiers select the
+// same cell.  The cells are merged by 'load' and 'loadAndReset' (i.e., when
+// metrics are published), which lock every cell, so these operations are more
+// expensive than 'update'.
+//
+// As for 'balm::Collector', the number of cells is the number of concurrent
+// threads supported by the host, rounded up to a power of two, but at most
+// 16, and the cells are allocated from the allocator supplied at construction
+// as a single block of 64 bytes per cell, plus up to 63 bytes needed to align
+// that block on a cache line.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::IntegerCollector', modifies its
@@ -86,14 +103,59 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricid.h>
 #include <balm_metricrecord.h>
 
-#include <bslmt_mutex.h>
-#include <bslmt_lockguard.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
 
+#include <bslmt_threadutil.h>
+
+#include <bsls_spinlock.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
 namespace balm {
 
+                        // ===========================
+                        // class IntegerCollector_Cell
+                        // ===========================
+
+struct IntegerCollector_Cell {
+    // This component-private 'struct' provides the aggregated values of an
+    // integer metric updated by a subset of the threads updating an
+    // 'IntegerCollector', along with the lock synchronizing access to them.
+    // Each cell is padded to the size of a cache line, and 'IntegerCollector'
+    // aligns its cells on cache line boundaries, so that threads updating
+    // different cells of a collector do not contend.
+
+    // PUBLIC TYPES
+    enum { k_CACHE_LINE_SIZE = 64 };  // assumed size of a cache line
+
+    // PUBLIC DATA
+    bsls::SpinLock     d_lock;   // synchronizes access to the other members
+    int                d_count;  // aggregated count of events
+    bsls::Types::Int64 d_total;  // total of values across events
+    int                d_min;    // minimum value across events
+    int                d_max;    // maximum value across events
+    char               d_padding[k_CACHE_LINE_SIZE
+                               - sizeof(bsls::SpinLock)
+                               - 3 * sizeof(int)
+                               - sizeof(bsls::Types::Int64)];
+                                 // pad to a cache line
+
+    // CREATORS
+    IntegerCollector_Cell();
+        // Create a cell having a count of 0, total of 0, min of
+        // 'IntegerCollector::k_DEFAULT_MIN', and max of
+        // 'IntegerCollector::k_DEFAULT_MAX'.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum values of this cell to
+        // their default states.  The behavior is undefined unless the calling
+        // thread holds 'd_lock'.
+};
+
                            // ======================
                            // class IntegerCollector
                            // ======================
@@ -107,19 +169,65 @@ class IntegerCollector {
     // value for the count is 0, the default value for the total is 0, the
     // default value for the minimum is 'k_DEFAULT_MIN', and the default value
     // for the maximum is 'k_DEFAULT_MAX'.
+    //
+    // The aggregated values are distributed over an array of cells, each
+    // guarded by its own spin lock: 'update' and 'accumulateCountTotalMinMax'
+    // only lock the cell selected by the identifier of the calling thread,
+    // while the other operations lock every cell (always in the same order)
+    // and merge or reset their values, so that they remain atomic with
+    // respect to one another.
+
+    // PRIVATE TYPES
+    enum {
+        k_MAX_NUM_CELLS_LOG2 = 4,                         // log2 of
+                                                          // 'k_MAX_NUM_CELLS'
+
+        k_MAX_NUM_CELLS      = 1 << k_MAX_NUM_CELLS_LOG2  // maximum number of
+                                                          // cells
+    };
 
     // DATA
-    MetricId             d_metricId;  // metric identifier
-    int                  d_count;     // aggregated count of events
-    bsls::Types::Int64   d_total;     // total of values across events
-    int                  d_min;       // minimum value across events
-    int                  d_max;       // maximum value across events
-    mutable bslmt::Mutex d_mutex;     // synchronizes access to data
+    MetricId               d_metricId;     // metric identifier
+
+    void                  *d_buffer_p;     // memory holding the cells (owned)
+
+    IntegerCollector_Cell *d_cells_p;      // cache-line-aligned array of
+                                           // cells, within 'd_buffer_p'
+
+    int                    d_cellMask;     // number of cells minus one
+
+    bslma::Allocator      *d_allocator_p;  // memory allocator (held, not
+                                           // owned)
 
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE ACCESSORS
+    int cellIndex() const;
+        // Return the index of the cell updated by the calling thread.
+
+    // PRIVATE MANIPULATORS
+    void resetAll();
+        // Reset the values of every cell of this collector to their default
+        // states.  The behavior is undefined unless the calling thread holds
+        // the lock of every cell.
+
+    void lockAll() const;
+        // Acquire the lock of every cell of this collector, in increasing
+        // order of index.
+
+    void unlockAll() const;
+        // Release the lock of every cell of this collector.  The behavior is
+        // undefined unless the calling thread holds the lock of every cell.
+
+    void merge(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the count, total, minimum, and maximum values
+        // aggregated over every cell of this collector, converting default
+        // minimum and maximum values as described by 'load'.  The behavior is
+        // undefined unless the calling thread holds the lock of every cell.
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -129,11 +237,18 @@ class IntegerCollector {
     static const int DEFAULT_MAX;
 #endif
 
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(IntegerCollector,
+                                   bslma::UsesBslmaAllocator);
+
     // CREATORS
-    IntegerCollector(const MetricId& metricId);
+    IntegerCollector(const MetricId&   metricId,
+                     bslma::Allocator *basicAllocator = 0);
         // Create an integer collector for a metric having the specified
         // 'metricId', and having an initial count of 0, total of 0, min of
-        // 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.
+        // 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
 
     ~IntegerCollector();
         // Destroy this object.
@@ -201,46 +316,70 @@ class IntegerCollector {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
-                           // ----------------------
-                           // class IntegerCollector
-                           // ----------------------
+                        // ---------------------------
+                        // class IntegerCollector_Cell
+                        // ---------------------------
 
 // CREATORS
 inline
-IntegerCollector::IntegerCollector(const MetricId& metricId)
-: d_metricId(metricId)
+IntegerCollector_Cell::IntegerCollector_Cell()
+: d_lock(bsls::SpinLock::s_unlocked)
 , d_count(0)
 , d_total(0)
-, d_min(k_DEFAULT_MIN)
-, d_max(k_DEFAULT_MAX)
-, d_mutex()
+, d_min(IntegerCollector::k_DEFAULT_MIN)
+, d_max(IntegerCollector::k_DEFAULT_MAX)
 {
 }
 
+// MANIPULATORS
 inline
-IntegerCollector::~IntegerCollector()
+void IntegerCollector_Cell::reset()
 {
+    d_count = 0;
+    d_total = 0;
+    d_min   = IntegerCollector::k_DEFAULT_MIN;
+    d_max   = IntegerCollector::k_DEFAULT_MAX;
+}
+
+                           // ----------------------
+                           // class IntegerCollector
+                           // ----------------------
+
+// PRIVATE ACCESSORS
+inline
+int IntegerCollector::cellIndex() const
+{
+    // Thread identifiers are typically aligned addresses sharing their
+    // low-order bits, so use the high-order bits of a multiplicative hash of
+    // the identifier.
+
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * k_MULTIPLIER;
+
+    return static_cast<int>(hash >> (64 - k_MAX_NUM_CELLS_LOG2)) & d_cellMask;
 }
 
 // MANIPULATORS
 inline
 void IntegerCollector::reset()
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = 0;
-    d_total = 0;
-    d_min   = k_DEFAULT_MIN;
-    d_max   = k_DEFAULT_MAX;
+    lockAll();
+    resetAll();
+    unlockAll();
 }
 
 inline
 void IntegerCollector::update(int value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    ++d_count;
-    d_total += value;
-    d_min = bsl::min(value, d_min);
-    d_max = bsl::max(value, d_max);
+    IntegerCollector_Cell& cell = d_cells_p[cellIndex()];
+
+    bsls::SpinLockGuard guard(&cell.d_lock);
+    ++cell.d_count;
+    cell.d_total += value;
+    cell.d_min = bsl::min(value, cell.d_min);
+    cell.d_max = bsl::max(value, cell.d_max);
 }
 
 inline
@@ -249,11 +388,13 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count += count;
-    d_total += total;
-    d_min   = bsl::min(min, d_min);
-    d_max   = bsl::max(max, d_max);
+    IntegerCollector_Cell& cell = d_cells_p[cellIndex()];
+
+    bsls::SpinLockGuard guard(&cell.d_lock);
+    cell.d_count += count;
+    cell.d_total += total;
+    cell.d_min   = bsl::min(min, cell.d_min);
+    cell.d_max   = bsl::max(max, cell.d_max);
 }
 
 inline
@@ -262,11 +403,13 @@ void IntegerCollector::setCountTotalMinMax(int count,
                                            int min,
                                            int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = count;
-    d_total = total;
-    d_min   = min;
-    d_max   = max;
+    lockAll();
+    resetAll();
+    d_cells_p[0].d_count = count;
+    d_cells_p[0].d_total = total;
+    d_cells_p[0].d_min   = min;
+    d_cells_p[0].d_max   = max;
+    unlockAll();
 }
 
 // ACCESSORS
@@ -19,6 +19,8 @@
 
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
 #include <bsl_functional.h>
 #include <bsl_ostream.h>
 #include <bsl_cstring.h>
@@ -44,8 +46,8 @@ using bsl::flush;
 // out of the container, and that the operations are thread safe.
 // ----------------------------------------------------------------------------
 // CREATORS
-// [ 3]  balm::Collector(const balm::MetricId& metric);
-// [ 3]  ~balm::Collector();
+// [ 3]  balm::IntegerCollector(const MetricId&, Allocator *ba = 0);
+// [ 3]  ~balm::IntegerCollector();
 //
 // MANIPULATORS
 // [ 7]  void reset();
@@ -63,7 +65,8 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] CONCERN: CONCURRENT SIGNED UPDATES ARE MERGED WITHOUT OVERFLOW
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -216,6 +219,31 @@ void ConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+enum { k_NUM_UPDATES = 20000 };  // number of updates per thread in case 9
+
+int updateValue(int threadIndex, int i)
+    // Return the value supplied by the thread having the specified
+    // 'threadIndex' in the specified 'i'th update in case 9: 'i' offset by
+    // 'k_NUM_UPDATES' times 'threadIndex', negated if 'threadIndex' is odd.
+{
+    const int value = threadIndex * k_NUM_UPDATES + i;
+
+    return threadIndex % 2 ? -value : value;
+}
+
+void updateJob(Obj *collector, bslmt::Barrier *barrier, int threadIndex)
+    // Wait on the specified 'barrier', then update the specified 'collector'
+    // with 'updateValue(threadIndex, i)' for each 'i' in the range
+    // '[1 .. k_NUM_UPDATES]', in increasing order, where 'threadIndex' is the
+    // specified 'threadIndex'.
+{
+    barrier->wait();
+    for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+        collector->update(updateValue(threadIndex, i));
+    }
+}
+
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -248,7 +276,7 @@ int main(int argc, char *argv[])
     Id metric_E(DESC_E); const Id& METRIC_E = metric_E;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -303,6 +331,140 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT SIGNED UPDATES ARE MERGED WITHOUT OVERFLOW
+        //
+        // Concerns:
+        //: 1 Values supplied to 'update' from many threads concurrently are
+        //:   all accounted for exactly once by the records loaded by
+        //:   'loadAndReset', including while 'loadAndReset' is concurrently
+        //:   invoked.
+        //:
+        //: 2 Totals exceeding the range of 'int', whether accumulated in one
+        //:   cell or merged over several, are loaded exactly.
+        //:
+        //: 3 Negative and positive values are merged into the correct
+        //:   minimum and maximum, which are not converted to the defaults of
+        //:   'balm::MetricRecord' unless no value was supplied.
+        //
+        // Plan:
+        //: 1 Update a collector from several threads, half of them supplying
+        //:   disjoint ranges of positive values and half of them negative
+        //:   values, while the main thread repeatedly calls 'loadAndReset'.
+        //:   Verify that the sums of the counts and totals of the loaded
+        //:   records, and the extrema of their minima and maxima, are those
+        //:   of all the values supplied, computed independently.  (C-1, 3)
+        //:
+        //: 2 Update a collector with positive values only, whose total
+        //:   exceeds 'INT_MAX', from several threads, and verify the total
+        //:   loaded.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT SIGNED UPDATES ARE MERGED WITHOUT OVERFLOW
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CONCURRENT SIGNED UPDATES ARE MERGED WITHOUT OVERFLOW"
+                 << endl
+                 << "====================================================="
+                 << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        bslma::TestAllocator defaultAllocator;
+        bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+        Obj mX(METRIC_A);
+
+        bslmt::Barrier         barrier(k_NUM_THREADS + 1);
+        bdlmt::FixedThreadPool pool(k_NUM_THREADS, k_NUM_THREADS);
+        pool.start();
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            pool.enqueueJob(bdlf::BindUtil::bind(&updateJob,
+                                                 &mX,
+                                                 &barrier,
+                                                 i));
+        }
+
+        bsls::Types::Int64 count = 0;
+        double             total = 0.0;
+        double             min   = Rec::k_DEFAULT_MIN;
+        double             max   = Rec::k_DEFAULT_MAX;
+
+        barrier.wait();
+        for (int i = 0; i < 1000 || 0 < pool.numActiveThreads(); ++i) {
+            Rec record;
+            mX.loadAndReset(&record);
+
+            count += record.count();
+            total += record.total();
+            min    = bsl::min(min, record.min());
+            max    = bsl::max(max, record.max());
+        }
+        pool.drain();
+
+        Rec record;
+        mX.loadAndReset(&record);
+
+        count += record.count();
+        total += record.total();
+        min    = bsl::min(min, record.min());
+        max    = bsl::max(max, record.max());
+
+        bsls::Types::Int64 expectedTotal = 0;
+        int                expectedMin   = INT_MAX;
+        int                expectedMax   = INT_MIN;
+        for (int t = 0; t < k_NUM_THREADS; ++t) {
+            for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+                const int value = updateValue(t, i);
+
+                expectedTotal += value;
+                expectedMin    = bsl::min(expectedMin, value);
+                expectedMax    = bsl::max(expectedMax, value);
+            }
+        }
+
+        ASSERTV(count, k_NUM_THREADS * k_NUM_UPDATES == count);
+        ASSERTV(total, expectedTotal, expectedTotal == total);
+        ASSERTV(min,   expectedMin,   expectedMin   == min);
+        ASSERTV(max,   expectedMax,   expectedMax   == max);
+
+        mX.load(&record);
+        ASSERT(Rec(METRIC_A) == record);
+
+        if (verbose) cout << "\tTotals exceeding 'INT_MAX'." << endl;
+        {
+            Obj mY(METRIC_A);
+
+            bsls::Types::Int64 positiveTotal = 0;
+            for (int t = 0; t < k_NUM_THREADS; t += 2) {
+                for (int i = 1; i <= k_NUM_UPDATES; ++i) {
+                    positiveTotal += updateValue(t, i);
+                }
+            }
+            ASSERT(INT_MAX < positiveTotal);
+
+            bslmt::Barrier barrier(k_NUM_THREADS / 2 + 1);
+            for (int t = 0; t < k_NUM_THREADS; t += 2) {
+                pool.enqueueJob(bdlf::BindUtil::bind(&updateJob,
+                                                     &mY,
+                                                     &barrier,
+                                                     t));
+            }
+            barrier.wait();
+            pool.drain();
+
+            Rec positiveRecord;
+            mY.load(&positiveRecord);
+            ASSERTV(positiveRecord.count(),
+                    k_NUM_THREADS / 2 * k_NUM_UPDATES
+                                                   == positiveRecord.count());
+            ASSERTV(positiveRecord.total(),
+                    positiveTotal == positiveRecord.total());
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -570,14 +732,21 @@ int main(int argc, char *argv[])
         // Concerns:
         //   Test the constructor arguments
         //
+        //   The cells are allocated, as one block, from the allocator
+        //   supplied at construction, or from the default allocator if none
+        //   is supplied, and deallocated on destruction.
+        //
         // Plan:
         //   Verify the constructor by passing a value from a table of values
         //   and verifying the object is initialized with the value..
         //
+        //   Create collectors with and without a test allocator, with another
+        //   test allocator installed as the default, and verify the blocks
+        //   in use by each allocator.
         //
         // Testing:
-        //   balm::Collector(const balm::MetricId^ )
-        //   ~balm::Collector()
+        //   balm::IntegerCollector(const MetricId&, Allocator *ba = 0);
+        //   ~balm::IntegerCollector();
         // --------------------------------------------------------------------
 
         if (verbose) cout << "\nTesting constructor." << endl;
@@ -589,6 +758,37 @@ int main(int argc, char *argv[])
             ASSERT(IDS[i] == MX.metricId());
         }
 
+        if (verbose) cout << "\nTesting allocator." << endl;
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        {
+            bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+            bslma::TestAllocator objectAllocator("object",   veryVeryVerbose);
+
+            bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+            {
+                Obj mX(METRIC_A, &objectAllocator); const Obj& MX = mX;
+
+                ASSERT(METRIC_A == MX.metricId());
+                ASSERT(1 == objectAllocator.numBlocksInUse());
+                ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+                mX.update(-1);
+                mX.update(2);
+
+                Rec record;
+                MX.load(&record);
+                ASSERT(Rec(METRIC_A, 2, 1, -1, 2) == record);
+            }
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+
+            {
+                Obj mX(METRIC_A);
+
+                ASSERT(1 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
       } break;
       case 2: {
         // --------------------------------------------------------------------
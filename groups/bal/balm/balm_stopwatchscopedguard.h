@@ -27,7 +27,11 @@ BSLS_IDENT("$Id: $")
 // units to report values in (by default, values are reported in seconds).  The
 // guard measures the elapsed time between its construction and destruction,
 // and on destruction records that elapsed time, in the indicated time units,
-// to the supplied metric.
+// to the supplied metric.  A guard may alternatively be supplied a
+// 'balm::HistogramCollector' (see 'balm_histogramcollector'), in which case
+// the distribution of the recorded elapsed times is collected, and
+// percentiles of those times (e.g., the 99th percentile latency) are
+// published in addition to their count, total, minimum, and maximum.
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
@@ -153,12 +157,65 @@ BSLS_IDENT("$Id: $")
 //      manager->publishAll();
 //
 //..
+//
+///Example 3: Recording Latency Percentiles
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we record the elapsed time of a request-processing function
+// to a 'balm::HistogramCollector', so that the median, 90th, 99th, and 99.9th
+// percentiles of the elapsed times (see 'balm_collectorrepository') are
+// published along with the other aggregates of the metric.  We obtain the
+// default histogram collector for the metric from the collector repository
+// of the metrics manager:
+//..
+//  class LatencyTrackingProcessor {
+//
+//      // DATA
+//      balm::HistogramCollector *d_latency_p;  // held, not owned
+//
+//    public:
+//
+//      // CREATORS
+//      explicit LatencyTrackingProcessor(balm::MetricsManager *manager)
+//      : d_latency_p(manager->collectorRepository().
+//                    getDefaultHistogramCollector("MyCategory",
+//                                                 "RequestLatency"))
+//      {}
+//
+//      // MANIPULATORS
+//      int processRequest(const bsl::string& request)
+//          // Process the specified 'request'.  Return 0 on success, and a
+//          // non-zero value otherwise.
+//      {
+//          (void)request;
+//
+//          balm::StopwatchScopedGuard guard(
+//                                 d_latency_p,
+//                                 balm::StopwatchScopedGuard::k_MICROSECONDS);
+//
+//  // ...
+//
+//          return 0;
+//      }
+//  };
+//..
+// Each publication of "MyCategory" then reports, in addition to the
+// "RequestLatency" metric, the "RequestLatency.p50", "RequestLatency.p90",
+// "RequestLatency.p99", and "RequestLatency.p99.9" metrics:
+//..
+//      LatencyTrackingProcessor latencyProcessor(manager);
+//
+//      latencyProcessor.processRequest("ab");
+//      latencyProcessor.processRequest("abc");
+//
+//      manager->publishAll();
+//..
 
 #include <balscm_version.h>
 
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_metric.h>
 #include <balm_metricsmanager.h>
 
@@ -180,15 +237,16 @@ class StopwatchScopedGuard {
     // report the elapsed time; by default a guard will report time in seconds.
     // The supplied time units determine the scale of the double value reported
     // by this guard, but does *not* affect the precision of the elapsed time
-    // measurement.  Each instance of this class delegates to a 'Collector' for
-    // the metric.  This 'Collector' is initialized on construction based on
-    // the constructor arguments.  If this scoped guard is not initialized with
-    // an active metric, or if the supplied metric becomes inactive before the
-    // scoped guard is destroyed, then 'isActive()' will return 'false' and no
-    // metric values will be recorded.  Note that if the metric supplied at
-    // construction is not active when the scoped guard is constructed, the
-    // scoped guard will not become active or record metric values regardless
-    // of the future state of that supplied metric.
+    // measurement.  Each instance of this class delegates to a 'Collector'
+    // (or a 'HistogramCollector') for the metric.  This collector is
+    // initialized on construction based on the constructor arguments.  If
+    // this scoped guard is not initialized with an active metric, or if the
+    // supplied metric becomes inactive before the scoped guard is destroyed,
+    // then 'isActive()' will return 'false' and no metric values will be
+    // recorded.  Note that if the metric supplied at construction is not
+    // active when the scoped guard is constructed, the scoped guard will not
+    // become active or record metric values regardless of the future state
+    // of that supplied metric.
 
   public:
     // PUBLIC TYPES
@@ -217,8 +275,14 @@ class StopwatchScopedGuard {
 
     Units           d_timeUnits;    // time units to record elapsed time in
 
-    Collector *d_collector_p;  // metric collector (held, not owned); may
-                                    // be 0, but cannot be invalid
+    Collector          *d_collector_p;  // metric collector (held, not
+                                        // owned); may be 0, but cannot be
+                                        // invalid
+
+    HistogramCollector *d_histogram_p;  // histogram collector (held, not
+                                        // owned); may be 0, but cannot be
+                                        // invalid, and is 0 unless
+                                        // 'd_collector_p' is 0
 
     // NOT IMPLEMENTED
     StopwatchScopedGuard(const StopwatchScopedGuard&);
@@ -250,6 +314,19 @@ class StopwatchScopedGuard {
         // this guard, but does *not* affect the precision of the elapsed time
         // measurement.
 
+    explicit StopwatchScopedGuard(HistogramCollector *collector,
+                                  Units               timeUnits = k_SECONDS);
+        // Initialize this scoped guard to record elapsed time using the
+        // specified histogram 'collector'.  Optionally specify the
+        // 'timeUnits' in which to report elapsed time.  If 'collector' is 0
+        // or 'collector->category().enabled() == false', this object will be
+        // inactive (i.e., will not record any values).  The behavior is
+        // undefined unless
+        // 'collector == 0 || collector->metricId().isValid()'.  Note that
+        // 'timeUnits' indicates the scale of the double value reported by
+        // this guard, but does *not* affect the precision of the elapsed time
+        // measurement.
+
     StopwatchScopedGuard(const MetricId&  metricId,
                          MetricsManager  *manager = 0);
     StopwatchScopedGuard(const MetricId&  metricId,
@@ -324,6 +401,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(Metric *metric,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(metric->isActive() ? metric->collector() : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
@@ -338,18 +416,35 @@ StopwatchScopedGuard::StopwatchScopedGuard(Collector *collector,
 , d_collector_p((collector && collector->metricId().category()->enabled())
                 ? collector
                 : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
     }
 }
 
+inline
+StopwatchScopedGuard::StopwatchScopedGuard(HistogramCollector *collector,
+                                           Units               timeUnits)
+: d_stopwatch()
+, d_timeUnits(timeUnits)
+, d_collector_p(0)
+, d_histogram_p((collector && collector->metricId().category()->enabled())
+                ? collector
+                : 0)
+{
+    if (d_histogram_p) {
+        d_stopwatch.start();
+    }
+}
+
 inline
 StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
                                            MetricsManager  *manager)
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -367,6 +462,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -384,6 +480,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
 
@@ -404,6 +501,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
     d_collector_p = (collector && collector->metricId().category()->enabled())
@@ -417,7 +515,13 @@ inline
 StopwatchScopedGuard::~StopwatchScopedGuard()
 {
     if (isActive()) {
-        d_collector_p->update(d_stopwatch.elapsedTime() * d_timeUnits);
+        const double elapsedTime = d_stopwatch.elapsedTime() * d_timeUnits;
+        if (d_collector_p) {
+            d_collector_p->update(elapsedTime);
+        }
+        else {
+            d_histogram_p->update(elapsedTime);
+        }
     }
 }
 
@@ -425,6 +529,9 @@ StopwatchScopedGuard::~StopwatchScopedGuard()
 inline
 bool StopwatchScopedGuard::isActive() const
 {
+    if (d_histogram_p) {
+        return d_histogram_p->metricId().category()->enabled();       // RETURN
+    }
     return 0 != d_collector_p
         && d_collector_p->metricId().category()->enabled();
 }
@@ -56,6 +56,8 @@ using bsl::flush;
 // CREATORS
 // [ 4]  explicit balm::StopwatchScopedGuard(balm::Metric *metric);
 // [ 3]  explicit balm::StopwatchScopedGuard(balm::Collector *collector);
+// [ 7]  explicit balm::StopwatchScopedGuard(balm::HistogramCollector *,
+//                                          Units);
 // [ 4]  balm::StopwatchScopedGuard(const balm::MetricId&  ,
 //                                 balm::MetricsManager  * = 0);
 // [ 4]  balm::StopwatchScopedGuard(const char * ,
@@ -69,7 +71,8 @@ using bsl::flush;
 // [ 2] 'TestPublisher'                             (helper classes)
 // [ 3] TESTING REPORTED TIME UNITS
 // [ 6] ELAPSED TIME VALUE
-// [ 7] USAGE
+// [ 7] TESTING HISTOGRAM COLLECTOR
+// [ 8] USAGE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -418,6 +421,47 @@ bool TestPublisher::contains(const balm::MetricId& id) const
     // ...
     };
 //..
+//
+///Example 3: Recording Latency Percentiles
+/// - - - - - - - - - - - - - - - - - - - -
+// In this example we record the elapsed time of a request-processing function
+// to a 'balm::HistogramCollector', so that the median, 90th, 99th, and 99.9th
+// percentiles of the elapsed times (see 'balm_collectorrepository') are
+// published along with the other aggregates of the metric.  We obtain the
+// default histogram collector for the metric from the collector repository
+// of the metrics manager:
+//..
+    class LatencyTrackingProcessor {
+
+        // DATA
+        balm::HistogramCollector *d_latency_p;  // held, not owned
+
+      public:
+
+        // CREATORS
+        explicit LatencyTrackingProcessor(balm::MetricsManager *manager)
+        : d_latency_p(manager->collectorRepository().
+                      getDefaultHistogramCollector("MyCategory",
+                                                   "RequestLatency"))
+        {}
+
+        // MANIPULATORS
+        int processRequest(const bsl::string& request)
+            // Process the specified 'request'.  Return 0 on success, and a
+            // non-zero value otherwise.
+        {
+            (void)request;
+
+            balm::StopwatchScopedGuard guard(
+                                   d_latency_p,
+                                   balm::StopwatchScopedGuard::k_MICROSECONDS);
+
+    // ...
+
+            return 0;
+        }
+    };
+//..
 
 // ============================================================================
 //                               MAIN PROGRAM
@@ -436,7 +480,7 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -508,9 +552,103 @@ int main(int argc, char *argv[])
 
         manager->publishAll();
 
+//..
+// Each publication of "MyCategory" then reports, in addition to the
+// "RequestLatency" metric, the "RequestLatency.p50", "RequestLatency.p90",
+// "RequestLatency.p99", and "RequestLatency.p99.9" metrics:
+//..
+        LatencyTrackingProcessor latencyProcessor(manager);
+
+        latencyProcessor.processRequest("ab");
+        latencyProcessor.processRequest("abc");
+
+        manager->publishAll();
+//..
     }
         ASSERT(0 == balm::DefaultMetricsManager::instance());
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING HISTOGRAM COLLECTOR
+        //
+        // Concerns:
+        //: 1 A guard supplied a null histogram collector, or a histogram
+        //:   collector whose category is disabled, is inactive and does not
+        //:   record a value.
+        //:
+        //: 2 A guard supplied a histogram collector whose category is enabled
+        //:   is active and records a single value on destruction, in the
+        //:   supplied time units.
+        //:
+        //: 3 A guard whose category is disabled before its destruction
+        //:   becomes inactive and does not record a value.
+        //
+        // Plan:
+        //: 1 Create guards for null, disabled, and enabled histogram
+        //:   collectors, and verify 'isActive' and the values loaded from the
+        //:   collectors after the guards are destroyed.  (C-1..2)
+        //:
+        //: 2 Disable the category of an active guard, and verify that no
+        //:   value is recorded.  (C-3)
+        //
+        // Testing:
+        //   explicit balm::StopwatchScopedGuard(balm::HistogramCollector *,
+        //                                       Units);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING HISTOGRAM COLLECTOR\n"
+                          << "===========================\n";
+
+        MetricsManager  manager(Z);
+        Repository&     repository = manager.collectorRepository();
+
+        balm::HistogramCollector *histA =
+                             repository.getDefaultHistogramCollector("A", "1");
+        balm::HistogramCollector *histB =
+                             repository.getDefaultHistogramCollector("B", "1");
+        manager.setCategoryEnabled("B", false);
+
+        balm::Histogram histogram(Z);
+
+        {
+            Obj mX(static_cast<balm::HistogramCollector *>(0));
+            ASSERT(!mX.isActive());
+        }
+        {
+            Obj mX(histB);
+            ASSERT(!mX.isActive());
+        }
+        histB->load(&histogram);
+        ASSERT(0 == histogram.count());
+
+        {
+            Obj mX(histA);
+            ASSERT(mX.isActive());
+        }
+        histA->loadAndReset(&histogram);
+        ASSERT(1    == histogram.count());
+        ASSERT(0.0  <= histogram.min());
+        ASSERT(0.01 >  histogram.max());
+
+        {
+            Obj mX(histA, Obj::k_MICROSECONDS);
+            ASSERT(mX.isActive());
+            bslmt::ThreadUtil::microSleep(10000);
+        }
+        histA->loadAndReset(&histogram);
+        ASSERT(1 == histogram.count());
+        ASSERTV(histogram.min(), 10000.0 <= histogram.min());
+
+        {
+            Obj mX(histA);
+            ASSERT(mX.isActive());
+            manager.setCategoryEnabled("A", false);
+            ASSERT(!mX.isActive());
+        }
+        histA->loadAndReset(&histogram);
+        ASSERT(0 == histogram.count());
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING ELAPSED TIME VALUE:
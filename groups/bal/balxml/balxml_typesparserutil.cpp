@@ -17,6 +17,9 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlb_chartype.h>
+#include <bdlb_numericparseutil.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bdldfp_decimalutil.h>
@@ -82,114 +85,89 @@ int parseBoolean(bool *result, const char *input, int inputLength)
     return BAEXML_FAILURE;
 }
 
-int parseDoubleImpl(double *result, const char *input, bool formatDecimal)
+int parseDouble(double     *result,
+                const char *input,
+                int         inputLength,
+                bool        formatDecimal)
     // Parse a string representing a double into the specified 'result'.  The
-    // specified 'input' is a null-terminated string.  The specified
-    // 'formatDecimal' should be true if 'input' should contain only decimal
-    // digits, period and sign characters (i.e., INF/NaN, and exponential
-    // notation are not allowed); otherwise 'input' can contain any floating-
-    // point representation form.  Return 0 on success and non-zero otherwise.
+    // specified 'formatDecimal' should be true if the specified 'input' of
+    // the specified length 'inputLength' should contain only decimal digits,
+    // period and sign characters (i.e., INF/NaN, and exponential notation are
+    // not allowed); otherwise 'input' can contain any floating-point
+    // representation form.  Return 0 on success and non-zero otherwise.  Note
+    // that 'input' need not be null-terminated, and is parsed without copying
+    // it.
 {
     enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
     static const char decimalChars[] = "+-.0123456789";
 
-    if (formatDecimal && input[bsl::strspn(input, decimalChars)] != '\0') {
-        // Non-decimal character (i.e., potential INF, NaN, or exponent) found.
+    const char *begin = input;
+    const char *end   = input + inputLength;
+
+    if (begin == end) {
         return BAEXML_FAILURE;                                        // RETURN
     }
 
-    switch (input[0]) {
-      case 'N': {
-        if (bsl::strcmp(input + 1, "aN") == 0) {
-            *result = bsl::numeric_limits<double>::quiet_NaN();
-            return BAEXML_SUCCESS;                                    // RETURN
-        }
-      } break;
-      case 'I': {
-        if (bsl::strcmp(input + 1, "NF") == 0) {
-            *result = bsl::numeric_limits<double>::infinity();
-            return BAEXML_SUCCESS;                                    // RETURN
-        }
-      } break;
-      case '+': {
-        if (bsl::strcmp(input + 1, "INF") == 0) {
-            *result = bsl::numeric_limits<double>::infinity();
-            return BAEXML_SUCCESS;                                    // RETURN
-        }
-      } break;
-      case '-': {
-        if (bsl::strcmp(input + 1, "INF") == 0) {
-            *result = -bsl::numeric_limits<double>::infinity();
-            return BAEXML_SUCCESS;                                    // RETURN
-        }
-      } break;
+    if (formatDecimal) {
+        for (const char *iter = begin; iter != end; ++iter) {
+            if ('\0' == *iter || !bsl::strchr(decimalChars, *iter)) {
+                // Non-decimal character (i.e., potential INF, NaN, or
+                // exponent) found.
 
-      default: {
-        ;  // do nothing
-      } break;
-    } // End switch
+                return BAEXML_FAILURE;                                // RETURN
+            }
+        }
+    }
 
-    char *end = 0;
-    errno = 0;
-    *result = bsl::strtod(input, &end);
+    const bslstl::StringRef inputRef(begin, inputLength);
 
-    if (end == input || *end != '\0') {  // nothing was consumed or not all
-                                         // characters were consumed
-        return BAEXML_FAILURE;                                        // RETURN
+    if ("NaN" == inputRef) {
+        *result = bsl::numeric_limits<double>::quiet_NaN();
+        return BAEXML_SUCCESS;                                        // RETURN
     }
-
-    // We ignore underflow errors.  If strtod sets errno to ERANGE, then it
-    // will also have set the result to a very large number for overflow or a
-    // very small number (or zero) for underflow -- exactly what we want.
-    if (ERANGE == errno) {
-        if (*result < -1.0 || 1.0 < *result) {
-            // Overflow is an error.
-            return BAEXML_FAILURE;                                    // RETURN
-        }
-        else {
-            // Underflow is OK (very small number).
-            return BAEXML_SUCCESS;                                    // RETURN
-        }
+    if ("INF" == inputRef || "+INF" == inputRef) {
+        *result = bsl::numeric_limits<double>::infinity();
+        return BAEXML_SUCCESS;                                        // RETURN
     }
-    else if (errno != 0) {
-        return BAEXML_FAILURE;                                        // RETURN
+    if ("-INF" == inputRef) {
+        *result = -bsl::numeric_limits<double>::infinity();
+        return BAEXML_SUCCESS;                                        // RETURN
     }
 
-    return BAEXML_SUCCESS;
-}
+    // Leading whitespace is accepted (as it was when 'strtod' was used).
 
-int parseDouble(double     *result,
-                const char *input,
-                int         inputLength,
-                bool        formatDecimal)
-    // Parse a string representing a double into the specified 'result'.  The
-    // specified 'formatDecimal' will be true if the specified 'input' of
-    // specified length 'inputLength' should contain only decimal digits,
-    // period and sign characters; otherwise 'input' can contain any floating-
-    // point representation form.  Return 0 on success and non-zero otherwise.
-{
-    // 'input' must be zero terminated string
-    enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
-    enum { BUFLEN = 80 };
+    while (begin != end && bdlb::CharType::isSpace(*begin)) {
+        ++begin;
+    }
+
+    double            value;
+    bslstl::StringRef rest;
+
+    if (0 != bdlb::NumericParseUtil::parseDouble(
+                                    &value,
+                                    &rest,
+                                    bslstl::StringRef(begin, end - begin))
+     || !rest.empty()) {
+        // Nothing was consumed or not all characters were consumed.
 
-    if (0 == inputLength) {
         return BAEXML_FAILURE;                                        // RETURN
     }
 
-    if (inputLength < BUFLEN) {
-        // Use a fixed-length buffer for efficiency.
-        char  buffer[BUFLEN];
-        bsl::memcpy(buffer, input, inputLength);
-        buffer[inputLength] = '\0';
+    // Underflow (to a subnormal value or zero) is accepted, but overflow of a
+    // number (as opposed to, e.g., the text "inf") is an error.
 
-        return u::parseDoubleImpl(result, buffer, formatDecimal);     // RETURN
+    if (value ==  bsl::numeric_limits<double>::infinity()
+     || value == -bsl::numeric_limits<double>::infinity()) {
+        const char *first = '+' == *begin || '-' == *begin ? begin + 1 : begin;
 
+        if (first != end
+         && ('.' == *first || bdlb::CharType::isDigit(*first))) {
+            return BAEXML_FAILURE;                                    // RETURN
+        }
     }
-    else {
-        // Use a string for dynamic allocation.
-        bsl::string tmp(input, inputLength);
-        return u::parseDoubleImpl(result, tmp.c_str(), formatDecimal);// RETURN
-    }
+
+    *result = value;
+    return BAEXML_SUCCESS;
 }
 
 int parseInt(int *result, const char *input, int inputLength)
@@ -1242,7 +1242,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1258,6 +1258,75 @@ int main(int argc, char *argv[])
 
         if (verbose) bsl::cout << "\nEnd of test." << bsl::endl;
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING ROUND TRIP OF 'float' AND 'double'
+        //
+        // Concerns:
+        //: 1 Any finite 'float' or 'double' value printed by
+        //:   'TypesPrintUtil::printDefault' is parsed by 'parseDefault' back
+        //:   into exactly the same value.
+        //
+        // Plan:
+        //: 1 For a large number of pseudo-random bit patterns, print the
+        //:   finite value that they represent, parse the output, and verify
+        //:   that the bits of the result are those of the original value.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Round Trip of 'float' and 'double'"
+                          << "\n==========================================="
+                          << endl;
+
+        typedef bsls::Types::Uint64 Uint64;
+
+        Uint64 state = 0x9E3779B97F4A7C15ULL;  // xorshift generator state
+
+        for (int i = 0; i < 100000; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            double value;
+            bsl::memcpy(&value, &state, sizeof value);
+
+            if (!bdlb::Float::isFinite(value)) {
+                continue;
+            }
+
+            bsl::ostringstream ss;
+            balxml::TypesPrintUtil::printDefault(ss, value);
+            const bsl::string text = ss.str();
+
+            double result;
+            ASSERTV(text, 0 == Util::parseDefault(
+                                             &result,
+                                             text.data(),
+                                             static_cast<int>(text.length())));
+            ASSERTV(text, 0 == bsl::memcmp(&value, &result, sizeof value));
+
+            const unsigned int floatBits = static_cast<unsigned int>(state);
+            float              floatValue;
+            bsl::memcpy(&floatValue, &floatBits, sizeof floatValue);
+
+            if (!bdlb::Float::isFinite(floatValue)) {
+                continue;
+            }
+
+            ss.str("");
+            balxml::TypesPrintUtil::printDefault(ss, floatValue);
+            const bsl::string floatText = ss.str();
+
+            float floatResult;
+            ASSERTV(floatText, 0 == Util::parseDefault(
+                                        &floatResult,
+                                        floatText.data(),
+                                        static_cast<int>(floatText.length())));
+            ASSERTV(floatText,
+                    0 == bsl::memcmp(&floatValue,
+                                     &floatResult,
+                                     sizeof floatValue));
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // TESTING 'parse' FUNCTION
@@ -1954,6 +2023,13 @@ int main(int argc, char *argv[])
                 { L_,     "123.4X",    123.4,           },
                 { L_,     "0.005X",    0.005            },
                 { L_,     "9.99E306X", 9.99E306         },
+                { L_,     "9007199254740993X",
+                                       9007199254740992.0 },
+                { L_,     "9007199254740993.0000000000000000000001X",
+                                       9007199254740994.0 },
+                { L_,     "2.4703282292062328e-324X",
+                                       4.9406564584124654e-324 },
+                { L_,     "1e-400X",   0.0              },
                 { L_,     "+INFX",     posInf,          },
                 { L_,     "-INFX",     -posInf,         },
                 { L_,     "NaNX",      qNaN             },
@@ -12,6 +12,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 
+#include <bdlb_numericformatterutil.h>
 #include <bdlb_print.h>
 #include <bdlde_base64encoder.h>
 #include <bdldfp_decimalutil.h>
@@ -986,26 +987,18 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Print the shortest text that parses back into 'object', so that
+        // encoding is lossless without padding the output with digits.
 
-        char buffer[FLT_DIG + 20];  // buffer with headroom
+        char buffer[bdlb::NumericFormatterUtil::k_FLOAT_MAX_LENGTH];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len =
-                    bsl::sprintf(buffer, "%.*g", FLT_DIG + 1, (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        const char *end = bdlb::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        object);
+        BSLS_ASSERT(end);
 
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
@@ -1032,25 +1025,18 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Print the shortest text that parses back into 'object', so that
+        // encoding is lossless without padding the output with digits.
 
-        char buffer[DBL_DIG + 20];  // buffer with headroom
+        char buffer[bdlb::NumericFormatterUtil::k_DOUBLE_MAX_LENGTH];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = bsl::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        const char *end = bdlb::NumericFormatterUtil::toChars(
+                                                        buffer,
+                                                        buffer + sizeof buffer,
+                                                        object);
+        BSLS_ASSERT(end);
 
-        stream.write(buffer, len);
+        stream.write(buffer, end - buffer);
       } break;
     }
 
@@ -105,6 +105,15 @@ BSLS_IDENT("$Id: $")
 //      Enumeration                         TEXT
 //..
 //
+///Printing 'float' and 'double' Values
+///------------------------------------
+// In the 'DEFAULT' formatting mode, a finite 'float' or 'double' value is
+// printed as the shortest text that parses back into exactly the same value
+// (see 'bdlb_numericformatterutil'), so that the value survives a round trip
+// through XML without loss and without superfluous digits (e.g., 0.1 is
+// printed as "0.1" and '1.0 / 3.0' as "0.3333333333333333").  Infinite values
+// are printed as "+INF" and "-INF", and NaN values as "NaN".
+//
 ///Behavior of 'printText' on Non-Valid Strings
 ///--------------------------------------------
 // The output of 'printText' will always be valid XML 1.0 with UTF-8 encoding.
@@ -0,0 +1,79 @@
+// bdlat_attributelookuptable.cpp                                     -*-C++-*-
+#include <bdlat_attributelookuptable.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlat_attributelookuptable_cpp,"$Id$ $CSID$")
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The number of buckets is the smallest power of two that is at least twice
+// the number of attributes (and at least 2), so that at least half of the
+// buckets are empty and 'lookup', which probes buckets from the one selected
+// by the hash of the name until it finds the name or an empty bucket, always
+// terminates.  The attributes are inserted in array order, and an attribute
+// whose name is already in the table is not inserted, so that 'lookup' finds
+// the first of several attributes having the same name.
+
+namespace BloombergLP {
+
+                      // --------------------------------
+                      // class bdlat_AttributeLookupTable
+                      // --------------------------------
+
+// CREATORS
+bdlat_AttributeLookupTable::bdlat_AttributeLookupTable(
+                                 const bdlat_AttributeInfo *attributes,
+                                 int                        numAttributes,
+                                 bslma::Allocator          *basicAllocator)
+: d_attributes_p(attributes)
+, d_numAttributes(numAttributes)
+, d_buckets(basicAllocator)
+, d_mask(0)
+{
+    BSLS_ASSERT(0 <= numAttributes);
+    BSLS_ASSERT(attributes || 0 == numAttributes);
+
+    bsl::size_t numBuckets = 2;
+    while (numBuckets < 2 * static_cast<bsl::size_t>(numAttributes)) {
+        numBuckets *= 2;
+    }
+
+    d_buckets.resize(numBuckets, -1);
+    d_mask = static_cast<unsigned int>(numBuckets - 1);
+
+    for (int i = 0; i < numAttributes; ++i) {
+        const bdlat_AttributeInfo& info = attributes[i];
+
+        if (lookup(info.d_name_p, info.d_nameLength)) {
+            continue;
+        }
+
+        unsigned int bucket = hash(info.d_name_p, info.d_nameLength) & d_mask;
+        while (0 <= d_buckets[bucket]) {
+            bucket = (bucket + 1) & d_mask;
+        }
+        d_buckets[bucket] = i;
+    }
+}
+
+bdlat_AttributeLookupTable::~bdlat_AttributeLookupTable()
+{
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
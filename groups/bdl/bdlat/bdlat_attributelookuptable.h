@@ -0,0 +1,306 @@
+// bdlat_attributelookuptable.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLAT_ATTRIBUTELOOKUPTABLE
+#define INCLUDED_BDLAT_ATTRIBUTELOOKUPTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide constant-time lookup of sequence attributes by name.
+//
+//@CLASSES:
+//  bdlat_AttributeLookupTable: hash table from attribute name to attribute
+//  bdlat_HasAttributeLookupTable<TYPE>: true for types having a lookup table
+//
+//@SEE_ALSO: bdlat_attributeinfo, bdlat_sequencefunctions
+//
+//@DESCRIPTION: This component provides a class, 'bdlat_AttributeLookupTable',
+// that indexes an array of 'bdlat_AttributeInfo' objects (typically the
+// 'ATTRIBUTE_INFO_ARRAY' of a generated "sequence" type) by attribute name, so
+// that the information for an attribute can be found from its name in
+// constant time on average, independent of the number of attributes.
+//
+// The 'lookupAttributeInfo' class method of a generated "sequence" type
+// compares the supplied name with the name of each attribute in turn, so that
+// finding an attribute takes time proportional to the number of attributes.
+// Decoders (e.g., 'baljsn::Decoder' and 'balxml::Decoder') look up every
+// element of their input by name using
+// 'bdlat_SequenceFunctions::manipulateAttribute', so for a type having many
+// attributes this linear search can dominate the cost of decoding.
+//
+// This component also provides a trait, 'bdlat_HasAttributeLookupTable',
+// that a "sequence" type having the 'bdlat_TypeTraitBasicSequence' trait may
+// declare to indicate that it provides a class method having the signature:
+//..
+//  static const bdlat_AttributeLookupTable& attributeLookupTable();
+//..
+// returning a table of all of its attributes.  For such a type, the
+// name-based functions of 'bdlat_SequenceFunctions' ('manipulateAttribute',
+// 'accessAttribute', and 'hasAttribute') find the attribute using that table,
+// and then forward to the id-based member function of the type.  For any
+// other type, those functions forward to the name-based member functions of
+// the type as before, so no change is required to existing types.
+//
+// Note that only those three functions use the table.  The
+// 'lookupAttributeInfo' class method of a generated type, which is not
+// changed, still searches the attributes linearly, as does any other code
+// calling it (or a name-based member function of the type) directly.
+// Similarly, the selections of a "choice" type, including those of an
+// untagged choice whose selection names a decoder resolves using
+// 'bdlat_ChoiceFunctions::hasSelection' and 'makeSelection', are still found
+// by a linear search of the selection information of the type.
+//
+// A table holds the address of the array of attribute information supplied
+// at construction; it does not copy it.  The names of the attributes are
+// hashed once, at construction; 'lookup' hashes the supplied name, and
+// compares it with at most a few attribute names (having the same hash
+// bucket), using open addressing with linear probing in a bucket array at
+// most half full.  If more than one attribute has the same name, 'lookup'
+// returns the first of them in the array, as a linear search would.
+//
+///Thread Safety
+///-------------
+// The 'lookup' method of 'bdlat_AttributeLookupTable' modifies no state of the
+// table, and so may be called concurrently by multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up the Attributes of a Sequence Type by Name
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a "sequence" type, 'Quote', generated by
+// 'bas_codegen.pl', having an array of attribute information:
+//..
+//  const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[] = {
+//      { 1, "symbol", 6, "", bdlat_FormattingMode::e_TEXT },
+//      { 2, "bid",    3, "", bdlat_FormattingMode::e_DEFAULT },
+//      { 3, "ask",    3, "", bdlat_FormattingMode::e_DEFAULT },
+//      { 4, "size",   4, "", bdlat_FormattingMode::e_DEC }
+//  };
+//  const int NUM_ATTRIBUTES = sizeof  ATTRIBUTE_INFO_ARRAY
+//                           / sizeof *ATTRIBUTE_INFO_ARRAY;
+//..
+// First, we create a table indexing that array:
+//..
+//  bdlat_AttributeLookupTable table(ATTRIBUTE_INFO_ARRAY, NUM_ATTRIBUTES);
+//  assert(NUM_ATTRIBUTES == table.numAttributes());
+//..
+// Then, we look up an attribute by name:
+//..
+//  const bdlat_AttributeInfo *info = table.lookup("ask", 3);
+//  assert(&ATTRIBUTE_INFO_ARRAY[2] == info);
+//  assert(3                        == info->id());
+//..
+// Next, we observe that a name that is not the name of an attribute is not
+// found:
+//..
+//  assert(0 == table.lookup("asks", 4));
+//  assert(0 == table.lookup("as",   2));
+//..
+// Finally, we sketch how the generated type would declare the
+// 'bdlat_HasAttributeLookupTable' trait, so that
+// 'bdlat_SequenceFunctions::manipulateAttribute' (and so each decoder) finds
+// its attributes using the table:
+//..
+//  class Quote {
+//      // ...
+//
+//    public:
+//      // TRAITS
+//      BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(Quote)
+//      BSLMF_NESTED_TRAIT_DECLARATION(Quote, bdlat_HasAttributeLookupTable);
+//
+//      // CLASS METHODS
+//      static const bdlat_AttributeLookupTable& attributeLookupTable();
+//          // Return a reference to the non-modifiable table of the
+//          // attributes of this class.
+//
+//      // ...
+//  };
+//
+//  const bdlat_AttributeLookupTable& Quote::attributeLookupTable()
+//  {
+//      static const bdlat_AttributeLookupTable table(
+//                                     ATTRIBUTE_INFO_ARRAY,
+//                                     NUM_ATTRIBUTES,
+//                                     bslma::Default::globalAllocator());
+//      return table;
+//  }
+//..
+// Note that, prior to C++11, the initialization of a function-local static
+// object is not guaranteed to be thread-safe, so in such builds
+// 'attributeLookupTable' should be called once before objects of the type are
+// decoded by multiple threads.
+
+#include <bdlscm_version.h>
+
+#include <bdlat_attributeinfo.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstring.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+
+                 // ====================================
+                 // struct bdlat_HasAttributeLookupTable
+                 // ====================================
+
+template <class TYPE>
+struct bdlat_HasAttributeLookupTable :
+        bslmf::DetectNestedTrait<TYPE, bdlat_HasAttributeLookupTable>::type
+{
+    // This trait may be declared for "sequence" types that provide a class
+    // method, 'attributeLookupTable', returning a reference to a
+    // non-modifiable 'bdlat_AttributeLookupTable' of all of their attributes.
+};
+
+                      // ================================
+                      // class bdlat_AttributeLookupTable
+                      // ================================
+
+class bdlat_AttributeLookupTable {
+    // This class provides a hash table from the name of each of an array of
+    // attributes to its 'bdlat_AttributeInfo' object.  The array is supplied
+    // at construction, and is neither copied nor owned.
+
+    // DATA
+    const bdlat_AttributeInfo *d_attributes_p;  // attribute information
+                                                // (held, not owned)
+
+    int                        d_numAttributes; // number of attributes
+
+    bsl::vector<int>           d_buckets;       // index, in
+                                                // 'd_attributes_p', of the
+                                                // attribute in each bucket, or
+                                                // -1 if the bucket is empty
+
+    unsigned int               d_mask;          // number of buckets minus one
+
+  private:
+    // NOT IMPLEMENTED
+    bdlat_AttributeLookupTable(const bdlat_AttributeLookupTable&);
+    bdlat_AttributeLookupTable& operator=(const bdlat_AttributeLookupTable&);
+
+    // PRIVATE CLASS METHODS
+    static unsigned int hash(const char *name, int nameLength);
+        // Return the hash value of the specified 'name' having the specified
+        // 'nameLength'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(bdlat_AttributeLookupTable,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    bdlat_AttributeLookupTable(
+                           const bdlat_AttributeInfo *attributes,
+                           int                        numAttributes,
+                           bslma::Allocator          *basicAllocator = 0);
+        // Create a table of the specified 'numAttributes' attributes described
+        // by the array at the specified 'attributes'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '0 <= numAttributes', 'attributes' refers to an
+        // array of at least 'numAttributes' elements if '0 < numAttributes',
+        // and that array remains valid and unmodified throughout the lifetime
+        // of this table.
+
+    ~bdlat_AttributeLookupTable();
+        // Destroy this object.
+
+    // ACCESSORS
+    const bdlat_AttributeInfo *lookup(const char *name, int nameLength) const;
+        // Return the address of the information of the first attribute in
+        // the array supplied at construction whose name is the specified
+        // 'name' having the specified 'nameLength', or 0 if there is no such
+        // attribute.  The behavior is undefined unless '0 <= nameLength', and
+        // 'name' refers to at least 'nameLength' characters if
+        // '0 < nameLength'.
+
+    int numAttributes() const;
+        // Return the number of attributes in this table.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class bdlat_AttributeLookupTable
+                      // --------------------------------
+
+// PRIVATE CLASS METHODS
+inline
+unsigned int bdlat_AttributeLookupTable::hash(const char *name,
+                                              int         nameLength)
+{
+    // 32-bit FNV-1a
+
+    unsigned int result = 2166136261u;
+
+    for (int i = 0; i < nameLength; ++i) {
+        result = (result ^ static_cast<unsigned char>(name[i])) * 16777619u;
+    }
+
+    return result;
+}
+
+// ACCESSORS
+inline
+const bdlat_AttributeInfo *bdlat_AttributeLookupTable::lookup(
+                                                  const char *name,
+                                                  int         nameLength) const
+{
+    BSLS_ASSERT_SAFE(0 <= nameLength);
+    BSLS_ASSERT_SAFE(name || 0 == nameLength);
+
+    for (unsigned int bucket = hash(name, nameLength) & d_mask;
+         ;
+         bucket = (bucket + 1) & d_mask) {
+        const int index = d_buckets[bucket];
+
+        if (index < 0) {
+            return 0;                                                 // RETURN
+        }
+
+        const bdlat_AttributeInfo& info = d_attributes_p[index];
+
+        if (nameLength == info.d_nameLength
+         && 0 == bsl::memcmp(name, info.d_name_p, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+}
+
+inline
+int bdlat_AttributeLookupTable::numAttributes() const
+{
+    return d_numAttributes;
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
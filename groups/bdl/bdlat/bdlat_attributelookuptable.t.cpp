@@ -0,0 +1,671 @@
+// bdlat_attributelookuptable.t.cpp                                   -*-C++-*-
+#include <bdlat_attributelookuptable.h>
+
+#include <bdlat_formattingmode.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>     // 'sprintf'
+#include <bsl_cstdlib.h>    // 'atoi'
+#include <bsl_cstring.h>    // 'memcmp', 'strlen'
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a hash table from attribute names to the
+// elements of an array of 'bdlat_AttributeInfo' objects, and a trait
+// identifying types providing such a table.  We verify, for a variety of
+// arrays (including an empty array, names that are prefixes of each other,
+// names of the same length, and duplicate names), that 'lookup' returns the
+// address of the first element having the supplied name, and 0 for names that
+// are not in the array.  We also verify that memory is supplied by the
+// specified allocator, and that the trait is detected.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] bdlat_AttributeLookupTable(const AttributeInfo *, int, Allocator *);
+// [ 2] ~bdlat_AttributeLookupTable();
+//
+// ACCESSORS
+// [ 2] const bdlat_AttributeInfo *lookup(const char *name, int len) const;
+// [ 2] int numAttributes() const;
+//
+// TRAITS
+// [ 3] bdlat_HasAttributeLookupTable<TYPE>
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_AttributeLookupTable Obj;
+typedef bsls::Types::Int64         Int64;
+
+namespace {
+
+const bdlat_AttributeInfo *linearLookup(const bdlat_AttributeInfo *attributes,
+                                        int                        numAttrs,
+                                        const char                *name,
+                                        int                        nameLength)
+    // Return the address of the first of the specified 'numAttrs' elements of
+    // the specified 'attributes' whose name is the specified 'name' having
+    // the specified 'nameLength', or 0 if there is no such element, searching
+    // as the 'lookupAttributeInfo' class method of a generated type does.
+{
+    for (int i = 0; i < numAttrs; ++i) {
+        const bdlat_AttributeInfo& info = attributes[i];
+
+        if (nameLength == info.d_nameLength
+         && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+
+    return 0;
+}
+
+void makeAttributes(bsl::vector<bdlat_AttributeInfo> *attributes,
+                    bsl::vector<bsl::string>         *names,
+                    int                               numAttributes)
+    // Load into the specified 'attributes' the specified 'numAttributes'
+    // elements having distinct names, resembling the attribute names of a
+    // large generated type, and ids 1 through 'numAttributes'.  Load the
+    // names into the specified 'names', which must remain unmodified for as
+    // long as 'attributes' is used.
+{
+    static const char *const PREFIXES[] = {
+        "order", "trade", "price", "quantity", "account", "security",
+        "settlement", "counterparty"
+    };
+    static const char *const SUFFIXES[] = {
+        "Id", "Date", "Time", "Type", "Status", "Currency", "Code", "Name",
+        "Source", "Version"
+    };
+    const int NUM_PREFIXES = sizeof PREFIXES / sizeof *PREFIXES;
+    const int NUM_SUFFIXES = sizeof SUFFIXES / sizeof *SUFFIXES;
+
+    names->clear();
+    for (int i = 0; i < numAttributes; ++i) {
+        bsl::string name(PREFIXES[i % NUM_PREFIXES]);
+        name += SUFFIXES[(i / NUM_PREFIXES) % NUM_SUFFIXES];
+        if (NUM_PREFIXES * NUM_SUFFIXES <= i) {
+            char buffer[16];
+            bsl::sprintf(buffer, "%d", i / (NUM_PREFIXES * NUM_SUFFIXES));
+            name += buffer;
+        }
+        names->push_back(name);
+    }
+
+    attributes->clear();
+    for (int i = 0; i < numAttributes; ++i) {
+        const bdlat_AttributeInfo info = {
+            i + 1,
+            (*names)[i].c_str(),
+            static_cast<int>((*names)[i].length()),
+            "",
+            bdlat_FormattingMode::e_DEFAULT
+        };
+        attributes->push_back(info);
+    }
+}
+
+                            // ===============
+                            // class WithTable
+                            // ===============
+
+class WithTable {
+    // This class declares the 'bdlat_HasAttributeLookupTable' trait.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WithTable, bdlat_HasAttributeLookupTable);
+};
+
+                           // ==================
+                           // class WithoutTable
+                           // ==================
+
+class WithoutTable {
+    // This class does not declare the 'bdlat_HasAttributeLookupTable' trait.
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up the Attributes of a Sequence Type by Name
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a "sequence" type, 'Quote', generated by
+// 'bas_codegen.pl', having an array of attribute information:
+//..
+    const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[] = {
+        { 1, "symbol", 6, "", bdlat_FormattingMode::e_TEXT },
+        { 2, "bid",    3, "", bdlat_FormattingMode::e_DEFAULT },
+        { 3, "ask",    3, "", bdlat_FormattingMode::e_DEFAULT },
+        { 4, "size",   4, "", bdlat_FormattingMode::e_DEC }
+    };
+    const int NUM_ATTRIBUTES = sizeof  ATTRIBUTE_INFO_ARRAY
+                             / sizeof *ATTRIBUTE_INFO_ARRAY;
+//..
+// First, we create a table indexing that array:
+//..
+    bdlat_AttributeLookupTable table(ATTRIBUTE_INFO_ARRAY, NUM_ATTRIBUTES);
+    ASSERT(NUM_ATTRIBUTES == table.numAttributes());
+//..
+// Then, we look up an attribute by name:
+//..
+    const bdlat_AttributeInfo *info = table.lookup("ask", 3);
+    ASSERT(&ATTRIBUTE_INFO_ARRAY[2] == info);
+    ASSERT(3                        == info->id());
+//..
+// Next, we observe that a name that is not the name of an attribute is not
+// found:
+//..
+    ASSERT(0 == table.lookup("asks", 4));
+    ASSERT(0 == table.lookup("as",   2));
+//..
+// Finally, we sketch how the generated type would declare the
+// 'bdlat_HasAttributeLookupTable' trait (see the component header).
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TRAIT
+        //
+        // Concerns:
+        //: 1 'bdlat_HasAttributeLookupTable' is 'true' for a type that
+        //:   declares it, and 'false' for any other type.
+        //
+        // Plan:
+        //: 1 Test the trait for a class declaring it, a class not declaring
+        //:   it, and a fundamental type.  (C-1)
+        //
+        // Testing:
+        //   bdlat_HasAttributeLookupTable<TYPE>
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TRAIT" << endl
+                          << "=====" << endl;
+
+        ASSERT( bdlat_HasAttributeLookupTable<WithTable>::value);
+        ASSERT(!bdlat_HasAttributeLookupTable<WithoutTable>::value);
+        ASSERT(!bdlat_HasAttributeLookupTable<int>::value);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        //: 1 'lookup' returns the address of the element of the array having
+        //:   the supplied name, for every element of the array.
+        //:
+        //: 2 'lookup' returns 0 for a name that is not in the array, including
+        //:   the empty name, a prefix or an extension of a name in the array,
+        //:   and a name of the same length as a name in the array.
+        //:
+        //: 3 If several elements have the same name, 'lookup' returns the
+        //:   first of them.
+        //:
+        //: 4 An empty table finds no name.
+        //:
+        //: 5 'numAttributes' returns the number of elements in the array.
+        //:
+        //: 6 Memory is supplied by the specified allocator (or, if none is
+        //:   specified, the default allocator), and is released on
+        //:   destruction; 'lookup' allocates no memory.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, specify a set of arrays of
+        //:   attribute names, and names to look up that are, or are not, in
+        //:   the array.  For each array, create a table using a test
+        //:   allocator, and compare the result of 'lookup' for each name with
+        //:   that of a linear search.  (C-1..5)
+        //:
+        //: 2 Create tables of up to 200 generated attributes, and verify that
+        //:   each attribute is found, and that names differing from an
+        //:   attribute name in their last character are not.  (C-1..2, 5)
+        //:
+        //: 3 Install a test allocator as the default allocator, and verify
+        //:   the memory used by tables created with and without an allocator.
+        //:   (C-6)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   bdlat_AttributeLookupTable(const AttributeInfo *, int, Alloc *);
+        //   ~bdlat_AttributeLookupTable();
+        //   const bdlat_AttributeInfo *lookup(const char *, int) const;
+        //   int numAttributes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOOKUP" << endl
+                          << "======" << endl;
+
+        const int MAX_NAMES = 8;
+
+        static const struct {
+            int         d_line;
+            const char *d_names[MAX_NAMES];  // attribute names (0-terminated)
+        } DATA[] = {
+            //LINE  NAMES
+            //----  -----------------------------------------------------
+            { L_,   { 0 }                                                 },
+            { L_,   { "a", 0 }                                            },
+            { L_,   { "", 0 }                                             },
+            { L_,   { "a", "b", 0 }                                       },
+            { L_,   { "a", "ab", "abc", "abcd", 0 }                       },
+            { L_,   { "abcd", "abc", "ab", "a", 0 }                       },
+            { L_,   { "abc", "abd", "acc", "bbc", "xyz", 0 }              },
+            { L_,   { "name", "value", "name", 0 }                        },
+            { L_,   { "x", "x", "x", 0 }                                  },
+            { L_,   { "id", "timestamp", "symbol", "bid", "ask",
+                      "bidSize", "askSize", 0 }                           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const char *const KEYS[] = {
+            "", "a", "b", "ab", "abc", "abcd", "abcde", "abd", "acc", "bbc",
+            "xyz", "xy", "name", "nam", "names", "value", "x", "xx", "id",
+            "timestamp", "timestamP", "symbol", "bid", "ask", "bidSize",
+            "askSize", "askSiz", "bidsize", "missing"
+        };
+        const int NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            bdlat_AttributeInfo attributes[MAX_NAMES];
+            int                 numAttributes = 0;
+
+            for (; DATA[ti].d_names[numAttributes]; ++numAttributes) {
+                const char *NAME = DATA[ti].d_names[numAttributes];
+
+                const bdlat_AttributeInfo info = {
+                    numAttributes + 1,
+                    NAME,
+                    static_cast<int>(bsl::strlen(NAME)),
+                    "",
+                    bdlat_FormattingMode::e_DEFAULT
+                };
+                attributes[numAttributes] = info;
+            }
+
+            if (veryVerbose) { T_ P_(LINE) P(numAttributes) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            const Obj X(numAttributes ? attributes : 0, numAttributes, &sa);
+
+            ASSERTV(LINE, numAttributes == X.numAttributes());
+            ASSERTV(LINE, 0 < sa.numBlocksInUse());
+
+            const Int64 numAllocations = sa.numAllocations();
+
+            for (int tj = 0; tj < NUM_KEYS; ++tj) {
+                const char *KEY    = KEYS[tj];
+                const int   LENGTH = static_cast<int>(bsl::strlen(KEY));
+
+                const bdlat_AttributeInfo *EXP = linearLookup(attributes,
+                                                              numAttributes,
+                                                              KEY,
+                                                              LENGTH);
+
+                ASSERTV(LINE, KEY, EXP == X.lookup(KEY, LENGTH));
+            }
+
+            ASSERTV(LINE, numAllocations == sa.numAllocations());
+        }
+
+        if (verbose) cout << "\nGenerated attributes." << endl;
+        {
+            bsl::vector<bdlat_AttributeInfo> attributes;
+            bsl::vector<bsl::string>         names;
+
+            for (int n = 1; n <= 200; n += n < 20 ? 1 : 29) {
+                makeAttributes(&attributes, &names, n);
+
+                bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+                const Obj X(attributes.data(), n, &sa);
+
+                ASSERTV(n, n == X.numAttributes());
+
+                for (int i = 0; i < n; ++i) {
+                    bsl::string name = names[i];
+
+                    ASSERTV(n, i, &attributes[i] == X.lookup(
+                                          name.data(),
+                                          static_cast<int>(name.length())));
+
+                    name[name.length() - 1] = '#';
+
+                    ASSERTV(n, i, 0 == X.lookup(
+                                          name.data(),
+                                          static_cast<int>(name.length())));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nAllocator use." << endl;
+        {
+            const bdlat_AttributeInfo ATTRIBUTES[] = {
+                { 1, "a", 1, "", bdlat_FormattingMode::e_DEFAULT },
+                { 2, "b", 1, "", bdlat_FormattingMode::e_DEFAULT }
+            };
+
+            bslma::TestAllocator da("default",   veryVeryVeryVerbose);
+            bslma::TestAllocator sa("supplied",  veryVeryVeryVerbose);
+
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            {
+                const Obj X(ATTRIBUTES, 2);
+
+                ASSERT(0 <  da.numBlocksInUse());
+                ASSERT(&ATTRIBUTES[1] == X.lookup("b", 1));
+            }
+            ASSERT(0 == da.numBlocksInUse());
+
+            const Int64 numDefaultAllocations = da.numAllocations();
+            {
+                const Obj X(ATTRIBUTES, 2, &sa);
+
+                ASSERT(0 <  sa.numBlocksInUse());
+                ASSERT(&ATTRIBUTES[0] == X.lookup("a", 1));
+            }
+            ASSERT(0 == sa.numBlocksInUse());
+            ASSERT(numDefaultAllocations == da.numAllocations());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bdlat_AttributeInfo ATTRIBUTES[] = {
+                { 1, "a", 1, "", bdlat_FormattingMode::e_DEFAULT }
+            };
+
+            ASSERT_PASS(Obj(ATTRIBUTES,  1));
+            ASSERT_PASS(Obj(0,           0));
+            ASSERT_FAIL(Obj(ATTRIBUTES, -1));
+            ASSERT_FAIL(Obj(0,           1));
+
+            const Obj X(ATTRIBUTES, 1);
+
+            ASSERT_SAFE_PASS(X.lookup("a",  1));
+            ASSERT_SAFE_PASS(X.lookup(0,    0));
+            ASSERT_SAFE_FAIL(X.lookup("a", -1));
+            ASSERT_SAFE_FAIL(X.lookup(0,    1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a table of a few attributes, and look up names that are,
+        //:   and are not, in the table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bdlat_AttributeInfo ATTRIBUTES[] = {
+            { 7, "first",  5, "", bdlat_FormattingMode::e_DEFAULT },
+            { 3, "second", 6, "", bdlat_FormattingMode::e_TEXT    },
+            { 9, "third",  5, "", bdlat_FormattingMode::e_DEC     }
+        };
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        const Obj X(ATTRIBUTES, 3, &sa);
+
+        ASSERT(3 == X.numAttributes());
+
+        ASSERT(&ATTRIBUTES[0] == X.lookup("first",  5));
+        ASSERT(&ATTRIBUTES[1] == X.lookup("second", 6));
+        ASSERT(&ATTRIBUTES[2] == X.lookup("third",  5));
+
+        ASSERT(0 == X.lookup("fourth", 6));
+        ASSERT(0 == X.lookup("firs",   4));
+        ASSERT(0 == X.lookup("",       0));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Looking up an attribute of a type having many attributes takes
+        //:   much less time using a table than using a linear search.
+        //
+        // Plan:
+        //: 1 For several numbers of generated attributes, look up every
+        //:   attribute many times using a linear search (as the
+        //:   'lookupAttributeInfo' class method of a generated type does) and
+        //:   using a table, and report the average time of a lookup.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int k_NUM_LOOKUPS = 4 * 1000 * 1000;
+
+        static const int SIZES[] = { 4, 10, 20, 40, 80, 160 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int n = SIZES[ti];
+
+            bsl::vector<bdlat_AttributeInfo> attributes;
+            bsl::vector<bsl::string>         names;
+
+            makeAttributes(&attributes, &names, n);
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            const Obj X(attributes.data(), n, &sa);
+
+            Int64 linearTime = 0;
+            Int64 tableTime  = 0;
+            int   found      = 0;
+
+            for (int useTable = 0; useTable < 2; ++useTable) {
+                const Int64 start = bsls::TimeUtil::getTimer();
+
+                for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+                    const bsl::string& name = names[i % n];
+                    const int          len  = static_cast<int>(name.length());
+
+                    const bdlat_AttributeInfo *info =
+                        useTable
+                        ? X.lookup(name.data(), len)
+                        : linearLookup(attributes.data(), n, name.data(), len);
+
+                    found += 0 != info;
+                }
+
+                const Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+                (useTable ? tableTime : linearTime) = elapsed;
+            }
+
+            ASSERTV(n, 2 * k_NUM_LOOKUPS == found);
+
+            cout << n << " attributes: linear "
+                 << static_cast<double>(linearTime) / k_NUM_LOOKUPS
+                 << " ns, table "
+                 << static_cast<double>(tableTime)  / k_NUM_LOOKUPS
+                 << " ns per lookup" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
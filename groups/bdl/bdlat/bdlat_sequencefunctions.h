@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlat_SequenceFunctions: namespace for calling sequence functions
 //
-//@SEE_ALSO: bdlat_attributeinfo
+//@SEE_ALSO: bdlat_attributeinfo, bdlat_attributelookuptable
 //
 //@DESCRIPTION: The 'bdlat_SequenceFunctions' 'namespace' provided in this
 // component defines parameterized functions that expose "sequence" behavior
@@ -40,7 +40,13 @@ BSLS_IDENT("$Id: $")
 // behavior through the 'bdlat_SequenceFunctions' 'namespace'.
 //
 // This component specializes all of these functions for types that have the
-// 'bdlat_TypeTraitBasicSequence' trait.
+// 'bdlat_TypeTraitBasicSequence' trait.  If such a type also has the
+// 'bdlat_HasAttributeLookupTable' trait, the functions taking an attribute
+// name find the attribute in the 'bdlat_AttributeLookupTable' returned by the
+// 'attributeLookupTable' class method of the type (in constant time on
+// average), and then forward to the corresponding member function of the
+// type taking an attribute id; otherwise, they forward to the member functions
+// of the type taking an attribute name.  See 'bdlat_attributelookuptable'.
 //
 // Types that do not have the 'bdlat_TypeTraitBasicSequence' trait can be
 // plugged into the 'bdlat' framework.  This is done by overloading the
@@ -582,12 +588,14 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlat_attributelookuptable.h>
 #include <bdlat_bdeatoverrides.h>
 #include <bdlat_typetraits.h>
 
 #include <bslalg_hastrait.h>
 
 #include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_matchanytype.h>
 #include <bslmf_metaint.h>
 
@@ -772,6 +780,58 @@ namespace bdlat_SequenceFunctions {
 
 }  // close namespace bdlat_SequenceFunctions
 
+// ---- Anything below this line is implementation specific.  Do not use.  ----
+
+                     // ==================================
+                     // struct bdlat_SequenceFunctions_Imp
+                     // ==================================
+
+struct bdlat_SequenceFunctions_Imp {
+    // This 'struct' provides the default implementations of the name-based
+    // overloadable functions, selecting between a lookup using the
+    // 'bdlat_AttributeLookupTable' of a type having the
+    // 'bdlat_HasAttributeLookupTable' trait (the 'bsl::true_type' overloads)
+    // and the name-based member functions of any other type (the
+    // 'bsl::false_type' overloads).
+
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE         *object,
+                                   MANIPULATOR&  manipulator,
+                                   const char   *attributeName,
+                                   int           attributeNameLength,
+                                   bsl::true_type);
+    template <class TYPE, class MANIPULATOR>
+    static int manipulateAttribute(TYPE         *object,
+                                   MANIPULATOR&  manipulator,
+                                   const char   *attributeName,
+                                   int           attributeNameLength,
+                                   bsl::false_type);
+
+    template <class TYPE, class ACCESSOR>
+    static int accessAttribute(const TYPE&  object,
+                               ACCESSOR&    accessor,
+                               const char  *attributeName,
+                               int          attributeNameLength,
+                               bsl::true_type);
+    template <class TYPE, class ACCESSOR>
+    static int accessAttribute(const TYPE&  object,
+                               ACCESSOR&    accessor,
+                               const char  *attributeName,
+                               int          attributeNameLength,
+                               bsl::false_type);
+
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&  object,
+                             const char  *attributeName,
+                             int          attributeNameLength,
+                             bsl::true_type);
+    template <class TYPE>
+    static bool hasAttribute(const TYPE&  object,
+                             const char  *attributeName,
+                             int          attributeNameLength,
+                             bsl::false_type);
+};
+
 // ============================================================================
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -933,9 +993,14 @@ int bdlat_SequenceFunctions::bdlat_sequenceManipulateAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return object->manipulateAttribute(manipulator,
-                                       attributeName,
-                                       attributeNameLength);
+    typedef typename bdlat_HasAttributeLookupTable<TYPE>::type HasTable;
+
+    return bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                                                           object,
+                                                           manipulator,
+                                                           attributeName,
+                                                           attributeNameLength,
+                                                           HasTable());
 }
 
 template <class TYPE, class MANIPULATOR>
@@ -976,9 +1041,14 @@ int bdlat_SequenceFunctions::bdlat_sequenceAccessAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return object.accessAttribute(accessor,
-                                  attributeName,
-                                  attributeNameLength);
+    typedef typename bdlat_HasAttributeLookupTable<TYPE>::type HasTable;
+
+    return bdlat_SequenceFunctions_Imp::accessAttribute(
+                                                           object,
+                                                           accessor,
+                                                           attributeName,
+                                                           attributeNameLength,
+                                                           HasTable());
 }
 
 template <class TYPE, class ACCESSOR>
@@ -1020,7 +1090,13 @@ bool bdlat_SequenceFunctions::bdlat_sequenceHasAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
+    typedef typename bdlat_HasAttributeLookupTable<TYPE>::type HasTable;
+
+    return bdlat_SequenceFunctions_Imp::hasAttribute(
+                                                           object,
+                                                           attributeName,
+                                                           attributeNameLength,
+                                                           HasTable());
 }
 
 template <class TYPE>
@@ -1038,6 +1114,99 @@ bool bdlat_SequenceFunctions::bdlat_sequenceHasAttribute(
 #pragma warning( pop )
 #endif
 
+                     // ----------------------------------
+                     // struct bdlat_SequenceFunctions_Imp
+                     // ----------------------------------
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                                             TYPE         *object,
+                                             MANIPULATOR&  manipulator,
+                                             const char   *attributeName,
+                                             int           attributeNameLength,
+                                             bsl::true_type)
+{
+    const bdlat_AttributeInfo *info = TYPE::attributeLookupTable().lookup(
+                                                          attributeName,
+                                                          attributeNameLength);
+    if (!info) {
+        return -1;                                                    // RETURN
+    }
+
+    return object->manipulateAttribute(manipulator, info->d_id);
+}
+
+template <class TYPE, class MANIPULATOR>
+inline
+int bdlat_SequenceFunctions_Imp::manipulateAttribute(
+                                             TYPE         *object,
+                                             MANIPULATOR&  manipulator,
+                                             const char   *attributeName,
+                                             int           attributeNameLength,
+                                             bsl::false_type)
+{
+    return object->manipulateAttribute(manipulator,
+                                       attributeName,
+                                       attributeNameLength);
+}
+
+template <class TYPE, class ACCESSOR>
+inline
+int bdlat_SequenceFunctions_Imp::accessAttribute(
+                                              const TYPE&  object,
+                                              ACCESSOR&    accessor,
+                                              const char  *attributeName,
+                                              int          attributeNameLength,
+                                              bsl::true_type)
+{
+    const bdlat_AttributeInfo *info = TYPE::attributeLookupTable().lookup(
+                                                          attributeName,
+                                                          attributeNameLength);
+    if (!info) {
+        return -1;                                                    // RETURN
+    }
+
+    return object.accessAttribute(accessor, info->d_id);
+}
+
+template <class TYPE, class ACCESSOR>
+inline
+int bdlat_SequenceFunctions_Imp::accessAttribute(
+                                              const TYPE&  object,
+                                              ACCESSOR&    accessor,
+                                              const char  *attributeName,
+                                              int          attributeNameLength,
+                                              bsl::false_type)
+{
+    return object.accessAttribute(accessor,
+                                  attributeName,
+                                  attributeNameLength);
+}
+
+template <class TYPE>
+inline
+bool bdlat_SequenceFunctions_Imp::hasAttribute(
+                                              const TYPE&,
+                                              const char  *attributeName,
+                                              int          attributeNameLength,
+                                              bsl::true_type)
+{
+    return 0 != TYPE::attributeLookupTable().lookup(attributeName,
+                                                    attributeNameLength);
+}
+
+template <class TYPE>
+inline
+bool bdlat_SequenceFunctions_Imp::hasAttribute(
+                                              const TYPE&  object,
+                                              const char  *attributeName,
+                                              int          attributeNameLength,
+                                              bsl::false_type)
+{
+    return 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
+}
+
 }  // close enterprise namespace
 
 #endif
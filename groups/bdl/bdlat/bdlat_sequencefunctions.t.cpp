@@ -13,11 +13,14 @@
 #include <bslim_testutil.h>
 
 #include <bdlat_attributeinfo.h>
+#include <bdlat_attributelookuptable.h>
 #include <bdlat_formattingmode.h>
 #include <bdlat_typetraits.h>
 
 #include <bslalg_typetraits.h>
 
+#include <bslmf_nestedtraitdeclaration.h>
+
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iomanip.h>
@@ -45,6 +48,7 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // [ 1] METHOD FORWARDING TEST
 // [ 2] INFO ACCESS TEST
+// [ 3] ATTRIBUTE LOOKUP TABLE TEST
 // [ 4] USAGE EXAMPLE
 
 // ============================================================================
@@ -314,6 +318,75 @@ const bdlat_AttributeInfo *Point::lookupAttributeInfo(int id)
     }
 }
 
+                             // =================
+                             // class TabledPoint
+                             // =================
+
+class TabledPoint {
+    // This class is a "sequence" type having the attributes of 'Point', and
+    // providing a 'bdlat_AttributeLookupTable' of them.  Each member function
+    // records its invocation in 'globalFlag'; those taking an attribute id
+    // record '10 + id'.
+
+  public:
+    // TYPE TRAITS
+    BSLALG_DECLARE_NESTED_TRAITS(TabledPoint, bdlat_TypeTraitBasicSequence);
+    BSLMF_NESTED_TRAIT_DECLARATION(TabledPoint,
+                                   bdlat_HasAttributeLookupTable);
+
+    // CLASS METHODS
+    static const bdlat_AttributeLookupTable& attributeLookupTable()
+        // Return a reference to the non-modifiable table of the attributes of
+        // this class.
+    {
+        static const bdlat_AttributeLookupTable table(
+                                                   Point::ATTRIBUTE_INFO_ARRAY,
+                                                   Point::NUM_ATTRIBUTES);
+        return table;
+    }
+
+    static const bdlat_AttributeInfo *lookupAttributeInfo(const char *, int)
+        // look up the attribute with a given name
+    {
+        globalFlag = 1;
+        return 0;
+    }
+
+    // MANIPULATORS
+    template<class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&, const char *, int)
+        // visit the modifiable attribute with a given name
+    {
+        globalFlag = 2;
+        return globalFlag;
+    }
+
+    template<class MANIPULATOR>
+    int manipulateAttribute(MANIPULATOR&, int id)
+        // visit the modifiable attribute with a given id
+    {
+        globalFlag = 10 + id;
+        return globalFlag;
+    }
+
+    // ACCESSORS
+    template<class ACCESSOR>
+    int accessAttribute(ACCESSOR&, const char *, int) const
+        // visit the non-modifiable attribute with a given name
+    {
+        globalFlag = 3;
+        return globalFlag;
+    }
+
+    template<class ACCESSOR>
+    int accessAttribute(ACCESSOR&, int id) const
+        // visit the non-modifiable attribute with a given id
+    {
+        globalFlag = 10 + id;
+        return globalFlag;
+    }
+};
+
 }  // close namespace geom
 
 // ============================================================================
@@ -768,7 +841,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 4: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -795,6 +868,73 @@ int main(int argc, char *argv[])
                     "age: 25\n"
                     "salary: 12345.00\n" == ss.str());
       } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ATTRIBUTE LOOKUP TABLE TEST
+        //
+        // Concerns:
+        //: 1 For a type having the 'bdlat_HasAttributeLookupTable' trait,
+        //:   'manipulateAttribute' and 'accessAttribute' taking an attribute
+        //:   name forward to the member function of the type taking the id of
+        //:   the attribute found in the table of the type, and return
+        //:   non-zero without invoking the type if the name is not found.
+        //:
+        //: 2 'hasAttribute' taking an attribute name consults the table of
+        //:   the type, and not its 'lookupAttributeInfo' class method.
+        //
+        // Plan:
+        //: 1 Invoke the name-based functions on an object of a type that
+        //:   records the member functions invoked, for names that are, and
+        //:   are not, the names of its attributes.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Attribute names are found using the lookup table.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ATTRIBUTE LOOKUP TABLE TEST" << endl
+                          << "===========================" << endl;
+
+        geom::TabledPoint mP;  const geom::TabledPoint& P = mP;
+        int               dummyVisitor;
+
+        globalFlag = 0;
+        ASSERT(11 == Obj::manipulateAttribute(&mP, dummyVisitor, "X", 1));
+        ASSERT(11 == globalFlag);
+
+        globalFlag = 0;
+        ASSERT(12 == Obj::manipulateAttribute(&mP, dummyVisitor, "Y", 1));
+        ASSERT(12 == globalFlag);
+
+        globalFlag = 0;
+        ASSERT(0  != Obj::manipulateAttribute(&mP, dummyVisitor, "Z", 1));
+        ASSERT(0  == globalFlag);
+
+        globalFlag = 0;
+        ASSERT(12 == Obj::accessAttribute(P, dummyVisitor, "Y", 1));
+        ASSERT(12 == globalFlag);
+
+        globalFlag = 0;
+        ASSERT(0  != Obj::accessAttribute(P, dummyVisitor, "XY", 2));
+        ASSERT(0  == globalFlag);
+
+        globalFlag = 0;
+        ASSERT( Obj::hasAttribute(P, "X", 1));
+        ASSERT(!Obj::hasAttribute(P, "x", 1));
+        ASSERT(0  == globalFlag);
+
+        if (verbose) cout << "\nTypes without a table are unaffected." << endl;
+
+        geom::Point mX;  const geom::Point& X = mX;
+
+        globalFlag = 0;
+        ASSERT( Obj::hasAttribute(X, "X", 1));
+        ASSERT(!Obj::hasAttribute(X, "Z", 1));
+
+        globalFlag = 0;
+        ASSERT(1  == Obj::manipulateAttribute(&mX, dummyVisitor, "Z", 1));
+        ASSERT(1  == globalFlag);
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // TESTING META-FUNCTIONS
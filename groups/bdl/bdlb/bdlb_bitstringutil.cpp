@@ -1036,6 +1036,141 @@ bsl::ostream& newlineAndIndent(bsl::ostream& stream,
     return stream;
 }
 
+                        // for 'findNth[01]At{Max,Min}Index'
+
+static inline
+int selectSetBit(uint64_t value, size_t nth)
+    // Return the index of the specified 'nth' least-significant set bit in
+    // the specified 'value'.  The behavior is undefined unless '0 < nth' and
+    // 'nth <= BitUtil::numBitsSet(value)'.
+{
+    BSLS_ASSERT(0 < nth);
+    BSLS_ASSERT(nth <= static_cast<size_t>(BitUtil::numBitsSet(value)));
+
+    // Narrow the search to the half of 'value' holding the bit sought, halving
+    // the width of the search at each step.
+
+    int ret = 0;
+    for (int width = k_BITS_PER_UINT64 / 2; 0 < width; width /= 2) {
+        const uint64_t low   = value & lt64Raw(width);
+        const size_t   count = BitUtil::numBitsSet(low);
+
+        if (count < nth) {
+            nth   -= count;
+            value >>= width;
+            ret   += width;
+        }
+        else {
+            value = low;
+        }
+    }
+
+    return ret;
+}
+
+static
+size_t findNthSetAtMaxIndex(const uint64_t *bitString,
+                            size_t          begin,
+                            size_t          end,
+                            size_t          nth,
+                            uint64_t        flip)
+    // Return the index of the specified 'nth' most-significant bit in the
+    // specified range '[begin .. end)' of the specified 'bitString' that is
+    // set once the words of 'bitString' are XOR-ed with the specified 'flip',
+    // if such a bit exists, and 'BitStringUtil::k_INVALID_INDEX' otherwise.
+    // The behavior is undefined unless 'begin <= end', 'end' is less than or
+    // equal to the length of 'bitString', and '0 < nth'.  Note that whole
+    // words are skipped by counting their set bits, so that the cost of this
+    // function is linear in the number of words searched rather than in
+    // 'nth'.
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < nth);
+
+    if (begin == end) {
+        return bdlb::BitStringUtil::k_INVALID_INDEX;                  // RETURN
+    }
+
+    const size_t beginWord =        begin / k_BITS_PER_UINT64;
+    const int    beginIdx  =    u32(begin) % k_BITS_PER_UINT64;
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
+
+    uint64_t value = (bitString[lastWord] ^ flip) & BitMaskUtil::lt64(endPos);
+
+    for (size_t ii = lastWord; true; value = bitString[--ii] ^ flip) {
+        if (beginWord == ii) {
+            value &= ge64Raw(beginIdx);
+        }
+
+        const size_t count = BitUtil::numBitsSet(value);
+
+        if (nth <= count) {
+            return ii * k_BITS_PER_UINT64
+                                    + selectSetBit(value, count - nth + 1);
+                                                                      // RETURN
+        }
+
+        if (beginWord == ii) {
+            return bdlb::BitStringUtil::k_INVALID_INDEX;              // RETURN
+        }
+
+        nth -= count;
+    }
+}
+
+static
+size_t findNthSetAtMinIndex(const uint64_t *bitString,
+                            size_t          begin,
+                            size_t          end,
+                            size_t          nth,
+                            uint64_t        flip)
+    // Return the index of the specified 'nth' least-significant bit in the
+    // specified range '[begin .. end)' of the specified 'bitString' that is
+    // set once the words of 'bitString' are XOR-ed with the specified 'flip',
+    // if such a bit exists, and 'BitStringUtil::k_INVALID_INDEX' otherwise.
+    // The behavior is undefined unless 'begin <= end', 'end' is less than or
+    // equal to the length of 'bitString', and '0 < nth'.  Note that whole
+    // words are skipped by counting their set bits, so that the cost of this
+    // function is linear in the number of words searched rather than in
+    // 'nth'.
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < nth);
+
+    if (begin == end) {
+        return bdlb::BitStringUtil::k_INVALID_INDEX;                  // RETURN
+    }
+
+    const size_t beginWord =        begin / k_BITS_PER_UINT64;
+    const int    beginIdx  =    u32(begin) % k_BITS_PER_UINT64;
+    const size_t lastWord  =    (end - 1) / k_BITS_PER_UINT64;
+    const int    endPos    = u32(end - 1) % k_BITS_PER_UINT64 + 1;
+
+    uint64_t value = (bitString[beginWord] ^ flip) & ge64Raw(beginIdx);
+
+    for (size_t ii = beginWord; true; value = bitString[++ii] ^ flip) {
+        if (lastWord == ii) {
+            value &= BitMaskUtil::lt64(endPos);
+        }
+
+        const size_t count = BitUtil::numBitsSet(value);
+
+        if (nth <= count) {
+            return ii * k_BITS_PER_UINT64 + selectSetBit(value, nth);
+                                                                      // RETURN
+        }
+
+        if (lastWord == ii) {
+            return bdlb::BitStringUtil::k_INVALID_INDEX;              // RETURN
+        }
+
+        nth -= count;
+    }
+}
+
 namespace BloombergLP {
 namespace bdlb {
 
@@ -1995,6 +2130,54 @@ size_t BitStringUtil::find1AtMinIndex(const uint64_t *bitString,
            : k_INVALID_INDEX;
 }
 
+size_t BitStringUtil::findNth0AtMaxIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          nth)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < nth);
+
+    return findNthSetAtMaxIndex(bitString, begin, end, nth, ~0ULL);
+}
+
+size_t BitStringUtil::findNth0AtMinIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          nth)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < nth);
+
+    return findNthSetAtMinIndex(bitString, begin, end, nth, ~0ULL);
+}
+
+size_t BitStringUtil::findNth1AtMaxIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          nth)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < nth);
+
+    return findNthSetAtMaxIndex(bitString, begin, end, nth, 0);
+}
+
+size_t BitStringUtil::findNth1AtMinIndex(const uint64_t *bitString,
+                                         size_t          begin,
+                                         size_t          end,
+                                         size_t          nth)
+{
+    BSLS_ASSERT(bitString);
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(0 < nth);
+
+    return findNthSetAtMinIndex(bitString, begin, end, nth, 0);
+}
+
 bool BitStringUtil::isAny0(const uint64_t *bitString,
                            size_t          index,
                            size_t          numBits)
@@ -187,13 +187,21 @@ BSLS_IDENT("$Id: $")
 //
 //                                     Find
 // +--------------------------------------------------------------------------+
-// | find0AtMaxIndex | Locate the highest-order 0 bit in a range.             |
+// | find0AtMaxIndex    | Locate the highest-order 0 bit in a range.          |
 // +--------------------------------------------------------------------------+
-// | find0AtMinIndex | Locate the lowest-order 0 bit in a range.              |
+// | find0AtMinIndex    | Locate the lowest-order 0 bit in a range.           |
 // +--------------------------------------------------------------------------+
-// | find1AtMaxIndex | Locate the highest-order 1 bit in a range.             |
+// | find1AtMaxIndex    | Locate the highest-order 1 bit in a range.          |
 // +--------------------------------------------------------------------------+
-// | find1AtMinIndex | Locate the lowest-order 1 bit in a range.              |
+// | find1AtMinIndex    | Locate the lowest-order 1 bit in a range.           |
+// +--------------------------------------------------------------------------+
+// | findNth0AtMaxIndex | Locate the nth highest-order 0 bit in a range.      |
+// +--------------------------------------------------------------------------+
+// | findNth0AtMinIndex | Locate the nth lowest-order 0 bit in a range.       |
+// +--------------------------------------------------------------------------+
+// | findNth1AtMaxIndex | Locate the nth highest-order 1 bit in a range.      |
+// +--------------------------------------------------------------------------+
+// | findNth1AtMinIndex | Locate the nth lowest-order 1 bit in a range.       |
 // +--------------------------------------------------------------------------+
 //
 //
@@ -721,6 +729,54 @@ struct BitStringUtil {
         // unless 'begin <= end' and 'end' is less than or equal to the length
         // of 'bitString'.
 
+    static bsl::size_t findNth0AtMaxIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          nth);
+        // Return the index of the specified 'nth' most-significant 0 bit in
+        // the specified 'bitString' in the specified range '[begin .. end)',
+        // if such a bit exists, and 'k_INVALID_INDEX' otherwise.  The behavior
+        // is undefined unless 'begin <= end', 'end' is less than or equal to
+        // the length of 'bitString', and '0 < nth'.  Note that
+        // 'findNth0AtMaxIndex(bitString, begin, end, 1)' returns the same
+        // value as 'find0AtMaxIndex(bitString, begin, end)'.
+
+    static bsl::size_t findNth0AtMinIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          nth);
+        // Return the index of the specified 'nth' least-significant 0 bit in
+        // the specified 'bitString' in the specified range '[begin .. end)',
+        // if such a bit exists, and 'k_INVALID_INDEX' otherwise.  The behavior
+        // is undefined unless 'begin <= end', 'end' is less than or equal to
+        // the length of 'bitString', and '0 < nth'.  Note that
+        // 'findNth0AtMinIndex(bitString, begin, end, 1)' returns the same
+        // value as 'find0AtMinIndex(bitString, begin, end)'.
+
+    static bsl::size_t findNth1AtMaxIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          nth);
+        // Return the index of the specified 'nth' most-significant 1 bit in
+        // the specified 'bitString' in the specified range '[begin .. end)',
+        // if such a bit exists, and 'k_INVALID_INDEX' otherwise.  The behavior
+        // is undefined unless 'begin <= end', 'end' is less than or equal to
+        // the length of 'bitString', and '0 < nth'.  Note that
+        // 'findNth1AtMaxIndex(bitString, begin, end, 1)' returns the same
+        // value as 'find1AtMaxIndex(bitString, begin, end)'.
+
+    static bsl::size_t findNth1AtMinIndex(const bsl::uint64_t *bitString,
+                                          bsl::size_t          begin,
+                                          bsl::size_t          end,
+                                          bsl::size_t          nth);
+        // Return the index of the specified 'nth' least-significant 1 bit in
+        // the specified 'bitString' in the specified range '[begin .. end)',
+        // if such a bit exists, and 'k_INVALID_INDEX' otherwise.  The behavior
+        // is undefined unless 'begin <= end', 'end' is less than or equal to
+        // the length of 'bitString', and '0 < nth'.  Note that
+        // 'findNth1AtMinIndex(bitString, begin, end, 1)' returns the same
+        // value as 'find1AtMinIndex(bitString, begin, end)'.
+
                                 // Count
 
     static bool isAny0(const bsl::uint64_t *bitString,
@@ -75,13 +75,17 @@ using bsl::flush;
 // [20] St find1AtMaxIndex(U64 *bitString, St begin, St end);
 // [22] St find1AtMinIndex(const uint64_t *bitString, St length);
 // [22] St find1AtMinIndex(U64 *bitString, St begin, St end);
+// [23] St findNth0AtMaxIndex(U64 *bitString, St begin, St end, St nth);
+// [23] St findNth0AtMinIndex(U64 *bitString, St begin, St end, St nth);
+// [23] St findNth1AtMaxIndex(U64 *bitString, St begin, St end, St nth);
+// [23] St findNth1AtMinIndex(U64 *bitString, St begin, St end, St nth);
 // [ 6] bool isAny0(const uint64_t *bitString, St index, St numBits);
 // [ 6] bool isAny1(const uint64_t *bitString, St index, St numBits);
 // [13] St num0(const uint64_t *bitString, St index, St numBits);
 // [13] St num1(const uint64_t *bitString, St index, St numBits);
 // [12] OS& print(OS& stream, U64 *bs, St nb, int lvl, int spl);
 // ----------------------------------------------------------------------------
-// [23] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
 // [ 1] void populateBitString(U64 *bitString, St idx, char *ascii);
 // [ 1] void populateBitStringHex(U64 *bitString, St idx, char *ascii);
 // ----------------------------------------------------------------------------
@@ -961,7 +965,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 23: {
+      case 24: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1111,6 +1115,155 @@ int main(int argc, char *argv[])
     ASSERT(false == isOffMay28);
 //..
       } break;
+      case 23: {
+        // --------------------------------------------------------------------
+        // TESTING 'findNth[01]At{Max,Min}Index' METHODS
+        //   Ensure the methods return the expected value.
+        //
+        // Concerns:
+        //: 1 That each 'findNth[01]At{Max,Min}Index' function returns the
+        //:   index of the 'nth' matching bit in a range, counting from the
+        //:   lowest-order or highest-order end of the range as appropriate,
+        //:   or 'k_INVALID_INDEX' if the range has fewer than 'nth' matching
+        //:   bits.
+        //:
+        //: 2 That ranges and counts spanning several words, and ranges
+        //:   beginning and ending in the middle of a word, are handled.
+        //:
+        //: 3 That 'findNth[01]At{Max,Min}Index' with an 'nth' of 1 returns the
+        //:   same value as the corresponding 'find[01]At{Max,Min}Index'.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Iterate over different test arrays with 'setUpArray'.
+        //:   o Iterate over ranges '[begin .. end)' within the array.
+        //:     1 Record, in order, the indices of the bits in the range that
+        //:       match each value by inspecting every bit with 'bit'.
+        //:
+        //:     2 For each 'nth' from 1 to one more than the number of
+        //:       matching bits, verify that each function returns the
+        //:       recorded index, or 'k_INVALID_INDEX' if there is none.
+        //:       (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values.  (C-4)
+        //
+        // Testing:
+        //   St findNth0AtMaxIndex(U64 *bitString, St begin, St end, St nth);
+        //   St findNth0AtMinIndex(U64 *bitString, St begin, St end, St nth);
+        //   St findNth1AtMaxIndex(U64 *bitString, St begin, St end, St nth);
+        //   St findNth1AtMinIndex(U64 *bitString, St begin, St end, St nth);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'findNth[01]At{Max,Min}Index' METHODS\n"
+                          << "=============================================\n";
+
+        const int NUM_BITS = SET_UP_ARRAY_DIM * k_BITS_PER_UINT64;
+
+        uint64_t bits[SET_UP_ARRAY_DIM], control[SET_UP_ARRAY_DIM];
+
+        for (int ii = 0; ii < 150; ) {
+            setUpArray(control, &ii);
+            wordCpy(bits, control, sizeof(bits));
+
+            if (veryVerbose) {
+                P_(ii);    P(pHex(bits, NUM_BITS));
+            }
+
+            for (int begin = 0; begin <= NUM_BITS; incInt(&begin, NUM_BITS)) {
+                for (int end = begin; end <= NUM_BITS;
+                                                     incInt(&end, NUM_BITS)) {
+                    size_t idx0[NUM_BITS], idx1[NUM_BITS];
+                    size_t num0 = 0,       num1 = 0;
+
+                    for (int jj = begin; jj < end; ++jj) {
+                        if (Util::bit(bits, jj)) {
+                            idx1[num1++] = jj;
+                        }
+                        else {
+                            idx0[num0++] = jj;
+                        }
+                    }
+
+                    ASSERT(num0 == Util::num0(bits, begin, end - begin));
+
+                    for (size_t nth = 1; nth <= num0 + 1; ++nth) {
+                        const size_t EXP_MIN = nth <= num0
+                                             ? idx0[nth - 1]
+                                             : k_INVALID_INDEX;
+                        const size_t EXP_MAX = nth <= num0
+                                             ? idx0[num0 - nth]
+                                             : k_INVALID_INDEX;
+
+                        const size_t MIN =
+                             Util::findNth0AtMinIndex(bits, begin, end, nth);
+                        const size_t MAX =
+                             Util::findNth0AtMaxIndex(bits, begin, end, nth);
+
+                        ASSERTV(ii, begin, end, nth, MIN, EXP_MIN == MIN);
+                        ASSERTV(ii, begin, end, nth, MAX, EXP_MAX == MAX);
+                    }
+
+                    for (size_t nth = 1; nth <= num1 + 1; ++nth) {
+                        const size_t EXP_MIN = nth <= num1
+                                             ? idx1[nth - 1]
+                                             : k_INVALID_INDEX;
+                        const size_t EXP_MAX = nth <= num1
+                                             ? idx1[num1 - nth]
+                                             : k_INVALID_INDEX;
+
+                        const size_t MIN =
+                             Util::findNth1AtMinIndex(bits, begin, end, nth);
+                        const size_t MAX =
+                             Util::findNth1AtMaxIndex(bits, begin, end, nth);
+
+                        ASSERTV(ii, begin, end, nth, MIN, EXP_MIN == MIN);
+                        ASSERTV(ii, begin, end, nth, MAX, EXP_MAX == MAX);
+                    }
+
+                    ASSERT(Util::find0AtMinIndex(bits, begin, end) ==
+                                Util::findNth0AtMinIndex(bits, begin, end, 1));
+                    ASSERT(Util::find0AtMaxIndex(bits, begin, end) ==
+                                Util::findNth0AtMaxIndex(bits, begin, end, 1));
+                    ASSERT(Util::find1AtMinIndex(bits, begin, end) ==
+                                Util::findNth1AtMinIndex(bits, begin, end, 1));
+                    ASSERT(Util::find1AtMaxIndex(bits, begin, end) ==
+                                Util::findNth1AtMaxIndex(bits, begin, end, 1));
+                }
+            }
+
+            ASSERT(0 == wordCmp(bits, control, sizeof(bits)));
+        }
+
+        {
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_PASS(Util::findNth0AtMinIndex(bits,  0,   0, 1));
+            ASSERT_PASS(Util::findNth0AtMinIndex(bits, 10, 100, 5));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(   0,  0,   0, 1));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(bits, 10,   9, 1));
+            ASSERT_FAIL(Util::findNth0AtMinIndex(bits, 10, 100, 0));
+
+            ASSERT_PASS(Util::findNth0AtMaxIndex(bits,  0,   0, 1));
+            ASSERT_PASS(Util::findNth0AtMaxIndex(bits, 10, 100, 5));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(   0,  0,   0, 1));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(bits, 10,   9, 1));
+            ASSERT_FAIL(Util::findNth0AtMaxIndex(bits, 10, 100, 0));
+
+            ASSERT_PASS(Util::findNth1AtMinIndex(bits,  0,   0, 1));
+            ASSERT_PASS(Util::findNth1AtMinIndex(bits, 10, 100, 5));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(   0,  0,   0, 1));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(bits, 10,   9, 1));
+            ASSERT_FAIL(Util::findNth1AtMinIndex(bits, 10, 100, 0));
+
+            ASSERT_PASS(Util::findNth1AtMaxIndex(bits,  0,   0, 1));
+            ASSERT_PASS(Util::findNth1AtMaxIndex(bits, 10, 100, 5));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(   0,  0,   0, 1));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(bits, 10,   9, 1));
+            ASSERT_FAIL(Util::findNth1AtMaxIndex(bits, 10, 100, 0));
+        }
+      } break;
       case 22: {
         // --------------------------------------------------------------------
         // TESTING 'find1AtMinIndex' METHODS
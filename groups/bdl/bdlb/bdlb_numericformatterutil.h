@@ -0,0 +1,171 @@
+// bdlb_numericformatterutil.h                                        -*-C++-*-
+#ifndef INCLUDED_BDLB_NUMERICFORMATTERUTIL
+#define INCLUDED_BDLB_NUMERICFORMATTERUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide shortest round-trip conversion of floating-point to text.
+//
+//@CLASSES:
+//  bdlb::NumericFormatterUtil: namespace for floating-point formatting
+//
+//@SEE_ALSO: bdlb_numericparseutil
+//
+//@DESCRIPTION: This component provides a namespace,
+// 'bdlb::NumericFormatterUtil', containing functions that write the shortest
+// decimal text representation of a 'double' or 'float' value that, when
+// parsed back into the same type (e.g., by 'strtod', 'strtof', or
+// 'bdlb::NumericParseUtil::parseDouble'), yields exactly the original value.
+//
+// Printing a floating-point value with a fixed precision forces a choice
+// between output that is exact but needlessly long (e.g., "%.17g" renders
+// 0.1 as "0.10000000000000001") and output that is short but loses
+// information (e.g., "%.15g" renders '1.0 / 3.0' as "0.333333333333333",
+// which does not parse back to the same 'double').  The functions of this
+// component produce the shortest text that identifies the value exactly: 0.1
+// is rendered as "0.1" and '1.0 / 3.0' as "0.3333333333333333".  If more than
+// one shortest digit sequence identifies the value, the one closest to the
+// exact value is chosen.
+//
+// The conversion is performed with integer arithmetic only, following the
+// *Ryu* algorithm (see Ulf Adams, "Ryu: Fast Float-to-String Conversion",
+// PLDI 2018).  It does not allocate memory, does not consult the C locale,
+// and is typically several times faster than 'sprintf' with a fixed
+// precision.
+//
+///Output Format
+///-------------
+// The output format is that of the C++17 'std::to_chars' function without a
+// format argument: the shortest digit sequence is rendered either in fixed
+// notation (as by the "%f" 'printf' conversion) or in scientific notation (as
+// by the "%e" 'printf' conversion), whichever yields fewer characters, with
+// fixed notation preferred in case of a tie.  For example:
+//..
+//  Value                     Output
+//  ------------------------  -------------------------
+//  0.0                       0
+//  -0.0                      -0
+//  1.0                       1
+//  100.0                     100
+//  0.1                       0.1
+//  0.001                     0.001
+//  0.0001                    1e-04
+//  1.0 / 3.0                 0.3333333333333333
+//  1e22                      1e+22
+//  123456789012345680000.0   123456789012345680000
+//  DBL_MAX                   1.7976931348623157e+308
+//..
+// The exponent of scientific notation always has a sign and at least two
+// digits.  Note that in fixed notation a large value is padded with zeros
+// after its shortest significant digits (rather than printed exactly), so the
+// text is a valid representation of the value but not necessarily its exact
+// decimal expansion.  Positive and negative infinity are rendered "inf" and
+// "-inf", and NaN values are rendered "nan" or "-nan" (according to the sign
+// bit); callers needing a different rendering of these special values (e.g.,
+// to conform to a data-interchange format) should test for them before
+// calling.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing 'double' Values Without Loss of Precision
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are writing prices to a text file that will later be read back,
+// and want the values read to be identical to the values written, without
+// padding the file with more digits than are needed.
+//
+// First, we define a buffer large enough for any 'double':
+//..
+//  char buffer[bdlb::NumericFormatterUtil::k_DOUBLE_MAX_LENGTH];
+//..
+// Then, we format a value whose shortest representation is short:
+//..
+//  char *end = bdlb::NumericFormatterUtil::toChars(buffer,
+//                                                  buffer + sizeof buffer,
+//                                                  0.1);
+//  assert(0     != end);
+//  assert("0.1" == bsl::string(buffer, end));
+//..
+// Next, we format a value that needs every significant digit that a 'double'
+// can carry:
+//..
+//  const double third = 1.0 / 3.0;
+//
+//  end = bdlb::NumericFormatterUtil::toChars(buffer,
+//                                            buffer + sizeof buffer,
+//                                            third);
+//  assert("0.3333333333333333" == bsl::string(buffer, end));
+//..
+// Finally, we observe that the text parses back to exactly the original value:
+//..
+//  double parsed;
+//  int    rc = bdlb::NumericParseUtil::parseDouble(
+//                                             &parsed,
+//                                             bslstl::StringRef(buffer, end));
+//  assert(0     == rc);
+//  assert(third == parsed);
+//..
+
+#include <bdlscm_version.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+                        // ===========================
+                        // struct NumericFormatterUtil
+                        // ===========================
+
+struct NumericFormatterUtil {
+    // This 'struct' provides a namespace for a suite of functions that write
+    // the shortest round-trip text representation of floating-point values.
+
+    // TYPES
+    enum {
+        k_FLOAT_MAX_LENGTH  = 15,  // maximum length of the text written for
+                                   // a 'float' (a sign, 9 digits, a decimal
+                                   // point, and a 4-character exponent)
+
+        k_DOUBLE_MAX_LENGTH = 24   // maximum length of the text written for
+                                   // a 'double' (e.g.,
+                                   // "-2.2250738585072014e-308")
+    };
+
+    // CLASS METHODS
+    static char *toChars(char *first, char *last, double value);
+    static char *toChars(char *first, char *last, float  value);
+        // Write the shortest text representation of the specified 'value'
+        // that parses back into the same value of the type of 'value' into
+        // the character range starting at the specified 'first' and ending
+        // one before the specified 'last', using the format described in
+        // {Output Format}.  Return the address one past the last character
+        // written on success, and 0, with the contents of the range
+        // unspecified, if the range is too small to hold the text.  The
+        // written text is not null-terminated.  The behavior is undefined
+        // unless '[first, last)' is a valid range.  Note that a range of
+        // 'k_DOUBLE_MAX_LENGTH' (respectively, 'k_FLOAT_MAX_LENGTH')
+        // characters is sufficient for any 'double' (respectively, 'float')
+        // value.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
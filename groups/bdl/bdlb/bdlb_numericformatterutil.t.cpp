@@ -0,0 +1,669 @@
+// bdlb_numericformatterutil.t.cpp                                    -*-C++-*-
+
+#include <bdlb_numericformatterutil.h>
+
+#include <bdlb_numericparseutil.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bslim_testutil.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides two functions that write the shortest
+// round-trip text of a 'double' or 'float'.  We verify the exact output for a
+// table of values chosen to exercise each branch of the layout (fixed and
+// scientific notation, and the ties between them) and the boundaries of each
+// type.  We then verify, for a large number of pseudo-random bit patterns,
+// that the output parses back to the original value using the standard
+// library and is identical in its significant digits to the correctly
+// rounded output of 'sprintf' having the same number of digits, and that no
+// shorter correctly rounded output parses back to the original value.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] char *toChars(char *first, char *last, double value);
+// [ 3] char *toChars(char *first, char *last, float value);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] ROUND TRIP AND SHORTNESS
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlb::NumericFormatterUtil Util;
+typedef bsls::Types::Uint64        Uint64;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+Uint64 nextRandom(Uint64 *state)
+    // Advance the specified xorshift generator 'state' and return its new
+    // value.
+{
+    Uint64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+static
+bsl::string significantDigits(const char *text)
+    // Return the significant decimal digits of the number in the specified
+    // 'text' (i.e., its digits before any exponent, stripped of leading and
+    // trailing zeros).
+{
+    bsl::string digits;
+    for (const char *p = text; *p && 'e' != *p; ++p) {
+        if ('0' <= *p && *p <= '9' && (!digits.empty() || '0' != *p)) {
+            digits += *p;
+        }
+    }
+    while (!digits.empty() && '0' == digits[digits.length() - 1]) {
+        digits.erase(digits.length() - 1);
+    }
+    return digits;
+}
+
+template <class TYPE>
+TYPE parseValue(const char *text);
+    // Return the value of the specified 'TYPE' parsed by the standard library
+    // from the specified 'text'.
+
+template <>
+double parseValue<double>(const char *text)
+{
+    return bsl::strtod(text, 0);
+}
+
+template <>
+float parseValue<float>(const char *text)
+{
+    return strtof(text, 0);
+}
+
+template <class TYPE>
+void verifyRoundTrip(TYPE value, int line)
+    // Verify that 'Util::toChars' writes a shortest round-trip text for the
+    // specified 'value', reporting failures against the specified 'line'.
+{
+    char buffer[64];
+
+    char *end = Util::toChars(buffer, buffer + sizeof buffer, value);
+    ASSERTV(line, 0 != end);
+    if (!end) {
+        return;                                                       // RETURN
+    }
+    *end = '\0';
+
+    const TYPE parsed = parseValue<TYPE>(buffer);
+    ASSERTV(line, buffer, value == parsed);
+
+    const bsl::string digits    = significantDigits(buffer);
+    const int         numDigits = static_cast<int>(digits.length());
+
+    // The correctly rounded text having as many digits has the same digits.
+
+    char expected[64];
+    sprintf(expected, "%.*e", numDigits - 1, static_cast<double>(value));
+    ASSERTV(line, buffer, expected, digits == significantDigits(expected));
+
+    // The correctly rounded text having one fewer digit does not round trip.
+
+    if (1 < numDigits) {
+        char shorter[64];
+        sprintf(shorter, "%.*e", numDigits - 2, static_cast<double>(value));
+        ASSERTV(line, buffer, shorter, value != parseValue<TYPE>(shorter));
+    }
+
+    // The buffer size indicated by the component suffices, and a smaller
+    // buffer than the one needed is rejected.
+
+    const int maxLength = sizeof(TYPE) == sizeof(double)
+                          ? Util::k_DOUBLE_MAX_LENGTH
+                          : Util::k_FLOAT_MAX_LENGTH;
+    ASSERTV(line, buffer, end - buffer <= maxLength);
+    ASSERTV(line, buffer, 0 == Util::toChars(buffer, end - 1, value));
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing 'double' Values Without Loss of Precision
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are writing prices to a text file that will later be read back,
+// and want the values read to be identical to the values written, without
+// padding the file with more digits than are needed.
+//
+// First, we define a buffer large enough for any 'double':
+//..
+    char buffer[bdlb::NumericFormatterUtil::k_DOUBLE_MAX_LENGTH];
+//..
+// Then, we format a value whose shortest representation is short:
+//..
+    char *end = bdlb::NumericFormatterUtil::toChars(buffer,
+                                                    buffer + sizeof buffer,
+                                                    0.1);
+    ASSERT(0     != end);
+    ASSERT("0.1" == bsl::string(buffer, end));
+//..
+// Next, we format a value that needs every significant digit that a 'double'
+// can carry:
+//..
+    const double third = 1.0 / 3.0;
+
+    end = bdlb::NumericFormatterUtil::toChars(buffer,
+                                              buffer + sizeof buffer,
+                                              third);
+    ASSERT("0.3333333333333333" == bsl::string(buffer, end));
+//..
+// Finally, we observe that the text parses back to exactly the original value:
+//..
+    double parsed;
+    int    rc = bdlb::NumericParseUtil::parseDouble(
+                                               &parsed,
+                                               bslstl::StringRef(buffer, end));
+    ASSERT(0     == rc);
+    ASSERT(third == parsed);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // ROUND TRIP AND SHORTNESS
+        //
+        // Concerns:
+        //: 1 The text written for any finite value parses back to that value.
+        //:
+        //: 2 No text having fewer significant digits parses back to the
+        //:   value.
+        //:
+        //: 3 Among the texts having the fewest significant digits, the one
+        //:   closest to the value is written.
+        //:
+        //: 4 The text fits in the number of characters given by the
+        //:   'k_*_MAX_LENGTH' constants, and a range one character shorter
+        //:   than the text is rejected.
+        //
+        // Plan:
+        //: 1 For each of a large number of pseudo-random bit patterns
+        //:   representing finite values (covering every exponent, including
+        //:   subnormals), and for every power of 10 and small integer, write
+        //:   the text and verify that it parses back to the value with
+        //:   'strtod' (or 'strtof'), that its significant digits are those of
+        //:   the correctly rounded "%.*e" output of 'sprintf' having the same
+        //:   number of digits, and that the correctly rounded output having
+        //:   one fewer digit does not parse back to the value.  (C-1..4)
+        //
+        // Testing:
+        //   ROUND TRIP AND SHORTNESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ROUND TRIP AND SHORTNESS" << endl
+                          << "========================" << endl;
+
+        const int NUM_ITERATIONS = veryVerbose ? 10000000 : 200000;
+
+        if (verbose) cout << "\nTesting pseudo-random 'double' values.\n";
+        {
+            Uint64 state = 0x9E3779B97F4A7C15ULL;
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                const Uint64 bits = nextRandom(&state);
+                double       value;
+                memcpy(&value, &bits, sizeof value);
+                if (value != value
+                 || value ==  bsl::numeric_limits<double>::infinity()
+                 || value == -bsl::numeric_limits<double>::infinity()) {
+                    continue;
+                }
+                verifyRoundTrip(value, i);
+
+                // Also exercise values with short significands, which are
+                // most often written in practice.
+
+                verifyRoundTrip(static_cast<double>(bits % 1000000)
+                                                     / (1 + bits % 10000), i);
+            }
+        }
+
+        if (verbose) cout << "\nTesting pseudo-random 'float' values.\n";
+        {
+            Uint64 state = 0x2545F4914F6CDD1DULL;
+            for (int i = 0; i < NUM_ITERATIONS; ++i) {
+                const unsigned int bits =
+                              static_cast<unsigned int>(nextRandom(&state));
+                float              value;
+                memcpy(&value, &bits, sizeof value);
+                if (value != value
+                 || value ==  bsl::numeric_limits<float>::infinity()
+                 || value == -bsl::numeric_limits<float>::infinity()) {
+                    continue;
+                }
+                verifyRoundTrip(value, i);
+            }
+        }
+
+        if (verbose) cout << "\nTesting powers of 10 and integers.\n";
+        {
+            for (int e = -323; e <= 308; ++e) {
+                char text[16];
+                sprintf(text, "1e%d", e);
+                verifyRoundTrip(bsl::strtod(text, 0), e);
+            }
+            for (int e = -45; e <= 38; ++e) {
+                char text[16];
+                sprintf(text, "1e%d", e);
+                verifyRoundTrip(strtof(text, 0), e);
+            }
+            for (int i = 1; i <= 100000; ++i) {
+                verifyRoundTrip(static_cast<double>(i), i);
+                verifyRoundTrip(static_cast<float>(i), i);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'toChars' FOR 'float'
+        //
+        // Concerns:
+        //: 1 The shortest digits of a 'float' value are found, and differ from
+        //:   those of the same value converted to 'double'.
+        //:
+        //: 2 The layout is as for 'double'.
+        //:
+        //: 3 Special values, zeros, and the boundaries of the type are
+        //:   written as documented.
+        //
+        // Plan:
+        //: 1 Use the table-driven technique to verify the text written for a
+        //:   set of values.  (C-1..3)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, float value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'toChars' FOR 'float'" << endl
+                          << "=====================" << endl;
+
+        const float INF = bsl::numeric_limits<float>::infinity();
+        const float NAN = bsl::numeric_limits<float>::quiet_NaN();
+
+        static const struct {
+            int         d_line;
+            float       d_value;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE                   EXPECTED
+            //----  ----------------------  ---------------
+            { L_,    0.0f,                  "0"             },
+            { L_,   -0.0f,                  "-0"            },
+            { L_,    1.0f,                  "1"             },
+            { L_,    0.1f,                  "0.1"           },
+            { L_,   -2.5f,                  "-2.5"          },
+            { L_,    1.0f / 3.0f,           "0.33333334"    },
+            { L_,    3.14159f,              "3.14159"       },
+            { L_,    16777216.0f,           "16777216"      },
+            { L_,    1e10f,                 "1e+10"         },
+            { L_,    0.0001f,               "1e-04"         },
+            { L_,    FLT_MAX,               "3.4028235e+38" },
+            { L_,    FLT_MIN,               "1.1754944e-38" },
+            { L_,   -FLT_MIN,               "-1.1754944e-38"},
+            { L_,    1.4e-45f,              "1e-45"         },
+            { L_,    INF,                   "inf"           },
+            { L_,   -INF,                   "-inf"          },
+            { L_,    NAN,                   "nan"           },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE     = DATA[ti].d_line;
+            const float  VALUE    = DATA[ti].d_value;
+            const string EXPECTED = DATA[ti].d_expected;
+
+            char buffer[Util::k_FLOAT_MAX_LENGTH];
+
+            char *end = Util::toChars(buffer, buffer + sizeof buffer, VALUE);
+
+            ASSERTV(LINE, 0 != end);
+            if (!end) {
+                continue;
+            }
+
+            const string result(buffer, end);
+            if (veryVerbose) { T_ P_(LINE) P(result) }
+
+            ASSERTV(LINE, EXPECTED, result, EXPECTED == result);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'toChars' FOR 'double'
+        //
+        // Concerns:
+        //: 1 The shortest digits are written in fixed notation if that is no
+        //:   longer than scientific notation, and in scientific notation
+        //:   otherwise.
+        //:
+        //: 2 Large values written in fixed notation are padded with zeros.
+        //:
+        //: 3 The exponent of scientific notation has a sign and at least two
+        //:   digits.
+        //:
+        //: 4 Special values, zeros, subnormals, and the boundaries of the type
+        //:   are written as documented.
+        //:
+        //: 5 A range too small for the text is rejected.
+        //
+        // Plan:
+        //: 1 Use the table-driven technique to verify the text written for a
+        //:   set of values, and that it is rejected by any shorter range.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   char *toChars(char *first, char *last, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'toChars' FOR 'double'" << endl
+                          << "======================" << endl;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double NAN = bsl::numeric_limits<double>::quiet_NaN();
+
+        static const struct {
+            int         d_line;
+            double      d_value;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE                     EXPECTED
+            //----  ------------------------  -------------------------
+            { L_,    0.0,                     "0"                         },
+            { L_,   -0.0,                     "-0"                        },
+            { L_,    1.0,                     "1"                         },
+            { L_,   -1.0,                     "-1"                        },
+            { L_,    1.5,                     "1.5"                       },
+            { L_,   -2.5,                     "-2.5"                      },
+            { L_,    0.1,                     "0.1"                       },
+            { L_,    0.3,                     "0.3"                       },
+            { L_,    0.1 + 0.2,               "0.30000000000000004"       },
+            { L_,    1.0 / 3.0,               "0.3333333333333333"        },
+            { L_,    2.0 / 3.0,               "0.6666666666666666"        },
+            { L_,    1234.5,                  "1234.5"                    },
+            { L_,    123456.789,              "123456.789"                },
+
+            // fixed versus scientific notation
+
+            { L_,    100.0,                   "100"                       },
+            { L_,    1000.0,                  "1000"                      },
+            { L_,    10000.0,                 "10000"                     },
+            { L_,    100000.0,                "1e+05"                     },
+            { L_,    120000.0,                "120000"                    },
+            { L_,    0.001,                   "0.001"                     },
+            { L_,    0.0001,                  "1e-04"                     },
+            { L_,    0.00012,                 "0.00012"                   },
+            { L_,    0.000123,                "0.000123"                  },
+            { L_,    1e-7,                    "1e-07"                     },
+            { L_,    1e16,                    "1e+16"                     },
+            { L_,    1e22,                    "1e+22"                     },
+            { L_,    1e23,                    "1e+23"                     },
+            { L_,    9007199254740992.0,      "9007199254740992"          },
+            { L_,    9223372036854775808.0,   "9223372036854776000"       },
+            { L_,    123456789012345680000.0, "123456789012345680000"     },
+
+            // boundaries
+
+            { L_,    DBL_MAX,                 "1.7976931348623157e+308"   },
+            { L_,   -DBL_MAX,                 "-1.7976931348623157e+308"  },
+            { L_,    DBL_MIN,                 "2.2250738585072014e-308"   },
+            { L_,   -DBL_MIN,                 "-2.2250738585072014e-308"  },
+            { L_,    5e-324,                  "5e-324"                    },
+            { L_,    5e-310,                  "5e-310"                    },
+
+            // special values
+
+            { L_,    INF,                     "inf"                       },
+            { L_,   -INF,                     "-inf"                      },
+            { L_,    NAN,                     "nan"                       },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE     = DATA[ti].d_line;
+            const double VALUE    = DATA[ti].d_value;
+            const string EXPECTED = DATA[ti].d_expected;
+
+            char buffer[Util::k_DOUBLE_MAX_LENGTH];
+
+            char *end = Util::toChars(buffer, buffer + sizeof buffer, VALUE);
+
+            ASSERTV(LINE, 0 != end);
+            if (!end) {
+                continue;
+            }
+
+            const string result(buffer, end);
+            if (veryVerbose) { T_ P_(LINE) P(result) }
+
+            ASSERTV(LINE, EXPECTED, result, EXPECTED == result);
+
+            for (char *last = buffer; last < end; ++last) {
+                ASSERTV(LINE, last - buffer,
+                        0 == Util::toChars(buffer, last, VALUE));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a few 'double' and 'float' values and verify the text.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char buffer[Util::k_DOUBLE_MAX_LENGTH];
+
+        char *end = Util::toChars(buffer, buffer + sizeof buffer, 2.5);
+        ASSERT("2.5" == string(buffer, end));
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 0.1f);
+        ASSERT("0.1" == string(buffer, end));
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 1e300);
+        ASSERT("1e+300" == string(buffer, end));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Writing the shortest round-trip text is faster than writing the
+        //:   text with 'sprintf' at the precision needed to round-trip.
+        //
+        // Plan:
+        //: 1 Time writing a set of pseudo-random values having short and long
+        //:   shortest representations with 'toChars' and with "%.17g".
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_VALUES = 1000;
+        const int NUM_PASSES = 1000;
+
+        double values[NUM_VALUES];
+        Uint64 state = 0x9E3779B97F4A7C15ULL;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Uint64 bits = nextRandom(&state);
+            values[i] = 0 == i % 2
+                        ? static_cast<double>(bits % 100000000) / 100
+                        : static_cast<double>(bits % 1000000007) / 997;
+        }
+
+        char           buffer[32];
+        Uint64         totalLength = 0;
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int pass = 0; pass < NUM_PASSES; ++pass) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                totalLength += Util::toChars(buffer,
+                                             buffer + sizeof buffer,
+                                             values[i]) - buffer;
+            }
+        }
+        timer.stop();
+        const double toCharsTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int pass = 0; pass < NUM_PASSES; ++pass) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                totalLength += sprintf(buffer, "%.17g", values[i]);
+            }
+        }
+        timer.stop();
+        const double sprintfTime = timer.elapsedTime();
+
+        const double NUM_CALLS = static_cast<double>(NUM_VALUES) * NUM_PASSES;
+        cout << "toChars: " << toCharsTime / NUM_CALLS * 1e9 << " ns/value\n"
+             << "sprintf: " << sprintfTime / NUM_CALLS * 1e9 << " ns/value\n";
+        if (veryVerbose) {
+            P(totalLength)
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -93,9 +93,23 @@ BSLS_IDENT("$Id: $")
 ///Floating Point Values
 ///---------------------
 // The conversion from text to values of type 'double' results in the closest
-// representable value to the decimal text.  Note that this is the same as for
-// the standard library function 'strtod'.  For example, the ASCII string
-// "3.14159" is converted, on some platforms, to 3.1415899999999999.
+// representable value to the decimal text, with a value exactly halfway
+// between two representable values rounded to the one whose least significant
+// bit is zero.  Note that this is the same as for the standard library
+// function 'strtod' (in the "C" locale) on conforming platforms.  For example,
+// the ASCII string "3.14159" is converted to 3.1415899999999999.  Text whose
+// value is too large in magnitude to be represented is converted to infinity
+// (having the sign of the text), and text whose value is too small is
+// converted to the nearest subnormal value or zero.  Unlike 'strtod',
+// 'parseDouble' does not accept hexadecimal floating-point text: "0x1p4" is
+// parsed as 0, leaving "x1p4" as the remainder.
+//
+// 'parseDouble' reads the input directly from the supplied string reference:
+// it does not copy the input (which need not be null-terminated), does not
+// allocate memory, and does not depend on the current locale.  Almost all
+// input is converted with a few 64-bit integer multiplications; only values
+// very close to halfway between two representable values, and subnormal,
+// overflowing, or underflowing values, require a slower, exact computation.
 //
 ///Special Floating Point Values
 ///- - - - - - - - - - - - - - -
@@ -201,9 +215,9 @@ struct NumericParseUtil {
         // successfully parsed text, or the position at which a parse failure
         // was detected.  Return zero on success, and a non-zero value
         // otherwise.  The value of 'result' is unchanged if a parse failure
-        // occurs.  The behavior is undefined unless the current locale is the
-        // "C" locale, such that 'strcmp(setlocale(0, 0), "C") == 0'.  For more
-        // information see {Floating Point Values}.
+        // occurs.  Note that this function neither allocates memory nor
+        // depends on the current locale.  For more information see {Floating
+        // Point Values}.
 
     static int parseInt(int                      *result,
                         const bslstl::StringRef&  inputString,
@@ -73,7 +73,8 @@ using namespace bdlb;
 // [10] parseUshort(result, rest, input, base = 10)
 // [10] parseUshort(result, input, base = 10)
 //-----------------------------------------------------------------------------
-// [11] USAGE EXAMPLE
+// [11] CONCERN: 'parseDouble' is correctly rounded and does not allocate
+// [12] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -163,7 +164,7 @@ int main(int argc, char *argv[])
     using bslstl::StringRef;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -209,6 +210,213 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING PARSE DOUBLE: ROUNDING AND RESOURCE USE
+        //
+        // Concerns:
+        //:  1 The result is the 'double' nearest to the value of the input,
+        //:    with ties rounded to even, including for input having more
+        //:    than 19 significant digits, input exactly or very nearly
+        //:    halfway between two 'double' values, and subnormal,
+        //:    overflowing, and underflowing input.
+        //:
+        //:  2 Every finite 'double' printed with 17 significant digits parses
+        //:    back to the same 'double'.
+        //:
+        //:  3 No character beyond the end of the input string is read (i.e.,
+        //:    the input need not be null-terminated).
+        //:
+        //:  4 No memory is allocated, even for very long input.
+        //
+        // Plan:
+        //:  1 Using the table-driven technique, parse a set of hard cases and
+        //:    compare the bits of each result with the expected bits, which
+        //:    were computed independently using exact arithmetic.  (C-1)
+        //:
+        //:  2 Print 'double' values having random bit patterns with "%.17g"
+        //:    and verify that each parses back to the original value.  (C-2)
+        //:
+        //:  3 Parse each input of P-1 and P-2 from a buffer in which it is
+        //:    followed by more digits, passing a string reference that
+        //:    excludes them.  (C-3)
+        //:
+        //:  4 Install a test allocator as the default allocator, and verify
+        //:    that no memory is allocated by P-1..3 nor by parsing input of
+        //:    several thousand characters.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: 'parseDouble' is correctly rounded and does not allocate
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PARSE DOUBLE: ROUNDING AND RESOURCE USE"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int  SZ = 128;
+        char       buffer[SZ];
+
+        if (verbose) cout << "\nHard cases." << endl;
+        {
+            static const struct {
+                int         d_lineNum;  // source line number
+                const char *d_spec_p;   // specification string
+                Uint64      d_bits;     // bits of expected result
+            } DATA[] = {
+                //line spec                       expected bits
+                //---- --------------------------  ---------------------
+                { L_, "9007199254740993",         0x4340000000000000ULL },
+                { L_, "9007199254740993.0000000000000000001",
+                                                  0x4340000000000001ULL },
+                { L_, "9007199254740995",         0x4340000000000002ULL },
+                { L_, "7.2057594037927933e16",    0x4370000000000000ULL },
+                { L_, "1448997445238699",         0x4314976C0803FEACULL },
+                { L_, "1e23",                     0x44B52D02C7E14AF6ULL },
+                { L_, "0.1",                      0x3FB999999999999AULL },
+                { L_, "3.14159",                  0x400921F9F01B866EULL },
+                { L_, "123456789012345678901234567890",
+                                                  0x45F8EE90FF6C373EULL },
+                { L_, "0.000000000000000000000000000000000000000000001e45",
+                                                  0x3FF0000000000000ULL },
+                { L_, "2.2250738585072011e-308",  0x000FFFFFFFFFFFFFULL },
+                { L_, "2.2250738585072012e-308",  0x0010000000000000ULL },
+                { L_, "4.35679845e-310",          0x000050339B7F0B24ULL },
+                { L_, "8.5e-323",                 0x0000000000000011ULL },
+                { L_, "4.9406564584124654e-324",  0x0000000000000001ULL },
+                { L_, "5e-324",                   0x0000000000000001ULL },
+                { L_, "2.4703282292062327e-324",  0x0000000000000000ULL },
+                { L_, "2.4703282292062328e-324",  0x0000000000000001ULL },
+                { L_, "1e-400",                   0x0000000000000000ULL },
+                { L_, "8.98846567431158e307",     0x7FE0000000000000ULL },
+                { L_, "1.7976931348623157e308",   0x7FEFFFFFFFFFFFFFULL },
+                { L_, "1.7976931348623158e308",   0x7FEFFFFFFFFFFFFFULL },
+                { L_, "179769313486231580793728971405301e276",
+                                                  0x7FEFFFFFFFFFFFFFULL },
+                { L_, "1.7976931348623159e308",   0x7FF0000000000000ULL },
+                { L_, "1e400",                    0x7FF0000000000000ULL },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE = DATA[ti].d_lineNum;
+                const char *const  SPEC = DATA[ti].d_spec_p;
+                const Uint64       BITS = DATA[ti].d_bits;
+                const bsl::size_t  LEN  = strlen(SPEC);
+
+                if (veryVerbose) { P_(LINE) P(SPEC) }
+
+                ASSERTV(LINE, LEN + 2 < SZ);
+
+                strcpy(buffer, SPEC);
+                strcpy(buffer + LEN, "99");
+
+                double    result = 0;
+                StringRef rest;
+                int       rv = NumericParseUtil::parseDouble(
+                                                    &result,
+                                                    &rest,
+                                                    StringRef(buffer, LEN));
+                ASSERTV(LINE, rv, 0 == rv);
+                ASSERTV(LINE, rest.empty());
+                ASSERTV(LINE, buffer + LEN == rest.data());
+
+                Uint64 bits;
+                memcpy(&bits, &result, sizeof bits);
+                ASSERTV(LINE, bits, BITS, BITS == bits);
+
+                // The negated text yields the negated value.
+
+                buffer[0] = '-';
+                strcpy(buffer + 1, SPEC);
+
+                rv = NumericParseUtil::parseDouble(&result,
+                                                   StringRef(buffer, LEN + 1));
+                ASSERTV(LINE, rv, 0 == rv);
+
+                memcpy(&bits, &result, sizeof bits);
+                ASSERTV(LINE, bits, BITS, (BITS | (1ULL << 63)) == bits);
+            }
+        }
+
+        if (verbose) cout << "\nRound trip of random values." << endl;
+        {
+            Uint64    state = 0x9E3779B97F4A7C15ULL;
+            const int NUM_VALUES = veryVerbose ? 10000000 : 100000;
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                state = state * 6364136223846793005ULL
+                      + 1442695040888963407ULL;
+
+                const Uint64 BITS = state ^ (state >> 29);
+                double       value;
+                memcpy(&value, &BITS, sizeof value);
+
+                if (value != value
+                 || value ==  bsl::numeric_limits<double>::infinity()
+                 || value == -bsl::numeric_limits<double>::infinity()) {
+                    continue;
+                }
+
+                const int len = sprintf(buffer, "%.17g", value);
+                strcpy(buffer + len, "12");
+
+                double    result = 0;
+                StringRef rest;
+                int       rv = NumericParseUtil::parseDouble(
+                                                    &result,
+                                                    &rest,
+                                                    StringRef(buffer, len));
+                ASSERTV(buffer, rv, 0 == rv);
+                ASSERTV(buffer, rest.empty());
+
+                Uint64 bits;
+                memcpy(&bits, &result, sizeof bits);
+                ASSERTV(buffer, BITS, bits, BITS == bits);
+            }
+        }
+
+        if (verbose) cout << "\nLong input." << endl;
+        {
+            // The value of the input, whose significand has 5001 digits, is
+            // slightly above halfway between 1 and the next 'double', so it
+            // must be rounded up.
+
+            bsl::string input("1.00000000000000011102230246251565404236316680"
+                              "908203125",
+                              &testAllocator);
+            input.append(4950, '0');
+            input.append("1e0x");
+
+            const bsl::size_t LEN = input.length() - 1;
+
+            double    result = 0;
+            StringRef rest;
+            int       rv = NumericParseUtil::parseDouble(
+                                               &result,
+                                               &rest,
+                                               StringRef(input.data(), LEN));
+            ASSERTV(rv, 0 == rv);
+            ASSERTV(rest.empty());
+            ASSERTV(result, 1.0000000000000002 == result);
+
+            // Without the final non-zero digit, the input is exactly halfway
+            // and is rounded to even.
+
+            input[LEN - 3] = '0';
+
+            rv = NumericParseUtil::parseDouble(&result,
+                                               StringRef(input.data(), LEN));
+            ASSERTV(rv, 0 == rv);
+            ASSERTV(result, 1.0 == result);
+        }
+
+        ASSERTV(da.numAllocations(), 0 == da.numAllocations());
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // TESTING PARSE USHORT
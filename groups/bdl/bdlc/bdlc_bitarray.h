@@ -935,6 +935,42 @@ class BitArray {
         // is not specified and 'effectiveEnd == end' otherwise.  The behavior
         // is undefined unless 'begin <= effectiveEnd <= length()'.
 
+    bsl::size_t findNth0AtMaxIndex(bsl::size_t begin,
+                                   bsl::size_t end,
+                                   bsl::size_t nth) const;
+        // Return the index of the specified 'nth' most-significant 0 bit in
+        // this array in the specified range '[begin .. end)', and
+        // 'k_INVALID_INDEX' if the range has fewer than 'nth' 0 bits.  The
+        // behavior is undefined unless 'begin <= end <= length()' and
+        // '0 < nth'.
+
+    bsl::size_t findNth0AtMinIndex(bsl::size_t begin,
+                                   bsl::size_t end,
+                                   bsl::size_t nth) const;
+        // Return the index of the specified 'nth' least-significant 0 bit in
+        // this array in the specified range '[begin .. end)', and
+        // 'k_INVALID_INDEX' if the range has fewer than 'nth' 0 bits.  The
+        // behavior is undefined unless 'begin <= end <= length()' and
+        // '0 < nth'.
+
+    bsl::size_t findNth1AtMaxIndex(bsl::size_t begin,
+                                   bsl::size_t end,
+                                   bsl::size_t nth) const;
+        // Return the index of the specified 'nth' most-significant 1 bit in
+        // this array in the specified range '[begin .. end)', and
+        // 'k_INVALID_INDEX' if the range has fewer than 'nth' 1 bits.  The
+        // behavior is undefined unless 'begin <= end <= length()' and
+        // '0 < nth'.
+
+    bsl::size_t findNth1AtMinIndex(bsl::size_t begin,
+                                   bsl::size_t end,
+                                   bsl::size_t nth) const;
+        // Return the index of the specified 'nth' least-significant 1 bit in
+        // this array in the specified range '[begin .. end)', and
+        // 'k_INVALID_INDEX' if the range has fewer than 'nth' 1 bits.  The
+        // behavior is undefined unless 'begin <= end <= length()' and
+        // '0 < nth'.
+
     bool isAny0() const;
         // Return 'true' if the value of any bit in this array is 0, and
         // 'false' otherwise.
@@ -1738,6 +1774,54 @@ bsl::size_t BitArray::find1AtMinIndex(bsl::size_t begin, bsl::size_t end) const
     return bdlb::BitStringUtil::find1AtMinIndex(data(), begin, end);
 }
 
+inline
+bsl::size_t BitArray::findNth0AtMaxIndex(bsl::size_t begin,
+                                       bsl::size_t end,
+                                       bsl::size_t nth) const
+{
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+    BSLS_ASSERT(0 < nth);
+
+    return bdlb::BitStringUtil::findNth0AtMaxIndex(data(), begin, end, nth);
+}
+
+inline
+bsl::size_t BitArray::findNth0AtMinIndex(bsl::size_t begin,
+                                       bsl::size_t end,
+                                       bsl::size_t nth) const
+{
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+    BSLS_ASSERT(0 < nth);
+
+    return bdlb::BitStringUtil::findNth0AtMinIndex(data(), begin, end, nth);
+}
+
+inline
+bsl::size_t BitArray::findNth1AtMaxIndex(bsl::size_t begin,
+                                       bsl::size_t end,
+                                       bsl::size_t nth) const
+{
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+    BSLS_ASSERT(0 < nth);
+
+    return bdlb::BitStringUtil::findNth1AtMaxIndex(data(), begin, end, nth);
+}
+
+inline
+bsl::size_t BitArray::findNth1AtMinIndex(bsl::size_t begin,
+                                       bsl::size_t end,
+                                       bsl::size_t nth) const
+{
+    BSLS_ASSERT(begin <= end);
+    BSLS_ASSERT(         end <= d_length);
+    BSLS_ASSERT(0 < nth);
+
+    return bdlb::BitStringUtil::findNth1AtMinIndex(data(), begin, end, nth);
+}
+
 inline
 bool BitArray::isAny0() const
 {
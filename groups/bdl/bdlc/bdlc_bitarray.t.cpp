@@ -36,6 +36,7 @@
 #include <bsl_string.h>
 #include <bsl_sstream.h>
 #include <bsl_new.h>         // placement new syntax
+#include <bsl_vector.h>
 
 #include <bsl_cctype.h>      // isspace, tolower
 #include <bsl_climits.h>     // CHAR_BIT
@@ -134,6 +135,10 @@ using bsl::uint64_t;
 // [28] size_t find0AtMinIndex(size_t begin, size_t end) const;
 // [27] size_t find1AtMaxIndex(size_t begin, size_t end) const;
 // [28] size_t find1AtMinIndex(size_t begin, size_t end) const;
+// [31] size_t findNth0AtMaxIndex(size_t begin, size_t end, size_t nth) const;
+// [31] size_t findNth0AtMinIndex(size_t begin, size_t end, size_t nth) const;
+// [31] size_t findNth1AtMaxIndex(size_t begin, size_t end, size_t nth) const;
+// [31] size_t findNth1AtMinIndex(size_t begin, size_t end, size_t nth) const;
 // [ 4] bool isAny0() const;
 // [ 4] bool isAny1() const;
 // [ 4] bool isEmpty() const;
@@ -157,7 +162,7 @@ using bsl::uint64_t;
 // [ 5] ostream& operator<<(ostream&, const BitArray&);
 // [ 8] void swap(BitArray& lhs, BitArray& rhs);
 //-----------------------------------------------------------------------------
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [ 3] BitArray gDispatch(const char *spec);
 // [ 3] BitArray& gg(BitArray* object, const char *spec);
 // [ 3] BitArray& ggDispatch(BitArray* object, const char *spec);
@@ -861,7 +866,7 @@ bsl::string randSpec(size_t length)
 
 static
 void testUsage()
-    // Test the usage example (see call in main 'switch', test case 31).  This
+    // Test the usage example (see call in main 'switch', test case 32).  This
     // code had to be moved out of the main 'switch', which had grown too
     // large, causing the AIX optimizing compiler to crash.
 {
@@ -1361,6 +1366,107 @@ void testFind1AtMinIndex()
         }
 }
 
+static
+void testFindNth()
+    // Test the 'findNth[01]At{Max,Min}Index' methods.  See documentation in
+    // case 31 of the main 'switch' statement.
+{
+        const char *SPECS[] = {
+           "0",      "01",     "011",    "0110",   "01100", "111111",
+           "0110001",         "01100011",         "011000110",
+           "0000100011100001001100000100110",
+           "00001000111000010011000001001101",
+           "000010001110000100110000010011010000100011100001001100000100110",
+           "00001000111000010011000001001101000010001110000100110000010011001",
+           "xhaq5haq5w3", "xh4w7q9ha", "xqah5yca532wdwb", "xhqyabdc9hawwd",
+           "xh01wwww0", "xwwww0h01h0", "xww0h01h0ww0",
+           0}; // Null string required as last element.
+
+        for (int ti = 0; SPECS[ti]; ++ti) {
+            for (int flip = 0; flip < 2; ++flip) {
+                const char *const DST = SPECS[ti];
+
+                Obj          mX;
+                const Obj&   X      = ggDispatch(&mX, DST);
+                const size_t curLen = X.length();
+
+                if (flip) {
+                    mX.toggleAll();
+                }
+
+                bsl::vector<size_t> idx0, idx1;
+
+                for (size_t begin = 0; begin <= curLen; ++begin) {
+                    for (size_t end = begin; end <= curLen; ++end) {
+                        idx0.clear();
+                        idx1.clear();
+
+                        for (size_t ii = begin; ii < end; ++ii) {
+                            (X[ii] ? idx1 : idx0).push_back(ii);
+                        }
+
+                        const size_t NUM0 = idx0.size();
+                        const size_t NUM1 = idx1.size();
+
+                        for (size_t nth = 1; nth <= NUM0 + 1; ++nth) {
+                            ASSERTV(DST, flip, begin, end, nth,
+                                    X.findNth0AtMinIndex(begin, end, nth) ==
+                                    (nth <= NUM0 ? idx0[nth - 1]
+                                                 : k_INVALID_INDEX));
+                            ASSERTV(DST, flip, begin, end, nth,
+                                    X.findNth0AtMaxIndex(begin, end, nth) ==
+                                    (nth <= NUM0 ? idx0[NUM0 - nth]
+                                                 : k_INVALID_INDEX));
+                        }
+
+                        for (size_t nth = 1; nth <= NUM1 + 1; ++nth) {
+                            ASSERTV(DST, flip, begin, end, nth,
+                                    X.findNth1AtMinIndex(begin, end, nth) ==
+                                    (nth <= NUM1 ? idx1[nth - 1]
+                                                 : k_INVALID_INDEX));
+                            ASSERTV(DST, flip, begin, end, nth,
+                                    X.findNth1AtMaxIndex(begin, end, nth) ==
+                                    (nth <= NUM1 ? idx1[NUM1 - nth]
+                                                 : k_INVALID_INDEX));
+                        }
+                    }
+                }
+            }
+        }
+
+        {
+            Obj mX;    const Obj& X = ggDispatch(&mX, "xwa");
+
+            bsls::AssertTestHandlerGuard guard;
+
+            size_t len = X.length();
+
+            ASSERT_SAFE_PASS(X.findNth0AtMaxIndex(      0,       0, 1));
+            ASSERT_SAFE_PASS(X.findNth0AtMaxIndex(      0,     len, 2));
+            ASSERT_SAFE_FAIL(X.findNth0AtMaxIndex(len / 2, len/2-1, 1));
+            ASSERT_SAFE_FAIL(X.findNth0AtMaxIndex(      0, len + 1, 1));
+            ASSERT_SAFE_FAIL(X.findNth0AtMaxIndex(      0,     len, 0));
+
+            ASSERT_SAFE_PASS(X.findNth0AtMinIndex(      0,       0, 1));
+            ASSERT_SAFE_PASS(X.findNth0AtMinIndex(      0,     len, 2));
+            ASSERT_SAFE_FAIL(X.findNth0AtMinIndex(len / 2, len/2-1, 1));
+            ASSERT_SAFE_FAIL(X.findNth0AtMinIndex(      0, len + 1, 1));
+            ASSERT_SAFE_FAIL(X.findNth0AtMinIndex(      0,     len, 0));
+
+            ASSERT_SAFE_PASS(X.findNth1AtMaxIndex(      0,       0, 1));
+            ASSERT_SAFE_PASS(X.findNth1AtMaxIndex(      0,     len, 2));
+            ASSERT_SAFE_FAIL(X.findNth1AtMaxIndex(len / 2, len/2-1, 1));
+            ASSERT_SAFE_FAIL(X.findNth1AtMaxIndex(      0, len + 1, 1));
+            ASSERT_SAFE_FAIL(X.findNth1AtMaxIndex(      0,     len, 0));
+
+            ASSERT_SAFE_PASS(X.findNth1AtMinIndex(      0,       0, 1));
+            ASSERT_SAFE_PASS(X.findNth1AtMinIndex(      0,     len, 2));
+            ASSERT_SAFE_FAIL(X.findNth1AtMinIndex(len / 2, len/2-1, 1));
+            ASSERT_SAFE_FAIL(X.findNth1AtMinIndex(      0, len + 1, 1));
+            ASSERT_SAFE_FAIL(X.findNth1AtMinIndex(      0,     len, 0));
+        }
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1417,7 +1523,7 @@ int main(int argc, char *argv[])
     strcat(LONG_SPEC_9, LONG_SPEC_1);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -1438,6 +1544,39 @@ int main(int argc, char *argv[])
 
         testUsage();
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING 'findNth[01]At{Max,Min}Index'
+        //
+        // Concerns:
+        //: 1 That each function returns the index of the 'nth' bit of the
+        //:   appropriate value in the range, counting from the appropriate end
+        //:   of the range, or 'k_INVALID_INDEX' if there is no such bit.
+        //:
+        //: 2 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a variety of specs, and for each such spec and its
+        //:   complement, vary 'begin' and 'end' over all possible ranges.
+        //:   o Record, in order, the indices of the 0 bits and of the 1 bits
+        //:     in the range.
+        //:   o For every 'nth' up to one more than the number of bits having
+        //:     each value, verify the value returned by each function.  (C-1)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-2)
+        //
+        // Testing:
+        //   size_t findNth0AtMaxIndex(size_t begin, size_t end, size_t nth);
+        //   size_t findNth0AtMinIndex(size_t begin, size_t end, size_t nth);
+        //   size_t findNth1AtMaxIndex(size_t begin, size_t end, size_t nth);
+        //   size_t findNth1AtMinIndex(size_t begin, size_t end, size_t nth);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'findNth[01]At{Max,Min}Index'\n"
+                               "=====================================\n";
+
+        testFindNth();
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING RANGE-BASED NUM0, NUM1
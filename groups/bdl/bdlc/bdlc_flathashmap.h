@@ -0,0 +1,867 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressed unordered map container
+//  bdlc::FlatHashMap_EntryUtil: entry policy for 'bdlc::FlatHashTable'
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashset, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashMap', implementing a value-semantic container that maps
+// unique keys of (template parameter) type 'KEY' to values of (template
+// parameter) type 'VALUE', using (template parameter) types 'HASH' and
+// 'EQUAL' to hash and compare keys.  The interface is a subset of that of
+// 'bsl::unordered_map'.
+//
+// Unlike 'bsl::unordered_map', which allocates a node for every element and
+// chains the nodes of each bucket in a linked list, 'bdlc::FlatHashMap' stores
+// its elements directly in a single array of slots using open addressing (see
+// 'bdlc_flathashtable').  Consequently, inserting an element does not
+// allocate memory unless the map must grow, and looking up a key usually
+// touches one group of 16 control bytes, compared all at once with SSE2
+// instructions where available, and one element.  In return:
+//
+//: o Inserting an element, or calling 'rehash' or 'reserve', may move all
+//:   elements, invalidating all iterators, pointers, and references to them.
+//:
+//: o 'VALUE' must be copy-constructible, and 'bsl::pair<const KEY, VALUE>'
+//:   must be move-constructible (or bitwise movable, see
+//:   'bslmf_isbitwisemoveable').
+//:
+//: o Memory is not reclaimed when elements are erased; use 'rehash(0)' or
+//:   'reset' to release it.
+//:
+//: o There is no bucket interface, and the maximum load factor is fixed at
+//:   0.875.
+//
+// Any hash functor that can be applied to 'KEY' may be used, including the
+// 'bslh::Hash<>' family and 'bsl::hash<KEY>' (the default).  Because hash
+// values are mixed before use (see 'bdlc_flathashtable'), identity hashes of
+// integers, such as 'bsl::hash<int>', perform well.
+//
+// 'bdlc::FlatHashMap' uses the 'bslma::Allocator' supplied at construction,
+// or the default allocator, for all of its memory, and passes that allocator
+// to its elements if they use 'bslma' allocators.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a text.  A
+// 'bdlc::FlatHashMap' from words to counts is a natural fit.
+//
+// First, we create the map, and a text to process:
+//..
+//  bdlc::FlatHashMap<bsl::string, int> wordCounts;
+//
+//  const char *const WORDS[] = { "the", "cat", "sat", "on", "the", "mat",
+//                                "and", "the", "cat", "slept" };
+//  const int NUM_WORDS = static_cast<int>(sizeof WORDS / sizeof *WORDS);
+//..
+// Then, we count the words using 'operator[]', which inserts a
+// default-constructed (zero) count the first time a word is seen:
+//..
+//  for (int i = 0; i < NUM_WORDS; ++i) {
+//      ++wordCounts[WORDS[i]];
+//  }
+//..
+// Finally, we verify the counts:
+//..
+//  assert(7 == wordCounts.size());
+//  assert(3 == wordCounts["the"]);
+//  assert(2 == wordCounts["cat"]);
+//  assert(1 == wordCounts.at("slept"));
+//  assert(!wordCounts.contains("dog"));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslalg_constructorproxy.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ============================
+                       // struct FlatHashMap_EntryUtil
+                       // ============================
+
+template <class KEY, class VALUE>
+struct FlatHashMap_EntryUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' policy required by
+    // 'FlatHashTable' for entries of type 'bsl::pair<const KEY, VALUE>'.
+
+    // TYPES
+    typedef bsl::pair<const KEY, VALUE> Entry;
+
+    // CLASS METHODS
+    static void constructFromKey(Entry            *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Construct at the specified 'entry' address an entry having the
+        // specified 'key' and a default-constructed value, using the
+        // specified 'allocator' to supply memory.
+
+    static const KEY& key(const Entry& entry);
+        // Return the key of the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This value-semantic class template implements an unordered map from
+    // unique keys of type 'KEY' to values of type 'VALUE' whose elements are
+    // stored in an open-addressed table, as described in the component
+    // documentation.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          bsl::pair<const KEY, VALUE>,
+                          FlatHashMap_EntryUtil<KEY, VALUE>,
+                          HASH,
+                          EQUAL> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                     key_type;
+    typedef VALUE                                   mapped_type;
+    typedef bsl::pair<const KEY, VALUE>             value_type;
+    typedef bsl::size_t                             size_type;
+    typedef bsl::ptrdiff_t                          difference_type;
+    typedef HASH                                    hasher;
+    typedef EQUAL                                   key_equal;
+    typedef value_type&                             reference;
+    typedef const value_type&                       const_reference;
+    typedef value_type                             *pointer;
+    typedef const value_type                       *const_pointer;
+    typedef typename ImplType::iterator             iterator;
+    typedef typename ImplType::const_iterator       const_iterator;
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t       capacity,
+                         bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'capacity' indicating the
+        // minimum initial number of slots.  If 'capacity' is not supplied or
+        // is 0, no memory is allocated.  Optionally specify a 'hash' functor
+        // used to hash keys; if 'hash' is not supplied, a default-constructed
+        // 'HASH' is used.  Optionally specify an 'equal' functor used to
+        // compare keys; if 'equal' is not supplied, a default-constructed
+        // 'EQUAL' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash = HASH(),
+                const EQUAL&      equal = EQUAL(),
+                bslma::Allocator *basicAllocator = 0);
+        // Create a map and insert each 'value_type' object in the range
+        // '[first, last)', ignoring those having a key already in the map.
+        // Optionally specify a 'capacity', 'hash' functor, 'equal' functor,
+        // and 'basicAllocator', as for the other constructors.  The behavior
+        // is undefined unless '[first, last)' is a valid range of objects
+        // convertible to 'value_type'.
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a map having the same value, functors, and capacity as the
+        // specified 'original'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~FlatHashMap();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this object the value and functors of the specified 'rhs'
+        // object, and return a reference providing modifiable access to this
+        // object.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key', first inserting an element having 'key' and
+        // a default-constructed value if 'key' is not in this map.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the value mapped
+        // to the specified 'key'.  Throw a 'std::out_of_range' exception if
+        // 'key' is not in this map.
+
+    iterator begin();
+        // Return an iterator to the first element of this map, or 'end()' if
+        // this map is empty.
+
+    void clear();
+        // Remove all elements from this map, retaining its capacity.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the (empty or one-element) range
+        // of elements of this map having the specified 'key'.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key' from this map, if
+        // any, and return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove the element at the specified 'position' from this map, and
+        // return an iterator to the element following it, or 'end()'.  The
+        // behavior is undefined unless 'position' refers to an element of this
+        // map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the elements in the range '[first, last)' from this map, and
+        // return 'last'.  The behavior is undefined unless '[first, last)' is
+        // a valid range of elements of this map.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator to the element having the specified 'key', or
+        // 'end()' if there is no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if its key is
+        // not already in this map.  Return a pair whose 'first' member refers
+        // to the element having the key of 'value', and whose 'second' member
+        // is 'true' if the element was inserted and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert each 'value_type' object in the range '[first, last)' whose
+        // key is not already in this map.  The behavior is undefined unless
+        // '[first, last)' is a valid range of objects convertible to
+        // 'value_type'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to the smallest valid capacity that
+        // is at least the specified 'minimumCapacity' and can hold 'size()'
+        // elements without exceeding the maximum load factor, and rehash all
+        // elements.  If the resulting capacity is 0, all memory held by this
+        // map is released.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this map, if needed, so that it can hold
+        // the specified 'numElements' without exceeding the maximum load
+        // factor.
+
+    void reset();
+        // Remove all elements from this map and release all memory, setting
+        // the capacity to 0.
+
+    void swap(FlatHashMap& other);
+        // Exchange the value and functors of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // guarantee.  The behavior is undefined unless this object was created
+        // with the same allocator as 'other'.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the value
+        // mapped to the specified 'key'.  Throw a 'std::out_of_range'
+        // exception if 'key' is not in this map.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator to the first element of this map, or 'end()' if
+        // this map is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this map.
+
+    const_iterator cend() const;
+    const_iterator end() const;
+        // Return the past-the-end iterator of this map.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map has an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map has no elements, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                         const;
+        // Return a pair of iterators defining the (empty or one-element) range
+        // of elements of this map having the specified 'key'.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the element having the specified 'key', or
+        // 'end()' if there is no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this map.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this map.
+
+    float load_factor() const;
+        // Return 'size() / capacity()', or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this map, 0.875.
+
+    bsl::size_t size() const;
+        // Return the number of elements of this map.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashMap' objects have the same
+    // value if they have the same number of elements, and for each element of
+    // 'lhs' there is an element of 'rhs' having an equal key and an equal
+    // value.  Note that the functors of 'lhs' and 'rhs' are not compared.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatHashMap' objects do not
+    // have the same value if they do not have the same number of elements, or
+    // some element of 'lhs' has no element of 'rhs' having an equal key and
+    // an equal value.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This
+    // function provides the no-throw guarantee if the two objects were created
+    // with the same allocator, and the basic guarantee otherwise.
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct FlatHashMap_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE>::constructFromKey(
+                                                 Entry            *entry,
+                                                 bslma::Allocator *allocator,
+                                                 const KEY&        key)
+{
+    bslalg::ConstructorProxy<VALUE> value(allocator);
+    bslma::ConstructionUtil::construct(entry, allocator, key, value.object());
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE>::key(const Entry& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                            const FlatHashMap&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::~FlatHashMap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl[key].second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                    "FlatHashMap<...>::at(key): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator,
+          typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    return d_impl.erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                    "FlatHashMap<...>::at(key): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator,
+          typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// TRAITS
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlc::FlatHashMap<KEY, VALUE, HASH, EQUAL> >
+                                                           : bsl::true_type {};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
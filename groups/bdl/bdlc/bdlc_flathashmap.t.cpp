@@ -0,0 +1,988 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a value-semantic container that forwards
+// nearly all of its operations to 'bdlc::FlatHashTable', which is tested
+// thoroughly in its own test driver.  This test driver therefore concentrates
+// on the forwarding: that each constructor passes its arguments through [2],
+// that element access and the 'at' exception work [3], that the manipulators
+// and accessors agree with 'bsl::unordered_map' for 'bslh::Hash' and
+// 'bsl::hash' [4], and that copying, assignment, 'swap', and equality behave
+// as for a value-semantic type [5].  Case -1 compares the performance of
+// 'bdlc::FlatHashMap' with that of 'bsl::unordered_map'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap();
+// [ 2] FlatHashMap(Allocator *basicAllocator);
+// [ 2] FlatHashMap(size_t capacity, Allocator *basicAllocator = 0);
+// [ 2] FlatHashMap(size_t capacity, const HASH&, Allocator * = 0);
+// [ 2] FlatHashMap(size_t capacity, const HASH&, const EQUAL&, Alloc * = 0);
+// [ 2] FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, Alloc * = 0);
+// [ 2] FlatHashMap(first, last, capacity, hash, equal, Allocator * = 0);
+// [ 5] FlatHashMap(const FlatHashMap& original, Allocator *ba = 0);
+// [ 2] ~FlatHashMap();
+//
+// MANIPULATORS
+// [ 5] FlatHashMap& operator=(const FlatHashMap& rhs);
+// [ 3] VALUE& operator[](const KEY& key);
+// [ 3] VALUE& at(const KEY& key);
+// [ 4] iterator begin();
+// [ 4] void clear();
+// [ 4] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 4] size_t erase(const KEY& key);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] iterator erase(iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 4] iterator end();
+// [ 4] iterator find(const KEY& key);
+// [ 4] pair<iterator, bool> insert(const value_type& value);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] void rehash(size_t minimumCapacity);
+// [ 4] void reserve(size_t numElements);
+// [ 4] void reset();
+// [ 5] void swap(FlatHashMap& other);
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY& key) const;
+// [ 4] const_iterator begin() const;
+// [ 4] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 4] const_iterator cend() const;
+// [ 4] const_iterator end() const;
+// [ 4] bool contains(const KEY& key) const;
+// [ 4] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 4] pair<const_iterator, const_iterator> equal_range(const KEY&) const;
+// [ 4] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 4] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 5] bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 5] void swap(FlatHashMap& a, FlatHashMap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64                      Int64;
+typedef bsls::Types::Uint64                     Uint64;
+typedef bdlc::FlatHashMap<int, bsl::string>     Obj;
+typedef bdlc::FlatHashMap<bsl::string,
+                          int,
+                          bslh::Hash<> >        StringObj;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct TaggedHash {
+    // This hash functor hashes 'int' values with 'bsl::hash<int>', and carries
+    // a tag to verify that it is copied.
+
+    int d_tag;
+
+    explicit TaggedHash(int tag = 0)
+    : d_tag(tag)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return bsl::hash<int>()(key);
+    }
+};
+
+struct TaggedEqual {
+    // This functor compares 'int' values, and carries a tag to verify that it
+    // is copied.
+
+    int d_tag;
+
+    explicit TaggedEqual(int tag = 0)
+    : d_tag(tag)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs == rhs;
+    }
+};
+
+typedef bdlc::FlatHashMap<int, int, TaggedHash, TaggedEqual> TaggedObj;
+
+unsigned int nextRandom(unsigned int *state)
+    // Return the next value of the linear congruential generator whose state
+    // is at the specified 'state' address.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xffffff;
+}
+
+Uint64 mix(Uint64 value)
+    // Return a pseudo-random permutation of the specified 'value'.
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    return value;
+}
+
+template <class MAP>
+double timeInsert(MAP *map, const bsl::vector<Uint64>& keys)
+    // Insert each of the specified 'keys' into the specified 'map', and return
+    // the elapsed time in seconds.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        (*map)[keys[i]] = i;
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class MAP>
+double timeFind(const MAP&                 map,
+                const bsl::vector<Uint64>& keys,
+                bsl::size_t               *numFound)
+    // Look up each of the specified 'keys' in the specified 'map', load the
+    // number found into the specified 'numFound', and return the elapsed time
+    // in seconds.
+{
+    bsl::size_t     found = 0;
+    bsls::Stopwatch timer;
+    timer.start();
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        found += map.find(keys[i]) != map.end();
+    }
+    timer.stop();
+    *numFound = found;
+    return timer.elapsedTime();
+}
+
+template <class MAP>
+double timeErase(MAP *map, const bsl::vector<Uint64>& keys)
+    // Erase each of the specified 'keys' from the specified 'map', and return
+    // the elapsed time in seconds.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        map->erase(keys[i]);
+    }
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+template <class MAP>
+void runBenchmark(const char                 *name,
+                  MAP                        *map,
+                  const bsl::vector<Uint64>& keys,
+                  const bsl::vector<Uint64>& lookupKeys,
+                  const bsl::vector<Uint64>& missingKeys,
+                  bslma::TestAllocator      *allocator)
+    // Measure and print, under the specified 'name', the time per operation
+    // for inserting the specified 'keys' into the specified empty 'map',
+    // looking up the specified 'lookupKeys' (a permutation of 'keys') and
+    // 'missingKeys', and erasing 'lookupKeys', along with the memory used
+    // from the specified 'allocator' when all keys are present.
+{
+    const double n        = static_cast<double>(keys.size());
+    const double insert   = timeInsert(map, keys);
+    const Int64  memory   = allocator->numBytesInUse();
+
+    bsl::size_t  numFound = 0;
+    const double hit      = timeFind(*map, lookupKeys, &numFound);
+    ASSERTV(name, keys.size() == numFound);
+
+    const double miss     = timeFind(*map, missingKeys, &numFound);
+    ASSERTV(name, 0 == numFound);
+
+    const double erase    = timeErase(map, lookupKeys);
+    ASSERTV(name, map->empty());
+
+    cout << name
+         << ": insert " << insert * 1e9 / n << " ns"
+         << ", find (hit) " << hit * 1e9 / n << " ns"
+         << ", find (miss) " << miss * 1e9 / n << " ns"
+         << ", erase " << erase * 1e9 / n << " ns"
+         << ", memory " << static_cast<double>(memory) / n << " bytes/key"
+         << endl;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a text.  A
+// 'bdlc::FlatHashMap' from words to counts is a natural fit.
+//
+// First, we create the map, and a text to process:
+//..
+    bdlc::FlatHashMap<bsl::string, int> wordCounts;
+
+    const char *const WORDS[] = { "the", "cat", "sat", "on", "the", "mat",
+                                  "and", "the", "cat", "slept" };
+    const int NUM_WORDS = static_cast<int>(sizeof WORDS / sizeof *WORDS);
+//..
+// Then, we count the words using 'operator[]', which inserts a
+// default-constructed (zero) count the first time a word is seen:
+//..
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        ++wordCounts[WORDS[i]];
+    }
+//..
+// Finally, we verify the counts:
+//..
+    ASSERT(7 == wordCounts.size());
+    ASSERT(3 == wordCounts["the"]);
+    ASSERT(2 == wordCounts["cat"]);
+    ASSERT(1 == wordCounts.at("slept"));
+    ASSERT(!wordCounts.contains("dog"));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the value of the original and uses the supplied
+        //:   allocator, or the default allocator if none is supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, returns a
+        //:   reference to the target, and keeps the target's allocator.
+        //:
+        //: 3 Maps compare equal if and only if they have the same keys mapped
+        //:   to equal values.
+        //:
+        //: 4 The 'swap' method and free function exchange values, and the free
+        //:   function supports different allocators.
+        //
+        // Plan:
+        //: 1 Copy, assign, swap, and compare maps built with different
+        //:   allocators, verifying values and allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap& original, Allocator *ba = 0);
+        //   FlatHashMap& operator=(const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& other);
+        //   bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& a, FlatHashMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        bslma::TestAllocator tb("other",  veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        for (int i = 0; i < 100; ++i) {
+            mX[i] = bsl::string(i, 'x');
+        }
+
+        {
+            Obj mY(X, &tb);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+            ASSERT(&tb == Y.allocator());
+            ASSERT(&tb == Y.at(50).get_allocator().mechanism());
+
+            mY[50] = "changed";
+            ASSERT(X != Y);
+            mY[50] = bsl::string(50, 'x');
+            ASSERT(X == Y);
+            mY.erase(50);
+            ASSERT(X != Y);
+            mY[150];
+            ASSERT(X != Y);
+        }
+        {
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(&defaultAllocator == Y.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            Obj mY(&tb);  const Obj& Y = mY;
+            mY[1000] = "to be replaced";
+
+            Obj *mR = &(mY = X);
+            ASSERT(&mY == mR);
+            ASSERT(X == Y);
+            ASSERT(&tb == Y.allocator());
+
+            mR = &(mY = Y);
+            ASSERT(&mY == mR);
+            ASSERT(X == Y);
+        }
+
+        {
+            Obj mY(&ta);
+            mY[7] = "seven";
+            const Obj XX(X, &ta);
+            const Obj YY(mY, &ta);
+
+            const Int64 blocks = ta.numBlocksTotal();
+            mX.swap(mY);
+            ASSERT(blocks == ta.numBlocksTotal());
+            ASSERT(YY == X);
+            ASSERT(XX == mY);
+
+            swap(mX, mY);
+            ASSERT(blocks == ta.numBlocksTotal());
+            ASSERT(XX == X);
+            ASSERT(YY == mY);
+
+            Obj mZ(&tb);
+            swap(mX, mZ);
+            ASSERT(X.empty());
+            ASSERT(XX == mZ);
+            ASSERT(&ta == X.allocator());
+            ASSERT(&tb == mZ.allocator());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each manipulator and accessor forwards correctly, so that the map
+        //:   behaves as 'bsl::unordered_map' for the same operations.
+        //:
+        //: 2 'bslh::Hash<>' and 'bsl::hash' can be used as the hash functor.
+        //:
+        //: 3 The capacity manipulators preserve the elements.
+        //
+        // Plan:
+        //: 1 Apply random operations to a map of strings using 'bslh::Hash<>'
+        //:   and to a 'bsl::unordered_map' oracle, verifying after each batch
+        //:   that they hold the same elements.  (C-1..2)
+        //:
+        //: 2 Exercise the remaining manipulators on a map using 'bsl::hash',
+        //:   verifying the results.  (C-1..3)
+        //
+        // Testing:
+        //   iterator begin();
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator end();
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numElements);
+        //   void reset();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(KEY) const;
+        //   const_iterator find(const KEY& key) const;
+        //   float load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS AND ACCESSORS" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tRandom operations with 'bslh::Hash<>'."
+                          << endl;
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+            bsl::unordered_map<bsl::string, int> oracle;
+
+            unsigned int state = 12345;
+            for (int i = 0; i < 20000; ++i) {
+                const unsigned int op  = nextRandom(&state) % 8;
+                char               buffer[32];
+                bsl::sprintf(buffer,
+                             "key number %u",
+                             nextRandom(&state) % 2000);
+                const bsl::string  key(buffer);
+
+                if (op < 3) {
+                    const bsl::pair<StringObj::iterator, bool> rc =
+                             mX.insert(StringObj::value_type(key, i));
+                    ASSERTV(i, rc.second == oracle.insert(
+                                bsl::pair<bsl::string, int>(key, i)).second);
+                    ASSERTV(i, key == rc.first->first);
+                    ASSERTV(i, oracle[key] == rc.first->second);
+                }
+                else if (op < 4) {
+                    mX[key] = i;
+                    oracle[key] = i;
+                }
+                else if (op < 6) {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                }
+                else if (op < 7) {
+                    StringObj::iterator it = mX.find(key);
+                    ASSERTV(i, (it == mX.end()) == (0 == oracle.count(key)));
+                    if (it != mX.end()) {
+                        ASSERTV(i, oracle[key] == it->second);
+                        mX.erase(it);
+                        oracle.erase(key);
+                    }
+                }
+                else {
+                    ASSERTV(i, oracle.count(key) == X.count(key));
+                    ASSERTV(i, !!oracle.count(key) == X.contains(key));
+                    const bsl::pair<StringObj::const_iterator,
+                                    StringObj::const_iterator> range =
+                                                            X.equal_range(key);
+                    ASSERTV(i, oracle.count(key) ==
+                               static_cast<bsl::size_t>(
+                                    bsl::distance(range.first, range.second)));
+                }
+
+                if (0 == i % 1000) {
+                    ASSERTV(i, oracle.size() == X.size());
+                    bsl::size_t numVisited = 0;
+                    for (StringObj::const_iterator it = X.cbegin();
+                         it != X.cend();
+                         ++it, ++numVisited) {
+                        ASSERTV(i, oracle.count(it->first));
+                        ASSERTV(i, oracle[it->first] == it->second);
+                    }
+                    ASSERTV(i, oracle.size() == numVisited);
+                }
+            }
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\tRemaining manipulators." << endl;
+        {
+            bsl::vector<bsl::pair<int, bsl::string> > data;
+            for (int i = 0; i < 200; ++i) {
+                data.push_back(bsl::pair<int, bsl::string>(i % 150, "v"));
+            }
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.insert(data.begin(), data.end());
+            ASSERT(150 == X.size());
+            ASSERT(0.0f < X.load_factor());
+
+            mX.reserve(5000);
+            ASSERT(5000 <= X.capacity() * 7 / 8);
+            ASSERT(150 == X.size());
+            for (int i = 0; i < 150; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+
+            mX.rehash(0);
+            ASSERT(256 == X.capacity());
+            ASSERT(150 == X.size());
+
+            bsl::pair<Obj::iterator, Obj::iterator> range =
+                                                           mX.equal_range(10);
+            ASSERT(range.first != range.second);
+            range.first->second = "ten";
+            ASSERT("ten" == X.at(10));
+
+            const Obj::iterator it       = mX.begin();
+            const int           firstKey = it->first;
+            mX.erase(it);
+            ASSERT(!X.contains(firstKey));
+            ASSERT(149 == X.size());
+
+            Obj::const_iterator cit = X.find(20);
+            mX.erase(cit);
+            ASSERT(!X.contains(20));
+
+            Obj::iterator last = mX.erase(X.begin(), X.end());
+            ASSERT(last == mX.end());
+            ASSERT(X.empty());
+            ASSERT(256 == X.capacity());
+
+            mX[1] = "one";
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 < X.capacity());
+
+            mX.reset();
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts a default-constructed value, using the
+        //:   map's allocator, if the key is not present, and otherwise returns
+        //:   the existing value.
+        //:
+        //: 2 'at' returns the value mapped to a present key, and throws
+        //:   'std::out_of_range' otherwise, without changing the map.
+        //
+        // Plan:
+        //: 1 Access present and absent keys through both methods, verifying
+        //:   the results and the exceptions thrown.  (C-1..2)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY& key);
+        //   VALUE& at(const KEY& key);
+        //   const VALUE& at(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ELEMENT ACCESS" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+
+        ASSERT("" == mX[5]);
+        ASSERT(1 == X.size());
+        ASSERT(&ta == mX[5].get_allocator().mechanism());
+
+        mX[5] = "five";
+        ASSERT("five" == mX[5]);
+        ASSERT(1 == X.size());
+
+        mX.at(5) += "!";
+        ASSERT("five!" == X.at(5));
+
+        bool caught = false;
+        try {
+            mX.at(6);
+        }
+        catch (const bsl::out_of_range&) {
+            caught = true;
+        }
+        ASSERT(caught);
+
+        caught = false;
+        try {
+            X.at(6);
+        }
+        catch (const bsl::out_of_range&) {
+            caught = true;
+        }
+        ASSERT(caught);
+        ASSERT(1 == X.size());
+        ASSERT(!X.contains(6));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map having the requested capacity,
+        //:   functors, and allocator, and no memory is allocated for a
+        //:   capacity of 0.
+        //:
+        //: 2 The range constructors insert each element, ignoring duplicate
+        //:   keys.
+        //:
+        //: 3 The allocator is the default allocator if none is supplied.
+        //:
+        //: 4 The 'UsesBslmaAllocator' trait is declared.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor and verify the basic accessors
+        //:   and allocation counts.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   FlatHashMap(Allocator *basicAllocator);
+        //   FlatHashMap(size_t capacity, Allocator *basicAllocator = 0);
+        //   FlatHashMap(size_t capacity, const HASH&, Allocator * = 0);
+        //   FlatHashMap(size_t, const HASH&, const EQUAL&, Alloc * = 0);
+        //   FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, Alloc *);
+        //   FlatHashMap(first, last, capacity, hash, equal, Allocator * = 0);
+        //   ~FlatHashMap();
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(bslma::UsesBslmaAllocator<TaggedObj>::value);
+
+        {
+            const TaggedObj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0 == X.hash_function().d_tag);
+            ASSERT(0 == X.key_eq().d_tag);
+        }
+        {
+            const TaggedObj X(&ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+        }
+        {
+            const TaggedObj X(100, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(128 == X.capacity());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        {
+            const TaggedObj X(1, TaggedHash(3), &ta);
+            ASSERT(16 == X.capacity());
+            ASSERT(3 == X.hash_function().d_tag);
+            ASSERT(0 == X.key_eq().d_tag);
+        }
+        {
+            const TaggedObj X(0, TaggedHash(3), TaggedEqual(4), &ta);
+            ASSERT(0 == X.capacity());
+            ASSERT(3 == X.hash_function().d_tag);
+            ASSERT(4 == X.key_eq().d_tag);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        bsl::map<int, int> data;
+        for (int i = 0; i < 40; ++i) {
+            data[i * 3] = i;
+        }
+        {
+            const TaggedObj X(data.begin(), data.end(), &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(40 == X.size());
+            for (int i = 0; i < 40; ++i) {
+                ASSERTV(i, i == X.at(i * 3));
+            }
+        }
+        {
+            const TaggedObj X(data.begin(),
+                              data.end(),
+                              1000,
+                              TaggedHash(5),
+                              TaggedEqual(6),
+                              &ta);
+            ASSERT(40 == X.size());
+            ASSERT(1024 == X.capacity());
+            ASSERT(5 == X.hash_function().d_tag);
+            ASSERT(6 == X.key_eq().d_tag);
+        }
+        {
+            bsl::vector<bsl::pair<int, int> > pairs;
+            pairs.push_back(bsl::pair<int, int>(1, 10));
+            pairs.push_back(bsl::pair<int, int>(1, 20));
+            pairs.push_back(bsl::pair<int, int>(2, 30));
+
+            const TaggedObj X(pairs.begin(), pairs.end(), &ta);
+            ASSERT(2 == X.size());
+            ASSERT(10 == X.at(1));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, modify, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(&ta);  const Obj& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT(mX.insert(Obj::value_type(1, "one")).second);
+        ASSERT(mX.insert(Obj::value_type(2, "two")).second);
+        ASSERT(!mX.insert(Obj::value_type(1, "uno")).second);
+        ASSERT(2 == X.size());
+        ASSERT("one" == X.at(1));
+
+        mX[3] = "three";
+        ASSERT(3 == X.size());
+        ASSERT("three" == X.find(3)->second);
+        ASSERT(X.end() == X.find(4));
+
+        ASSERT(1 == mX.erase(2));
+        ASSERT(!X.contains(2));
+        ASSERT(2 == X.size());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 'bdlc::FlatHashMap' is faster and uses less memory than
+        //:   'bsl::unordered_map' for large numbers of small elements.
+        //
+        // Plan:
+        //: 1 For a number of 64-bit keys given by the optional second argument
+        //:   (default 1,000,000), time inserting the keys into each map,
+        //:   looking up each key, looking up as many absent keys, and erasing
+        //:   each key, and report the time per operation and the memory used
+        //:   per key.  The keys are pseudo-random and are looked up and erased
+        //:   in a shuffled order, so that operations access memory randomly
+        //:   once the map is larger than the cache.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const bsl::size_t numKeys = argc > 2
+                                  ? static_cast<bsl::size_t>(
+                                                     bsl::atof(argv[2]))
+                                  : 1000000;
+        P(numKeys);
+
+        bsl::vector<Uint64> keys(numKeys);
+        bsl::vector<Uint64> missingKeys(numKeys);
+        for (bsl::size_t i = 0; i < numKeys; ++i) {
+            keys[i]        = mix(2 * i);
+            missingKeys[i] = mix(2 * i + 1);
+        }
+
+        // Look up the keys in a different order than they were inserted, so
+        // that node-based maps do not benefit from allocating nodes in
+        // insertion order.
+
+        bsl::vector<Uint64> lookupKeys(keys);
+        for (bsl::size_t i = numKeys; i > 1; --i) {
+            bsl::swap(lookupKeys[i - 1],
+                      lookupKeys[static_cast<bsl::size_t>(mix(i) % i)]);
+        }
+
+        {
+            bslma::TestAllocator ta("flat", false);
+            bdlc::FlatHashMap<Uint64, Uint64, bslh::Hash<> > map(&ta);
+            runBenchmark("bdlc::FlatHashMap (bslh::Hash)  ",
+                         &map,
+                         keys,
+                         lookupKeys,
+                         missingKeys,
+                         &ta);
+        }
+        {
+            bslma::TestAllocator ta("unordered", false);
+            bsl::unordered_map<Uint64, Uint64, bslh::Hash<> > map(&ta);
+            runBenchmark("bsl::unordered_map (bslh::Hash) ",
+                         &map,
+                         keys,
+                         lookupKeys,
+                         missingKeys,
+                         &ta);
+        }
+        {
+            bslma::TestAllocator ta("flat", false);
+            bdlc::FlatHashMap<Uint64, Uint64> map(&ta);
+            runBenchmark("bdlc::FlatHashMap (bsl::hash)   ",
+                         &map,
+                         keys,
+                         lookupKeys,
+                         missingKeys,
+                         &ta);
+        }
+        {
+            bslma::TestAllocator ta("unordered", false);
+            bsl::unordered_map<Uint64, Uint64> map(&ta);
+            runBenchmark("bsl::unordered_map (bsl::hash)  ",
+                         &map,
+                         keys,
+                         lookupKeys,
+                         missingKeys,
+                         &ta);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
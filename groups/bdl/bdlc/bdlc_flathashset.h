@@ -0,0 +1,735 @@
+// bdlc_flathashset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHSET
+#define INCLUDED_BDLC_FLATHASHSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered set container.
+//
+//@CLASSES:
+//  bdlc::FlatHashSet: open-addressed unordered set container
+//  bdlc::FlatHashSet_EntryUtil: entry policy for 'bdlc::FlatHashTable'
+//
+//@SEE_ALSO: bdlc_flathashtable, bdlc_flathashmap, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashSet', implementing a value-semantic container of unique
+// keys of (template parameter) type 'KEY', using (template parameter) types
+// 'HASH' and 'EQUAL' to hash and compare keys.  The interface is a subset of
+// that of 'bsl::unordered_set'.
+//
+// 'bdlc::FlatHashSet' stores its keys directly in a single array of slots
+// using open addressing (see 'bdlc_flathashtable'), rather than in
+// individually allocated nodes as 'bsl::unordered_set' does, so inserting a
+// key does not allocate memory unless the set must grow, and a lookup usually
+// touches one group of 16 control bytes and one key.  The trade-offs are the
+// same as for 'bdlc::FlatHashMap':
+//
+//: o Inserting a key, or calling 'rehash' or 'reserve', may move all keys,
+//:   invalidating all iterators, pointers, and references to them.
+//:
+//: o 'KEY' must be copy-constructible and move-constructible (or bitwise
+//:   movable, see 'bslmf_isbitwisemoveable').
+//:
+//: o Memory is not reclaimed when keys are erased; use 'rehash(0)' or
+//:   'reset' to release it.
+//:
+//: o There is no bucket interface, and the maximum load factor is fixed at
+//:   0.875.
+//
+// Any hash functor that can be applied to 'KEY' may be used, including the
+// 'bslh::Hash<>' family and 'bsl::hash<KEY>' (the default).
+//
+// 'bdlc::FlatHashSet' uses the 'bslma::Allocator' supplied at construction,
+// or the default allocator, for all of its memory, and passes that allocator
+// to its keys if they use 'bslma' allocators.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we receive a stream of order identifiers, some of which are
+// repeated, and we want to process each identifier only once.
+//
+// First, we create a set to track the identifiers already seen, reserving
+// room for the number we expect:
+//..
+//  bdlc::FlatHashSet<int> seen;
+//  seen.reserve(8);
+//
+//  const int IDS[]   = { 17, 4, 17, 99, 4, 23, 17 };
+//  const int NUM_IDS = static_cast<int>(sizeof IDS / sizeof *IDS);
+//..
+// Then, we process each identifier whose insertion succeeds:
+//..
+//  int numProcessed = 0;
+//  for (int i = 0; i < NUM_IDS; ++i) {
+//      if (seen.insert(IDS[i]).second) {
+//          ++numProcessed;
+//      }
+//  }
+//..
+// Finally, we verify that each distinct identifier was processed once:
+//..
+//  assert(4 == numProcessed);
+//  assert(4 == seen.size());
+//  assert(seen.contains(99));
+//  assert(!seen.contains(5));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ============================
+                       // struct FlatHashSet_EntryUtil
+                       // ============================
+
+template <class KEY>
+struct FlatHashSet_EntryUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' policy required by
+    // 'FlatHashTable' for entries that are keys.
+
+    // CLASS METHODS
+    static void constructFromKey(KEY              *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Construct at the specified 'entry' address a copy of the specified
+        // 'key', using the specified 'allocator' to supply memory.
+
+    static const KEY& key(const KEY& entry);
+        // Return the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashSet
+                            // =================
+
+template <class KEY,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashSet {
+    // This value-semantic class template implements an unordered set of
+    // unique keys of type 'KEY' stored in an open-addressed table, as
+    // described in the component documentation.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          KEY,
+                          FlatHashSet_EntryUtil<KEY>,
+                          HASH,
+                          EQUAL> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying table
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const FlatHashSet<K, H, E>&,
+                           const FlatHashSet<K, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                     key_type;
+    typedef KEY                                     value_type;
+    typedef bsl::size_t                             size_type;
+    typedef bsl::ptrdiff_t                          difference_type;
+    typedef HASH                                    hasher;
+    typedef EQUAL                                   key_equal;
+    typedef value_type&                             reference;
+    typedef const value_type&                       const_reference;
+    typedef value_type                             *pointer;
+    typedef const value_type                       *const_pointer;
+    typedef typename ImplType::const_iterator       iterator;
+    typedef typename ImplType::const_iterator       const_iterator;
+
+    // CREATORS
+    FlatHashSet();
+    explicit FlatHashSet(bslma::Allocator *basicAllocator);
+    explicit FlatHashSet(bsl::size_t       capacity,
+                         bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'capacity' indicating the
+        // minimum initial number of slots.  If 'capacity' is not supplied or
+        // is 0, no memory is allocated.  Optionally specify a 'hash' functor
+        // used to hash keys; if 'hash' is not supplied, a default-constructed
+        // 'HASH' is used.  Optionally specify an 'equal' functor used to
+        // compare keys; if 'equal' is not supplied, a default-constructed
+        // 'EQUAL' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash = HASH(),
+                const EQUAL&      equal = EQUAL(),
+                bslma::Allocator *basicAllocator = 0);
+        // Create a set and insert each key in the range '[first, last)',
+        // ignoring duplicates.  Optionally specify a 'capacity', 'hash'
+        // functor, 'equal' functor, and 'basicAllocator', as for the other
+        // constructors.  The behavior is undefined unless '[first, last)' is a
+        // valid range of objects convertible to 'KEY'.
+
+    FlatHashSet(const FlatHashSet&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a set having the same value, functors, and capacity as the
+        // specified 'original'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~FlatHashSet();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashSet& operator=(const FlatHashSet& rhs);
+        // Assign to this object the value and functors of the specified 'rhs'
+        // object, and return a reference providing modifiable access to this
+        // object.
+
+    void clear();
+        // Remove all keys from this set, retaining its capacity.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the specified 'key' from this set, if present, and return the
+        // number of keys removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the key at the specified 'position' from this set, and return
+        // an iterator to the key following it, or 'end()'.  The behavior is
+        // undefined unless 'position' refers to a key of this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the keys in the range '[first, last)' from this set, and
+        // return 'last'.  The behavior is undefined unless '[first, last)' is
+        // a valid range of keys of this set.
+
+    bsl::pair<iterator, bool> insert(const KEY& key);
+        // Insert a copy of the specified 'key' into this set if it is not
+        // already present.  Return a pair whose 'first' member refers to the
+        // key in this set equal to 'key', and whose 'second' member is 'true'
+        // if the key was inserted and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert each key in the range '[first, last)' that is not already in
+        // this set.  The behavior is undefined unless '[first, last)' is a
+        // valid range of objects convertible to 'KEY'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this set to the smallest valid capacity that
+        // is at least the specified 'minimumCapacity' and can hold 'size()'
+        // keys without exceeding the maximum load factor, and rehash all keys.
+        // If the resulting capacity is 0, all memory held by this set is
+        // released.
+
+    void reserve(bsl::size_t numKeys);
+        // Increase the capacity of this set, if needed, so that it can hold
+        // the specified 'numKeys' without exceeding the maximum load factor.
+
+    void reset();
+        // Remove all keys from this set and release all memory, setting the
+        // capacity to 0.
+
+    void swap(FlatHashSet& other);
+        // Exchange the value and functors of this object with those of the
+        // specified 'other' object.  This method provides the no-throw
+        // guarantee.  The behavior is undefined unless this object was created
+        // with the same allocator as 'other'.
+
+    // ACCESSORS
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator to the first key of this set, or 'end()' if this
+        // set is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this set.
+
+    const_iterator cend() const;
+    const_iterator end() const;
+        // Return the past-the-end iterator of this set.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains the specified 'key', and 'false'
+        // otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of keys in this set equal to the specified 'key'
+        // (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this set has no keys, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                         const;
+        // Return a pair of iterators defining the (empty or one-element) range
+        // of keys of this set equal to the specified 'key'.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the key in this set equal to the specified
+        // 'key', or 'end()' if there is no such key.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this set.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this set.
+
+    float load_factor() const;
+        // Return 'size() / capacity()', or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this set, 0.875.
+
+    bsl::size_t size() const;
+        // Return the number of keys in this set.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashSet' objects have the same
+    // value if they have the same number of keys, and each key of 'lhs' is
+    // contained in 'rhs'.  Note that the functors of 'lhs' and 'rhs' are not
+    // compared.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'FlatHashSet' objects do not
+    // have the same value if they do not have the same number of keys, or
+    // some key of 'lhs' is not contained in 'rhs'.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(FlatHashSet<KEY, HASH, EQUAL>& a, FlatHashSet<KEY, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This
+    // function provides the no-throw guarantee if the two objects were created
+    // with the same allocator, and the basic guarantee otherwise.
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct FlatHashSet_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class KEY>
+inline
+void FlatHashSet_EntryUtil<KEY>::constructFromKey(KEY              *entry,
+                                                  bslma::Allocator *allocator,
+                                                  const KEY&        key)
+{
+    bslma::ConstructionUtil::construct(entry, allocator, key);
+}
+
+template <class KEY>
+inline
+const KEY& FlatHashSet_EntryUtil<KEY>::key(const KEY& entry)
+{
+    return entry;
+}
+
+                            // -----------------
+                            // class FlatHashSet
+                            // -----------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                            const FlatHashSet&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::~FlatHashSet()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(const FlatHashSet& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first,
+                                     const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& key)
+{
+    return d_impl.insert(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reserve(bsl::size_t numKeys)
+{
+    d_impl.reserve(numKeys);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::swap(FlatHashSet& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator,
+          typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator>
+FlatHashSet<KEY, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    return d_impl.equal_range(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+EQUAL FlatHashSet<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                                  // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashSet<KEY, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashSet<KEY, HASH, EQUAL>& a,
+                FlatHashSet<KEY, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashSet<KEY, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashSet<KEY, HASH, EQUAL> futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// TRAITS
+
+namespace bslma {
+
+template <class KEY, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlc::FlatHashSet<KEY, HASH, EQUAL> >
+                                                           : bsl::true_type {};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,682 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslh_hash.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a value-semantic container that forwards
+// nearly all of its operations to 'bdlc::FlatHashTable', which is tested
+// thoroughly in its own test driver.  This test driver therefore concentrates
+// on the forwarding: that each constructor passes its arguments through [2],
+// that the manipulators and accessors agree with 'bsl::set' [3], and that
+// copying, assignment, 'swap', and equality behave as for a value-semantic
+// type [4].
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashSet();
+// [ 2] FlatHashSet(Allocator *basicAllocator);
+// [ 2] FlatHashSet(size_t capacity, Allocator *basicAllocator = 0);
+// [ 2] FlatHashSet(size_t capacity, const HASH&, Allocator * = 0);
+// [ 2] FlatHashSet(size_t capacity, const HASH&, const EQUAL&, Alloc * = 0);
+// [ 2] FlatHashSet(INPUT_ITERATOR first, INPUT_ITERATOR last, Alloc * = 0);
+// [ 2] FlatHashSet(first, last, capacity, hash, equal, Allocator * = 0);
+// [ 4] FlatHashSet(const FlatHashSet& original, Allocator *ba = 0);
+// [ 2] ~FlatHashSet();
+//
+// MANIPULATORS
+// [ 4] FlatHashSet& operator=(const FlatHashSet& rhs);
+// [ 3] void clear();
+// [ 3] size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] pair<iterator, bool> insert(const KEY& key);
+// [ 3] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void rehash(size_t minimumCapacity);
+// [ 3] void reserve(size_t numKeys);
+// [ 3] void reset();
+// [ 4] void swap(FlatHashSet& other);
+//
+// ACCESSORS
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 3] const_iterator cend() const;
+// [ 3] const_iterator end() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(KEY) const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 3] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+// [ 4] bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+// [ 4] void swap(FlatHashSet& a, FlatHashSet& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64                                Int64;
+typedef bdlc::FlatHashSet<int>                            Obj;
+typedef bdlc::FlatHashSet<bsl::string, bslh::Hash<> >     StringObj;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct TaggedHash {
+    // This hash functor hashes 'int' values with 'bsl::hash<int>', and carries
+    // a tag to verify that it is copied.
+
+    int d_tag;
+
+    explicit TaggedHash(int tag = 0)
+    : d_tag(tag)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return bsl::hash<int>()(key);
+    }
+};
+
+struct TaggedEqual {
+    // This functor compares 'int' values, and carries a tag to verify that it
+    // is copied.
+
+    int d_tag;
+
+    explicit TaggedEqual(int tag = 0)
+    : d_tag(tag)
+    {
+    }
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs == rhs;
+    }
+};
+
+typedef bdlc::FlatHashSet<int, TaggedHash, TaggedEqual> TaggedObj;
+
+unsigned int nextRandom(unsigned int *state)
+    // Return the next value of the linear congruential generator whose state
+    // is at the specified 'state' address.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xffffff;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+///- - - - - - - - - - - - - - -
+// Suppose we receive a stream of order identifiers, some of which are
+// repeated, and we want to process each identifier only once.
+//
+// First, we create a set to track the identifiers already seen, reserving
+// room for the number we expect:
+//..
+    bdlc::FlatHashSet<int> seen;
+    seen.reserve(8);
+
+    const int IDS[]   = { 17, 4, 17, 99, 4, 23, 17 };
+    const int NUM_IDS = static_cast<int>(sizeof IDS / sizeof *IDS);
+//..
+// Then, we process each identifier whose insertion succeeds:
+//..
+    int numProcessed = 0;
+    for (int i = 0; i < NUM_IDS; ++i) {
+        if (seen.insert(IDS[i]).second) {
+            ++numProcessed;
+        }
+    }
+//..
+// Finally, we verify that each distinct identifier was processed once:
+//..
+    ASSERT(4 == numProcessed);
+    ASSERT(4 == seen.size());
+    ASSERT(seen.contains(99));
+    ASSERT(!seen.contains(5));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the value of the original and uses the supplied
+        //:   allocator, or the default allocator if none is supplied.
+        //:
+        //: 2 Assignment gives the target the value of the source, returns a
+        //:   reference to the target, and keeps the target's allocator.
+        //:
+        //: 3 Sets compare equal if and only if they contain the same keys.
+        //:
+        //: 4 The 'swap' method and free function exchange values, and the free
+        //:   function supports different allocators.
+        //
+        // Plan:
+        //: 1 Copy, assign, swap, and compare sets built with different
+        //:   allocators, verifying values and allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet& original, Allocator *ba = 0);
+        //   FlatHashSet& operator=(const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& other);
+        //   bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& a, FlatHashSet& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        bslma::TestAllocator tb("other",  veryVeryVeryVerbose);
+
+        StringObj mX(&ta);  const StringObj& X = mX;
+        for (int i = 0; i < 100; ++i) {
+            char buffer[64];
+            bsl::sprintf(buffer, "a key long enough to allocate memory %d", i);
+            mX.insert(bsl::string(buffer));
+        }
+
+        {
+            StringObj mY(X, &tb);  const StringObj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+            ASSERT(&tb == Y.allocator());
+            ASSERT(&tb == Y.begin()->get_allocator().mechanism());
+
+            const bsl::string KEY = *Y.begin();
+            mY.erase(KEY);
+            ASSERT(X != Y);
+            mY.insert("another key");
+            ASSERT(X != Y);
+            mY.erase("another key");
+            mY.insert(KEY);
+            ASSERT(X == Y);
+        }
+        {
+            StringObj mY(X);  const StringObj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(&defaultAllocator == Y.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            StringObj mY(&tb);  const StringObj& Y = mY;
+            mY.insert("to be replaced");
+
+            StringObj *mR = &(mY = X);
+            ASSERT(&mY == mR);
+            ASSERT(X == Y);
+            ASSERT(&tb == Y.allocator());
+
+            mR = &(mY = Y);
+            ASSERT(&mY == mR);
+            ASSERT(X == Y);
+        }
+
+        {
+            StringObj mY(&ta);
+            mY.insert("seven");
+            const StringObj XX(X, &ta);
+            const StringObj YY(mY, &ta);
+
+            const Int64 blocks = ta.numBlocksTotal();
+            mX.swap(mY);
+            ASSERT(blocks == ta.numBlocksTotal());
+            ASSERT(YY == X);
+            ASSERT(XX == mY);
+
+            swap(mX, mY);
+            ASSERT(blocks == ta.numBlocksTotal());
+            ASSERT(XX == X);
+            ASSERT(YY == mY);
+
+            StringObj mZ(&tb);
+            swap(mX, mZ);
+            ASSERT(X.empty());
+            ASSERT(XX == mZ);
+            ASSERT(&ta == X.allocator());
+            ASSERT(&tb == mZ.allocator());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each manipulator and accessor forwards correctly, so that the set
+        //:   behaves as 'bsl::set' for the same operations (apart from
+        //:   iteration order).
+        //:
+        //: 2 The capacity manipulators preserve the keys.
+        //
+        // Plan:
+        //: 1 Apply random operations to a set and to a 'bsl::set' oracle,
+        //:   verifying after each batch that they hold the same keys.  (C-1)
+        //:
+        //: 2 Exercise the remaining manipulators, verifying the results.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   pair<iterator, bool> insert(const KEY& key);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numKeys);
+        //   void reset();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(KEY) const;
+        //   const_iterator find(const KEY& key) const;
+        //   float load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS AND ACCESSORS" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tRandom operations." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            bsl::set<int> oracle;
+
+            unsigned int state = 54321;
+            for (int i = 0; i < 50000; ++i) {
+                const unsigned int op  = nextRandom(&state) % 8;
+                const int          key = static_cast<int>(
+                                                  nextRandom(&state) % 5000);
+
+                if (op < 4) {
+                    const bsl::pair<Obj::iterator, bool> rc = mX.insert(key);
+                    ASSERTV(i, rc.second == oracle.insert(key).second);
+                    ASSERTV(i, key == *rc.first);
+                }
+                else if (op < 6) {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                }
+                else if (op < 7) {
+                    Obj::const_iterator it = X.find(key);
+                    ASSERTV(i, (it == X.end()) == (0 == oracle.count(key)));
+                    if (it != X.end()) {
+                        mX.erase(it);
+                        oracle.erase(key);
+                    }
+                }
+                else {
+                    ASSERTV(i, oracle.count(key) == X.count(key));
+                    ASSERTV(i, !!oracle.count(key) == X.contains(key));
+                    const bsl::pair<Obj::const_iterator,
+                                    Obj::const_iterator> range =
+                                                            X.equal_range(key);
+                    ASSERTV(i, oracle.count(key) ==
+                               static_cast<bsl::size_t>(
+                                    bsl::distance(range.first, range.second)));
+                }
+
+                if (0 == i % 1000) {
+                    ASSERTV(i, oracle.size() == X.size());
+                    bsl::size_t numVisited = 0;
+                    for (Obj::const_iterator it = X.cbegin();
+                         it != X.cend();
+                         ++it, ++numVisited) {
+                        ASSERTV(i, oracle.count(*it));
+                    }
+                    ASSERTV(i, oracle.size() == numVisited);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tRemaining manipulators." << endl;
+        {
+            bsl::vector<int> data;
+            for (int i = 0; i < 200; ++i) {
+                data.push_back(i % 150);
+            }
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.insert(data.begin(), data.end());
+            ASSERT(150 == X.size());
+            ASSERT(0.0f < X.load_factor());
+
+            mX.reserve(5000);
+            ASSERT(5000 <= X.capacity() * 7 / 8);
+            ASSERT(150 == X.size());
+            for (int i = 0; i < 150; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+
+            mX.rehash(0);
+            ASSERT(256 == X.capacity());
+            ASSERT(150 == X.size());
+
+            const int FIRST = *X.begin();
+            mX.erase(X.begin());
+            ASSERT(!X.contains(FIRST));
+            ASSERT(149 == X.size());
+
+            Obj::iterator last = mX.erase(X.begin(), X.end());
+            ASSERT(last == X.end());
+            ASSERT(X.empty());
+            ASSERT(256 == X.capacity());
+
+            mX.insert(1);
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 < X.capacity());
+
+            mX.reset();
+            ASSERT(0 == X.capacity());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a set having the requested capacity,
+        //:   functors, and allocator, and no memory is allocated for a
+        //:   capacity of 0.
+        //:
+        //: 2 The range constructors insert each key, ignoring duplicates.
+        //:
+        //: 3 The allocator is the default allocator if none is supplied.
+        //:
+        //: 4 The 'UsesBslmaAllocator' trait is declared.
+        //
+        // Plan:
+        //: 1 Create sets with each constructor and verify the basic accessors
+        //:   and allocation counts.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   FlatHashSet(Allocator *basicAllocator);
+        //   FlatHashSet(size_t capacity, Allocator *basicAllocator = 0);
+        //   FlatHashSet(size_t capacity, const HASH&, Allocator * = 0);
+        //   FlatHashSet(size_t, const HASH&, const EQUAL&, Alloc * = 0);
+        //   FlatHashSet(INPUT_ITERATOR first, INPUT_ITERATOR last, Alloc *);
+        //   FlatHashSet(first, last, capacity, hash, equal, Allocator * = 0);
+        //   ~FlatHashSet();
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+        ASSERT(bslma::UsesBslmaAllocator<StringObj>::value);
+
+        {
+            const TaggedObj X;
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(0 == X.hash_function().d_tag);
+            ASSERT(0 == X.key_eq().d_tag);
+        }
+        {
+            const TaggedObj X(&ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+        }
+        {
+            const TaggedObj X(100, &ta);
+            ASSERT(128 == X.capacity());
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+        {
+            const TaggedObj X(1, TaggedHash(3), &ta);
+            ASSERT(16 == X.capacity());
+            ASSERT(3 == X.hash_function().d_tag);
+            ASSERT(0 == X.key_eq().d_tag);
+        }
+        {
+            const TaggedObj X(0, TaggedHash(3), TaggedEqual(4), &ta);
+            ASSERT(0 == X.capacity());
+            ASSERT(3 == X.hash_function().d_tag);
+            ASSERT(4 == X.key_eq().d_tag);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        const int DATA[] = { 5, 3, 5, 9, 3, 1 };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+        {
+            const TaggedObj X(DATA, DATA + NUM_DATA, &ta);
+            ASSERT(&ta == X.allocator());
+            ASSERT(4 == X.size());
+            ASSERT(X.contains(1));
+            ASSERT(X.contains(9));
+        }
+        {
+            const TaggedObj X(DATA,
+                              DATA + NUM_DATA,
+                              1000,
+                              TaggedHash(5),
+                              TaggedEqual(6),
+                              &ta);
+            ASSERT(4 == X.size());
+            ASSERT(1024 == X.capacity());
+            ASSERT(5 == X.hash_function().d_tag);
+            ASSERT(6 == X.key_eq().d_tag);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few keys.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        StringObj mX(&ta);  const StringObj& X = mX;
+        ASSERT(X.empty());
+
+        ASSERT(mX.insert("one").second);
+        ASSERT(mX.insert("two").second);
+        ASSERT(!mX.insert("one").second);
+        ASSERT(2 == X.size());
+        ASSERT(X.contains("one"));
+        ASSERT("two" == *X.find("two"));
+        ASSERT(X.end() == X.find("three"));
+
+        ASSERT(1 == mX.erase("two"));
+        ASSERT(!X.contains("two"));
+        ASSERT(1 == X.size());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
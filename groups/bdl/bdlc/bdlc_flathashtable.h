@@ -0,0 +1,1439 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table like Abseil 'flat_hash_map'.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table with group probing
+//  bdlc::FlatHashTable_GroupControl: operations on a group of control bytes
+//  bdlc::FlatHashTable_IteratorImp: iterator implementation for the table
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset, bslstl_hashtable
+//
+//@DESCRIPTION: This component provides a value-semantic, open-addressed hash
+// table, 'bdlc::FlatHashTable', that stores its entries in a single contiguous
+// array of slots rather than in individually allocated nodes.  It is the
+// implementation underlying 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet', and
+// is not intended to be used directly by clients.
+//
+// The table is parameterized by the 'KEY' type, the 'ENTRY' type stored in
+// each slot, an 'ENTRY_UTIL' policy that extracts the key from an entry and
+// constructs an entry from a key, and the 'HASH' and 'EQUAL' functors applied
+// to keys.  An 'ENTRY_UTIL' type must provide the following class methods:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return the key of the specified 'entry'.
+//
+//  static void constructFromKey(ENTRY            *entry,
+//                               bslma::Allocator *allocator,
+//                               const KEY&        key);
+//      // Construct at the specified 'entry' address an entry having the
+//      // specified 'key' (and a default value, if any), using the specified
+//      // 'allocator' to supply memory.
+//..
+//
+///Layout and Probing
+///------------------
+// The table has a capacity that is either 0 or a power of two no less than
+// 'k_MIN_CAPACITY'.  Each slot has an associated *control* byte, and the
+// control bytes are organized in groups of 16 consecutive bytes.  A control
+// byte is 'k_EMPTY' if its slot has not held an entry since the last rehash,
+// 'k_ERASED' if its slot held an entry that has been erased, and otherwise
+// holds 7 bits of the hash value of the key of the entry in its slot.
+//
+// The hash value of a key is mixed by multiplication with a 64-bit constant
+// (Fibonacci hashing), so that hash functors whose low or high bits are of
+// poor quality, such as the identity hash 'bsl::hash<int>', still distribute
+// keys evenly.  The top 7 bits of the mixed value are the control byte of the
+// key, and the bits below them select the group at which probing starts.
+//
+// A lookup compares the control byte of the key with all 16 control bytes of
+// a group at once, using SSE2 instructions where available, and compares keys
+// only for the slots whose control bytes match.  If the key is not found in
+// the group and the group contains an empty slot, the lookup terminates;
+// otherwise it continues with the next group in a triangular (quadratic)
+// probe sequence that visits every group.  Consequently, most lookups touch
+// one cache line of control bytes and one entry.
+//
+// The table is rehashed to double its capacity when an insertion would make
+// the number of occupied and erased slots exceed 7/8 of the capacity (the
+// maximum load factor), or rehashed at the same capacity, purging erased
+// slots, if most of those slots are erased.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any manipulator that might rehash the table (e.g., 'insert', 'rehash',
+// 'reserve') invalidates all iterators, pointers, and references to entries
+// of the table.  'erase' invalidates only iterators, pointers, and references
+// to the erased entries.
+//
+///Exception Safety
+///----------------
+// If an exception is thrown by a constructor of 'ENTRY', by a functor, or by
+// the allocator, the table is left in a valid but unspecified state (i.e., the
+// basic guarantee is provided).  Insertion of a single entry into a table that
+// does not need to be rehashed provides the strong guarantee.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc_flathashmap' and
+// 'bdlc_flathashset'; see those components for usage examples.  The following
+// shows the minimal 'ENTRY_UTIL' policy needed to use the table as a set of
+// 'int' values:
+//..
+//  struct IntEntryUtil {
+//      static const int& key(const int& entry)
+//      {
+//          return entry;
+//      }
+//
+//      static void constructFromKey(int              *entry,
+//                                   bslma::Allocator *,
+//                                   const int&        key)
+//      {
+//          *entry = key;
+//      }
+//  };
+//
+//  typedef bdlc::FlatHashTable<int,
+//                              int,
+//                              IntEntryUtil,
+//                              bsl::hash<int>,
+//                              bsl::equal_to<int> > IntTable;
+//
+//  IntTable table(0, bsl::hash<int>(), bsl::equal_to<int>());
+//
+//  for (int i = 0; i < 100; ++i) {
+//      table.insert(i * i);
+//  }
+//
+//  assert(100 == table.size());
+//  assert(table.contains(81));
+//  assert(!table.contains(82));
+//  assert(1 == table.erase(81));
+//  assert(!table.contains(81));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslstl_forwarditerator.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_utility.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define BDLC_FLATHASHTABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                      // ================================
+                      // class FlatHashTable_GroupControl
+                      // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides queries over a group of 'k_SIZE' consecutive control
+    // bytes of a 'FlatHashTable', each answered for all bytes of the group at
+    // once as a bit mask in which bit 'i' corresponds to byte 'i'.  SSE2
+    // instructions are used where available.
+
+  public:
+    // TYPES
+    typedef bsl::uint32_t BitMask;
+
+    enum {
+        k_SIZE = 16  // number of control bytes in a group
+    };
+
+    static const bsl::uint8_t k_EMPTY  = 0x80;
+        // control byte of a slot that has not held an entry since the table
+        // was last rehashed
+
+    static const bsl::uint8_t k_ERASED = 0xfe;
+        // control byte of a slot whose entry has been erased
+
+  private:
+    // DATA
+#if defined(BDLC_FLATHASHTABLE_SSE2)
+    __m128i             d_value;    // the control bytes
+#else
+    const bsl::uint8_t *d_bytes_p;  // the control bytes (held, not owned)
+#endif
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const bsl::uint8_t *controlBytes);
+        // Create an object for querying the 'k_SIZE' control bytes starting at
+        // the specified 'controlBytes'.  The behavior is undefined unless
+        // 'controlBytes' refers to at least 'k_SIZE' bytes, which remain
+        // unchanged during the lifetime of this object.
+
+    // ACCESSORS
+    BitMask available() const;
+        // Return a bit mask of the bytes in this group that are 'k_EMPTY' or
+        // 'k_ERASED'.
+
+    bool containsEmpty() const;
+        // Return 'true' if any byte in this group is 'k_EMPTY', and 'false'
+        // otherwise.
+
+    BitMask inUse() const;
+        // Return a bit mask of the bytes in this group that are neither
+        // 'k_EMPTY' nor 'k_ERASED'.
+
+    BitMask match(bsl::uint8_t value) const;
+        // Return a bit mask of the bytes in this group that are equal to the
+        // specified 'value'.
+};
+
+                      // ===============================
+                      // class FlatHashTable_IteratorImp
+                      // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class provides the minimal iterator interface required by
+    // 'bslstl::ForwardIterator' for iterating over the occupied slots of a
+    // 'FlatHashTable' in slot order.
+
+    // DATA
+    ENTRY              *d_entries_p;   // slots of the table
+    const bsl::uint8_t *d_controls_p;  // control bytes of the table
+    bsl::size_t         d_index;       // index of the current slot
+    bsl::size_t         d_capacity;    // number of slots in the table
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend bool operator==(const FlatHashTable_IteratorImp<OTHER_ENTRY>&,
+                           const FlatHashTable_IteratorImp<OTHER_ENTRY>&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create an iterator that does not refer to any table.
+
+    FlatHashTable_IteratorImp(ENTRY              *entries,
+                              const bsl::uint8_t *controls,
+                              bsl::size_t         index,
+                              bsl::size_t         capacity);
+        // Create an iterator referring to the slot at the specified 'index' of
+        // the table having the specified 'entries', 'controls', and
+        // 'capacity'.  If 'index' does not refer to an occupied slot, advance
+        // to the next occupied slot, or to the past-the-end position if there
+        // is none.  The behavior is undefined unless 'index <= capacity'.
+
+    // MANIPULATORS
+    void operator++();
+        // Advance this iterator to the next occupied slot, or to the
+        // past-the-end position if there is none.  The behavior is undefined
+        // unless this iterator refers to an occupied slot.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry in the slot this iterator refers
+        // to.  The behavior is undefined unless this iterator refers to an
+        // occupied slot.
+
+    bsl::size_t index() const;
+        // Return the index of the slot this iterator refers to.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' refer to the same slot of
+    // the same table, and 'false' otherwise.
+
+                            // ===================
+                            // class FlatHashTable
+                            // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This value-semantic class implements an open-addressed hash table of
+    // unique keys whose entries are stored in a contiguous array of slots, as
+    // described in the component documentation.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl GroupControl;
+    typedef GroupControl::BitMask      BitMask;
+    typedef bsls::Types::Uint64        Uint64;
+
+    // DATA
+    ENTRY            *d_entries_p;    // array of 'd_capacity' slots, followed
+                                      // in the same allocation by the control
+                                      // bytes
+
+    bsl::uint8_t     *d_controls_p;   // array of 'd_capacity' control bytes
+
+    bsl::size_t       d_size;         // number of entries
+
+    bsl::size_t       d_numErased;    // number of 'k_ERASED' control bytes
+
+    bsl::size_t       d_capacity;     // number of slots
+
+    int               d_groupShift;   // shift applied to the mixed hash value
+                                      // to obtain the first group to probe
+
+    HASH              d_hasher;       // hash functor
+
+    EQUAL             d_equal;        // key-equality functor
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t maxLoad(bsl::size_t capacity);
+        // Return the maximum number of occupied and erased slots in a table
+        // having the specified 'capacity'.
+
+    // PRIVATE MANIPULATORS
+    void adopt(bsl::size_t capacity);
+        // Allocate 'capacity' slots and their control bytes, mark all slots
+        // empty, and make them the storage of this table, which must have no
+        // storage.  The behavior is undefined unless 'capacity' is a power of
+        // two no less than 'k_MIN_CAPACITY'.
+
+    void destroyEntries();
+        // Destroy all entries of this table and mark all slots empty, without
+        // releasing storage.
+
+    void eraseSlot(bsl::size_t index);
+        // Destroy the entry at the occupied slot having the specified 'index'
+        // and mark the slot erased or, if doing so cannot break a probe
+        // sequence, empty.
+
+    void commitInsert(bsl::size_t index, Uint64 hashValue);
+        // Mark the available slot having the specified 'index', in which an
+        // entry whose key has the specified mixed 'hashValue' has just been
+        // constructed, as occupied.
+
+    bsl::size_t prepareInsert(Uint64 hashValue);
+        // Return the index of an available slot for an entry whose key has
+        // the specified mixed 'hashValue', rehashing this table first if
+        // needed.  The caller must construct the entry in the returned slot
+        // and then call 'commitInsert'.
+
+    void releaseStorage();
+        // Return the storage of this table, which must hold no entries, to
+        // the allocator and set the capacity to 0.
+
+    void rehashImp(bsl::size_t newCapacity);
+        // Move all entries of this table into newly allocated storage having
+        // the specified 'newCapacity' slots.  The behavior is undefined unless
+        // 'newCapacity' is 0 or a power of two no less than 'k_MIN_CAPACITY',
+        // and 'size() <= maxLoad(newCapacity)'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findAvailable(Uint64 hashValue) const;
+        // Return the index of the first available slot in the probe sequence
+        // for the specified mixed 'hashValue'.  The behavior is undefined
+        // unless this table has an available slot.
+
+    bsl::size_t findKey(const KEY& key, Uint64 hashValue) const;
+        // Return the index of the slot holding the entry having the specified
+        // 'key', whose mixed hash value is the specified 'hashValue', or
+        // 'd_capacity' if there is no such entry.
+
+    Uint64 hashKey(const KEY& key) const;
+        // Return the mixed hash value of the specified 'key'.
+
+  public:
+    // TYPES
+    typedef FlatHashTable_IteratorImp<ENTRY>                   IteratorImp;
+    typedef bslstl::ForwardIterator<ENTRY, IteratorImp>        iterator;
+    typedef bslstl::ForwardIterator<const ENTRY, IteratorImp>  const_iterator;
+
+    enum {
+        k_MIN_CAPACITY = GroupControl::k_SIZE  // smallest non-zero capacity
+    };
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table having at least the specified 'capacity', and
+        // using the specified 'hash' and 'equal' functors.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  No memory is
+        // allocated if 'capacity' is 0.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, functors, and capacity as the
+        // specified 'original'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~FlatHashTable();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this object the value and functors of the specified 'rhs'
+        // object, and return a reference providing modifiable access to this
+        // object.
+
+    ENTRY& operator[](const KEY& key);
+        // Return a reference to the entry having the specified 'key', first
+        // inserting an entry constructed by 'ENTRY_UTIL::constructFromKey' if
+        // there is no such entry.
+
+    iterator begin();
+        // Return an iterator to the first entry of this table, or 'end()' if
+        // this table is empty.
+
+    void clear();
+        // Remove all entries from this table, retaining its capacity.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the (empty or one-element) range
+        // of entries of this table having the specified 'key'.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the entry having the specified 'key' from this table, if
+        // any, and return the number of entries removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove the entry at the specified 'position' from this table, and
+        // return an iterator to the entry following it, or 'end()'.  The
+        // behavior is undefined unless 'position' refers to an entry of this
+        // table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove the entries in the range '[first, last)' from this table, and
+        // return 'last'.  The behavior is undefined unless '[first, last)' is
+        // a valid range of entries of this table.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+    iterator find(const KEY& key);
+        // Return an iterator to the entry having the specified 'key', or
+        // 'end()' if there is no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        // Insert a copy of the specified 'entry' into this table if no entry
+        // having the same key exists.  Return a pair whose 'first' member
+        // refers to the entry having the key of 'entry', and whose 'second'
+        // member is 'true' if the entry was inserted and 'false' otherwise.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to the smallest valid capacity
+        // that is at least the specified 'minimumCapacity' and can hold
+        // 'size()' entries without exceeding the maximum load factor, and
+        // rehash all entries.  If the resulting capacity is 0, all memory
+        // held by this table is released.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase the capacity of this table, if needed, so that it can hold
+        // the specified 'numEntries' without exceeding the maximum load
+        // factor.
+
+    void reset();
+        // Remove all entries from this table and release all memory, setting
+        // the capacity to 0.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value and functors of this object with those of the
+        // specified 'other' object.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+
+    const_iterator begin() const;
+        // Return an iterator to the first entry of this table, or 'end()' if
+        // this table is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table holds an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this table holds no entries, and 'false' otherwise.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this table.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                         const;
+        // Return a pair of iterators defining the (empty or one-element) range
+        // of entries of this table having the specified 'key'.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator to the entry having the specified 'key', or
+        // 'end()' if there is no such entry.
+
+    const HASH& hash_function() const;
+        // Return the hash functor of this table.
+
+    const EQUAL& key_eq() const;
+        // Return the key-equality functor of this table.
+
+    float load_factor() const;
+        // Return 'size() / capacity()', or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this table, 0.875.
+
+    bsl::size_t size() const;
+        // Return the number of entries of this table.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' hold the same number of
+    // entries, and for each entry of 'lhs' there is an entry of 'rhs' having
+    // the same key that compares equal to it using 'ENTRY::operator==', and
+    // 'false' otherwise.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' do not have the same
+    // value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This
+    // function provides the no-throw guarantee if the two objects were created
+    // with the same allocator, and the basic guarantee otherwise.
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class FlatHashTable_GroupControl
+                      // --------------------------------
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                              const bsl::uint8_t *controlBytes)
+#if defined(BDLC_FLATHASHTABLE_SSE2)
+: d_value(_mm_loadu_si128(reinterpret_cast<const __m128i *>(controlBytes)))
+#else
+: d_bytes_p(controlBytes)
+#endif
+{
+}
+
+// ACCESSORS
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::available() const
+{
+#if defined(BDLC_FLATHASHTABLE_SSE2)
+    return static_cast<BitMask>(_mm_movemask_epi8(d_value));
+#else
+    BitMask result = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        result |= static_cast<BitMask>(d_bytes_p[i] >> 7) << i;
+    }
+    return result;
+#endif
+}
+
+inline
+bool FlatHashTable_GroupControl::containsEmpty() const
+{
+    return 0 != match(k_EMPTY);
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & ((1u << k_SIZE) - 1);
+}
+
+inline
+FlatHashTable_GroupControl::BitMask
+FlatHashTable_GroupControl::match(bsl::uint8_t value) const
+{
+#if defined(BDLC_FLATHASHTABLE_SSE2)
+    const __m128i values = _mm_set1_epi8(static_cast<char>(value));
+    return static_cast<BitMask>(
+                      _mm_movemask_epi8(_mm_cmpeq_epi8(values, d_value)));
+#else
+    BitMask result = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        result |= static_cast<BitMask>(d_bytes_p[i] == value) << i;
+    }
+    return result;
+#endif
+}
+
+                      // -------------------------------
+                      // class FlatHashTable_IteratorImp
+                      // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entries_p(0)
+, d_controls_p(0)
+, d_index(0)
+, d_capacity(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                                ENTRY              *entries,
+                                                const bsl::uint8_t *controls,
+                                                bsl::size_t         index,
+                                                bsl::size_t         capacity)
+: d_entries_p(entries)
+, d_controls_p(controls)
+, d_index(index)
+, d_capacity(capacity)
+{
+    BSLS_ASSERT_SAFE(index <= capacity);
+
+    while (d_index < d_capacity
+        && (d_controls_p[d_index] & FlatHashTable_GroupControl::k_EMPTY)) {
+        ++d_index;
+    }
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_index < d_capacity);
+
+    do {
+        ++d_index;
+    } while (d_index < d_capacity
+          && (d_controls_p[d_index] & FlatHashTable_GroupControl::k_EMPTY));
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_index < d_capacity);
+
+    return d_entries_p[d_index];
+}
+
+template <class ENTRY>
+inline
+bsl::size_t FlatHashTable_IteratorImp<ENTRY>::index() const
+{
+    return d_index;
+}
+
+                            // -------------------
+                            // class FlatHashTable
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxLoad(
+                                                         bsl::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::adopt(
+                                                         bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(0 == d_entries_p);
+    BSLS_ASSERT_SAFE(k_MIN_CAPACITY <= capacity);
+    BSLS_ASSERT_SAFE(0 == (capacity & (capacity - 1)));
+
+    void *storage = d_allocator_p->allocate(capacity * sizeof(ENTRY)
+                                          + capacity);
+
+    d_entries_p  = static_cast<ENTRY *>(storage);
+    d_controls_p = reinterpret_cast<bsl::uint8_t *>(d_entries_p + capacity);
+    d_capacity   = capacity;
+    d_numErased  = 0;
+    bsl::memset(d_controls_p, GroupControl::k_EMPTY, capacity);
+
+    // Probing starts at the group selected by the 'log2(numGroups)' bits of
+    // the mixed hash value just below its top 7 bits, which form the control
+    // byte.
+
+    d_groupShift = 57 - bdlb::BitUtil::log2(
+                    static_cast<bdlb::BitUtil::uint64_t>(capacity
+                                                     / GroupControl::k_SIZE));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::commitInsert(
+                                                        bsl::size_t index,
+                                                        Uint64      hashValue)
+{
+    BSLS_ASSERT_SAFE(d_controls_p[index] & GroupControl::k_EMPTY);
+
+    if (GroupControl::k_ERASED == d_controls_p[index]) {
+        --d_numErased;
+    }
+    d_controls_p[index] = static_cast<bsl::uint8_t>(hashValue >> 57);
+    ++d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::destroyEntries()
+{
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        if (!(d_controls_p[i] & GroupControl::k_EMPTY)) {
+            bslma::DestructionUtil::destroy(d_entries_p + i);
+        }
+    }
+    if (d_capacity) {
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    }
+    d_size      = 0;
+    d_numErased = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::eraseSlot(
+                                                            bsl::size_t index)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(!(d_controls_p[index] & GroupControl::k_EMPTY));
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    // A probe sequence continues past a group only if the group has no empty
+    // slot.  If the group of 'index' already has one, no probe sequence
+    // continues past it, so the slot can be marked empty.
+
+    const bsl::size_t groupStart = index & ~static_cast<bsl::size_t>(
+                                                    GroupControl::k_SIZE - 1);
+    if (GroupControl(d_controls_p + groupStart).containsEmpty()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+        ++d_numErased;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::prepareInsert(
+                                                             Uint64 hashValue)
+{
+    bsl::size_t index = d_capacity ? findAvailable(hashValue) : 0;
+
+    if (0 == d_capacity
+     || (GroupControl::k_EMPTY == d_controls_p[index]
+      && d_size + d_numErased + 1 > maxLoad(d_capacity))) {
+        // Grow unless most of the used slots are erased, in which case
+        // rehashing at the same capacity reclaims them.
+
+        bsl::size_t newCapacity = d_capacity
+                               ? d_capacity
+                               : static_cast<bsl::size_t>(k_MIN_CAPACITY);
+        if (d_size + 1 > maxLoad(newCapacity) / 2) {
+            newCapacity *= 2;
+        }
+        rehashImp(newCapacity);
+        index = findAvailable(hashValue);
+    }
+
+    return index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::releaseStorage()
+{
+    BSLS_ASSERT_SAFE(0 == d_size);
+
+    if (d_entries_p) {
+        d_allocator_p->deallocate(d_entries_p);
+    }
+    d_entries_p  = 0;
+    d_controls_p = 0;
+    d_capacity   = 0;
+    d_numErased  = 0;
+    d_groupShift = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashImp(
+                                                      bsl::size_t newCapacity)
+{
+    BSLS_ASSERT_SAFE(d_size <= maxLoad(newCapacity));
+
+    FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+    if (newCapacity) {
+        other.adopt(newCapacity);
+    }
+
+    // Move the entries one at a time, marking each moved-from slot erased so
+    // that this table remains valid if a move constructor throws.
+
+    for (bsl::size_t i = 0; i < d_capacity; ++i) {
+        if (d_controls_p[i] & GroupControl::k_EMPTY) {
+            continue;                                               // CONTINUE
+        }
+
+        const Uint64      hashValue = hashKey(ENTRY_UTIL::key(d_entries_p[i]));
+        const bsl::size_t index     = other.findAvailable(hashValue);
+
+        bslma::ConstructionUtil::destructiveMove(other.d_entries_p + index,
+                                                 d_allocator_p,
+                                                 d_entries_p + i);
+        other.d_controls_p[index] = static_cast<bsl::uint8_t>(hashValue >> 57);
+        ++other.d_size;
+
+        d_controls_p[i] = GroupControl::k_ERASED;
+        --d_size;
+        ++d_numErased;
+    }
+
+    releaseStorage();
+    swap(other);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                                       Uint64 hashValue) const
+{
+    const bsl::size_t groupMask = d_capacity / GroupControl::k_SIZE - 1;
+    bsl::size_t       group     = static_cast<bsl::size_t>(
+                                        hashValue >> d_groupShift) & groupMask;
+
+    for (bsl::size_t step = 1; ; ++step) {
+        const bsl::size_t  start = group * GroupControl::k_SIZE;
+        const BitMask      mask  =
+                               GroupControl(d_controls_p + start).available();
+        if (mask) {
+            return start + bdlb::BitUtil::numTrailingUnsetBits(mask);
+                                                                      // RETURN
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+                                                  const KEY& key,
+                                                  Uint64     hashValue) const
+{
+    if (0 == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::uint8_t control   = static_cast<bsl::uint8_t>(hashValue >> 57);
+    const bsl::size_t  numGroups = d_capacity / GroupControl::k_SIZE;
+    const bsl::size_t  groupMask = numGroups - 1;
+    bsl::size_t        group     = static_cast<bsl::size_t>(
+                                        hashValue >> d_groupShift) & groupMask;
+
+    for (bsl::size_t step = 1; step <= numGroups; ++step) {
+        const bsl::size_t  start = group * GroupControl::k_SIZE;
+        const GroupControl groupControl(d_controls_p + start);
+
+        for (BitMask mask = groupControl.match(control);
+             mask;
+             mask &= mask - 1) {
+            const bsl::size_t index =
+                      start + bdlb::BitUtil::numTrailingUnsetBits(mask);
+            if (d_equal(ENTRY_UTIL::key(d_entries_p[index]), key)) {
+                return index;                                         // RETURN
+            }
+        }
+
+        if (groupControl.containsEmpty()) {
+            break;
+        }
+        group = (group + step) & groupMask;
+    }
+
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::Uint64
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hashKey(
+                                                          const KEY& key) const
+{
+    // Multiplication by 2^64 divided by the golden ratio spreads the bits of
+    // the hash value toward the top of the product, which is where they are
+    // taken from.
+
+    return static_cast<Uint64>(d_hasher(key)) * 0x9e3779b97f4a7c15ULL;
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                             bsl::size_t       capacity,
+                                             const HASH&       hash,
+                                             const EQUAL&      equal,
+                                             bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        rehash(capacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                         const FlatHashTable&  original,
+                                         bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 == original.d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    // Entries are placed in the same slots as in 'original', which is valid
+    // because the capacity, and hence the probe sequences, are the same.
+
+    adopt(original.d_capacity);
+
+    BSLS_TRY {
+        for (bsl::size_t i = 0; i < d_capacity; ++i) {
+            if (!(original.d_controls_p[i] & GroupControl::k_EMPTY)) {
+                bslma::ConstructionUtil::construct(d_entries_p + i,
+                                                   d_allocator_p,
+                                                   original.d_entries_p[i]);
+                d_controls_p[i] = original.d_controls_p[i];
+                ++d_size;
+            }
+            else if (GroupControl::k_ERASED == original.d_controls_p[i]) {
+                d_controls_p[i] = GroupControl::k_ERASED;
+                ++d_numErased;
+            }
+        }
+    }
+    BSLS_CATCH(...) {
+        // The destructor is not run for a partially constructed object.
+
+        destroyEntries();
+        releaseStorage();
+        BSLS_RETHROW;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    destroyEntries();
+    releaseStorage();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                     const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable copy(rhs, d_allocator_p);
+        swap(copy);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+ENTRY& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator[](
+                                                               const KEY& key)
+{
+    const Uint64      hashValue = hashKey(key);
+    const bsl::size_t found     = findKey(key, hashValue);
+    if (found != d_capacity) {
+        return d_entries_p[found];                                    // RETURN
+    }
+
+    const bsl::size_t index = prepareInsert(hashValue);
+
+    ENTRY_UTIL::constructFromKey(d_entries_p + index, d_allocator_p, key);
+    commitInsert(index, hashValue);
+
+    return d_entries_p[index];
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    return iterator(IteratorImp(d_entries_p, d_controls_p, 0, d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    destroyEntries();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<
+     typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+     typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                                               const KEY& key)
+{
+    iterator first = find(key);
+    iterator last  = first;
+    if (last != end()) {
+        ++last;
+    }
+    return bsl::pair<iterator, iterator>(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                               const KEY& key)
+{
+    const bsl::size_t index = findKey(key, hashKey(key));
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+    eraseSlot(index);
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    const bsl::size_t index = position.imp().index();
+    eraseSlot(index);
+    return iterator(IteratorImp(d_entries_p,
+                                d_controls_p,
+                                index + 1,
+                                d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(const_iterator first,
+                                                          const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(IteratorImp(d_entries_p,
+                                d_controls_p,
+                                last.imp().index(),
+                                d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator(IteratorImp(d_entries_p,
+                                d_controls_p,
+                                d_capacity,
+                                d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    return iterator(IteratorImp(d_entries_p,
+                                d_controls_p,
+                                findKey(key, hashKey(key)),
+                                d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+     typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+           bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    const KEY&        key       = ENTRY_UTIL::key(entry);
+    const Uint64      hashValue = hashKey(key);
+    const bsl::size_t found     = findKey(key, hashValue);
+    if (found != d_capacity) {
+        return bsl::pair<iterator, bool>(
+                iterator(IteratorImp(d_entries_p,
+                                     d_controls_p,
+                                     found,
+                                     d_capacity)),
+                false);                                               // RETURN
+    }
+
+    // 'entry' may refer to an entry of this table only if it has the same key
+    // as an existing entry, which was handled above, so rehashing cannot
+    // invalidate it.
+
+    const bsl::size_t index = prepareInsert(hashValue);
+
+    bslma::ConstructionUtil::construct(d_entries_p + index,
+                                       d_allocator_p,
+                                       entry);
+    commitInsert(index, hashValue);
+
+    return bsl::pair<iterator, bool>(
+                iterator(IteratorImp(d_entries_p,
+                                     d_controls_p,
+                                     index,
+                                     d_capacity)),
+                true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                  bsl::size_t minimumCapacity)
+{
+    bsl::size_t newCapacity = 0;
+    if (minimumCapacity || d_size) {
+        newCapacity = k_MIN_CAPACITY;
+        while (newCapacity < minimumCapacity
+            || maxLoad(newCapacity) < d_size) {
+            newCapacity *= 2;
+        }
+    }
+
+    if (newCapacity != d_capacity || d_numErased) {
+        rehashImp(newCapacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                       bsl::size_t numEntries)
+{
+    if (numEntries + d_numErased <= maxLoad(d_capacity)) {
+        return;                                                       // RETURN
+    }
+
+    bsl::size_t newCapacity = d_capacity
+                            ? d_capacity
+                            : static_cast<bsl::size_t>(k_MIN_CAPACITY);
+    while (maxLoad(newCapacity) < numEntries) {
+        newCapacity *= 2;
+    }
+    rehashImp(newCapacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reset()
+{
+    destroyEntries();
+    releaseStorage();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                         FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_numErased,  &other.d_numErased);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_groupShift, &other.d_groupShift);
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,      &other.d_equal);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_iterator(IteratorImp(d_entries_p,
+                                      d_controls_p,
+                                      0,
+                                      d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                         const KEY& key) const
+{
+    return findKey(key, hashKey(key)) != d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+                                                         const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator(IteratorImp(d_entries_p,
+                                      d_controls_p,
+                                      d_capacity,
+                                      d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<
+     typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                               const_iterator,
+     typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                               const_iterator>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equal_range(
+                                                         const KEY& key) const
+{
+    const_iterator first = find(key);
+    const_iterator last  = first;
+    if (last != end()) {
+        ++last;
+    }
+    return bsl::pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    return const_iterator(IteratorImp(d_entries_p,
+                                      d_controls_p,
+                                      findKey(key, hashKey(key)),
+                                      d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const HASH&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const EQUAL& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity ? static_cast<float>(d_size)
+                                           / static_cast<float>(d_capacity)
+                      : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor() const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool bdlc::operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                      const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_entries_p == rhs.d_entries_p && lhs.d_index == rhs.d_index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                  const_iterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        const ConstIterator found = rhs.find(ENTRY_UTIL::key(*it));
+        if (found == rhs.end() || !(*found == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+             const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureA(b,
+                                                              a.allocator());
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureB(a,
+                                                              b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+// TRAITS
+
+namespace bslma {
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlc::FlatHashTable<KEY,
+                                              ENTRY,
+                                              ENTRY_UTIL,
+                                              HASH,
+                                              EQUAL> > : bsl::true_type {};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1206 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a value-semantic, open-addressed hash table
+// parameterized by an entry policy.  We first verify the group-control
+// queries, which are implemented with SSE2 instructions where available,
+// against a straightforward evaluation of the control bytes [2].  The table
+// itself is tested by applying long random sequences of operations to it and
+// to an oracle ('bsl::set' and 'bsl::map'), with a good hash, a hash whose
+// values all select the same group, and a constant hash that makes every key
+// collide [3].  We then test the capacity manipulators [4], the copy
+// constructor, assignment, 'swap', and the equality operators [5], and
+// exception neutrality and allocator propagation using a test allocator [6].
+// ----------------------------------------------------------------------------
+// CLASS 'bdlc::FlatHashTable_GroupControl'
+// [ 2] FlatHashTable_GroupControl(const uint8_t *controlBytes);
+// [ 2] BitMask available() const;
+// [ 2] bool containsEmpty() const;
+// [ 2] BitMask inUse() const;
+// [ 2] BitMask match(uint8_t value) const;
+//
+// CLASS 'bdlc::FlatHashTable'
+// [ 3] FlatHashTable(size_t capacity, hash, equal, Allocator *ba = 0);
+// [ 5] FlatHashTable(const FlatHashTable& original, Allocator *ba = 0);
+// [ 3] ~FlatHashTable();
+// [ 5] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 3] ENTRY& operator[](const KEY& key);
+// [ 3] iterator begin();
+// [ 3] void clear();
+// [ 3] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 3] size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator end();
+// [ 3] iterator find(const KEY& key);
+// [ 3] pair<iterator, bool> insert(const ENTRY& entry);
+// [ 4] void rehash(size_t minimumCapacity);
+// [ 4] void reserve(size_t numEntries);
+// [ 4] void reset();
+// [ 5] void swap(FlatHashTable& other);
+// [ 6] bslma::Allocator *allocator() const;
+// [ 3] const_iterator begin() const;
+// [ 4] size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 3] bool empty() const;
+// [ 3] const_iterator end() const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(const KEY&) const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 5] const HASH& hash_function() const;
+// [ 5] const EQUAL& key_eq() const;
+// [ 4] float load_factor() const;
+// [ 4] float max_load_factor() const;
+// [ 3] size_t size() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatHashTable& lhs, const FlatHashTable& rhs);
+// [ 5] bool operator!=(const FlatHashTable& lhs, const FlatHashTable& rhs);
+// [ 5] void swap(FlatHashTable& a, FlatHashTable& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 6] EXCEPTION SAFETY
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl GroupControl;
+typedef GroupControl::BitMask            BitMask;
+typedef bsls::Types::Int64               Int64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct IntEntryUtil {
+    // This 'struct' provides an entry policy for a table of 'int' keys.
+
+    static const int& key(const int& entry)
+    {
+        return entry;
+    }
+
+    static void constructFromKey(int *entry, bslma::Allocator *, int key)
+    {
+        *entry = key;
+    }
+};
+
+struct PairEntryUtil {
+    // This 'struct' provides an entry policy for a table mapping 'int' keys
+    // to 'bsl::string' values.
+
+    typedef bsl::pair<const int, bsl::string> Entry;
+
+    static const int& key(const Entry& entry)
+    {
+        return entry.first;
+    }
+
+    static void constructFromKey(Entry            *entry,
+                                 bslma::Allocator *allocator,
+                                 int               key)
+    {
+        bslma::ConstructionUtil::construct(entry,
+                                           allocator,
+                                           key,
+                                           bsl::string(allocator));
+    }
+};
+
+struct StringEntryUtil {
+    // This 'struct' provides an entry policy for a table of 'bsl::string'
+    // keys.
+
+    static const bsl::string& key(const bsl::string& entry)
+    {
+        return entry;
+    }
+
+    static void constructFromKey(bsl::string        *entry,
+                                 bslma::Allocator   *allocator,
+                                 const bsl::string&  key)
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key);
+    }
+};
+
+struct ScaledHash {
+    // This hash functor returns a configurable multiple of its argument, so
+    // that a multiple of 0 makes all keys collide.
+
+    bsl::size_t d_multiplier;
+
+    explicit ScaledHash(bsl::size_t multiplier = 1)
+    : d_multiplier(multiplier)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key) * d_multiplier;
+    }
+};
+
+struct StringHash {
+    // This hash functor returns a simple hash of a string, with an optional
+    // constant result to make all keys collide.
+
+    bool d_constant;
+
+    explicit StringHash(bool constant = false)
+    : d_constant(constant)
+    {
+    }
+
+    bsl::size_t operator()(const bsl::string& key) const
+    {
+        if (d_constant) {
+            return 42;                                                // RETURN
+        }
+        bsl::size_t result = 5381;
+        for (bsl::size_t i = 0; i < key.size(); ++i) {
+            result = result * 33 + static_cast<unsigned char>(key[i]);
+        }
+        return result;
+    }
+};
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IntEntryUtil,
+                            ScaledHash,
+                            bsl::equal_to<int> > IntTable;
+
+typedef bdlc::FlatHashTable<int,
+                            bsl::pair<const int, bsl::string>,
+                            PairEntryUtil,
+                            ScaledHash,
+                            bsl::equal_to<int> > PairTable;
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            StringEntryUtil,
+                            StringHash,
+                            bsl::equal_to<bsl::string> > StringTable;
+
+unsigned int nextRandom(unsigned int *state)
+    // Return the next value of the linear congruential generator whose state
+    // is at the specified 'state' address.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xffffff;
+}
+
+BitMask expectedMatch(const bsl::uint8_t *bytes, bsl::uint8_t value)
+    // Return the mask of the 16 specified 'bytes' equal to the specified
+    // 'value'.
+{
+    BitMask result = 0;
+    for (int i = 0; i < GroupControl::k_SIZE; ++i) {
+        if (bytes[i] == value) {
+            result |= 1u << i;
+        }
+    }
+    return result;
+}
+
+BitMask expectedAvailable(const bsl::uint8_t *bytes)
+    // Return the mask of the 16 specified 'bytes' that are empty or erased.
+{
+    return expectedMatch(bytes, GroupControl::k_EMPTY)
+         | expectedMatch(bytes, GroupControl::k_ERASED);
+}
+
+bool isConsistent(const IntTable& table, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'table' holds exactly the keys of the
+    // specified 'oracle', as observed through both iteration and lookup, and
+    // 'false' otherwise.
+{
+    if (table.size() != oracle.size()
+     || table.empty() != oracle.empty()) {
+        return false;                                                 // RETURN
+    }
+    bsl::size_t numVisited = 0;
+    for (IntTable::const_iterator it = table.begin();
+         it != table.end();
+         ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++numVisited;
+    }
+    if (numVisited != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    for (bsl::set<int>::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        if (!table.contains(*it) || *table.find(*it) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+void testRandomOperations(bsl::size_t multiplier,
+                          int         keyRange,
+                          int         numOperations,
+                          bool        veryVerbose)
+    // Apply the specified 'numOperations' random operations, on keys in
+    // '[0 .. keyRange)', to an 'IntTable' whose hash multiplies keys by the
+    // specified 'multiplier' and to a 'bsl::set' oracle, and verify after
+    // each operation that they agree.  Print progress if the specified
+    // 'veryVerbose' is 'true'.
+{
+    bslma::TestAllocator ta("table", false);
+
+    IntTable      mX(0, ScaledHash(multiplier), bsl::equal_to<int>(), &ta);
+    const IntTable& X = mX;
+    bsl::set<int> oracle;
+
+    unsigned int state = static_cast<unsigned int>(multiplier * 7 + keyRange);
+
+    for (int i = 0; i < numOperations; ++i) {
+        const unsigned int op  = nextRandom(&state) % 16;
+        const int          key = static_cast<int>(nextRandom(&state)
+                                                                  % keyRange);
+
+        if (op < 6) {
+            const bsl::pair<IntTable::iterator, bool> rc = mX.insert(key);
+            const bool inserted = oracle.insert(key).second;
+            ASSERTV(i, key, inserted == rc.second);
+            ASSERTV(i, key, key == *rc.first);
+        }
+        else if (op < 7) {
+            ASSERTV(i, key, key == mX[key]);
+            oracle.insert(key);
+        }
+        else if (op < 11) {
+            ASSERTV(i, key, oracle.erase(key) == mX.erase(key));
+        }
+        else if (op < 12) {
+            IntTable::iterator it = mX.find(key);
+            if (it != mX.end()) {
+                IntTable::iterator next = mX.erase(it);
+                oracle.erase(key);
+                ASSERTV(i, key, next == mX.end() || oracle.count(*next));
+            }
+        }
+        else if (op < 13) {
+            const bsl::pair<IntTable::iterator, IntTable::iterator> range =
+                                                          mX.equal_range(key);
+            const bsl::size_t n = oracle.count(key);
+            ASSERTV(i, key, n == X.count(key));
+            ASSERTV(i, key, n == static_cast<bsl::size_t>(
+                                    bsl::distance(range.first, range.second)));
+        }
+        else if (op < 14 && 0 == nextRandom(&state) % 64) {
+            if (0 == nextRandom(&state) % 2) {
+                mX.clear();
+                ASSERTV(i, 0 == ta.numBlocksInUse() || 0 < X.capacity());
+            }
+            else {
+                mX.erase(X.begin(), X.end());
+            }
+            oracle.clear();
+        }
+        else {
+            ASSERTV(i, key, oracle.count(key) == X.count(key));
+            ASSERTV(i, key, (X.find(key) == X.end()) == !oracle.count(key));
+        }
+
+        if (0 == i % 64 || i == numOperations - 1) {
+            ASSERTV(multiplier, i, isConsistent(X, oracle));
+        }
+        ASSERTV(i, X.size() <= X.capacity() * X.max_load_factor());
+    }
+
+    if (veryVerbose) {
+        P_(multiplier) P_(keyRange) P_(X.size()) P(X.capacity())
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    IntEntryUtil,
+                                    bsl::hash<int>,
+                                    bsl::equal_to<int> > IntTable;
+
+        IntTable table(0, bsl::hash<int>(), bsl::equal_to<int>());
+
+        for (int i = 0; i < 100; ++i) {
+            table.insert(i * i);
+        }
+
+        ASSERT(100 == table.size());
+        ASSERT(table.contains(81));
+        ASSERT(!table.contains(82));
+        ASSERT(1 == table.erase(81));
+        ASSERT(!table.contains(81));
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY AND ALLOCATOR PROPAGATION
+        //
+        // Concerns:
+        //: 1 All memory is supplied by the allocator passed at construction,
+        //:   or by the default allocator if none is passed.
+        //:
+        //: 2 The allocator is passed to entries that use 'bslma' allocators,
+        //:   including those created by 'operator[]'.
+        //:
+        //: 3 If an allocation fails during 'insert', 'operator[]', a copy, or
+        //:   an assignment, no memory is leaked and the table remains
+        //:   consistent.
+        //:
+        //: 4 If an allocation fails while inserting into a table that does not
+        //:   need to grow, the table is unchanged.
+        //:
+        //: 5 Erasing an entry, or clearing the table, does not release the
+        //:   slots, while 'reset' releases all memory.
+        //
+        // Plan:
+        //: 1 Create tables of long strings with and without an allocator, and
+        //:   verify where memory is allocated.  (C-1..2)
+        //:
+        //: 2 Perform insertions, copies, and assignments inside the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST' macros, verifying the table
+        //:   after each attempt, with a normal hash and one that makes all
+        //:   keys collide.  (C-3..4)
+        //:
+        //: 3 Verify the allocation counts after 'erase', 'clear', and
+        //:   'reset'.  (C-5)
+        //
+        // Testing:
+        //   bslma::Allocator *allocator() const;
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY AND ALLOCATOR PROPAGATION"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        const char *const LONG = "a string long enough to allocate memory";
+
+        if (verbose) cout << "\tAllocator propagation." << endl;
+        {
+            {
+                StringTable mX(0, StringHash(), bsl::equal_to<bsl::string>());
+                ASSERT(&defaultAllocator == mX.allocator());
+                ASSERT(0 == defaultAllocator.numBlocksInUse());
+                mX.insert(bsl::string(LONG));
+                ASSERT(0 < defaultAllocator.numBlocksInUse());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            const Int64 defaultBlocks = defaultAllocator.numBlocksTotal();
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            PairTable mX(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            ASSERT(&ta == mX.allocator());
+            ASSERT(0 == ta.numBlocksTotal());
+
+            mX[1].second = LONG;
+            mX.insert(bsl::pair<const int, bsl::string>(
+                                                    2,
+                                                    bsl::string(LONG, &ta)));
+            ASSERT(&ta == mX[1].second.get_allocator().mechanism());
+            ASSERT(&ta == mX[2].second.get_allocator().mechanism());
+            ASSERT(defaultBlocks == defaultAllocator.numBlocksTotal());
+
+            const Int64 blocks = ta.numBlocksInUse();
+            ASSERT(1 == mX.erase(1));
+            ASSERT(blocks - 1 == ta.numBlocksInUse());
+            mX.clear();
+            ASSERT(1 == ta.numBlocksInUse());
+            mX.reset();
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == mX.capacity());
+        }
+
+        if (verbose) cout << "\tException neutrality." << endl;
+
+        for (int constant = 0; constant < 2; ++constant) {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            StringTable mX(0,
+                           StringHash(constant),
+                           bsl::equal_to<bsl::string>(),
+                           &ta);
+            const StringTable& X = mX;
+
+            for (int i = 0; i < 40; ++i) {
+                char buffer[64];
+                bsl::sprintf(buffer, "%s %d", LONG, i);
+                const bsl::string KEY(buffer);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    const bsl::size_t SIZE     = X.size();
+                    const bsl::size_t CAPACITY = X.capacity();
+                    try {
+                        mX.insert(KEY);
+                    }
+                    catch (...) {
+                        ASSERTV(constant, i, !X.contains(KEY));
+                        if (X.capacity() == CAPACITY) {
+                            ASSERTV(constant, i, SIZE == X.size());
+                        }
+                        throw;
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(constant, i, X.contains(KEY));
+                ASSERTV(constant, i, i + 1 == static_cast<int>(X.size()));
+
+                bsl::size_t numVisited = 0;
+                for (StringTable::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it, ++numVisited) {
+                    ASSERTV(constant, i, X.find(*it) == it);
+                }
+                ASSERTV(constant, i, X.size() == numVisited);
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                StringTable mY(X, &ta);
+                ASSERTV(constant, X == mY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                StringTable mY(0,
+                               StringHash(constant),
+                               bsl::equal_to<bsl::string>(),
+                               &ta);
+                mY.insert(bsl::string(LONG));
+                mY = X;
+                ASSERTV(constant, X == mY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Two tables compare equal if and only if they hold the same
+        //:   entries, regardless of capacity, insertion order, and history of
+        //:   erasures.
+        //:
+        //: 2 Entries having equal keys but different values compare unequal.
+        //:
+        //: 3 A copy has the same value, functors, and capacity as the
+        //:   original, and uses the allocator supplied to it.
+        //:
+        //: 4 Assignment, including self-assignment, gives the target the value
+        //:   and functors of the source and returns a reference to the
+        //:   target.
+        //:
+        //: 5 The 'swap' method exchanges values and functors without
+        //:   allocating; the free 'swap' works with different allocators.
+        //
+        // Plan:
+        //: 1 Build pairs of tables from the same keys in different orders,
+        //:   with different capacities and erasures, and compare them.
+        //:   (C-1..2)
+        //:
+        //: 2 Copy, assign, and swap tables, verifying value, functors,
+        //:   capacity, and allocation counts.  (C-3..5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original, Allocator *ba = 0);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   void swap(FlatHashTable& other);
+        //   const HASH& hash_function() const;
+        //   const EQUAL& key_eq() const;
+        //   bool operator==(const FlatHashTable& lhs, const FlatHashTable&);
+        //   bool operator!=(const FlatHashTable& lhs, const FlatHashTable&);
+        //   void swap(FlatHashTable& a, FlatHashTable& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        bslma::TestAllocator tb("other",  veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tEquality." << endl;
+        {
+            IntTable mX(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            IntTable mY(256, ScaledHash(3), bsl::equal_to<int>(), &ta);
+            const IntTable& X = mX;
+            const IntTable& Y = mY;
+
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+                mY.insert(99 - i);
+                ASSERTV(i, (X == Y) == (99 == i));
+            }
+            ASSERT(X == Y);
+            ASSERT(X.capacity() != Y.capacity());
+
+            mX.insert(1000);
+            ASSERT(X != Y);
+            mY.insert(1001);
+            ASSERT(X != Y);
+            mX.erase(1000);
+            mX.insert(1001);
+            ASSERT(X == Y);
+
+            PairTable mA(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            PairTable mB(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            mA[1].second = "one";
+            mB[1].second = "uno";
+            ASSERT(mA != mB);
+            mB[1].second = "one";
+            ASSERT(mA == mB);
+        }
+
+        if (verbose) cout << "\tCopy construction." << endl;
+        {
+            PairTable mX(0, ScaledHash(5), bsl::equal_to<int>(), &ta);
+            const PairTable& X = mX;
+            for (int i = 0; i < 50; ++i) {
+                mX[i].second = "a long string value that must allocate";
+            }
+            for (int i = 0; i < 50; i += 3) {
+                mX.erase(i);
+            }
+
+            {
+                PairTable mY(X, &tb);  const PairTable& Y = mY;
+                ASSERT(X == Y);
+                ASSERT(&tb == Y.allocator());
+                ASSERT(X.capacity() == Y.capacity());
+                ASSERT(5 == Y.hash_function().d_multiplier);
+                ASSERT(&tb == Y.begin()->second.get_allocator().mechanism());
+            }
+            ASSERT(0 == tb.numBlocksInUse());
+
+            const Int64 defaultBlocks = defaultAllocator.numBlocksTotal();
+            {
+                PairTable mY(X);  const PairTable& Y = mY;
+                ASSERT(X == Y);
+                ASSERT(&defaultAllocator == Y.allocator());
+            }
+            ASSERT(defaultBlocks < defaultAllocator.numBlocksTotal());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            IntTable mE(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            const Int64 blocks = tb.numBlocksTotal();
+            IntTable mF(mE, &tb);
+            ASSERT(0 == mF.capacity());
+            ASSERT(blocks == tb.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\tAssignment." << endl;
+        {
+            PairTable mX(0, ScaledHash(5), bsl::equal_to<int>(), &ta);
+            const PairTable& X = mX;
+            for (int i = 0; i < 30; ++i) {
+                mX[i].second = "value";
+            }
+
+            PairTable mY(0, ScaledHash(7), bsl::equal_to<int>(), &tb);
+            const PairTable& Y = mY;
+            for (int i = 100; i < 200; ++i) {
+                mY[i].second = "other value";
+            }
+
+            PairTable *mR = &(mY = X);
+            ASSERT(&mY == mR);
+            ASSERT(X == Y);
+            ASSERT(5 == Y.hash_function().d_multiplier);
+            ASSERT(&tb == Y.allocator());
+            ASSERT(&tb == Y.begin()->second.get_allocator().mechanism());
+
+            mR = &(mY = Y);
+            ASSERT(&mY == mR);
+            ASSERT(X == Y);
+
+            IntTable mE(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            IntTable mF(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            mF.insert(1);
+            mF = mE;
+            ASSERT(mF.empty());
+            ASSERT(mE == mF);
+        }
+
+        if (verbose) cout << "\tSwap." << endl;
+        {
+            IntTable mX(0, ScaledHash(2), bsl::equal_to<int>(), &ta);
+            IntTable mY(0, ScaledHash(3), bsl::equal_to<int>(), &ta);
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i);
+            }
+            for (int i = 0; i < 100; ++i) {
+                mY.insert(-i);
+            }
+            const IntTable XX(mX, &ta);
+            const IntTable YY(mY, &ta);
+
+            const Int64 blocks = ta.numBlocksTotal();
+            mX.swap(mY);
+            ASSERT(blocks == ta.numBlocksTotal());
+            ASSERT(YY == mX);
+            ASSERT(XX == mY);
+            ASSERT(3 == mX.hash_function().d_multiplier);
+            ASSERT(2 == mY.hash_function().d_multiplier);
+
+            swap(mX, mY);
+            ASSERT(blocks == ta.numBlocksTotal());
+            ASSERT(XX == mX);
+            ASSERT(YY == mY);
+
+            IntTable mZ(0, ScaledHash(4), bsl::equal_to<int>(), &tb);
+            swap(mX, mZ);
+            ASSERT(mX.empty());
+            ASSERT(XX == mZ);
+            ASSERT(&ta == mX.allocator());
+            ASSERT(&tb == mZ.allocator());
+            ASSERT(4 == mX.hash_function().d_multiplier);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CAPACITY
+        //
+        // Concerns:
+        //: 1 A table created with capacity 0 allocates no memory; otherwise
+        //:   its capacity is the smallest power of two (at least
+        //:   'k_MIN_CAPACITY') that is not less than the requested capacity.
+        //:
+        //: 2 'reserve(n)' results in a capacity that holds 'n' entries within
+        //:   the maximum load factor, and subsequent insertion of up to 'n'
+        //:   entries does not allocate.
+        //:
+        //: 3 'rehash' shrinks or grows the table to the smallest capacity
+        //:   holding its entries, preserving them, and 'rehash(0)' on an
+        //:   empty table releases all memory.
+        //:
+        //: 4 Repeatedly inserting and erasing keys does not grow the table
+        //:   without bound.
+        //:
+        //: 5 'load_factor' and 'max_load_factor' return the expected values.
+        //
+        // Plan:
+        //: 1 Exercise each manipulator, verifying 'capacity', 'load_factor',
+        //:   and the allocation counts of a test allocator.  (C-1..5)
+        //
+        // Testing:
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numEntries);
+        //   void reset();
+        //   size_t capacity() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_requested;
+            bsl::size_t d_expected;
+        } DATA[] = {
+            //LINE  REQUESTED  EXPECTED
+            //----  ---------  --------
+            { L_,           0,        0 },
+            { L_,           1,       16 },
+            { L_,          15,       16 },
+            { L_,          16,       16 },
+            { L_,          17,       32 },
+            { L_,         100,      128 },
+            { L_,        1024,     1024 },
+            { L_,        1025,     2048 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::size_t REQUESTED = DATA[ti].d_requested;
+            const bsl::size_t EXPECTED  = DATA[ti].d_expected;
+
+            {
+                IntTable mX(REQUESTED,
+                            ScaledHash(),
+                            bsl::equal_to<int>(),
+                            &ta);
+                ASSERTV(LINE, EXPECTED == mX.capacity());
+                ASSERTV(LINE, (0 == EXPECTED) == (0 == ta.numBlocksInUse()));
+                ASSERTV(LINE, 0.0f == mX.load_factor());
+                ASSERTV(LINE, 0.875f == mX.max_load_factor());
+            }
+            {
+                IntTable mX(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+                mX.rehash(REQUESTED);
+                ASSERTV(LINE, EXPECTED == mX.capacity());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tReserve." << endl;
+
+        for (bsl::size_t n = 0; n < 300; n += 7) {
+            IntTable mX(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            mX.reserve(n);
+            const bsl::size_t CAPACITY = mX.capacity();
+            ASSERTV(n, n <= CAPACITY * 7 / 8);
+            ASSERTV(n, 0 == n || CAPACITY == 16 || n > CAPACITY / 2 * 7 / 8);
+
+            const Int64 blocks = ta.numBlocksTotal();
+            for (bsl::size_t i = 0; i < n; ++i) {
+                mX.insert(static_cast<int>(i * 31));
+            }
+            ASSERTV(n, CAPACITY == mX.capacity());
+            ASSERTV(n, blocks == ta.numBlocksTotal());
+            ASSERTV(n, 0 == n || 0.0f < mX.load_factor());
+
+            mX.reserve(n / 2);
+            ASSERTV(n, CAPACITY == mX.capacity());
+        }
+
+        if (verbose) cout << "\tRehash." << endl;
+        {
+            IntTable mX(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            bsl::set<int> oracle;
+            for (int i = 0; i < 1000; ++i) {
+                mX.insert(i);
+                oracle.insert(i);
+            }
+            ASSERT(2048 == mX.capacity());
+            ASSERT(isConsistent(mX, oracle));
+
+            for (int i = 0; i < 1000; i += 2) {
+                mX.erase(i);
+                oracle.erase(i);
+            }
+            mX.rehash(0);
+            ASSERT(1024 == mX.capacity());
+            ASSERT(isConsistent(mX, oracle));
+
+            mX.rehash(8192);
+            ASSERT(8192 == mX.capacity());
+            ASSERT(isConsistent(mX, oracle));
+            ASSERT(500.0f / 8192 == mX.load_factor());
+
+            mX.clear();
+            ASSERT(8192 == mX.capacity());
+            mX.rehash(0);
+            ASSERT(0 == mX.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(mX.begin() == mX.end());
+
+            mX.insert(5);
+            ASSERT(16 == mX.capacity());
+            mX.reset();
+            ASSERT(0 == mX.capacity());
+            ASSERT(mX.empty());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tErased slots are reclaimed." << endl;
+        {
+            IntTable mX(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i);
+            }
+            const bsl::size_t CAPACITY = mX.capacity();
+            for (int i = 10; i < 100000; ++i) {
+                mX.insert(i);
+                ASSERTV(i, 1 == mX.erase(i - 10));
+            }
+            ASSERT(10 == mX.size());
+            ASSERT(CAPACITY == mX.capacity());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // RANDOM OPERATIONS
+        //
+        // Concerns:
+        //: 1 The table holds exactly the keys inserted and not yet erased,
+        //:   each exactly once, as observed through iteration, 'find',
+        //:   'contains', 'count', and 'equal_range'.
+        //:
+        //: 2 'insert' and 'operator[]' report and return the correct entry
+        //:   whether or not the key is already present.
+        //:
+        //: 3 'erase' by iterator returns an iterator to a following entry.
+        //:
+        //: 4 The table remains correct when many keys share the same group or
+        //:   the same hash value, and after many erasures (i.e., erased slots
+        //:   do not break probe sequences).
+        //
+        // Plan:
+        //: 1 Apply long random sequences of operations to the table and to a
+        //:   'bsl::set' oracle, with a good hash, a hash whose values select
+        //:   the same group for most keys, and a constant hash, and verify
+        //:   they agree.  (C-1..4)
+        //:
+        //: 2 Insert into and look up in a table mapping to strings, verifying
+        //:   the values.  (C-1..2)
+        //
+        // Testing:
+        //   FlatHashTable(size_t capacity, hash, equal, Allocator *ba = 0);
+        //   ~FlatHashTable();
+        //   ENTRY& operator[](const KEY& key);
+        //   iterator begin();
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator end();
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const ENTRY& entry);
+        //   const_iterator begin() const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator end() const;
+        //   pair<const_iterator, const_iterator> equal_range(KEY) const;
+        //   const_iterator find(const KEY& key) const;
+        //   size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANDOM OPERATIONS" << endl
+                          << "=================" << endl;
+
+        testRandomOperations(1,                100,   20000, veryVerbose);
+        testRandomOperations(1,              10000,  200000, veryVerbose);
+        testRandomOperations(0x9e3779b9u,     5000,  100000, veryVerbose);
+        testRandomOperations(1ull << 40,      3000,  100000, veryVerbose);
+        testRandomOperations(0,                300,   20000, veryVerbose);
+
+        if (verbose) cout << "\tEntries with values." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            PairTable mX(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+            const PairTable& X = mX;
+            bsl::map<int, bsl::string> oracle;
+
+            for (int i = 0; i < 2000; ++i) {
+                const int   key = (i * 37) % 1500;
+                bsl::string value(i % 50, static_cast<char>('a' + i % 26));
+                if (i % 2) {
+                    mX[key].second = value;
+                    oracle[key]    = value;
+                }
+                else {
+                    const bool inserted = mX.insert(
+                        bsl::pair<const int, bsl::string>(key, value)).second;
+                    ASSERTV(i, inserted == oracle.insert(
+                              bsl::pair<int, bsl::string>(key, value)).second);
+                }
+            }
+            ASSERT(oracle.size() == X.size());
+            for (bsl::map<int, bsl::string>::const_iterator it =
+                                                               oracle.begin();
+                 it != oracle.end();
+                 ++it) {
+                PairTable::const_iterator found = X.find(it->first);
+                ASSERTV(it->first, found != X.end());
+                ASSERTV(it->first, it->second == found->second);
+            }
+
+            const bsl::pair<PairTable::const_iterator,
+                            PairTable::const_iterator> range =
+                                                          X.equal_range(3000);
+            ASSERT(range.first == X.end());
+            ASSERT(range.second == X.end());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // GROUP CONTROL
+        //
+        // Concerns:
+        //: 1 Each query returns the mask of the bytes satisfying it, with bit
+        //:   'i' corresponding to byte 'i'.
+        //:
+        //: 2 'k_EMPTY' and 'k_ERASED' are not confused with each other or with
+        //:   the 7-bit hash values.
+        //:
+        //: 3 Unaligned groups are supported.
+        //
+        // Plan:
+        //: 1 For many random groups, built from 7-bit values, 'k_EMPTY', and
+        //:   'k_ERASED' at unaligned addresses, compare each query with a
+        //:   direct evaluation.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl(const uint8_t *controlBytes);
+        //   BitMask available() const;
+        //   bool containsEmpty() const;
+        //   BitMask inUse() const;
+        //   BitMask match(uint8_t value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROUP CONTROL" << endl
+                          << "=============" << endl;
+
+        ASSERT(0x80 == GroupControl::k_EMPTY);
+        ASSERT(0xfe == GroupControl::k_ERASED);
+
+        unsigned int state = 1;
+        bsl::uint8_t buffer[GroupControl::k_SIZE + 8];
+
+        for (int iteration = 0; iteration < 20000; ++iteration) {
+            const int          offset = iteration % 8;
+            bsl::uint8_t      *bytes  = buffer + offset;
+            const unsigned int mode   = nextRandom(&state) % 4;
+
+            for (int i = 0; i < GroupControl::k_SIZE; ++i) {
+                const unsigned int r = nextRandom(&state) % 8;
+                if (0 == mode && r == 0) {
+                    bytes[i] = GroupControl::k_EMPTY;
+                }
+                else if (1 == mode && r < 2) {
+                    bytes[i] = GroupControl::k_ERASED;
+                }
+                else if (2 == mode && r < 4) {
+                    bytes[i] = r < 2 ? GroupControl::k_EMPTY
+                                     : GroupControl::k_ERASED;
+                }
+                else {
+                    bytes[i] = static_cast<bsl::uint8_t>(
+                                                 nextRandom(&state) & 0x7f);
+                }
+            }
+
+            const GroupControl X(bytes);
+
+            const BitMask EXP_AVAILABLE = expectedAvailable(bytes);
+            const BitMask EXP_EMPTY     = expectedMatch(bytes,
+                                                        GroupControl::k_EMPTY);
+
+            ASSERTV(iteration, EXP_AVAILABLE == X.available());
+            ASSERTV(iteration, (0 != EXP_EMPTY) == X.containsEmpty());
+            ASSERTV(iteration, (~EXP_AVAILABLE & 0xffff) == X.inUse());
+            ASSERTV(iteration, EXP_EMPTY == X.match(GroupControl::k_EMPTY));
+
+            const bsl::uint8_t VALUE = bytes[nextRandom(&state) % 16] & 0x7f;
+            ASSERTV(iteration, expectedMatch(bytes, VALUE) == X.match(VALUE));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, erase, and iterate over a few keys.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        IntTable mX(0, ScaledHash(), bsl::equal_to<int>(), &ta);
+        const IntTable& X = mX;
+
+        ASSERT(X.empty());
+        ASSERT(0 == X.capacity());
+        ASSERT(X.begin() == X.end());
+        ASSERT(X.find(1) == X.end());
+        ASSERT(0 == ta.numBlocksTotal());
+
+        ASSERT(mX.insert(1).second);
+        ASSERT(mX.insert(2).second);
+        ASSERT(!mX.insert(1).second);
+        ASSERT(2 == X.size());
+        ASSERT(16 == X.capacity());
+        ASSERT(X.contains(1));
+        ASSERT(X.contains(2));
+        ASSERT(!X.contains(3));
+
+        int sum = 0;
+        for (IntTable::const_iterator it = X.begin(); it != X.end(); ++it) {
+            sum += *it;
+        }
+        ASSERT(3 == sum);
+
+        ASSERT(1 == mX.erase(1));
+        ASSERT(0 == mX.erase(1));
+        ASSERT(1 == X.size());
+        ASSERT(!X.contains(1));
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(i);
+        }
+        ASSERT(100 == X.size());
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, X.contains(i));
+        }
+        mX.clear();
+        ASSERT(X.empty());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -28,6 +28,16 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The 'tryPopFront' method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// The batch methods 'pushBackBatch', 'popFrontBatch', and 'tryPopFrontBatch'
+// transfer an array of elements in one call.  Each batch reserves its
+// contiguous range of elements with a single atomic operation and notifies
+// the threads blocked on the other end of the queue once, rather than once per
+// element, which substantially reduces the cost of synchronization when
+// elements are produced or consumed in bursts.  Elements of a batch retain
+// their relative order, but elements pushed concurrently by other threads may
+// be interleaved between the portions of a 'pushBackBatch' that had to wait
+// for the queue to drain.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  Any threads blocked in 'pushBack'
@@ -182,6 +192,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslalg_scalarprimitives.h>
 
+#include <bslma_destructionutil.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_istriviallycopyable.h>
@@ -198,6 +209,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdint.h>
 
 namespace BloombergLP {
@@ -272,6 +285,99 @@ class BoundedQueue_PushExceptionCompleteProctor {
         // If no queue is currently managed, this method has no effect.
 };
 
+                // =========================================
+                // class BoundedQueue_PushBatchCompleteGuard
+                // =========================================
+
+template <class TYPE>
+class BoundedQueue_PushBatchCompleteGuard {
+    // This class implements a guard that invokes 'TYPE::pushBatchComplete'
+    // upon destruction, reporting the number of elements of the managed batch
+    // that were successfully constructed and the number that were not.
+
+    // DATA
+    TYPE        *d_queue_p;      // managed queue
+    bsl::size_t  d_numNodes;     // number of nodes reserved for the batch
+    bsl::size_t  d_numPushed;    // number of nodes successfully constructed
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushBatchCompleteGuard();
+    BoundedQueue_PushBatchCompleteGuard(
+                                   const BoundedQueue_PushBatchCompleteGuard&);
+    BoundedQueue_PushBatchCompleteGuard& operator=(
+                                   const BoundedQueue_PushBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushBatchCompleteGuard(TYPE *queue, bsl::size_t numNodes);
+        // Create a 'pushBatchComplete' guard managing the specified 'numNodes'
+        // nodes reserved from the specified 'queue', none of which have yet
+        // been constructed.
+
+    ~BoundedQueue_PushBatchCompleteGuard();
+        // Destroy this object and invoke the managed queue's
+        // 'pushBatchComplete' method with the number of constructed and
+        // unconstructed nodes.
+
+    // MANIPULATORS
+    void increment();
+        // Record that one more of the managed nodes has been constructed.
+};
+
+                 // ========================================
+                 // class BoundedQueue_PopBatchCompleteGuard
+                 // ========================================
+
+template <class TYPE, class NODE>
+class BoundedQueue_PopBatchCompleteGuard {
+    // This class implements a guard that iterates over the nodes reserved by
+    // a batch "pop" operation, destroying the value held by each node once the
+    // next node is requested, and that, upon destruction, destroys the values
+    // of the nodes not yet visited and invokes 'TYPE::popBatchComplete'.
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    // DATA
+    TYPE   *d_queue_p;      // managed queue owning the managed nodes
+    NODE   *d_node_p;       // node most recently returned by 'next', if any
+    Uint64  d_index;        // index of the next node of the current range
+    Uint64  d_numNodes;     // number of nodes left in the current range
+    Uint64  d_numSkipped;   // number of reclaimed nodes skipped in the
+                            // current range
+    Uint64  d_numReserved;  // total number of nodes reserved
+    bool    d_isEmpty;      // if true, the empty condition will be signalled
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopBatchCompleteGuard();
+    BoundedQueue_PopBatchCompleteGuard(
+                                    const BoundedQueue_PopBatchCompleteGuard&);
+    BoundedQueue_PopBatchCompleteGuard& operator=(
+                                    const BoundedQueue_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopBatchCompleteGuard(TYPE   *queue,
+                                       Uint64  numValues,
+                                       bool    isEmpty);
+        // Create a 'popBatchComplete' guard that reserves the nodes holding
+        // the next specified 'numValues' values of the specified 'queue', and
+        // that will cause the empty condition to be signalled if the specified
+        // 'isEmpty' is 'true'.  The behavior is undefined unless 'numValues'
+        // elements have been acquired from the "pop" semaphore of 'queue'.
+
+    ~BoundedQueue_PopBatchCompleteGuard();
+        // Destroy the values held by the nodes of the batch, destroy this
+        // object, and invoke the 'TYPE::popBatchComplete' method.
+
+    // MANIPULATORS
+    NODE *next();
+        // Destroy the value held by the node returned by the previous
+        // invocation of this method, if any, and return the address of the
+        // next node of the batch holding a value, or 0 if all the values of
+        // the batch have been returned.
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -404,12 +510,34 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PushBatchCompleteGuard<BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PopBatchCompleteGuard<
+                                            BoundedQueue<TYPE>,
+                                            typename BoundedQueue<TYPE>::Node>;
+
     // PRIVATE CLASS METHODS
     static bool isQuiescentState(bsls::Types::Uint64 count);
         // Return 'true' if the specified 'count' implies a quiescent state
         // (see *Implementation* *Note*), and 'false' otherwise.
 
     // PRIVATE MANIPULATORS
+    Node *element(Uint64 index);
+        // Return the address of the node at the specified 'index' of the
+        // circular buffer of this queue.
+
+    void popBatchComplete(Uint64 numNodes, bool isEmpty);
+        // Mark the specified 'numNodes' "pop" operations as complete, 'post'
+        // to the 'd_pushSemaphore' if appropriate, and if the specified
+        // 'isEmpty' is 'true' then signal the queue empty condition.  The
+        // behavior is undefined unless the values held by the nodes have been
+        // destroyed.
+
+    Uint64 popBatchReserve(Uint64 numNodes);
+        // Start the specified 'numNodes' "pop" operations and return the index
+        // of the first node of the contiguous range of 'numNodes' nodes
+        // reserved for them.
+
     void popComplete(Node *node, bool isEmpty);
         // Destruct the value stored in the specified 'node', mark the 'node'
         // writable, and if the specified 'isEmpty' is 'true' then signal the
@@ -417,11 +545,29 @@ class BoundedQueue {
         // by a guard to complete the reclamation of a node in the presence of
         // an exception.
 
+    void popBatchHelper(TYPE *values, Uint64 numValues);
+        // Remove the specified 'numValues' elements from the front of this
+        // queue and load them, in order, into the array starting at the
+        // specified 'values'.  This method is invoked by 'popFrontBatch' and
+        // 'tryPopFrontBatch' once 'numValues' elements are available.
+
     void popFrontHelper(TYPE *value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  This method is invoked by
         // 'popFront' and 'tryPopFront' once an element is available.
 
+    void pushBatchComplete(Uint64 numPushed, Uint64 numFailed);
+        // Mark the specified 'numPushed' "push" operations as complete, remove
+        // the indicators for the specified 'numFailed' started "push"
+        // operations, and 'post' to the 'd_popSemaphore' if appropriate.  This
+        // method is used by a guard to complete a batch "push" operation,
+        // both normally and in the presence of an exception.
+
+    void pushBatchHelper(const TYPE *values, Uint64 numValues);
+        // Append the specified 'numValues' elements of the specified 'values'
+        // array to the back of this queue.  This method is invoked by
+        // 'pushBackBatch' once 'numValues' empty elements have been acquired.
+
     void pushComplete();
         // Mark a "push" operation as complete, and 'post' to the
         // 'd_popSemaphore' if appropriate.
@@ -474,6 +620,25 @@ class BoundedQueue {
         // the queue being empty will return 'e_DISABLED' if 'disablePopFront'
         // is invoked.
 
+    int popFrontBatch(TYPE        *values,
+                      bsl::size_t  maxNumValues,
+                      bsl::size_t *numPopped);
+        // Remove up to the specified 'maxNumValues' elements from the front
+        // of this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into
+        // the specified 'numPopped'.  If the queue is empty, block until it is
+        // not empty; at least one element is removed on success.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPopFrontDisabled()' and
+        // 'e_FAILED' if an error occurs.  On failure, 'values' is not changed
+        // and 0 is loaded into 'numPopped'.  Threads blocked due to the queue
+        // being empty will return 'e_DISABLED' if 'disablePopFront' is
+        // invoked.  The behavior is undefined unless '0 < maxNumValues' and
+        // 'values' refers to an array of at least 'maxNumValues' elements.
+        // Note that the elements are reserved from the queue, and the
+        // producers blocked on a full queue are notified, once per invocation
+        // rather than once per element.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  If the
         // queue is full, block until it is not full.  Return 0 on success, and
@@ -492,6 +657,23 @@ class BoundedQueue {
         // due to the queue being full will return 'e_DISABLED' if
         // 'disablePushBack' is invoked.
 
+    int pushBackBatch(const TYPE  *values,
+                      bsl::size_t  numValues,
+                      bsl::size_t *numPushed = 0);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue.  If the
+        // queue is full, block until it is not full, appending as many of the
+        // remaining elements as fit at each opportunity.  Optionally specify
+        // 'numPushed', into which the number of elements appended is loaded.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_SUCCESS' if all 'numValues' elements were appended,
+        // 'e_DISABLED' if 'isPushBackDisabled()' and 'e_FAILED' if an error
+        // occurs.  On failure, the elements appended before the failure remain
+        // in the queue.  Threads blocked due to the queue being full will
+        // return 'e_DISABLED' if 'disablePushBack' is invoked.  Note that the
+        // elements appended at each opportunity are reserved from the queue,
+        // and the consumers are notified, once rather than once per element.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -507,6 +689,22 @@ class BoundedQueue {
         // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
         // an error occurs.  On failure, 'value' is not changed.
 
+    int tryPopFrontBatch(TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bsl::size_t *numPopped);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, and, if successful, load
+        // the removed elements, in order, into the array starting at the
+        // specified 'values'.  Load the number of elements removed into the
+        // specified 'numPopped'.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_SUCCESS' if at least one element
+        // was removed, 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
+        // an error occurs.  On failure, 'values' is not changed and 0 is
+        // loaded into 'numPopped'.  The behavior is undefined unless
+        // '0 < maxNumValues' and 'values' refers to an array of at least
+        // 'maxNumValues' elements.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -641,6 +839,109 @@ void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
     d_queue_p = 0;
 }
 
+                // -----------------------------------------
+                // class BoundedQueue_PushBatchCompleteGuard
+                // -----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushBatchCompleteGuard<TYPE>::BoundedQueue_PushBatchCompleteGuard(
+                                                         TYPE        *queue,
+                                                         bsl::size_t  numNodes)
+: d_queue_p(queue)
+, d_numNodes(numNodes)
+, d_numPushed(0)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushBatchCompleteGuard<TYPE>::
+                                         ~BoundedQueue_PushBatchCompleteGuard()
+{
+    d_queue_p->pushBatchComplete(d_numPushed, d_numNodes - d_numPushed);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushBatchCompleteGuard<TYPE>::increment()
+{
+    ++d_numPushed;
+}
+
+                // ----------------------------------------
+                // class BoundedQueue_PopBatchCompleteGuard
+                // ----------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+inline
+BoundedQueue_PopBatchCompleteGuard<TYPE, NODE>::
+                         BoundedQueue_PopBatchCompleteGuard(TYPE   *queue,
+                                                            Uint64  numValues,
+                                                            bool    isEmpty)
+: d_queue_p(queue)
+, d_node_p(0)
+, d_index(queue->popBatchReserve(numValues))
+, d_numNodes(numValues)
+, d_numSkipped(0)
+, d_numReserved(numValues)
+, d_isEmpty(isEmpty)
+{
+}
+
+template <class TYPE, class NODE>
+BoundedQueue_PopBatchCompleteGuard<TYPE, NODE>::
+                                          ~BoundedQueue_PopBatchCompleteGuard()
+{
+    while (next()) {
+        // Destroy the remaining values; this loop executes only when an
+        // exception prevented the batch from being fully consumed.
+    }
+
+    d_queue_p->popBatchComplete(d_numReserved, d_isEmpty);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+NODE *BoundedQueue_PopBatchCompleteGuard<TYPE, NODE>::next()
+{
+    if (d_node_p) {
+        bslma::DestructionUtil::destroy(d_node_p->d_value.address());
+        d_node_p = 0;
+    }
+
+    while (true) {
+        if (0 == d_numNodes) {
+            if (0 == d_numSkipped) {
+                return 0;                                             // RETURN
+            }
+
+            // Every node marked for reclamation in the previous range
+            // displaced a value; reserve a further range to obtain them.
+
+            d_index        = d_queue_p->popBatchReserve(d_numSkipped);
+            d_numNodes     = d_numSkipped;
+            d_numReserved += d_numSkipped;
+            d_numSkipped   = 0;
+        }
+
+        NODE *node = d_queue_p->element(d_index);
+
+        ++d_index;
+        --d_numNodes;
+
+        if (!node->reclaim()) {
+            d_node_p = node;
+            return node;                                              // RETURN
+        }
+
+        ++d_numSkipped;
+    }
+}
+
                          // ------------------------
                          // struct BoundedQueue_Node
                          // ------------------------
@@ -686,6 +987,54 @@ bool BoundedQueue<TYPE>::isQuiescentState(bsls::Types::Uint64 count)
 }
 
 // PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+typename BoundedQueue<TYPE>::Node *BoundedQueue<TYPE>::element(Uint64 index)
+{
+    return &d_element_p[index % d_capacity];
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popBatchComplete(Uint64 numNodes, bool isEmpty)
+{
+    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_popCount,
+                                               k_FINISHED_INC * numNodes);
+    if (isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.post(static_cast<int>(count & k_STARTED_MASK));
+        }
+    }
+
+    if (isEmpty) {
+        AtomicOp::addUintAcqRel(&d_emptyGeneration, 1);
+        if (0 < AtomicOp::getUintAcquire(&d_emptyCount)) {
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&d_emptyMutex);
+            }
+            d_emptyCondition.broadcast();
+        }
+    }
+}
+
+template <class TYPE>
+inline
+typename BoundedQueue<TYPE>::Uint64
+BoundedQueue<TYPE>::popBatchReserve(Uint64 numNodes)
+{
+    AtomicOp::addUint64AcqRel(&d_popCount, k_STARTED_INC * numNodes);
+
+    // 'd_popIndex' stores the next location to use (want the original value)
+
+    return AtomicOp::addUint64NvAcqRel(&d_popIndex, numNodes) - numNodes;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
 {
@@ -716,6 +1065,25 @@ void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popBatchHelper(TYPE *values, Uint64 numValues)
+{
+    bool empty = isEmpty();
+
+    BoundedQueue_PopBatchCompleteGuard<BoundedQueue<TYPE>, Node>
+                                                 guard(this, numValues, empty);
+
+    Node *node;
+    while (0 != (node = guard.next())) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        *values = bslmf::MovableRefUtil::move(node->d_value.object());
+#else
+        *values = node->d_value.object();
+#endif
+        ++values;
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 {
@@ -753,6 +1121,66 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 #endif
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBatchComplete(Uint64 numPushed, Uint64 numFailed)
+{
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                                          &d_pushCount,
+                                          k_FINISHED_INC * numPushed
+                                                - k_STARTED_INC * numFailed);
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of pushed elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the pop
+        // semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_pushCount,
+                                               count,
+                                               0) == count) {
+            d_popSemaphore.post(numToPost);
+        }
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBatchHelper(const TYPE *values, Uint64 numValues)
+{
+    AtomicOp::addUint64AcqRel(&d_pushCount, k_STARTED_INC * numValues);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numValues)
+                                                                   - numValues;
+
+    // Mark every reserved node for reclamation before constructing any of
+    // them so that, should a constructor throw, the nodes left unconstructed
+    // are skipped by the consumers.
+
+    for (Uint64 i = 0; i < numValues; ++i) {
+        element(index + i)->assignReclaim(true);
+    }
+
+    BoundedQueue_PushBatchCompleteGuard<BoundedQueue<TYPE> > guard(
+                                                    this,
+                                                    static_cast<bsl::size_t>(
+                                                                  numValues));
+
+    for (Uint64 i = 0; i < numValues; ++i) {
+        Node *node = element(index + i);
+
+        bslalg::ScalarPrimitives::copyConstruct(node->d_value.address(),
+                                                values[i],
+                                                d_allocator_p);
+
+        node->assignReclaim(false);
+
+        guard.increment();
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::pushComplete()
 {
@@ -849,6 +1277,38 @@ int BoundedQueue<TYPE>::popFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFrontBatch(TYPE        *values,
+                                      bsl::size_t  maxNumValues,
+                                      bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    *numPopped = 0;
+
+    int rv = d_popSemaphore.wait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    bsl::size_t numValues = 1;
+    if (1 < maxNumValues) {
+        numValues += d_popSemaphore.take(static_cast<int>(
+                       bsl::min<Uint64>(maxNumValues - 1, d_capacity)));
+    }
+
+    popBatchHelper(values, numValues);
+
+    *numPopped = numValues;
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -922,6 +1382,47 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBackBatch(const TYPE  *values,
+                                      bsl::size_t  numValues,
+                                      bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t numDone = 0;
+    int         rv      = e_SUCCESS;
+
+    while (numDone < numValues) {
+        int rc = d_pushSemaphore.wait();
+        if (rc) {
+            rv = bslmt::FastPostSemaphore::e_DISABLED == rc
+               ? e_DISABLED
+               : e_FAILED;
+            break;
+        }
+
+        // Having acquired one empty element, acquire as many more as are
+        // immediately available, and push them all as one batch.
+
+        bsl::size_t count = 1;
+        if (1 < numValues - numDone) {
+            count += d_pushSemaphore.take(static_cast<int>(
+                         bsl::min<Uint64>(numValues - numDone - 1,
+                                          d_capacity)));
+        }
+
+        pushBatchHelper(values + numDone, count);
+
+        numDone += count;
+    }
+
+    if (numPushed) {
+        *numPushed = numDone;
+    }
+
+    return rv;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::removeAll()
 {
@@ -980,6 +1481,41 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFrontBatch(TYPE        *values,
+                                         bsl::size_t  maxNumValues,
+                                         bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    *numPopped = 0;
+
+    int rv = d_popSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_EMPTY;                                           // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    bsl::size_t numValues = 1;
+    if (1 < maxNumValues) {
+        numValues += d_popSemaphore.take(static_cast<int>(
+                       bsl::min<Uint64>(maxNumValues - 1, d_capacity)));
+    }
+
+    popBatchHelper(values, numValues);
+
+    *numPopped = numValues;
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -79,10 +79,13 @@ using namespace bsl;
 // [ 2] BoundedQueue(bsl::size_t capacity, bslma::Allocator bA = 0);
 // [ 2] ~BoundedQueue();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBackBatch(const TYPE *, bsl::size_t, bsl::size_t * = 0);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
 // [ 5] void disablePopFront();
@@ -98,7 +101,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -107,6 +110,7 @@ using namespace bsl;
 // [10] CONCERN: template requirements
 // [11] CONCERN: ordering guarantee
 // [12] DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
+// [13] CONCERN: batch operations preserve order and skip reclaimed nodes
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -513,6 +517,17 @@ extern "C" void *deferredDisablePopFront(void *arg)
     return 0;
 }
 
+extern "C" void *deferredDisablePushBack(void *arg)
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    bslmt::ThreadUtil::microSleep(k_DECISECOND);
+
+    mX.disablePushBack();
+
+    return 0;
+}
+
 static bsls::TimeInterval s_deferredPopFrontInterval;
 
 extern "C" void *deferredPopFront(void *arg)
@@ -751,6 +766,46 @@ extern "C" void *pushWaitDisable(void *arg)
     return 0;
 }
 
+struct BatchPopData {
+    Obj         *d_obj_p;       // queue to pop from
+    int          d_numValues;   // total number of values to pop
+    int          d_numBatches;  // number of successful batch pops
+    bool         d_inOrder;     // 'true' if values were popped in order
+};
+
+extern "C" void *batchPop(void *arg)
+    // Pop 'd_numValues' values from the queue described by the specified
+    // 'arg', which must be a 'BatchPopData', using 'popFrontBatch', and record
+    // whether the values were the sequence '0, 1, 2, ...'.
+{
+    BatchPopData *data = static_cast<BatchPopData *>(arg);
+
+    enum { k_MAX_BATCH = 7 };
+
+    int next = 0;
+
+    data->d_numBatches = 0;
+    data->d_inOrder    = true;
+
+    while (next < data->d_numValues) {
+        int         values[k_MAX_BATCH];
+        bsl::size_t numPopped;
+
+        if (0 == data->d_obj_p->popFrontBatch(values,
+                                              k_MAX_BATCH,
+                                              &numPopped)) {
+            ++data->d_numBatches;
+            for (bsl::size_t i = 0; i < numPopped; ++i, ++next) {
+                if (next != values[i]) {
+                    data->d_inOrder = false;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -971,7 +1026,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1009,6 +1064,259 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 'pushBackBatch' appends the elements of the array in order and
+        //:   reports the number appended.
+        //:
+        //: 2 'popFrontBatch' and 'tryPopFrontBatch' remove up to the
+        //:   requested number of elements, in order, and report the number
+        //:   removed; 'tryPopFrontBatch' returns 'e_EMPTY' on an empty queue.
+        //:
+        //: 3 A 'pushBackBatch' larger than the capacity of the queue blocks
+        //:   until consumers make room, and the elements are delivered in
+        //:   order to a single consumer.
+        //:
+        //: 4 The batch methods honor the enqueue and dequeue disabled states.
+        //:
+        //: 5 An exception thrown while constructing an element of a batch
+        //:   leaves the previously constructed elements in the queue and the
+        //:   remaining reserved nodes are skipped by subsequent pops.
+        //:
+        //: 6 An exception thrown while assigning a popped element destroys
+        //:   the remaining elements of the batch and leaves the queue usable.
+        //
+        // Plan:
+        //: 1 Push and pop batches on a single thread and verify the values,
+        //:   counts, and return codes.  (C-1..2)
+        //:
+        //: 2 Push many more values than the capacity in batches while a
+        //:   consumer thread pops batches, and verify the sequence.  (C-3)
+        //:
+        //: 3 Disable and verify the return codes.  (C-4)
+        //:
+        //: 4 Using 'AllocExceptionHelper' and a test allocator with an
+        //:   allocation limit, inject exceptions into batch pushes and pops,
+        //:   and verify the number of elements and the memory in use.
+        //:   (C-5..6)
+        //
+        // Testing:
+        //   int popFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
+        //   int pushBackBatch(const TYPE *, bsl::size_t, bsl::size_t * = 0);
+        //   int tryPopFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
+        //   CONCERN: batch operations preserve order and skip reclaimed nodes
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nSingle-threaded batches." << endl;
+        {
+            Obj mX(8);  const Obj& X = mX;
+
+            const int   VALUES[] = { 1, 2, 3, 4, 5 };
+            int         values[16];
+            bsl::size_t num = 99;
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 5, &num));
+            ASSERT(5 == num);
+            ASSERT(5 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(values, 3, &num));
+            ASSERT(3 == num);
+            ASSERT(1 == values[0] && 2 == values[1] && 3 == values[2]);
+            ASSERT(2 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 0));
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 5));
+            ASSERT(7 == X.numElements());
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBatch(values, 16, &num));
+            ASSERT(7 == num);
+            ASSERT(4 == values[0] && 5 == values[1]);
+            for (int i = 2; i < 7; ++i) {
+                ASSERTV(i, values[i], i - 1 == values[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            values[0] = -1;
+            ASSERT(e_EMPTY == mX.tryPopFrontBatch(values, 16, &num));
+            ASSERT(0 == num);
+            ASSERT(-1 == values[0]);
+
+            // Interleave single-element and batch operations across the wrap
+            // of the circular buffer.
+
+            for (int i = 0; i < 20; ++i) {
+                ASSERT(e_SUCCESS == mX.pushBack(i));
+                ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 3));
+                ASSERT(e_SUCCESS == mX.tryPopFrontBatch(values, 2, &num));
+                ASSERTV(i, num, 2 == num);
+                ASSERTV(i, values[0], i == values[0]);
+                ASSERTV(i, values[1], 1 == values[1]);
+                ASSERT(e_SUCCESS == mX.popFront(&values[0]));
+                ASSERT(2 == values[0]);
+                ASSERT(e_SUCCESS == mX.popFrontBatch(values, 4, &num));
+                ASSERTV(i, num, 1 == num);
+                ASSERT(3 == values[0]);
+            }
+            ASSERT(X.isEmpty());
+        }
+
+        if (verbose) cout << "\nBatches larger than the capacity." << endl;
+        {
+            enum { k_NUM_VALUES = 10000, k_BATCH = 50 };
+
+            Obj mX(16);  const Obj& X = mX;
+
+            BatchPopData data;
+            data.d_obj_p     = &mX;
+            data.d_numValues = k_NUM_VALUES;
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, batchPop, &data);
+
+            bsl::vector<int> values(k_NUM_VALUES);
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                values[i] = i;
+            }
+
+            for (int i = 0; i < k_NUM_VALUES; i += k_BATCH) {
+                bsl::size_t num = 0;
+                ASSERT(e_SUCCESS == mX.pushBackBatch(&values[i],
+                                                     k_BATCH,
+                                                     &num));
+                ASSERTV(i, num, k_BATCH == num);
+            }
+
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(data.d_inOrder);
+            ASSERT(0 < data.d_numBatches);
+            ASSERT(X.isEmpty());
+
+            if (veryVerbose) {
+                P(data.d_numBatches);
+            }
+        }
+
+        if (verbose) cout << "\nDisabled states." << endl;
+        {
+            Obj mX(4);  const Obj& X = mX;
+
+            const int   VALUES[] = { 1, 2, 3, 4, 5, 6 };
+            int         values[6];
+            bsl::size_t num = 99;
+
+            mX.disablePushBack();
+            ASSERT(e_DISABLED == mX.pushBackBatch(VALUES, 3, &num));
+            ASSERT(0 == num);
+            ASSERT(X.isEmpty());
+            mX.enablePushBack();
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 3));
+
+            mX.disablePopFront();
+            ASSERT(e_DISABLED == mX.popFrontBatch(values, 6, &num));
+            ASSERT(0 == num);
+            ASSERT(e_DISABLED == mX.tryPopFrontBatch(values, 6, &num));
+            ASSERT(0 == num);
+            mX.enablePopFront();
+
+            // A batch that does not fit returns the partial count when the
+            // queue is disabled while it is blocked.
+
+            bslmt::ThreadUtil::Handle handle;
+            bslmt::ThreadUtil::create(&handle, deferredDisablePushBack, &mX);
+
+            ASSERT(e_DISABLED == mX.pushBackBatch(VALUES, 6, &num));
+            ASSERT(1 == num);
+            ASSERT(4 == X.numElements());
+
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(values, 6, &num));
+            ASSERT(4 == num);
+            ASSERT(1 == values[0] && 2 == values[1] && 3 == values[2]);
+            ASSERT(1 == values[3]);
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException safety." << endl;
+        {
+            typedef bdlcc::BoundedQueue<AllocExceptionHelper> HObj;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            {
+                HObj mX(8, &sa);  const HObj& X = mX;
+
+                bsl::vector<AllocExceptionHelper> values(4,
+                                                         AllocExceptionHelper(
+                                                                         &sa),
+                                                         &sa);
+
+                bsls::Types::Int64 inUse = sa.numBlocksInUse();
+
+                // The third copy construction throws.
+
+                int numException = 0;
+
+                sa.setAllocationLimit(2);
+                try {
+                    mX.pushBackBatch(&values[0], 4);
+                } catch (bslma::TestAllocatorException&) {
+                    ++numException;
+                }
+                sa.setAllocationLimit(-1);
+
+                ASSERT(1 == numException);
+                ASSERT(2 == X.numElements());
+                ASSERT(inUse + 2 == sa.numBlocksInUse());
+
+                ASSERT(0 == mX.pushBackBatch(&values[0], 3));
+                ASSERT(5 == X.numElements());
+
+                // The two reclaimed nodes are skipped.
+
+                bsl::size_t num = 0;
+                ASSERT(0 == mX.popFrontBatch(&values[0], 4, &num));
+                ASSERT(4 == num);
+                ASSERT(1 == X.numElements());
+
+                ASSERT(0 == mX.pushBackBatch(&values[0], 4));
+                ASSERT(5 == X.numElements());
+                ASSERT(inUse + 5 == sa.numBlocksInUse());
+
+                // The second assignment throws; the whole batch is removed.
+
+                numException = 0;
+
+                sa.setAllocationLimit(1);
+                try {
+                    mX.popFrontBatch(&values[0], 4, &num);
+                } catch (bslma::TestAllocatorException&) {
+                    ++numException;
+                }
+                sa.setAllocationLimit(-1);
+
+                ASSERT(1 == numException);
+                ASSERT(1 == X.numElements());
+                ASSERT(inUse + 1 == sa.numBlocksInUse());
+
+                ASSERT(0 == mX.pushBackBatch(&values[0], 4));
+                ASSERT(0 == mX.tryPopFrontBatch(&values[0], 4, &num));
+                ASSERT(4 == num);
+                ASSERT(1 == X.numElements());
+            }
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+#endif
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // DRQS 153332608: 'waitUntilEmpty' RACE WITH 'popFront'
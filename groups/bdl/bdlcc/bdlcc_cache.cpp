@@ -2,6 +2,226 @@
 
 #include <bdlcc_cache.h>
 
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_cache_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+namespace {
+
+const bsls::Types::Uint64 k_ROW_SEEDS[] = {
+    // Seeds of the hash functions of the rows of 'Cache_FrequencySketch'.
+
+    0x97CB3127A9F3D5B1ULL,
+    0xB492B66FBE98F273ULL,
+    0x9AE16A3B2F90404FULL,
+    0xCBF29CE484222325ULL
+};
+
+const bsl::size_t k_MAX_CAPACITY = 1 << 22;  // maximum capacity taken into
+                                             // account when sizing a
+                                             // 'Cache_FrequencySketch'
+
+const bsl::size_t k_MIN_CAPACITY = 16;       // minimum capacity taken into
+                                             // account when sizing a
+                                             // 'Cache_FrequencySketch'
+
+}  // close unnamed namespace
+
+                        // --------------------------
+                        // class Cache_LookupCounters
+                        // --------------------------
+
+// CREATORS
+Cache_LookupCounters::Cache_LookupCounters(bslma::Allocator *basicAllocator)
+: d_buffer_p(0)
+, d_cells_p(0)
+, d_cellMask(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLMF_ASSERT(sizeof(Cell) == k_CACHE_LINE_SIZE);
+
+    const unsigned int concurrency = bslmt::ThreadUtil::hardwareConcurrency();
+
+    int numCells = 1;
+    while (numCells < k_MAX_NUM_CELLS
+        && static_cast<unsigned int>(numCells) < concurrency) {
+        numCells *= 2;
+    }
+
+    d_buffer_p = d_allocator_p->allocate(numCells * sizeof(Cell)
+                                         + k_CACHE_LINE_SIZE - 1);
+
+    char *cells = static_cast<char *>(d_buffer_p)
+                + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                            d_buffer_p,
+                                                            k_CACHE_LINE_SIZE);
+
+    d_cells_p  = reinterpret_cast<Cell *>(cells);
+    d_cellMask = numCells - 1;
+
+    BSLS_ASSERT(0 == reinterpret_cast<bsls::Types::UintPtr>(d_cells_p)
+                                                         % k_CACHE_LINE_SIZE);
+
+    for (int i = 0; i < numCells; ++i) {
+        new (d_cells_p + i) Cell();
+    }
+}
+
+Cache_LookupCounters::~Cache_LookupCounters()
+{
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+// ACCESSORS
+bsls::Types::Uint64 Cache_LookupCounters::numHits() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (int i = 0; i <= d_cellMask; ++i) {
+        result += d_cells_p[i].d_numHits.loadRelaxed();
+    }
+    return result;
+}
+
+bsls::Types::Uint64 Cache_LookupCounters::numMisses() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (int i = 0; i <= d_cellMask; ++i) {
+        result += d_cells_p[i].d_numMisses.loadRelaxed();
+    }
+    return result;
+}
+
+                        // ---------------------------
+                        // class Cache_FrequencySketch
+                        // ---------------------------
+
+// PRIVATE ACCESSORS
+bsl::size_t Cache_FrequencySketch::index(bsl::size_t hash, int row) const
+{
+    // Each row uses a different multiplicative hash of 'hash', so that keys
+    // colliding in one row are unlikely to collide in the others.
+
+    bsls::Types::Uint64 h = (static_cast<bsls::Types::Uint64>(hash) +
+                                             k_ROW_SEEDS[row]) *
+                                                  0x9E3779B97F4A7C15ULL;
+    h ^= h >> 32;
+
+    return row * d_width + (static_cast<bsl::size_t>(h) & (d_width - 1));
+}
+
+// CREATORS
+Cache_FrequencySketch::Cache_FrequencySketch(bsl::size_t       capacity,
+                                             bslma::Allocator *basicAllocator)
+: d_counters(basicAllocator)
+, d_width(0)
+, d_numIncrements(0)
+, d_sampleSize(0)
+{
+    if (0 == capacity) {
+        return;                                                       // RETURN
+    }
+
+    if (capacity < k_MIN_CAPACITY) {
+        capacity = k_MIN_CAPACITY;
+    }
+    else if (capacity > k_MAX_CAPACITY) {
+        capacity = k_MAX_CAPACITY;
+    }
+
+    // Each row has at least 4 counters per item of the cache, and the
+    // counters are aged after 10 increments per item, so that the counters
+    // are incremented at most 2.5 times on average, due to collisions, between
+    // agings.
+
+    d_width      = bdlb::BitUtil::roundUpToBinaryPower(
+                           static_cast<bdlb::BitUtil::uint32_t>(4 * capacity));
+    d_sampleSize = 10 * capacity;
+    d_counters.resize(k_DEPTH * d_width, 0);
+}
+
+// MANIPULATORS
+void Cache_FrequencySketch::clear()
+{
+    bsl::fill(d_counters.begin(), d_counters.end(), 0);
+    d_numIncrements = 0;
+}
+
+void Cache_FrequencySketch::increment(bsl::size_t hash)
+{
+    if (0 == d_width) {
+        return;                                                       // RETURN
+    }
+
+    // Conservative update: only the counters equal to the minimum (i.e., to
+    // the current estimate) are incremented, which reduces the overestimation
+    // due to collisions.
+
+    bsl::size_t indices[k_DEPTH];
+    int         minimum = k_MAX_COUNTER;
+    for (int row = 0; row < k_DEPTH; ++row) {
+        indices[row] = index(hash, row);
+        if (d_counters[indices[row]] < minimum) {
+            minimum = d_counters[indices[row]];
+        }
+    }
+
+    if (k_MAX_COUNTER == minimum) {
+        return;                                                       // RETURN
+    }
+
+    for (int row = 0; row < k_DEPTH; ++row) {
+        if (minimum == d_counters[indices[row]]) {
+            ++d_counters[indices[row]];
+        }
+    }
+
+    if (++d_numIncrements >= d_sampleSize) {
+        // Age the counters, so that the estimates reflect recent accesses.
+
+        for (bsl::size_t i = 0; i < d_counters.size(); ++i) {
+            d_counters[i] = static_cast<unsigned char>(d_counters[i] >> 1);
+        }
+        d_numIncrements /= 2;
+    }
+}
+
+// ACCESSORS
+int Cache_FrequencySketch::frequency(bsl::size_t hash) const
+{
+    if (0 == d_width) {
+        return 0;                                                     // RETURN
+    }
+
+    int minimum = k_MAX_COUNTER;
+    for (int row = 0; row < k_DEPTH; ++row) {
+        const int counter = d_counters[index(hash, row)];
+        if (counter < minimum) {
+            minimum = counter;
+        }
+    }
+    return minimum;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2017 Bloomberg Finance L.P.
 //
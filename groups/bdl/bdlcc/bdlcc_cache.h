@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlcc::Cache: in-process key-value cache
+//  bdlcc::CacheEvictionPolicy: enumeration of cache eviction policies
 //
 //@DESCRIPTION: This component defines a single class template, 'bdlcc::Cache',
 // implementing a thread-safe in-memory key-value cache with a configurable
@@ -27,11 +28,35 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
-// order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// Five eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), CLOCK, SLRU (Segmented LRU), and TinyLFU.  With LRU,
+// the item that has *not* been
+// accessed for the longest period of time will be evicted first.  With FIFO,
+// the eviction order is based on the order of insertion, with the earliest
+// inserted item being evicted first.  CLOCK (also known as "second chance") is
+// an approximation of LRU: items are kept in insertion order, and an access
+// merely marks the item as referenced; when an item is considered for
+// eviction and is marked as referenced, the mark is cleared and the item is
+// moved to the back of the eviction queue instead of being evicted.
+//
+// SLRU and TinyLFU take the frequency of accesses into account, so that a
+// scan (e.g., a reload of reference data touching every key once) does not
+// flush the frequently accessed items from the cache, as it would with LRU.
+// With SLRU, the eviction queue is split into two LRU segments: new items are
+// inserted into the *probationary* segment, and an item accessed while in the
+// probationary segment is moved to the *protected* segment.  The protected
+// segment holds at most 80% of the high watermark, its least recently used
+// items being moved back to the probationary segment as needed, and items are
+// evicted from the probationary segment first.  TinyLFU (more exactly,
+// W-TinyLFU) adds a small LRU *admission window*, holding 1% of the high
+// watermark, in front of the SLRU segments: new items are inserted into the
+// window, and once the cache is full, an item leaving the window is admitted
+// into the probationary segment only if it was accessed more frequently than
+// the item that would be evicted to make room for it, and is evicted
+// otherwise.  The access frequencies are estimated by a compact count-min
+// sketch of the recent lookups and insertions of keys (including lookups of
+// keys that are not in the cache), whose counters are periodically halved so
+// that the estimates favor recent accesses.
 //
 ///Thread Safety
 ///-------------
@@ -49,10 +74,15 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the 'tryGetValue' method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means 'tryGetValue'
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument 'modifyEvictionQueue' is set to 'false'.  For limited cases where
-// contention is likely, temporarily setting 'modifyEvictionQueue' to 'false'
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO or CLOCK, or
+// the argument 'modifyEvictionQueue' is set to 'false'; note that SLRU and
+// TinyLFU, like LRU, require a write lock.  For limited cases
+// where contention is likely, temporarily setting 'modifyEvictionQueue' to
+// 'false' might be of value.  Where contention on reads is the norm (e.g., a
+// cache read by many threads), the CLOCK eviction policy retains most of the
+// benefit of LRU while allowing concurrent 'tryGetValue' calls; contention
+// can be further reduced by partitioning the cache into independently locked
+// stripes (see 'bdlcc_stripedcache').
 //
 // The 'visit' method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -65,6 +95,28 @@ BSLS_IDENT("$Id: $")
 // quickly, or if the visitor returns false after only a subset of the cache
 // items were processed.
 //
+///Statistics
+///----------
+// The cache counts the calls to 'tryGetValue' that found the requested key
+// ('numHits') and that did not ('numMisses'), and the items evicted by the
+// eviction policy ('numEvictions'), i.e., by 'insert' (once the high watermark
+// is reached) and 'popFront', but not by 'erase', 'eraseBulk', or 'clear'.
+// The counters are never reset: the effect of a change (e.g., of the eviction
+// policy or the watermarks) is measured by the difference of their values
+// over a period of time.  The counters are updated atomically, and can be read
+// at any time without locking the cache.
+//
+// So that the lookups of a cache by multiple threads holding the same read
+// lock (e.g., using the CLOCK eviction policy) do not contend for a shared
+// cache line, 'numHits' and 'numMisses' are striped across cells of one cache
+// line (64 bytes) each, one per concurrent thread supported by the host (see
+// 'bslmt::ThreadUtil::hardwareConcurrency'), rounded up to a power of two,
+// but at most 16.  A lookup updates the cell selected by a hash of the id of
+// the calling thread.  The cells are allocated, from the allocator supplied at
+// construction, as a single block aligned on a cache line, so that a cache
+// allocates between 127 and 1087 bytes for these counters.  'numEvictions',
+// which is updated only while the write lock is held, is not striped.
+//
 ///Post-eviction Callback and Potential Deadlocks
 ///---------------------------------------------
 // When an item is evicted or erased from the cache, the previously set
@@ -88,7 +140,8 @@ BSLS_IDENT("$Id: $")
 // +----------------------------------------------------+--------------------+
 // | tryGetValue                                        | O[1]               |
 // +----------------------------------------------------+--------------------+
-// | popFront                                           | O[1]               |
+// | popFront                                           | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
 // +----------------------------------------------------+--------------------+
 // | erase                                              | O[1]               |
 // +----------------------------------------------------+--------------------+
@@ -294,9 +347,12 @@ BSLS_IDENT("$Id: $")
 //  }
 //..
 
+#include <bdlscm_version.h>
+
 #include <bslim_printer.h>
 
 #include <bslma_allocator.h>
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_allocatorargt.h>
@@ -305,10 +361,13 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_readerwritermutex.h>
 #include <bslmt_readlockguard.h>
+#include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_memory.h>
 #include <bsl_map.h>
@@ -329,9 +388,158 @@ struct CacheEvictionPolicy {
     enum Enum {
         // Enumeration of supported cache eviction policies.
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,     // Least Recently Used
+        e_FIFO,    // First In, First Out
+        e_CLOCK,   // CLOCK (second chance) approximation of LRU
+        e_SLRU,    // Segmented LRU
+        e_TINYLFU  // Window TinyLFU (SLRU with frequency-based admission)
+    };
+};
+
+class Cache_FrequencySketch {
+    // This class implements a count-min sketch estimating the frequency of
+    // occurrence of hash values, used by the TinyLFU eviction policy of
+    // 'Cache'.  The sketch holds 'k_DEPTH' rows of counters saturating at
+    // 15; a hash value is mapped to one counter in each row, and its
+    // estimated frequency is the minimum of these counters.  Once the number
+    // of increments reaches 10 times the capacity of the sketch, all the
+    // counters are halved, so that the estimates reflect the recent history.
+
+    // PRIVATE TYPES
+    enum {
+        k_DEPTH       = 4,   // number of rows of counters
+        k_MAX_COUNTER = 15   // saturation value of the counters
     };
+
+    // DATA
+    bsl::vector<unsigned char> d_counters;       // 'k_DEPTH' rows of
+                                                 // 'd_width' counters
+
+    bsl::size_t                d_width;          // number of counters in a
+                                                 // row (a power of 2, or 0)
+
+    bsl::size_t                d_numIncrements;  // number of increments
+                                                 // since the last aging (less
+                                                 // half of the increments
+                                                 // before it)
+
+    bsl::size_t                d_sampleSize;     // number of increments
+                                                 // triggering an aging
+
+    // PRIVATE ACCESSORS
+    bsl::size_t index(bsl::size_t hash, int row) const;
+        // Return the index in 'd_counters' of the counter of the specified
+        // 'row' corresponding to the specified 'hash'.
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_FrequencySketch(const Cache_FrequencySketch&);
+    Cache_FrequencySketch& operator=(const Cache_FrequencySketch&);
+
+  public:
+    // CREATORS
+    explicit Cache_FrequencySketch(bsl::size_t       capacity,
+                                   bslma::Allocator *basicAllocator = 0);
+        // Create a sketch suitable for estimating the frequency of the keys of
+        // a cache holding up to the specified 'capacity' items.  If
+        // 'capacity' is 0, create an empty sketch, for which 'frequency'
+        // always returns 0.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    //! ~Cache_FrequencySketch() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Reset all the counters of this sketch to 0.
+
+    void increment(bsl::size_t hash);
+        // Record an occurrence of the specified 'hash'.
+
+    // ACCESSORS
+    int frequency(bsl::size_t hash) const;
+        // Return the estimated number of recent occurrences of the specified
+        // 'hash', in the range '[0 .. 15]'.
+};
+
+class Cache_LookupCounters {
+    // This class implements the counters of the lookups of 'Cache' that found
+    // the requested key (hits) and that did not (misses).  The counters are
+    // striped across cells of one cache line each, and a thread updates the
+    // cell selected by a hash of its thread id, so that lookups by different
+    // threads, which may hold the same read lock on the cache, typically do
+    // not write to the same cache line.  The number of cells is the number of
+    // concurrent threads supported by the host, rounded up to a power of two,
+    // but at most 16.
+
+    // PRIVATE TYPES
+    enum {
+        k_CACHE_LINE_SIZE    = 64,                        // assumed size of a
+                                                          // cache line
+
+        k_MAX_NUM_CELLS_LOG2 = 4,                         // log2 of the
+                                                          // maximum number of
+                                                          // cells
+
+        k_MAX_NUM_CELLS      = 1 << k_MAX_NUM_CELLS_LOG2  // maximum number of
+                                                          // cells
+    };
+
+    struct Cell {
+        // This 'struct' holds the counters updated by a subset of the
+        // threads, padded to a cache line.
+
+        // PUBLIC DATA
+        bsls::AtomicUint64 d_numHits;    // number of successful lookups
+        bsls::AtomicUint64 d_numMisses;  // number of failed lookups
+        char               d_padding[k_CACHE_LINE_SIZE
+                                     - 2 * sizeof(bsls::AtomicUint64)];
+                                         // pad to a cache line
+    };
+
+    // DATA
+    void             *d_buffer_p;     // memory holding the cells (owned)
+
+    Cell             *d_cells_p;      // cells, aligned on a cache line
+
+    int               d_cellMask;     // number of cells minus one
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    Cell& cell();
+        // Return a reference providing modifiable access to the cell updated
+        // by the calling thread.
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_LookupCounters(const Cache_LookupCounters&);
+    Cache_LookupCounters& operator=(const Cache_LookupCounters&);
+
+  public:
+    // CREATORS
+    explicit Cache_LookupCounters(bslma::Allocator *basicAllocator = 0);
+        // Create counters of lookups having the value 0.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~Cache_LookupCounters();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void addHit();
+        // Count a successful lookup.
+
+    void addMiss();
+        // Count a failed lookup.
+
+    // ACCESSORS
+    bsls::Types::Uint64 numHits() const;
+        // Return the number of successful lookups counted.
+
+    bsls::Types::Uint64 numMisses() const;
+        // Return the number of failed lookups counted.
 };
 
 template <class KEY>
@@ -398,8 +606,105 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
         // Eviction queue type.
 
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
-        // Value type of the hash map.
+    enum Segment {
+        // Enumeration of the queues holding the keys of the items, in the
+        // order in which they are visited.
+
+        e_WINDOW_QUEUE,     // admission window (TinyLFU only)
+        e_MAIN_QUEUE,       // the only queue of LRU, FIFO, and CLOCK, and the
+                            // probationary segment of SLRU and TinyLFU
+        e_PROTECTED_QUEUE   // protected segment (SLRU and TinyLFU only)
+    };
+
+    struct MapValue {
+        // This 'struct' is the value type of the hash map, holding the value
+        // of an item, the position of its key in the eviction queue and the
+        // queue itself (i.e., the segment), and whether the item has been
+        // accessed since it was last considered for eviction (CLOCK eviction
+        // policy only).
+
+        // DATA
+        ValuePtrType                 d_valuePtr;    // value of the item
+
+        typename QueueType::iterator d_queueIt;     // position of the key in
+                                                    // the eviction queue
+
+        Segment                      d_segment;     // queue holding the
+                                                    // key
+
+        mutable bsls::AtomicBool     d_referenced;  // 'true' if accessed
+                                                    // since last considered
+                                                    // for eviction; set with
+                                                    // only a read lock held
+
+        // CREATORS
+        MapValue(const ValuePtrType&                 valuePtr,
+                 const typename QueueType::iterator& queueIt,
+                 Segment                             segment)
+        : d_valuePtr(valuePtr)
+        , d_queueIt(queueIt)
+        , d_segment(segment)
+        , d_referenced(false)
+            // Create a 'MapValue' object holding the specified 'valuePtr',
+            // 'queueIt', and 'segment', and not marked as referenced.
+        {
+        }
+
+        MapValue(bslmf::MovableRef<ValuePtrType>     valuePtr,
+                 const typename QueueType::iterator& queueIt,
+                 Segment                             segment)
+        : d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+        , d_queueIt(queueIt)
+        , d_segment(segment)
+        , d_referenced(false)
+            // Create a 'MapValue' object holding the specified 'valuePtr',
+            // which is left in a valid but unspecified state, 'queueIt', and
+            // 'segment', and not marked as referenced.
+        {
+        }
+
+        MapValue(const MapValue& original)
+        : d_valuePtr(original.d_valuePtr)
+        , d_queueIt(original.d_queueIt)
+        , d_segment(original.d_segment)
+        , d_referenced(original.d_referenced.loadRelaxed())
+            // Create a 'MapValue' object having the same value as the
+            // specified 'original' object.
+        {
+        }
+
+        MapValue(bslmf::MovableRef<MapValue> original)
+        : d_valuePtr(bslmf::MovableRefUtil::move(
+                           bslmf::MovableRefUtil::access(original).d_valuePtr))
+        , d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+        , d_segment(bslmf::MovableRefUtil::access(original).d_segment)
+        , d_referenced(bslmf::MovableRefUtil::access(original)
+                                                 .d_referenced.loadRelaxed())
+            // Create a 'MapValue' object having the same value as the
+            // specified 'original' object, leaving 'original' in a valid but
+            // unspecified state.
+        {
+        }
+    };
+
+    struct SegmentQueues {
+        // This 'struct' holds the queues of the segments of the SLRU and
+        // TinyLFU eviction policies other than the probationary segment.
+
+        // DATA
+        QueueType d_windowQueue;     // admission window (TinyLFU only)
+
+        QueueType d_protectedQueue;  // protected segment
+
+        // CREATORS
+        explicit SegmentQueues(bslma::Allocator *basicAllocator)
+        : d_windowQueue(basicAllocator)
+        , d_protectedQueue(basicAllocator)
+            // Create empty queues using the specified 'basicAllocator' to
+            // supply memory.
+        {
+        }
+    };
 
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
         // Hash map type.
@@ -421,6 +726,18 @@ class Cache {
                                                        // first item to be
                                                        // evicted is at the
                                                        // front of the queue
+                                                       // (for SLRU and
+                                                       // TinyLFU, the
+                                                       // probationary
+                                                       // segment)
+
+    bslma::ManagedPtr<SegmentQueues>
+                               d_segments_mp;          // other segments (SLRU
+                                                       // and TinyLFU only)
+
+    Cache_FrequencySketch      d_sketch;               // frequency of the
+                                                       // recently accessed
+                                                       // keys (TinyLFU only)
 
     CacheEvictionPolicy::Enum  d_evictionPolicy;       // eviction policy
 
@@ -433,15 +750,40 @@ class Cache {
                                                        // starts after an
                                                        // insert
 
+    bsl::size_t                d_windowCapacity;       // maximum size of the
+                                                       // admission window
+                                                       // once this cache is
+                                                       // full
+
+    bsl::size_t                d_protectedCapacity;    // maximum size of the
+                                                       // protected segment
+
     PostEvictionCallback       d_postEvictionCallback; // the function to call
                                                        // after a value has
                                                        // been evicted from the
                                                        // cache
 
+    Cache_LookupCounters       d_lookupCounters;       // numbers of
+                                                       // successful and
+                                                       // failed lookups
+
+    bsls::AtomicUint64         d_numEvictions;         // number of items
+                                                       // evicted by the
+                                                       // eviction policy
+
     // FRIENDS
     friend class Cache_TestUtil<KEY, VALUE, HASH, EQUAL>;
 
     // PRIVATE MANIPULATORS
+    void createSegments();
+        // Create the queues of the segments other than 'd_queue' if the
+        // eviction policy is SLRU or TinyLFU.
+
+    QueueType& queue(Segment segment);
+        // Return a reference providing modifiable access to the queue of the
+        // specified 'segment'.  The behavior is undefined unless 'segment' is
+        // 'e_MAIN_QUEUE' or the eviction policy is SLRU or TinyLFU.
+
     void enforceHighWatermark();
         // Evict items from this cache if 'size() >= highWatermark()' until
         // 'size() < lowWatermark()' beginning from the front of the eviction
@@ -451,6 +793,28 @@ class Cache {
         // Evict the item at the specified 'mapIt' and invoke the post-eviction
         // callback for that item.
 
+    typename MapType::iterator findEvictionCandidate();
+        // Return an iterator to the item that is the next to be evicted from
+        // this cache.  If the eviction policy is CLOCK, first move each item
+        // at the front of the eviction queue that has been referenced since it
+        // was last considered for eviction to the back of the eviction queue,
+        // clearing its reference mark.  If the eviction policy is TinyLFU and
+        // the admission window holds at least 'd_windowCapacity' items,
+        // return either the least recently used item of the window or, after
+        // admitting that item into the probationary segment, the victim of
+        // the SLRU segments, whichever is estimated to be the least frequently
+        // accessed.  The behavior is undefined if this cache is empty.
+
+    void moveToQueue(const typename MapType::iterator& mapIt,
+                     Segment                           segment);
+        // Move the key of the item at the specified 'mapIt' to the back of the
+        // queue of the specified 'segment'.
+
+    void promote(const typename MapType::iterator& mapIt);
+        // Record an access to the item at the specified 'mapIt' in the
+        // eviction queue according to the eviction policy, which must be LRU,
+        // SLRU, or TinyLFU.
+
     bool insertValuePtrMoveImp(KEY          *key_p,
                                bool          moveKey,
                                ValuePtrType *valuePtr_p,
@@ -577,7 +941,12 @@ class Cache {
     int popFront();
         // Remove the item at the front of the eviction queue.  Invoke the
         // post-eviction callback for the removed item.  Return 0 on success,
-        // and 1 if this cache is empty.
+        // and 1 if this cache is empty.  Note that if the eviction policy is
+        // CLOCK, the items at the front of the eviction queue that have been
+        // referenced since they were last considered for eviction are first
+        // given a second chance, and that if the eviction policy is SLRU or
+        // TinyLFU, the item removed is the item that would be evicted next
+        // (see {'bdlcc_cache'|Description}).
 
     void setPostEvictionCallback(
                              const PostEvictionCallback& postEvictionCallback);
@@ -590,10 +959,18 @@ class Cache {
                     bool                    modifyEvictionQueue = true);
         // Load, into the specified 'value', the value associated with the
         // specified 'key' in this cache.  If the optionally specified
-        // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
-        // move the cached item to the back of the eviction queue.  Return 0 on
-        // success, and 1 if 'key' does not exist in this cache.  Note that a
-        // write lock is acquired only if this queue is modified.
+        // 'modifyEvictionQueue' is 'true', record the access according to
+        // the eviction policy: if the eviction policy is LRU, move the cached
+        // item to the back of the eviction queue, if the eviction policy is
+        // CLOCK, mark the cached item as referenced, and if the eviction
+        // policy is SLRU or TinyLFU, move the cached item to the back of its
+        // segment or to the protected segment (see
+        // {'bdlcc_cache'|Description}) and, for TinyLFU, record the access
+        // (even if 'key' does not exist in this cache) in the frequency
+        // sketch.  Return 0 on success, and 1 if 'key' does not exist in this
+        // cache.  Note that a write lock is acquired only if the eviction
+        // queue is modified (i.e., the eviction policy is LRU, SLRU, or
+        // TinyLFU and 'modifyEvictionQueue' is 'true').
 
     // ACCESSORS
     EQUAL equalFunction() const;
@@ -616,6 +993,28 @@ class Cache {
         // Return the low watermark of this cache, which is the size at which
         // eviction of existing items ends.
 
+    bsls::Types::Uint64 numEvictions() const;
+        // Return the number of items evicted from this cache by its eviction
+        // policy (i.e., by 'insert', 'insertBulk', and 'popFront') since its
+        // creation.  Note that the items removed by 'erase', 'eraseBulk', and
+        // 'clear' are not counted.
+
+    bsls::Types::Uint64 numHits() const;
+        // Return the number of calls to 'tryGetValue' on this cache that found
+        // the requested key since its creation.  Note that this method sums
+        // the counts of up to 16 cells (one cache line each, see
+        // {Statistics}), so that 'tryGetValue' does not write to a cache line
+        // shared by all threads, and that a value read while lookups are in
+        // progress may or may not include those lookups.
+
+    bsls::Types::Uint64 numMisses() const;
+        // Return the number of calls to 'tryGetValue' on this cache that did
+        // not find the requested key since its creation.  Note that this
+        // method sums the counts of up to 16 cells (one cache line each, see
+        // {Statistics}), so that 'tryGetValue' does not write to a cache line
+        // shared by all threads, and that a value read while lookups are in
+        // progress may or may not include those lookups.
+
     bsl::size_t size() const;
         // Return the current size of this cache.
 
@@ -623,8 +1022,11 @@ class Cache {
     void visit(VISITOR& visitor) const;
         // Call the specified 'visitor' for every item stored in this cache in
         // the order of the eviction queue until 'visitor' returns 'false'.
-        // The 'VISITOR' type must be a callable object that can be invoked in
-        // the same way as the function 'bool (const KEY&, const VALUE&)'
+        // If the eviction policy is SLRU or TinyLFU, the items of the
+        // admission window, of the probationary segment, and then of the
+        // protected segment are visited, in the order of each.  The 'VISITOR'
+        // type must be a callable object that can be invoked in the same way
+        // as the function 'bool (const KEY&, const VALUE&)'
 };
 
 template <class KEY,
@@ -664,6 +1066,40 @@ class Cache_TestUtil {
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                        // --------------------------
+                        // class Cache_LookupCounters
+                        // --------------------------
+
+// PRIVATE MANIPULATORS
+inline
+Cache_LookupCounters::Cell& Cache_LookupCounters::cell()
+{
+    // Thread identifiers are typically aligned addresses sharing their
+    // low-order bits, so use the high-order bits of a multiplicative hash of
+    // the identifier.
+
+    const bsls::Types::Uint64 k_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                   * k_MULTIPLIER;
+
+    return d_cells_p[static_cast<int>(hash >> (64 - k_MAX_NUM_CELLS_LOG2))
+                                                                & d_cellMask];
+}
+
+// MANIPULATORS
+inline
+void Cache_LookupCounters::addHit()
+{
+    cell().d_numHits.addRelaxed(1);
+}
+
+inline
+void Cache_LookupCounters::addMiss()
+{
+    cell().d_numMisses.addRelaxed(1);
+}
+
                         // ------------------------
                         // class Cache_QueueProctor
                         // ------------------------
@@ -714,10 +1150,15 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(bslma::Allocator *basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_sketch(0, d_allocator_p)
 , d_evictionPolicy(CacheEvictionPolicy::e_LRU)
 , d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
 , d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_windowCapacity(0)
+, d_protectedCapacity(d_highWatermark - d_highWatermark / 5)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+, d_lookupCounters(d_allocator_p)
+, d_numEvictions(0)
 {
 }
 
@@ -730,14 +1171,23 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_sketch(CacheEvictionPolicy::e_TINYLFU == evictionPolicy ? highWatermark
+                                                            : 0,
+           d_allocator_p)
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
+, d_windowCapacity(highWatermark / 100 ? highWatermark / 100 : 1)
+, d_protectedCapacity(highWatermark - highWatermark / 5)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+, d_lookupCounters(d_allocator_p)
+, d_numEvictions(0)
 {
     BSLS_REVIEW(lowWatermark <= highWatermark);
     BSLS_REVIEW(1 <= lowWatermark);
     BSLS_REVIEW(1 <= highWatermark);
+
+    createSegments();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -751,17 +1201,54 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(0, hashFunction, equalFunction, d_allocator_p)
 , d_queue(d_allocator_p)
+, d_sketch(CacheEvictionPolicy::e_TINYLFU == evictionPolicy ? highWatermark
+                                                            : 0,
+           d_allocator_p)
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
+, d_windowCapacity(highWatermark / 100 ? highWatermark / 100 : 1)
+, d_protectedCapacity(highWatermark - highWatermark / 5)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+, d_lookupCounters(d_allocator_p)
+, d_numEvictions(0)
 {
     BSLS_REVIEW(lowWatermark <= highWatermark);
     BSLS_REVIEW(1 <= lowWatermark);
     BSLS_REVIEW(1 <= highWatermark);
+
+    createSegments();
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::createSegments()
+{
+    // The other segments are allocated only if needed, so that the memory
+    // footprint of a cache using another eviction policy is not increased.
+
+    if (CacheEvictionPolicy::e_SLRU    == d_evictionPolicy ||
+        CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+        d_segments_mp.load(new (*d_allocator_p) SegmentQueues(d_allocator_p),
+                           d_allocator_p);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename Cache<KEY, VALUE, HASH, EQUAL>::QueueType&
+Cache<KEY, VALUE, HASH, EQUAL>::queue(Segment segment)
+{
+    if (e_MAIN_QUEUE == segment) {
+        return d_queue;                                               // RETURN
+    }
+
+    BSLS_ASSERT(d_segments_mp);
+
+    return e_WINDOW_QUEUE == segment ? d_segments_mp->d_windowQueue
+                                     : d_segments_mp->d_protectedQueue;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
 {
@@ -770,9 +1257,8 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(findEvictionCandidate());
+        d_numEvictions.addRelaxed(1);
     }
 }
 
@@ -780,15 +1266,121 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
 
-    d_queue.erase(mapIt->second.second);
+    queue(mapIt->second.d_segment).erase(mapIt->second.d_queueIt);
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
         d_postEvictionCallback(value);
     }
 }
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::findEvictionCandidate()
+{
+    BSLS_ASSERT(!d_map.empty());
+
+    if (d_segments_mp) {
+        QueueType& windowQueue = d_segments_mp->d_windowQueue;
+        QueueType& mainQueue   = d_queue.empty()
+                               ? d_segments_mp->d_protectedQueue
+                               : d_queue;
+
+        if (mainQueue.empty()) {
+            return d_map.find(windowQueue.front());                   // RETURN
+        }
+
+        const typename MapType::iterator victimIt =
+                                                 d_map.find(mainQueue.front());
+        BSLS_ASSERT(victimIt != d_map.end());
+
+        if (windowQueue.size() < d_windowCapacity) {
+            return victimIt;                                          // RETURN
+        }
+
+        // The admission window is full (and, if this eviction is made to
+        // insert an item, is about to overflow): its least recently used item
+        // is admitted into the probationary segment only if it is estimated
+        // to be accessed more frequently than the victim.
+
+        const typename MapType::iterator candidateIt =
+                                              d_map.find(windowQueue.front());
+        BSLS_ASSERT(candidateIt != d_map.end());
+
+        const HASH hasher = d_map.hash_function();
+        const int  candidateFrequency =
+                                d_sketch.frequency(hasher(candidateIt->first));
+        const int  victimFrequency =
+                                   d_sketch.frequency(hasher(victimIt->first));
+
+        if (candidateFrequency <= victimFrequency) {
+            return candidateIt;                                       // RETURN
+        }
+
+        moveToQueue(candidateIt, e_MAIN_QUEUE);
+        return victimIt;                                              // RETURN
+    }
+
+    while (true) {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        if (CacheEvictionPolicy::e_CLOCK != d_evictionPolicy
+         || !mapIt->second.d_referenced.loadRelaxed()) {
+            return mapIt;                                             // RETURN
+        }
+
+        // Give the item a second chance.  As its reference mark is cleared,
+        // this loop terminates after at most one pass through the queue.
+
+        mapIt->second.d_referenced.storeRelaxed(false);
+        d_queue.splice(d_queue.end(), d_queue, d_queue.begin());
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void Cache<KEY, VALUE, HASH, EQUAL>::moveToQueue(
+                                     const typename MapType::iterator& mapIt,
+                                     Segment                           segment)
+{
+    MapValue& mapValue = mapIt->second;
+
+    queue(segment).splice(queue(segment).end(),
+                          queue(mapValue.d_segment),
+                          mapValue.d_queueIt);
+    mapValue.d_segment = segment;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::promote(
+                                       const typename MapType::iterator& mapIt)
+{
+    if (e_MAIN_QUEUE != mapIt->second.d_segment
+     || CacheEvictionPolicy::e_LRU == d_evictionPolicy) {
+        moveToQueue(mapIt, mapIt->second.d_segment);
+        return;                                                       // RETURN
+    }
+
+    // An item of the probationary segment is moved to the protected segment,
+    // demoting the least recently used items of the protected segment to the
+    // probationary segment if it is full.
+
+    QueueType& protectedQueue = d_segments_mp->d_protectedQueue;
+
+    moveToQueue(mapIt, e_PROTECTED_QUEUE);
+
+    while (protectedQueue.size() > d_protectedCapacity) {
+        const typename MapType::iterator demotedIt =
+                                            d_map.find(protectedQueue.front());
+        BSLS_ASSERT(demotedIt != d_map.end());
+
+        moveToQueue(demotedIt, e_MAIN_QUEUE);
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
@@ -811,24 +1403,42 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        if (d_segments_mp) {
+            // Replacing the value of an item is an access to the item.
 
-        // Move 'queueIt' to the back of 'd_queue'.
+            if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+                d_sketch.increment(d_map.hash_function()(key));
+            }
+            promote(mapIt);
+        }
+        else {
+            // Move the key to the back of 'd_queue'.
 
-        d_queue.splice(d_queue.end(), d_queue, queueIt);
+            d_queue.splice(d_queue.end(), d_queue, mapIt->second.d_queueIt);
+        }
 
         return false;                                                 // RETURN
     }
     else {
-        Cache_QueueProctor<KEY>      proctor(&d_queue);
-        d_queue.push_back(key);
-        typename QueueType::iterator queueIt = d_queue.end();
+        const Segment segment =
+                        CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy
+                        ? e_WINDOW_QUEUE
+                        : e_MAIN_QUEUE;
+        QueueType&    targetQueue = queue(segment);
+
+        if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+            d_sketch.increment(d_map.hash_function()(key));
+        }
+
+        Cache_QueueProctor<KEY>      proctor(&targetQueue);
+        targetQueue.push_back(key);
+        typename QueueType::iterator queueIt = targetQueue.end();
         --queueIt;
 
         bsls::ObjectBuffer<MapValue> mapValueFootprint;
@@ -837,12 +1447,10 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
                                       queueIt,
-                                      d_allocator_p);
+                                      segment);
         }
         else {
-            new (mapValue_p) MapValue(valuePtr,
-                                      queueIt,
-                                      d_allocator_p);
+            new (mapValue_p) MapValue(valuePtr, queueIt, segment);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
@@ -857,6 +1465,19 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         proctor.release();
 
+        // Until this cache is about to be full, the items overflowing the
+        // admission window are admitted into the probationary segment
+        // unconditionally.
+
+        if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+            QueueType& windowQueue = d_segments_mp->d_windowQueue;
+
+            while (windowQueue.size() > d_windowCapacity
+                && d_map.size() < d_lowWatermark) {
+                moveToQueue(d_map.find(windowQueue.front()), e_MAIN_QUEUE);
+            }
+        }
+
         return true;                                                  // RETURN
     }
 }
@@ -909,6 +1530,11 @@ void Cache<KEY, VALUE, HASH, EQUAL>::clear()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
     d_map.clear();
     d_queue.clear();
+    if (d_segments_mp) {
+        d_segments_mp->d_windowQueue.clear();
+        d_segments_mp->d_protectedQueue.clear();
+    }
+    d_sketch.clear();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -1072,9 +1698,8 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictItem(findEvictionCandidate());
+        d_numEvictions.addRelaxed(1);
         return 0;                                                     // RETURN
     }
 
@@ -1095,7 +1720,9 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
                                    const KEY&              key,
                                    bool                    modifyEvictionQueue)
 {
-    int writeLock = d_evictionPolicy == CacheEvictionPolicy::e_LRU &&
+    int writeLock = (d_evictionPolicy == CacheEvictionPolicy::e_LRU  ||
+                     d_evictionPolicy == CacheEvictionPolicy::e_SLRU ||
+                     d_evictionPolicy == CacheEvictionPolicy::e_TINYLFU) &&
          modifyEvictionQueue ? 1 : 0;
     if (writeLock) {
         d_rwlock.lockWrite();
@@ -1110,19 +1737,34 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
 
     bslmt::ReadLockGuard<LockType> guard(&d_rwlock, true);
 
+    if (writeLock && d_evictionPolicy == CacheEvictionPolicy::e_TINYLFU) {
+        // The frequency of lookups of keys not in the cache is recorded too,
+        // so that a key is admitted if it is in demand.
+
+        d_sketch.increment(d_map.hash_function()(key));
+    }
+
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt == d_map.end()) {
+        d_lookupCounters.addMiss();
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    d_lookupCounters.addHit();
+
+    *value = mapIt->second.d_valuePtr;
 
     if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
-        typename QueueType::iterator last = d_queue.end();
-        --last;
-        if (last != queueIt) {
-            d_queue.splice(d_queue.end(), d_queue, queueIt);
+        promote(mapIt);
+    }
+    else if (d_evictionPolicy == CacheEvictionPolicy::e_CLOCK &&
+             modifyEvictionQueue) {
+        // Only a read lock is held: the reference mark is an atomic flag, and
+        // it is not stored if it is already set to avoid needlessly
+        // contending for its cache line.
+
+        if (!mapIt->second.d_referenced.loadRelaxed()) {
+            mapIt->second.d_referenced.storeRelaxed(true);
         }
     }
 
@@ -1166,6 +1808,27 @@ bsl::size_t Cache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
     return d_lowWatermark;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64 Cache<KEY, VALUE, HASH, EQUAL>::numEvictions() const
+{
+    return d_numEvictions.loadRelaxed();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64 Cache<KEY, VALUE, HASH, EQUAL>::numHits() const
+{
+    return d_lookupCounters.numHits();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64 Cache<KEY, VALUE, HASH, EQUAL>::numMisses() const
+{
+    return d_lookupCounters.numMisses();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t Cache<KEY, VALUE, HASH, EQUAL>::size() const
@@ -1180,16 +1843,28 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
 {
     bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
 
-    for (typename QueueType::const_iterator queueIt = d_queue.begin();
-         queueIt != d_queue.end(); ++queueIt) {
+    const QueueType *const queues[] = {
+        d_segments_mp ? &d_segments_mp->d_windowQueue    : 0,
+        &d_queue,
+        d_segments_mp ? &d_segments_mp->d_protectedQueue : 0
+    };
 
-        const KEY&                             key = *queueIt;
-        const typename MapType::const_iterator mapIt = d_map.find(key);
-        BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+    for (int i = 0; i < 3; ++i) {
+        if (!queues[i]) {
+            continue;
+        }
+
+        for (typename QueueType::const_iterator queueIt = queues[i]->begin();
+             queueIt != queues[i]->end(); ++queueIt) {
+
+            const KEY&                             key = *queueIt;
+            const typename MapType::const_iterator mapIt = d_map.find(key);
+            BSLS_ASSERT(mapIt != d_map.end());
+            const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
-        if (!visitor(key, *valuePtr)) {
-            break;
+            if (!visitor(key, *valuePtr)) {
+                return;                                               // RETURN
+            }
         }
     }
 }
@@ -117,6 +117,9 @@ using namespace bsl;
 // [ 4] CacheEvictionPolicy::Enum evictionPolicy() const;
 // [ 4] bsl::size_t highWatermark() const;
 // [ 4] bsl::size_t lowWatermark() const;
+// [21] bsls::Types::Uint64 numEvictions() const;
+// [21] bsls::Types::Uint64 numHits() const;
+// [21] bsls::Types::Uint64 numMisses() const;
 // [ 4] bsl::size_t size() const;
 // [ 4] HASH hashFunction() const;
 // [ 4] EQUAL equalFunction() const;
@@ -128,7 +131,10 @@ using namespace bsl;
 // [15] THREAD SAFETY
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
-// [18] USAGE EXAMPLE
+// [19] CLOCK EVICTION POLICY
+// [20] SLRU AND TINYLFU EVICTION POLICIES
+// [21] STATISTICS
+// [22] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
@@ -1343,6 +1349,11 @@ void testLocking()
     //:   eviction policy, run 'tryGetValue' and measure how long it took to
     //:   complete.  It should be less than sec.
     //:
+    //:14 Spawn a thread that calls 'lockRead', sleep for 0.1sec, and calls
+    //:   'unlock'.  On the main thread, use a 'bdlcc:Cache' object with CLOCK
+    //:   eviction policy, run 'tryGetValue' and measure how long it took to
+    //:   complete.  It should be less than sec.
+    //:
     // Testing:
     //   void insert(const KEYTYPE& key, const VALUETYPE& value);
     //   void insert(const KEYTYPE& key, const ValuePtrType& valuePtr);
@@ -1621,6 +1632,30 @@ void testLocking()
         ASSERT(duration < k_SLEEP_PERIOD / 2);
     }
 
+    CacheType          clockCache(bdlcc::CacheEvictionPolicy::e_CLOCK, 10, 20,
+                                                                      &talloc);
+    Cache_TestUtilType clockCache_TestUtil(clockCache);
+    ThreadData         tdClockRead(&clockCache_TestUtil, k_SLEEP_PERIOD, 'R');
+
+    clockCache.insert(8, "eight");
+
+    // LockRead / tryGetValue, CLOCK
+    {
+        bslmt::ThreadUtil::create(&handle, workThread, &tdClockRead);
+        smp.wait();
+        // Time the duration how long it took to run 'tryGetValue'
+        TimeType startTime = bsls::TimeUtil::getTimer();
+
+        bsl::shared_ptr<bsl::string> valuePtr;
+        int                          rc = clockCache.tryGetValue(&valuePtr, 8);
+        ASSERT(0 == rc);
+
+        TimeType endTime = bsls::TimeUtil::getTimer();
+        int      duration = static_cast<int>((endTime - startTime) / 1000);
+        bslmt::ThreadUtil::join(handle, &result);
+
+        ASSERT(duration < k_SLEEP_PERIOD / 2);
+    }
 }
 }  // close namespace testLock
 
@@ -1746,6 +1781,81 @@ void threadedTest1()
 
 }  // close namespace threaded
 
+namespace clockTest {
+
+typedef bdlcc::Cache<int, int> ClockCache;
+
+struct EvictionRecorder {
+    // This 'struct' provides a post-eviction callback recording the values
+    // of the evicted items.
+
+    // DATA
+    bsl::vector<int> *d_log_p;  // evicted values (held, not owned)
+
+    // ACCESSORS
+    void operator()(const ClockCache::ValuePtrType& value) const
+        // Append the specified 'value' to the log.
+    {
+        d_log_p->push_back(*value);
+    }
+};
+
+struct OrderVisitor {
+    // This 'struct' provides a visitor recording the values of the visited
+    // items.
+
+    // DATA
+    bsl::vector<int> *d_values_p;  // visited values (held, not owned)
+
+    // ACCESSORS
+    bool operator()(int, int value) const
+        // Append the specified 'value' to the visited values and return
+        // 'true'.
+    {
+        d_values_p->push_back(value);
+        return true;
+    }
+};
+
+bsl::vector<int> evictionOrder(const ClockCache&  cache,
+                               bslma::Allocator  *allocator)
+    // Return the values of the items of the specified 'cache' in the order of
+    // its eviction queue, using the specified 'allocator' to supply memory.
+{
+    bsl::vector<int> result(allocator);
+    OrderVisitor     visitor = { &result };
+    cache.visit(visitor);
+    return result;
+}
+
+}  // close namespace clockTest
+
+namespace statisticsTest {
+
+typedef bdlcc::Cache<int, int> IntCache;
+
+enum {
+    k_NUM_THREADS    = 4,     // number of threads looking up keys
+    k_NUM_ITERATIONS = 10000  // number of lookups of each key by each thread
+};
+
+extern "C" void *lookupThread(void *arg)
+    // Look up, 'k_NUM_ITERATIONS' times each, the key 0, which is expected to
+    // be in the cache at the specified 'arg', and the key -1, which is not,
+    // without modifying the eviction queue.
+{
+    IntCache *cache = static_cast<IntCache *>(arg);
+
+    IntCache::ValuePtrType value;
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        cache->tryGetValue(&value, 0, false);
+        cache->tryGetValue(&value, -1, false);
+    }
+    return 0;
+}
+
+}  // close namespace statisticsTest
+
 // TestDriver template
 namespace {
 
@@ -3802,10 +3912,11 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase2()
             bslma::TestAllocator&  oa = *objAllocatorPtr;
             bslma::TestAllocator& noa = 'c' != CONFIG ? sa : da;
 
-            // Verify allocation from the object/non-object allocators.
+            // Verify allocation from the object/non-object allocators (of the
+            // hash map and of the cells of the lookup counters).
 
             ASSERTV(LENGTH, CONFIG, oa.numBlocksTotal(),
-                    1 ==  oa.numBlocksTotal());
+                    2 ==  oa.numBlocksTotal());
             ASSERTV(LENGTH, CONFIG, noa.numBlocksTotal(),
                     0 == noa.numBlocksTotal());
             ASSERTV(LENGTH, CONFIG, 0          == X.size());
@@ -4163,7 +4274,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 19: {
+      case 22: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4184,6 +4295,610 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 21: {
+        // --------------------------------------------------------------------
+        // STATISTICS
+        //
+        // Concerns:
+        //: 1 The counters are 0 on construction.
+        //:
+        //: 2 'numHits' and 'numMisses' count the calls to 'tryGetValue' that
+        //:   found and did not find the requested key, whatever the value of
+        //:   'modifyEvictionQueue'.
+        //:
+        //: 3 'numEvictions' counts the items evicted by 'insert',
+        //:   'insertBulk', and 'popFront', but not the items removed by
+        //:   'erase', 'eraseBulk', and 'clear'.
+        //:
+        //: 4 The counters are not reset by 'clear'.
+        //:
+        //: 5 The counters behave the same for all the eviction policies.
+        //:
+        //: 6 The lookups performed concurrently by multiple threads are all
+        //:   counted.
+        //
+        // Plan:
+        //: 1 For each eviction policy, perform a sequence of operations on a
+        //:   cache, and verify the values of the counters after each.
+        //:   (C-1..5)
+        //:
+        //: 2 Look up a key in a cache, and a key not in it, from several
+        //:   threads, and verify that 'numHits' and 'numMisses' are the total
+        //:   numbers of these lookups.  (C-6)
+        //
+        // Testing:
+        //   bsls::Types::Uint64 numEvictions() const;
+        //   bsls::Types::Uint64 numHits() const;
+        //   bsls::Types::Uint64 numMisses() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STATISTICS" << endl
+                          << "==========" << endl;
+
+        typedef bdlcc::CacheEvictionPolicy Policy;
+        typedef bdlcc::Cache<int, int>     IntCache;
+
+        static const Policy::Enum POLICIES[] = {
+            Policy::e_LRU,
+            Policy::e_FIFO,
+            Policy::e_CLOCK,
+            Policy::e_SLRU,
+            Policy::e_TINYLFU
+        };
+        const int NUM_POLICIES = static_cast<int>(sizeof POLICIES /
+                                                  sizeof *POLICIES);
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+            const Policy::Enum POLICY = POLICIES[pi];
+
+            IntCache mX(POLICY, 10, 10, &ta);  const IntCache& X = mX;
+
+            ASSERTV(POLICY, 0 == X.numHits());
+            ASSERTV(POLICY, 0 == X.numMisses());
+            ASSERTV(POLICY, 0 == X.numEvictions());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERTV(POLICY, 0 == X.numEvictions());
+
+            IntCache::ValuePtrType value;
+            ASSERTV(POLICY, 0 == mX.tryGetValue(&value, 3));
+            ASSERTV(POLICY, 0 == mX.tryGetValue(&value, 4, false));
+            ASSERTV(POLICY, 1 == mX.tryGetValue(&value, 42));
+            ASSERTV(POLICY, 1 == mX.tryGetValue(&value, 43, false));
+            ASSERTV(POLICY, 0 == mX.tryGetValue(&value, 3));
+
+            ASSERTV(POLICY, X.numHits(),   3 == X.numHits());
+            ASSERTV(POLICY, X.numMisses(), 2 == X.numMisses());
+
+            // Each insertion into a full cache evicts one item.
+
+            mX.insert(10, 10);
+            mX.insert(11, 11);
+            ASSERTV(POLICY, X.numEvictions(), 2 == X.numEvictions());
+
+            bsl::vector<IntCache::KVType> data(&ta);
+            data.push_back(IntCache::KVType(
+                                     12,
+                                     bsl::allocate_shared<int>(&ta, 12)));
+            ASSERTV(POLICY, 1 == mX.insertBulk(data));
+            ASSERTV(POLICY, X.numEvictions(), 3 == X.numEvictions());
+
+            // Removals by 'erase', 'eraseBulk', and 'clear' are not counted.
+
+            ASSERTV(POLICY, 0 == mX.erase(12));
+
+            // Note that, with TinyLFU, some of the recently inserted items
+            // might not have been admitted.
+
+            const bsl::size_t SIZE = X.size();
+            bsl::vector<int>  keys(&ta);
+            keys.push_back(11);
+            keys.push_back(10);
+            keys.push_back(0);
+            const int         NUM_ERASED = mX.eraseBulk(keys);
+            ASSERTV(POLICY, NUM_ERASED, SIZE - NUM_ERASED == X.size());
+            ASSERTV(POLICY, X.numEvictions(), 3 == X.numEvictions());
+
+            ASSERTV(POLICY, 0 == mX.popFront());
+            ASSERTV(POLICY, X.numEvictions(), 4 == X.numEvictions());
+
+            mX.clear();
+            ASSERTV(POLICY, 1 == mX.popFront());
+            ASSERTV(POLICY, X.numEvictions(), 4 == X.numEvictions());
+            ASSERTV(POLICY, X.numHits(),      3 == X.numHits());
+            ASSERTV(POLICY, X.numMisses(),    2 == X.numMisses());
+        }
+
+        if (verbose) cout << "\tConcurrent lookups." << endl;
+        {
+            using namespace statisticsTest;
+
+            IntCache        mX(Policy::e_CLOCK, 10, 10, &ta);
+            const IntCache& X = mX;
+
+            mX.insert(0, 0);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      lookupThread,
+                                                      &mX));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            const bsls::Types::Uint64 EXPECTED = k_NUM_THREADS
+                                               * k_NUM_ITERATIONS;
+
+            ASSERTV(X.numHits(),   EXPECTED == X.numHits());
+            ASSERTV(X.numMisses(), EXPECTED == X.numMisses());
+        }
+      } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // SLRU AND TINYLFU EVICTION POLICIES
+        //
+        // Concerns:
+        //: 1 With the SLRU eviction policy, new items are inserted at the back
+        //:   of the probationary segment, and an item accessed while in the
+        //:   probationary segment is moved to the back of the protected
+        //:   segment, which holds at most 80% of the high watermark, its
+        //:   least recently used items being moved back to the probationary
+        //:   segment.
+        //:
+        //: 2 Items are evicted from the front of the probationary segment,
+        //:   then from the front of the protected segment.
+        //:
+        //: 3 Replacing the value of an item is an access to the item, and a
+        //:   'tryGetValue' with 'modifyEvictionQueue' set to 'false' is not.
+        //:
+        //: 4 The frequency sketch estimates the number of recent occurrences
+        //:   of hash values, saturating at 15, and its counters are halved
+        //:   periodically.  An empty sketch allocates no memory.
+        //:
+        //: 5 With the TinyLFU eviction policy, an item leaving the full
+        //:   admission window is admitted only if its key was accessed (or
+        //:   looked up) more frequently than the key of the victim.
+        //:
+        //: 6 With both policies, a scan of keys accessed only once does not
+        //:   evict the frequently accessed items, unlike with LRU.
+        //
+        // Plan:
+        //: 1 Perform a sequence of operations on an SLRU cache, and verify
+        //:   the evicted items (using a post-eviction callback) and the order
+        //:   of the remaining items (using 'visit').  (C-1..3)
+        //:
+        //: 2 Directly exercise a 'bdlcc::Cache_FrequencySketch'.  (C-4)
+        //:
+        //: 3 Look up an absent key several times in a full TinyLFU cache,
+        //:   insert it and other keys, and verify that only the key looked up
+        //:   is admitted.  (C-5)
+        //:
+        //: 4 For each eviction policy, access a hot set of keys repeatedly,
+        //:   insert many other keys once, and verify which hot keys remain.
+        //:   (C-6)
+        //
+        // Testing:
+        //   CacheEvictionPolicy::e_SLRU
+        //   CacheEvictionPolicy::e_TINYLFU
+        //   Cache_FrequencySketch
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SLRU AND TINYLFU EVICTION POLICIES" << endl
+                          << "==================================" << endl;
+
+        using clockTest::ClockCache;
+        using clockTest::EvictionRecorder;
+        using clockTest::evictionOrder;
+
+        typedef bdlcc::CacheEvictionPolicy Policy;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tSLRU." << endl;
+        {
+            // The protected segment holds at most 4 items.
+
+            ClockCache        mX(Policy::e_SLRU, 5, 5, &ta);
+            const ClockCache& X = mX;
+
+            ASSERT(Policy::e_SLRU == X.evictionPolicy());
+
+            bsl::vector<int> evicted(&ta);
+            EvictionRecorder recorder = { &evicted };
+            mX.setPostEvictionCallback(
+                     ClockCache::PostEvictionCallback(bsl::allocator_arg,
+                                                      &ta,
+                                                      recorder));
+
+            for (int i = 1; i <= 5; ++i) {
+                mX.insert(i, i);
+            }
+
+            // Accessing 1 and 2 protects them; peeking at 3 does not.
+
+            ClockCache::ValuePtrType value;
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+            ASSERT(0 == mX.tryGetValue(&value, 3, false));
+            {
+                static const int EXP[] = { 3, 4, 5, 1, 2 };
+                ASSERT(bsl::vector<int>(EXP, EXP + 5, &ta) ==
+                                                     evictionOrder(X, &ta));
+            }
+
+            // The front of the probationary segment is evicted.
+
+            mX.insert(6, 6);
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(evicted[0], 3 == evicted[0]);
+            {
+                static const int EXP[] = { 4, 5, 6, 1, 2 };
+                ASSERT(bsl::vector<int>(EXP, EXP + 5, &ta) ==
+                                                     evictionOrder(X, &ta));
+            }
+
+            // The protected segment overflows: 1 is demoted.
+
+            ASSERT(0 == mX.tryGetValue(&value, 4));
+            ASSERT(0 == mX.tryGetValue(&value, 5));
+            ASSERT(0 == mX.tryGetValue(&value, 6));
+            {
+                static const int EXP[] = { 1, 2, 4, 5, 6 };
+                ASSERT(bsl::vector<int>(EXP, EXP + 5, &ta) ==
+                                                     evictionOrder(X, &ta));
+            }
+
+            // An access in the protected segment moves the item to its back.
+
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+            {
+                static const int EXP[] = { 1, 4, 5, 6, 2 };
+                ASSERT(bsl::vector<int>(EXP, EXP + 5, &ta) ==
+                                                     evictionOrder(X, &ta));
+            }
+
+            // 'popFront' evicts from the probationary segment, then from the
+            // protected segment.
+
+            ASSERT(0 == mX.popFront());
+            ASSERTV(evicted.size(), 2 == evicted.size());
+            ASSERTV(evicted[1], 1 == evicted[1]);
+
+            ASSERT(0 == mX.popFront());
+            ASSERTV(evicted.size(), 3 == evicted.size());
+            ASSERTV(evicted[2], 4 == evicted[2]);
+            {
+                static const int EXP[] = { 5, 6, 2 };
+                ASSERT(bsl::vector<int>(EXP, EXP + 3, &ta) ==
+                                                     evictionOrder(X, &ta));
+            }
+
+            // Replacing the value of an item of the probationary segment
+            // protects it.
+
+            mX.insert(8, 8);
+            {
+                static const int EXP[] = { 8, 5, 6, 2 };
+                ASSERT(bsl::vector<int>(EXP, EXP + 4, &ta) ==
+                                                     evictionOrder(X, &ta));
+            }
+
+            mX.insert(8, 80);
+            {
+                static const int EXP[] = { 5, 6, 2, 80 };
+                ASSERT(bsl::vector<int>(EXP, EXP + 4, &ta) ==
+                                                     evictionOrder(X, &ta));
+            }
+
+            ASSERT(0 == mX.erase(8));
+            ASSERTV(evicted.size(), 4 == evicted.size());
+            ASSERTV(evicted[3], 80 == evicted[3]);
+
+            mX.clear();
+            ASSERT(0 == X.size());
+            ASSERT(1 == mX.popFront());
+
+            mX.insert(7, 7);
+            ASSERT(1 == X.size());
+            ASSERT(0 == mX.tryGetValue(&value, 7));
+            ASSERT(7 == *value);
+        }
+
+        if (verbose) cout << "\tFrequency sketch." << endl;
+        {
+            bdlcc::Cache_FrequencySketch mX(100, &ta);
+            const bdlcc::Cache_FrequencySketch& X = mX;
+
+            ASSERT(0 == X.frequency(1));
+            ASSERT(0 == X.frequency(2));
+
+            mX.increment(1);
+            mX.increment(1);
+            mX.increment(1);
+            mX.increment(2);
+            ASSERTV(X.frequency(1), 3 == X.frequency(1));
+            ASSERTV(X.frequency(2), 1 == X.frequency(2));
+            ASSERTV(X.frequency(3), 0 == X.frequency(3));
+
+            for (int i = 0; i < 20; ++i) {
+                mX.increment(1);
+            }
+            ASSERTV(X.frequency(1), 15 == X.frequency(1));
+
+            mX.clear();
+            ASSERT(0 == X.frequency(1));
+            ASSERT(0 == X.frequency(2));
+
+            // The counters are halved after 1000 (i.e., 10 times the
+            // capacity) increments.
+
+            for (int i = 0; i < 8; ++i) {
+                mX.increment(7);
+            }
+            for (int i = 0; i < 1000 - 8 - 1; ++i) {
+                mX.increment(1000 + i % 500);
+            }
+            ASSERTV(X.frequency(7), 8 <= X.frequency(7));
+
+            mX.increment(1000);
+            ASSERTV(X.frequency(7), 4 <= X.frequency(7));
+            ASSERTV(X.frequency(7),      X.frequency(7) < 8);
+
+            bslma::TestAllocator         za("empty", veryVeryVeryVerbose);
+            bdlcc::Cache_FrequencySketch mY(0, &za);
+
+            mY.increment(1);
+            ASSERT(0 == mY.frequency(1));
+            ASSERT(0 == za.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\tTinyLFU admission." << endl;
+        {
+            // The admission window holds 1 item.
+
+            ClockCache mX(Policy::e_TINYLFU, 100, 100, &ta);
+            const ClockCache& X = mX;
+
+            ASSERT(Policy::e_TINYLFU == X.evictionPolicy());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERT(100 == X.size());
+
+            // 500 is in demand.
+
+            ClockCache::ValuePtrType value;
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(1 == mX.tryGetValue(&value, 500));
+            }
+
+            for (int key = 500; key < 504; ++key) {
+                mX.insert(key, key);
+                ASSERTV(key, X.size(), 100 == X.size());
+            }
+
+            ASSERT(0 == mX.tryGetValue(&value, 500, false));
+            ASSERT(1 == mX.tryGetValue(&value, 501, false));
+            ASSERT(0 == mX.tryGetValue(&value, 503, false));
+        }
+
+        if (verbose) cout << "\tScan resistance." << endl;
+
+        static const Policy::Enum POLICIES[] = {
+            Policy::e_LRU, Policy::e_SLRU, Policy::e_TINYLFU
+        };
+
+        for (int pi = 0; pi < 3; ++pi) {
+            const Policy::Enum POLICY = POLICIES[pi];
+
+            ClockCache mX(POLICY, 100, 100, &ta);  const ClockCache& X = mX;
+
+            enum { k_NUM_HOT = 50 };
+
+            ClockCache::ValuePtrType value;
+            for (int i = 0; i < k_NUM_HOT; ++i) {
+                mX.insert(i, i);
+            }
+            for (int round = 0; round < 5; ++round) {
+                for (int i = 0; i < k_NUM_HOT; ++i) {
+                    ASSERTV(POLICY, i, 0 == mX.tryGetValue(&value, i));
+                }
+            }
+
+            for (int key = 1000; key < 2000; ++key) {
+                mX.insert(key, key);
+                ASSERTV(POLICY, key, X.size() <= 100);
+            }
+
+            int numHotRemaining = 0;
+            for (int i = 0; i < k_NUM_HOT; ++i) {
+                numHotRemaining += 0 == mX.tryGetValue(&value, i, false);
+            }
+
+            if (veryVerbose) { P_(POLICY) P(numHotRemaining) }
+
+            if (Policy::e_LRU == POLICY) {
+                ASSERTV(numHotRemaining, 0 == numHotRemaining);
+            }
+            else {
+                ASSERTV(POLICY, numHotRemaining, k_NUM_HOT == numHotRemaining);
+            }
+        }
+      } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // CLOCK EVICTION POLICY
+        //
+        // Concerns:
+        //: 1 With the CLOCK eviction policy, items are evicted in insertion
+        //:   order, except that an item accessed by 'tryGetValue' since it
+        //:   was last considered for eviction is moved to the back of the
+        //:   eviction queue instead of being evicted.
+        //:
+        //: 2 A second chance is given only once per access.
+        //:
+        //: 3 'tryGetValue' with 'modifyEvictionQueue' set to 'false' does not
+        //:   mark the item as accessed.
+        //:
+        //: 4 If every item has been accessed, the eviction wraps around to
+        //:   the item that was at the front of the eviction queue.
+        //:
+        //: 5 'popFront' gives the items a second chance in the same way.
+        //:
+        //: 6 'tryGetValue' never modifies the eviction queue.
+        //
+        // Plan:
+        //: 1 Insert items into a CLOCK cache having a fixed maximum size,
+        //:   access some of them using 'tryGetValue', insert more items to
+        //:   trigger eviction, and verify the evicted items (using a
+        //:   post-eviction callback) and the order of the remaining items
+        //:   (using 'visit').  (C-1..5)
+        //:
+        //: 2 Verify that 'tryGetValue' does not change the eviction queue.
+        //:   (C-6)
+        //
+        // Testing:
+        //   CacheEvictionPolicy::e_CLOCK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLOCK EVICTION POLICY" << endl
+                          << "=====================" << endl;
+
+        using clockTest::ClockCache;
+        using clockTest::EvictionRecorder;
+        using clockTest::evictionOrder;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        ClockCache mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 4, 4, &ta);
+        const ClockCache& X = mX;
+
+        ASSERT(bdlcc::CacheEvictionPolicy::e_CLOCK == X.evictionPolicy());
+
+        bsl::vector<int>  evicted(&ta);
+        EvictionRecorder  recorder = { &evicted };
+        mX.setPostEvictionCallback(
+                 ClockCache::PostEvictionCallback(bsl::allocator_arg,
+                                                  &ta,
+                                                  recorder));
+
+        mX.insert(0, 0);
+        mX.insert(1, 1);
+        mX.insert(2, 2);
+        mX.insert(3, 3);
+
+        {
+            static const int EXP[] = { 0, 1, 2, 3 };
+            ASSERT(bsl::vector<int>(EXP, EXP + 4, &ta) ==
+                                                     evictionOrder(X, &ta));
+        }
+
+        // Access 0 and 2; 'tryGetValue' does not reorder the queue.
+
+        ClockCache::ValuePtrType value;
+        ASSERT(0 == mX.tryGetValue(&value, 0));
+        ASSERT(0 == *value);
+        ASSERT(0 == mX.tryGetValue(&value, 2));
+        ASSERT(0 == mX.tryGetValue(&value, 2));
+        ASSERT(1 == mX.tryGetValue(&value, 9));
+
+        {
+            static const int EXP[] = { 0, 1, 2, 3 };
+            ASSERT(bsl::vector<int>(EXP, EXP + 4, &ta) ==
+                                                     evictionOrder(X, &ta));
+        }
+
+        // 0 gets a second chance, and 1 is evicted.
+
+        mX.insert(4, 4);
+        ASSERTV(evicted.size(), 1 == evicted.size());
+        ASSERTV(evicted[0], 1 == evicted[0]);
+        {
+            static const int EXP[] = { 2, 3, 0, 4 };
+            ASSERT(bsl::vector<int>(EXP, EXP + 4, &ta) ==
+                                                     evictionOrder(X, &ta));
+        }
+
+        // 2 gets a second chance, and 3 is evicted.
+
+        mX.insert(5, 5);
+        ASSERTV(evicted.size(), 2 == evicted.size());
+        ASSERTV(evicted[1], 3 == evicted[1]);
+        {
+            static const int EXP[] = { 0, 4, 2, 5 };
+            ASSERT(bsl::vector<int>(EXP, EXP + 4, &ta) ==
+                                                     evictionOrder(X, &ta));
+        }
+
+        // The second chance of 0 has been used; a peek does not mark it.
+
+        ASSERT(0 == mX.tryGetValue(&value, 0, false));
+
+        mX.insert(6, 6);
+        ASSERTV(evicted.size(), 3 == evicted.size());
+        ASSERTV(evicted[2], 0 == evicted[2]);
+        {
+            static const int EXP[] = { 4, 2, 5, 6 };
+            ASSERT(bsl::vector<int>(EXP, EXP + 4, &ta) ==
+                                                     evictionOrder(X, &ta));
+        }
+
+        // Every item is accessed: the eviction wraps around.
+
+        ASSERT(0 == mX.tryGetValue(&value, 4));
+        ASSERT(0 == mX.tryGetValue(&value, 2));
+        ASSERT(0 == mX.tryGetValue(&value, 5));
+        ASSERT(0 == mX.tryGetValue(&value, 6));
+
+        mX.insert(7, 7);
+        ASSERTV(evicted.size(), 4 == evicted.size());
+        ASSERTV(evicted[3], 4 == evicted[3]);
+        {
+            static const int EXP[] = { 2, 5, 6, 7 };
+            ASSERT(bsl::vector<int>(EXP, EXP + 4, &ta) ==
+                                                     evictionOrder(X, &ta));
+        }
+
+        // 'popFront' gives a second chance as well.
+
+        ASSERT(0 == mX.tryGetValue(&value, 7));
+        ASSERT(0 == mX.tryGetValue(&value, 2));
+
+        ASSERT(0 == mX.popFront());
+        ASSERTV(evicted.size(), 5 == evicted.size());
+        ASSERTV(evicted[4], 5 == evicted[4]);
+        {
+            static const int EXP[] = { 6, 7, 2 };
+            ASSERT(bsl::vector<int>(EXP, EXP + 3, &ta) ==
+                                                     evictionOrder(X, &ta));
+        }
+
+        // Overwriting an item moves it to the back of the queue.
+
+        mX.insert(6, 60);
+        {
+            static const int EXP[] = { 7, 2, 60 };
+            ASSERT(bsl::vector<int>(EXP, EXP + 3, &ta) ==
+                                                     evictionOrder(X, &ta));
+        }
+
+        ASSERT(0 == mX.popFront());
+        ASSERT(0 == mX.popFront());
+        ASSERT(0 == mX.popFront());
+        ASSERT(1 == mX.popFront());
+        ASSERT(0 == X.size());
+        ASSERTV(evicted.size(), 8 == evicted.size());
+      } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
       case 18: {
         // --------------------------------------------------------------------
@@ -30,6 +30,13 @@ BSLS_IDENT("$Id: $")
 // 'tryPushBack' and 'tryPopFront' are also provided, which fail immediately
 // returning a non-zero value in case of overflow or underflow.
 //
+// The batch methods 'pushBackBatch', 'popFrontBatch', and 'tryPopFrontBatch'
+// transfer an array of elements in one call.  Each batch reserves a
+// contiguous range of cells with a single operation on the underlying
+// 'bdlcc::FixedQueueIndexManager' (see 'reservePushIndices' and
+// 'reservePopIndices'), and wakes the threads blocked on the other end of the
+// queue once per batch rather than once per element.
+//
 // The queue may be placed into a "disabled" state using the 'disable' method.
 // When disabled, 'pushBack' and 'tryPushBack' fail immediately (they do not
 // block and any blocked invocations will fail immediately).  The queue may be
@@ -271,6 +278,8 @@ class FixedQueue {
     // FRIENDS
     template <class VAL> friend class FixedQueue_PushProctor;
     template <class VAL> friend class FixedQueue_PopGuard;
+    template <class VAL> friend class FixedQueue_PushBatchProctor;
+    template <class VAL> friend class FixedQueue_PopBatchGuard;
 
   public:
     // TRAITS
@@ -301,6 +310,19 @@ class FixedQueue {
         // state.  Return 0 on success, and a nonzero value if the queue is
         // disabled.
 
+    int pushBackBatch(const TYPE  *values,
+                      bsl::size_t  numValues,
+                      bsl::size_t *numPushed = 0);
+        // Append the specified 'numValues' elements of the array starting at
+        // the specified 'values', in order, to the back of this queue,
+        // blocking until either space is available - if necessary - or the
+        // queue is disabled.  Optionally specify 'numPushed', into which the
+        // number of elements appended is loaded.  Return 0 if all the elements
+        // were appended, and a nonzero value if the queue is disabled (in
+        // which case the elements appended before the queue was disabled
+        // remain in the queue).  Note that, at each opportunity, as many of
+        // the remaining elements as fit are appended as a single batch.
+
     int tryPushBack(const TYPE& value);
         // Attempt to append the specified 'value' to the back of this queue
         // without blocking.  Return 0 on success, and a non-zero value if the
@@ -321,12 +343,36 @@ class FixedQueue {
         // Remove the element from the front of this queue and return it's
         // value.  If the queue is empty, block until it is not empty.
 
+    void popFrontBatch(TYPE        *values,
+                       bsl::size_t  maxNumValues,
+                       bsl::size_t *numPopped);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty, block until it is not
+        // empty; at least one element is removed.  The behavior is undefined
+        // unless '0 < maxNumValues' and 'values' refers to an array of at
+        // least 'maxNumValues' elements.
+
     int tryPopFront(TYPE *value);
         // Attempt to remove the element from the front of this queue without
         // blocking, and, if successful, load the specified 'value' with the
         // removed element.  Return 0 on success, and a non-zero value if queue
         // was empty.  On failure, 'value' is not changed.
 
+    int tryPopFrontBatch(TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bsl::size_t *numPopped);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, and, if successful, load
+        // the removed elements, in order, into the array starting at the
+        // specified 'values'.  Load the number of elements removed into the
+        // specified 'numPopped'.  Return 0 if at least one element was
+        // removed, and a non-zero value if the queue was empty.  On failure,
+        // 'values' is not changed and 0 is loaded into 'numPopped'.  The
+        // behavior is undefined unless '0 < maxNumValues' and 'values' refers
+        // to an array of at least 'maxNumValues' elements.
+
     void removeAll();
         // Remove all items from this queue.  Note that this operation is not
         // atomic; if other threads are concurrently pushing items into the
@@ -471,6 +517,132 @@ class FixedQueue_PushProctor {
 
 };
 
+                       // ==============================
+                       // class FixedQueue_PopBatchGuard
+                       // ==============================
+
+template <class VALUE>
+class FixedQueue_PopBatchGuard {
+    // This class provides a guard that iterates over a contiguous range of
+    // cells of a 'FixedQueue' object reserved for popping, and that, upon its
+    // destruction, removes (pops) the cells of the range that have not yet
+    // been visited, destroying their elements, and wakes up waiting pushers.
+    // Note that this guard is used to provide exception safety when popping a
+    // batch of elements from a 'FixedQueue' object.
+
+    // DATA
+    FixedQueue<VALUE> *d_parent_p;
+                                     // object from which the elements will be
+                                     // popped
+
+    unsigned int                  d_generation;
+                                     // generation count of the current cell
+
+    unsigned int                  d_index;
+                                     // index of the current cell
+
+    unsigned int                  d_numRemaining;
+                                     // number of cells, starting with the
+                                     // current cell, not yet popped
+
+    unsigned int                  d_numCells;
+                                     // number of cells in the range
+
+  private:
+    // NOT IMPLEMENTED
+    FixedQueue_PopBatchGuard(const FixedQueue_PopBatchGuard&);
+    FixedQueue_PopBatchGuard& operator=(const FixedQueue_PopBatchGuard&);
+
+  public:
+    // CREATORS
+    FixedQueue_PopBatchGuard(FixedQueue<VALUE> *queue,
+                             unsigned int       generation,
+                             unsigned int       index,
+                             unsigned int       numCells);
+        // Create a guard for the range of the specified 'numCells' cells of
+        // the specified 'queue' starting at the specified 'index' having the
+        // specified 'generation'.  The behavior is undefined unless the
+        // current thread has acquired a reservation to pop the cells of the
+        // range (using 'FixedQueueIndexManager::reservePopIndices').
+
+    ~FixedQueue_PopBatchGuard();
+        // Remove (pop) the cells of the range not yet popped, destroying their
+        // elements, and wake up to as many waiting pushers as there are cells
+        // in the range.
+
+    // MANIPULATORS
+    void next();
+        // Remove (pop) the current cell, destroying its element, and make the
+        // following cell of the range current.  The behavior is undefined
+        // unless a cell of the range remains.
+
+    // ACCESSORS
+    unsigned int index() const;
+        // Return the index of the current cell.
+};
+
+                      // =================================
+                      // class FixedQueue_PushBatchProctor
+                      // =================================
+
+template <class VALUE>
+class FixedQueue_PushBatchProctor {
+    // This class provides a proctor that iterates over a contiguous range of
+    // cells of a 'FixedQueue' object reserved for pushing, and that, upon its
+    // destruction, if cells of the range remain that have not been committed,
+    // removes and destroys all the elements of the 'FixedQueue' (putting that
+    // ring-buffer into a valid empty state) and releases the remaining
+    // cells.  Note that this proctor is used to provide exception safety when
+    // pushing a batch of elements into a 'FixedQueue' object.
+
+    // DATA
+    FixedQueue<VALUE> *d_parent_p;
+                                     // object in which the elements are pushed
+
+    unsigned int                  d_generation;
+                                     // generation count of the current cell
+
+    unsigned int                  d_index;
+                                     // index of the current cell
+
+    unsigned int                  d_numRemaining;
+                                     // number of cells, starting with the
+                                     // current cell, not yet committed
+
+  private:
+    // NOT IMPLEMENTED
+    FixedQueue_PushBatchProctor(const FixedQueue_PushBatchProctor&);
+    FixedQueue_PushBatchProctor& operator=(const FixedQueue_PushBatchProctor&);
+
+  public:
+    // CREATORS
+    FixedQueue_PushBatchProctor(FixedQueue<VALUE> *queue,
+                                unsigned int       generation,
+                                unsigned int       index,
+                                unsigned int       numCells);
+        // Create a proctor for the range of the specified 'numCells' cells of
+        // the specified 'queue' starting at the specified 'index' having the
+        // specified 'generation'.  The behavior is undefined unless the
+        // current thread has acquired a reservation to push the cells of the
+        // range (using 'FixedQueueIndexManager::reservePushIndices').
+
+    ~FixedQueue_PushBatchProctor();
+        // Destroy this proctor and, if cells of the range remain that have not
+        // been committed, remove and destroy all the elements from the
+        // 'FixedQueue' object supplied at construction, and release the
+        // remaining cells.
+
+    // MANIPULATORS
+    void next();
+        // Commit (mark as full) the current cell, whose element must have
+        // been constructed, and make the following cell of the range current.
+        // The behavior is undefined unless a cell of the range remains.
+
+    // ACCESSORS
+    unsigned int index() const;
+        // Return the index of the current cell.
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -587,6 +759,56 @@ int FixedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
     return 0;
 }
 
+template <class TYPE>
+int FixedQueue<TYPE>::tryPopFrontBatch(TYPE        *values,
+                                       bsl::size_t  maxNumValues,
+                                       bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    unsigned int generation;
+    unsigned int index;
+    unsigned int numCells;
+
+    // SYNCHRONIZATION POINT 2
+    //
+    // See 'tryPopFront'.
+
+    int retval = d_impl.reservePopIndices(
+                            &generation,
+                            &index,
+                            &numCells,
+                            static_cast<unsigned int>(
+                                bsl::min<bsl::size_t>(maxNumValues,
+                                                      d_impl.capacity())));
+
+    if (0 != retval) {
+        *numPopped = 0;
+        return retval;                                                // RETURN
+    }
+
+    // Copy or move the elements.  'FixedQueue_PopBatchGuard' will destroy the
+    // original objects, update the queue, and release waiting pushers, even
+    // if an assignment operator throws.
+
+    FixedQueue_PopBatchGuard<TYPE> guard(this, generation, index, numCells);
+
+    for (unsigned int i = 0; i < numCells; ++i) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[i] = bslmf::MovableRefUtil::move(d_elements[guard.index()]);
+#else
+        values[i] = d_elements[guard.index()];
+#endif
+        guard.next();
+    }
+
+    *numPopped = numCells;
+
+    return 0;
+}
+
 template <class TYPE>
 int FixedQueue<TYPE>::tryPopFront(TYPE *value)
 {
@@ -687,6 +909,93 @@ int FixedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return 0;
 }
 
+template <class TYPE>
+int FixedQueue<TYPE>::pushBackBatch(const TYPE  *values,
+                                    bsl::size_t  numValues,
+                                    bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t numDone = 0;
+    int         retval  = 0;
+
+    while (numDone < numValues) {
+        unsigned int generation;
+        unsigned int index;
+        unsigned int numCells;
+
+        // SYNCHRONIZATION POINT 1
+        //
+        // See 'tryPushBack'.
+
+        retval = d_impl.reservePushIndices(
+                            &generation,
+                            &index,
+                            &numCells,
+                            static_cast<unsigned int>(
+                                bsl::min<bsl::size_t>(numValues - numDone,
+                                                      d_impl.capacity())));
+
+        if (retval < 0) {
+            // The queue is disabled.
+
+            break;
+        }
+
+        if (0 < retval) {
+            retval = 0;
+
+            d_numWaitingPushers.addRelaxed(1);
+
+            // SYNCHRONIZATION POINT 1-Prime
+            //
+            // See 'pushBack'.
+
+            if (isFull() && isEnabled()) {
+                d_pushControlSema.wait();
+            }
+
+            d_numWaitingPushers.addRelaxed(-1);
+
+            continue;
+        }
+
+        // Copy the elements into the cells, committing each cell as soon as
+        // its element is constructed.  If an exception is thrown by the copy
+        // constructor, 'FixedQueue_PushBatchProctor' will leave the queue in a
+        // valid empty state and release the remaining cells.
+
+        FixedQueue_PushBatchProctor<TYPE> guard(this,
+                                                generation,
+                                                index,
+                                                numCells);
+
+        for (unsigned int i = 0; i < numCells; ++i) {
+            bslalg::ScalarPrimitives::copyConstruct(
+                                                 &d_elements[guard.index()],
+                                                 values[numDone + i],
+                                                 d_allocator_p);
+            guard.next();
+        }
+
+        numDone += numCells;
+
+        // Wake up, once, as many waiting poppers as there are new elements.
+
+        const int numWakeUps = bsl::min(static_cast<int>(numCells),
+                                        d_numWaitingPoppers.loadRelaxed());
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 < numWakeUps)) {
+            d_popControlSema.post(numWakeUps);
+        }
+    }
+
+    if (numPushed) {
+        *numPushed = numDone;
+    }
+
+    return retval;
+}
+
 template <class TYPE>
 void FixedQueue<TYPE>::popFront(TYPE *value)
 {
@@ -709,6 +1018,26 @@ void FixedQueue<TYPE>::popFront(TYPE *value)
     }
 }
 
+template <class TYPE>
+void FixedQueue<TYPE>::popFrontBatch(TYPE        *values,
+                                     bsl::size_t  maxNumValues,
+                                     bsl::size_t *numPopped)
+{
+    while (0 != tryPopFrontBatch(values, maxNumValues, numPopped)) {
+        d_numWaitingPoppers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 2-Prime
+        //
+        // See 'popFront'.
+
+        if (isEmpty()) {
+            d_popControlSema.wait();
+        }
+
+        d_numWaitingPoppers.addRelaxed(-1);
+    }
+}
+
 template <class TYPE>
 TYPE FixedQueue<TYPE>::popFront()
 {
@@ -931,6 +1260,133 @@ void FixedQueue_PushProctor<VALUE>::release()
 {
     d_parent_p = 0;
 }
+                       // ------------------------------
+                       // class FixedQueue_PopBatchGuard
+                       // ------------------------------
+
+// CREATORS
+template <class VALUE>
+inline
+FixedQueue_PopBatchGuard<VALUE>::FixedQueue_PopBatchGuard(
+                                                 FixedQueue<VALUE> *queue,
+                                                 unsigned int       generation,
+                                                 unsigned int       index,
+                                                 unsigned int       numCells)
+: d_parent_p(queue)
+, d_generation(generation)
+, d_index(index)
+, d_numRemaining(numCells)
+, d_numCells(numCells)
+{
+}
+
+template <class VALUE>
+FixedQueue_PopBatchGuard<VALUE>::~FixedQueue_PopBatchGuard()
+{
+    // Pop any cells of the range not yet popped; this happens only if an
+    // assignment operator threw.
+
+    while (d_numRemaining) {
+        next();
+    }
+
+    // Notify pushers of available elements.
+
+    const int numWakeUps = bsl::min(
+                               static_cast<int>(d_numCells),
+                               d_parent_p->d_numWaitingPushers.loadRelaxed());
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 < numWakeUps)) {
+        d_parent_p->d_pushControlSema.post(numWakeUps);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline
+void FixedQueue_PopBatchGuard<VALUE>::next()
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    bslma::DestructionUtil::destroy(d_parent_p->d_elements + d_index);
+
+    d_parent_p->d_impl.commitPopIndex(d_generation, d_index);
+
+    if (--d_numRemaining) {
+        d_parent_p->d_impl.advanceIndex(&d_generation, &d_index);
+    }
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+unsigned int FixedQueue_PopBatchGuard<VALUE>::index() const
+{
+    return d_index;
+}
+
+                      // ---------------------------------
+                      // class FixedQueue_PushBatchProctor
+                      // ---------------------------------
+
+// CREATORS
+template <class VALUE>
+inline
+FixedQueue_PushBatchProctor<VALUE>::FixedQueue_PushBatchProctor(
+                                                 FixedQueue<VALUE> *queue,
+                                                 unsigned int       generation,
+                                                 unsigned int       index,
+                                                 unsigned int       numCells)
+: d_parent_p(queue)
+, d_generation(generation)
+, d_index(index)
+, d_numRemaining(numCells)
+{
+}
+
+template <class VALUE>
+FixedQueue_PushBatchProctor<VALUE>::~FixedQueue_PushBatchProctor()
+{
+    // Each cell not yet committed is still reserved as 'e_WRITING'.  Release
+    // them in order, as though an exception had been thrown while pushing
+    // each one individually: the first release disposes of all the elements
+    // preceding it (including those of this batch that were committed), and
+    // each subsequent release finds no elements to dispose of.
+
+    while (d_numRemaining) {
+        {
+            FixedQueue_PushProctor<VALUE> proctor(d_parent_p,
+                                                  d_generation,
+                                                  d_index);
+        }
+
+        if (--d_numRemaining) {
+            d_parent_p->d_impl.advanceIndex(&d_generation, &d_index);
+        }
+    }
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline
+void FixedQueue_PushBatchProctor<VALUE>::next()
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    d_parent_p->d_impl.commitPushIndex(d_generation, d_index);
+
+    if (--d_numRemaining) {
+        d_parent_p->d_impl.advanceIndex(&d_generation, &d_index);
+    }
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+unsigned int FixedQueue_PushBatchProctor<VALUE>::index() const
+{
+    return d_index;
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
@@ -50,6 +50,7 @@
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>            // 'atoi'
 
@@ -316,6 +317,66 @@ void exceptionProducer(bdlcc::FixedQueue<ExceptionTester> *tester,
 
 #endif
 
+#ifdef BDE_BUILD_TARGET_EXC
+
+class BatchExceptionTester
+    // This class counts its live instances, and throws from its copy
+    // constructor or copy-assignment operator once 's_numCopiesBeforeThrow'
+    // further copies have been made (if it is positive).
+{
+public:
+    static int s_numCopiesBeforeThrow;
+    static int s_numLive;
+
+    BatchExceptionTester() { ++s_numLive; }
+
+    BatchExceptionTester(const BatchExceptionTester&) {
+        countCopy();
+        ++s_numLive;
+    }
+
+    ~BatchExceptionTester() { --s_numLive; }
+
+    BatchExceptionTester& operator=(const BatchExceptionTester&) {
+        countCopy();
+        return *this;
+    }
+
+    static void countCopy() {
+        if (0 < s_numCopiesBeforeThrow && 0 == --s_numCopiesBeforeThrow) {
+            throw 1;
+        }
+    }
+};
+
+int BatchExceptionTester::s_numCopiesBeforeThrow = 0;
+int BatchExceptionTester::s_numLive              = 0;
+
+#endif
+
+void batchProducer(Obj *queue, int id, int numValues, int batchSize)
+    // Push into the specified 'queue', in batches of the specified
+    // 'batchSize', the specified 'numValues' values tagged with the specified
+    // 'id'.
+{
+    bsl::vector<Element *> values(batchSize);
+
+    for (int i = 0; i < numValues; i += batchSize) {
+        const int numInBatch = bsl::min(batchSize, numValues - i);
+
+        for (int j = 0; j < numInBatch; ++j) {
+            values[j] = reinterpret_cast<Element *>(
+                                  static_cast<bsls::Types::IntPtr>(
+                                               id * numValues + i + j + 1));
+        }
+        bsl::size_t numPushed = 0;
+        ASSERTT(0 == queue->pushBackBatch(values.data(),
+                                          numInBatch,
+                                          &numPushed));
+        ASSERTT(static_cast<bsl::size_t>(numInBatch) == numPushed);
+    }
+}
+
 class TestType
 {
     int *d_arg_p;
@@ -1305,7 +1366,7 @@ int main(int argc, char *argv[])
                     bslmt::Configuration::recommendedDefaultThreadStackSize());
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 20: {
         // ---------------------------------------------------------
         // Usage example test
         //
@@ -1321,6 +1382,221 @@ int main(int argc, char *argv[])
         break;
       }
 
+      case 19: {
+        // ---------------------------------------------------------
+        // Batch operations test
+        //
+        // Test that 'pushBackBatch', 'popFrontBatch', and
+        // 'tryPopFrontBatch' push and pop values in order, across the end of
+        // the buffer, block (and are woken up) when the queue is full or
+        // empty, respect the disabled state, and provide the same exception
+        // guarantees as 'pushBack' and 'popFront'.
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Batch operations test" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tSingle-threaded batches." << endl;
+        {
+            bdlcc::FixedQueue<int> queue(5, &ta);
+
+            const int   VALUES[] = { 1, 2, 3, 4, 5, 6, 7 };
+            int         results[7];
+            bsl::size_t numPushed = 99;
+            bsl::size_t numPopped = 99;
+
+            ASSERT(0 == queue.pushBackBatch(VALUES, 0, &numPushed));
+            ASSERT(0 == numPushed);
+            ASSERT(queue.isEmpty());
+
+            ASSERT(0 != queue.tryPopFrontBatch(results, 7, &numPopped));
+            ASSERT(0 == numPopped);
+
+            ASSERT(0 == queue.pushBackBatch(VALUES, 3, &numPushed));
+            ASSERT(3 == numPushed);
+            ASSERT(3 == queue.length());
+
+            ASSERT(0 == queue.pushBackBatch(VALUES + 3, 2));
+            ASSERT(queue.isFull());
+
+            ASSERT(0 == queue.tryPopFrontBatch(results, 2, &numPopped));
+            ASSERT(2 == numPopped);
+            ASSERT(1 == results[0]);
+            ASSERT(2 == results[1]);
+
+            queue.popFrontBatch(results, 7, &numPopped);
+            ASSERT(3 == numPopped);
+            ASSERT(3 == results[0]);
+            ASSERT(4 == results[1]);
+            ASSERT(5 == results[2]);
+            ASSERT(queue.isEmpty());
+
+            // Run batches of every size through several generations.
+
+            for (int i = 0; i < 30; ++i) {
+                const bsl::size_t NUM_VALUES = i % 5 + 1;
+
+                ASSERT(0 == queue.pushBackBatch(VALUES + i % 3,
+                                                NUM_VALUES,
+                                                &numPushed));
+                ASSERT(NUM_VALUES == numPushed);
+
+                bsl::size_t total = 0;
+                while (0 == queue.tryPopFrontBatch(results + total,
+                                                   7 - total,
+                                                   &numPopped)) {
+                    total += numPopped;
+                }
+                ASSERTV(i, total, NUM_VALUES == total);
+                for (bsl::size_t j = 0; j < total; ++j) {
+                    ASSERTV(i, j, VALUES[i % 3 + j] == results[j]);
+                }
+            }
+
+            // A disabled queue rejects batches, but can be popped.
+
+            ASSERT(0 == queue.pushBackBatch(VALUES, 2));
+            queue.disable();
+
+            numPushed = 99;
+            ASSERT(0 != queue.pushBackBatch(VALUES, 3, &numPushed));
+            ASSERT(0 == numPushed);
+            ASSERT(2 == queue.length());
+
+            queue.popFrontBatch(results, 7, &numPopped);
+            ASSERT(2 == numPopped);
+            ASSERT(1 == results[0]);
+            ASSERT(2 == results[1]);
+
+            queue.enable();
+            ASSERT(0 == queue.pushBackBatch(VALUES, 5, &numPushed));
+            ASSERT(5 == numPushed);
+            ASSERT(queue.isFull());
+        }
+
+        if (verbose) cout << "\tMultiple producers, one consumer." << endl;
+        {
+            enum {
+                k_NUM_PRODUCERS = 3,
+                k_NUM_VALUES    = 10000,
+                k_BATCH_SIZE    = 50,
+                k_POP_SIZE      = 7
+            };
+
+            Obj queue(16, &ta);
+
+            bslmt::ThreadGroup producers(&ta);
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                producers.addThread(bdlf::BindUtil::bind(&batchProducer,
+                                                         &queue,
+                                                         i,
+                                                         +k_NUM_VALUES,
+                                                         +k_BATCH_SIZE));
+            }
+
+            bsls::Types::IntPtr lastValue[k_NUM_PRODUCERS] = { 0, 0, 0 };
+            Element            *results[k_POP_SIZE];
+            int                 numReceived = 0;
+
+            while (numReceived < k_NUM_PRODUCERS * k_NUM_VALUES) {
+                bsl::size_t numPopped = 0;
+                queue.popFrontBatch(results, k_POP_SIZE, &numPopped);
+                ASSERT(0 < numPopped && numPopped <= k_POP_SIZE);
+
+                for (bsl::size_t j = 0; j < numPopped; ++j) {
+                    const bsls::Types::IntPtr value =
+                        reinterpret_cast<bsls::Types::IntPtr>(results[j]) - 1;
+                    const int id = static_cast<int>(value / k_NUM_VALUES);
+
+                    ASSERTV(value, 0 <= id && id < k_NUM_PRODUCERS);
+                    if (0 <= id && id < k_NUM_PRODUCERS) {
+                        ASSERTV(id, value, lastValue[id],
+                                value % k_NUM_VALUES == lastValue[id]);
+                        ++lastValue[id];
+                    }
+                }
+                numReceived += static_cast<int>(numPopped);
+            }
+            producers.joinAll();
+
+            ASSERT(queue.isEmpty());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\tException safety." << endl;
+        {
+            typedef BatchExceptionTester ETester;
+
+            bdlcc::FixedQueue<ETester> queue(5, &ta);
+
+            {
+                ETester     values[4];
+                ETester     results[5];
+                bsl::size_t numPopped;
+
+                ASSERT(9 == ETester::s_numLive);
+
+                // An exception pushing the second element of a batch empties
+                // the queue.
+
+                ASSERT(0 == queue.pushBackBatch(values, 2));
+                ASSERT(11 == ETester::s_numLive);
+
+                ETester::s_numCopiesBeforeThrow = 2;
+
+                bool caught = false;
+                try {
+                    queue.pushBackBatch(values, 3);
+                }
+                catch (...) {
+                    caught = true;
+                }
+                ASSERT(caught);
+                ASSERT(queue.isEmpty());
+                ASSERTV(ETester::s_numLive, 9 == ETester::s_numLive);
+
+                // The queue remains usable across generations.
+
+                for (int i = 0; i < 4; ++i) {
+                    ASSERT(0 == queue.pushBackBatch(values, 4));
+                    ASSERT(4 == queue.length());
+                    queue.popFrontBatch(results, 5, &numPopped);
+                    ASSERT(4 == numPopped);
+                    ASSERT(9 == ETester::s_numLive);
+                }
+
+                // An exception assigning the second element of a batch
+                // removes the whole batch.
+
+                ASSERT(0 == queue.pushBackBatch(values, 4));
+
+                ETester::s_numCopiesBeforeThrow = 2;
+
+                caught = false;
+                try {
+                    queue.tryPopFrontBatch(results, 5, &numPopped);
+                }
+                catch (...) {
+                    caught = true;
+                }
+                ASSERT(caught);
+                ASSERT(queue.isEmpty());
+                ASSERTV(ETester::s_numLive, 9 == ETester::s_numLive);
+
+                ASSERT(0 == queue.pushBackBatch(values, 4));
+                ASSERT(4 == queue.length());
+                queue.popFrontBatch(results, 5, &numPopped);
+                ASSERT(4 == numPopped);
+            }
+            ASSERT(0 == ETester::s_numLive);
+        }
+#endif
+
+        ASSERT(0 == ta.numBytesInUse());
+      } break;
       case 18: {
           // ---------------------------------------------------------
           // Moving tests
@@ -493,6 +493,97 @@ void FixedQueueIndexManager::commitPushIndex(unsigned int generation,
     d_states[index] = encodeElementState(generation, e_FULL);
 }
 
+int FixedQueueIndexManager::reservePushIndices(unsigned int *generation,
+                                               unsigned int *index,
+                                               unsigned int *numReserved,
+                                               unsigned int  maxNumIndices)
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+    BSLS_ASSERT(0 != numReserved);
+    BSLS_ASSERT(0 <  maxNumIndices);
+
+    int rc = reservePushIndex(generation, index);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // We've acquired the first cell.  Attempt to acquire each subsequent cell
+    // in turn by swapping it from 'e_EMPTY' to 'e_WRITING' in the generation
+    // it would be pushed in; stop at the first cell that is not empty (either
+    // another thread has acquired it, or it has not yet been popped in the
+    // previous generation), or once the queue is disabled, so that each cell
+    // is reserved only if the queue is enabled when it is reserved, as for
+    // 'reservePushIndex'.
+
+    const unsigned int firstIndex =
+               static_cast<unsigned int>(*generation * d_capacity + *index);
+    const unsigned int maxCount   =
+               static_cast<unsigned int>(
+                             bsl::min<bsl::size_t>(maxNumIndices, d_capacity));
+
+    unsigned int lastIndex = firstIndex;
+    unsigned int count     = 1;
+
+    while (count < maxCount) {
+        const unsigned int combinedIndex = nextCombinedIndex(lastIndex);
+
+        const unsigned int currGeneration =
+                         static_cast<unsigned int>(combinedIndex / d_capacity);
+        const unsigned int currIndex      =
+                         static_cast<unsigned int>(combinedIndex % d_capacity);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                  isDisabledFlagSet(d_pushIndex.load()))) {
+            break;
+        }
+
+        const int compare = encodeElementState(currGeneration, e_EMPTY);
+        const int swap    = encodeElementState(currGeneration, e_WRITING);
+
+        if (compare != d_states[currIndex].testAndSwap(compare, swap)) {
+            break;
+        }
+
+        lastIndex = combinedIndex;
+        ++count;
+    }
+
+    *numReserved = count;
+
+    if (1 < count) {
+        // Advance the push index past the reserved cells, preserving the
+        // disabled flag, unless another thread has already advanced it beyond
+        // them.  Note that other threads may concurrently advance the push
+        // index one cell at a time over the cells we have acquired.
+
+        const unsigned int endIndex    = nextCombinedIndex(lastIndex);
+        unsigned int       loadedIndex = d_pushIndex.loadRelaxed();
+
+        for (;;) {
+            const int offset = circularDifference(
+                                              discardDisabledFlag(loadedIndex),
+                                              firstIndex,
+                                              d_maxCombinedIndex + 1);
+
+            if (offset < 0 || static_cast<unsigned int>(offset) >= count) {
+                break;
+            }
+
+            const unsigned int swap = endIndex
+                                    | (loadedIndex & k_DISABLED_STATE_MASK);
+            const unsigned int was  = d_pushIndex.testAndSwap(loadedIndex,
+                                                              swap);
+            if (was == loadedIndex) {
+                break;
+            }
+            loadedIndex = was;
+        }
+    }
+
+    return 0;
+}
+
 int FixedQueueIndexManager::reservePopIndex(unsigned int *generation,
                                             unsigned int *index)
 {
@@ -624,6 +715,84 @@ void FixedQueueIndexManager::commitPopIndex(unsigned int generation,
                                          e_EMPTY);
 }
 
+int FixedQueueIndexManager::reservePopIndices(unsigned int *generation,
+                                              unsigned int *index,
+                                              unsigned int *numReserved,
+                                              unsigned int  maxNumIndices)
+{
+    BSLS_ASSERT(0 != generation);
+    BSLS_ASSERT(0 != index);
+    BSLS_ASSERT(0 != numReserved);
+    BSLS_ASSERT(0 <  maxNumIndices);
+
+    int rc = reservePopIndex(generation, index);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    // We've acquired the first cell.  Attempt to acquire each subsequent cell
+    // in turn by swapping it from 'e_FULL' to 'e_READING' in its generation;
+    // stop at the first cell that is not full (either it is empty, another
+    // thread is still writing it, or another thread has acquired it).
+
+    const unsigned int firstIndex =
+               static_cast<unsigned int>(*generation * d_capacity + *index);
+    const unsigned int maxCount   =
+               static_cast<unsigned int>(
+                             bsl::min<bsl::size_t>(maxNumIndices, d_capacity));
+
+    unsigned int lastIndex = firstIndex;
+    unsigned int count     = 1;
+
+    while (count < maxCount) {
+        const unsigned int combinedIndex = nextCombinedIndex(lastIndex);
+
+        const unsigned int currGeneration =
+                         static_cast<unsigned int>(combinedIndex / d_capacity);
+        const unsigned int currIndex      =
+                         static_cast<unsigned int>(combinedIndex % d_capacity);
+
+        const int compare = encodeElementState(currGeneration, e_FULL);
+        const int swap    = encodeElementState(currGeneration, e_READING);
+
+        if (compare != d_states[currIndex].testAndSwap(compare, swap)) {
+            break;
+        }
+
+        lastIndex = combinedIndex;
+        ++count;
+    }
+
+    *numReserved = count;
+
+    if (1 < count) {
+        // Advance the pop index past the reserved cells, unless another thread
+        // has already advanced it beyond them.
+
+        const unsigned int endIndex    = nextCombinedIndex(lastIndex);
+        unsigned int       loadedIndex = d_popIndex.loadRelaxed();
+
+        for (;;) {
+            const int offset = circularDifference(loadedIndex,
+                                                  firstIndex,
+                                                  d_maxCombinedIndex + 1);
+
+            if (offset < 0 || static_cast<unsigned int>(offset) >= count) {
+                break;
+            }
+
+            const unsigned int was = d_popIndex.testAndSwap(loadedIndex,
+                                                            endIndex);
+            if (was == loadedIndex) {
+                break;
+            }
+            loadedIndex = was;
+        }
+    }
+
+    return 0;
+}
+
 void FixedQueueIndexManager::disable()
 {
 
@@ -40,6 +40,17 @@ BSLS_IDENT("$Id: $")
 // non-creator operations on an object can be safely invoked simultaneously
 // from multiple threads.
 //
+///Disabled State
+///--------------
+// Once 'disable' has returned, no index is reserved for pushing until 'enable'
+// is called.  'reservePushIndex' and 'reservePushIndices' check the disabled
+// state immediately before reserving each index, which is the point at which
+// that index is reserved: a reservation of several indices by
+// 'reservePushIndices' is therefore equivalent to consecutive calls to
+// 'reservePushIndex', and ends early (having reserved at least one index) if
+// the queue is disabled during the reservation.  Indices reserved before
+// 'disable' returned must still be committed.
+//
 ///Exception safety
 ///----------------
 // All methods of the 'bdlcc::FixedQueueIndexManager' provide a no-throw
@@ -194,6 +205,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmf_nestedtraitdeclaration.h>
 
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_platform.h>
 #include <bsls_performancehint.h>
@@ -377,6 +389,31 @@ class FixedQueueIndexManager {
         // 'index' match those returned by a previous successful call to
         // 'reservePushIndex' (that has not previously been committed).
 
+    int reservePushIndices(unsigned int *generation,
+                           unsigned int *index,
+                           unsigned int *numReserved,
+                           unsigned int  maxNumIndices);
+        // Reserve up to the specified 'maxNumIndices' consecutive available
+        // indices at which to enqueue elements in an (externally managed)
+        // circular buffer; load the specified 'index' and 'generation' with
+        // the index and generation of the first reserved index, and load the
+        // specified 'numReserved' with the number of indices reserved.  Return
+        // 0 on success, a negative value if the queue is disabled, and a
+        // positive value if the queue is full.  On success at least one index
+        // is reserved, the reserved indices are contiguous in the circular
+        // buffer (and may wrap around its end), and the push index is advanced
+        // past all of them at once.  Use 'advanceIndex' to obtain the
+        // generation and index of each subsequent reserved index, each of
+        // which must be committed with 'commitPushIndex'.  If this method
+        // fails 'generation', 'index', and 'numReserved' will be unmodified.
+        // The behavior is undefined unless '0 < maxNumIndices', or if the
+        // current thread is already holding a reservation on either a push or
+        // pop index.  Note that each index is reserved only if the queue is
+        // enabled at the point of its reservation, as if by a separate call
+        // to 'reservePushIndex' (see {Disabled State}): once 'disable' has
+        // returned, no further index is reserved, and fewer than the
+        // available indices may be reserved.
+
                          // Popping Elements
 
     int reservePopIndex(unsigned int *generation, unsigned int *index);
@@ -404,11 +441,32 @@ class FixedQueueIndexManager {
         // successful call to 'reservePopIndex' (that has not previously been
         // committed).
 
+    int reservePopIndices(unsigned int *generation,
+                          unsigned int *index,
+                          unsigned int *numReserved,
+                          unsigned int  maxNumIndices);
+        // Reserve up to the specified 'maxNumIndices' consecutive indices from
+        // which to dequeue elements from an (externally managed) circular
+        // buffer; load the specified 'index' and 'generation' with the index
+        // and generation of the first reserved index, and load the specified
+        // 'numReserved' with the number of indices reserved.  Return 0 on
+        // success, and a non-zero value if the queue is empty.  On success at
+        // least one index is reserved, the reserved indices are contiguous in
+        // the circular buffer (and may wrap around its end), and the pop index
+        // is advanced past all of them at once.  Use 'advanceIndex' to obtain
+        // the generation and index of each subsequent reserved index, each of
+        // which must be committed with 'commitPopIndex'.  If this method fails
+        // 'generation', 'index', and 'numReserved' will be unmodified.  The
+        // behavior is undefined unless '0 < maxNumIndices', or if the current
+        // thread is already holding a reservation on either a push or pop
+        // index.
+
                                 // Disabled State
 
     void disable();
-        // Mark the queue as disabled.  Future calls to 'reservePushIndex' will
-        // fail.
+        // Mark the queue as disabled.  Future calls to 'reservePushIndex' and
+        // 'reservePushIndices' will fail, and calls to 'reservePushIndices'
+        // in progress will reserve no further index.
 
     void enable();
         // Mark the queue as enabled.
@@ -448,6 +506,14 @@ class FixedQueueIndexManager {
         // for pushing, and committing that index.
 
     // ACCESSORS
+    void advanceIndex(unsigned int *generation, unsigned int *index) const;
+        // Load into the specified 'generation' and 'index' the generation and
+        // index of the cell of the circular buffer that follows the cell they
+        // currently identify.  The behavior is undefined unless
+        // '*generation' and '*index' identify a cell of this circular buffer.
+        // Note that this method is intended for iterating over the indices
+        // reserved by 'reservePushIndices' and 'reservePopIndices'.
+
     bool isEnabled() const;
         // Return 'true' if the queue is enabled, and 'false' if it is
         // disabled.
@@ -502,6 +568,24 @@ unsigned int FixedQueueIndexManager::nextGeneration(
 }
 
 // ACCESSORS
+inline
+void FixedQueueIndexManager::advanceIndex(unsigned int *generation,
+                                          unsigned int *index) const
+{
+    BSLS_ASSERT(generation);
+    BSLS_ASSERT(index);
+    BSLS_ASSERT(*generation <= d_maxGeneration);
+    BSLS_ASSERT(*index      <  d_capacity);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_capacity == *index + 1)) {
+        *generation = nextGeneration(*generation);
+        *index      = 0;
+    }
+    else {
+        ++*index;
+    }
+}
+
 inline
 bsl::size_t FixedQueueIndexManager::capacity() const
 {
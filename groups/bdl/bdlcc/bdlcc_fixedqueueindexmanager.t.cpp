@@ -90,6 +90,8 @@ using namespace bsl;
 // [ 3] void commitPushIndex(unsigned int , unsigned int );
 // [ 3] int reservePopIndex(unsigned int *, unsigned int *);
 // [ 3] void commitPopIndex(unsigned int , unsigned int );
+// [13] int reservePushIndices(unsigned *, unsigned *, unsigned *, unsigned);
+// [13] int reservePopIndices(unsigned *, unsigned *, unsigned *, unsigned);
 // [ 6] int reservePopIndexForClear(unsigned *,unsigned *,unsigned,unsigned);
 // [ 7] void abortPushIndexReservation(unsigned int, unsigned int);
 // [ 5] void disable();
@@ -99,13 +101,15 @@ using namespace bsl;
 // [ 5] bool isEnabled() const;
 // [ 3] unsigned int length() const;
 // [ 2] unsigned int capacity() const;
+// [13] void advanceIndex(unsigned int *, unsigned int *) const;
 // [10] bsl::ostream& print(bsl::ostream& ) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 4] CONCERN: 'gg' generator and 'dirtyGG' generator
 // [11] CONCERN: Thread-Safety (concurrent access does not corrupt state)
 // [12] CONCERN: maxCombinedIndex
+// [13] CONCERN: batch reservations do not corrupt state
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -775,6 +779,94 @@ void readerThread(Obj *x, TestThreadStateBarrier *testState, int delayPeriod)
     }
 }
 
+void batchWriterThread(Obj                    *x,
+                       TestThreadStateBarrier *testState,
+                       int                     delayPeriod)
+    // Simulate a client pushing batches of elements from the specified 'x'
+    // test object, using the specified 'testState' to determine the current
+    // state of the test (running, paused, exiting), and periodically inserting
+    // delays using the specified 'delayPeriod'.
+{
+    const bsl::size_t CAPACITY = x->capacity();
+
+    testState->blockUntilStateChange();
+
+    for (unsigned int batchSize = 1;; batchSize = batchSize % 7 + 1) {
+        TestThreadStateBarrier::State state = testState->state();
+        if (state == TestThreadStateBarrier::e_EXIT) {
+            return;                                                   // RETURN
+        }
+        else if (state == TestThreadStateBarrier::e_WAIT) {
+            testState->blockUntilStateChange();
+            continue;
+        }
+        bsl::size_t length = x->length();
+        ASSERTV(length, length <= CAPACITY);
+
+        unsigned int generation, index, numReserved;
+        int rc = x->reservePushIndices(&generation,
+                                       &index,
+                                       &numReserved,
+                                       batchSize);
+        performDelay(delayPeriod);
+        if (0 == rc) {
+            ASSERTV(numReserved, batchSize, 0 < numReserved);
+            ASSERTV(numReserved, batchSize, numReserved <= batchSize);
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                if (0 != i) {
+                    x->advanceIndex(&generation, &index);
+                }
+                x->commitPushIndex(generation, index);
+            }
+        }
+    }
+}
+
+void batchReaderThread(Obj                    *x,
+                       TestThreadStateBarrier *testState,
+                       int                     delayPeriod)
+    // Simulate a client popping batches of elements from the specified 'x'
+    // test object, using the specified 'testState' to determine the current
+    // state of the test (running, paused, exiting), and periodically inserting
+    // delays using the specified 'delayPeriod'.
+{
+    const bsl::size_t CAPACITY = x->capacity();
+
+    testState->blockUntilStateChange();
+
+    for (unsigned int batchSize = 1;; batchSize = batchSize % 5 + 1) {
+        TestThreadStateBarrier::State state = testState->state();
+        if (state == TestThreadStateBarrier::e_EXIT) {
+            return;                                                   // RETURN
+        }
+        else if (state == TestThreadStateBarrier::e_WAIT) {
+            testState->blockUntilStateChange();
+            continue;
+        }
+        bsl::size_t length = x->length();
+        ASSERTV(length, length <= CAPACITY);
+
+        unsigned int generation, index, numReserved;
+        int rc = x->reservePopIndices(&generation,
+                                      &index,
+                                      &numReserved,
+                                      batchSize);
+        performDelay(delayPeriod);
+        if (0 == rc) {
+            ASSERTV(numReserved, batchSize, 0 < numReserved);
+            ASSERTV(numReserved, batchSize, numReserved <= batchSize);
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                if (0 != i) {
+                    x->advanceIndex(&generation, &index);
+                }
+                x->commitPopIndex(generation, index);
+            }
+        }
+    }
+}
+
 void exceptionThread(Obj                    *x,
                      TestThreadStateBarrier *testState,
                      int                     delayPeriod)
@@ -982,7 +1074,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   The usage example provided in the component header file must
@@ -1021,6 +1113,451 @@ int main(int argc, char *argv[])
     ASSERT(1 == result);
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING: 'reservePushIndices', 'reservePopIndices'
+        //
+        // Concerns:
+        //  1 That 'reservePushIndices' reserves the requested number of
+        //    consecutive indices if they are all empty, and otherwise stops at
+        //    the first index that is not available (in particular, it never
+        //    reserves more than 'capacity()' indices or an index that has not
+        //    been popped in the preceding generation).
+        //
+        //  2 That 'reservePopIndices' reserves the requested number of
+        //    consecutive indices if they are all full, and otherwise stops at
+        //    the first index that is not full (in particular, one that is
+        //    still being written).
+        //
+        //  3 That both methods fail, and leave their arguments unmodified, if
+        //    the queue is full (respectively, empty), and that
+        //    'reservePushIndices' fails if the queue is disabled.
+        //
+        //  4 That 'advanceIndex' yields the indices of a reserved range,
+        //    including when the range wraps around the end of the buffer and
+        //    around the maximum combined index.
+        //
+        //  5 That concurrent batch reservations, interleaved with single
+        //    reservations and exception handling, do not corrupt the state of
+        //    the buffer.
+        //
+        // Plan:
+        //  1 Using a capacity 5 buffer, reserve, commit, and verify a series
+        //    of batches, including ranges truncated by full, empty, and
+        //    currently reserved cells, ranges wrapping around the end of the
+        //    buffer, and reservations on a full, empty, and disabled buffer.
+        //    (C-1..4)
+        //
+        //  2 Use 'dirtyGG' to place the push and pop indices just before the
+        //    maximum combined index and verify batches reserved across it.
+        //    (C-4)
+        //
+        //  3 Repeat the thread-safety test of case 11 using threads that
+        //    reserve batches of indices, and validate the state of the buffer
+        //    with 'assertValidState' periodically.  (C-5)
+        //
+        // Testing:
+        //   int reservePushIndices(unsigned *,unsigned *,unsigned *,unsigned);
+        //   int reservePopIndices(unsigned *,unsigned *,unsigned *,unsigned);
+        //   void advanceIndex(unsigned int *, unsigned int *) const;
+        //   CONCERN: batch reservations do not corrupt state
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: 'reservePushIndices', "
+                          << "'reservePopIndices'" << endl
+                          << "================================"
+                          << "===================" << endl;
+
+        if (verbose) cout << "\nTest batches on a capacity 5 buffer" << endl;
+        {
+            bslma::TestAllocator oa;
+            Obj x(5, &oa); const Obj& X = x;
+
+            unsigned int generation  = 99;
+            unsigned int index       = 99;
+            unsigned int numReserved = 99;
+
+            ASSERT(0 != x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            3));
+            ASSERT(99 == generation);
+            ASSERT(99 == index);
+            ASSERT(99 == numReserved);
+
+            ASSERT(0 == x.reservePushIndices(&generation,
+                                             &index,
+                                             &numReserved,
+                                             3));
+            ASSERT(0 == generation);
+            ASSERT(0 == index);
+            ASSERT(3 == numReserved);
+            ASSERT(3 == X.length());
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                if (0 != i) {
+                    X.advanceIndex(&generation, &index);
+                }
+                ASSERTV(i, index,      i == index);
+                ASSERTV(i, generation, 0 == generation);
+                x.commitPushIndex(generation, index);
+            }
+
+            // Only 2 cells remain available.
+
+            ASSERT(0 == x.reservePushIndices(&generation,
+                                             &index,
+                                             &numReserved,
+                                             100));
+            ASSERT(0 == generation);
+            ASSERT(3 == index);
+            ASSERT(2 == numReserved);
+            ASSERT(5 == X.length());
+
+            x.commitPushIndex(generation, index);
+            X.advanceIndex(&generation, &index);
+            ASSERT(0 == generation);
+            ASSERT(4 == index);
+            x.commitPushIndex(generation, index);
+
+            ASSERT(0 < x.reservePushIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            1));
+            ASSERT(0 == generation);
+            ASSERT(4 == index);
+            ASSERT(2 == numReserved);
+
+            ASSERT(0 == x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            2));
+            ASSERT(0 == generation);
+            ASSERT(0 == index);
+            ASSERT(2 == numReserved);
+            ASSERT(3 == X.length());
+
+            x.commitPopIndex(generation, index);
+            X.advanceIndex(&generation, &index);
+            x.commitPopIndex(generation, index);
+
+            // Push a batch wrapping around the end of the buffer.
+
+            ASSERT(0 == x.reservePushIndices(&generation,
+                                             &index,
+                                             &numReserved,
+                                             100));
+            ASSERT(1 == generation);
+            ASSERT(0 == index);
+            ASSERT(2 == numReserved);
+
+            x.commitPushIndex(generation, index);
+            X.advanceIndex(&generation, &index);
+            x.commitPushIndex(generation, index);
+
+            ASSERT(0 == x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            100));
+            ASSERT(0 == generation);
+            ASSERT(2 == index);
+            ASSERT(5 == numReserved);
+            ASSERT(0 == X.length());
+
+            {
+                const unsigned int EXP_GENERATION[] = { 0, 0, 0, 1, 1 };
+                const unsigned int EXP_INDEX[]      = { 2, 3, 4, 0, 1 };
+
+                for (unsigned int i = 0; i < numReserved; ++i) {
+                    if (0 != i) {
+                        X.advanceIndex(&generation, &index);
+                    }
+                    ASSERTV(i, index,      EXP_INDEX[i]      == index);
+                    ASSERTV(i, generation, EXP_GENERATION[i] == generation);
+                    x.commitPopIndex(generation, index);
+                }
+            }
+
+            ASSERT(0 != x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            100));
+
+            // A batch stops at a cell reserved by another push or pop.
+
+            unsigned int singleGeneration, singleIndex;
+            ASSERT(0 == x.reservePushIndex(&singleGeneration, &singleIndex));
+            ASSERT(1 == singleGeneration);
+            ASSERT(2 == singleIndex);
+
+            ASSERT(0 == x.reservePushIndices(&generation,
+                                             &index,
+                                             &numReserved,
+                                             3));
+            ASSERT(1 == generation);
+            ASSERT(3 == index);
+            ASSERT(3 == numReserved);
+
+            const unsigned int batchGeneration = generation;
+            const unsigned int batchIndex      = index;
+
+            x.commitPushIndex(generation, index);        // index 3
+            X.advanceIndex(&generation, &index);
+            X.advanceIndex(&generation, &index);
+            ASSERT(2 == generation);
+            ASSERT(0 == index);
+            x.commitPushIndex(generation, index);        // index 0
+            x.commitPushIndex(singleGeneration, singleIndex);
+
+            // The batch stops at the cell (index 4) still being written.
+
+            ASSERT(0 == x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            5));
+            ASSERT(1 == generation);
+            ASSERT(2 == index);
+            ASSERT(2 == numReserved);
+
+            x.commitPopIndex(generation, index);
+            X.advanceIndex(&generation, &index);
+            x.commitPopIndex(generation, index);
+
+            generation = batchGeneration;
+            index      = batchIndex;
+            X.advanceIndex(&generation, &index);
+            ASSERT(1 == generation);
+            ASSERT(4 == index);
+            x.commitPushIndex(generation, index);        // index 4
+
+            ASSERT(0 == x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            5));
+            ASSERT(1 == generation);
+            ASSERT(4 == index);
+            ASSERT(2 == numReserved);
+
+            x.commitPopIndex(generation, index);
+            X.advanceIndex(&generation, &index);
+            x.commitPopIndex(generation, index);
+            ASSERT(0 == X.length());
+
+            // A disabled queue cannot be pushed, but can be popped.
+
+            ASSERT(0 == x.reservePushIndices(&generation,
+                                             &index,
+                                             &numReserved,
+                                             2));
+            x.commitPushIndex(generation, index);
+            X.advanceIndex(&generation, &index);
+            x.commitPushIndex(generation, index);
+
+            x.disable();
+
+            generation  = 99;
+            index       = 99;
+            numReserved = 99;
+
+            ASSERT(0 > x.reservePushIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            2));
+            ASSERT(99 == generation);
+            ASSERT(99 == index);
+            ASSERT(99 == numReserved);
+
+            ASSERT(0 == x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            5));
+            ASSERT(2 == numReserved);
+            x.commitPopIndex(generation, index);
+            X.advanceIndex(&generation, &index);
+            x.commitPopIndex(generation, index);
+
+            ASSERT(!X.isEnabled());
+            x.enable();
+
+            ASSERT(0 == x.reservePushIndices(&generation,
+                                             &index,
+                                             &numReserved,
+                                             1));
+            ASSERT(1 == numReserved);
+            x.commitPushIndex(generation, index);
+            ASSERT(1 == X.length());
+            ASSERT(X.isEnabled());
+        }
+
+        if (verbose) cout << "\nTest batches across the maximum combined index"
+                          << endl;
+        {
+            bslma::TestAllocator oa;
+            Obj x(4, &oa); const Obj& X = x;
+
+            const unsigned int MAX_COMBINED_INDEX =
+                                        FixedQueueState(&x).maxCombinedIndex();
+
+            dirtyGG(&x, MAX_COMBINED_INDEX - 1, MAX_COMBINED_INDEX - 1);
+
+            const unsigned int EXP_COMBINED_INDEX[] = {
+                MAX_COMBINED_INDEX - 1, MAX_COMBINED_INDEX, 0, 1
+            };
+
+            unsigned int generation, index, numReserved;
+
+            ASSERT(0 == x.reservePushIndices(&generation,
+                                             &index,
+                                             &numReserved,
+                                             4));
+            ASSERT(4 == numReserved);
+            ASSERT(4 == X.length());
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                if (0 != i) {
+                    X.advanceIndex(&generation, &index);
+                }
+                const unsigned int COMBINED = generation * 4 + index;
+                ASSERTV(i, COMBINED, EXP_COMBINED_INDEX[i] == COMBINED);
+                x.commitPushIndex(generation, index);
+            }
+
+            ASSERT(0 == x.reservePopIndices(&generation,
+                                            &index,
+                                            &numReserved,
+                                            10));
+            ASSERT(4 == numReserved);
+
+            for (unsigned int i = 0; i < numReserved; ++i) {
+                if (0 != i) {
+                    X.advanceIndex(&generation, &index);
+                }
+                const unsigned int COMBINED = generation * 4 + index;
+                ASSERTV(i, COMBINED, EXP_COMBINED_INDEX[i] == COMBINED);
+                x.commitPopIndex(generation, index);
+            }
+            ASSERT(0 == X.length());
+
+            ASSERT(0 == x.reservePushIndex(&generation, &index));
+            ASSERT(0 == generation);
+            ASSERT(2 == index);
+            x.commitPushIndex(generation, index);
+            ASSERT(1 == X.length());
+        }
+
+        if (verbose) cout << "\nTest concurrent batch reservations" << endl;
+        {
+            struct {
+                int d_line;
+                int d_capacity;           // queue capacity
+                int d_delayPeriod;        // period with which to insert delays
+                int d_numBatchReaders;    // number of batch reader threads
+                int d_numBatchWriters;    // number of batch writer threads
+                int d_numReaders;         // number of reader threads
+                int d_numWriters;         // number of writer threads
+                int d_numExceptions;      // number of exception threads
+            } DATA[] = {
+
+//               Line Cap Delay BRdrs BWrtrs Rdrs Wrtrs Excps
+//               ============================================
+                { L_,   1,    0,    2,     2,   0,    0,    0 },
+                { L_,  15,    0,    3,     3,   0,    0,    0 },
+                { L_,  15,    0,    2,     2,   2,    2,    0 },
+                { L_,  15,    5,    2,     2,   2,    2,    1 },
+            };
+            const int NUM_DATA = sizeof(DATA) / sizeof(*DATA);
+
+            const int    NUM_PROBES   = 5;
+            const double PROBE_PERIOD = 0.05;
+
+            for (int i = 0; i < NUM_DATA; ++i) {
+                const int LINE           = DATA[i].d_line;
+                const int CAPACITY       = DATA[i].d_capacity;
+                const int DELAY          = DATA[i].d_delayPeriod;
+                const int NUM_B_READERS  = DATA[i].d_numBatchReaders;
+                const int NUM_B_WRITERS  = DATA[i].d_numBatchWriters;
+                const int NUM_READERS    = DATA[i].d_numReaders;
+                const int NUM_WRITERS    = DATA[i].d_numWriters;
+                const int NUM_EXCEPTIONS = DATA[i].d_numExceptions;
+                const int NUM_THREADS    = NUM_B_READERS + NUM_B_WRITERS
+                                         + NUM_READERS   + NUM_WRITERS
+                                         + NUM_EXCEPTIONS;
+
+                if (veryVerbose) { P(LINE); }
+
+                TestThreadStateBarrier state(NUM_THREADS);
+                Obj x(CAPACITY);  const Obj& X = x;
+
+                bsl::vector<bslmt::ThreadUtil::Handle> handles;
+                handles.resize(NUM_THREADS);
+                int thread = 0;
+
+                for (int j = 0; j < NUM_B_WRITERS; ++j, ++thread) {
+                    int rc = bslmt::ThreadUtil::create(
+                                 &handles[thread],
+                                 bdlf::BindUtil::bind(&batchWriterThread,
+                                                      &x,
+                                                      &state,
+                                                      DELAY));
+                    BSLS_ASSERT_OPT(0 == rc); // test invariant
+                }
+                for (int j = 0; j < NUM_B_READERS; ++j, ++thread) {
+                    int rc = bslmt::ThreadUtil::create(
+                                 &handles[thread],
+                                 bdlf::BindUtil::bind(&batchReaderThread,
+                                                      &x,
+                                                      &state,
+                                                      DELAY));
+                    BSLS_ASSERT_OPT(0 == rc); // test invariant
+                }
+                for (int j = 0; j < NUM_WRITERS; ++j, ++thread) {
+                    int rc = bslmt::ThreadUtil::create(
+                                 &handles[thread],
+                                 bdlf::BindUtil::bind(&writerThread,
+                                                      &x,
+                                                      &state,
+                                                      DELAY));
+                    BSLS_ASSERT_OPT(0 == rc); // test invariant
+                }
+                for (int j = 0; j < NUM_READERS; ++j, ++thread) {
+                    int rc = bslmt::ThreadUtil::create(
+                                 &handles[thread],
+                                 bdlf::BindUtil::bind(&readerThread,
+                                                      &x,
+                                                      &state,
+                                                      DELAY));
+                    BSLS_ASSERT_OPT(0 == rc); // test invariant
+                }
+                for (int j = 0; j < NUM_EXCEPTIONS; ++j, ++thread) {
+                    int rc = bslmt::ThreadUtil::create(
+                                 &handles[thread],
+                                 bdlf::BindUtil::bind(&exceptionThread,
+                                                      &x,
+                                                      &state,
+                                                      DELAY));
+                    BSLS_ASSERT_OPT(0 == rc); // test invariant
+                }
+
+                state.continueTest();
+
+                for (int j = 0; j < NUM_PROBES; ++j) {
+                    bslmt::ThreadUtil::sleep(bsls::TimeInterval(PROBE_PERIOD));
+                    state.suspendTest();
+                    assertValidState(&x);
+                    if (veryVeryVerbose) {
+                        P(X);
+                    }
+                    state.continueTest();
+                }
+                state.exitTest();
+
+                for (int j = 0; j < NUM_THREADS; ++j) {
+                    bslmt::ThreadUtil::join(handles[j]);
+                }
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // CONCERN: maxCombinedIndex
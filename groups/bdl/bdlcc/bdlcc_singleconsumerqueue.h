@@ -29,6 +29,13 @@ BSLS_IDENT("$Id: $")
 // provided.  The 'tryPopFront' method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Elements may also be pushed and popped in batches using 'pushBackBatch',
+// 'popFrontBatch', and 'tryPopFrontBatch'.  When enough nodes are available,
+// 'pushBackBatch' reserves all the nodes for a batch with a single atomic
+// operation, and wakes a blocked consumer at most once per batch, which
+// reduces the per-element cost of moving bursts of elements through the
+// queue.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -230,6 +237,23 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
         // undefined unless the invoker of this method is the single consumer.
 
+    int popFrontBatch(TYPE        *values,
+                      bsl::size_t  maxNumValues,
+                      bsl::size_t *numPopped);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array of 'maxNumValues'
+        // elements starting at the specified 'values', and load into the
+        // specified 'numPopped' the number of elements removed.  If the queue
+        // is empty, block until it is not empty, and then remove the first
+        // element and, without blocking, as many of the following elements as
+        // are available.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_DISABLED' if 'isPopFrontDisabled()'.  On
+        // failure, load 0 into 'numPopped' and leave 'values' unchanged.
+        // Threads blocked due to the queue being empty will return
+        // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
+        // undefined unless '0 < maxNumValues' and the invoker of this method
+        // is the single consumer.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -242,6 +266,20 @@ class SingleConsumerQueue {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    int pushBackBatch(const TYPE  *values,
+                      bsl::size_t  numValues,
+                      bsl::size_t *numPushed = 0);
+        // Append, in order, the specified 'numValues' elements of the array
+        // starting at the specified 'values' to the back of this queue, and
+        // load into the optionally specified 'numPushed' the number of
+        // elements appended.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()' (in which case some of the elements may have
+        // been appended).  The elements of a batch are contiguous in this
+        // queue, unless the queue must allocate memory to hold them, in which
+        // case elements pushed concurrently by other threads may be
+        // interleaved with them.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -259,6 +297,21 @@ class SingleConsumerQueue {
         // behavior is undefined unless the invoker of this method is the
         // single consumer.
 
+    int tryPopFrontBatch(TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bsl::size_t *numPopped);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, load them, in order, into
+        // the array of 'maxNumValues' elements starting at the specified
+        // 'values', and load into the specified 'numPopped' the number of
+        // elements removed.  Return 0 on success (at least one element was
+        // removed), and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure, load
+        // 0 into 'numPopped' and leave 'values' unchanged.  The behavior is
+        // undefined unless '0 < maxNumValues' and the invoker of this method
+        // is the single consumer.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -361,6 +414,14 @@ int SingleConsumerQueue<TYPE>::popFront(TYPE *value)
     return d_impl.popFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::popFrontBatch(TYPE        *values,
+                                             bsl::size_t  maxNumValues,
+                                             bsl::size_t *numPopped)
+{
+    return d_impl.popFrontBatch(values, maxNumValues, numPopped);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -373,6 +434,14 @@ int SingleConsumerQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return d_impl.pushBack(bslmf::MovableRefUtil::move(value));
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::pushBackBatch(const TYPE  *values,
+                                             bsl::size_t  numValues,
+                                             bsl::size_t *numPushed)
+{
+    return d_impl.pushBackBatch(values, numValues, numPushed);
+}
+
 template <class TYPE>
 void SingleConsumerQueue<TYPE>::removeAll()
 {
@@ -385,6 +454,14 @@ int SingleConsumerQueue<TYPE>::tryPopFront(TYPE *value)
     return d_impl.tryPopFront(value);
 }
 
+template <class TYPE>
+int SingleConsumerQueue<TYPE>::tryPopFrontBatch(TYPE        *values,
+                                                bsl::size_t  maxNumValues,
+                                                bsl::size_t *numPopped)
+{
+    return d_impl.tryPopFrontBatch(values, maxNumValues, numPopped);
+}
+
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::tryPushBack(const TYPE& value)
 {
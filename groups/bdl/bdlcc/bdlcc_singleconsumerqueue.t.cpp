@@ -79,10 +79,13 @@ using namespace bsl;
 // [ 5] SingleConsumerQueue(capacity, *bA = 0);
 // [ 2] ~SingleConsumerQueue();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBackBatch(const TYPE *, bsl::size_t, bsl::size_t * = 0);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
 // [ 6] void disablePopFront();
@@ -98,7 +101,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -872,7 +875,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -910,6 +913,79 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH OPERATIONS
+        //   Ensure the batch manipulators forward correctly.
+        //
+        // Concerns:
+        //: 1 The batch manipulators forward their arguments to the
+        //:   implementation correctly and return its result.
+        //
+        // Plan:
+        //: 1 Push and pop batches of elements, including in the disabled
+        //:   states, and verify the values and counts returned.  (C-1)
+        //
+        // Testing:
+        //   int popFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
+        //   int pushBackBatch(const TYPE *, bsl::size_t, bsl::size_t * = 0);
+        //   int tryPopFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH OPERATIONS" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        AllocObj mX(2, &sa);  const AllocObj& X = mX;
+
+        const bsl::string VALUES[] = {
+            "a", "b", "a string long enough to allocate memory", "d"
+        };
+
+        bsl::string results[4];
+        bsl::size_t numPushed = 0;
+        bsl::size_t numPopped = 0;
+
+        ASSERT(e_EMPTY == mX.tryPopFrontBatch(results, 4, &numPopped));
+        ASSERT(0 == numPopped);
+
+        ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 4, &numPushed));
+        ASSERT(4 == numPushed);
+        ASSERT(4 == X.numElements());
+
+        ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results, 3, &numPopped));
+        ASSERT(3 == numPopped);
+        for (int i = 0; i < 3; ++i) {
+            ASSERTV(i, VALUES[i] == results[i]);
+        }
+
+        ASSERT(e_SUCCESS == mX.popFrontBatch(results, 4, &numPopped));
+        ASSERT(1 == numPopped);
+        ASSERT(VALUES[3] == results[0]);
+        ASSERT(X.isEmpty());
+
+        mX.disablePushBack();
+        ASSERT(e_DISABLED == mX.pushBackBatch(VALUES, 4, &numPushed));
+        ASSERT(0 == numPushed);
+        mX.enablePushBack();
+
+        ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 4));
+
+        mX.disablePopFront();
+        ASSERT(e_DISABLED == mX.tryPopFrontBatch(results, 4, &numPopped));
+        ASSERT(0 == numPopped);
+        ASSERT(e_DISABLED == mX.popFrontBatch(results, 4, &numPopped));
+        ASSERT(0 == numPopped);
+        mX.enablePopFront();
+
+        ASSERT(e_SUCCESS == mX.popFrontBatch(results, 4, &numPopped));
+        ASSERT(4 == numPopped);
+        for (int i = 0; i < 4; ++i) {
+            ASSERTV(i, VALUES[i] == results[i]);
+        }
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
@@ -29,6 +29,13 @@ BSLS_IDENT("$Id: $")
 // provided.  The 'tryPopFront' method fails immediately, returning a non-zero
 // value, if the queue is empty.
 //
+// Elements may also be pushed and popped in batches using 'pushBackBatch',
+// 'popFrontBatch', and 'tryPopFrontBatch'.  When enough nodes are available,
+// 'pushBackBatch' reserves all the nodes for a batch with a single atomic
+// operation on the queue's state, and wakes a blocked consumer at most once
+// per batch; 'popFrontBatch' and 'tryPopFrontBatch' return all the nodes of a
+// batch to the producers with a single atomic operation.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  The queue may be restored to normal
@@ -209,6 +216,117 @@ class SingleConsumerQueueImpl_PopCompleteGuard {
         // managed queue.
 };
 
+           // ===================================================
+           // class SingleConsumerQueueImpl_PopBatchCompleteGuard
+           // ===================================================
+
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_PopBatchCompleteGuard {
+    // This class implements a guard that pops a contiguous range of readable
+    // nodes from the front of the managed queue, destroying the value in each,
+    // and upon destruction pops any nodes of the range remaining and invokes
+    // 'popBatchComplete' on the managed queue.
+
+    // DATA
+    TYPE               *d_queue_p;        // managed queue owning the nodes
+
+    NODE               *d_node_p;         // next node to pop
+
+    bsl::size_t         d_numRemaining;   // number of nodes remaining to pop
+
+    bsls::Types::Int64  d_numNodes;       // number of nodes popped
+
+    bsls::Types::Int64  d_numReclaimed;   // number of reclaimed nodes popped
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PopBatchCompleteGuard();
+    SingleConsumerQueueImpl_PopBatchCompleteGuard(
+                         const SingleConsumerQueueImpl_PopBatchCompleteGuard&);
+    SingleConsumerQueueImpl_PopBatchCompleteGuard& operator=(
+                         const SingleConsumerQueueImpl_PopBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    SingleConsumerQueueImpl_PopBatchCompleteGuard(
+                                        TYPE               *queue,
+                                        NODE               *node,
+                                        bsl::size_t         numNodes,
+                                        bsls::Types::Int64  numReclaimed);
+        // Create a guard managing the range of the specified 'numNodes'
+        // readable nodes of the specified 'queue' starting at the specified
+        // 'node', the front of 'queue', which has already popped the specified
+        // 'numReclaimed' reclaimed nodes.
+
+    ~SingleConsumerQueueImpl_PopBatchCompleteGuard();
+        // Destroy this object, pop the nodes of the managed range that have
+        // not been popped, and invoke the 'popBatchComplete' method on the
+        // managed queue.
+
+    // MANIPULATORS
+    void next();
+        // Pop the node returned by 'node()'.  The behavior is undefined unless
+        // at least one node of the managed range has not been popped.
+
+    // ACCESSORS
+    NODE *node() const;
+        // Return the next node of the managed range to be popped.
+};
+
+           // ====================================================
+           // class SingleConsumerQueueImpl_PushBatchCompleteGuard
+           // ====================================================
+
+template <class TYPE, class NODE>
+class SingleConsumerQueueImpl_PushBatchCompleteGuard {
+    // This class implements a guard that tracks the writing of a contiguous
+    // range of nodes reserved in the managed queue, and upon destruction
+    // invokes 'pushBatchComplete' on the managed queue with the nodes of the
+    // range that were not written.
+
+    // DATA
+    TYPE        *d_queue_p;          // managed queue owning the nodes
+
+    NODE        *d_node_p;           // next node to write
+
+    bsl::size_t  d_numRemaining;     // number of nodes remaining to write
+
+    bool         d_isReaderBlocked;  // 'true' if the consumer was blocked on
+                                     // a written node
+
+    // NOT IMPLEMENTED
+    SingleConsumerQueueImpl_PushBatchCompleteGuard();
+    SingleConsumerQueueImpl_PushBatchCompleteGuard(
+                        const SingleConsumerQueueImpl_PushBatchCompleteGuard&);
+    SingleConsumerQueueImpl_PushBatchCompleteGuard& operator=(
+                        const SingleConsumerQueueImpl_PushBatchCompleteGuard&);
+
+  public:
+    // CREATORS
+    SingleConsumerQueueImpl_PushBatchCompleteGuard(TYPE        *queue,
+                                                   NODE        *node,
+                                                   bsl::size_t  numNodes);
+        // Create a guard managing the range of the specified 'numNodes' nodes
+        // of the specified 'queue', reserved for writing, starting at the
+        // specified 'node'.
+
+    ~SingleConsumerQueueImpl_PushBatchCompleteGuard();
+        // Destroy this object and invoke the 'pushBatchComplete' method on the
+        // managed queue with the nodes of the managed range not yet written.
+
+    // MANIPULATORS
+    void next(NODE *node, bool isReaderBlocked);
+        // Record that the node returned by 'node()' has been written, and that
+        // the specified 'node' is the next node of the managed range.  If the
+        // specified 'isReaderBlocked' is 'true', the consumer was blocked on
+        // the written node and is signaled upon destruction of this guard.
+        // The behavior is undefined unless at least one node of the managed
+        // range has not been written.
+
+    // ACCESSORS
+    NODE *node() const;
+        // Return the next node of the managed range to be written.
+};
+
                       // =============================
                       // class SingleConsumerQueueImpl
                       // =============================
@@ -334,6 +452,26 @@ class SingleConsumerQueueImpl {
                                                                   MUTEX,
                                                                   CONDITION> >;
 
+    friend class SingleConsumerQueueImpl_PopBatchCompleteGuard<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
+    friend class SingleConsumerQueueImpl_PushBatchCompleteGuard<
+                           SingleConsumerQueueImpl<TYPE,
+                                                   ATOMIC_OP,
+                                                   MUTEX,
+                                                   CONDITION>,
+                           typename SingleConsumerQueueImpl<TYPE,
+                                                            ATOMIC_OP,
+                                                            MUTEX,
+                                                            CONDITION>::Node >;
+
     // PRIVATE CLASS METHODS
     static bsls::Types::Int64 available(bsls::Types::Int64 state);
         // Return the available attribute from the specified 'state'.
@@ -348,6 +486,37 @@ class SingleConsumerQueueImpl {
         // then signal the queue empty condition.  This method is used to
         // complete the reclamation of a node in the presence of an exception.
 
+    void popBatchComplete(bsls::Types::Int64 numNodes,
+                          bsls::Types::Int64 numReclaimed);
+        // Make the specified 'numNodes' nodes, popped using 'popNode' and
+        // including the specified 'numReclaimed' reclaimed nodes, available
+        // to producers, and if the queue is empty then signal the queue empty
+        // condition.
+
+    Node *popNode(Node *node, bool destruct);
+        // If the specified 'destruct' is true, destruct the value stored in
+        // the specified 'node'.  Mark 'node' writable, advance 'd_nextRead'
+        // past 'node', and return the node following 'node'.  The behavior is
+        // undefined unless 'node' is 'd_nextRead'.  Note that the node is not
+        // available to producers until 'popBatchComplete' is invoked.
+
+    void pushBatchComplete(Node        *node,
+                           bsl::size_t  numUnwritten,
+                           bool         isReaderBlocked);
+        // Mark the specified 'numUnwritten' nodes, starting at the specified
+        // 'node', as nodes to be reclaimed, and, if the specified
+        // 'isReaderBlocked' is 'true', signal the consumer.  This method is
+        // used to complete a batch push, including in the presence of an
+        // exception.
+
+    Node *pushBackBatchHelper(bsl::size_t *numNodes);
+        // Reserve up to the specified 'numNodes' consecutive nodes to assign
+        // the values being pushed into this queue, load into 'numNodes' the
+        // number of nodes reserved, and return a pointer to the first of them,
+        // or return 0 if 'isPushBackDisabled()'.  The behavior is undefined
+        // unless '0 < *numNodes'.  Note that more than one node is reserved
+        // only if that many nodes are available without allocation.
+
     Node *pushBackHelper();
         // Return a pointer to the node to assign the value being pushed into
         // this queue, or 0 if 'isPushBackDisabled()'.
@@ -413,6 +582,23 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
         // undefined unless the invoker of this method is the single consumer.
 
+    int popFrontBatch(TYPE        *values,
+                      bsl::size_t  maxNumValues,
+                      bsl::size_t *numPopped);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array of 'maxNumValues'
+        // elements starting at the specified 'values', and load into the
+        // specified 'numPopped' the number of elements removed.  If the queue
+        // is empty, block until it is not empty, and then remove the first
+        // element and, without blocking, as many of the following elements as
+        // are available.  Return 0 on success, and a non-zero value otherwise.
+        // Specifically, return 'e_DISABLED' if 'isPopFrontDisabled()'.  On
+        // failure, load 0 into 'numPopped' and leave 'values' unchanged.
+        // Threads blocked due to the queue being empty will return
+        // 'e_DISABLED' if 'disablePopFront' is invoked.  The behavior is
+        // undefined unless '0 < maxNumValues' and the invoker of this method
+        // is the single consumer.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -425,6 +611,21 @@ class SingleConsumerQueueImpl {
         // 'e_DISABLED' if 'isPushBackDisabled()'.  On failure, 'value' is not
         // changed.
 
+    int pushBackBatch(const TYPE  *values,
+                      bsl::size_t  numValues,
+                      bsl::size_t *numPushed = 0);
+        // Append, in order, the specified 'numValues' elements of the array
+        // starting at the specified 'values' to the back of this queue, and
+        // load into the optionally specified 'numPushed' the number of
+        // elements appended.  Return 0 on success, and a non-zero value
+        // otherwise.  Specifically, return 'e_DISABLED' if
+        // 'isPushBackDisabled()' (in which case some of the elements may have
+        // been appended).  The elements of a batch are contiguous in this
+        // queue, unless the queue must allocate nodes to hold them, in which
+        // case elements pushed concurrently by other threads may be
+        // interleaved with them.  If an exception is thrown, the elements of
+        // 'values' already appended remain in this queue.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -442,6 +643,23 @@ class SingleConsumerQueueImpl {
         // behavior is undefined unless the invoker of this method is the
         // single consumer.
 
+    int tryPopFrontBatch(TYPE        *values,
+                         bsl::size_t  maxNumValues,
+                         bsl::size_t *numPopped);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, load them, in order, into
+        // the array of 'maxNumValues' elements starting at the specified
+        // 'values', and load into the specified 'numPopped' the number of
+        // elements removed.  Return 0 on success (at least one element was
+        // removed), and a non-zero value otherwise.  Specifically, return
+        // 'e_DISABLED' if 'isPopFrontDisabled()', and 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty.  On failure, load
+        // 0 into 'numPopped' and leave 'values' unchanged.  If an exception is
+        // thrown while assigning an element, all the elements of the batch
+        // being removed are destroyed and removed from the queue.  The
+        // behavior is undefined unless '0 < maxNumValues' and the invoker of
+        // this method is the single consumer.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, retun
@@ -593,6 +811,99 @@ SingleConsumerQueueImpl_PopCompleteGuard<TYPE>::
     d_queue_p->popComplete(true);
 }
 
+           // ---------------------------------------------------
+           // class SingleConsumerQueueImpl_PopBatchCompleteGuard
+           // ---------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::
+                                 SingleConsumerQueueImpl_PopBatchCompleteGuard(
+                                        TYPE               *queue,
+                                        NODE               *node,
+                                        bsl::size_t         numNodes,
+                                        bsls::Types::Int64  numReclaimed)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_numRemaining(numNodes)
+, d_numNodes(numReclaimed)
+, d_numReclaimed(numReclaimed)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::
+                               ~SingleConsumerQueueImpl_PopBatchCompleteGuard()
+{
+    while (d_numRemaining) {
+        next();
+    }
+    d_queue_p->popBatchComplete(d_numNodes, d_numReclaimed);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+void SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::next()
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    d_node_p = d_queue_p->popNode(d_node_p, true);
+    --d_numRemaining;
+    ++d_numNodes;
+}
+
+// ACCESSORS
+template <class TYPE, class NODE>
+NODE *SingleConsumerQueueImpl_PopBatchCompleteGuard<TYPE, NODE>::node() const
+{
+    return d_node_p;
+}
+
+           // ----------------------------------------------------
+           // class SingleConsumerQueueImpl_PushBatchCompleteGuard
+           // ----------------------------------------------------
+
+// CREATORS
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushBatchCompleteGuard<TYPE, NODE>::
+                                SingleConsumerQueueImpl_PushBatchCompleteGuard(
+                                                         TYPE        *queue,
+                                                         NODE        *node,
+                                                         bsl::size_t  numNodes)
+: d_queue_p(queue)
+, d_node_p(node)
+, d_numRemaining(numNodes)
+, d_isReaderBlocked(false)
+{
+}
+
+template <class TYPE, class NODE>
+SingleConsumerQueueImpl_PushBatchCompleteGuard<TYPE, NODE>::
+                              ~SingleConsumerQueueImpl_PushBatchCompleteGuard()
+{
+    d_queue_p->pushBatchComplete(d_node_p, d_numRemaining, d_isReaderBlocked);
+}
+
+// MANIPULATORS
+template <class TYPE, class NODE>
+void SingleConsumerQueueImpl_PushBatchCompleteGuard<TYPE, NODE>::next(
+                                                      NODE *node,
+                                                      bool  isReaderBlocked)
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    d_node_p = node;
+    --d_numRemaining;
+    d_isReaderBlocked = d_isReaderBlocked || isReaderBlocked;
+}
+
+// ACCESSORS
+template <class TYPE, class NODE>
+NODE *SingleConsumerQueueImpl_PushBatchCompleteGuard<TYPE, NODE>::node() const
+{
+    return d_node_p;
+}
+
                       // -----------------------------
                       // class SingleConsumerQueueImpl
                       // -----------------------------
@@ -653,6 +964,146 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                            ::popBatchComplete(bsls::Types::Int64 numNodes,
+                                               bsls::Types::Int64 numReclaimed)
+{
+    if (numReclaimed) {
+        ATOMIC_OP::addInt64AcqRel(&d_capacity, numReclaimed);
+    }
+
+    if (0 == numNodes) {
+        return;                                                       // RETURN
+    }
+
+    bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(
+                                                  &d_state,
+                                                  k_AVAILABLE_INC * numNodes);
+
+    if (ATOMIC_OP::getInt64Acquire(&d_capacity) == available(state)) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_emptyMutex);
+        }
+        d_emptyCondition.broadcast();
+    }
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
+                     SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                           ::popNode(Node *node, bool destruct)
+{
+    if (destruct) {
+        node->d_value.object().~TYPE();
+    }
+
+    Node *next = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&node->d_next));
+
+    ATOMIC_OP::setIntRelease(&node->d_state, e_WRITABLE);
+    ATOMIC_OP::setPtrRelease(&d_nextRead, next);
+
+    return next;
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                              ::pushBatchComplete(Node        *node,
+                                                  bsl::size_t  numUnwritten,
+                                                  bool         isReaderBlocked)
+{
+    // Note that the next node is loaded before a node is marked, since the
+    // consumer may reclaim the node, and a producer may then reuse it, as
+    // soon as it is marked.
+
+    while (numUnwritten) {
+        Node *next =
+                  static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&node->d_next));
+        markReclaim(node);
+        node = next;
+        --numUnwritten;
+    }
+
+    if (isReaderBlocked) {
+        {
+            bslmt::LockGuard<MUTEX> guard(&d_readMutex);
+        }
+        d_readCondition.signal();
+    }
+}
+
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
+                     SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                  ::pushBackBatchHelper(bsl::size_t *numNodes)
+{
+    BSLS_ASSERT(0 < *numNodes);
+
+    if (1 == (ATOMIC_OP::getUintAcquire(&d_pushBackDisabled) & 1)) {
+        return 0;                                                     // RETURN
+    }
+
+    bsls::Types::Int64 count = static_cast<bsls::Types::Int64>(*numNodes);
+
+    if (1 < count) {
+        const bsls::Types::Int64 avail =
+                             available(ATOMIC_OP::getInt64Acquire(&d_state));
+        if (avail < count) {
+            count = avail;
+        }
+    }
+
+    if (1 < count) {
+        // Attempt to use 'count' existing nodes with a single update of the
+        // state, as in the fast path of 'pushBackHelper'.
+
+        const bsls::Types::Int64 delta = k_USE_INC - k_AVAILABLE_INC * count;
+
+        bsls::Types::Int64 state = ATOMIC_OP::addInt64NvAcqRel(&d_state,
+                                                               delta);
+
+        if (0 <= state && 0 == (state & k_ALLOCATE_MASK)) {
+            // Note that no thread can allocate a node while this thread is
+            // using existing nodes, so the 'count' nodes following
+            // 'd_nextWrite' are stable and may be claimed with a single
+            // 'testAndSwap'.
+
+            Node *nextWrite = static_cast<Node *>(
+                                       ATOMIC_OP::getPtrAcquire(&d_nextWrite));
+            Node *expNextWrite;
+            do {
+                expNextWrite = nextWrite;
+
+                Node *end = nextWrite;
+                for (bsls::Types::Int64 i = 0; i < count; ++i) {
+                    end = static_cast<Node *>(
+                                    ATOMIC_OP::getPtrAcquire(&end->d_next));
+                }
+
+                nextWrite = static_cast<Node *>(
+                                    ATOMIC_OP::testAndSwapPtrAcqRel(
+                                                                  &d_nextWrite,
+                                                                  nextWrite,
+                                                                  end));
+            } while (nextWrite != expNextWrite);
+
+            ATOMIC_OP::addInt64AcqRel(&d_state, -k_USE_INC);
+
+            *numNodes = static_cast<bsl::size_t>(count);
+
+            return nextWrite;                                         // RETURN
+        }
+
+        // The nodes were taken by other threads; undo the indication.
+
+        ATOMIC_OP::addInt64AcqRel(&d_state, -delta);
+    }
+
+    *numNodes = 1;
+
+    return pushBackHelper();
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 typename SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::Node *
                      SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
@@ -950,6 +1401,34 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFrontBatch(
+                                                    TYPE        *values,
+                                                    bsl::size_t  maxNumValues,
+                                                    bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    int rc = popFront(values);
+    if (0 != rc) {
+        *numPopped = 0;
+        return rc;                                                    // RETURN
+    }
+
+    *numPopped = 1;
+
+    if (1 < maxNumValues) {
+        bsl::size_t numMore;
+        if (0 == tryPopFrontBatch(values + 1, maxNumValues - 1, &numMore)) {
+            *numPopped += numMore;
+        }
+    }
+
+    return 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
                                                              const TYPE& value)
@@ -1019,6 +1498,69 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBack(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::pushBackBatch(
+                                                     const TYPE  *values,
+                                                     bsl::size_t  numValues,
+                                                     bsl::size_t *numPushed)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t numDone = 0;
+    int         rc      = 0;
+
+    while (numDone < numValues) {
+        bsl::size_t numNodes = numValues - numDone;
+
+        Node *target = pushBackBatchHelper(&numNodes);
+
+        if (0 == target) {
+            rc = e_DISABLED;
+            break;
+        }
+
+        // The guard marks any nodes not written (due to an exception) for
+        // reclamation, and signals the consumer once, if it was blocked on any
+        // of the written nodes.
+
+        SingleConsumerQueueImpl_PushBatchCompleteGuard<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node> guard(this,
+                                                        target,
+                                                        numNodes);
+
+        for (bsl::size_t i = 0; i < numNodes; ++i) {
+            Node *node = guard.node();
+
+            bslalg::ScalarPrimitives::copyConstruct(node->d_value.address(),
+                                                    values[numDone + i],
+                                                    d_allocator_p);
+
+            // Note that the next node must be loaded before the node is made
+            // readable (see 'pushBatchComplete').
+
+            Node *next =
+                  static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&node->d_next));
+
+            int nodeState = ATOMIC_OP::swapIntAcqRel(&node->d_state,
+                                                     e_READABLE);
+
+            guard.next(next, e_WRITABLE_AND_BLOCKED == nodeState);
+        }
+
+        numDone += numNodes;
+    }
+
+    if (numPushed) {
+        *numPushed = numDone;
+    }
+
+    return rc;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::removeAll()
 {
@@ -1092,6 +1634,75 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPopFront(
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                  ::tryPopFrontBatch(TYPE        *values,
+                                                     bsl::size_t  maxNumValues,
+                                                     bsl::size_t *numPopped)
+{
+    BSLS_ASSERT(values);
+    BSLS_ASSERT(0 < maxNumValues);
+    BSLS_ASSERT(numPopped);
+
+    unsigned int generation = ATOMIC_OP::getUintAcquire(&d_popFrontDisabled);
+    if (1 == (generation & 1)) {
+        *numPopped = 0;
+        return e_DISABLED;                                            // RETURN
+    }
+
+    Node *nextRead =
+                    static_cast<Node *>(ATOMIC_OP::getPtrAcquire(&d_nextRead));
+    int nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+
+    bsls::Types::Int64 numReclaimed = 0;
+    while (e_RECLAIM == nodeState) {
+        nextRead  = popNode(nextRead, false);
+        nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+        ++numReclaimed;
+    }
+
+    // Determine the range of consecutive readable nodes to pop.
+
+    bsl::size_t numValues = 0;
+    Node       *node      = nextRead;
+    while (e_READABLE == nodeState) {
+        ++numValues;
+        if (numValues == maxNumValues) {
+            break;
+        }
+        node      = static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
+                                                              &node->d_next));
+        nodeState = ATOMIC_OP::getIntAcquire(&node->d_state);
+    }
+
+    // The guard pops the nodes of the range, even if an assignment throws, and
+    // makes all the popped nodes available to producers at once.
+
+    SingleConsumerQueueImpl_PopBatchCompleteGuard<
+                                            SingleConsumerQueueImpl<TYPE,
+                                                                    ATOMIC_OP,
+                                                                    MUTEX,
+                                                                    CONDITION>,
+                                            Node> guard(this,
+                                                        nextRead,
+                                                        numValues,
+                                                        numReclaimed);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[i] = bslmf::MovableRefUtil::move(
+                                              guard.node()->d_value.object());
+#else
+        values[i] = guard.node()->d_value.object();
+#endif
+        guard.next();
+    }
+
+    *numPopped = numValues;
+
+    return 0 == numValues ? e_EMPTY : 0;
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::tryPushBack(
                                                              const TYPE& value)
@@ -26,6 +26,7 @@
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
@@ -77,10 +78,13 @@ using namespace bsl;
 // [ 5] SingleConsumerQueueImpl(capacity, *bA = 0);
 // [ 2] ~SingleConsumerQueueImpl();
 // [ 2] int popFront(TYPE *value);
+// [13] int popFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
 // [ 2] int pushBack(const TYPE& value);
 // [10] int pushBack(bslmf::MovableRef<TYPE> value);
+// [13] int pushBackBatch(const TYPE *, bsl::size_t, bsl::size_t * = 0);
 // [ 2] void removeAll();
 // [ 8] int tryPopFront(TYPE *value);
+// [13] int tryPopFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
 // [ 7] int tryPushBack(const TYPE& value);
 // [10] int tryPushBack(bslmf::MovableRef<TYPE> value);
 // [ 6] void disablePopFront();
@@ -102,6 +106,7 @@ using namespace bsl;
 // [10] CONCERN: 'popFront' and 'tryPopFront' honor move-semantics
 // [11] CONCERN: template requirements
 // [12] CONCERN: ordering guarantee
+// [13] CONCERN: batch operations preserve order and exception safety
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -205,6 +210,67 @@ class AllocExceptionHelper {
     }
 };
 
+#ifdef BDE_BUILD_TARGET_EXC
+                        // ===========================
+                        // struct BatchExceptionHelper
+                        // ===========================
+
+struct BatchExceptionHelper {
+    // This 'struct' counts its live instances and throws an 'int' from its
+    // copy constructor and copy-assignment operator once
+    // 's_numCopiesBeforeThrow' copies have been made (if it is not negative).
+
+    // CLASS DATA
+    static int s_numCopiesBeforeThrow;  // copies allowed before throwing
+    static int s_numLive;               // number of live instances
+
+    // DATA
+    int d_value;
+
+    // CLASS METHODS
+    static void copy()
+        // Throw an 'int' if no more copies are allowed.
+    {
+        if (0 == s_numCopiesBeforeThrow) {
+            throw 0;
+        }
+        if (0 < s_numCopiesBeforeThrow) {
+            --s_numCopiesBeforeThrow;
+        }
+    }
+
+    // CREATORS
+    BatchExceptionHelper(int value = 0)                             // IMPLICIT
+    : d_value(value)
+    {
+        ++s_numLive;
+    }
+
+    BatchExceptionHelper(const BatchExceptionHelper& original)
+    : d_value(original.d_value)
+    {
+        copy();
+        ++s_numLive;
+    }
+
+    ~BatchExceptionHelper()
+    {
+        --s_numLive;
+    }
+
+    // MANIPULATORS
+    BatchExceptionHelper& operator=(const BatchExceptionHelper& rhs)
+    {
+        copy();
+        d_value = rhs.d_value;
+        return *this;
+    }
+};
+
+int BatchExceptionHelper::s_numCopiesBeforeThrow = -1;
+int BatchExceptionHelper::s_numLive              = 0;
+#endif
+
                                 // ==========
                                 // MoveTester
                                 // ==========
@@ -562,6 +628,40 @@ extern "C" void *orderingPush(void *arg)
     return 0;
 }
 
+struct BatchPushData {
+    Obj *d_obj_p;       // queue to push into
+    int  d_id;          // identifies the values pushed by this thread
+    int  d_numValues;   // number of values to push
+    int  d_batchSize;   // number of values per batch
+};
+
+extern "C" void *batchPush(void *arg)
+    // Push 'd_numValues' consecutive values, starting at
+    // 'd_id * d_numValues', in batches of 'd_batchSize' values, into the
+    // queue described by the specified 'arg'.
+{
+    BatchPushData& data = *static_cast<BatchPushData *>(arg);
+
+    bsl::vector<int> values(data.d_batchSize);
+
+    for (int i = 0; i < data.d_numValues; i += data.d_batchSize) {
+        const int numInBatch = bsl::min(data.d_batchSize,
+                                        data.d_numValues - i);
+
+        for (int j = 0; j < numInBatch; ++j) {
+            values[j] = data.d_id * data.d_numValues + i + j;
+        }
+
+        bsl::size_t numPushed = 0;
+        ASSERT(0 == data.d_obj_p->pushBackBatch(values.data(),
+                                                numInBatch,
+                                                &numPushed));
+        ASSERT(static_cast<bsl::size_t>(numInBatch) == numPushed);
+    }
+
+    return 0;
+}
+
 extern "C" void *orderingState(void *arg)
 {
     OrderingObj& mX = *static_cast<OrderingObj *>(arg);
@@ -805,6 +905,258 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 13: {
+        // ---------------------------------------------------------
+        // Batch Operations Test
+        //   The batch methods push and pop several elements at once.
+        //
+        // Concerns:
+        //: 1 'pushBackBatch' appends all the elements, in order, using
+        //:   existing nodes without allocation when enough are available,
+        //:   and allocating nodes otherwise.
+        //:
+        //: 2 'tryPopFrontBatch' removes, in order, up to the requested
+        //:   number of elements, and fails if the queue is empty.
+        //:
+        //: 3 'popFrontBatch' blocks until an element is available.
+        //:
+        //: 4 The batch methods honor the disabled states.
+        //:
+        //: 5 Concurrent batch pushes preserve the order of the elements
+        //:   pushed by each thread.
+        //:
+        //: 6 If an element's copy constructor throws during 'pushBackBatch',
+        //:   the elements already copied remain in the queue and the nodes
+        //:   not written are reclaimed.  If an element's assignment throws
+        //:   during 'tryPopFrontBatch', the elements of the batch are
+        //:   removed and destroyed.
+        //
+        // Plan:
+        //: 1 Push and pop batches of various sizes in a single thread and
+        //:   verify the values, the number of elements, and the allocations.
+        //:   (C-1,2,4)
+        //:
+        //: 2 Use threads pushing batches of tagged values while the main
+        //:   thread pops with 'popFrontBatch' and verifies the per-thread
+        //:   order.  (C-3,5)
+        //:
+        //: 3 Use 'BatchExceptionHelper' to inject exceptions and verify the
+        //:   state of the queue and the number of live elements.  (C-6)
+        //
+        // Testing:
+        //   int popFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
+        //   int pushBackBatch(const TYPE *, bsl::size_t, bsl::size_t * = 0);
+        //   int tryPopFrontBatch(TYPE *, bsl::size_t, bsl::size_t *);
+        //   CONCERN: batch operations preserve order and exception safety
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "Batch Operations Test" << endl
+                          << "=====================" << endl;
+
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(4, &sa);  const Obj& X = mX;
+
+            const int   VALUES[] = { 1, 2, 3, 4, 5, 6, 7 };
+            int         results[8];
+            bsl::size_t numPushed = 99;
+            bsl::size_t numPopped = 99;
+
+            bsls::Types::Int64 na = sa.numAllocations();
+
+            ASSERT(e_EMPTY == mX.tryPopFrontBatch(results, 8, &numPopped));
+            ASSERT(0 == numPopped);
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 0, &numPushed));
+            ASSERT(0 == numPushed);
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 3, &numPushed));
+            ASSERT(3 == numPushed);
+            ASSERT(3 == X.numElements());
+            ASSERT(na == sa.numAllocations());
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results, 2, &numPopped));
+            ASSERT(2 == numPopped);
+            ASSERT(1 == results[0]);
+            ASSERT(2 == results[1]);
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results, 8, &numPopped));
+            ASSERT(1 == numPopped);
+            ASSERT(3 == results[0]);
+            ASSERT(X.isEmpty());
+            ASSERT(e_SUCCESS == X.waitUntilEmpty());
+
+            // More elements than available nodes.
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 7));
+            ASSERT(7 == X.numElements());
+            ASSERT(na < sa.numAllocations());
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(results, 8, &numPopped));
+            ASSERT(7 == numPopped);
+            for (int i = 0; i < 7; ++i) {
+                ASSERTV(i, results[i], VALUES[i] == results[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            // Now all the nodes are available.
+
+            na = sa.numAllocations();
+
+            for (int i = 0; i < 20; ++i) {
+                const bsl::size_t NUM_VALUES = i % 7 + 1;
+
+                ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, NUM_VALUES));
+                ASSERT(e_SUCCESS == mX.popFrontBatch(results,
+                                                     8,
+                                                     &numPopped));
+                ASSERTV(i, numPopped, NUM_VALUES == numPopped);
+                for (bsl::size_t j = 0; j < numPopped; ++j) {
+                    ASSERTV(i, j, VALUES[j] == results[j]);
+                }
+            }
+            ASSERT(na == sa.numAllocations());
+
+            // Disabled states.
+
+            mX.pushBackBatch(VALUES, 2);
+
+            mX.disablePushBack();
+            ASSERT(e_DISABLED == mX.pushBackBatch(VALUES, 2, &numPushed));
+            ASSERT(0 == numPushed);
+            ASSERT(2 == X.numElements());
+            mX.enablePushBack();
+
+            mX.disablePopFront();
+            ASSERT(e_DISABLED == mX.tryPopFrontBatch(results, 8, &numPopped));
+            ASSERT(0 == numPopped);
+            ASSERT(e_DISABLED == mX.popFrontBatch(results, 8, &numPopped));
+            ASSERT(0 == numPopped);
+            mX.enablePopFront();
+
+            ASSERT(e_SUCCESS == mX.popFrontBatch(results, 8, &numPopped));
+            ASSERT(2 == numPopped);
+        }
+        {
+            enum { k_NUM_THREADS = 3, k_NUM_VALUES = 10000 };
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(16, &sa);  const Obj& X = mX;
+
+            bslmt::ThreadUtil::Handle handle[k_NUM_THREADS];
+            BatchPushData             data[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                data[i].d_obj_p     = &mX;
+                data[i].d_id        = i;
+                data[i].d_numValues = k_NUM_VALUES;
+                data[i].d_batchSize = 10 * (i + 1);
+                bslmt::ThreadUtil::create(&handle[i], batchPush, &data[i]);
+            }
+
+            int results[7];
+            int next[k_NUM_THREADS] = { 0, 0, 0 };
+            int numReceived = 0;
+
+            while (numReceived < k_NUM_THREADS * k_NUM_VALUES) {
+                bsl::size_t numPopped = 0;
+                ASSERT(e_SUCCESS == mX.popFrontBatch(results, 7, &numPopped));
+                ASSERT(0 < numPopped && numPopped <= 7);
+
+                for (bsl::size_t j = 0; j < numPopped; ++j) {
+                    const int id = results[j] / k_NUM_VALUES;
+
+                    ASSERTV(results[j], 0 <= id && id < k_NUM_THREADS);
+                    if (0 <= id && id < k_NUM_THREADS) {
+                        ASSERTV(id, results[j], next[id],
+                                results[j] % k_NUM_VALUES == next[id]);
+                        ++next[id];
+                    }
+                }
+                numReceived += static_cast<int>(numPopped);
+            }
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handle[i]);
+            }
+
+            ASSERT(X.isEmpty());
+        }
+#ifdef BDE_BUILD_TARGET_EXC
+        {
+            typedef bdlcc::SingleConsumerQueueImpl<BatchExceptionHelper,
+                                                   bsls::AtomicOperations,
+                                                   bslmt::Mutex,
+                                                   bslmt::Condition> EObj;
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            EObj mX(4, &sa);  const EObj& X = mX;
+
+            const BatchExceptionHelper VALUES[] = { 1, 2, 3 };
+
+            BatchExceptionHelper results[3];
+            bsl::size_t          numPushed = 0;
+            bsl::size_t          numPopped = 0;
+            int                  numException = 0;
+
+            const int LIVE = BatchExceptionHelper::s_numLive;
+
+            // Copying the second element throws.
+
+            BatchExceptionHelper::s_numCopiesBeforeThrow = 1;
+            try {
+                mX.pushBackBatch(VALUES, 3, &numPushed);
+            } catch (int) {
+                ++numException;
+            }
+            BatchExceptionHelper::s_numCopiesBeforeThrow = -1;
+
+            ASSERT(1 == numException);
+            ASSERT(1 == X.numElements());
+            ASSERT(LIVE + 1 == BatchExceptionHelper::s_numLive);
+
+            // The nodes not written are skipped.
+
+            ASSERT(e_SUCCESS == mX.tryPopFrontBatch(results, 3, &numPopped));
+            ASSERT(1 == numPopped);
+            ASSERT(1 == results[0].d_value);
+            ASSERT(X.isEmpty());
+            ASSERT(LIVE == BatchExceptionHelper::s_numLive);
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 3));
+            ASSERT(3 == X.numElements());
+
+            // Assigning the second element throws.
+
+            BatchExceptionHelper::s_numCopiesBeforeThrow = 1;
+            try {
+                mX.tryPopFrontBatch(results, 3, &numPopped);
+            } catch (int) {
+                ++numException;
+            }
+            BatchExceptionHelper::s_numCopiesBeforeThrow = -1;
+
+            ASSERT(2 == numException);
+            ASSERT(X.isEmpty());
+            ASSERT(LIVE == BatchExceptionHelper::s_numLive);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+
+            ASSERT(e_SUCCESS == mX.pushBackBatch(VALUES, 3));
+            ASSERT(e_SUCCESS == mX.popFrontBatch(results, 3, &numPopped));
+            ASSERT(3 == numPopped);
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, VALUES[i].d_value == results[i].d_value);
+            }
+            ASSERT(NUM_ALLOCATIONS == sa.numAllocations());
+            ASSERT(LIVE == BatchExceptionHelper::s_numLive);
+        }
+#endif
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
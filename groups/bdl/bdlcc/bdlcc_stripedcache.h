@@ -0,0 +1,932 @@
+// bdlcc_stripedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_STRIPEDCACHE
+#define INCLUDED_BDLCC_STRIPEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a bucket-group locking (i.e., *striped*) in-process cache.
+//
+//@CLASSES:
+//  bdlcc::StripedCache: in-process key-value cache partitioned into stripes
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::StripedCache', implementing a thread-safe in-memory key-value cache
+// with a configurable eviction policy, that partitions its items into a (user
+// defined) number of *stripes*, each of which is a separately locked
+// 'bdlcc::Cache' having its own eviction queue.  The stripe of an item is
+// determined by the hash value of its key.  This design allows greater
+// concurrency (and improved performance) than a single 'bdlcc::Cache' object,
+// in particular when the cache is read by many threads: operations on keys in
+// different stripes never contend for the same lock.
+//
+// 'bdlcc::StripedCache' provides (nearly) the same interface as
+// 'bdlcc::Cache', and uses the same template parameters: the key type
+// ('KEY'), the value type ('VALUE'), the optional hash function ('HASH'), and
+// the optional equal function ('EQUAL').
+//
+///Eviction Policies
+///-----------------
+// All of the eviction policies supported by 'bdlcc::Cache' (see
+// 'bdlcc::CacheEvictionPolicy') are supported, and are applied *per* *stripe*:
+// for example, with the LRU policy, the item evicted from a stripe is the item
+// of that stripe that has not been accessed for the longest period of time,
+// which is not necessarily the least recently used item in the whole cache.
+//
+// With the LRU policy, a successful 'tryGetValue' moves the item to the back
+// of the eviction queue of its stripe, and therefore requires a write lock on
+// that stripe.  With the CLOCK policy, 'tryGetValue' merely marks the item as
+// referenced, which requires only a read lock: the CLOCK policy is therefore
+// recommended for caches that are read by many threads concurrently.  The
+// frequency-aware SLRU and TinyLFU policies, like LRU, require a write lock;
+// note that, with TinyLFU, each stripe keeps its own frequency sketch.
+//
+// As for 'bdlcc::Cache', the hits, misses, and evictions are counted (see
+// {'bdlcc_cache'|Statistics}); the counters of the cache are the sums of the
+// counters of the stripes.  Note that each stripe allocates its own cells of
+// hit and miss counters (between 127 and 1087 bytes, depending on the host).
+//
+///Watermarks
+///----------
+// The low and high watermarks supplied at construction apply to the cache as
+// a whole, and are divided evenly among the stripes (rounding up): each stripe
+// starts evicting its items when its size reaches
+// 'ceil(highWatermark / numStripes)', and stops when its size falls below
+// 'ceil(lowWatermark / numStripes)'.  As items are generally not distributed
+// perfectly evenly among the stripes, eviction may start before 'size()'
+// reaches 'highWatermark()'; conversely, 'size()' may exceed 'highWatermark()'
+// by up to 'numStripes() - 1' items.  Caches needing a precise size limit
+// should use few stripes (or a 'bdlcc::Cache').
+//
+///Number of Stripes
+///-----------------
+// The number of stripes is rounded up to a power of 2.  As for
+// 'bdlcc::StripedUnorderedMap', performance improves as the number of stripes
+// increases, reaching a plateau at roughly four times the number of threads
+// *concurrently* using the cache.
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::StripedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.
+//
+// The methods operating on a single key lock only the stripe of that key.
+// The methods operating on the whole cache ('clear', 'size', 'visit', and
+// 'setPostEvictionCallback') lock each of the stripes in turn; therefore,
+// they do *not* operate on a snapshot of the whole cache: for example, 'size'
+// may reflect an item erased from one stripe and not an item inserted
+// concurrently into another stripe.
+//
+// As for 'bdlcc::Cache', the post-eviction callback is invoked while holding
+// the write lock of the stripe of the evicted item; the cache object itself
+// should not be used in a post-eviction callback, otherwise a deadlock may
+// result.
+//
+///Runtime Complexity
+///------------------
+//..
+// +----------------------------------------------------+--------------------+
+// | Operation                                          | Complexity         |
+// +====================================================+====================+
+// | insert                                             | Average: O[1]      |
+// |                                                    | Worst:   O[n]      |
+// +----------------------------------------------------+--------------------+
+// | insertBulk, eraseBulk, k elements                  | Average: O[k]      |
+// |                                                    | Worst:   O[n*k]    |
+// +----------------------------------------------------+--------------------+
+// | tryGetValue, erase                                 | O[1]               |
+// +----------------------------------------------------+--------------------+
+// | size                                               | O[numStripes]      |
+// +----------------------------------------------------+--------------------+
+// | clear, visit                                       | O[n + numStripes]  |
+// +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Cache Read by Many Threads
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches the prices of financial instruments, which
+// are looked up by many request-processing threads and refreshed
+// infrequently.  With a single 'bdlcc::Cache', all of the lookups would
+// contend for the same lock; we use a 'bdlcc::StripedCache' with the CLOCK
+// eviction policy instead, so that the lookups only acquire (shared) read
+// locks spread over many stripes.
+//
+// First, we define the cache, limiting its size to approximately 1000 items:
+//..
+//  typedef bdlcc::StripedCache<int, double> PriceCache;
+//
+//  PriceCache prices(bdlcc::CacheEvictionPolicy::e_CLOCK,
+//                    900,
+//                    1000,
+//                    16,
+//                    &talloc);
+//  assert(16 == prices.numStripes());
+//..
+// Then, we populate the cache:
+//..
+//  for (int i = 0; i < 100; ++i) {
+//      prices.insert(i, 100.0 + i);
+//  }
+//  assert(100 == prices.size());
+//..
+// Next, we define a function that might be run by each of the
+// request-processing threads, looking up the price of an instrument:
+//..
+//  double lookupPrice(PriceCache *cache, int instrument)
+//      // Return the price of the specified 'instrument' in the specified
+//      // 'cache', or 0 if it is not cached.
+//  {
+//      bsl::shared_ptr<double> price;
+//      if (0 != cache->tryGetValue(&price, instrument)) {
+//          return 0;                                                 // RETURN
+//      }
+//      return *price;
+//  }
+//..
+// Then, we look up some prices:
+//..
+//  assert(142.0 == lookupPrice(&prices, 42));
+//  assert(  0.0 == lookupPrice(&prices, 4242));
+//..
+// Finally, we update a price and erase an instrument from the cache:
+//..
+//  prices.insert(42, 143.0);
+//  assert(143.0 == lookupPrice(&prices, 42));
+//
+//  assert(0 == prices.erase(42));
+//  assert(1 == prices.erase(42));
+//  assert(99 == prices.size());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_autoarraydestructor.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                      // ===============================
+                      // class StripedCache_VisitorProxy
+                      // ===============================
+
+template <class KEY, class VALUE, class VISITOR>
+class StripedCache_VisitorProxy {
+    // This class provides a visitor that forwards each visited item to a
+    // held visitor, and records whether the held visitor requested the
+    // visitation to stop, so that the visitation of the stripes of a
+    // 'StripedCache' can be stopped.
+
+    // DATA
+    VISITOR *d_visitor_p;  // forwarded-to visitor (held, not owned)
+
+    bool    *d_stopped_p;  // set to 'true' if '*d_visitor_p' returns 'false'
+                           // (held, not owned)
+
+  public:
+    // CREATORS
+    StripedCache_VisitorProxy(VISITOR *visitor, bool *stopped);
+        // Create a visitor forwarding to the specified 'visitor', and setting
+        // the specified 'stopped' flag to 'true' if 'visitor' returns
+        // 'false'.
+
+    // MANIPULATORS
+    bool operator()(const KEY& key, const VALUE& value);
+        // Invoke the held visitor with the specified 'key' and 'value', and
+        // return its result.
+};
+
+                            // ==================
+                            // class StripedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class StripedCache {
+    // This class represents an in-process key-value store, partitioned into
+    // independently locked stripes, supporting a variety of eviction policies.
+
+  private:
+    // PRIVATE TYPES
+    typedef Cache<KEY, VALUE, HASH, EQUAL> Stripe;
+        // Type of each of the stripes.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename Stripe::ValuePtrType         ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef typename Stripe::PostEvictionCallback PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef typename Stripe::KVType               KVType;
+        // Value type of a bulk insert entry.
+
+    enum {
+        k_DEFAULT_NUM_STRIPES = 16  // default number of stripes
+    };
+
+  private:
+    // DATA
+    bslma::Allocator          *d_allocator_p;   // memory allocator (held, not
+                                                // owned)
+
+    bsl::size_t                d_numStripes;    // number of stripes (a power
+                                                // of 2)
+
+    bsl::size_t                d_stripeMask;    // 'd_numStripes - 1'
+
+    Stripe                    *d_stripes_p;     // array of 'd_numStripes'
+                                                // stripes (owned)
+
+    HASH                       d_hashFunction;  // hash function used to
+                                                // select the stripe of a key
+
+    bsl::size_t                d_lowWatermark;  // low watermark of the whole
+                                                // cache
+
+    bsl::size_t                d_highWatermark; // high watermark of the whole
+                                                // cache
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t stripeWatermark(bsl::size_t watermark,
+                                       bsl::size_t numStripes);
+        // Return the specified 'watermark' of a whole cache divided among the
+        // specified 'numStripes', rounding up.
+
+    // PRIVATE MANIPULATORS
+    void createStripes(CacheEvictionPolicy::Enum  evictionPolicy,
+                       const EQUAL&               equalFunction);
+        // Create the stripes of this cache using the specified
+        // 'evictionPolicy' and 'equalFunction', and the watermarks, the hash
+        // function, and the allocator of this cache.
+
+    Stripe& stripe(const KEY& key);
+        // Return a reference providing modifiable access to the stripe of the
+        // specified 'key'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t stripeIndex(const KEY& key) const;
+        // Return the index of the stripe of the specified 'key'.
+
+  private:
+    // NOT IMPLEMENTED
+    StripedCache(const StripedCache&);
+    StripedCache& operator=(const StripedCache&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StripedCache, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit StripedCache(bslma::Allocator *basicAllocator = 0);
+        // Create an empty LRU cache having no size limit and
+        // 'k_DEFAULT_NUM_STRIPES' stripes.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes = k_DEFAULT_NUM_STRIPES,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy' and the
+        // specified 'lowWatermark' and 'highWatermark'.  Optionally specify
+        // 'numStripes', the minimum number of stripes; if 'numStripes' is not
+        // specified, 'k_DEFAULT_NUM_STRIPES' is used.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'lowWatermark <= highWatermark',
+        // '1 <= lowWatermark', and '1 <= numStripes'.  Note that the number
+        // of stripes is rounded up to a power of 2.
+
+    StripedCache(CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bsl::size_t                numStripes,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache using the specified 'evictionPolicy',
+        // 'lowWatermark', 'highWatermark', and 'numStripes', the minimum
+        // number of stripes.  The specified 'hashFunction' is used to generate
+        // the hash values for a given key, and the specified 'equalFunction'
+        // is used to determine whether two keys have the same value.
+        // Optionally specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark', and
+        // '1 <= numStripes'.  Note that the number of stripes is rounded up to
+        // a power of 2.
+
+    ~StripedCache();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Move the specified 'key' and its associated 'value' into this cache.
+        // If 'key' already exists, then its value will be replaced with
+        // 'value'.  Note that all the methods that take moved objects provide
+        // the 'basic' but not the 'strong' exception guarantee -- throws may
+        // occur after the objects are moved out of; the cache will not be
+        // modified, but 'key' or 'value' may be changed.  Also note that 'key'
+        // must be copyable, even if it is moved.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.  Note that the method with 'key' moved provides the
+        // 'basic' but not the 'strong' exception guarantee -- if a throw
+        // occurs, the cache will not be modified, but 'key' may be changed.
+        // Also note that 'key' must be copyable, even if it is moved.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // Note that the items of each stripe are inserted while holding the
+        // lock of that stripe once.
+
+    int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // If an exception occurs during this action, we provide only the
+        // basic guarantee - both this cache and 'data' will be in some valid
+        // but unspecified state.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true', record the access in the eviction
+        // queue of the stripe of 'key' according to the eviction policy (see
+        // 'bdlcc::Cache::tryGetValue').  Return 0 on success, and 1 if 'key'
+        // does not exist in this cache.  Note that a write lock on the stripe
+        // of 'key' is acquired only if its eviction queue is modified (i.e.,
+        // the eviction policy is LRU, SLRU, or TinyLFU and
+        // 'modifyEvictionQueue' is 'true').
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache that
+        // returns 'true' if two 'KEY' objects have the same value, and 'false'
+        // otherwise.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsl::size_t highWatermark() const;
+        // Return the high watermark of this cache, which is the (approximate)
+        // size at which eviction of existing items begins.
+
+    bsl::size_t lowWatermark() const;
+        // Return the low watermark of this cache, which is the (approximate)
+        // size at which eviction of existing items ends.
+
+    bsls::Types::Uint64 numEvictions() const;
+        // Return the number of items evicted from this cache by its eviction
+        // policy since its creation (see 'bdlcc::Cache::numEvictions').
+
+    bsls::Types::Uint64 numHits() const;
+        // Return the number of calls to 'tryGetValue' on this cache that found
+        // the requested key since its creation.
+
+    bsls::Types::Uint64 numMisses() const;
+        // Return the number of calls to 'tryGetValue' on this cache that did
+        // not find the requested key since its creation.
+
+    bsl::size_t numStripes() const;
+        // Return the number of stripes of this cache.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.  Note that the stripes are
+        // locked in turn, so the returned value reflects the state of each
+        // stripe at a different time if the cache is being modified
+        // concurrently.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // stripe by stripe, in the order of the eviction queue of each
+        // stripe, until 'visitor' returns 'false'.  The 'VISITOR' type must
+        // be a callable object that can be invoked in the same way as the
+        // function 'bool (const KEY&, const VALUE&)'.  Note that only the
+        // stripe being visited is locked.
+};
+
+// ============================================================================
+//                        INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // -------------------------------
+                      // class StripedCache_VisitorProxy
+                      // -------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+StripedCache_VisitorProxy<KEY, VALUE, VISITOR>::StripedCache_VisitorProxy(
+                                                              VISITOR *visitor,
+                                                              bool    *stopped)
+: d_visitor_p(visitor)
+, d_stopped_p(stopped)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+bool StripedCache_VisitorProxy<KEY, VALUE, VISITOR>::operator()(
+                                                          const KEY&   key,
+                                                          const VALUE& value)
+{
+    if (!(*d_visitor_p)(key, value)) {
+        *d_stopped_p = true;
+        return false;                                                 // RETURN
+    }
+    return true;
+}
+
+                            // ------------------
+                            // class StripedCache
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::stripeWatermark(
+                                                        bsl::size_t watermark,
+                                                        bsl::size_t numStripes)
+{
+    return watermark / numStripes + (watermark % numStripes ? 1 : 0);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::createStripes(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     const EQUAL&               equalFunction)
+{
+    const bsl::size_t lowWatermark  = stripeWatermark(d_lowWatermark,
+                                                      d_numStripes);
+    const bsl::size_t highWatermark = stripeWatermark(d_highWatermark,
+                                                      d_numStripes);
+
+    d_stripes_p = static_cast<Stripe *>(d_allocator_p->allocate(
+                                               d_numStripes * sizeof(Stripe)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocatorProctor(
+                                                                d_stripes_p,
+                                                                d_allocator_p);
+    bslalg::AutoArrayDestructor<Stripe> destructorGuard(d_stripes_p,
+                                                        d_stripes_p);
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        new (d_stripes_p + i) Stripe(evictionPolicy,
+                                     lowWatermark,
+                                     highWatermark,
+                                     d_hashFunction,
+                                     equalFunction,
+                                     d_allocator_p);
+        destructorGuard.moveEnd();
+    }
+
+    destructorGuard.release();
+    deallocatorProctor.release();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedCache<KEY, VALUE, HASH, EQUAL>::Stripe&
+StripedCache<KEY, VALUE, HASH, EQUAL>::stripe(const KEY& key)
+{
+    return d_stripes_p[stripeIndex(key)];
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::stripeIndex(
+                                                          const KEY& key) const
+{
+    // The stripes use the same hash function to select the buckets of their
+    // hash tables: the hash value is scrambled (using Fibonacci hashing) so
+    // that the items of a stripe are not confined to a subset of its
+    // buckets, and so that hash functions having poorly distributed low bits
+    // (e.g., the hash of aligned pointers) do not leave stripes unused.
+
+    const bsls::Types::Uint64 hash = static_cast<bsls::Types::Uint64>(
+                                                         d_hashFunction(key));
+
+    return static_cast<bsl::size_t>((hash * 0x9E3779B97F4A7C15ULL) >> 32)
+         & d_stripeMask;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numStripes(k_DEFAULT_NUM_STRIPES)
+, d_stripeMask(k_DEFAULT_NUM_STRIPES - 1)
+, d_stripes_p(0)
+, d_hashFunction()
+, d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+{
+    createStripes(CacheEvictionPolicy::e_LRU, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numStripes(static_cast<bsl::size_t>(
+                  bdlb::BitUtil::roundUpToBinaryPower(
+                          static_cast<bdlb::BitUtil::uint64_t>(numStripes))))
+, d_stripeMask(d_numStripes - 1)
+, d_stripes_p(0)
+, d_hashFunction()
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+{
+    BSLS_ASSERT(lowWatermark <= highWatermark);
+    BSLS_ASSERT(1 <= lowWatermark);
+    BSLS_ASSERT(1 <= numStripes);
+
+    createStripes(evictionPolicy, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::StripedCache(
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     bsl::size_t                lowWatermark,
+                                     bsl::size_t                highWatermark,
+                                     bsl::size_t                numStripes,
+                                     const HASH&                hashFunction,
+                                     const EQUAL&               equalFunction,
+                                     bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_numStripes(static_cast<bsl::size_t>(
+                  bdlb::BitUtil::roundUpToBinaryPower(
+                          static_cast<bdlb::BitUtil::uint64_t>(numStripes))))
+, d_stripeMask(d_numStripes - 1)
+, d_stripes_p(0)
+, d_hashFunction(hashFunction)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+{
+    BSLS_ASSERT(lowWatermark <= highWatermark);
+    BSLS_ASSERT(1 <= lowWatermark);
+    BSLS_ASSERT(1 <= numStripes);
+
+    createStripes(evictionPolicy, equalFunction);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+StripedCache<KEY, VALUE, HASH, EQUAL>::~StripedCache()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].~Stripe();
+    }
+    d_allocator_p->deallocate(d_stripes_p);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return stripe(key).erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    int count = 0;
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        if (0 == stripe(keys[i]).erase(keys[i])) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    stripe(key).insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               const KEY&               key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    stripe(key).insert(key, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 bslmf::MovableRef<KEY> key,
+                                                 const VALUE&           value)
+{
+    Stripe& keyStripe = stripe(bslmf::MovableRefUtil::access(key));
+    keyStripe.insert(bslmf::MovableRefUtil::move(key), value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<KEY>   key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    Stripe& keyStripe = stripe(bslmf::MovableRefUtil::access(key));
+    keyStripe.insert(bslmf::MovableRefUtil::move(key),
+                     bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                  const KEY&          key,
+                                                  const ValuePtrType& valuePtr)
+{
+    stripe(key).insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY> key,
+                                              const ValuePtrType&    valuePtr)
+{
+    Stripe& keyStripe = stripe(bslmf::MovableRefUtil::access(key));
+    keyStripe.insert(bslmf::MovableRefUtil::move(key), valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                              const bsl::vector<KVType>& data)
+{
+    // Partition the data by stripe, so that each stripe is locked once.
+
+    bsl::vector<bsl::vector<KVType> > stripeData(d_numStripes,
+                                                 bsl::vector<KVType>(),
+                                                 d_allocator_p);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        stripeData[stripeIndex(data[i].first)].push_back(data[i]);
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        if (!stripeData[i].empty()) {
+            count += d_stripes_p[i].insertBulk(
+                              bslmf::MovableRefUtil::move(stripeData[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                  bslmf::MovableRef<bsl::vector<KVType> > data)
+{
+    bsl::vector<KVType>& localData = data;
+
+    // Partition the data by stripe, so that each stripe is locked once.
+
+    bsl::vector<bsl::vector<KVType> > stripeData(d_numStripes,
+                                                 bsl::vector<KVType>(),
+                                                 d_allocator_p);
+    for (bsl::size_t i = 0; i < localData.size(); ++i) {
+        stripeData[stripeIndex(localData[i].first)].push_back(
+                                  bslmf::MovableRefUtil::move(localData[i]));
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        if (!stripeData[i].empty()) {
+            count += d_stripes_p[i].insertBulk(
+                              bslmf::MovableRefUtil::move(stripeData[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_stripes_p[i].setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    return stripe(key).tryGetValue(value, key, modifyEvictionQueue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL StripedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_stripes_p[0].equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+StripedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_stripes_p[0].evictionPolicy();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH StripedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Uint64
+StripedCache<KEY, VALUE, HASH, EQUAL>::numEvictions() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].numEvictions();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Uint64 StripedCache<KEY, VALUE, HASH, EQUAL>::numHits() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].numHits();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Uint64 StripedCache<KEY, VALUE, HASH, EQUAL>::numMisses() const
+{
+    bsls::Types::Uint64 result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].numMisses();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::numStripes() const
+{
+    return d_numStripes;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t StripedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        result += d_stripes_p[i].size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void StripedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    bool                                              stopped = false;
+    StripedCache_VisitorProxy<KEY, VALUE, VISITOR>    proxy(&visitor,
+                                                            &stopped);
+
+    for (bsl::size_t i = 0; i < d_numStripes && !stopped; ++i) {
+        d_stripes_p[i].visit(proxy);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1237 @@
+// bdlcc_stripedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_stripedcache.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_memory.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::StripedCache', that
+// provides an in-memory key-value cache partitioned into stripes, each of
+// which is a 'bdlcc::Cache'.  As the functionality of each stripe is provided
+// by 'bdlcc::Cache', which is tested in its own test driver, we need only
+// verify that operations are forwarded to the right stripe, that the
+// operations on the whole cache combine the stripes correctly, that the
+// watermarks are divided among the stripes as documented, and that keys are
+// distributed among the stripes.
+//
+// Primary Manipulators:
+//: o 'insert'
+//: o 'erase'
+//
+// Basic Accessors:
+//: o 'tryGetValue'
+//: o 'size'
+//: o 'numStripes'
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit StripedCache(bslma::Allocator *basicAllocator = 0);
+// [ 2] StripedCache(policy, lowWat, highWat, numStripes, alloc);
+// [ 2] StripedCache(policy, lowWat, highWat, numStripes, h, eq, alloc);
+// [ 2] ~StripedCache();
+//
+// MANIPULATORS
+// [ 4] void clear();
+// [ 4] int erase(const KEY& key);
+// [ 4] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 3] void insert(const KEY& key, const VALUE& value);
+// [ 3] void insert(const KEY& key, VALUE&& value);
+// [ 3] void insert(KEY&& key, const VALUE& value);
+// [ 3] void insert(KEY&& key, VALUE&& value);
+// [ 3] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 3] void insert(KEY&& key, const ValuePtrType& valuePtr);
+// [ 5] int insertBulk(const bsl::vector<KVType>& data);
+// [ 5] int insertBulk(bsl::vector<KVType>&& data);
+// [ 4] void setPostEvictionCallback(postEvictionCallback);
+// [ 3] int tryGetValue(value, const KEY& key, bool modifyEvictionQueue);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 6] bsls::Types::Uint64 numEvictions() const;
+// [ 3] bsls::Types::Uint64 numHits() const;
+// [ 3] bsls::Types::Uint64 numMisses() const;
+// [ 2] bsl::size_t numStripes() const;
+// [ 3] bsl::size_t size() const;
+// [ 7] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] DISTRIBUTION OF KEYS AMONG STRIPES
+// [ 6] EVICTION
+// [ 8] CONCURRENCY
+// [ 9] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::StripedCache<int, bsl::string> Obj;
+typedef bdlcc::CacheEvictionPolicy            Policy;
+
+// ============================================================================
+//                        HELPER FUNCTIONS AND CLASSES
+// ----------------------------------------------------------------------------
+
+namespace {
+
+class AlignedHash {
+    // This class provides a hash functor that behaves like the hash of
+    // aligned pointers: the low 6 bits of the hash values are always 0.  It
+    // also has an identifying value, to verify that it is copied.
+
+    // DATA
+    int d_id;  // identifier
+
+  public:
+    // CREATORS
+    explicit AlignedHash(int id = 0)
+    : d_id(id)
+        // Create a hash functor having the optionally specified 'id'.
+    {
+    }
+
+    // ACCESSORS
+    bsl::size_t operator()(int key) const
+        // Return the hash value of the specified 'key'.
+    {
+        return static_cast<bsl::size_t>(key) << 6;
+    }
+
+    int id() const
+        // Return the identifier of this functor.
+    {
+        return d_id;
+    }
+};
+
+class IdEqual {
+    // This class provides an equality functor having an identifying value, to
+    // verify that it is copied.
+
+    // DATA
+    int d_id;  // identifier
+
+  public:
+    // CREATORS
+    explicit IdEqual(int id = 0)
+    : d_id(id)
+        // Create an equality functor having the optionally specified 'id'.
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are equal, and
+        // 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+
+    int id() const
+        // Return the identifier of this functor.
+    {
+        return d_id;
+    }
+};
+
+struct EvictionRecorder {
+    // This 'struct' provides a post-eviction callback recording the values of
+    // the evicted items.
+
+    // DATA
+    bsl::vector<bsl::string> *d_log_p;  // evicted values (held, not owned)
+
+    // ACCESSORS
+    void operator()(const Obj::ValuePtrType& value) const
+        // Append the specified 'value' to the log.
+    {
+        d_log_p->push_back(*value);
+    }
+};
+
+struct KeyCollector {
+    // This 'struct' provides a visitor collecting the visited keys, and
+    // stopping the visitation after a specified number of items.
+
+    // DATA
+    bsl::vector<int> *d_keys_p;   // visited keys (held, not owned)
+
+    bsl::size_t       d_limit;    // maximum number of items to visit
+
+    // MANIPULATORS
+    bool operator()(int key, const bsl::string& value)
+        // Append the specified 'key' to the visited keys, verify that the
+        // specified 'value' corresponds to 'key', and return 'true' unless
+        // the limit of visited items is reached.
+    {
+        ASSERTV(key, value, bsl::to_string(key) == value);
+        d_keys_p->push_back(key);
+        return d_keys_p->size() < d_limit;
+    }
+};
+
+bsl::string valueOf(int key)
+    // Return the value associated with the specified 'key' in these tests.
+{
+    return bsl::to_string(key);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample {
+
+typedef bdlcc::StripedCache<int, double> PriceCache;
+
+double lookupPrice(PriceCache *cache, int instrument)
+    // Return the price of the specified 'instrument' in the specified
+    // 'cache', or 0 if it is not cached.
+{
+    bsl::shared_ptr<double> price;
+    if (0 != cache->tryGetValue(&price, instrument)) {
+        return 0;                                                     // RETURN
+    }
+    return *price;
+}
+
+}  // close namespace usageExample
+
+// ============================================================================
+//                               CONCURRENCY TEST
+// ----------------------------------------------------------------------------
+
+namespace concurrencyTest {
+
+enum {
+    k_NUM_THREADS    = 8,
+    k_NUM_ITERATIONS = 20000,
+    k_NUM_KEYS       = 2000
+};
+
+struct WorkerArgs {
+    // This 'struct' holds the arguments of a worker thread.
+
+    Obj              *d_cache_p;    // cache under test
+    bslmt::Barrier   *d_barrier_p;  // start barrier
+    int               d_id;         // identifier of the thread
+    bsls::AtomicInt  *d_numHits_p;  // number of successful lookups
+};
+
+void worker(WorkerArgs args)
+    // Perform a random mix of operations on the cache specified by 'args'.
+{
+    unsigned random = 12345 + args.d_id;
+    int      numHits = 0;
+
+    args.d_barrier_p->wait();
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        random = random * 1103515245 + 12345;
+        const int key       = static_cast<int>((random >> 8) % k_NUM_KEYS);
+        const int operation = static_cast<int>((random >> 24) % 16);
+
+        if (operation < 12) {
+            bsl::shared_ptr<bsl::string> value;
+            if (0 == args.d_cache_p->tryGetValue(&value, key)) {
+                ASSERTV(key, *value, valueOf(key) == *value);
+                ++numHits;
+            }
+        }
+        else if (operation < 15) {
+            args.d_cache_p->insert(key, valueOf(key));
+        }
+        else {
+            args.d_cache_p->erase(key);
+        }
+    }
+
+    args.d_numHits_p->add(numHits);
+}
+
+}  // close namespace concurrencyTest
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usageExample;
+
+        bslma::TestAllocator talloc("usage", veryVeryVeryVerbose);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Cache Read by Many Threads
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose that a service caches the prices of financial instruments, which
+// are looked up by many request-processing threads and refreshed
+// infrequently.  With a single 'bdlcc::Cache', all of the lookups would
+// contend for the same lock; we use a 'bdlcc::StripedCache' with the CLOCK
+// eviction policy instead, so that the lookups only acquire (shared) read
+// locks spread over many stripes.
+//
+// First, we define the cache, limiting its size to approximately 1000 items:
+//..
+//  typedef bdlcc::StripedCache<int, double> PriceCache;
+
+    PriceCache prices(bdlcc::CacheEvictionPolicy::e_CLOCK,
+                      900,
+                      1000,
+                      16,
+                      &talloc);
+    ASSERT(16 == prices.numStripes());
+//..
+// Then, we populate the cache:
+//..
+    for (int i = 0; i < 100; ++i) {
+        prices.insert(i, 100.0 + i);
+    }
+    ASSERT(100 == prices.size());
+//..
+// Next, we define a function that might be run by each of the
+// request-processing threads, looking up the price of an instrument:
+//..
+//  double lookupPrice(PriceCache *cache, int instrument)
+//      // Return the price of the specified 'instrument' in the specified
+//      // 'cache', or 0 if it is not cached.
+//  {
+//      bsl::shared_ptr<double> price;
+//      if (0 != cache->tryGetValue(&price, instrument)) {
+//          return 0;                                                 // RETURN
+//      }
+//      return *price;
+//  }
+//..
+// Then, we look up some prices:
+//..
+    ASSERT(142.0 == lookupPrice(&prices, 42));
+    ASSERT(  0.0 == lookupPrice(&prices, 4242));
+//..
+// Finally, we update a price and erase an instrument from the cache:
+//..
+    prices.insert(42, 143.0);
+    ASSERT(143.0 == lookupPrice(&prices, 42));
+
+    ASSERT(0 == prices.erase(42));
+    ASSERT(1 == prices.erase(42));
+    ASSERT(99 == prices.size());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 The cache can be used concurrently by several threads performing
+        //:   lookups, insertions, and erasures, with every eviction policy.
+        //:
+        //: 2 After the threads are done, the cache is consistent: every item
+        //:   has the correct value, 'visit' visits 'size()' items, and the
+        //:   size is limited as documented.
+        //
+        // Plan:
+        //: 1 For each eviction policy, run several threads performing random
+        //:   operations on a cache, verifying the looked up values; then
+        //:   verify the consistency of the cache.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace concurrencyTest;
+
+        static const Policy::Enum POLICIES[] = {
+            Policy::e_LRU,
+            Policy::e_FIFO,
+            Policy::e_CLOCK,
+            Policy::e_SLRU,
+            Policy::e_TINYLFU
+        };
+        const int NUM_POLICIES = static_cast<int>(sizeof POLICIES /
+                                                  sizeof *POLICIES);
+
+        for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+            const Policy::Enum POLICY = POLICIES[pi];
+
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            Obj mX(POLICY, 800, 1000, 8, &ta);  const Obj& X = mX;
+
+            bslmt::Barrier     barrier(k_NUM_THREADS);
+            bsls::AtomicInt    numHits(0);
+            bslmt::ThreadGroup threads(&ta);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                WorkerArgs args = { &mX, &barrier, i, &numHits };
+                ASSERT(0 == threads.addThread(bdlf::BindUtil::bindS(
+                                                                 &ta,
+                                                                 &worker,
+                                                                 args)));
+            }
+            threads.joinAll();
+
+            if (veryVerbose) {
+                P_(POLICY) P_(numHits) P(X.size());
+            }
+
+            ASSERTV(POLICY, 0 < numHits);
+
+            const bsl::size_t SIZE = X.size();
+            ASSERTV(POLICY, SIZE, SIZE <= 1000 + X.numStripes() - 1);
+
+            bsl::vector<int> keys(&ta);
+            KeyCollector     collector = { &keys, SIZE + 1 };
+            X.visit(collector);
+            ASSERTV(POLICY, SIZE, keys.size(), SIZE == keys.size());
+
+            bsl::set<int> uniqueKeys(keys.begin(), keys.end(), &ta);
+            ASSERTV(POLICY, SIZE == uniqueKeys.size());
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'visit'
+        //
+        // Concerns:
+        //: 1 'visit' visits every item of every stripe exactly once.
+        //:
+        //: 2 'visit' stops as soon as the visitor returns 'false', including
+        //:   across stripes.
+        //:
+        //: 3 'visit' on an empty cache does not invoke the visitor.
+        //
+        // Plan:
+        //: 1 Populate a cache and visit it with visitors having a variety of
+        //:   limits on the number of items visited.  (C-1..3)
+        //
+        // Testing:
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'visit'" << endl
+                          << "=======" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(Policy::e_LRU, 1000, 1000, 8, &ta);  const Obj& X = mX;
+
+        {
+            bsl::vector<int> keys(&ta);
+            KeyCollector     collector = { &keys, 1000 };
+            X.visit(collector);
+            ASSERT(keys.empty());
+        }
+
+        const int NUM_KEYS = 100;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(i, valueOf(i));
+        }
+
+        for (bsl::size_t limit = 1; limit <= NUM_KEYS + 1; ++limit) {
+            bsl::vector<int> keys(&ta);
+            KeyCollector     collector = { &keys, limit };
+            X.visit(collector);
+
+            const bsl::size_t EXPECTED = bsl::min<bsl::size_t>(limit,
+                                                               NUM_KEYS);
+            ASSERTV(limit, keys.size(), EXPECTED == keys.size());
+
+            bsl::set<int> uniqueKeys(keys.begin(), keys.end(), &ta);
+            ASSERTV(limit, EXPECTED == uniqueKeys.size());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EVICTION
+        //
+        // Concerns:
+        //: 1 With a single stripe, eviction is the same as for a
+        //:   'bdlcc::Cache' having the same watermarks.
+        //:
+        //: 2 With several stripes, the watermarks are divided among the
+        //:   stripes, rounding up, so that the size of the cache never
+        //:   exceeds 'highWatermark() + numStripes() - 1'.
+        //:
+        //: 3 The post-eviction callback is invoked for each evicted item.
+        //:
+        //: 4 The eviction policy is applied within each stripe.
+        //:
+        //: 5 'numEvictions' returns the total number of items evicted from all
+        //:   the stripes.
+        //
+        // Plan:
+        //: 1 Insert items into a single-stripe cache and a 'bdlcc::Cache'
+        //:   having the same watermarks and eviction policy, and verify that
+        //:   the same items are evicted.  (C-1, 3)
+        //:
+        //: 2 Insert many items into caches having several stripes, verify the
+        //:   size after each insertion, and that the number of items evicted
+        //:   (as seen by the callback and by 'numEvictions') plus the size
+        //:   equals the number of items inserted.  (C-2..3, 5)
+        //:
+        //: 3 In a cache having a single stripe and the CLOCK policy, look up
+        //:   an item, and verify that it survives the next eviction.  (C-4)
+        //
+        // Testing:
+        //   bsls::Types::Uint64 numEvictions() const;
+        //   EVICTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EVICTION" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        static const Policy::Enum POLICIES[] = {
+            Policy::e_LRU,
+            Policy::e_FIFO,
+            Policy::e_CLOCK,
+            Policy::e_SLRU,
+            Policy::e_TINYLFU
+        };
+        const int NUM_POLICIES = static_cast<int>(sizeof POLICIES /
+                                                  sizeof *POLICIES);
+
+        if (verbose) cout << "\tSingle stripe." << endl;
+
+        for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+            const Policy::Enum POLICY = POLICIES[pi];
+
+            typedef bdlcc::Cache<int, bsl::string> Cache;
+
+            Obj   mX(POLICY, 5, 8, 1, &ta);  const Obj& X = mX;
+            Cache mY(POLICY, 5, 8, &ta);
+
+            ASSERTV(POLICY, 1 == X.numStripes());
+
+            bsl::vector<bsl::string> evictedX(&ta), evictedY(&ta);
+            EvictionRecorder recorderX = { &evictedX };
+            EvictionRecorder recorderY = { &evictedY };
+            mX.setPostEvictionCallback(Obj::PostEvictionCallback(
+                                                           bsl::allocator_arg,
+                                                           &ta,
+                                                           recorderX));
+            mY.setPostEvictionCallback(Cache::PostEvictionCallback(
+                                                           bsl::allocator_arg,
+                                                           &ta,
+                                                           recorderY));
+
+            for (int i = 0; i < 40; ++i) {
+                mX.insert(i, valueOf(i));
+                mY.insert(i, valueOf(i));
+
+                bsl::shared_ptr<bsl::string> value;
+                const int KEY = i * 7 % (i + 1);
+                ASSERTV(POLICY, i,
+                        mX.tryGetValue(&value, KEY) ==
+                                                  mY.tryGetValue(&value, KEY));
+                ASSERTV(POLICY, i, X.size() == mY.size());
+            }
+            ASSERTV(POLICY, evictedX.size(), evictedY.size(),
+                    evictedX == evictedY);
+        }
+
+        if (verbose) cout << "\tSeveral stripes." << endl;
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_low;
+            bsl::size_t d_high;
+            bsl::size_t d_numStripes;
+        } DATA[] = {
+            { L_,    1,    1,  1 },
+            { L_,    1,    1,  4 },
+            { L_,    5,   10,  4 },
+            { L_,   10,   10,  3 },
+            { L_,  100,  128, 16 },
+            { L_,  100,  130, 16 },
+            { L_, 1000, 1000, 64 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const Policy::Enum POLICY      = POLICIES[pi];
+            const int          LINE        = DATA[ti].d_line;
+            const bsl::size_t  LOW         = DATA[ti].d_low;
+            const bsl::size_t  HIGH        = DATA[ti].d_high;
+            const bsl::size_t  NUM_STRIPES = DATA[ti].d_numStripes;
+
+            Obj mX(POLICY, LOW, HIGH, NUM_STRIPES, &ta);  const Obj& X = mX;
+
+            ASSERTV(LINE, LOW  == X.lowWatermark());
+            ASSERTV(LINE, HIGH == X.highWatermark());
+
+            bsl::vector<bsl::string> evicted(&ta);
+            EvictionRecorder         recorder = { &evicted };
+            mX.setPostEvictionCallback(Obj::PostEvictionCallback(
+                                                           bsl::allocator_arg,
+                                                           &ta,
+                                                           recorder));
+
+            const bsl::size_t LIMIT = HIGH + X.numStripes() - 1;
+
+            for (int i = 0; i < 3000; ++i) {
+                mX.insert(i, valueOf(i));
+
+                const bsl::size_t SIZE = X.size();
+                ASSERTV(LINE, POLICY, i, SIZE, LIMIT, SIZE <= LIMIT);
+                ASSERTV(LINE, POLICY, i, SIZE, evicted.size(),
+                        SIZE + evicted.size() == static_cast<bsl::size_t>(
+                                                                       i + 1));
+            }
+            ASSERTV(LINE, POLICY, X.numEvictions(), evicted.size(),
+                    evicted.size() == X.numEvictions());
+
+            // Every stripe is used: the cache holds at least the low
+            // watermark of each stripe, less one, in each stripe.
+
+            const bsl::size_t STRIPE_LOW = (LOW + X.numStripes() - 1)
+                                         / X.numStripes();
+            ASSERTV(LINE, POLICY, X.size(),
+                    X.size() >= (STRIPE_LOW - 1) * X.numStripes());
+        }
+        }
+
+        if (verbose) cout << "\tCLOCK policy." << endl;
+        {
+            Obj mX(Policy::e_CLOCK, 3, 3, 1, &ta);  const Obj& X = mX;
+
+            bsl::vector<bsl::string> evicted(&ta);
+            EvictionRecorder         recorder = { &evicted };
+            mX.setPostEvictionCallback(Obj::PostEvictionCallback(
+                                                           bsl::allocator_arg,
+                                                           &ta,
+                                                           recorder));
+
+            mX.insert(0, valueOf(0));
+            mX.insert(1, valueOf(1));
+            mX.insert(2, valueOf(2));
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+
+            mX.insert(3, valueOf(3));
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(evicted[0], valueOf(1) == evicted[0]);
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(3 == X.size());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'insertBulk'
+        //
+        // Concerns:
+        //: 1 'insertBulk' inserts every item, in every stripe, and returns the
+        //:   number of items that were not previously in the cache.
+        //:
+        //: 2 Items already in the cache have their value replaced.
+        //:
+        //: 3 Both overloads have the same effect.
+        //
+        // Plan:
+        //: 1 Using both overloads, bulk insert items, some of which are
+        //:   already in the cache, and verify the return value and the
+        //:   content of the cache.  (C-1..3)
+        //
+        // Testing:
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int insertBulk(bsl::vector<KVType>&& data);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'insertBulk'" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        for (int move = 0; move <= 1; ++move) {
+            Obj mX(Policy::e_FIFO, 1000, 1000, 8, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 50; i += 2) {
+                mX.insert(i, "old");
+            }
+
+            bsl::vector<Obj::KVType> data(&ta);
+            for (int i = 0; i < 100; ++i) {
+                data.push_back(Obj::KVType(
+                        i,
+                        bsl::allocate_shared<bsl::string>(&ta, valueOf(i))));
+            }
+
+            const int RC = move
+                         ? mX.insertBulk(bslmf::MovableRefUtil::move(data))
+                         : mX.insertBulk(data);
+
+            ASSERTV(move, RC, 75 == RC);
+            ASSERTV(move, X.size(), 100 == X.size());
+
+            for (int i = 0; i < 100; ++i) {
+                bsl::shared_ptr<bsl::string> value;
+                ASSERTV(move, i, 0 == mX.tryGetValue(&value, i));
+                ASSERTV(move, i, valueOf(i) == *value);
+            }
+
+            ASSERTV(move, 0 == mX.insertBulk(bsl::vector<Obj::KVType>(&ta)));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'erase', 'eraseBulk', 'clear', 'setPostEvictionCallback'
+        //
+        // Concerns:
+        //: 1 'erase' removes the item from its stripe, invokes the
+        //:   post-eviction callback, and returns 0, or returns 1 if the key is
+        //:   not in the cache.
+        //:
+        //: 2 'eraseBulk' removes the items from their stripes, invokes the
+        //:   post-eviction callback for each, and returns the number of items
+        //:   removed.
+        //:
+        //: 3 'clear' removes every item from every stripe, and does not invoke
+        //:   the post-eviction callback.
+        //:
+        //: 4 The post-eviction callback is set for every stripe.
+        //
+        // Plan:
+        //: 1 Populate a cache, and remove items using each of the methods,
+        //:   verifying the content of the cache and the invocations of the
+        //:   post-eviction callback.  (C-1..4)
+        //
+        // Testing:
+        //   int erase(const KEY& key);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void clear();
+        //   void setPostEvictionCallback(postEvictionCallback);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'erase', 'eraseBulk', 'clear'" << endl
+                          << "=============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(Policy::e_LRU, 1000, 1000, 16, &ta);  const Obj& X = mX;
+
+        bsl::vector<bsl::string> evicted(&ta);
+        EvictionRecorder         recorder = { &evicted };
+        mX.setPostEvictionCallback(Obj::PostEvictionCallback(
+                                                           bsl::allocator_arg,
+                                                           &ta,
+                                                           recorder));
+
+        for (int i = 0; i < 100; ++i) {
+            mX.insert(i, valueOf(i));
+        }
+        ASSERT(100 == X.size());
+
+        for (int i = 0; i < 100; i += 10) {
+            ASSERTV(i, 0 == mX.erase(i));
+            ASSERTV(i, 1 == mX.erase(i));
+        }
+        ASSERTV(X.size(), 90 == X.size());
+        ASSERTV(evicted.size(), 10 == evicted.size());
+        for (bsl::size_t i = 0; i < evicted.size(); ++i) {
+            ASSERTV(i, valueOf(static_cast<int>(i) * 10) == evicted[i]);
+        }
+
+        bsl::vector<int> keys(&ta);
+        for (int i = 0; i < 100; i += 5) {
+            keys.push_back(i);  // 10 of these were already erased
+        }
+        keys.push_back(1000);
+
+        ASSERT(10 == mX.eraseBulk(keys));
+        ASSERTV(X.size(), 80 == X.size());
+        ASSERTV(evicted.size(), 20 == evicted.size());
+
+        for (int i = 0; i < 100; ++i) {
+            bsl::shared_ptr<bsl::string> value;
+            ASSERTV(i, (i % 5 ? 0 : 1) == mX.tryGetValue(&value, i));
+        }
+
+        mX.clear();
+        ASSERT(0 == X.size());
+        ASSERTV(evicted.size(), 20 == evicted.size());
+
+        mX.insert(1, valueOf(1));
+        ASSERT(1 == X.size());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'insert', 'tryGetValue', 'size'
+        //
+        // Concerns:
+        //: 1 Each of the 'insert' overloads inserts the item, which is then
+        //:   found by 'tryGetValue'.
+        //:
+        //: 2 Inserting an existing key replaces its value.
+        //:
+        //: 3 'tryGetValue' returns 1 for keys not in the cache.
+        //:
+        //: 4 'size' returns the total number of items of all the stripes.
+        //:
+        //: 5 Keys are distributed among the stripes, even for hash functions
+        //:   having poorly distributed low bits.
+        //:
+        //: 6 'numHits' and 'numMisses' return the total numbers of successful
+        //:   and unsuccessful lookups of all the stripes.
+        //
+        // Plan:
+        //: 1 Insert items using each of the overloads, and verify them using
+        //:   'tryGetValue', 'size', 'numHits', and 'numMisses'.  (C-1..4, 6)
+        //:
+        //: 2 Using a hash functor whose low bits are always 0, insert many
+        //:   items into a cache whose stripes each hold few items, and verify
+        //:   that the size of the cache is not limited to the size of a
+        //:   single stripe.  (C-5)
+        //
+        // Testing:
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, VALUE&& value);
+        //   void insert(KEY&& key, const VALUE& value);
+        //   void insert(KEY&& key, VALUE&& value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(KEY&& key, const ValuePtrType& valuePtr);
+        //   int tryGetValue(value, const KEY& key, bool modifyEvictionQueue);
+        //   bsl::size_t size() const;
+        //   bsls::Types::Uint64 numHits() const;
+        //   bsls::Types::Uint64 numMisses() const;
+        //   DISTRIBUTION OF KEYS AMONG STRIPES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'insert', 'tryGetValue', 'size'" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            Obj mX(Policy::e_LRU, 1000, 1000, 4, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.numHits());
+            ASSERT(0 == X.numMisses());
+
+            for (int i = 0; i < 60; i += 6) {
+                int         key0 = i + 0, key2 = i + 2, key3 = i + 3;
+                int         key5 = i + 5;
+                bsl::string value1(valueOf(i + 1), &ta);
+                bsl::string value3(valueOf(i + 3), &ta);
+
+                mX.insert(i + 0, valueOf(i + 0));
+                mX.insert(i + 1, bslmf::MovableRefUtil::move(value1));
+                mX.insert(bslmf::MovableRefUtil::move(key2), valueOf(i + 2));
+                mX.insert(bslmf::MovableRefUtil::move(key3),
+                          bslmf::MovableRefUtil::move(value3));
+                mX.insert(i + 4,
+                          bsl::allocate_shared<bsl::string>(&ta,
+                                                            valueOf(i + 4)));
+                mX.insert(bslmf::MovableRefUtil::move(key5),
+                          bsl::allocate_shared<bsl::string>(&ta,
+                                                            valueOf(i + 5)));
+                (void)key0;
+                ASSERTV(i, X.size(), static_cast<bsl::size_t>(i + 6) ==
+                                                                     X.size());
+            }
+
+            for (int i = 0; i < 70; ++i) {
+                bsl::shared_ptr<bsl::string> value;
+                const int RC = mX.tryGetValue(&value, i, i % 2);
+                if (i < 60) {
+                    ASSERTV(i, 0 == RC);
+                    ASSERTV(i, *value, valueOf(i) == *value);
+                }
+                else {
+                    ASSERTV(i, 1 == RC);
+                }
+            }
+            ASSERTV(X.numHits(),   60 == X.numHits());
+            ASSERTV(X.numMisses(), 10 == X.numMisses());
+
+            mX.insert(7, "seven");
+            ASSERT(60 == X.size());
+
+            bsl::shared_ptr<bsl::string> value;
+            ASSERT(0 == mX.tryGetValue(&value, 7));
+            ASSERT("seven" == *value);
+        }
+
+        if (verbose) cout << "\tDistribution of keys among stripes." << endl;
+        {
+            typedef bdlcc::StripedCache<int, int, AlignedHash> AlignedObj;
+
+            // 16 stripes of at most 16 items each.
+
+            AlignedObj mX(Policy::e_FIFO, 256, 256, 16, &ta);
+            const AlignedObj& X = mX;
+
+            for (int i = 0; i < 128; ++i) {
+                mX.insert(i, i);
+            }
+
+            // Had all the items been put in the same stripe, only 16 of them
+            // would remain.
+
+            ASSERTV(X.size(), 96 <= X.size());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an empty LRU cache having no
+        //:   size limit and 'k_DEFAULT_NUM_STRIPES' stripes.
+        //:
+        //: 2 The other constructors use the specified eviction policy,
+        //:   watermarks, and functors, and round the number of stripes up to
+        //:   a power of 2.
+        //:
+        //: 3 Memory is supplied by the specified allocator, and is released on
+        //:   destruction.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using each of the constructors and verify the
+        //:   values returned by the accessors and the memory usage.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   explicit StripedCache(bslma::Allocator *basicAllocator = 0);
+        //   StripedCache(policy, lowWat, highWat, numStripes, alloc);
+        //   StripedCache(policy, lowWat, highWat, numStripes, h, eq, alloc);
+        //   ~StripedCache();
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numStripes() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+            ASSERT(Policy::e_LRU == X.evictionPolicy());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                          X.lowWatermark());
+            ASSERT(bsl::numeric_limits<bsl::size_t>::max() ==
+                                                         X.highWatermark());
+            ASSERT(0 == X.size());
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        {
+            bslma::DefaultAllocatorGuard guard(&ta);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == X.numStripes());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_numStripes;
+            bsl::size_t d_expNumStripes;
+        } DATA[] = {
+            { L_,    1,    1 },
+            { L_,    2,    2 },
+            { L_,    3,    4 },
+            { L_,    4,    4 },
+            { L_,    5,    8 },
+            { L_,   16,   16 },
+            { L_,   17,   32 },
+            { L_, 1000, 1024 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE            = DATA[ti].d_line;
+            const bsl::size_t NUM_STRIPES     = DATA[ti].d_numStripes;
+            const bsl::size_t EXP_NUM_STRIPES = DATA[ti].d_expNumStripes;
+
+            {
+                Obj mX(Policy::e_CLOCK, 10, 20, NUM_STRIPES, &ta);
+                const Obj& X = mX;
+
+                ASSERTV(LINE, EXP_NUM_STRIPES == X.numStripes());
+                ASSERTV(LINE, Policy::e_CLOCK == X.evictionPolicy());
+                ASSERTV(LINE, 10 == X.lowWatermark());
+                ASSERTV(LINE, 20 == X.highWatermark());
+                ASSERTV(LINE, 0 == X.size());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+
+            {
+                typedef bdlcc::StripedCache<int, int, AlignedHash, IdEqual>
+                                                                    FunctorObj;
+
+                FunctorObj mX(Policy::e_FIFO,
+                              5,
+                              5,
+                              NUM_STRIPES,
+                              AlignedHash(3),
+                              IdEqual(4),
+                              &ta);
+                const FunctorObj& X = mX;
+
+                ASSERTV(LINE, EXP_NUM_STRIPES == X.numStripes());
+                ASSERTV(LINE, Policy::e_FIFO == X.evictionPolicy());
+                ASSERTV(LINE, 5 == X.lowWatermark());
+                ASSERTV(LINE, 5 == X.highWatermark());
+                ASSERTV(LINE, 3 == X.hashFunction().id());
+                ASSERTV(LINE, 4 == X.equalFunction().id());
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+
+        // The default number of stripes is used if not specified.
+
+        {
+            Obj mX(Policy::e_LRU, 1, 1);
+            ASSERT(Obj::k_DEFAULT_NUM_STRIPES == mX.numStripes());
+        }
+        ASSERT(dam.isInUseSame());
+        dam.reset();
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(Policy::e_LRU, 1, 1, 1, &ta));
+            ASSERT_FAIL(Obj(Policy::e_LRU, 0, 1, 1, &ta));
+            ASSERT_FAIL(Obj(Policy::e_LRU, 2, 1, 1, &ta));
+            ASSERT_FAIL(Obj(Policy::e_LRU, 1, 1, 0, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a cache, insert, look up, and erase a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(Policy::e_CLOCK, 100, 200, 4, &ta);  const Obj& X = mX;
+
+        ASSERT(4 == X.numStripes());
+        ASSERT(0 == X.size());
+
+        mX.insert(1, "one");
+        mX.insert(2, "two");
+        ASSERT(2 == X.size());
+
+        bsl::shared_ptr<bsl::string> value;
+        ASSERT(0 == mX.tryGetValue(&value, 1));
+        ASSERT("one" == *value);
+        ASSERT(1 == mX.tryGetValue(&value, 3));
+
+        ASSERT(0 == mX.erase(1));
+        ASSERT(1 == X.size());
+        ASSERT(1 == mX.tryGetValue(&value, 1));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERT(dam.isTotalSame());
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERT(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -14,7 +14,22 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>  // for testing only
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+#endif
 
 namespace BloombergLP {
 
@@ -93,6 +108,97 @@ static const char decoding[256] = {
        ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
 };
 
+                        // =========================
+                        // FILE-SCOPE STATIC HELPERS
+                        // =========================
+
+#if defined(LIKE_X86_GCC)
+
+__attribute__((target("ssse3")))
+static
+bool decodeBlockSsse3(char *out, const char *input)
+    // Decode the 16 characters starting at the specified 'input' into 12
+    // bytes starting at the specified 'out' using SSSE3 instructions, and
+    // return 'true', if all 16 characters are numeric Base64 characters;
+    // otherwise return 'false' with no effect on 'out'.
+{
+    const __m128i in = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+
+    const __m128i nibble      = _mm_set1_epi8(0x0f);
+    const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), nibble);
+    const __m128i lowNibbles  = _mm_and_si128(in, nibble);
+
+    // A character is a numeric Base64 character if and only if the bit masks
+    // selected by its high and low nibbles have no bit in common.
+
+    const __m128i lowMasks = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                           0x11, 0x11, 0x11, 0x11,
+                                           0x11, 0x11, 0x13, 0x1a,
+                                           0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i highMasks = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10);
+
+    const __m128i invalid = _mm_and_si128(
+                                     _mm_shuffle_epi8(lowMasks,  lowNibbles),
+                                     _mm_shuffle_epi8(highMasks, highNibbles));
+    if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(invalid,
+                                                   _mm_setzero_si128()))) {
+        return false;                                                 // RETURN
+    }
+
+    // Map each character to its 6-bit value by adding an offset selected by
+    // its high nibble ('/' being distinguished from '+').
+
+    const __m128i offsets = _mm_setr_epi8(0,   16,  19,   4,
+                                          -65, -65, -71, -71,
+                                          0,   0,   0,   0,
+                                          0,   0,   0,   0);
+    const __m128i isSlash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+    const __m128i values  = _mm_add_epi8(
+                  in,
+                  _mm_shuffle_epi8(offsets, _mm_add_epi8(isSlash,
+                                                         highNibbles)));
+
+    // Pack each group of four 6-bit values into 24 bits, then gather the
+    // 3-byte results in big-endian order.
+
+    const __m128i pairs   = _mm_maddubs_epi16(values,
+                                              _mm_set1_epi32(0x01400140));
+    const __m128i quanta  = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    const __m128i packed  = _mm_shuffle_epi8(quanta,
+                                             _mm_setr_epi8( 2,  1,  0,
+                                                            6,  5,  4,
+                                                           10,  9,  8,
+                                                           14, 13, 12,
+                                                           -1, -1, -1, -1));
+
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out), packed);
+    const int last = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+    bsl::memcpy(out + 8, &last, 4);
+
+    return true;
+}
+
+static
+bool hasSsse3()
+    // Return 'true' if the CPU on which this process is running supports the
+    // SSSE3 instruction set, and 'false' otherwise.
+{
+    static bool result = false;
+
+    BSLMT_ONCE_DO {
+        __builtin_cpu_init();
+        result = __builtin_cpu_supports("ssse3");
+    }
+
+    return result;
+}
+
+#endif  // LIKE_X86_GCC
+
 namespace bdlde {
 
                          // -------------------
@@ -116,6 +222,77 @@ Base64Decoder::~Base64Decoder()
     BSLS_ASSERT(0 <= d_outputLength);
 }
 
+// MANIPULATORS
+int Base64Decoder::decode(char       *out,
+                          int        *numOut,
+                          int        *numIn,
+                          const char *begin,
+                          const char *end)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(numIn);
+    BSLS_ASSERT(begin <= end);
+
+#if defined(LIKE_X86_GCC)
+    if (e_INPUT_STATE != d_state || end - begin < 16 || !hasSsse3()) {
+        return convert(out, numOut, numIn, begin, end);               // RETURN
+    }
+
+    char *const       outBegin = out;
+    const char *const inBegin  = begin;
+
+    int tmpNumOut;
+    int tmpNumIn;
+    int rc = 0;
+
+    while (e_INPUT_STATE == d_state && end - begin >= 16) {
+        // Note that no bits are retained exactly when the input consumed so
+        // far consists of complete 4-character quanta (and all output has
+        // been emitted).
+
+        if (0 == d_bitsInStack && decodeBlockSsse3(out, begin)) {
+            out            += 12;
+            begin          += 16;
+            d_outputLength += 12;
+            continue;
+        }
+
+        // Let the state machine process the block, and then as many
+        // characters as needed to complete the current quantum.
+
+        rc = convert(out, &tmpNumOut, &tmpNumIn, begin, begin + 16);
+        out   += tmpNumOut;
+        begin += tmpNumIn;
+
+        while (0 <= rc
+            && d_bitsInStack
+            && e_INPUT_STATE == d_state
+            && begin != end) {
+            rc = convert(out, &tmpNumOut, &tmpNumIn, begin, begin + 1);
+            out   += tmpNumOut;
+            begin += tmpNumIn;
+        }
+
+        if (rc < 0) {
+            break;
+        }
+    }
+
+    if (0 <= rc && begin != end) {
+        rc = convert(out, &tmpNumOut, &tmpNumIn, begin, end);
+        out   += tmpNumOut;
+        begin += tmpNumIn;
+    }
+
+    *numOut = static_cast<int>(out   - outBegin);
+    *numIn  = static_cast<int>(begin - inBegin);
+
+    return rc;
+#else
+    return convert(out, numOut, numIn, begin, end);
+#endif
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
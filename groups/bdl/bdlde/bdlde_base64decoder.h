@@ -153,6 +153,19 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Bulk Conversion
+///---------------
+// In addition to the 'convert' method templates, which process one character
+// at a time through arbitrary iterators, 'bdlde::Base64Decoder' provides the
+// 'decode' method, which converts a contiguous buffer of input to a
+// contiguous buffer of output with the same result.  On x86 platforms
+// supporting the SSSE3 instruction set (determined at run time), 'decode'
+// converts 16 characters of input at a time using vector instructions,
+// provided they are all numeric Base64 characters.  Any other block of input
+// (e.g., one containing whitespace, '=', or an unrecognized character) is
+// processed by the per-character state machine, which also reports any error
+// exactly as 'convert' does.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Decoder' object to
@@ -506,6 +519,26 @@ class Base64Decoder {
         // 'endConvert' method be called to complete the encoding of any
         // unprocessed input characters that do not complete a 3-byte sequence.
 
+    int decode(char       *out,
+               int        *numOut,
+               int        *numIn,
+               const char *begin,
+               const char *end);
+        // Decode the sequence of input characters starting at the specified
+        // 'begin' position up to, but not including, the specified 'end'
+        // position, writing the resulting output bytes to the specified 'out'
+        // buffer, and load into the specified 'numOut' and 'numIn' the number
+        // of output bytes produced and input bytes consumed, respectively.
+        // Return a non-negative value on success, -1 on an input error, and
+        // -2 if the 'endConvert' method has already been called without an
+        // intervening 'resetState' call.  The behavior is undefined unless
+        // 'begin <= end' and 'out' refers to a buffer of at least
+        // 'maxDecodedLength(end - begin)' bytes plus the number of bytes
+        // retained by a previous call to 'convert'.  Note that this method
+        // has the same effect as 'convert(out, numOut, numIn, begin, end)',
+        // but is optimized for large contiguous inputs (see
+        // {Bulk Conversion}).
+
     template <class OUTPUT_ITERATOR>
     int endConvert(OUTPUT_ITERATOR out);
     template <class OUTPUT_ITERATOR>
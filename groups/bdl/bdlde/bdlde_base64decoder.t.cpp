@@ -21,7 +21,9 @@
 #include <bsl_cstring.h>   // memset()
 #include <bsl_cctype.h>    // isgraph()
 #include <bsl_climits.h>   // INT_MIN
+#include <bsl_algorithm.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 
 #include <stdio.h>
 
@@ -178,6 +180,7 @@ using namespace bsl;  // automatically added by script
 // [ 2] bdlde::Base64Decoder(int unrecognizedIsErrorFlag);
 // [ 3] ~bdlde::Base64Decoder();
 // [ 8] int convert(char *o, int *no, int *ni, begin, end, int mno);
+// [12] int decode(char *o, int *no, int *ni, const char *b, const char *e)
 // [ 8] int endConvert(char *out, int *numOut, int maxNumOut);
 // [ 9] void resetState();
 // [ 3] bool isAcceptable() const;
@@ -1209,6 +1212,185 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(12)
+{
+        (void)veryVeryVerbose;
+        (void)veryVeryVeryVerbose;
+
+        // --------------------------------------------------------------------
+        // TESTING 'decode'
+        //
+        // Concerns:
+        //: 1 'decode' produces the same output, consumes the same input,
+        //:   returns the same status, and leaves the decoder in the same state
+        //:   as 'convert' for valid inputs of every length, including inputs
+        //:   spanning several vector blocks.
+        //:
+        //: 2 Soft line breaks, whitespace, padding, and unrecognized or
+        //:   invalid characters anywhere in the input (in particular, in the
+        //:   middle of a vector block) are handled exactly as by 'convert',
+        //:   in both the strict and the relaxed modes.
+        //:
+        //: 3 'decode' correctly resumes from any state left by previous calls
+        //:   to 'convert', including a partial quantum and output retained
+        //:   due to 'maxNumOut'.
+        //
+        // Plan:
+        //: 1 For random byte sequences of lengths 0 to 300, encoded with a
+        //:   variety of maximum line lengths, optionally corrupted by
+        //:   replacing a randomly chosen character with whitespace, '=', or
+        //:   an unrecognized character, and for a set of prefixes supplied to
+        //:   'convert' (with and without a 'maxNumOut' limit), decode the
+        //:   input with 'decode' using one decoder and with 'convert' using
+        //:   another, and verify that the results and the states of the two
+        //:   decoders are the same, both before and after calling
+        //:   'endConvert'.  (C-1..3)
+        //
+        // Testing:
+        //   int decode(char *o, int *no, int *ni, const char *b, const char *e)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decode'" << endl
+                          << "================" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 4, 7, 16, 76 };
+        const int NUM_LINE_LENGTHS = static_cast<int>(sizeof LINE_LENGTHS
+                                                    / sizeof *LINE_LENGTHS);
+
+        static const char CORRUPTIONS[] = { ' ', '\n', '\r', '\t', '=', '!',
+                                            '-', '_', '\0', '\x80', '\xff' };
+        const int NUM_CORRUPTIONS = static_cast<int>(sizeof CORRUPTIONS);
+
+        unsigned random = 12345;
+
+        for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+        for (int strict = 0; strict <= 1; ++strict) {
+        for (int prefixLength = 0; prefixLength <= 5; ++prefixLength) {
+        for (int limit = -1; limit <= 0; ++limit) {
+        for (int length = 0; length <= 300; ++length) {
+            const int LINE_LENGTH = LINE_LENGTHS[li];
+
+            // Create the encoded input.
+
+            char data[300];
+            for (int i = 0; i < length; ++i) {
+                random = random * 1103515245 + 12345;
+                data[i] = static_cast<char>(random >> 16);
+            }
+
+            bdlde::Base64Encoder encoder(LINE_LENGTH);
+
+            bsl::string input(
+                 bdlde::Base64Encoder::encodedLength(length, LINE_LENGTH), 0);
+            encoder.convert(input.begin(), data, data + length);
+            encoder.endConvert(input.begin()
+                             + encoder.outputLength());
+
+            random = random * 1103515245 + 12345;
+            const unsigned corruption = (random >> 16) % 4;
+            if (!input.empty() && corruption) {
+                random = random * 1103515245 + 12345;
+                const bsl::size_t index = (random >> 8) % input.size();
+
+                if (3 == corruption) {
+                    input.resize(index);              // truncate
+                }
+                else {
+                    random = random * 1103515245 + 12345;
+                    input[index] =
+                               CORRUPTIONS[(random >> 16) % NUM_CORRUPTIONS];
+                }
+            }
+
+            const char *const INPUT = input.data();
+            const char *const INPUT_END = INPUT + input.size();
+            const char *const PREFIX_END =
+                 INPUT + bsl::min(static_cast<bsl::size_t>(prefixLength),
+                                  input.size());
+
+            if (veryVerbose) {
+                P_(LINE_LENGTH) P_(strict) P_(prefixLength) P_(limit) P(input);
+            }
+
+            Obj mX(strict);  const Obj& X = mX;  // uses 'decode'
+            Obj mY(strict);  const Obj& Y = mY;  // uses 'convert'
+
+            bsl::string outX(Obj::maxDecodedLength(
+                                     static_cast<int>(input.size())) + 8, 0);
+            bsl::string outY(outX);
+
+            // Supply the prefix to both decoders using 'convert', with the
+            // same 'maxNumOut' limit.
+
+            int numOutX = 0, numInX = 0, numOutY = 0, numInY = 0;
+
+            int rcX = mX.convert(&outX[0], &numOutX, &numInX,
+                                 INPUT, PREFIX_END, limit);
+            int rcY = mY.convert(&outY[0], &numOutY, &numInY,
+                                 INPUT, PREFIX_END, limit);
+            ASSERTV(LINE_LENGTH, strict, prefixLength, limit, rcX == rcY);
+
+            int lengthX = numOutX;
+            int lengthY = numOutY;
+
+            const char *const BEGIN = INPUT + numInX;
+
+            rcX = mX.decode(&outX[lengthX], &numOutX, &numInX,
+                            BEGIN, INPUT_END);
+            rcY = mY.convert(&outY[lengthY], &numOutY, &numInY,
+                             BEGIN, INPUT_END);
+
+            ASSERTV(LINE_LENGTH, strict, prefixLength, input, rcX, rcY,
+                    rcX == rcY);
+            ASSERTV(LINE_LENGTH, strict, prefixLength, input,
+                    numOutX, numOutY, numOutX == numOutY);
+            ASSERTV(LINE_LENGTH, strict, prefixLength, input,
+                    numInX, numInY, numInX == numInY);
+            ASSERTV(LINE_LENGTH, strict, prefixLength, limit, input,
+                    X.outputLength() == Y.outputLength());
+            ASSERTV(LINE_LENGTH, strict, prefixLength, limit, input,
+                    X.isError() == Y.isError());
+            ASSERTV(LINE_LENGTH, strict, prefixLength, limit, input,
+                    X.isAcceptable() == Y.isAcceptable());
+            ASSERTV(LINE_LENGTH, strict, prefixLength, limit, input,
+                    X.isMaximal() == Y.isMaximal());
+
+            lengthX += numOutX;
+            lengthY += numOutY;
+
+            rcX = mX.endConvert(&outX[lengthX], &numOutX);
+            rcY = mY.endConvert(&outY[lengthY], &numOutY);
+            ASSERTV(LINE_LENGTH, strict, prefixLength, input,
+                    rcX, rcY, rcX == rcY);
+
+            lengthX += numOutX;
+            lengthY += numOutY;
+
+            ASSERTV(LINE_LENGTH, strict, prefixLength, input,
+                    lengthX, lengthY, lengthX == lengthY);
+            ASSERTV(LINE_LENGTH, strict, prefixLength, limit, input,
+                    outX == outY);
+            ASSERTV(LINE_LENGTH, strict, prefixLength, limit, input,
+                    X.isError() == Y.isError());
+            ASSERTV(LINE_LENGTH, strict, prefixLength, limit, input,
+                    X.isDone() == Y.isDone());
+
+            if (0 == corruption && 0 == prefixLength && 0 > limit) {
+                // Uncorrupted input decodes to the original data.
+
+                ASSERTV(LINE_LENGTH, strict, length, lengthX,
+                        length == lengthX);
+                ASSERTV(LINE_LENGTH, strict, length,
+                        0 == bsl::memcmp(data, outX.data(), length));
+            }
+        }
+        }
+        }
+        }
+        }
+}
+
 DEFINE_TEST_CASE(11)
 {
         (void)veryVeryVerbose;
@@ -5616,6 +5798,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(12);
         CASE(11);
         CASE(10);
         CASE(9);
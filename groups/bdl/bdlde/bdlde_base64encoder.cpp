@@ -12,7 +12,20 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+#endif
 
 namespace BloombergLP {
 
@@ -35,6 +48,123 @@ static const char enc[] = {
     '4', '5', '6', '7', '8', '9', '+', '/',  // 070
 };
 
+                        // =========================
+                        // FILE-SCOPE STATIC HELPERS
+                        // =========================
+
+static
+void encodeQuanta(char *out, const char *input, int numQuanta)
+    // Encode the specified 'numQuanta' 3-byte quanta starting at the specified
+    // 'input' into '4 * numQuanta' characters starting at the specified 'out'.
+{
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(input);
+
+    for (; numQuanta > 0; --numQuanta, in += 3, out += 4) {
+        const unsigned value = (static_cast<unsigned>(in[0]) << 16)
+                             | (static_cast<unsigned>(in[1]) <<  8)
+                             |  static_cast<unsigned>(in[2]);
+
+        out[0] = enc[ value >> 18        ];
+        out[1] = enc[(value >> 12) & 0x3f];
+        out[2] = enc[(value >>  6) & 0x3f];
+        out[3] = enc[ value        & 0x3f];
+    }
+}
+
+#if defined(LIKE_X86_GCC)
+
+__attribute__((target("ssse3")))
+static
+void encodeBlockSsse3(char *out, const char *input)
+    // Encode the 4 3-byte quanta (12 bytes) starting at the specified 'input'
+    // into 16 characters starting at the specified 'out' using SSSE3
+    // instructions.  The behavior is undefined unless 16 bytes starting at
+    // 'input' can be read.
+{
+    // Distribute the bytes of each quantum, 'abc', over a 32-bit lane as
+    // 'bacb', so that each of the four 6-bit values can be shifted into its
+    // own byte by 16-bit multiplications.
+
+    __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11,  9, 10,
+                                            7,  8,  6,  7,
+                                            4,  5,  3,  4,
+                                            1,  2,  0,  1));
+
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Map each 6-bit value to its character by adding an offset selected by
+    // the range ('A-Z', 'a-z', '0-9', '+', or '/') the value falls in.
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    range = _mm_or_si128(range, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A',      0,
+                                          0);
+
+    const __m128i result = _mm_add_epi8(_mm_shuffle_epi8(offsets, range),
+                                        indices);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), result);
+}
+
+static
+bool hasSsse3()
+    // Return 'true' if the CPU on which this process is running supports the
+    // SSSE3 instruction set, and 'false' otherwise.
+{
+    static bool result = false;
+
+    BSLMT_ONCE_DO {
+        __builtin_cpu_init();
+        result = __builtin_cpu_supports("ssse3");
+    }
+
+    return result;
+}
+
+#endif  // LIKE_X86_GCC
+
+static
+void encodeQuantaBulk(char       *out,
+                      const char *input,
+                      const char *inputEnd,
+                      int         numQuanta)
+    // Encode the specified 'numQuanta' 3-byte quanta starting at the specified
+    // 'input' into '4 * numQuanta' characters starting at the specified 'out',
+    // using vector instructions if supported by the CPU.  The behavior is
+    // undefined unless '[input, inputEnd)' is a readable range containing at
+    // least 'numQuanta' quanta.
+{
+#if defined(LIKE_X86_GCC)
+    if (numQuanta >= 4 && hasSsse3()) {
+        // Note that each block reads 16 bytes of input, of which only 12 are
+        // encoded.
+
+        while (numQuanta >= 4 && inputEnd - input >= 16) {
+            encodeBlockSsse3(out, input);
+            out       += 16;
+            input     += 12;
+            numQuanta -= 4;
+        }
+    }
+#else
+    (void)inputEnd;
+#endif
+
+    encodeQuanta(out, input, numQuanta);
+}
+
 namespace bdlde {
 
                          // -------------------
@@ -56,6 +186,94 @@ Base64Encoder::~Base64Encoder()
     BSLS_ASSERT(0 <= d_outputLength);
 }
 
+// MANIPULATORS
+int Base64Encoder::encode(char       *out,
+                          int        *numOut,
+                          int        *numIn,
+                          const char *begin,
+                          const char *end)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(numIn);
+    BSLS_ASSERT(begin <= end);
+
+    if (e_ERROR_STATE == d_state || e_DONE_STATE == d_state) {
+        return convert(out, numOut, numIn, begin, end);               // RETURN
+    }
+
+    char *const       outBegin = out;
+    const char *const inBegin  = begin;
+
+    int tmpNumOut;
+    int tmpNumIn;
+
+    // Emit any output retained from a previous call, and complete any
+    // partial quantum, using the state machine.
+
+    if (6 <= d_bitsInStack) {
+        convert(out, &tmpNumOut, &tmpNumIn, begin, begin);
+        out += tmpNumOut;
+    }
+
+    while (d_bitsInStack && begin != end) {
+        convert(out, &tmpNumOut, &tmpNumIn, begin, begin + 1);
+        out   += tmpNumOut;
+        begin += tmpNumIn;
+    }
+
+    while (end - begin >= 3) {
+        int numQuanta = static_cast<int>((end - begin) / 3);
+
+        if (d_maxLineLength) {
+            if (d_lineLength >= d_maxLineLength) {
+                // Emit the soft line break pending at the end of the current
+                // line, as 'append' would before the next character.
+
+                if (d_lineLength == d_maxLineLength) {
+                    *out++ = '\r';
+                    ++d_outputLength;
+                }
+                *out++ = '\n';
+                ++d_outputLength;
+                d_lineLength = 0;
+            }
+
+            const int numLineQuanta = (d_maxLineLength - d_lineLength) / 4;
+            if (0 == numLineQuanta) {
+                // The next quantum straddles a line break.
+
+                convert(out, &tmpNumOut, &tmpNumIn, begin, begin + 3);
+                out   += tmpNumOut;
+                begin += tmpNumIn;
+                continue;
+            }
+            if (numQuanta > numLineQuanta) {
+                numQuanta = numLineQuanta;
+            }
+        }
+
+        encodeQuantaBulk(out, begin, end, numQuanta);
+
+        out            += 4 * numQuanta;
+        begin          += 3 * numQuanta;
+        d_lineLength   += 4 * numQuanta;
+        d_outputLength += 4 * numQuanta;
+    }
+
+    // Retain the final one or two bytes using the state machine.
+
+    if (begin != end) {
+        convert(out, &tmpNumOut, &tmpNumIn, begin, end);
+        out   += tmpNumOut;
+        begin += tmpNumIn;
+    }
+
+    *numOut = static_cast<int>(out   - outBegin);
+    *numIn  = static_cast<int>(begin - inBegin);
+
+    return 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -153,6 +153,20 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Bulk Conversion
+///---------------
+// In addition to the 'convert' method templates, which process one byte at a
+// time through arbitrary iterators, 'bdlde::Base64Encoder' provides the
+// 'encode' method, which converts a contiguous buffer of input to a
+// contiguous buffer of output with the same result (including the insertion
+// of soft line breaks).  On x86 platforms supporting the SSSE3 instruction
+// set (determined at run time), 'encode' converts 12 bytes of input at a time
+// using vector instructions; on other platforms it converts 3 bytes at a time.
+// The per-byte state machine is used only to complete a 3-byte quantum
+// retained from a previous call, for a quantum straddling a line break, and
+// for the final one or two bytes of the input.  'bdlde::Base64Decoder'
+// provides the corresponding 'decode' method.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Encoder' object to
@@ -553,6 +567,23 @@ class Base64Encoder {
         // of any unprocessed input characters that do not complete a 3-byte
         // sequence.
 
+    int encode(char       *out,
+               int        *numOut,
+               int        *numIn,
+               const char *begin,
+               const char *end);
+        // Encode the sequence of input bytes starting at the specified 'begin'
+        // position up to, but not including, the specified 'end' position,
+        // writing the resulting output characters to the specified 'out'
+        // buffer, and load into the specified 'numOut' and 'numIn' the number
+        // of output bytes produced and input bytes consumed, respectively.
+        // Return 0 on success and a negative value otherwise.  The behavior
+        // is undefined unless 'begin <= end' and 'out' refers to a buffer
+        // large enough to hold the resulting output (see 'encodedLength').
+        // Note that this method has the same effect as
+        // 'convert(out, numOut, numIn, begin, end)', but is optimized for
+        // large contiguous inputs (see {Bulk Conversion}).
+
     template <class OUTPUT_ITERATOR>
     int endConvert(OUTPUT_ITERATOR out);
     template <class OUTPUT_ITERATOR>
@@ -22,6 +22,7 @@
 #include <bsl_cctype.h>    // isgraph()
 #include <bsl_climits.h>   // INT_MAX
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -100,6 +101,7 @@ using namespace bsl;  // automatically added by script
 // [ 2] bdlde::Base64Encoder(int maxLineLength);
 // [ 3] ~bdlde::Base64Encoder();
 //*[ 8] int convert(char *o, int *no, int *ni, begin, end, int mno);
+// [14] int encode(char *o, int *no, int *ni, const char *b, const char *e)
 //*[ 8] int endConvert(char *out, int *numOut, int maxNumOut);
 // [ 7] int convert(char *o, int *no, int*ni, const char*b, const char*e);
 // [ 7] int endConvert(char *out, int *numOut);
@@ -1220,6 +1222,139 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode'
+        //
+        // Concerns:
+        //: 1 'encode' produces the same output, consumes the same input, and
+        //:   leaves the encoder in the same state as 'convert' for inputs of
+        //:   every length, including inputs spanning several vector blocks.
+        //:
+        //: 2 Soft line breaks are inserted exactly as by 'convert' for every
+        //:   maximum line length, including lengths that are not multiples of
+        //:   4 (so that quanta straddle line breaks) and 0.
+        //:
+        //: 3 'encode' correctly resumes from any state left by previous calls
+        //:   to 'convert', including a partial quantum, output retained due
+        //:   to 'maxNumOut', and a pending line break.
+        //:
+        //: 4 'encode' fails, exactly as 'convert' does, if called after
+        //:   'endConvert'.
+        //
+        // Plan:
+        //: 1 For a set of maximum line lengths, a set of prefixes supplied to
+        //:   'convert' (with and without a 'maxNumOut' limit), and random
+        //:   inputs of lengths 0 to 300, encode the input with 'encode' using
+        //:   one encoder and with 'convert' using another, call 'endConvert'
+        //:   on both, and verify that the results and the states of the two
+        //:   encoders are the same.  (C-1..3)
+        //:
+        //: 2 Call 'encode' after 'endConvert' and verify that it fails and
+        //:   puts the encoder in the error state.  (C-4)
+        //
+        // Testing:
+        //   int encode(char *o, int *no, int *ni, const char *b, const char *e)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encode'" << endl
+                          << "================" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 15, 16,
+                                            17, 76, 77, 78, 79, 100 };
+        const int NUM_LINE_LENGTHS = static_cast<int>(sizeof LINE_LENGTHS
+                                                    / sizeof *LINE_LENGTHS);
+
+        unsigned random = 12345;
+
+        for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+            const int LINE_LENGTH = LINE_LENGTHS[li];
+
+            for (int prefixLength = 0; prefixLength <= 4; ++prefixLength) {
+            for (int limit = -1; limit <= 1; ++limit) {
+            for (int length = 0; length <= 300; ++length) {
+                char input[304];
+                for (int i = 0; i < prefixLength + length; ++i) {
+                    random = random * 1103515245 + 12345;
+                    input[i] = static_cast<char>(random >> 16);
+                }
+                const char *const INPUT      = input;
+                const char *const PREFIX_END = INPUT + prefixLength;
+                const char *const INPUT_END  = PREFIX_END + length;
+
+                Obj mX(LINE_LENGTH);  const Obj& X = mX;  // uses 'encode'
+                Obj mY(LINE_LENGTH);  const Obj& Y = mY;  // uses 'convert'
+
+                bsl::string outX(Obj::encodedLength(prefixLength + length,
+                                                    LINE_LENGTH) + 8,
+                                 '\0');
+                bsl::string outY(outX);
+
+                // Supply the prefix to both encoders using 'convert', with
+                // the same 'maxNumOut' limit.
+
+                int numOutX = 0, numInX = 0, numOutY = 0, numInY = 0;
+
+                int rcX = mX.convert(&outX[0], &numOutX, &numInX,
+                                     INPUT, PREFIX_END, limit);
+                int rcY = mY.convert(&outY[0], &numOutY, &numInY,
+                                     INPUT, PREFIX_END, limit);
+                ASSERTV(LINE_LENGTH, prefixLength, limit, rcX == rcY);
+
+                int lengthX = numOutX;
+                int lengthY = numOutY;
+
+                const char *const BEGIN = INPUT + numInX;
+
+                rcX = mX.encode(&outX[lengthX], &numOutX, &numInX,
+                                BEGIN, INPUT_END);
+                rcY = mY.convert(&outY[lengthY], &numOutY, &numInY,
+                                 BEGIN, INPUT_END);
+
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length, rcX, rcY,
+                        rcX == rcY);
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length,
+                        numOutX, numOutY, numOutX == numOutY);
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length,
+                        numInX, numInY, numInX == numInY);
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length,
+                        X.outputLength() == Y.outputLength());
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length,
+                        X.isAcceptable() == Y.isAcceptable());
+
+                lengthX += numOutX;
+                lengthY += numOutY;
+
+                rcX = mX.endConvert(&outX[lengthX], &numOutX);
+                rcY = mY.endConvert(&outY[lengthY], &numOutY);
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length,
+                        0 == rcX && 0 == rcY);
+
+                lengthX += numOutX;
+                lengthY += numOutY;
+
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length,
+                        lengthX, lengthY, lengthX == lengthY);
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length,
+                        outX == outY);
+                ASSERTV(LINE_LENGTH, prefixLength, limit, length,
+                        X.isDone() && Y.isDone());
+
+                // 'encode' after 'endConvert' is an error.
+
+                if (0 == prefixLength && 0 == limit && length < 4) {
+                    ASSERT(0 > mX.encode(&outX[0], &numOutX, &numInX,
+                                         INPUT, INPUT_END));
+                    ASSERT(0 == numOutX);
+                    ASSERT(0 == numInX);
+                    ASSERT(X.isError());
+                }
+            }
+            }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING OPTIONAL NUMIN, NUMOUT
@@ -0,0 +1,815 @@
+// bdlde_gziputil.cpp                                                 -*-C++-*-
+#include <bdlde_gziputil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_gziputil_cpp,"$Id$ $CSID$")
+
+#include <bdlde_crc32.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_ios.h>
+#include <bsl_vector.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The data is divided into DEFLATE blocks of at most 'k_BLOCK_SIZE' bytes
+// (plus the length of a match straddling that limit).  The literals and
+// matches of a block are recorded in 'd_symbols', together with the number of
+// bits needed to write them using the fixed Huffman codes, and the block is
+// written once it is complete: using the fixed Huffman codes, unless storing
+// its bytes as they are (in a "stored" block, having a 4-byte length header,
+// aligned on a byte) is smaller, so that incompressible data grows by at most
+// 5 bytes per block.  A block ends before the window is moved past its first
+// byte (its bytes remaining in the window for a stored block), and the last
+// block is marked final when the end of the input is reached.  Matches may
+// refer to the bytes of previous blocks, whichever their type.
+//
+// The LZ77 matching follows the scheme used by 'zlib': the window buffer holds
+// twice the maximum match distance, and its upper half is moved to its lower
+// half when the current position gets close to its end.  The head of the hash
+// chain of each 3-byte prefix is stored in 'd_head', and the previous position
+// having the same hash value as each position of the window is stored in
+// 'd_prev' (indexed by the position modulo the maximum distance).  Positions
+// are offsets in the window buffer, adjusted when the window is moved, and -1
+// denotes the end of a chain.
+//
+// The Huffman codes are written most-significant bit first, whereas all other
+// values are written least-significant bit first: the codes are reversed once,
+// when the code tables are built.
+
+namespace BloombergLP {
+namespace bdlde {
+namespace {
+
+typedef bsls::Types::Uint64 Uint64;
+
+enum {
+    k_WINDOW_SIZE        = 32768,     // maximum distance of a match
+    k_WINDOW_MASK        = k_WINDOW_SIZE - 1,
+    k_HASH_BITS          = 15,
+    k_HASH_SIZE          = 1 << k_HASH_BITS,
+    k_HASH_MASK          = k_HASH_SIZE - 1,
+    k_MIN_MATCH          = 3,         // shortest match encoded
+    k_MAX_MATCH          = 258,       // longest match encoded
+    k_MIN_LOOKAHEAD      = k_MAX_MATCH + k_MIN_MATCH + 1,
+    k_MAX_CHAIN          = 64,        // hash chain entries searched
+    k_NICE_MATCH         = 128,       // match length ending a search
+    k_NUM_LITERAL_CODES  = 288,
+    k_END_OF_BLOCK       = 256,
+    k_BLOCK_SIZE         = 16 * 1024, // input bytes ending a block
+    k_OUTPUT_BUFFER_SIZE = 16 * 1024
+};
+
+const unsigned char k_GZIP_HEADER[] = {
+    0x1f, 0x8b,              // magic number
+    0x08,                    // compression method: DEFLATE
+    0x00,                    // flags: none
+    0x00, 0x00, 0x00, 0x00,  // modification time: unavailable
+    0x00,                    // extra flags
+    0xff                     // operating system: unknown
+};
+
+inline
+int highestBit(unsigned int value)
+    // Return the index of the most significant bit set in the specified
+    // 'value'.  The behavior is undefined unless '0 != value'.
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(
+                                            static_cast<bsl::uint32_t>(value));
+}
+
+unsigned int reverseBits(unsigned int code, int numBits)
+    // Return the specified 'code' having the specified 'numBits' bits, with
+    // the order of these bits reversed.
+{
+    unsigned int result = 0;
+
+    for (int i = 0; i < numBits; ++i) {
+        result = (result << 1) | (code & 1);
+        code >>= 1;
+    }
+    return result;
+}
+
+void lengthCode(unsigned int *code,
+                int          *numExtraBits,
+                unsigned int *extra,
+                int           length)
+    // Load into the specified 'code', 'numExtraBits', and 'extra' the
+    // literal/length code, the number of extra bits, and the extra bits
+    // encoding the specified match 'length'.  The behavior is undefined unless
+    // 'k_MIN_MATCH <= length <= k_MAX_MATCH'.
+{
+    // Length codes 257..284 encode the lengths 3..257 in 7 groups of 4 codes
+    // (the first group having no extra bit, and each following group having
+    // one more extra bit), and the code 285 encodes the length 258.
+
+    const unsigned int lengthOffset = length - k_MIN_MATCH;
+
+    *numExtraBits = 0;
+    *extra        = 0;
+
+    if (k_MAX_MATCH == length) {
+        *code = 285;
+    }
+    else if (lengthOffset < 8) {
+        *code = 257 + lengthOffset;
+    }
+    else {
+        const int bit = highestBit(lengthOffset);
+
+        *numExtraBits = bit - 2;
+        *code         = 257 + 4 * (bit - 1)
+                      + ((lengthOffset >> *numExtraBits) & 3);
+        *extra        = lengthOffset & ((1u << *numExtraBits) - 1);
+    }
+}
+
+void distanceCode(unsigned int *code,
+                  int          *numExtraBits,
+                  unsigned int *extra,
+                  int           distance)
+    // Load into the specified 'code', 'numExtraBits', and 'extra' the
+    // distance code, the number of extra bits, and the extra bits encoding
+    // the specified match 'distance'.  The behavior is undefined unless
+    // '1 <= distance <= k_WINDOW_SIZE'.
+{
+    // Distance codes 0..29 encode the distances 1..32768 in groups of 2 codes
+    // (the first 2 groups having no extra bit, and each following group
+    // having one more extra bit).
+
+    const unsigned int distanceOffset = distance - 1;
+
+    if (distanceOffset < 4) {
+        *code         = distanceOffset;
+        *numExtraBits = 0;
+        *extra        = 0;
+    }
+    else {
+        const int bit = highestBit(distanceOffset);
+
+        *numExtraBits = bit - 1;
+        *code         = 2 * bit + ((distanceOffset >> *numExtraBits) & 1);
+        *extra        = distanceOffset & ((1u << *numExtraBits) - 1);
+    }
+}
+
+struct Symbol {
+    // This 'struct' holds a literal or a match of a block being compressed.
+
+    unsigned short d_length;    // match length, or literal byte if
+                                // 'd_distance' is 0
+    unsigned short d_distance;  // match distance, or 0 for a literal
+};
+
+                              // ===============
+                              // class BitWriter
+                              // ===============
+
+class BitWriter {
+    // This class writes sequences of bits, least-significant bit first, to a
+    // stream buffer, through an internal buffer.
+
+    // DATA
+    bsl::streambuf *d_output_p;                        // held, not owned
+    Uint64          d_bits;                            // pending bits
+    int             d_numBits;                         // number of pending
+                                                       // bits
+    char            d_buffer[k_OUTPUT_BUFFER_SIZE];    // output buffer
+    int             d_length;                          // bytes in 'd_buffer'
+    bool            d_failed;                          // 'true' if writing
+                                                       // to 'd_output_p'
+                                                       // failed
+
+    // PRIVATE MANIPULATORS
+    void putByte(unsigned int byte);
+        // Append the low-order 8 bits of the specified 'byte' to the output
+        // buffer, writing the buffer first if it is full.
+
+  public:
+    // CREATORS
+    explicit BitWriter(bsl::streambuf *output);
+        // Create a bit writer writing to the specified 'output'.
+
+    // MANIPULATORS
+    void alignToByte();
+        // Write the pending bits, padded with 0 bits to a multiple of 8.
+
+    void flush();
+        // Write the output buffer to the stream buffer.
+
+    void writeBits(unsigned int value, int numBits);
+        // Write the low-order specified 'numBits' bits of the specified
+        // 'value'.  The behavior is undefined unless '0 <= numBits <= 16'.
+
+    void writeBytes(const unsigned char *bytes, int numBytes);
+        // Write the specified 'numBytes' 'bytes'.  The behavior is undefined
+        // unless no bits are pending (i.e., unless 'alignToByte' was called
+        // after the last call to 'writeBits').
+
+    void writeUint32(unsigned int value);
+        // Write the specified 'value' in 4 bytes, least-significant byte
+        // first.  The behavior is undefined unless no bits are pending.
+
+    // ACCESSORS
+    bool hasFailed() const;
+        // Return 'true' if writing to the stream buffer failed, and 'false'
+        // otherwise.
+
+    int numPendingBits() const;
+        // Return the number of bits written that are not yet in the output
+        // buffer.
+};
+
+                              // ---------------
+                              // class BitWriter
+                              // ---------------
+
+// PRIVATE MANIPULATORS
+inline
+void BitWriter::putByte(unsigned int byte)
+{
+    if (k_OUTPUT_BUFFER_SIZE == d_length) {
+        flush();
+    }
+    d_buffer[d_length++] = static_cast<char>(byte & 0xff);
+}
+
+// CREATORS
+BitWriter::BitWriter(bsl::streambuf *output)
+: d_output_p(output)
+, d_bits(0)
+, d_numBits(0)
+, d_length(0)
+, d_failed(false)
+{
+}
+
+// MANIPULATORS
+void BitWriter::alignToByte()
+{
+    while (0 < d_numBits) {
+        putByte(static_cast<unsigned int>(d_bits));
+        d_bits    >>= 8;
+        d_numBits  -= 8;
+    }
+    d_bits    = 0;
+    d_numBits = 0;
+}
+
+void BitWriter::flush()
+{
+    if (d_length && d_output_p->sputn(d_buffer, d_length) != d_length) {
+        d_failed = true;
+    }
+    d_length = 0;
+}
+
+inline
+void BitWriter::writeBits(unsigned int value, int numBits)
+{
+    BSLS_ASSERT_SAFE(0 <= numBits && numBits <= 16);
+
+    d_bits    |= static_cast<Uint64>(value) << d_numBits;
+    d_numBits += numBits;
+
+    if (32 <= d_numBits) {
+        putByte(static_cast<unsigned int>(d_bits));
+        putByte(static_cast<unsigned int>(d_bits >> 8));
+        putByte(static_cast<unsigned int>(d_bits >> 16));
+        putByte(static_cast<unsigned int>(d_bits >> 24));
+        d_bits    >>= 32;
+        d_numBits  -= 32;
+    }
+}
+
+void BitWriter::writeBytes(const unsigned char *bytes, int numBytes)
+{
+    BSLS_ASSERT(0 == d_numBits);
+
+    for (int i = 0; i < numBytes; ++i) {
+        putByte(bytes[i]);
+    }
+}
+
+void BitWriter::writeUint32(unsigned int value)
+{
+    BSLS_ASSERT(0 == d_numBits);
+
+    putByte(value);
+    putByte(value >> 8);
+    putByte(value >> 16);
+    putByte(value >> 24);
+}
+
+// ACCESSORS
+inline
+bool BitWriter::hasFailed() const
+{
+    return d_failed;
+}
+
+inline
+int BitWriter::numPendingBits() const
+{
+    return d_numBits;
+}
+
+                              // ==============
+                              // class Deflater
+                              // ==============
+
+class Deflater {
+    // This class implements the compression of a stream buffer into a
+    // sequence of DEFLATE blocks, each using the fixed Huffman codes or
+    // storing its bytes as they are.
+
+    // DATA
+    bsl::streambuf             *d_input_p;    // held, not owned
+    BitWriter                  *d_writer_p;   // held, not owned
+    bsl::vector<unsigned char>  d_window;     // input data
+    bsl::vector<int>            d_head;       // first position of each chain
+    bsl::vector<int>            d_prev;       // next position in each chain
+    int                         d_position;   // current offset in 'd_window'
+    int                         d_lookahead;  // bytes available at, and
+                                              // following, 'd_position'
+    bool                        d_isEof;      // 'true' if 'd_input_p' is
+                                              // exhausted
+    Crc32                       d_crc;        // checksum of the data read
+    unsigned int                d_size;       // bytes read, modulo 2^32
+    bsl::vector<Symbol>         d_symbols;    // symbols of the current block
+    Uint64                      d_blockBits;  // bits of 'd_symbols' using the
+                                              // fixed Huffman codes
+    int                         d_blockStart; // offset in 'd_window' of the
+                                              // first byte of the current
+                                              // block
+    unsigned short              d_literalCodes[k_NUM_LITERAL_CODES];
+                                              // reversed literal/length
+                                              // codes
+    unsigned char               d_literalLengths[k_NUM_LITERAL_CODES];
+                                              // lengths of the codes above
+
+    // PRIVATE MANIPULATORS
+    void fillWindow();
+        // Read data from the input into the window, until the window is full
+        // or the input is exhausted.
+
+    int insertString(int position);
+        // Insert the specified 'position' into the hash chain of the 3 bytes
+        // at 'position' in the window, and return the previous head of the
+        // chain.  The behavior is undefined unless
+        // 'position + k_MIN_MATCH <= d_position + d_lookahead'.
+
+    void addLiteral(unsigned int byte);
+        // Append the specified literal 'byte' to the current block.
+
+    void addMatch(int length, int distance);
+        // Append a match of the specified 'length' at the specified
+        // 'distance' to the current block.
+
+    void slideWindow();
+        // Move the upper half of the window to its lower half, and update the
+        // hash chains.  The behavior is undefined unless the first byte of
+        // the current block is in the upper half of the window.
+
+    void writeBlock(bool isFinal);
+        // Write the current block, marked as the final block if the specified
+        // 'isFinal' is 'true', using the fixed Huffman codes or as a stored
+        // block, whichever is smaller, and start a new block at the current
+        // position.
+
+    void writeLiteral(unsigned int byte);
+        // Write the code of the specified literal 'byte'.
+
+    void writeMatch(int length, int distance);
+        // Write the codes of a match of the specified 'length' at the
+        // specified 'distance'.
+
+    // PRIVATE ACCESSORS
+    int longestMatch(int chainHead, int *distance) const;
+        // Return the length of the longest match of the string at the current
+        // position among those of the hash chain starting at the specified
+        // 'chainHead', and load its distance into the specified 'distance'.
+        // Return a value less than 'k_MIN_MATCH' if no match is found.
+
+  public:
+    // CREATORS
+    Deflater(bsl::streambuf   *input,
+             BitWriter        *writer,
+             bslma::Allocator *basicAllocator);
+        // Create a deflater reading from the specified 'input' and writing to
+        // the specified 'writer', using the specified 'basicAllocator' to
+        // supply memory.
+
+    // MANIPULATORS
+    void deflate();
+        // Read the input to its end, and write it as a sequence of DEFLATE
+        // blocks, the last of which is marked final.
+
+    // ACCESSORS
+    unsigned int checksum() const;
+        // Return the CRC-32 checksum of the data read.
+
+    unsigned int size() const;
+        // Return the number of bytes read, modulo 2^32.
+
+    void writeEndOfBlock() const;
+        // Write the end-of-block code.
+};
+
+                              // --------------
+                              // class Deflater
+                              // --------------
+
+// PRIVATE MANIPULATORS
+void Deflater::fillWindow()
+{
+    const int capacity = 2 * k_WINDOW_SIZE;
+
+    while (!d_isEof && d_position + d_lookahead < capacity) {
+        const int             offset    = d_position + d_lookahead;
+        const bsl::streamsize requested = capacity - offset;
+        const bsl::streamsize numRead   = d_input_p->sgetn(
+                                  reinterpret_cast<char *>(&d_window[offset]),
+                                  requested);
+
+        if (0 < numRead) {
+            d_crc.update(&d_window[offset], static_cast<bsl::size_t>(numRead));
+            d_size      += static_cast<unsigned int>(numRead);
+            d_lookahead += static_cast<int>(numRead);
+        }
+        if (numRead < requested) {
+            d_isEof = true;
+        }
+    }
+}
+
+inline
+int Deflater::insertString(int position)
+{
+    const unsigned char *p    = &d_window[position];
+    const unsigned int   hash = ((static_cast<unsigned int>(p[0]) << 10)
+                               ^ (static_cast<unsigned int>(p[1]) << 5)
+                               ^ p[2]) & k_HASH_MASK;
+
+    const int head = d_head[hash];
+
+    d_prev[position & k_WINDOW_MASK] = head;
+    d_head[hash]                     = position;
+
+    return head;
+}
+
+inline
+void Deflater::addLiteral(unsigned int byte)
+{
+    const Symbol symbol = { static_cast<unsigned short>(byte), 0 };
+    d_symbols.push_back(symbol);
+
+    d_blockBits += d_literalLengths[byte];
+}
+
+void Deflater::addMatch(int length, int distance)
+{
+    BSLS_ASSERT_SAFE(k_MIN_MATCH <= length && length <= k_MAX_MATCH);
+    BSLS_ASSERT_SAFE(1 <= distance && distance <= k_WINDOW_SIZE);
+
+    const Symbol symbol = { static_cast<unsigned short>(length),
+                            static_cast<unsigned short>(distance) };
+    d_symbols.push_back(symbol);
+
+    unsigned int code;
+    int          numExtraBits;
+    unsigned int extra;
+
+    lengthCode(&code, &numExtraBits, &extra, length);
+    d_blockBits += d_literalLengths[code] + numExtraBits;
+
+    // Distance codes have 5 bits.
+
+    distanceCode(&code, &numExtraBits, &extra, distance);
+    d_blockBits += 5 + numExtraBits;
+}
+
+void Deflater::slideWindow()
+{
+    BSLS_ASSERT(k_WINDOW_SIZE <= d_blockStart);
+
+    const int length = d_position + d_lookahead - k_WINDOW_SIZE;
+
+    bsl::memmove(&d_window[0], &d_window[k_WINDOW_SIZE], length);
+    d_position   -= k_WINDOW_SIZE;
+    d_blockStart -= k_WINDOW_SIZE;
+
+    for (int i = 0; i < k_HASH_SIZE; ++i) {
+        const int value = d_head[i];
+        d_head[i] = value >= k_WINDOW_SIZE ? value - k_WINDOW_SIZE : -1;
+    }
+    for (int i = 0; i < k_WINDOW_SIZE; ++i) {
+        const int value = d_prev[i];
+        d_prev[i] = value >= k_WINDOW_SIZE ? value - k_WINDOW_SIZE : -1;
+    }
+}
+
+void Deflater::writeBlock(bool isFinal)
+{
+    const int length = d_position - d_blockStart;
+
+    // The block header has 3 bits: 'BFINAL', then 'BTYPE' (01 for the fixed
+    // Huffman codes, and 00 for a stored block).  A stored block is then
+    // aligned on a byte, and its bytes are preceded by their number and the
+    // one's complement of that number, in 2 bytes each.
+
+    const int    padding    = (8 - (d_writer_p->numPendingBits() + 3) % 8) % 8;
+    const Uint64 fixedBits  = d_blockBits + d_literalLengths[k_END_OF_BLOCK];
+    const Uint64 storedBits = padding + 32 + 8 * static_cast<Uint64>(length);
+
+    if (fixedBits <= storedBits) {
+        d_writer_p->writeBits(isFinal ? 3 : 2, 3);
+
+        for (bsl::size_t i = 0; i < d_symbols.size(); ++i) {
+            const Symbol& symbol = d_symbols[i];
+
+            if (0 == symbol.d_distance) {
+                writeLiteral(symbol.d_length);
+            }
+            else {
+                writeMatch(symbol.d_length, symbol.d_distance);
+            }
+        }
+        writeEndOfBlock();
+    }
+    else {
+        BSLS_ASSERT(length <= 0xffff);
+
+        const unsigned char header[] = {
+            static_cast<unsigned char>(length),
+            static_cast<unsigned char>(length >> 8),
+            static_cast<unsigned char>(~length),
+            static_cast<unsigned char>(~length >> 8)
+        };
+
+        d_writer_p->writeBits(isFinal ? 1 : 0, 3);
+        d_writer_p->alignToByte();
+        d_writer_p->writeBytes(header, sizeof header);
+        d_writer_p->writeBytes(&d_window[d_blockStart], length);
+    }
+
+    d_symbols.clear();
+    d_blockBits  = 0;
+    d_blockStart = d_position;
+}
+
+inline
+void Deflater::writeLiteral(unsigned int byte)
+{
+    d_writer_p->writeBits(d_literalCodes[byte], d_literalLengths[byte]);
+}
+
+void Deflater::writeMatch(int length, int distance)
+{
+    BSLS_ASSERT_SAFE(k_MIN_MATCH <= length && length <= k_MAX_MATCH);
+    BSLS_ASSERT_SAFE(1 <= distance && distance <= k_WINDOW_SIZE);
+
+    unsigned int code;
+    int          numExtraBits;
+    unsigned int extra;
+
+    lengthCode(&code, &numExtraBits, &extra, length);
+
+    d_writer_p->writeBits(d_literalCodes[code], d_literalLengths[code]);
+    if (numExtraBits) {
+        d_writer_p->writeBits(extra, numExtraBits);
+    }
+
+    // Distance codes have 5 bits.
+
+    distanceCode(&code, &numExtraBits, &extra, distance);
+
+    d_writer_p->writeBits(reverseBits(code, 5), 5);
+    if (numExtraBits) {
+        d_writer_p->writeBits(extra, numExtraBits);
+    }
+}
+
+// PRIVATE ACCESSORS
+int Deflater::longestMatch(int chainHead, int *distance) const
+{
+    const int maxLength = d_lookahead < k_MAX_MATCH ? d_lookahead
+                                                    : k_MAX_MATCH;
+
+    const unsigned char *current = &d_window[d_position];
+
+    int bestLength = k_MIN_MATCH - 1;
+    int candidate  = chainHead;
+
+    for (int chain = k_MAX_CHAIN;
+         0 <= candidate
+      && d_position - candidate <= k_WINDOW_SIZE
+      && 0 < chain;
+         --chain) {
+        const unsigned char *match = &d_window[candidate];
+
+        if (match[bestLength] == current[bestLength]
+         && match[0]          == current[0]) {
+            int length = 1;
+            while (length < maxLength && match[length] == current[length]) {
+                ++length;
+            }
+
+            if (bestLength < length) {
+                bestLength = length;
+                *distance  = d_position - candidate;
+
+                if (k_NICE_MATCH <= length || maxLength == length) {
+                    break;
+                }
+            }
+        }
+
+        const int next = d_prev[candidate & k_WINDOW_MASK];
+        if (next >= candidate) {
+            break;
+        }
+        candidate = next;
+    }
+
+    return bestLength;
+}
+
+// CREATORS
+Deflater::Deflater(bsl::streambuf   *input,
+                   BitWriter        *writer,
+                   bslma::Allocator *basicAllocator)
+: d_input_p(input)
+, d_writer_p(writer)
+, d_window(2 * k_WINDOW_SIZE, 0, basicAllocator)
+, d_head(k_HASH_SIZE, -1, basicAllocator)
+, d_prev(k_WINDOW_SIZE, -1, basicAllocator)
+, d_position(0)
+, d_lookahead(0)
+, d_isEof(false)
+, d_crc()
+, d_size(0)
+, d_symbols(basicAllocator)
+, d_blockBits(0)
+, d_blockStart(0)
+{
+    // The fixed literal/length codes are: 8 bits from 00110000 for 0..143, 9
+    // bits from 110010000 for 144..255, 7 bits from 0000000 for 256..279, and
+    // 8 bits from 11000000 for 280..287.
+
+    for (int i = 0; i < k_NUM_LITERAL_CODES; ++i) {
+        unsigned int code;
+        int          length;
+
+        if (i < 144) {
+            code   = 0x30 + i;
+            length = 8;
+        }
+        else if (i < 256) {
+            code   = 0x190 + i - 144;
+            length = 9;
+        }
+        else if (i < 280) {
+            code   = i - 256;
+            length = 7;
+        }
+        else {
+            code   = 0xc0 + i - 280;
+            length = 8;
+        }
+
+        d_literalCodes[i]   = static_cast<unsigned short>(
+                                                   reverseBits(code, length));
+        d_literalLengths[i] = static_cast<unsigned char>(length);
+    }
+
+    d_symbols.reserve(k_BLOCK_SIZE);
+}
+
+// MANIPULATORS
+void Deflater::deflate()
+{
+    fillWindow();
+
+    while (0 < d_lookahead) {
+        if (d_lookahead < k_MIN_LOOKAHEAD && !d_isEof) {
+            if (2 * k_WINDOW_SIZE - k_MIN_LOOKAHEAD <= d_position) {
+                slideWindow();
+            }
+            fillWindow();
+        }
+
+        if (k_BLOCK_SIZE <= d_position - d_blockStart) {
+            writeBlock(false);
+        }
+
+        int length = 0;
+        int distance;
+
+        if (k_MIN_MATCH <= d_lookahead) {
+            length = longestMatch(insertString(d_position), &distance);
+        }
+
+        if (k_MIN_MATCH <= length) {
+            addMatch(length, distance);
+
+            // Insert the strings starting within the match, and having all
+            // of their 3 bytes available.
+
+            const int end  = d_position + length;
+            const int last = d_position + d_lookahead - k_MIN_MATCH;
+
+            for (int p = d_position + 1; p < end && p <= last; ++p) {
+                insertString(p);
+            }
+
+            d_position  += length;
+            d_lookahead -= length;
+        }
+        else {
+            addLiteral(d_window[d_position]);
+
+            ++d_position;
+            --d_lookahead;
+        }
+    }
+
+    writeBlock(true);
+}
+
+// ACCESSORS
+unsigned int Deflater::checksum() const
+{
+    return d_crc.checksum();
+}
+
+unsigned int Deflater::size() const
+{
+    return d_size;
+}
+
+void Deflater::writeEndOfBlock() const
+{
+    d_writer_p->writeBits(d_literalCodes[k_END_OF_BLOCK],
+                          d_literalLengths[k_END_OF_BLOCK]);
+}
+
+}  // close unnamed namespace
+
+                               // ---------------
+                               // struct GzipUtil
+                               // ---------------
+
+// CLASS METHODS
+int GzipUtil::compress(bsl::streambuf   *output,
+                       bsl::streambuf   *input,
+                       bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(output);
+    BSLS_ASSERT(input);
+
+    BitWriter writer(output);
+    Deflater  deflater(input, &writer, basicAllocator);
+
+    writer.writeBytes(k_GZIP_HEADER, sizeof k_GZIP_HEADER);
+
+    deflater.deflate();
+
+    writer.alignToByte();
+    writer.writeUint32(deflater.checksum());
+    writer.writeUint32(deflater.size());
+    writer.flush();
+
+    if (writer.hasFailed() || -1 == output->pubsync()) {
+        return -1;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
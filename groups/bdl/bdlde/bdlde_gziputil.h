@@ -0,0 +1,128 @@
+// bdlde_gziputil.h                                                   -*-C++-*-
+#ifndef INCLUDED_BDLDE_GZIPUTIL
+#define INCLUDED_BDLDE_GZIPUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide a utility to compress a stream in the gzip format.
+//
+//@CLASSES:
+//  bdlde::GzipUtil: namespace for gzip compression functions
+//
+//@SEE_ALSO: bdlde_crc32
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::GzipUtil', that
+// serves as a namespace for a function, 'compress', reading a stream buffer to
+// its end, and writing the data it reads, compressed, to another stream buffer
+// as a single member of the gzip file format (RFC 1952), that standard tools
+// such as 'gunzip' and 'zcat' can decompress.
+//
+// The data is compressed using the DEFLATE algorithm (RFC 1951): repeated
+// strings are replaced by references to their previous occurrence within a
+// sliding window of 32K bytes, found using hash chains, and the resulting
+// literals and references are encoded using the fixed Huffman codes defined by
+// the format.  No dictionary, nor any decompression function, is provided.
+// The compression achieved is not as good as that of 'gzip' (which builds
+// Huffman codes specific to each block of data), but text having many
+// repeated strings, such as log files, is typically compressed to a small
+// fraction of its original size.  The data is divided into blocks of about 16K
+// bytes, and a block that the fixed Huffman codes would not make smaller is
+// stored as it is instead, so that incompressible data (e.g., data that is
+// already compressed or encrypted) grows by at most 5 bytes per block, in
+// addition to the 18 bytes of the gzip header and trailer.  The memory used by
+// 'compress' is fixed (about 384K bytes), regardless of the amount of data
+// compressed.
+//
+///Thread Safety
+///-------------
+// 'bdlde::GzipUtil::compress' can be called concurrently by multiple threads,
+// provided the stream buffers supplied to each call are distinct.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a String
+///- - - - - - - - - - - - - - - -
+// Suppose we want to compress some repetitive text in memory, e.g., before
+// sending it to a remote host.
+//
+// First, we create an input stream buffer providing the text:
+//..
+//  const char text[] = "The quick brown fox jumps over the lazy dog.  "
+//                      "The quick brown fox jumps over the lazy dog.  "
+//                      "The quick brown fox jumps over the lazy dog.";
+//
+//  bdlsb::FixedMemInStreamBuf input(text, sizeof text - 1);
+//..
+// Then, we compress the text to an output stream buffer:
+//..
+//  bdlsb::MemOutStreamBuf output;
+//
+//  int rc = bdlde::GzipUtil::compress(&output, &input);
+//  assert(0 == rc);
+//..
+// Finally, we observe that the compressed data starts with the gzip magic
+// number, and that, the text repeating itself, it is smaller than the text:
+//..
+//  assert(2 < output.length());
+//  assert('\x1f' == output.data()[0]);
+//  assert('\x8b' == output.data()[1]);
+//
+//  assert(output.length() < sizeof text - 1);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bsl_streambuf.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                               // ===============
+                               // struct GzipUtil
+                               // ===============
+
+struct GzipUtil {
+    // This 'struct' provides a namespace for functions compressing data in
+    // the gzip format.
+
+    // CLASS METHODS
+    static int compress(bsl::streambuf   *output,
+                        bsl::streambuf   *input,
+                        bslma::Allocator *basicAllocator = 0);
+        // Read the specified 'input' stream buffer to its end, and write the
+        // data read, compressed in the gzip format, to the specified 'output'
+        // stream buffer.  Optionally specify a 'basicAllocator' used to supply
+        // (temporary) memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  Return 0 on success, and a
+        // non-zero value if writing to 'output' fails, in which case the data
+        // written to 'output' is not a valid gzip member.  Note that the end
+        // of the data is indicated by 'input' returning fewer characters than
+        // requested by 'sgetn' (i.e., input errors are indistinguishable from
+        // the end of the data).
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,980 @@
+// bdlde_gziputil.t.cpp                                               -*-C++-*-
+#include <bdlde_gziputil.h>
+
+#include <bdlde_crc32.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_fixedmemoutstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a single function compressing the
+// content of a stream buffer in the gzip format.  The output is verified by
+// decompressing it with a minimal decoder implemented in this test driver
+// (supporting the stored and fixed Huffman block types only), that is itself
+// verified on data compressed by 'zlib'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] int compress(streambuf *output, streambuf *input, Allocator *);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: OUTPUT FAILURE IS REPORTED
+// [ 5] CONCERN: REPETITIVE TEXT IS COMPRESSED
+// [ 6] CONCERN: INCOMPRESSIBLE DATA GROWTH IS BOUNDED
+// [ 7] USAGE EXAMPLE
+// [ 2] int gunzip(string *result, const char *data, size_t length);
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::GzipUtil Util;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// Compressed by 'zlib' (with the 'Z_FIXED' strategy) from
+// "hello, hello, hello!\n".
+
+const unsigned char FIXED_GZIP[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcb, 0x48,
+    0xcd, 0xc9, 0xc9, 0xd7, 0x51, 0xc8, 0x40, 0xa2, 0x14, 0xb9, 0x00, 0x63,
+    0xe2, 0x9b, 0x7a, 0x15, 0x00, 0x00, 0x00
+};
+
+// Stored (compression level 0) by 'zlib' from "stored".
+
+const unsigned char STORED_GZIP[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x03, 0x01, 0x06,
+    0x00, 0xf9, 0xff, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x0b, 0xf9, 0x43,
+    0x56, 0x06, 0x00, 0x00, 0x00
+};
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                              // ===============
+                              // class BitReader
+                              // ===============
+
+class BitReader {
+    // This class reads bits, least-significant bit first, from a buffer.
+
+    // DATA
+    const unsigned char *d_data_p;    // data read
+    bsl::size_t          d_length;    // length of 'd_data_p'
+    bsl::size_t          d_offset;    // offset of the next byte to read
+    int                  d_bitIndex;  // index of the next bit in the byte
+    bool                 d_isValid;   // 'false' if read past the end
+
+  public:
+    // CREATORS
+    BitReader(const unsigned char *data, bsl::size_t length)
+        // Create a reader of the specified 'data' having the specified
+        // 'length'.
+    : d_data_p(data)
+    , d_length(length)
+    , d_offset(0)
+    , d_bitIndex(0)
+    , d_isValid(true)
+    {
+    }
+
+    // MANIPULATORS
+    void alignToByte()
+        // Skip the remaining bits of the current byte, if any.
+    {
+        if (d_bitIndex) {
+            d_bitIndex = 0;
+            ++d_offset;
+        }
+    }
+
+    unsigned int readBit()
+        // Read and return one bit.
+    {
+        if (d_offset >= d_length) {
+            d_isValid = false;
+            return 0;                                                 // RETURN
+        }
+
+        unsigned int bit = (d_data_p[d_offset] >> d_bitIndex) & 1;
+
+        if (8 == ++d_bitIndex) {
+            d_bitIndex = 0;
+            ++d_offset;
+        }
+        return bit;
+    }
+
+    unsigned int readBits(int numBits)
+        // Read the specified 'numBits' bits, least-significant bit first, and
+        // return their value.
+    {
+        unsigned int result = 0;
+
+        for (int i = 0; i < numBits; ++i) {
+            result |= readBit() << i;
+        }
+        return result;
+    }
+
+    unsigned int readCode(int numBits)
+        // Read the specified 'numBits' bits of a Huffman code, most
+        // significant bit first, and return their value.
+    {
+        unsigned int result = 0;
+
+        for (int i = 0; i < numBits; ++i) {
+            result = (result << 1) | readBit();
+        }
+        return result;
+    }
+
+    // ACCESSORS
+    bool isValid() const
+        // Return 'true' if no read past the end of the data was attempted.
+    {
+        return d_isValid;
+    }
+
+    bsl::size_t offset() const
+        // Return the offset of the current byte.
+    {
+        return d_offset;
+    }
+};
+
+int decodeLiteral(BitReader *reader)
+    // Read, from the specified 'reader', a literal/length code of the fixed
+    // Huffman code table, and return its value.
+{
+    unsigned int code = reader->readCode(7);
+
+    if (code <= 0x17) {
+        return 256 + code;                                            // RETURN
+    }
+
+    code = (code << 1) | reader->readBit();
+
+    if (0x30 <= code && code <= 0xbf) {
+        return code - 0x30;                                           // RETURN
+    }
+    if (0xc0 <= code && code <= 0xc7) {
+        return 280 + code - 0xc0;                                     // RETURN
+    }
+
+    code = (code << 1) | reader->readBit();
+
+    return 144 + code - 0x190;
+}
+
+unsigned int readUint32(const unsigned char *data)
+    // Return the 32-bit value stored, least-significant byte first, at the
+    // specified 'data'.
+{
+    return static_cast<unsigned int>(data[0])
+         | static_cast<unsigned int>(data[1]) << 8
+         | static_cast<unsigned int>(data[2]) << 16
+         | static_cast<unsigned int>(data[3]) << 24;
+}
+
+int gunzip(bsl::string *result, const char *data, bsl::size_t length)
+    // Load into the specified 'result' the decompressed content of the gzip
+    // member (without optional header fields) of the specified 'length' at
+    // the specified 'data'.  Return 0 on success, and a non-zero value if the
+    // data is not valid, or uses dynamic Huffman codes.
+{
+    static const int LENGTH_BASE[] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51,
+        59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+    static const int LENGTH_EXTRA[] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4,
+        4, 5, 5, 5, 5, 0
+    };
+    static const int DISTANCE_BASE[] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385,
+        513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385,
+        24577
+    };
+    static const int DISTANCE_EXTRA[] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10,
+        10, 11, 11, 12, 12, 13, 13
+    };
+
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+
+    result->clear();
+
+    if (length < 18
+     || 0x1f != bytes[0] || 0x8b != bytes[1] || 8 != bytes[2]
+     || 0    != bytes[3]) {
+        return 1;                                                     // RETURN
+    }
+
+    BitReader reader(bytes + 10, length - 18);
+
+    bool isFinal = false;
+
+    while (!isFinal) {
+        isFinal = reader.readBit();
+
+        const unsigned int type = reader.readBits(2);
+
+        if (0 == type) {
+            reader.alignToByte();
+
+            const unsigned int len  = reader.readBits(16);
+            const unsigned int nlen = reader.readBits(16);
+
+            if ((len ^ 0xffff) != nlen) {
+                return 2;                                             // RETURN
+            }
+            for (unsigned int i = 0; i < len; ++i) {
+                result->push_back(static_cast<char>(reader.readBits(8)));
+            }
+        }
+        else if (1 == type) {
+            for (;;) {
+                const int symbol = decodeLiteral(&reader);
+
+                if (!reader.isValid() || 285 < symbol) {
+                    return 3;                                         // RETURN
+                }
+                if (symbol < 256) {
+                    result->push_back(static_cast<char>(symbol));
+                    continue;
+                }
+                if (256 == symbol) {
+                    break;
+                }
+
+                const int lengthCode = symbol - 257;
+                const int matchLength =
+                              LENGTH_BASE[lengthCode]
+                            + reader.readBits(LENGTH_EXTRA[lengthCode]);
+
+                const unsigned int distanceCode = reader.readCode(5);
+                if (29 < distanceCode) {
+                    return 4;                                         // RETURN
+                }
+
+                const bsl::size_t distance =
+                              DISTANCE_BASE[distanceCode]
+                            + reader.readBits(DISTANCE_EXTRA[distanceCode]);
+
+                if (result->size() < distance) {
+                    return 5;                                         // RETURN
+                }
+
+                for (int i = 0; i < matchLength; ++i) {
+                    result->push_back((*result)[result->size() - distance]);
+                }
+            }
+        }
+        else {
+            return 6;                                                 // RETURN
+        }
+
+        if (!reader.isValid()) {
+            return 7;                                                 // RETURN
+        }
+    }
+
+    reader.alignToByte();
+
+    if (10 + reader.offset() + 8 != length) {
+        return 8;                                                     // RETURN
+    }
+
+    const bdlde::Crc32 crc(result->data(), result->size());
+
+    const unsigned int size = static_cast<unsigned int>(result->size());
+
+    if (readUint32(bytes + length - 8) != crc.checksum()
+     || readUint32(bytes + length - 4) != size) {
+        return 9;                                                     // RETURN
+    }
+
+    return 0;
+}
+
+int compressString(bsl::string *result, const bsl::string& input)
+    // Load into the specified 'result' the specified 'input' compressed by
+    // 'bdlde::GzipUtil::compress'.  Return the value returned by 'compress'.
+{
+    bdlsb::FixedMemInStreamBuf inputBuffer(input.data(), input.size());
+    bdlsb::MemOutStreamBuf     outputBuffer;
+
+    const int rc = Util::compress(&outputBuffer, &inputBuffer);
+
+    result->assign(outputBuffer.data(), outputBuffer.length());
+
+    return rc;
+}
+
+void generateRandom(bsl::string *result, bsl::size_t length, unsigned seed)
+    // Load into the specified 'result' the specified 'length' pseudo-random
+    // bytes generated from the specified 'seed'.
+{
+    result->resize(length);
+
+    for (bsl::size_t i = 0; i < length; ++i) {
+        seed = seed * 1103515245 + 12345;
+        (*result)[i] = static_cast<char>(seed >> 16);
+    }
+}
+
+void generateLogLines(bsl::string *result, int numLines)
+    // Load into the specified 'result' the specified 'numLines' lines of
+    // text resembling a log file.
+{
+    static const char *const CATEGORIES[] = {
+        "SERVER.REQUEST", "SERVER.CACHE", "CLIENT.SESSION", "DB.QUERY"
+    };
+
+    bsl::ostringstream oss;
+
+    for (int i = 0; i < numLines; ++i) {
+        oss << "16OCT2026_12:" << (10 + i / 6000 % 50) << ':'
+            << (10 + i / 100 % 50) << '.' << (100 + i % 900) << ' '
+            << 4242 << ':' << (139652540049216LL + i % 4) << " INFO "
+            << "/home/build/src/server_requesthandler.cpp:" << (100 + i % 37)
+            << ' ' << CATEGORIES[i % 4] << " Processed request " << i
+            << " for user " << (i * 7919 % 1000) << " in " << (i % 97)
+            << "us\n";
+    }
+
+    result->assign(oss.str().data(), oss.str().size());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                             "\n=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Compressing a String
+///- - - - - - - - - - - - - - - -
+// Suppose we want to compress some repetitive text in memory, e.g., before
+// sending it to a remote host.
+//
+// First, we create an input stream buffer providing the text:
+//..
+        const char text[] = "The quick brown fox jumps over the lazy dog.  "
+                            "The quick brown fox jumps over the lazy dog.  "
+                            "The quick brown fox jumps over the lazy dog.";
+
+        bdlsb::FixedMemInStreamBuf input(text, sizeof text - 1);
+//..
+// Then, we compress the text to an output stream buffer:
+//..
+        bdlsb::MemOutStreamBuf output;
+
+        int rc = bdlde::GzipUtil::compress(&output, &input);
+        ASSERT(0 == rc);
+//..
+// Finally, we observe that the compressed data starts with the gzip magic
+// number, and that, the text repeating itself, it is smaller than the text:
+//..
+        ASSERT(2 < output.length());
+        ASSERT('\x1f' == output.data()[0]);
+        ASSERT('\x8b' == output.data()[1]);
+
+        ASSERT(output.length() < sizeof text - 1);
+//..
+
+        bsl::string decompressed;
+        ASSERT(0 == gunzip(&decompressed, output.data(), output.length()));
+        ASSERT(text == decompressed);
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: INCOMPRESSIBLE DATA GROWTH IS BOUNDED
+        //
+        // Concerns:
+        //: 1 Data that the fixed Huffman codes do not make smaller is stored
+        //:   as it is, growing by at most 5 bytes per block of 16K bytes, in
+        //:   addition to the 18 bytes of the gzip header and trailer.
+        //:
+        //: 2 Compressible data following incompressible data (and
+        //:   conversely) is still compressed.
+        //:
+        //: 3 The compressed data decompresses to the original data.
+        //
+        // Plan:
+        //: 1 Compress pseudo-random data of various sizes, and verify that
+        //:   the size of the compressed data does not exceed the size of the
+        //:   data plus 18 bytes plus 5 bytes per block, all blocks but the
+        //:   last (possibly empty) one having at least 16K bytes.  (C-1)
+        //:
+        //: 2 Compress text resembling a log file surrounded by pseudo-random
+        //:   data, and verify that the compressed data is smaller than the
+        //:   pseudo-random data plus a fourth of the text.  (C-2)
+        //:
+        //: 3 Decompress the compressed data, and verify that the result is
+        //:   the original data.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: INCOMPRESSIBLE DATA GROWTH IS BOUNDED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: INCOMPRESSIBLE DATA GROWTH IS BOUNDED"
+                             "\n=============================================="
+                          << endl;
+
+        const bsl::size_t k_BLOCK_SIZE = 16 * 1024;
+
+        static const bsl::size_t SIZES[] = {
+            0, 1, 100, 16383, 16384, 16385, 32768, 65536, 100000, 300000
+        };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const bsl::size_t SIZE = SIZES[ti];
+
+            bsl::string random;
+            generateRandom(&random, SIZE, ti + 1);
+
+            bsl::string compressed;
+            ASSERTV(ti, 0 == compressString(&compressed, random));
+
+            const bsl::size_t maxNumBlocks = SIZE / k_BLOCK_SIZE + 1;
+
+            if (veryVerbose) { P_(SIZE) P(compressed.size()) }
+
+            ASSERTV(SIZE, compressed.size(),
+                    compressed.size() <= SIZE + 18 + 5 * maxNumBlocks);
+
+            bsl::string decompressed;
+            ASSERTV(ti, 0 == gunzip(&decompressed,
+                                    compressed.data(),
+                                    compressed.size()));
+            ASSERTV(ti, random == decompressed);
+        }
+
+        if (verbose) cout << "\nMixed data." << endl;
+        {
+            bsl::string random, text;
+            generateRandom(&random, 100000, 42);
+            generateLogLines(&text, 5000);
+
+            const bsl::string data = random.substr(0, 50000)
+                                   + text
+                                   + random.substr(50000);
+
+            bsl::string compressed;
+            ASSERT(0 == compressString(&compressed, data));
+
+            if (veryVerbose) {
+                P_(data.size()) P_(text.size()) P(compressed.size())
+            }
+
+            ASSERTV(data.size(), text.size(), compressed.size(),
+                    compressed.size() < random.size() + text.size() / 4);
+
+            bsl::string decompressed;
+            ASSERT(0 == gunzip(&decompressed,
+                               compressed.data(),
+                               compressed.size()));
+            ASSERT(data == decompressed);
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCERN: REPETITIVE TEXT IS COMPRESSED
+        //
+        // Concerns:
+        //: 1 Text having many repeated strings, such as a log file, is
+        //:   compressed to a small fraction of its size.
+        //
+        // Plan:
+        //: 1 Compress text resembling a log file, and verify that the
+        //:   compressed data is less than a fourth of the size of the text.
+        //:   (C-1)
+        //
+        // Testing:
+        //   CONCERN: REPETITIVE TEXT IS COMPRESSED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: REPETITIVE TEXT IS COMPRESSED"
+                             "\n======================================"
+                          << endl;
+
+        bsl::string text;
+        generateLogLines(&text, 20000);
+
+        bsl::string compressed;
+        ASSERT(0 == compressString(&compressed, text));
+
+        if (veryVerbose) { P_(text.size()) P(compressed.size()) }
+
+        ASSERTV(text.size(), compressed.size(),
+                compressed.size() < text.size() / 4);
+
+        bsl::string decompressed;
+        ASSERT(0 == gunzip(&decompressed,
+                           compressed.data(),
+                           compressed.size()));
+        ASSERT(text == decompressed);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: OUTPUT FAILURE IS REPORTED
+        //
+        // Concerns:
+        //: 1 'compress' returns a non-zero value if the output stream buffer
+        //:   fails to accept all of the compressed data, whether the failure
+        //:   occurs while writing the header, the data, or the trailer.
+        //
+        // Plan:
+        //: 1 Compress data to a fixed-size output buffer of each size smaller
+        //:   than the size of the compressed data, and verify that 'compress'
+        //:   fails; then compress it to a buffer of the exact size, and
+        //:   verify that 'compress' succeeds.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: OUTPUT FAILURE IS REPORTED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: OUTPUT FAILURE IS REPORTED"
+                             "\n===================================" << endl;
+
+        bsl::string text;
+        generateLogLines(&text, 10);
+
+        bsl::string compressed;
+        ASSERT(0 == compressString(&compressed, text));
+
+        const bsl::size_t SIZE = compressed.size();
+
+        bsl::string buffer(SIZE, '\0');
+
+        for (bsl::size_t size = 0; size <= SIZE; ++size) {
+            bdlsb::FixedMemInStreamBuf  input(text.data(), text.size());
+            bdlsb::FixedMemOutStreamBuf output(&buffer[0], size);
+
+            const int rc = Util::compress(&output, &input);
+
+            if (veryVeryVerbose) { T_ P_(size) P(rc) }
+
+            ASSERTV(size, (SIZE == size) == (0 == rc));
+        }
+
+        ASSERT(compressed == buffer);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'compress'
+        //
+        // Concerns:
+        //: 1 The output is a valid gzip member, without optional header
+        //:   fields, that decompresses to the input.
+        //:
+        //: 2 The trailer holds the CRC-32 checksum and the size of the input.
+        //:
+        //: 3 Empty input, single bytes, all byte values, runs longer than the
+        //:   longest match, incompressible data, and data longer than the
+        //:   window (requiring the window to be moved, possibly more than
+        //:   once) are supported.
+        //:
+        //: 4 The input is read to its end, even if the stream buffer returns
+        //:   fewer characters than requested only at the end.
+        //:
+        //: 5 All memory is supplied by the specified allocator, or the
+        //:   default allocator if none is specified, and is released.
+        //
+        // Plan:
+        //: 1 Compress a set of inputs exhibiting the properties listed in C-3,
+        //:   decompress the output with the 'gunzip' test function (which
+        //:   verifies the trailer), and compare with the input.  (C-1..4)
+        //:
+        //: 2 Verify allocator usage with test allocators.  (C-5)
+        //
+        // Testing:
+        //   int compress(streambuf *output, streambuf *input, Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'compress'"
+                             "\n==================" << endl;
+
+        bsl::vector<bsl::string> inputs;
+
+        inputs.push_back("");
+        inputs.push_back("a");
+        inputs.push_back("ab");
+        inputs.push_back("abc");
+        inputs.push_back("abcabc");
+        inputs.push_back("abcabcabcabcabcabcabcabcabcabcabcabcabcabc");
+        inputs.push_back(bsl::string(1000, 'x'));
+        inputs.push_back(bsl::string(100000, '\0'));
+        {
+            bsl::string allBytes;
+            for (int i = 0; i < 256; ++i) {
+                allBytes.push_back(static_cast<char>(i));
+            }
+            inputs.push_back(allBytes);
+            inputs.push_back(allBytes + allBytes + allBytes);
+        }
+        {
+            bsl::string random;
+
+            generateRandom(&random, 1000, 1);
+            inputs.push_back(random);
+
+            generateRandom(&random, 65536, 2);
+            inputs.push_back(random);
+
+            generateRandom(&random, 300000, 3);
+            inputs.push_back(random);
+        }
+        {
+            bsl::string text;
+
+            generateLogLines(&text, 5000);
+            inputs.push_back(text);
+        }
+        {
+            // Repeated strings at distances close to the window size.
+
+            bsl::string random;
+            generateRandom(&random, 32768 - 3, 4);
+
+            inputs.push_back(random + random + random);
+
+            generateRandom(&random, 32768, 5);
+
+            inputs.push_back(random + random.substr(0, 100) + random);
+        }
+
+        for (bsl::size_t ti = 0; ti < inputs.size(); ++ti) {
+            const bsl::string& INPUT = inputs[ti];
+
+            if (veryVerbose) { T_ P_(ti) P(INPUT.size()) }
+
+            bslma::TestAllocator ta("temporary", veryVeryVeryVerbose);
+            bslma::TestAllocator oa("output",    veryVeryVeryVerbose);
+
+            bdlsb::FixedMemInStreamBuf input(INPUT.data(), INPUT.size());
+            bdlsb::MemOutStreamBuf     output(&oa);
+
+            const bsls::Types::Int64 numDefault =
+                                           defaultAllocator.numAllocations();
+
+            ASSERTV(ti, 0 == Util::compress(&output, &input, &ta));
+
+            ASSERTV(ti, 0 < ta.numAllocations());
+            ASSERTV(ti, 0 == ta.numBlocksInUse());
+            ASSERTV(ti, numDefault == defaultAllocator.numAllocations());
+
+            bsl::string decompressed;
+            ASSERTV(ti, 0 == gunzip(&decompressed,
+                                    output.data(),
+                                    output.length()));
+            ASSERTV(ti, INPUT == decompressed);
+
+            if (veryVerbose) { T_ T_ P(output.length()) }
+        }
+
+        if (verbose) cout << "\tDefault allocator." << endl;
+        {
+            bslma::TestAllocator oa("output", veryVeryVeryVerbose);
+
+            bdlsb::FixedMemInStreamBuf input("abc", 3);
+            bdlsb::MemOutStreamBuf     output(&oa);
+
+            const bsls::Types::Int64 numDefault =
+                                           defaultAllocator.numAllocations();
+
+            ASSERT(0 == Util::compress(&output, &input));
+            ASSERT(numDefault < defaultAllocator.numAllocations());
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bdlsb::FixedMemInStreamBuf input("abc", 3);
+            bdlsb::MemOutStreamBuf     output;
+
+            ASSERT_FAIL(Util::compress(0, &input));
+            ASSERT_FAIL(Util::compress(&output, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'gunzip'
+        //
+        // Concerns:
+        //: 1 The 'gunzip' test function decompresses the stored and fixed
+        //:   Huffman block types.
+        //:
+        //: 2 'gunzip' rejects data having an invalid header or trailer.
+        //
+        // Plan:
+        //: 1 Decompress data compressed by 'zlib'.  (C-1)
+        //:
+        //: 2 Corrupt a byte of the header and of the trailer of that data, and
+        //:   truncate it.  (C-2)
+        //
+        // Testing:
+        //   int gunzip(string *result, const char *data, size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'gunzip'"
+                             "\n================" << endl;
+
+        const char *fixed  = reinterpret_cast<const char *>(FIXED_GZIP);
+        const char *stored = reinterpret_cast<const char *>(STORED_GZIP);
+
+        bsl::string result;
+
+        ASSERT(0 == gunzip(&result, fixed, sizeof FIXED_GZIP));
+        ASSERTV(result, "hello, hello, hello!\n" == result);
+
+        ASSERT(0 == gunzip(&result, stored, sizeof STORED_GZIP));
+        ASSERTV(result, "stored" == result);
+
+        ASSERT(0 != gunzip(&result, fixed, sizeof FIXED_GZIP - 1));
+        ASSERT(0 != gunzip(&result, fixed, 10));
+
+        bsl::string corrupted(fixed, sizeof FIXED_GZIP);
+
+        corrupted[0] = 0x1e;
+        ASSERT(0 != gunzip(&result, corrupted.data(), corrupted.size()));
+
+        corrupted.assign(fixed, sizeof FIXED_GZIP);
+        corrupted[sizeof FIXED_GZIP - 5] ^= 1;
+        ASSERT(0 != gunzip(&result, corrupted.data(), corrupted.size()));
+
+        corrupted.assign(fixed, sizeof FIXED_GZIP);
+        corrupted[sizeof FIXED_GZIP - 1] ^= 1;
+        ASSERT(0 != gunzip(&result, corrupted.data(), corrupted.size()));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Compress a short string, and verify the header of the output.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                             "\n==============" << endl;
+
+        bsl::string compressed;
+        ASSERT(0 == compressString(&compressed, "hello, hello, hello!\n"));
+
+        ASSERT(18 < compressed.size());
+        ASSERT('\x1f' == compressed[0]);
+        ASSERT('\x8b' == compressed[1]);
+        ASSERT('\x08' == compressed[2]);
+        ASSERT('\x00' == compressed[3]);
+
+        bsl::string decompressed;
+        ASSERT(0 == gunzip(&decompressed,
+                           compressed.data(),
+                           compressed.size()));
+        ASSERT("hello, hello, hello!\n" == decompressed);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of 'compress' on text resembling a log
+        //:   file.
+        //
+        // Plan:
+        //: 1 Compress 64MB of such text, and report the time taken and the
+        //:   compression ratio.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                             "\n================" << endl;
+
+        bsl::string text;
+        generateLogLines(&text, 500000);
+
+        bsl::string data;
+        while (data.size() < 64 * 1024 * 1024) {
+            data += text;
+        }
+
+        bdlsb::FixedMemInStreamBuf input(data.data(), data.size());
+        bdlsb::MemOutStreamBuf     output;
+
+        bsls::Stopwatch timer;
+        timer.start();
+
+        ASSERT(0 == Util::compress(&output, &input));
+
+        timer.stop();
+
+        cout << "Compressed " << data.size() << " bytes to "
+             << output.length() << " bytes in " << timer.elapsedTime()
+             << "s (" << data.size() / timer.elapsedTime() / 1e6
+             << "MB/s)." << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
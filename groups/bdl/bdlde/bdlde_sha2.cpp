@@ -1,10 +1,29 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_sha2_cpp,"$Id$ $CSID$")
+
+#include <bslmt_once.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_ostream.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -153,6 +172,18 @@ const bsl::uint32_t sha256Constants[64] =
              0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
              0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
 
+// Second 32 bits of the fractional parts of the square root of the 9th through
+// 16th primes.
+const bsl::uint32_t sha224InitialState[8] =
+            {0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+             0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4};
+
+// First 32 bits of the fractional part of the square root of the first 8
+// primes.
+const bsl::uint32_t sha256InitialState[8] =
+            {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
 // First 64 bits of fractional part of the cube roots of the first 80 primes.
 const bsl::uint64_t sha512Constants[80] =
             {0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL,
@@ -197,11 +228,11 @@ const bsl::uint64_t sha512Constants[80] =
              0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
 
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
-void transform(INTEGER             *state,
-               const unsigned char *message,
-               bsl::uint64_t        numberOfBuffers,
-               bsl::uint64_t        bufferSize,
-               const INTEGER      (&constants)[ARRAY_SIZE])
+void transformPortable(INTEGER             *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numberOfBuffers,
+                       bsl::uint64_t        bufferSize,
+                       const INTEGER      (&constants)[ARRAY_SIZE])
     // Update the specified 'state' with the hashed contents of the specified
     // 'message' having a length equal to the specified 'bufferSize' times the
     // specified 'numberOfBuffers', mixing it with the values in the specified
@@ -247,6 +278,524 @@ void transform(INTEGER             *state,
     }
 }
 
+#if defined(LIKE_X86_GCC)
+
+bool hasShaNi()
+    // Return 'true' if the CPU on which this process is running supports the
+    // SHA extensions along with the SSSE3 and SSE4.1 instruction sets, and
+    // 'false' otherwise.
+{
+    static bool result = false;
+
+    BSLMT_ONCE_DO {
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+        __builtin_cpu_init();
+        result = __builtin_cpu_supports("ssse3")
+              && __builtin_cpu_supports("sse4.1")
+              && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)
+              && (ebx & (1u << 29));
+    }
+
+    return result;
+}
+
+bool hasAvx2()
+    // Return 'true' if the CPU on which this process is running supports the
+    // AVX2 instruction set, and 'false' otherwise.
+{
+    static bool result = false;
+
+    BSLMT_ONCE_DO {
+        __builtin_cpu_init();
+        result = __builtin_cpu_supports("avx2");
+    }
+
+    return result;
+}
+
+__attribute__((target("sha,ssse3,sse4.1")))
+inline
+__m128i scheduleShaNi(__m128i w0, __m128i w1, __m128i w2, __m128i w3)
+    // Return the next four message schedule words following the sixteen
+    // words in the specified 'w0', 'w1', 'w2', and 'w3' (oldest first).
+{
+    const __m128i t = _mm_add_epi32(_mm_sha256msg1_epu32(w0, w1),
+                                    _mm_alignr_epi8(w3, w2, 4));
+    return _mm_sha256msg2_epu32(t, w3);
+}
+
+__attribute__((target("sha,ssse3,sse4.1")))
+inline
+void roundsShaNi(__m128i             *abef,
+                 __m128i             *cdgh,
+                 __m128i              w,
+                 const bsl::uint32_t *constants)
+    // Apply four SHA-256 rounds, using the four message schedule words in the
+    // specified 'w' and the four round constants starting at the specified
+    // 'constants', to the working variables held in the specified 'abef' and
+    // 'cdgh'.
+{
+    const __m128i k = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(constants));
+
+    __m128i wk = _mm_add_epi32(w, k);
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, wk);
+    wk    = _mm_shuffle_epi32(wk, 0x0e);
+    *abef = _mm_sha256rnds2_epu32(*abef, *cdgh, wk);
+}
+
+__attribute__((target("sha,ssse3,sse4.1")))
+void transformShaNi(bsl::uint32_t       *state,
+                    const unsigned char *message,
+                    bsl::uint64_t        numberOfBuffers)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length of 64 times the specified 'numberOfBuffers'
+    // bytes using the SHA extensions of the CPU.
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                            0x0405060700010203ULL);
+
+    // The SHA-256 round instructions operate on the working variables
+    // arranged as '{A, B, E, F}' and '{C, D, G, H}'.
+
+    __m128i abcd = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state));
+    __m128i efgh = _mm_loadu_si128(
+                              reinterpret_cast<const __m128i *>(state + 4));
+
+    abcd = _mm_shuffle_epi32(abcd, 0xb1);                         // CDAB
+    efgh = _mm_shuffle_epi32(efgh, 0x1b);                         // EFGH
+    __m128i abef = _mm_alignr_epi8(abcd, efgh, 8);                // ABEF
+    __m128i cdgh = _mm_blend_epi16(efgh, abcd, 0xf0);             // CDGH
+
+    const unsigned char *messageEnd = message + 64 * numberOfBuffers;
+    for (; message != messageEnd; message += 64) {
+        const __m128i abefSaved = abef;
+        const __m128i cdghSaved = cdgh;
+
+        const __m128i *input = reinterpret_cast<const __m128i *>(message);
+
+        __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128(input + 0), byteSwap);
+        __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128(input + 1), byteSwap);
+        __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128(input + 2), byteSwap);
+        __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128(input + 3), byteSwap);
+
+        roundsShaNi(&abef, &cdgh, w0, sha256Constants +  0);
+        roundsShaNi(&abef, &cdgh, w1, sha256Constants +  4);
+        roundsShaNi(&abef, &cdgh, w2, sha256Constants +  8);
+        roundsShaNi(&abef, &cdgh, w3, sha256Constants + 12);
+
+        for (int index = 16; index != 64; index += 16) {
+            w0 = scheduleShaNi(w0, w1, w2, w3);
+            roundsShaNi(&abef, &cdgh, w0, sha256Constants + index +  0);
+            w1 = scheduleShaNi(w1, w2, w3, w0);
+            roundsShaNi(&abef, &cdgh, w1, sha256Constants + index +  4);
+            w2 = scheduleShaNi(w2, w3, w0, w1);
+            roundsShaNi(&abef, &cdgh, w2, sha256Constants + index +  8);
+            w3 = scheduleShaNi(w3, w0, w1, w2);
+            roundsShaNi(&abef, &cdgh, w3, sha256Constants + index + 12);
+        }
+
+        abef = _mm_add_epi32(abef, abefSaved);
+        cdgh = _mm_add_epi32(cdgh, cdghSaved);
+    }
+
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1b);           // FEBA
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);           // DCHG
+    abcd = _mm_blend_epi16(feba, dchg, 0xf0);                     // DCBA
+    efgh = _mm_alignr_epi8(dchg, feba, 8);                        // HGFE
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),     abcd);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4), efgh);
+}
+
+#endif  // LIKE_X86_GCC
+
+template<class INTEGER, bsl::size_t ARRAY_SIZE>
+void transform(INTEGER             *state,
+               const unsigned char *message,
+               bsl::uint64_t        numberOfBuffers,
+               bsl::uint64_t        bufferSize,
+               const INTEGER      (&constants)[ARRAY_SIZE])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' times the
+    // specified 'numberOfBuffers', mixing it with the values in the specified
+    // 'constants'.  This overload is used for SHA-384 and SHA-512.
+{
+    transformPortable(state, message, numberOfBuffers, bufferSize, constants);
+}
+
+void transform(bsl::uint32_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint32_t (&constants)[64])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' times the
+    // specified 'numberOfBuffers', mixing it with the values in the specified
+    // 'constants', using the SHA extensions of the CPU if they are supported.
+    // This overload is used for SHA-224 and SHA-256.  The behavior is
+    // undefined unless 'bufferSize' is 64 and 'constants' is
+    // 'sha256Constants'.
+{
+#if defined(LIKE_X86_GCC)
+    if (hasShaNi()) {
+        transformShaNi(state, message, numberOfBuffers);
+        return;                                                       // RETURN
+    }
+#endif
+
+    transformPortable(state, message, numberOfBuffers, bufferSize, constants);
+}
+
+                        // ------------------------
+                        // SHA-256 multi-buffer API
+                        // ------------------------
+
+struct Sha256Lane {
+    // This 'struct' describes the progress made hashing one message of a
+    // batch of messages being hashed with SHA-224 or SHA-256.
+
+    const unsigned char *d_message_p;  // message being hashed
+    bsl::uint64_t        d_length;     // length of 'd_message_p'
+    bsl::uint64_t        d_numBlocks;  // number of blocks in padded message
+    bsl::uint64_t        d_block;      // index of the next block to hash
+    unsigned char       *d_result_p;   // where to store the digest
+};
+
+void startLane(Sha256Lane        *lane,
+               const void        *message,
+               bsl::size_t        length,
+               unsigned char     *result)
+    // Load into the specified 'lane' the initial progress of hashing the
+    // specified 'message' having the specified 'length', whose digest is to
+    // be stored at the specified 'result'.
+{
+    lane->d_message_p = static_cast<const unsigned char *>(message);
+    lane->d_length    = length;
+    lane->d_numBlocks = (lane->d_length + 8) / 64 + 1;
+    lane->d_block     = 0;
+    lane->d_result_p  = result;
+}
+
+const unsigned char *loadBlock(unsigned char     (&scratch)[64],
+                               const Sha256Lane&   lane)
+    // Return the address of the next 64-byte block of the padded message
+    // described by the specified 'lane', using the specified 'scratch' to
+    // hold that block if it is not entirely contained in the message.  The
+    // behavior is undefined unless 'lane.d_block < lane.d_numBlocks'.
+{
+    const bsl::uint64_t offset = lane.d_block * 64;
+    if (offset + 64 <= lane.d_length) {
+        return lane.d_message_p + offset;                             // RETURN
+    }
+
+    bsl::fill(scratch, scratch + 64, static_cast<unsigned char>(0));
+    if (offset <= lane.d_length) {
+        bsl::copy(lane.d_message_p + offset,
+                  lane.d_message_p + lane.d_length,
+                  scratch);
+        scratch[lane.d_length - offset] = 1 << 7;
+    }
+    if (lane.d_block + 1 == lane.d_numBlocks) {
+        unpack(lane.d_length * 8, scratch + 64 - sizeof(bsl::uint64_t));
+    }
+    return scratch;
+}
+
+void finishLane(Sha256Lane    *lane,
+                bsl::uint32_t *state,
+                bsl::size_t    digestSize)
+    // Hash the remaining blocks of the message described by the specified
+    // 'lane' into the specified 'state', and store the first specified
+    // 'digestSize' bytes of the resulting digest in the result of 'lane'.
+{
+    const bsl::uint64_t numFullBlocks = lane->d_length / 64;
+    if (lane->d_block < numFullBlocks) {
+        transform(state,
+                  lane->d_message_p + lane->d_block * 64,
+                  numFullBlocks - lane->d_block,
+                  64,
+                  sha256Constants);
+        lane->d_block = numFullBlocks;
+    }
+
+    unsigned char scratch[64];
+    for (; lane->d_block != lane->d_numBlocks; ++lane->d_block) {
+        transform(state, loadBlock(scratch, *lane), 1, 64, sha256Constants);
+    }
+
+    for (bsl::size_t index = 0; index != digestSize / 4; ++index) {
+        unpack(state[index], lane->d_result_p + index * 4);
+    }
+}
+
+#if defined(LIKE_X86_GCC)
+
+__attribute__((target("avx2")))
+inline
+__m256i rotateRight8(__m256i value, int shift)
+    // Return the specified 'value' with each of its 32-bit lanes rotated
+    // right by the specified 'shift' bits.
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+__attribute__((target("avx2")))
+inline
+void transpose8(__m256i *rows)
+    // Transpose the 8x8 matrix of 32-bit words held in the specified 'rows',
+    // so that word 'j' of 'rows[i]' becomes word 'i' of 'rows[j]'.
+{
+    const __m256i t0 = _mm256_unpacklo_epi32(rows[0], rows[1]);
+    const __m256i t1 = _mm256_unpackhi_epi32(rows[0], rows[1]);
+    const __m256i t2 = _mm256_unpacklo_epi32(rows[2], rows[3]);
+    const __m256i t3 = _mm256_unpackhi_epi32(rows[2], rows[3]);
+    const __m256i t4 = _mm256_unpacklo_epi32(rows[4], rows[5]);
+    const __m256i t5 = _mm256_unpackhi_epi32(rows[4], rows[5]);
+    const __m256i t6 = _mm256_unpacklo_epi32(rows[6], rows[7]);
+    const __m256i t7 = _mm256_unpackhi_epi32(rows[6], rows[7]);
+
+    const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    rows[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    rows[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    rows[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    rows[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    rows[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    rows[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    rows[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    rows[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+__attribute__((target("avx2")))
+void transformAvx2(bsl::uint32_t              (*state)[8],
+                   const unsigned char *const  *blocks)
+    // Update each of the 8 SHA-256 states held in the specified 'state',
+    // where 'state[i][j]' is word 'i' of the state of lane 'j', with the
+    // hashed contents of the corresponding 64-byte block in the specified
+    // 'blocks', hashing all 8 lanes at once using AVX2 instructions.
+{
+    const __m256i byteSwap = _mm256_set_epi8(12, 13, 14, 15,  8,  9, 10, 11,
+                                              4,  5,  6,  7,  0,  1,  2,  3,
+                                             12, 13, 14, 15,  8,  9, 10, 11,
+                                              4,  5,  6,  7,  0,  1,  2,  3);
+
+    __m256i w[16];
+    for (int half = 0; half != 2; ++half) {
+        for (int lane = 0; lane != 8; ++lane) {
+            w[half * 8 + lane] = _mm256_shuffle_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                                   blocks[lane] + half * 32)),
+                    byteSwap);
+        }
+        transpose8(w + half * 8);
+    }
+
+    __m256i wv[8];
+    for (int index = 0; index != 8; ++index) {
+        const __m256i *word = reinterpret_cast<const __m256i *>(state[index]);
+        wv[index] = _mm256_loadu_si256(word);
+    }
+
+    __m256i a = wv[0], b = wv[1], c = wv[2], d = wv[3];
+    __m256i e = wv[4], f = wv[5], g = wv[6], h = wv[7];
+
+    for (int index = 0; index != 64; ++index) {
+        __m256i& wt = w[index & 15];
+        if (index >= 16) {
+            const __m256i w2  = w[(index -  2) & 15];
+            const __m256i w15 = w[(index - 15) & 15];
+
+            const __m256i s0 = _mm256_xor_si256(
+                                 _mm256_xor_si256(rotateRight8(w15,  7),
+                                                  rotateRight8(w15, 18)),
+                                 _mm256_srli_epi32(w15, 3));
+            const __m256i s1 = _mm256_xor_si256(
+                                 _mm256_xor_si256(rotateRight8(w2, 17),
+                                                  rotateRight8(w2, 19)),
+                                 _mm256_srli_epi32(w2, 10));
+
+            wt = _mm256_add_epi32(_mm256_add_epi32(wt, s0),
+                                  _mm256_add_epi32(w[(index - 7) & 15], s1));
+        }
+
+        const __m256i sum1 = _mm256_xor_si256(
+                                      _mm256_xor_si256(rotateRight8(e,  6),
+                                                       rotateRight8(e, 11)),
+                                      rotateRight8(e, 25));
+        const __m256i ch   = _mm256_xor_si256(
+                             _mm256_and_si256(_mm256_xor_si256(f, g), e), g);
+        const __m256i t1   = _mm256_add_epi32(
+                    _mm256_add_epi32(_mm256_add_epi32(h, sum1),
+                                     _mm256_add_epi32(ch, wt)),
+                    _mm256_set1_epi32(static_cast<int>(
+                                                   sha256Constants[index])));
+
+        const __m256i sum0 = _mm256_xor_si256(
+                                      _mm256_xor_si256(rotateRight8(a,  2),
+                                                       rotateRight8(a, 13)),
+                                      rotateRight8(a, 22));
+        const __m256i maj  = _mm256_or_si256(
+                             _mm256_and_si256(a, b),
+                             _mm256_and_si256(_mm256_or_si256(a, b), c));
+        const __m256i t2   = _mm256_add_epi32(sum0, maj);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, t2);
+    }
+
+    wv[0] = _mm256_add_epi32(wv[0], a);
+    wv[1] = _mm256_add_epi32(wv[1], b);
+    wv[2] = _mm256_add_epi32(wv[2], c);
+    wv[3] = _mm256_add_epi32(wv[3], d);
+    wv[4] = _mm256_add_epi32(wv[4], e);
+    wv[5] = _mm256_add_epi32(wv[5], f);
+    wv[6] = _mm256_add_epi32(wv[6], g);
+    wv[7] = _mm256_add_epi32(wv[7], h);
+
+    for (int index = 0; index != 8; ++index) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[index]),
+                            wv[index]);
+    }
+}
+
+void hashBatchAvx2(unsigned char        *results,
+                   bsl::size_t           digestSize,
+                   const bsl::uint32_t  *initialState,
+                   const void *const    *messages,
+                   const bsl::size_t    *lengths,
+                   bsl::size_t           numMessages)
+    // Load into the specified 'results' the first specified 'digestSize'
+    // bytes of the digests, computed from the specified 'initialState', of
+    // each of the specified 'numMessages' 'messages' having the specified
+    // 'lengths', hashing 8 messages at once using AVX2 instructions.  As soon
+    // as a message is complete its lane is refilled with the next message;
+    // once no messages remain to refill a lane, the messages still in
+    // progress are completed one at a time.  The behavior is undefined unless
+    // '8 <= numMessages'.
+{
+    Sha256Lane    lanes[8];
+    bsl::uint32_t state[8][8];
+    unsigned char scratch[8][64];
+
+    bsl::size_t next = 0;
+    for (int lane = 0; lane != 8; ++lane, ++next) {
+        startLane(&lanes[lane],
+                  messages[next],
+                  lengths[next],
+                  results + next * digestSize);
+        for (int word = 0; word != 8; ++word) {
+            state[word][lane] = initialState[word];
+        }
+    }
+
+    bool active[8] = { true, true, true, true, true, true, true, true };
+    bool drained   = false;
+    while (!drained) {
+        const unsigned char *blocks[8];
+        for (int lane = 0; lane != 8; ++lane) {
+            blocks[lane] = loadBlock(scratch[lane], lanes[lane]);
+            ++lanes[lane].d_block;
+        }
+
+        transformAvx2(state, blocks);
+
+        for (int lane = 0; lane != 8; ++lane) {
+            Sha256Lane& current = lanes[lane];
+            if (current.d_block != current.d_numBlocks) {
+                continue;                                           // CONTINUE
+            }
+
+            for (bsl::size_t word = 0; word != digestSize / 4; ++word) {
+                unpack(state[word][lane], current.d_result_p + word * 4);
+            }
+
+            if (next == numMessages) {
+                active[lane] = false;
+                drained      = true;
+                continue;                                           // CONTINUE
+            }
+
+            startLane(&current,
+                      messages[next],
+                      lengths[next],
+                      results + next * digestSize);
+            ++next;
+            for (int word = 0; word != 8; ++word) {
+                state[word][lane] = initialState[word];
+            }
+        }
+    }
+
+    for (int lane = 0; lane != 8; ++lane) {
+        if (active[lane]) {
+            bsl::uint32_t laneState[8];
+            for (int word = 0; word != 8; ++word) {
+                laneState[word] = state[word][lane];
+            }
+            finishLane(&lanes[lane], laneState, digestSize);
+        }
+    }
+}
+
+#endif  // LIKE_X86_GCC
+
+void hashBatch(unsigned char        *results,
+               bsl::size_t           digestSize,
+               const bsl::uint32_t (&initialState)[8],
+               const void *const    *messages,
+               const bsl::size_t    *lengths,
+               bsl::size_t           numMessages)
+    // Load into the specified 'results' the first specified 'digestSize'
+    // bytes of the digests, computed from the specified 'initialState', of
+    // each of the specified 'numMessages' 'messages' having the specified
+    // 'lengths', storing the digest of 'messages[i]' at
+    // 'results + i * digestSize'.
+{
+#if defined(LIKE_X86_GCC)
+    // A single message hashed with the SHA extensions is faster than 8
+    // messages hashed in parallel with AVX2, so the latter is used only when
+    // the former is not available.
+
+    if (8 <= numMessages && !hasShaNi() && hasAvx2()) {
+        hashBatchAvx2(results,
+                      digestSize,
+                      initialState,
+                      messages,
+                      lengths,
+                      numMessages);
+        return;                                                       // RETURN
+    }
+#endif
+
+    for (bsl::size_t index = 0; index != numMessages; ++index) {
+        Sha256Lane    lane;
+        bsl::uint32_t state[8];
+
+        startLane(&lane,
+                  messages[index],
+                  lengths[index],
+                  results + index * digestSize);
+        bsl::copy(initialState, initialState + 8, state);
+        finishLane(&lane, state, digestSize);
+    }
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -346,6 +895,91 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+// CLASS METHODS
+void Sha224::loadDigests(unsigned char      *results,
+                         const void *const  *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+    hashBatch(results,
+              k_DIGEST_SIZE,
+              sha224InitialState,
+              messages,
+              lengths,
+              numMessages);
+}
+
+void Sha256::loadDigests(unsigned char      *results,
+                         const void *const  *messages,
+                         const bsl::size_t  *lengths,
+                         bsl::size_t         numMessages)
+{
+    hashBatch(results,
+              k_DIGEST_SIZE,
+              sha256InitialState,
+              messages,
+              lengths,
+              numMessages);
+}
+
+                               // ---------------
+                               // struct Sha2_Imp
+                               // ---------------
+
+// CLASS METHODS
+bool Sha2_Imp::loadSha224DigestsAvx2(unsigned char      *results,
+                                     const void *const  *messages,
+                                     const bsl::size_t  *lengths,
+                                     bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(8 <= numMessages);
+
+#if defined(LIKE_X86_GCC)
+    if (hasAvx2()) {
+        hashBatchAvx2(results,
+                      Sha224::k_DIGEST_SIZE,
+                      sha224InitialState,
+                      messages,
+                      lengths,
+                      numMessages);
+        return true;                                                  // RETURN
+    }
+#else
+    (void)results;
+    (void)messages;
+    (void)lengths;
+#endif
+
+    return false;
+}
+
+bool Sha2_Imp::loadSha256DigestsAvx2(unsigned char      *results,
+                                     const void *const  *messages,
+                                     const bsl::size_t  *lengths,
+                                     bsl::size_t         numMessages)
+{
+    BSLS_ASSERT(8 <= numMessages);
+
+#if defined(LIKE_X86_GCC)
+    if (hasAvx2()) {
+        hashBatchAvx2(results,
+                      Sha256::k_DIGEST_SIZE,
+                      sha256InitialState,
+                      messages,
+                      lengths,
+                      numMessages);
+        return true;                                                  // RETURN
+    }
+#else
+    (void)results;
+    (void)messages;
+    (void)lengths;
+#endif
+
+    return false;
+}
+
+// CREATORS
 Sha224::Sha224()
 {
     reset();
@@ -394,32 +1028,14 @@ void Sha224::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // Second 32 bits of the fractional parts of the square root of the 9th
-    // through 16th primes.
-    d_state[0] = 0xc1059ed8;
-    d_state[1] = 0x367cd507;
-    d_state[2] = 0x3070dd17;
-    d_state[3] = 0xf70e5939;
-    d_state[4] = 0xffc00b31;
-    d_state[5] = 0x68581511;
-    d_state[6] = 0x64f98fa7;
-    d_state[7] = 0xbefa4fa4;
+    bsl::copy(sha224InitialState, sha224InitialState + 8, d_state);
 }
 
 void Sha256::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 32 bits of the fractional part of the square root of the first 8
-    // primes.
-    d_state[0] = 0x6a09e667;
-    d_state[1] = 0xbb67ae85;
-    d_state[2] = 0x3c6ef372;
-    d_state[3] = 0xa54ff53a;
-    d_state[4] = 0x510e527f;
-    d_state[5] = 0x9b05688c;
-    d_state[6] = 0x1f83d9ab;
-    d_state[7] = 0x5be0cd19;
+    bsl::copy(sha256InitialState, sha256InitialState + 8, d_state);
 }
 
 void Sha384::reset()
@@ -12,6 +12,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //  bdlde::Sha256: value-semantic type representing a SHA-256 digest
 //  bdlde::Sha384: value-semantic type representing a SHA-384 digest
 //  bdlde::Sha512: value-semantic type representing a SHA-512 digest
+//  bdlde::Sha2_Imp: alternative implementations for testing (private)
 //
 //@SEE_ALSO: bdlde_md5
 //
@@ -25,6 +26,29 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+///Hardware Acceleration
+///---------------------
+// On x86 platforms, 'Sha224' and 'Sha256' detect at runtime whether the CPU
+// supports the SHA extensions, and if so use them to hash each 64-byte block
+// of a message.  Otherwise, and for 'Sha384' and 'Sha512', a portable
+// implementation is used.  The digests produced are identical in either case.
+//
+///Hashing Many Messages
+///---------------------
+// The class method 'loadDigests' of 'Sha224' and 'Sha256' computes the
+// digests of a batch of independent messages, such as the keys of a table or
+// the records of a file, in a single call.  When the CPU lacks the SHA
+// extensions but supports AVX2, the messages are hashed eight at a time, one
+// in each 32-bit lane of a vector register, which is several times faster
+// than hashing them one by one.  Batches of fewer than eight messages are
+// hashed one at a time.
+//
+// This component also defines the component-private 'struct'
+// 'bdlde::Sha2_Imp', which exposes the AVX2 multi-buffer implementation
+// directly, so that it can be tested and benchmarked on CPUs having the SHA
+// extensions (on which 'loadDigests' never selects it).  It should not be
+// used other than to test and benchmark this component.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.  The
@@ -121,6 +145,25 @@ class Sha224 {
     static const bsl::size_t k_DIGEST_SIZE = 224 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void *const  *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-224 digests of each of the
+        // specified 'numMessages' 'messages', where 'messages[i]' has a length
+        // of 'lengths[i]' bytes, storing the digest of 'messages[i]' in the
+        // 'k_DIGEST_SIZE' bytes starting at 'results + i * k_DIGEST_SIZE'.
+        // The result for each message is the same as that obtained by
+        // 'loadDigest' after supplying the message to 'update' of a default
+        // constructed object, but several messages may be hashed at once.
+        // The behavior is undefined unless 'results' refers to at least
+        // 'numMessages * k_DIGEST_SIZE' bytes, 'messages' and 'lengths' each
+        // refer to at least 'numMessages' elements, and
+        // '[messages[i], messages[i] + lengths[i])' is a valid range for each
+        // 'i' in '[0, numMessages)'.  Note that if 'messages[i]' is 0, then
+        // 'lengths[i]' must also be 0.
+
     // CREATORS
     Sha224();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -201,6 +244,25 @@ class Sha256 {
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char      *results,
+                            const void *const  *messages,
+                            const bsl::size_t  *lengths,
+                            bsl::size_t         numMessages);
+        // Load into the specified 'results' the SHA-256 digests of each of the
+        // specified 'numMessages' 'messages', where 'messages[i]' has a length
+        // of 'lengths[i]' bytes, storing the digest of 'messages[i]' in the
+        // 'k_DIGEST_SIZE' bytes starting at 'results + i * k_DIGEST_SIZE'.
+        // The result for each message is the same as that obtained by
+        // 'loadDigest' after supplying the message to 'update' of a default
+        // constructed object, but several messages may be hashed at once.
+        // The behavior is undefined unless 'results' refers to at least
+        // 'numMessages * k_DIGEST_SIZE' bytes, 'messages' and 'lengths' each
+        // refer to at least 'numMessages' elements, and
+        // '[messages[i], messages[i] + lengths[i])' is a valid range for each
+        // 'i' in '[0, numMessages)'.  Note that if 'messages[i]' is 0, then
+        // 'lengths[i]' must also be 0.
+
     // CREATORS
     Sha256();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -403,6 +465,36 @@ class Sha512 {
         // output 'stream' and return a reference to the modifiable 'stream'.
 };
 
+                               // ===============
+                               // struct Sha2_Imp
+                               // ===============
+
+struct Sha2_Imp {
+    // This component-private 'struct' provides alternative implementations
+    // of the SHA-2 algorithms that should not be used other than to test and
+    // benchmark this component.
+
+    // CLASS METHODS
+    static bool loadSha224DigestsAvx2(unsigned char      *results,
+                                      const void *const  *messages,
+                                      const bsl::size_t  *lengths,
+                                      bsl::size_t         numMessages);
+    static bool loadSha256DigestsAvx2(unsigned char      *results,
+                                      const void *const  *messages,
+                                      const bsl::size_t  *lengths,
+                                      bsl::size_t         numMessages);
+        // If this platform supports AVX2 and the CPU on which this process is
+        // running supports it, load into the specified 'results' the SHA-224
+        // (respectively, SHA-256) digests of each of the specified
+        // 'numMessages' 'messages', where 'messages[i]' has a length of
+        // 'lengths[i]' bytes, hashing eight messages at a time using AVX2
+        // instructions whether or not the CPU supports the SHA extensions,
+        // and return 'true'; otherwise, return 'false' with no effect.  The
+        // digests are stored as by 'Sha224::loadDigests' (respectively,
+        // 'Sha256::loadDigests').  The behavior is undefined unless
+        // '8 <= numMessages' and the preconditions of 'loadDigests' are met.
+};
+
 // FREE OPERATORS
 bool operator==(const Sha224& lhs, const Sha224& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' SHA digests have the same
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -86,6 +87,12 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [27] void Sha224::loadDigests(uchar *, const void *const *, ...);
+// [27] void Sha256::loadDigests(uchar *, const void *const *, ...);
+// [27] bool Sha2_Imp::loadSha224DigestsAvx2(uchar *, ...);
+// [27] bool Sha2_Imp::loadSha256DigestsAvx2(uchar *, ...);
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +142,10 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [26] CONCERN: Accelerated SHA-224/SHA-256 match a reference implementation.
+// [28] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'update' and 'loadDigests'
+
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -285,6 +295,243 @@ const char *const sha512Results[6] =
 //                   HELPER CLASSES AND FUNCTIONS FOR TESTING
 //-----------------------------------------------------------------------------
 
+const bsl::uint32_t referenceConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+const bsl::uint32_t referenceSha224State[8] = {
+    0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+    0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4
+};
+
+const bsl::uint32_t referenceSha256State[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+bsl::uint32_t rotr(bsl::uint32_t value, int shift)
+    // Return the specified 'value' rotated right by the specified 'shift'
+    // bits.
+{
+    return (value >> shift) | (value << (32 - shift));
+}
+
+void referenceHash(unsigned char       *result,
+                   bsl::size_t          digestSize,
+                   const bsl::uint32_t *initialState,
+                   const bsl::string&   message)
+    // Load into the specified 'result' the first specified 'digestSize'
+    // bytes of the digest of the specified 'message' computed from the
+    // specified 'initialState' with a straightforward implementation of the
+    // SHA-256 compression function, transcribed directly from FIPS-180.
+{
+    bsl::string padded(message);
+    padded.push_back(static_cast<char>(0x80));
+    while (padded.size() % 64 != 56) {
+        padded.push_back('\0');
+    }
+    const bsl::uint64_t bits = static_cast<bsl::uint64_t>(message.size()) * 8;
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        padded.push_back(static_cast<char>(bits >> shift));
+    }
+
+    bsl::uint32_t h[8];
+    bsl::copy(initialState, initialState + 8, h);
+
+    for (bsl::size_t offset = 0; offset != padded.size(); offset += 64) {
+        const unsigned char *block =
+                  reinterpret_cast<const unsigned char *>(padded.data())
+                + offset;
+
+        bsl::uint32_t w[64];
+        for (int t = 0; t != 16; ++t) {
+            w[t] = (static_cast<bsl::uint32_t>(block[4 * t + 0]) << 24)
+                 | (static_cast<bsl::uint32_t>(block[4 * t + 1]) << 16)
+                 | (static_cast<bsl::uint32_t>(block[4 * t + 2]) <<  8)
+                 |  static_cast<bsl::uint32_t>(block[4 * t + 3]);
+        }
+        for (int t = 16; t != 64; ++t) {
+            const bsl::uint32_t s0 = rotr(w[t - 15],  7)
+                                   ^ rotr(w[t - 15], 18)
+                                   ^ (w[t - 15] >> 3);
+            const bsl::uint32_t s1 = rotr(w[t - 2], 17)
+                                   ^ rotr(w[t - 2], 19)
+                                   ^ (w[t - 2] >> 10);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+
+        bsl::uint32_t a = h[0], b = h[1], c = h[2], d = h[3];
+        bsl::uint32_t e = h[4], f = h[5], g = h[6], k = h[7];
+        for (int t = 0; t != 64; ++t) {
+            const bsl::uint32_t t1 = k
+                                   + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25))
+                                   + ((e & f) ^ (~e & g))
+                                   + referenceConstants[t]
+                                   + w[t];
+            const bsl::uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22))
+                                   + ((a & b) ^ (a & c) ^ (b & c));
+            k = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d;
+        h[4] += e; h[5] += f; h[6] += g; h[7] += k;
+    }
+
+    for (bsl::size_t index = 0; index != digestSize; ++index) {
+        result[index] = static_cast<unsigned char>(
+                                    h[index / 4] >> (24 - 8 * (index % 4)));
+    }
+}
+
+bsl::string makeMessage(bsl::size_t length, unsigned seed)
+    // Return a string of the specified 'length' whose bytes are generated
+    // from the specified 'seed'.
+{
+    bsl::string result(length, '\0');
+    for (bsl::size_t index = 0; index != length; ++index) {
+        seed = seed * 1103515245 + 12345;
+        result[index] = static_cast<char>(seed >> 16);
+    }
+    return result;
+}
+
+template <class HASHER>
+void testAgainstReference(const bsl::uint32_t *initialState)
+    // Verify that 'HASHER', which must be 'bdlde::Sha224' or 'bdlde::Sha256',
+    // produces the same digests as 'referenceHash' invoked with the specified
+    // 'initialState' for messages of a range of lengths, whether supplied
+    // all at once or in pieces.
+{
+    const bsl::size_t SIZE = HASHER::k_DIGEST_SIZE;
+
+    for (bsl::size_t length = 0; length <= 1100; ++length) {
+        const bsl::string message = makeMessage(length,
+                                                static_cast<unsigned>(length));
+
+        unsigned char expected[SIZE];
+        referenceHash(expected, SIZE, initialState, message);
+
+        unsigned char digest[SIZE];
+        HASHER(message.data(), length).loadDigest(digest);
+        ASSERTV(length, bsl::equal(expected, expected + SIZE, digest));
+
+        const bsl::size_t split = length / 3;
+        HASHER            hasher;
+        hasher.update(message.data(), split);
+        hasher.update(message.data() + split, length - split);
+        hasher.loadDigestAndReset(digest);
+        ASSERTV(length, bsl::equal(expected, expected + SIZE, digest));
+    }
+}
+
+template <class HASHER>
+bool testLoadDigests(const bsl::uint32_t *initialState, bool useAvx2)
+    // Verify that 'HASHER::loadDigests', where 'HASHER' is 'bdlde::Sha224' or
+    // 'bdlde::Sha256', produces the same digests as 'referenceHash' invoked
+    // with the specified 'initialState' for batches of messages of various
+    // sizes and lengths.  If the specified 'useAvx2' is 'true', verify
+    // instead the corresponding AVX2 function of 'bdlde::Sha2_Imp' for the
+    // batches of at least 8 messages.  Return 'false' if 'useAvx2' is 'true'
+    // and the AVX2 implementation is not supported on this host, and 'true'
+    // otherwise.
+{
+    const bsl::size_t SIZE = HASHER::k_DIGEST_SIZE;
+
+    // Batches of identical, increasing, decreasing, and mixed lengths, so
+    // that lanes finish at the same time and at different times.
+
+    const struct {
+        int         d_line;
+        bsl::size_t d_numMessages;
+        bsl::size_t d_base;
+        int         d_step;
+    } DATA[] = {
+        //LINE  NUM  BASE  STEP
+        //----  ---  ----  ----
+        { L_,     0,    0,    0 },
+        { L_,     1,    3,    0 },
+        { L_,     7,   64,    1 },
+        { L_,     8,    0,    0 },
+        { L_,     8,   55,    1 },
+        { L_,     9,  300,   -7 },
+        { L_,    16,   64,    0 },
+        { L_,    17,    0,   13 },
+        { L_,    40,  200,   -5 },
+        { L_,    64,    1,   37 },
+        { L_,   100, 1000,   -9 },
+    };
+    const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE = DATA[ti].d_line;
+        const bsl::size_t NUM  = DATA[ti].d_numMessages;
+
+        if (useAvx2 && NUM < 8) {
+            continue;                                               // CONTINUE
+        }
+
+        bsl::vector<bsl::string>  messages(NUM);
+        bsl::vector<const void *> pointers(NUM + 1, (const void *)0);
+        bsl::vector<bsl::size_t>  lengths(NUM + 1, 0);
+        for (bsl::size_t i = 0; i != NUM; ++i) {
+            const bsl::size_t length = (DATA[ti].d_base
+                                      + DATA[ti].d_step * static_cast<int>(i)
+                                      + (i % 3 == 2 ? 61 : 0)) % 2000;
+            messages[i] = makeMessage(length, static_cast<unsigned>(i + ti));
+            pointers[i] = messages[i].data();
+            lengths[i]  = length;
+        }
+
+        bsl::vector<unsigned char> results(NUM * SIZE + 1, 0xa5);
+        if (!useAvx2) {
+            HASHER::loadDigests(results.data(),
+                                pointers.data(),
+                                lengths.data(),
+                                NUM);
+        }
+        else if (!(bdlde::Sha224::k_DIGEST_SIZE == SIZE
+                   ? bdlde::Sha2_Imp::loadSha224DigestsAvx2(results.data(),
+                                                            pointers.data(),
+                                                            lengths.data(),
+                                                            NUM)
+                   : bdlde::Sha2_Imp::loadSha256DigestsAvx2(results.data(),
+                                                            pointers.data(),
+                                                            lengths.data(),
+                                                            NUM))) {
+            return false;                                             // RETURN
+        }
+
+        for (bsl::size_t i = 0; i != NUM; ++i) {
+            unsigned char expected[SIZE];
+            referenceHash(expected, SIZE, initialState, messages[i]);
+            ASSERTV(LINE, i, lengths[i],
+                    bsl::equal(expected,
+                               expected + SIZE,
+                               results.data() + i * SIZE));
+        }
+        ASSERTV(LINE, 0xa5 == results[NUM * SIZE]);
+    }
+
+    return true;
+}
+
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -509,7 +756,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -531,6 +778,88 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadDigests'
+        //
+        // Concerns:
+        //: 1 'loadDigests' stores the digest of each message at the
+        //:   corresponding offset of 'results', and writes nothing beyond the
+        //:   last digest.
+        //:
+        //: 2 The digests are correct whether the batch is hashed one message
+        //:   at a time or several messages at once, including when messages
+        //:   in the same batch have different numbers of blocks.
+        //:
+        //: 3 A batch of no messages is supported.
+        //:
+        //: 4 The AVX2 multi-buffer implementation produces the correct
+        //:   digests on every host supporting AVX2, including hosts having
+        //:   the SHA extensions, on which 'loadDigests' does not use it.
+        //
+        // Plan:
+        //: 1 For a table of batch sizes and length patterns, hash a batch of
+        //:   generated messages with 'loadDigests' and compare each digest
+        //:   with that computed by a reference implementation.  Verify that a
+        //:   sentinel byte following the results is unchanged.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 for the batches of at least 8 messages, hashing them
+        //:   with the AVX2 functions of 'bdlde::Sha2_Imp' if the host
+        //:   supports AVX2.  (C-4)
+        //
+        // Testing:
+        //   void Sha224::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha256::loadDigests(uchar *, const void *const *, ...);
+        //   bool Sha2_Imp::loadSha224DigestsAvx2(uchar *, ...);
+        //   bool Sha2_Imp::loadSha256DigestsAvx2(uchar *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'loadDigests'" "\n"
+                             "=====================" "\n";
+
+        testLoadDigests<bdlde::Sha224>(referenceSha224State, false);
+        testLoadDigests<bdlde::Sha256>(referenceSha256State, false);
+
+        if (verbose) cout << "\nAVX2 multi-buffer implementation." << endl;
+
+        const bool hasAvx2 =
+                  testLoadDigests<bdlde::Sha224>(referenceSha224State, true);
+        ASSERT(hasAvx2 ==
+                  testLoadDigests<bdlde::Sha256>(referenceSha256State, true));
+
+        if (verbose && !hasAvx2) {
+            cout << "AVX2 is not supported on this host." << endl;
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // CONSISTENCY WITH A REFERENCE IMPLEMENTATION
+        //
+        // Concerns:
+        //: 1 SHA-224 and SHA-256 digests are identical to those computed by a
+        //:   straightforward implementation of FIPS-180, whichever (hardware
+        //:   or portable) implementation of the compression function is
+        //:   selected at runtime.
+        //:
+        //: 2 The digests are correct for message lengths at and around every
+        //:   block boundary, and when the message is supplied in pieces.
+        //
+        // Plan:
+        //: 1 For every message length in '[0, 1100]', compare the digest of a
+        //:   generated message, supplied all at once and in two pieces, with
+        //:   that computed by a reference implementation in this test
+        //:   driver.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: Accelerated SHA-224/SHA-256 match a reference.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "CONSISTENCY WITH A REFERENCE IMPLEMENTATION\n"
+                             "===========================================\n";
+
+        testAgainstReference<bdlde::Sha224>(referenceSha224State);
+        testAgainstReference<bdlde::Sha256>(referenceSha256State);
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
@@ -1250,6 +1579,90 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'update' AND 'loadDigests'
+        //
+        // Concerns:
+        //: 1 Report the throughput of hashing long and short messages one at
+        //:   a time, and of hashing batches of short messages with
+        //:   'loadDigests'.
+        //
+        // Plan:
+        //: 1 Time each operation with 'bsls::Stopwatch' and report the
+        //:   throughput in MB/s.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'update' and 'loadDigests'
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE: 'update' AND 'loadDigests'" "\n"
+                "=======================================" "\n";
+
+        const bsl::string LONG = makeMessage(1 << 20, 1);
+
+        unsigned char digest[bdlde::Sha512::k_DIGEST_SIZE];
+        {
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i != 64; ++i) {
+                bdlde::Sha256(LONG.data(), LONG.size()).loadDigest(digest);
+            }
+            timer.stop();
+            cout << "Sha256 1MB messages: "
+                 << 64.0 / timer.elapsedTime() << " MB/s\n";
+        }
+        {
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i != 64; ++i) {
+                bdlde::Sha512(LONG.data(), LONG.size()).loadDigest(digest);
+            }
+            timer.stop();
+            cout << "Sha512 1MB messages: "
+                 << 64.0 / timer.elapsedTime() << " MB/s\n";
+        }
+
+        const bsl::size_t NUM_MESSAGES = 1 << 14;
+        const bsl::size_t LENGTHS[]    = { 32, 100, 1000 };
+
+        for (bsl::size_t li = 0; li != arraySize(LENGTHS); ++li) {
+            const bsl::size_t LENGTH = LENGTHS[li];
+            const double      MB     = static_cast<double>(NUM_MESSAGES)
+                                     * static_cast<double>(LENGTH)
+                                     / (1 << 20);
+
+            bsl::vector<const void *> pointers(NUM_MESSAGES);
+            bsl::vector<bsl::size_t>  lengths(NUM_MESSAGES, LENGTH);
+            for (bsl::size_t i = 0; i != NUM_MESSAGES; ++i) {
+                pointers[i] = LONG.data() + i * 64 % (LONG.size() - LENGTH);
+            }
+            bsl::vector<unsigned char> results(NUM_MESSAGES *
+                                               bdlde::Sha256::k_DIGEST_SIZE);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (bsl::size_t i = 0; i != NUM_MESSAGES; ++i) {
+                bdlde::Sha256(pointers[i], LENGTH).loadDigest(
+                            results.data() + i * bdlde::Sha256::k_DIGEST_SIZE);
+            }
+            timer.stop();
+            const double oneByOne = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            bdlde::Sha256::loadDigests(results.data(),
+                                       pointers.data(),
+                                       lengths.data(),
+                                       NUM_MESSAGES);
+            timer.stop();
+            const double batch = timer.elapsedTime();
+
+            cout << "Sha256 " << LENGTH << "-byte messages: "
+                 << MB / oneByOne << " MB/s one at a time, "
+                 << MB / batch    << " MB/s with 'loadDigests'\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
@@ -12,13 +12,36 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
+#include <bslmt_once.h>
+
 #include <bsls_assert.h>
+#include <bsls_log.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
 
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
 
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_X86_GCC
+#endif
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) || defined(__SSE2__)
+#define BDLDE_UTF8UTIL_SSE2
+#endif
+
+#if defined(LIKE_X86_GCC)
+#include <immintrin.h>
+#elif defined(BDLDE_UTF8UTIL_SSE2)
+#include <emmintrin.h>
+#endif
+
 // LOCAL CONSTANTS
 
 namespace {
@@ -46,7 +69,13 @@ enum {
     k_FOURBYTEHEAD_TEST  = 0xF8,  // 4 byte Utf8
     k_FOURBYTEHEAD_RES   = 0XF0,
     k_MULTIPLEBYTE_TEST  = 0xC0,  // 2nd, 3rd, 4th byte
-    k_MULTIPLEBYTE_RES   = 0X80
+    k_MULTIPLEBYTE_RES   = 0X80,
+
+    k_ASCII_BLOCK_SIZE   = 16,    // number of bytes examined by
+                                  // 'isAsciiBlock'
+
+    k_MIN_VECTOR_LENGTH  = 16     // min length of input validated by the
+                                  // vectorized kernels
 };
 
 #if defined(BSLS_ASSERT_SAFE_IS_ACTIVE)
@@ -399,6 +428,557 @@ static int validateAndCountCodePoints(const char             **invalidString,
     return count;
 }
 
+static inline
+bool isAsciiBlock(const char *string)
+    // Return 'true' if none of the 'k_ASCII_BLOCK_SIZE' bytes starting at the
+    // specified 'string' has its high bit set, and 'false' otherwise.
+{
+#if defined(BDLDE_UTF8UTIL_SSE2)
+    const __m128i input = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(string));
+    return 0 == _mm_movemask_epi8(input);
+#else
+    bsls::Types::Uint64 words[2];
+    bsl::memcpy(words, string, sizeof(words));
+    return 0 == ((words[0] | words[1]) & 0x8080808080808080ULL);
+#endif
+}
+
+#if defined(LIKE_X86_GCC)
+
+// The following vectorized kernels validate UTF-8 input and count its code
+// points 16 (SSSE3) or 32 (AVX2) bytes at a time, using the table-lookup
+// algorithm described in "Validating UTF-8 In Less Than One Instruction Per
+// Byte" (Keiser and Lemire, 2021).  Each byte of the input is classified,
+// together with the 1, 2, and 3 bytes preceding it, by three 16-entry table
+// lookups ('pshufb') whose results are and-ed together; any bit remaining set
+// identifies an encoding error.  Blocks consisting entirely of ASCII skip the
+// classification.  The count of code points is the count of bytes that are
+// not continuation bytes.
+//
+// The kernels only detect *that* an error occurred within a block (or in a
+// multi-byte sequence ending within it).  To report exactly the same
+// 'invalidString' as the scalar implementation, the scalar implementation is
+// then resumed from the last code point boundary preceding the block.
+
+enum {
+    // Error bits set by the table lookups.  Note that 'k_TOO_LARGE_1000' and
+    // 'k_OVERLONG_4' share a bit.
+
+    k_TOO_SHORT      = 1 << 0,  // lead byte not followed by a continuation
+    k_TOO_LONG       = 1 << 1,  // ASCII followed by a continuation
+    k_OVERLONG_3     = 1 << 2,  // non-minimal 3-byte encoding
+    k_TOO_LARGE      = 1 << 3,  // value above 0x10ffff
+    k_SURROGATE      = 1 << 4,  // surrogate value
+    k_OVERLONG_2     = 1 << 5,  // non-minimal 2-byte encoding
+    k_TOO_LARGE_1000 = 1 << 6,  // value above 0x10ffff (second byte 1000xxxx)
+    k_OVERLONG_4     = 1 << 6,  // non-minimal 4-byte encoding
+    k_TWO_CONTS      = 1 << 7,  // continuation following a continuation
+
+    k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+                                // errors determined by the high nibble of the
+                                // first byte alone
+};
+
+static const unsigned char byte1HighTable[16] = {
+    // indexed by the high nibble of the first byte of a pair
+
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,       // 0xxx: ASCII
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,   // 10xx: continuation
+    k_TOO_SHORT | k_OVERLONG_2,                           // 1100: 2-byte lead
+    k_TOO_SHORT,                                          // 1101: 2-byte lead
+    k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,             // 1110: 3-byte lead
+    k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000 | k_OVERLONG_4
+                                                          // 1111: 4-byte lead
+};
+
+static const unsigned char byte1LowTable[16] = {
+    // indexed by the low nibble of the first byte of a pair
+
+    k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4, // xxxx0000
+    k_CARRY | k_OVERLONG_2,                               // xxxx0001
+    k_CARRY,                                              // xxxx0010
+    k_CARRY,                                              // xxxx0011
+    k_CARRY | k_TOO_LARGE,                                // xxxx0100
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx0101
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx0110
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx0111
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx1000
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx1001
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx1010
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx1011
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx1100
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000 | k_SURROGATE,
+                                                          // xxxx1101
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,             // xxxx1110
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000              // xxxx1111
+};
+
+static const unsigned char byte2HighTable[16] = {
+    // indexed by the high nibble of the second byte of a pair
+
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,   // 0xxx: ASCII
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE_1000
+                                                          // 1000
+             | k_OVERLONG_4,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE,
+                                                          // 1001
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE  | k_TOO_LARGE,
+                                                          // 1010
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE  | k_TOO_LARGE,
+                                                          // 1011
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT    // 11xx: lead
+};
+
+static const unsigned char incompleteMaxTable[32] = {
+    // The maximum value of each byte of the last 32 bytes of a block for
+    // which the block does not end with an incomplete multi-byte sequence.
+
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+};
+
+typedef bsls::Types::IntPtr (*ValidateFunction)(const char             **,
+                                                const char              *,
+                                                bsls::Types::size_type);
+    // Signature of the functions implementing the length-based
+    // 'validateAndCountCodePoints'.
+
+static
+bsls::Types::IntPtr resumeScalarValidation(const char  **invalidString,
+                                           const char   *string,
+                                           const char   *blockStart,
+                                           const char   *end)
+    // Validate the specified range '[string, end)', having a vectorized
+    // kernel found to contain an error in, or ending within, the block
+    // starting at the specified 'blockStart', using the scalar
+    // implementation.  Return a negative value and load into the specified
+    // 'invalidString' the address of the first byte in the range that does
+    // not constitute the start of a valid UTF-8 encoding.  The behavior is
+    // undefined unless '[string, blockStart)' contains valid UTF-8, with the
+    // possible exception of a truncated multi-byte sequence at its end.
+{
+    // No multi-byte sequence is longer than 4 bytes, so the first byte in
+    // '[blockStart - 3, blockStart)' that is not a continuation byte, if any,
+    // starts a code point; otherwise 'blockStart' does.
+
+    const char *pc = blockStart - string >= 3 ? blockStart - 3 : string;
+    while (pc < blockStart && !isNotContinuation(*pc)) {
+        ++pc;
+    }
+
+    const int rc = validateAndCountCodePoints(invalidString, pc, end - pc);
+    BSLS_ASSERT_SAFE(rc < 0);
+    return rc;
+}
+
+                            // -----------------
+                            // SSSE3 (16 bytes)
+                            // -----------------
+
+__attribute__((target("ssse3,popcnt")))
+static inline
+bool validateBlockSsse3(bsls::Types::IntPtr *count,
+                        __m128i             *previous,
+                        __m128i             *previousIncomplete,
+                        const __m128i&       input)
+    // Validate the specified 'input' block, immediately preceded in the input
+    // by the specified 'previous' block, add to the specified 'count' the
+    // number of code points starting in 'input', and load 'input' into
+    // 'previous'.  Return 'true' if an error is found in 'input', including
+    // in a multi-byte sequence started in 'previous', and 'false' otherwise.
+    // Update the specified 'previousIncomplete' to flag whether 'input' ends
+    // with a multi-byte sequence that must be continued by the next block.
+{
+    __m128i error;
+
+    if (0 == _mm_movemask_epi8(input)) {
+        // ASCII fast path: only an incomplete sequence at the end of the
+        // previous block can be in error.
+
+        error               = *previousIncomplete;
+        *previousIncomplete = _mm_setzero_si128();
+        *count             += 16;
+    }
+    else {
+        const __m128i nibble = _mm_set1_epi8(0x0f);
+
+        const __m128i prev1 = _mm_alignr_epi8(input, *previous, 16 - 1);
+        const __m128i prev2 = _mm_alignr_epi8(input, *previous, 16 - 2);
+        const __m128i prev3 = _mm_alignr_epi8(input, *previous, 16 - 3);
+
+        const __m128i table1High = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(byte1HighTable));
+        const __m128i table1Low  = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(byte1LowTable));
+        const __m128i table2High = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(byte2HighTable));
+
+        const __m128i byte1High = _mm_shuffle_epi8(
+                              table1High,
+                              _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+        const __m128i byte1Low  = _mm_shuffle_epi8(
+                              table1Low,
+                              _mm_and_si128(prev1, nibble));
+        const __m128i byte2High = _mm_shuffle_epi8(
+                              table2High,
+                              _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+
+        const __m128i special = _mm_and_si128(_mm_and_si128(byte1High,
+                                                            byte1Low),
+                                              byte2High);
+
+        // Bytes that must be the 2nd continuation of a 3- or 4-byte sequence,
+        // or the 3rd continuation of a 4-byte sequence.
+
+        const __m128i must23 = _mm_or_si128(
+                            _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80)),
+                            _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80)));
+
+        error = _mm_xor_si128(_mm_and_si128(must23,
+                                            _mm_set1_epi8(
+                                                  static_cast<char>(0x80))),
+                              special);
+
+        *previousIncomplete = _mm_subs_epu8(
+                             input,
+                             _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                    incompleteMaxTable + 16)));
+
+        const int notContinuation = _mm_movemask_epi8(
+                             _mm_cmpgt_epi8(input, _mm_set1_epi8(-0x41)));
+        *count += __builtin_popcount(notContinuation);
+    }
+
+    *previous = input;
+
+    return 0xffff != _mm_movemask_epi8(
+                                   _mm_cmpeq_epi8(error, _mm_setzero_si128()));
+}
+
+__attribute__((target("ssse3,popcnt")))
+static
+bsls::Types::IntPtr validateAndCountCodePointsSsse3(
+                                       const char             **invalidString,
+                                       const char              *string,
+                                       bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if 'string' contains valid UTF-8, and
+    // otherwise return a negative value and load into the specified
+    // 'invalidString' the address of the first byte in 'string' that does not
+    // constitute the start of a valid UTF-8 encoding.  Use SSSE3 instructions.
+{
+    const char *const end = string + length;
+    const char       *pc  = string;
+
+    bsls::Types::IntPtr count              = 0;
+    __m128i             previous           = _mm_setzero_si128();
+    __m128i             previousIncomplete = _mm_setzero_si128();
+
+    for (; end - pc >= 16; pc += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                        reinterpret_cast<const __m128i *>(pc));
+        if (UNLIKELY(validateBlockSsse3(&count,
+                                        &previous,
+                                        &previousIncomplete,
+                                        input))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            return resumeScalarValidation(invalidString, string, pc, end);
+                                                                      // RETURN
+        }
+    }
+
+    if (pc < end) {
+        // Validate the remaining bytes padded with null bytes, which are
+        // ASCII and flag any trailing truncated sequence as too short.
+
+        char buffer[16] = { 0 };
+        bsl::memcpy(buffer, pc, end - pc);
+
+        const __m128i input = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(buffer));
+        if (UNLIKELY(validateBlockSsse3(&count,
+                                        &previous,
+                                        &previousIncomplete,
+                                        input))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            return resumeScalarValidation(invalidString, string, pc, end);
+                                                                      // RETURN
+        }
+        count -= 16 - (end - pc);
+    }
+    else if (UNLIKELY(0xffff != _mm_movemask_epi8(
+                                      _mm_cmpeq_epi8(previousIncomplete,
+                                                     _mm_setzero_si128())))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return resumeScalarValidation(invalidString, string, end, end);
+                                                                      // RETURN
+    }
+
+    return count;
+}
+
+                             // ---------------
+                             // AVX2 (32 bytes)
+                             // ---------------
+
+__attribute__((target("avx2,popcnt")))
+static inline
+bool validateBlockAvx2(bsls::Types::IntPtr *count,
+                       __m256i             *previous,
+                       __m256i             *previousIncomplete,
+                       const __m256i&       input)
+    // Validate the specified 'input' block, immediately preceded in the input
+    // by the specified 'previous' block, add to the specified 'count' the
+    // number of code points starting in 'input', and load 'input' into
+    // 'previous'.  Return 'true' if an error is found in 'input', including
+    // in a multi-byte sequence started in 'previous', and 'false' otherwise.
+    // Update the specified 'previousIncomplete' to flag whether 'input' ends
+    // with a multi-byte sequence that must be continued by the next block.
+{
+    __m256i error;
+
+    if (0 == _mm256_movemask_epi8(input)) {
+        // ASCII fast path: only an incomplete sequence at the end of the
+        // previous block can be in error.
+
+        error               = *previousIncomplete;
+        *previousIncomplete = _mm256_setzero_si256();
+        *count             += 32;
+    }
+    else {
+        const __m256i nibble = _mm256_set1_epi8(0x0f);
+
+        // 'shifted' holds the last 16 bytes of 'previous' followed by the
+        // first 16 bytes of 'input', so that 'alignr', which operates on each
+        // 128-bit lane independently, can shift bytes across the lanes.
+
+        const __m256i shifted = _mm256_permute2x128_si256(*previous,
+                                                          input,
+                                                          0x21);
+
+        const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 16 - 1);
+        const __m256i prev2 = _mm256_alignr_epi8(input, shifted, 16 - 2);
+        const __m256i prev3 = _mm256_alignr_epi8(input, shifted, 16 - 3);
+
+        const __m256i table1High = _mm256_broadcastsi128_si256(
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                            byte1HighTable)));
+        const __m256i table1Low  = _mm256_broadcastsi128_si256(
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                             byte1LowTable)));
+        const __m256i table2High = _mm256_broadcastsi128_si256(
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                            byte2HighTable)));
+
+        const __m256i byte1High = _mm256_shuffle_epi8(
+                        table1High,
+                        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+        const __m256i byte1Low  = _mm256_shuffle_epi8(
+                        table1Low,
+                        _mm256_and_si256(prev1, nibble));
+        const __m256i byte2High = _mm256_shuffle_epi8(
+                        table2High,
+                        _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+
+        const __m256i special = _mm256_and_si256(
+                                        _mm256_and_si256(byte1High, byte1Low),
+                                        byte2High);
+
+        // Bytes that must be the 2nd continuation of a 3- or 4-byte sequence,
+        // or the 3rd continuation of a 4-byte sequence.
+
+        const __m256i must23 = _mm256_or_si256(
+                      _mm256_subs_epu8(prev2, _mm256_set1_epi8(0xe0 - 0x80)),
+                      _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xf0 - 0x80)));
+
+        error = _mm256_xor_si256(_mm256_and_si256(must23,
+                                                  _mm256_set1_epi8(
+                                                     static_cast<char>(0x80))),
+                                 special);
+
+        *previousIncomplete = _mm256_subs_epu8(
+                        input,
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                                         incompleteMaxTable)));
+
+        const unsigned int notContinuation = _mm256_movemask_epi8(
+                         _mm256_cmpgt_epi8(input, _mm256_set1_epi8(-0x41)));
+        *count += __builtin_popcount(notContinuation);
+    }
+
+    *previous = input;
+
+    return !_mm256_testz_si256(error, error);
+}
+
+__attribute__((target("avx2,popcnt")))
+static
+bsls::Types::IntPtr validateAndCountCodePointsAvx2(
+                                       const char             **invalidString,
+                                       const char              *string,
+                                       bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if 'string' contains valid UTF-8, and
+    // otherwise return a negative value and load into the specified
+    // 'invalidString' the address of the first byte in 'string' that does not
+    // constitute the start of a valid UTF-8 encoding.  Use AVX2 instructions.
+{
+    const char *const end = string + length;
+    const char       *pc  = string;
+
+    bsls::Types::IntPtr count              = 0;
+    __m256i             previous           = _mm256_setzero_si256();
+    __m256i             previousIncomplete = _mm256_setzero_si256();
+
+    for (; end - pc >= 32; pc += 32) {
+        const __m256i input = _mm256_loadu_si256(
+                                        reinterpret_cast<const __m256i *>(pc));
+        if (UNLIKELY(validateBlockAvx2(&count,
+                                       &previous,
+                                       &previousIncomplete,
+                                       input))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            return resumeScalarValidation(invalidString, string, pc, end);
+                                                                      // RETURN
+        }
+    }
+
+    if (pc < end) {
+        // Validate the remaining bytes padded with null bytes, which are
+        // ASCII and flag any trailing truncated sequence as too short.
+
+        char buffer[32] = { 0 };
+        bsl::memcpy(buffer, pc, end - pc);
+
+        const __m256i input = _mm256_loadu_si256(
+                                    reinterpret_cast<const __m256i *>(buffer));
+        if (UNLIKELY(validateBlockAvx2(&count,
+                                       &previous,
+                                       &previousIncomplete,
+                                       input))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            return resumeScalarValidation(invalidString, string, pc, end);
+                                                                      // RETURN
+        }
+        count -= 32 - (end - pc);
+    }
+    else if (UNLIKELY(!_mm256_testz_si256(previousIncomplete,
+                                          previousIncomplete))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        return resumeScalarValidation(invalidString, string, end, end);
+                                                                      // RETURN
+    }
+
+    return count;
+}
+
+static
+bsls::Types::IntPtr validateAndCountCodePointsScalar(
+                                       const char             **invalidString,
+                                       const char              *string,
+                                       bsls::Types::size_type   length)
+    // Call the scalar 'validateAndCountCodePoints' with the specified
+    // 'invalidString', 'string', and 'length', and return its result.
+{
+    return validateAndCountCodePoints(invalidString, string, length);
+}
+
+static
+ValidateFunction selectValidateFunction()
+    // Return the fastest implementation of the length-based
+    // 'validateAndCountCodePoints' supported by the CPU on which this process
+    // is running, or 0 if no vectorized implementation is supported.
+{
+    static ValidateFunction function = 0;
+
+    BSLMT_ONCE_DO {
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2") &&
+                                         __builtin_cpu_supports("popcnt")) {
+            BSLS_LOG_INFO("Using AVX2 version for UTF-8 validation");
+            function = &validateAndCountCodePointsAvx2;
+        }
+        else if (__builtin_cpu_supports("ssse3") &&
+                                         __builtin_cpu_supports("popcnt")) {
+            BSLS_LOG_INFO("Using SSSE3 version for UTF-8 validation");
+            function = &validateAndCountCodePointsSsse3;
+        }
+        else {
+            BSLS_LOG_INFO("Using scalar version for UTF-8 validation "
+                          "(neither AVX2 nor SSSE3 instructions available)");
+            function = &validateAndCountCodePointsScalar;
+        }
+    }
+
+    return function;
+}
+
+#endif  // LIKE_X86_GCC
+
+static
+bsls::Types::IntPtr fastValidateAndCountCodePoints(
+                                       const char             **invalidString,
+                                       const char              *string,
+                                       bsls::Types::size_type   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' (in bytes) if 'string' contains valid
+    // UTF-8, with no effect on the specified 'invalidString'.  Otherwise,
+    // return a negative value and load into 'invalidString' the address of the
+    // first byte in 'string' that does not constitute the start of a valid
+    // UTF-8 encoding.  Use a vectorized implementation if one is supported by
+    // the CPU and 'length' is large enough to benefit from it.  Note that the
+    // result is the same as that of the scalar 'validateAndCountCodePoints'.
+{
+#if defined(LIKE_X86_GCC)
+    if (length >= k_MIN_VECTOR_LENGTH) {
+        return selectValidateFunction()(invalidString, string, length);
+                                                                      // RETURN
+    }
+#endif
+
+    return validateAndCountCodePoints(invalidString, string, length);
+}
+
+static
+bsls::Types::IntPtr fastValidateAndCountCodePoints(
+                                               const char **invalidString,
+                                               const char  *string)
+    // Return the number of Unicode code points in the specified
+    // null-terminated 'string' if 'string' contains valid UTF-8, with no
+    // effect on the specified 'invalidString'.  Otherwise, return a negative
+    // value and load into 'invalidString' the address of the first byte in
+    // 'string' that does not constitute the start of a valid UTF-8 encoding.
+    // Use a vectorized implementation if one is supported by the CPU.
+{
+#if defined(LIKE_X86_GCC)
+    if (&validateAndCountCodePointsScalar != selectValidateFunction()) {
+        // A null byte is not a continuation byte, so the terminating null
+        // byte truncates any multi-byte sequence it interrupts exactly as the
+        // end of length-delimited input does, and the same 'invalidString'
+        // results.
+
+        return fastValidateAndCountCodePoints(invalidString,
+                                              string,
+                                              bsl::strlen(string));
+                                                                      // RETURN
+    }
+#endif
+
+    return validateAndCountCodePoints(invalidString, string);
+}
+
 
 namespace BloombergLP {
 
@@ -654,6 +1234,16 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
           case 7: {
             // binary: 0xxxxxxx: ASCII and possible '\0'
 
+            // If the following block of input is entirely ASCII, and we are
+            // to advance over all of it, skip it in one step.  Note that
+            // 'ret' is incremented once more at the end of the iteration.
+
+            if (endOfInput - string >= k_ASCII_BLOCK_SIZE
+             && numCodePoints - ret >= k_ASCII_BLOCK_SIZE
+             && isAsciiBlock(string)) {
+                next  = string + k_ASCII_BLOCK_SIZE;
+                ret  += k_ASCII_BLOCK_SIZE - 1;
+            }
           } continue;
 
           case 8:
@@ -1038,7 +1628,7 @@ bool Utf8Util::isValid(const char **invalidString, const char *string)
     BSLS_ASSERT(invalidString);
     BSLS_ASSERT(string);
 
-    return validateAndCountCodePoints(invalidString, string) >= 0;
+    return fastValidateAndCountCodePoints(invalidString, string) >= 0;
 }
 
 bool Utf8Util::isValid(const char **invalidString,
@@ -1049,7 +1639,8 @@ bool Utf8Util::isValid(const char **invalidString,
     BSLS_ASSERT(string);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
-    return validateAndCountCodePoints(invalidString, string, length) >= 0;
+    return fastValidateAndCountCodePoints(invalidString, string, length)
+                                                                        >= 0;
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
@@ -1058,7 +1649,7 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(invalidString);
     BSLS_ASSERT(string);
 
-    return validateAndCountCodePoints(invalidString, string);
+    return fastValidateAndCountCodePoints(invalidString, string);
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
@@ -1069,7 +1660,7 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(string);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
-    return validateAndCountCodePoints(invalidString, string, length);
+    return fastValidateAndCountCodePoints(invalidString, string, length);
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsRaw(const char *string)
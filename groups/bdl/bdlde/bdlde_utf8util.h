@@ -68,6 +68,16 @@ BSLS_IDENT("$Id: $")
 //  http://en.wikipedia.org/wiki/Utf-8
 //..
 //
+///Performance
+///-----------
+// On x86 platforms supporting the SSSE3 or AVX2 instruction sets (determined
+// at run time), 'isValid' and 'numCodePointsIfValid' validate their input 16
+// or 32 bytes at a time, skipping blocks consisting entirely of ASCII at
+// negligible cost.  'advanceIfValid', when given the length of its input,
+// similarly skips runs of ASCII 16 bytes at a time.  The results, including
+// the value loaded into 'invalidString', are the same as those of the
+// byte-at-a-time implementation used on other platforms.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
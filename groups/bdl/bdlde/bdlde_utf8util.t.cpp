@@ -57,6 +57,9 @@ using bsl::size_t;
 //: o Test case 10 Test 'numBytesIfValid'.
 //: o Test case 11 Test 'getByteSize'.
 //: o Test case 12 Test 'appendUtf8Character'.
+//: o Test case 13 Test that the vectorized implementations of 'isValid',
+//:   'numCodePointsIfValid', and 'advanceIfValid' produce the same results as
+//:   the scalar implementation.
 //-----------------------------------------------------------------------------
 // CLASS METHODS
 // [12] int appendUtf8Character(bsl::string *, unsigned int);
@@ -97,9 +100,10 @@ using bsl::size_t;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
-// [13] USAGE EXAMPLE 1
-// [14] USAGE EXAMPLE 2
+// [14] USAGE EXAMPLE 1
+// [15] USAGE EXAMPLE 2
 // [ 9] 'advanceIfValid' on correct input followed by incorrect input
+// [13] vectorized validation agrees with scalar validation
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
 
@@ -2232,6 +2236,47 @@ int allNumCodePoints(const bsl::string& str)
     return len;
 }
 
+static
+bsls::Types::IntPtr referenceNumCodePointsIfValid(
+                                           const char  **invalidString,
+                                           const char   *string,
+                                           bsl::size_t   length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if 'string' contains valid UTF-8, and
+    // otherwise return a negative value and load into the specified
+    // 'invalidString' the address of the first byte that does not constitute
+    // the start of a valid UTF-8 encoding.  Validate 'string' one code point
+    // at a time, so that 'Obj' is never passed more than 4 bytes at once, and
+    // so that the result is that of the scalar (non-vectorized)
+    // implementation of 'Obj'.
+{
+    const char *pc  = string;
+    const char *end = string + length;
+
+    bsls::Types::IntPtr count = 0;
+    for (; pc < end; ++count) {
+        const unsigned char lead = static_cast<unsigned char>(*pc);
+
+        bsl::size_t size = lead < 0x80 ? 1
+                         : lead < 0xc0 ? 1
+                         : lead < 0xe0 ? 2
+                         : lead < 0xf0 ? 3
+                         :               4;
+        size = bsl::min<bsl::size_t>(size, end - pc);
+
+        const char *invalid;
+        if (!Obj::isValid(&invalid, pc, size)) {
+            ASSERT(pc == invalid);
+
+            *invalidString = pc;
+            return -1;                                                // RETURN
+        }
+        pc += size;
+    }
+
+    return count;
+}
+
 static
 bsl::string clone(const char *pc, int length)
     // Return a 'bsl::string' containing the specified 'length' bytes from the
@@ -2802,7 +2847,212 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING VECTORIZED VALIDATION
+        //
+        // Concerns:
+        //: 1 On platforms where 'isValid' and 'numCodePointsIfValid' are
+        //:   vectorized, they return the same results, and load the same
+        //:   'invalidString', as the scalar implementation, for both valid and
+        //:   invalid input.
+        //:
+        //: 2 Errors are correctly reported wherever they occur relative to the
+        //:   blocks processed by the vectorized implementation, including
+        //:   multi-byte sequences straddling two blocks and truncated
+        //:   sequences at the end of the input.
+        //:
+        //: 3 The null-terminated overloads report the same results as the
+        //:   overloads taking a length.
+        //:
+        //: 4 The ASCII fast path of 'advanceIfValid' advances by exactly the
+        //:   requested number of code points.
+        //
+        // Plan:
+        //: 1 Generate random valid strings of many lengths, mixing runs of
+        //:   ASCII with multi-byte code points, and compare the results of
+        //:   'numCodePointsIfValid' and 'isValid' with those of
+        //:   'referenceNumCodePointsIfValid', which validates one code point
+        //:   at a time.  (C-1, 3)
+        //:
+        //: 2 For every position in a number of valid strings, overwrite the
+        //:   byte at that position with each of a set of bytes likely to
+        //:   cause an error, and repeat P-1.  (C-1..3)
+        //:
+        //: 3 Repeat P-1 with every prefix of a number of valid strings.  (C-2)
+        //:
+        //: 4 Call 'advanceIfValid' for every number of code points on valid
+        //:   strings containing runs of ASCII, and compare the results with
+        //:   those of 'advanceRaw'.  (C-4)
+        //
+        // Testing:
+        //   vectorized validation agrees with scalar validation
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING VECTORIZED VALIDATION\n"
+                               "=============================\n";
+
+        static const char BAD_BYTES[] = {
+            '\0', 'a', '\x80', '\xbf', '\xc0', '\xc1', '\xc2', '\xdf',
+            '\xe0', '\xed', '\xef', '\xf0', '\xf4', '\xf5', '\xf8', '\xff'
+        };
+        enum { k_NUM_BAD_BYTES = sizeof BAD_BYTES / sizeof *BAD_BYTES };
+
+        bsl::vector<bsl::string> strings;
+        for (int length = 0; length < 200; ++length) {
+            for (int asciiPercent = 0; asciiPercent <= 100;
+                                                         asciiPercent += 50) {
+                bsl::string str;
+                while (str.length() < static_cast<bsl::size_t>(length)) {
+                    if (static_cast<int>(randUnsigned() % 100) <
+                                                               asciiPercent) {
+                        const int run = randUnsigned() % 40;
+                        for (int i = 0; i < run; ++i) {
+                            appendRand1Byte(&str);
+                        }
+                    }
+                    else {
+                        appendRandCorrectCodePoint(&str, false);
+                    }
+                }
+                strings.push_back(str);
+            }
+        }
+
+        if (verbose) cout << "Valid input\n";
+
+        for (bsl::size_t ti = 0; ti < strings.size(); ++ti) {
+            const bsl::string& STR = strings[ti];
+
+            const char *invalid = 0;
+            const bsls::Types::IntPtr EXP = referenceNumCodePointsIfValid(
+                                                                 &invalid,
+                                                                 STR.data(),
+                                                                 STR.length());
+            ASSERTV(ti, 0 <= EXP);
+
+            ASSERTV(ti, EXP == Obj::numCodePointsIfValid(&invalid,
+                                                         STR.data(),
+                                                         STR.length()));
+            ASSERTV(ti, EXP == Obj::numCodePointsIfValid(&invalid,
+                                                         STR.c_str()));
+            ASSERTV(ti, Obj::isValid(STR.data(), STR.length()));
+            ASSERTV(ti, Obj::isValid(STR.c_str()));
+            ASSERTV(ti, 0 == invalid);
+        }
+
+        if (verbose) cout << "Invalid bytes at every position\n";
+
+        for (bsl::size_t ti = 0; ti < strings.size(); ti += 7) {
+            for (bsl::size_t pos = 0; pos < strings[ti].length(); ++pos) {
+                for (int bi = 0; bi < k_NUM_BAD_BYTES; ++bi) {
+                    bsl::string str(strings[ti]);
+                    str[pos] = BAD_BYTES[bi];
+
+                    const char *expInvalid = 0;
+                    const bsls::Types::IntPtr EXP =
+                                  referenceNumCodePointsIfValid(&expInvalid,
+                                                                str.data(),
+                                                                str.length());
+
+                    const char *invalid = 0;
+                    const bsls::Types::IntPtr RESULT =
+                                        Obj::numCodePointsIfValid(&invalid,
+                                                                  str.data(),
+                                                                  str.length());
+                    ASSERTV(ti, pos, bi, EXP, RESULT,
+                                            (EXP < 0) == (RESULT < 0));
+                    ASSERTV(ti, pos, bi, EXP < 0 || EXP == RESULT);
+                    ASSERTV(ti, pos, bi, expInvalid == invalid);
+                    ASSERTV(ti, pos, bi,
+                            (EXP >= 0) == Obj::isValid(str.data(),
+                                                       str.length()));
+
+                    // The null-terminated overloads see only the input
+                    // preceding the first null byte.
+
+                    const bsl::size_t nullPos = bsl::strlen(str.c_str());
+
+                    expInvalid = 0;
+                    const bsls::Types::IntPtr EXP_NT =
+                                  referenceNumCodePointsIfValid(&expInvalid,
+                                                                str.data(),
+                                                                nullPos);
+                    invalid = 0;
+                    const bsls::Types::IntPtr RESULT_NT =
+                                   Obj::numCodePointsIfValid(&invalid,
+                                                             str.c_str());
+                    ASSERTV(ti, pos, bi, (EXP_NT < 0) == (RESULT_NT < 0));
+                    ASSERTV(ti, pos, bi, EXP_NT < 0 || EXP_NT == RESULT_NT);
+                    ASSERTV(ti, pos, bi, expInvalid == invalid);
+                }
+            }
+        }
+
+        if (verbose) cout << "Truncated input\n";
+
+        for (bsl::size_t ti = 0; ti < strings.size(); ti += 5) {
+            const bsl::string& STR = strings[ti];
+
+            for (bsl::size_t len = 0; len <= STR.length(); ++len) {
+                const char *expInvalid = 0;
+                const bsls::Types::IntPtr EXP = referenceNumCodePointsIfValid(
+                                                                   &expInvalid,
+                                                                   STR.data(),
+                                                                   len);
+
+                const char *invalid = 0;
+                const bsls::Types::IntPtr RESULT = Obj::numCodePointsIfValid(
+                                                                   &invalid,
+                                                                   STR.data(),
+                                                                   len);
+                ASSERTV(ti, len, EXP, RESULT, (EXP < 0) == (RESULT < 0));
+                ASSERTV(ti, len, EXP, RESULT, EXP < 0 || EXP == RESULT);
+                ASSERTV(ti, len, expInvalid == invalid);
+
+                const bsl::string prefix(STR.data(), len);
+                invalid = 0;
+                const bsls::Types::IntPtr RESULT_NT =
+                                   Obj::numCodePointsIfValid(&invalid,
+                                                             prefix.c_str());
+                ASSERTV(ti, len, (EXP < 0) == (RESULT_NT < 0));
+                ASSERTV(ti, len, EXP < 0 || EXP == RESULT_NT);
+                ASSERTV(ti, len,
+                        0 == expInvalid
+                     || expInvalid - STR.data() == invalid - prefix.data());
+            }
+        }
+
+        if (verbose) cout << "'advanceIfValid' over runs of ASCII\n";
+
+        for (bsl::size_t ti = 0; ti < strings.size(); ti += 11) {
+            const bsl::string&        STR = strings[ti];
+            const bsls::Types::IntPtr NUM = Obj::numCodePointsRaw(
+                                                                STR.data(),
+                                                                STR.length());
+
+            for (bsls::Types::IntPtr n = 0; n <= NUM + 1; ++n) {
+                const char *expResult;
+                const bsls::Types::IntPtr EXP = Obj::advanceRaw(&expResult,
+                                                                STR.data(),
+                                                                STR.length(),
+                                                                n);
+
+                int         status = -1;
+                const char *result = 0;
+                const bsls::Types::IntPtr RESULT = Obj::advanceIfValid(
+                                                                 &status,
+                                                                 &result,
+                                                                 STR.data(),
+                                                                 STR.length(),
+                                                                 n);
+                ASSERTV(ti, n, 0 == status);
+                ASSERTV(ti, n, EXP, RESULT, EXP == RESULT);
+                ASSERTV(ti, n, expResult == result);
+            }
+        }
+      } break;
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -2913,7 +3163,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
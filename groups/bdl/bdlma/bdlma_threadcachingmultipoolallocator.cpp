@@ -0,0 +1,632 @@
+// bdlma_threadcachingmultipoolallocator.cpp                          -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_concurrentpool.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadlocalvariable.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_spinlock.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_limits.h>
+
+#include <new>  // placement 'new'
+
+// IMPLEMENTATION NOTES
+// --------------------
+// Each thread cache holds, for every pool, a singly-linked list (a
+// "magazine") of free blocks threaded through the blocks themselves, and is
+// accessed without synchronization by its owning thread only.  The caches of
+// all threads are also kept on a doubly-linked list, guarded by
+// 'd_cacheMutex', so that the allocator can deallocate them on destruction.
+//
+// 'release' does not touch the caches of other threads (which may be in use
+// by those threads); instead it increments 'd_generation', and each thread
+// empties its cache (without touching the invalidated blocks) upon noticing
+// that the generation recorded in its cache is out of date.  A thread exiting
+// returns the blocks in its cache to the pools only if its generation is
+// current, which is determined under 'd_cacheMutex' (also held by 'release'
+// while incrementing the generation and releasing the pools).
+//
+// A batch of blocks returned by a thread cache is pushed, as a unit, onto the
+// depot of its pool, the first block of the batch holding the link to the
+// next batch and the number of blocks in the batch, and an empty magazine is
+// refilled by popping a whole batch from the depot, if any.  Each such
+// operation takes the spin lock of the depot for a few instructions only.
+// Batches in a depot are invalidated by 'release' along with the pools.
+//
+// Finding the calling thread's cache with 'bslmt::ThreadUtil::getSpecific'
+// costs a function call on every 'allocate' and 'deallocate', which is a
+// significant fraction of the cost of taking a block from a magazine.  On
+// supported platforms, each thread therefore remembers, in thread-local
+// variables, the cache it used most recently and the allocator owning it.
+// The allocator is identified by 'd_id', which is unique within the process,
+// rather than by its address, so that a memo referring to a destroyed
+// allocator never matches an allocator later created at the same address.
+// 'destroyThreadCache' runs on the exiting thread itself, and clears the memo
+// if it refers to the cache being destroyed.
+
+namespace BloombergLP {
+
+namespace {
+
+enum {
+    k_DEFAULT_NUM_POOLS         = 10,
+    k_DEFAULT_MAX_CHUNK_SIZE    = 32,
+    k_DEFAULT_MAX_CACHED_BLOCKS = 32,
+    k_MIN_BLOCK_SIZE            = 8
+};
+
+struct Link {
+    // This 'struct' overlays a free block held in a magazine.
+
+    Link *d_next_p;  // next free block in the magazine
+};
+
+struct Batch {
+    // This 'struct' overlays the first free block of a batch held in a depot.
+    // The blocks of the batch are linked through 'd_link'.
+
+    Link   d_link;         // first block of the batch
+    Batch *d_nextBatch_p;  // next batch in the depot
+    int    d_numBlocks;    // number of blocks in the batch
+};
+
+struct Magazine {
+    // This 'struct' holds the free blocks cached by one thread for one pool.
+
+    Link *d_head_p;     // first free block, or 0 if empty
+    int   d_numBlocks;  // number of blocks in the list
+};
+
+// The source of the unique identifier of each allocator ('0' is not used).
+
+bsls::AtomicOperations::AtomicTypes::Uint64 g_nextId = { 0 };
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(bsls::Types::Uint64, g_memoOwnerId, 0);
+    // identifier of the allocator owning 'g_memoCache', or 0 if none
+
+BSLMT_THREAD_LOCAL_VARIABLE(void *, g_memoCache, 0);
+    // calling thread's most recently used cache
+#endif
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+           // -------------------------------------------------
+           // struct ThreadCachingMultipoolAllocator::ThreadCache
+           // -------------------------------------------------
+
+struct ThreadCachingMultipoolAllocator::ThreadCache {
+    // This 'struct' holds the free blocks cached by a single thread.  The
+    // 'd_magazines' array is allocated with one element per pool of the owning
+    // allocator.
+
+    ThreadCachingMultipoolAllocator *d_owner_p;     // owning allocator
+    ThreadCache                     *d_prev_p;      // previous live cache
+    ThreadCache                     *d_next_p;      // next live cache
+    int                              d_generation;  // owner's generation
+                                                    // when last emptied
+    Magazine                         d_magazines[1];
+                                                    // one magazine per pool
+};
+
+              // -------------------------------------------
+              // struct ThreadCachingMultipoolAllocator::Depot
+              // -------------------------------------------
+
+struct ThreadCachingMultipoolAllocator::Depot {
+    // This 'struct' holds the batches of free blocks returned by thread
+    // caches to a single pool.
+
+    bsls::SpinLock  d_lock;       // guard 'd_batches_p'
+    Batch          *d_batches_p;  // first batch, or 0 if empty
+
+    Depot()
+    : d_lock(bsls::SpinLock::s_unlocked)
+    , d_batches_p(0)
+    {
+    }
+};
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachingMultipoolAllocator::destroyThreadCache(void *cache)
+{
+    ThreadCache                     *c     = static_cast<ThreadCache *>(cache);
+    ThreadCachingMultipoolAllocator *owner = c->d_owner_p;
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    if (g_memoCache == c) {
+        g_memoOwnerId = 0;
+        g_memoCache   = 0;
+    }
+#endif
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&owner->d_cacheMutex);
+
+        if (c->d_generation == owner->d_generation.loadRelaxed()) {
+            for (int i = 0; i < owner->d_numPools; ++i) {
+                owner->flushMagazine(c, i, c->d_magazines[i].d_numBlocks);
+            }
+        }
+
+        if (c->d_prev_p) {
+            c->d_prev_p->d_next_p = c->d_next_p;
+        }
+        else {
+            owner->d_caches_p = c->d_next_p;
+        }
+        if (c->d_next_p) {
+            c->d_next_p->d_prev_p = c->d_prev_p;
+        }
+        --owner->d_numCaches;
+    }
+
+    owner->d_allocAdapter.deallocate(c);
+}
+
+// PRIVATE MANIPULATORS
+void ThreadCachingMultipoolAllocator::initialize(
+                                 bsls::BlockGrowth::Strategy growthStrategy,
+                                 int                         maxBlocksPerChunk)
+{
+    BSLS_ASSERT(1 <= d_numPools);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+    BSLS_ASSERT(1 <= d_maxCachedBlocks);
+
+    BSLMF_ASSERT(sizeof(Batch) <= k_MIN_BLOCK_SIZE + sizeof(Header));
+
+    d_id           = bsls::AtomicOperations::addUint64NvRelaxed(&g_nextId, 1);
+    d_maxBlockSize = k_MIN_BLOCK_SIZE;
+
+    d_pools_p = static_cast<ConcurrentPool *>(
+                      d_allocAdapter.allocate(d_numPools * sizeof *d_pools_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                              d_pools_p,
+                                                              &d_allocAdapter);
+    bslma::AutoDestructor<ConcurrentPool> autoDtor(d_pools_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDtor) {
+        new (d_pools_p + i) ConcurrentPool(d_maxBlockSize + sizeof(Header),
+                                           growthStrategy,
+                                           maxBlocksPerChunk,
+                                           &d_allocAdapter);
+
+        BSLS_ASSERT(d_maxBlockSize <=
+                       bsl::numeric_limits<bsls::Types::size_type>::max() / 2);
+
+        d_maxBlockSize *= 2;
+    }
+
+    d_maxBlockSize /= 2;
+
+    d_depots_p = static_cast<Depot *>(
+                     d_allocAdapter.allocate(d_numPools * sizeof *d_depots_p));
+
+    for (int i = 0; i < d_numPools; ++i) {
+        new (d_depots_p + i) Depot();
+    }
+
+    if (0 != bslmt::ThreadUtil::createKey(&d_cacheKey, &destroyThreadCache)) {
+        BSLS_ASSERT_OPT(0 && "unable to create thread-specific key");
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    autoDtor.release();
+    autoPoolsDeallocator.release();
+}
+
+ThreadCachingMultipoolAllocator::ThreadCache *
+ThreadCachingMultipoolAllocator::createThreadCache()
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                       d_allocAdapter.allocate(sizeof(ThreadCache)
+                                     + (d_numPools - 1) * sizeof(Magazine)));
+
+    cache->d_owner_p = this;
+    cache->d_prev_p  = 0;
+    for (int i = 0; i < d_numPools; ++i) {
+        cache->d_magazines[i].d_head_p    = 0;
+        cache->d_magazines[i].d_numBlocks = 0;
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cacheMutex);
+
+        cache->d_generation = d_generation.loadRelaxed();
+        cache->d_next_p     = d_caches_p;
+        if (d_caches_p) {
+            d_caches_p->d_prev_p = cache;
+        }
+        d_caches_p = cache;
+        ++d_numCaches;
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_cacheKey, cache);
+
+    return cache;
+}
+
+void *ThreadCachingMultipoolAllocator::allocateFromPool(ThreadCache *cache,
+                                                        int          pool)
+{
+    Magazine&       magazine = cache->d_magazines[pool];
+    Depot&          depot    = d_depots_p[pool];
+    ConcurrentPool& source   = d_pools_p[pool];
+
+    BSLS_ASSERT(0 == magazine.d_numBlocks);
+
+    Batch *batch;
+    {
+        bsls::SpinLockGuard guard(&depot.d_lock);
+
+        batch = depot.d_batches_p;
+        if (batch) {
+            depot.d_batches_p = batch->d_nextBatch_p;
+        }
+    }
+
+    if (batch) {
+        BSLS_ASSERT(batch->d_numBlocks <= d_maxCachedBlocks);
+
+        Link *result = &batch->d_link;
+
+        magazine.d_head_p    = result->d_next_p;
+        magazine.d_numBlocks = batch->d_numBlocks - 1;
+
+        return result;                                                // RETURN
+    }
+
+    // Refill the magazine to half of its capacity (plus the block being
+    // returned), so that neither a burst of allocations nor one of
+    // deallocations immediately goes back to the shared pool.  Should
+    // 'source' throw, the blocks obtained so far remain in the magazine.
+
+    const int batchSize = d_maxCachedBlocks / 2 + 1;
+    for (int i = 0; i < batchSize; ++i) {
+        Link *link = static_cast<Link *>(source.allocate());
+
+        link->d_next_p    = magazine.d_head_p;
+        magazine.d_head_p = link;
+        ++magazine.d_numBlocks;
+    }
+
+    Link *result = magazine.d_head_p;
+
+    magazine.d_head_p = result->d_next_p;
+    --magazine.d_numBlocks;
+
+    return result;
+}
+
+void ThreadCachingMultipoolAllocator::flushMagazine(ThreadCache *cache,
+                                                    int          pool,
+                                                    int          numBlocks)
+{
+    Magazine& magazine = cache->d_magazines[pool];
+    Depot&    depot    = d_depots_p[pool];
+
+    BSLS_ASSERT(numBlocks <= magazine.d_numBlocks);
+
+    if (0 == numBlocks) {
+        return;                                                       // RETURN
+    }
+
+    // Detach the first 'numBlocks' blocks of the magazine as a batch.
+
+    Link *last = magazine.d_head_p;
+    for (int i = 1; i < numBlocks; ++i) {
+        last = last->d_next_p;
+    }
+
+    Batch *batch = reinterpret_cast<Batch *>(magazine.d_head_p);
+
+    magazine.d_head_p     = last->d_next_p;
+    magazine.d_numBlocks -= numBlocks;
+
+    last->d_next_p     = 0;
+    batch->d_numBlocks = numBlocks;
+
+    bsls::SpinLockGuard guard(&depot.d_lock);
+
+    batch->d_nextBatch_p = depot.d_batches_p;
+    depot.d_batches_p    = batch;
+}
+
+ThreadCachingMultipoolAllocator::ThreadCache *
+ThreadCachingMultipoolAllocator::lookupThreadCache()
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+
+    if (0 == cache) {
+        cache = createThreadCache();
+    }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_memoOwnerId = d_id;
+    g_memoCache   = cache;
+#endif
+
+    return cache;
+}
+
+inline
+ThreadCachingMultipoolAllocator::ThreadCache *
+ThreadCachingMultipoolAllocator::threadCache()
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    ThreadCache *cache = static_cast<ThreadCache *>(g_memoCache);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(g_memoOwnerId != d_id)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        cache = lookupThreadCache();
+    }
+#else
+    ThreadCache *cache = lookupThreadCache();
+#endif
+
+    const int generation = d_generation.loadRelaxed();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(cache->d_generation !=
+                                                              generation)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The cached blocks were invalidated by 'release'; drop them.
+
+        for (int i = 0; i < d_numPools; ++i) {
+            cache->d_magazines[i].d_head_p    = 0;
+            cache->d_magazines[i].d_numBlocks = 0;
+        }
+        cache->d_generation = generation;
+    }
+    return cache;
+}
+
+// PRIVATE ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::findPool(
+                                             bsls::Types::size_type size) const
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+// CREATORS
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(k_DEFAULT_NUM_POOLS)
+, d_maxCachedBlocks(k_DEFAULT_MAX_CACHED_BLOCKS)
+, d_generation(0)
+, d_caches_p(0)
+, d_numCaches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_maxCachedBlocks(k_DEFAULT_MAX_CACHED_BLOCKS)
+, d_generation(0)
+, d_caches_p(0)
+, d_numCaches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                               int                          numPools,
+                               bsls::BlockGrowth::Strategy  growthStrategy,
+                               int                          maxBlocksPerChunk,
+                               int                          maxCachedBlocks,
+                               bslma::Allocator            *basicAllocator)
+: d_numPools(numPools)
+, d_maxCachedBlocks(maxCachedBlocks)
+, d_generation(0)
+, d_caches_p(0)
+, d_numCaches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(growthStrategy, maxBlocksPerChunk);
+}
+
+ThreadCachingMultipoolAllocator::~ThreadCachingMultipoolAllocator()
+{
+    // Deleting the key first guarantees that 'destroyThreadCache' is not
+    // invoked for any thread exiting after this point.
+
+    bslmt::ThreadUtil::deleteKey(d_cacheKey);
+
+    while (d_caches_p) {
+        ThreadCache *next = d_caches_p->d_next_p;
+        d_allocAdapter.deallocate(d_caches_p);
+        d_caches_p = next;
+    }
+
+    d_blockList.release();
+    for (int i = 0; i < d_numPools; ++i) {
+        d_pools_p[i].release();
+        d_pools_p[i].~ConcurrentPool();
+    }
+    d_allocAdapter.deallocate(d_pools_p);
+    d_allocAdapter.deallocate(d_depots_p);
+}
+
+// MANIPULATORS
+void *ThreadCachingMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    Header *p;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size <= d_maxBlockSize)) {
+        const int    pool     = findPool(size);
+        ThreadCache *cache    = threadCache();
+        Magazine&    magazine = cache->d_magazines[pool];
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(magazine.d_head_p)) {
+            Link *link = magazine.d_head_p;
+
+            magazine.d_head_p = link->d_next_p;
+            --magazine.d_numBlocks;
+            p = reinterpret_cast<Header *>(link);
+        }
+        else {
+            p = static_cast<Header *>(allocateFromPool(cache, pool));
+        }
+        p->d_header.d_poolIdx = pool;
+    }
+    else {
+        // The requested size is large and will not be pooled.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        p = static_cast<Header *>(d_blockList.allocate(size + sizeof(Header)));
+        p->d_header.d_poolIdx = -1;
+    }
+
+    return p + 1;
+}
+
+void ThreadCachingMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header    *h    = static_cast<Header *>(address) - 1;
+    const int  pool = h->d_header.d_poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(-1 == pool)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_blockList.deallocate(h);
+        return;                                                       // RETURN
+    }
+
+    ThreadCache *cache    = threadCache();
+    Magazine&    magazine = cache->d_magazines[pool];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(magazine.d_numBlocks >=
+                                                          d_maxCachedBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Return half of the magazine, but at least one block, so that a
+        // thread that only deallocates amortizes the cost of the shared pool
+        // over many calls.
+
+        const int batchSize = d_maxCachedBlocks / 2;
+        flushMagazine(cache, pool, batchSize ? batchSize : 1);
+    }
+
+    Link *link = reinterpret_cast<Link *>(h);
+
+    link->d_next_p    = magazine.d_head_p;
+    magazine.d_head_p = link;
+    ++magazine.d_numBlocks;
+}
+
+void ThreadCachingMultipoolAllocator::flushThreadCache()
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                 bslmt::ThreadUtil::getSpecific(d_cacheKey));
+
+    if (0 == cache) {
+        return;                                                       // RETURN
+    }
+
+    cache = threadCache();  // drop blocks invalidated by 'release'
+
+    for (int i = 0; i < d_numPools; ++i) {
+        flushMagazine(cache, i, cache->d_magazines[i].d_numBlocks);
+    }
+}
+
+void ThreadCachingMultipoolAllocator::release()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_cacheMutex);
+
+        d_generation.addRelaxed(1);
+        for (int i = 0; i < d_numPools; ++i) {
+            d_depots_p[i].d_batches_p = 0;
+            d_pools_p[i].release();
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_blockList.release();
+}
+
+void ThreadCachingMultipoolAllocator::reserveCapacity(
+                                              bsls::Types::size_type size,
+                                              int                    numBlocks)
+{
+    BSLS_ASSERT(size <= d_maxBlockSize);
+    BSLS_ASSERT(0 <= numBlocks);
+
+    if (size) {
+        d_pools_p[findPool(size)].reserveCapacity(numBlocks);
+    }
+}
+
+// ACCESSORS
+int ThreadCachingMultipoolAllocator::numThreadCaches() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_cacheMutex);
+
+    return d_numCaches;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
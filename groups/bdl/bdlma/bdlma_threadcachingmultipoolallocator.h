@@ -0,0 +1,452 @@
+// bdlma_threadcachingmultipoolallocator.h                            -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingMultipoolAllocator: multipool with thread caches
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides a fully thread-safe managed allocator,
+// 'bdlma::ThreadCachingMultipoolAllocator', that dispenses memory from a
+// configurable number of 'bdlma::ConcurrentPool' objects (each managing blocks
+// of a unique size, the first of 8 bytes and each successive one twice the
+// size of the previous one) in the same manner as a
+// 'bdlma::ConcurrentMultipoolAllocator', but which interposes a small,
+// bounded, per-thread cache of free blocks in front of each pool:
+//..
+//   ,--------------------------------------.
+//  ( bdlma::ThreadCachingMultipoolAllocator )
+//   `--------------------------------------'
+//                      |         ctor/dtor
+//                      |         flushThreadCache
+//                      |         reserveCapacity
+//                      |         maxCachedBlocksPerPool
+//                      |         maxPooledBlockSize
+//                      |         numPools
+//                      |         numThreadCaches
+//                      V
+//          ,-----------------------.
+//         ( bdlma::ManagedAllocator )
+//          `-----------------------'
+//                      |         release
+//                      V
+//             ,----------------.
+//            ( bslma::Allocator )
+//             `----------------'
+//                                allocate
+//                                deallocate
+//..
+// A 'bdlma::ConcurrentPool' is lock-free in the common case, but the head of
+// its free list is a single atomic word that every thread allocating (or
+// deallocating) blocks of the same size must update.  When many threads
+// allocate and deallocate blocks of the same size concurrently, the cache line
+// holding that word is continually transferred between processors, and
+// replenishing the pool serializes all of them on a mutex.  A
+// 'bdlma::ThreadCachingMultipoolAllocator' avoids that traffic for the
+// common, steady-state pattern in which a thread deallocates blocks that it
+// (or another thread) will shortly allocate again.
+//
+///Thread Caches
+///-------------
+// The first time a thread allocates (or deallocates) a pooled block using a
+// 'bdlma::ThreadCachingMultipoolAllocator', a thread cache holding one free
+// list (a "magazine") for each pool is created for that thread.  Thereafter:
+//
+//: o A pooled 'allocate' request takes a block from the calling thread's
+//:   magazine for the appropriate pool, touching no shared state.  If that
+//:   magazine is empty, it is first refilled with a batch of blocks
+//:   previously returned by a thread cache, if any, and otherwise with a batch
+//:   of (up to half of 'maxCachedBlocksPerPool()') blocks taken from the
+//:   shared pool.
+//:
+//: o 'deallocate' of a pooled block places the block in the calling thread's
+//:   magazine for the block's pool.  If that magazine already holds
+//:   'maxCachedBlocksPerPool()' blocks, a batch of (up to half of) those
+//:   blocks is first returned to the shared pool.
+//:
+//: o When a thread exits, every block in its thread cache is returned to the
+//:   shared pools and the thread cache itself is deallocated.
+//
+// A batch of blocks returned by a thread cache is kept whole, on a list (a
+// "depot") associated with the pool, so that returning a batch, or refilling
+// a magazine from one, takes a single, briefly held, lock rather than an
+// atomic operation on the pool for each block.
+//
+// Blocks may be deallocated by a thread other than the one that allocated
+// them; such blocks simply migrate to the deallocating thread's cache and,
+// once that cache is full, back to the shared pool.  Because each magazine is
+// bounded, the memory retained by an idle thread is bounded as well (by
+// 'numPools() * maxCachedBlocksPerPool()' blocks).  A thread that expects to
+// remain idle for a long time may return its cached blocks to the shared pools
+// explicitly by calling 'flushThreadCache'.
+//
+// Requests for blocks larger than 'maxPooledBlockSize()' bypass both the
+// thread caches and the pools, and are satisfied directly by the allocator
+// supplied at construction (as for 'bdlma::ConcurrentMultipoolAllocator').
+//
+// Each 'bdlma::ThreadCachingMultipoolAllocator' object consumes one
+// thread-specific storage key (see 'bslmt::ThreadUtil::createKey') for its
+// lifetime; as the number of such keys available to a process is limited, this
+// allocator is intended for long-lived allocators shared by many threads,
+// rather than for short-lived, per-object allocators.
+//
+///'release' and Destruction
+///-------------------------
+// As with every 'bdlma::ManagedAllocator', 'release' relinquishes all memory
+// currently allocated via the allocator: all outstanding blocks (including
+// those held in thread caches) become invalid.  Thread caches are not
+// traversed by 'release'; instead, each thread discards the (now invalid)
+// contents of its cache the next time it uses the allocator.  The thread
+// caches themselves are allocated from the allocator supplied at construction
+// and are deallocated only when their threads exit, or when the allocator is
+// destroyed.  The behavior is undefined if 'release' is invoked concurrently
+// with any other method of the same object, or if the allocator is destroyed
+// while other threads are still using it.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ThreadCachingMultipoolAllocator' is *fully thread-safe*, meaning
+// any operation on the same object can be safely invoked from any thread
+// (subject to the restrictions on 'release' noted above), provided that the
+// allocator supplied at construction is fully thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Among Worker Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a number of worker threads each repeatedly build and discard
+// small, short-lived containers, all using a single allocator.  Using a
+// 'bdlma::ThreadCachingMultipoolAllocator', each worker recycles the nodes of
+// its own containers without contending with the other workers.
+//
+// First, we define the function executed by each worker thread:
+//..
+//  extern "C" void *workerFunction(void *arg)
+//  {
+//      bslma::Allocator *allocator = static_cast<bslma::Allocator *>(arg);
+//
+//      for (int i = 0; i < 1000; ++i) {
+//          bsl::list<int> list(allocator);
+//
+//          for (int j = 0; j < 100; ++j) {
+//              list.push_back(j);
+//          }
+//      }
+//      return 0;
+//  }
+//..
+// Then, we create the allocator, with 6 pools (covering blocks of up to 256
+// bytes), and run 4 workers that share it:
+//..
+//  bdlma::ThreadCachingMultipoolAllocator allocator(6);
+//
+//  bslmt::ThreadUtil::Handle handles[4];
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::create(&handles[i], workerFunction, &allocator);
+//  }
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//..
+// Finally, we observe that every worker's thread cache was flushed back to
+// the shared pools, and deallocated, as its thread exited:
+//..
+//  assert(0 == allocator.numThreadCaches());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_concurrentallocatoradapter.h>
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+class ConcurrentPool;
+
+                   // =====================================
+                   // class ThreadCachingMultipoolAllocator
+                   // =====================================
+
+class ThreadCachingMultipoolAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol to provide a
+    // fully thread-safe allocator that dispenses memory blocks of varying
+    // sizes from an array of 'ConcurrentPool' objects, fronted by bounded,
+    // per-thread caches of free blocks, so that steady-state allocation and
+    // deallocation by a thread does not contend with other threads.
+
+    // PRIVATE TYPES
+    struct Header {
+        // This 'struct' provides header information for each allocated memory
+        // block.  The header stores the index of the pool used for the memory
+        // allocation, or -1 if the block is not pooled.
+
+        union {
+            int                                 d_poolIdx;  // pool index
+
+            bsls::AlignmentUtil::MaxAlignedType d_dummy;    // force maximum
+                                                            // alignment
+        } d_header;
+    };
+
+    struct ThreadCache;
+        // This 'struct', defined in the implementation file, holds the free
+        // blocks cached by a single thread.
+
+    struct Depot;
+        // This 'struct', defined in the implementation file, holds the
+        // batches of free blocks returned by thread caches to a single pool.
+
+    // DATA
+    ConcurrentPool             *d_pools_p;         // array of memory pools
+
+    Depot                      *d_depots_p;        // array of depots, one per
+                                                   // pool
+
+    int                         d_numPools;        // number of memory pools
+
+    bsls::Types::size_type      d_maxBlockSize;    // largest pooled block
+                                                   // size
+
+    int                         d_maxCachedBlocks; // capacity of each
+                                                   // magazine
+
+    bsls::Types::Uint64         d_id;              // identifies this
+                                                   // allocator to the
+                                                   // calling thread's memo
+                                                   // of its cache
+
+    bsls::AtomicInt             d_generation;      // incremented by
+                                                   // 'release'; invalidates
+                                                   // thread caches
+
+    bslmt::ThreadUtil::Key      d_cacheKey;        // thread-specific key
+                                                   // holding the calling
+                                                   // thread's cache
+
+    ThreadCache                *d_caches_p;        // list of live thread
+                                                   // caches
+
+    int                         d_numCaches;       // number of live thread
+                                                   // caches
+
+    mutable bslmt::Mutex        d_cacheMutex;      // guard 'd_caches_p',
+                                                   // 'd_numCaches', and
+                                                   // 'd_generation' updates
+
+    BlockList                   d_blockList;       // "large" memory blocks
+
+    bslmt::Mutex                d_mutex;           // guard 'd_blockList' and
+                                                   // 'd_allocAdapter'
+
+    ConcurrentAllocatorAdapter  d_allocAdapter;    // thread-safe adapter
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingMultipoolAllocator(const ThreadCachingMultipoolAllocator&);
+    ThreadCachingMultipoolAllocator& operator=(
+                                       const ThreadCachingMultipoolAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static void destroyThreadCache(void *cache);
+        // Return the blocks held by the specified thread 'cache' to the pools
+        // of the allocator owning it, and deallocate 'cache'.  This function
+        // is invoked on thread exit for every thread that created a cache.
+
+    // PRIVATE MANIPULATORS
+    void initialize(bsls::BlockGrowth::Strategy growthStrategy,
+                    int                         maxBlocksPerChunk);
+        // Create the thread-specific key and the pools of this allocator,
+        // each pool using the specified 'growthStrategy' and
+        // 'maxBlocksPerChunk'.
+
+    ThreadCache *createThreadCache();
+        // Create a thread cache for the calling thread, register it with this
+        // allocator, and return its address.
+
+    void *allocateFromPool(ThreadCache *cache, int pool);
+        // Return a block from the specified 'pool', refilling the magazine
+        // for 'pool' in the specified 'cache' (which is owned by the calling
+        // thread) with a batch of blocks from the depot of 'pool' or, if that
+        // depot is empty, from 'pool' itself.  The behavior is undefined
+        // unless that magazine is empty.
+
+    void flushMagazine(ThreadCache *cache, int pool, int numBlocks);
+        // Return the specified 'numBlocks' blocks from the magazine for the
+        // specified 'pool' in the specified 'cache', as a single batch, to the
+        // depot of 'pool'.  The behavior is undefined unless that magazine
+        // holds at least 'numBlocks' blocks.
+
+    ThreadCache *lookupThreadCache();
+        // Return the calling thread's cache, found using the thread-specific
+        // key of this allocator, creating it if it does not exist, and
+        // remember it as the most recently used cache of the calling thread.
+
+    ThreadCache *threadCache();
+        // Return the calling thread's cache, creating it if it does not
+        // exist.  If the cache was invalidated by 'release', empty it first.
+
+    // PRIVATE ACCESSORS
+    int findPool(bsls::Types::size_type size) const;
+        // Return the index of the pool in this allocator for an allocation
+        // request of the specified 'size' (in bytes).
+
+  public:
+    // CREATORS
+    explicit ThreadCachingMultipoolAllocator(
+                                         bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingMultipoolAllocator(
+                                         int               numPools,
+                                         bslma::Allocator *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(
+                              int                          numPools,
+                              bsls::BlockGrowth::Strategy  growthStrategy,
+                              int                          maxBlocksPerChunk,
+                              int                          maxCachedBlocks,
+                              bslma::Allocator            *basicAllocator = 0);
+        // Create a thread-caching multipool allocator.  Optionally specify
+        // 'numPools', indicating the number of internally created
+        // 'ConcurrentPool' objects; the block size of the first pool is 8
+        // bytes, with the block size of each additional pool successively
+        // doubling.  If 'numPools' is not specified, an
+        // implementation-defined number of pools 'N' -- covering memory blocks
+        // ranging in size from '2^3 = 8' to '2^(N+2)' -- are created.  If
+        // 'numPools' is specified, optionally specify a 'growthStrategy'
+        // indicating whether the number of blocks allocated at once when a
+        // pool must be replenished should be fixed or grow geometrically
+        // (starting with 1), a 'maxBlocksPerChunk' indicating the maximum
+        // number of blocks allocated at once, and 'maxCachedBlocks',
+        // indicating the maximum number of free blocks each thread may cache
+        // for each pool.  If those are not specified, geometric growth and
+        // implementation-defined values are used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numPools', '1 <= maxBlocksPerChunk', and
+        // '1 <= maxCachedBlocks'.
+
+    virtual ~ThreadCachingMultipoolAllocator();
+        // Destroy this allocator.  All memory allocated from this allocator,
+        // including the thread caches of threads that have not exited, is
+        // released.  The behavior is undefined if any other thread is using
+        // this allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size > maxPooledBlockSize()', the memory allocation is managed
+        // directly by the underlying allocator, but will be deallocated when
+        // 'release' is called or when this object is destroyed.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this function has no effect.  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object and has not already been deallocated.
+
+    void flushThreadCache();
+        // Return all free blocks cached by the calling thread to the shared
+        // pools of this allocator.  Note that the thread cache itself is
+        // retained, and will be refilled by subsequent use.
+
+    virtual void release();
+        // Relinquish all memory currently allocated via this allocator,
+        // including the free blocks held in every thread's cache.  The
+        // behavior is undefined if this method is invoked concurrently with
+        // any other method of this object.
+
+    void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+        // Reserve memory from this allocator to satisfy memory requests for at
+        // least the specified 'numBlocks' having the specified 'size' (in
+        // bytes) before the pool replenishes.  If 'size' is 0, this method has
+        // no effect.  The behavior is undefined unless
+        // 'size <= maxPooledBlockSize()' and '0 <= numBlocks'.  Note that the
+        // capacity is reserved in the shared pool, not in the calling thread's
+        // cache.
+
+    // ACCESSORS
+    int maxCachedBlocksPerPool() const;
+        // Return the maximum number of free blocks each thread may cache for
+        // each pool of this allocator.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // allocator, i.e., '2 ^ (numPools() + 2)'.
+
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+
+    int numThreadCaches() const;
+        // Return the number of threads that currently have a cache in this
+        // allocator.  Note that the value returned may be out of date by the
+        // time it is examined.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::maxCachedBlocksPerPool() const
+{
+    return d_maxCachedBlocks;
+}
+
+inline
+bsls::Types::size_type
+ThreadCachingMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+int ThreadCachingMultipoolAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
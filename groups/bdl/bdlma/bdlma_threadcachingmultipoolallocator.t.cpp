@@ -0,0 +1,1256 @@
+// bdlma_threadcachingmultipoolallocator.t.cpp                        -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a thread-safe managed allocator that fronts an
+// array of 'bdlma::ConcurrentPool' objects with bounded per-thread caches.
+// The observable effects of the caches are which block addresses are handed
+// out to which thread, which we make deterministic by configuring caches
+// holding a single block per pool [3, 4].  We verify that thread caches are
+// flushed and deallocated on thread exit [4], that 'release' invalidates them
+// and that the destructor reclaims the caches of threads that are still
+// running [5], and finally that the allocator is correct when used by many
+// threads at once, including for blocks deallocated by a thread other than
+// the one that allocated them [6].
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingMultipoolAllocator(bslma::Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int numPools, Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int, Strategy, int, int, Alloc * = 0);
+// [ 5] ~ThreadCachingMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 1] void *allocate(bsls::Types::size_type size);
+// [ 1] void deallocate(void *address);
+// [ 3] void flushThreadCache();
+// [ 5] void release();
+// [ 2] void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+//
+// ACCESSORS
+// [ 2] int maxCachedBlocksPerPool() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 2] int numPools() const;
+// [ 4] int numThreadCaches() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: thread caches are bounded and reuse blocks LIFO
+// [ 4] CONCERN: thread caches are flushed on thread exit
+// [ 6] CONCERN: concurrent use, including cross-thread deallocation
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingMultipoolAllocator Obj;
+typedef bsls::Types::Int64                     Int64;
+typedef bsls::Types::size_type                 size_type;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int nextRandom(unsigned int *state)
+    // Return the next value of the linear congruential generator whose state
+    // is at the specified 'state' address.
+{
+    *state = *state * 1103515245u + 12345u;
+    return (*state >> 8) & 0xffffff;
+}
+
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == bsls::AlignmentUtil::calculateAlignmentOffset(
+                                   address,
+                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+}
+
+struct SingleCallArgs {
+    // This 'struct' holds the arguments of, and the results reported by,
+    // 'allocateAndDeallocate' and 'allocateOnce'.
+
+    bslma::Allocator *d_allocator_p;
+    size_type         d_size;
+    void             *d_address_p;
+    bslmt::Barrier   *d_barrier_p;  // if non-null, wait twice before exiting
+};
+
+extern "C" void *allocateAndDeallocate(void *arg)
+    // Allocate a block of 'd_size' bytes from 'd_allocator_p' of the
+    // 'SingleCallArgs' at the specified 'arg' address, store its address in
+    // 'd_address_p', and deallocate it.  If 'd_barrier_p' is not 0, then wait
+    // on it twice before returning.
+{
+    SingleCallArgs *args = static_cast<SingleCallArgs *>(arg);
+
+    args->d_address_p = args->d_allocator_p->allocate(args->d_size);
+    args->d_allocator_p->deallocate(args->d_address_p);
+
+    if (args->d_barrier_p) {
+        args->d_barrier_p->wait();
+        args->d_barrier_p->wait();
+    }
+    return 0;
+}
+
+extern "C" void *allocateOnce(void *arg)
+    // Allocate a block of 'd_size' bytes from 'd_allocator_p' of the
+    // 'SingleCallArgs' at the specified 'arg' address, and store its address
+    // in 'd_address_p'.
+{
+    SingleCallArgs *args = static_cast<SingleCallArgs *>(arg);
+
+    args->d_address_p = args->d_allocator_p->allocate(args->d_size);
+    return 0;
+}
+
+void runInThread(bslmt::ThreadUtil::ThreadFunction  function,
+                 SingleCallArgs                    *args)
+    // Run the specified 'function' with the specified 'args' in a new thread
+    // and wait for that thread to exit.
+{
+    bslmt::ThreadUtil::Handle handle;
+
+    ASSERT(0 == bslmt::ThreadUtil::create(&handle, function, args));
+    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+}
+
+                          // =======================
+                          // struct StressTestShared
+                          // =======================
+
+struct StressTestShared {
+    // This 'struct' holds the state shared by the threads of the stress test.
+
+    bslma::Allocator     *d_allocator_p;
+    int                   d_numIterations;
+    bslmt::Mutex          d_mutex;       // guard 'd_handOff'
+    bsl::vector<char *>   d_handOff;     // blocks allocated by one thread to
+                                         // be deallocated by another
+    bslmt::Barrier       *d_barrier_p;
+};
+
+struct StressTestArgs {
+    // This 'struct' holds the arguments of 'stressTestThread'.
+
+    StressTestShared *d_shared_p;
+    int               d_threadId;
+    int               d_numErrors;
+};
+
+void fillBlock(char *block, size_type size, int tag)
+    // Write the specified 'size' followed by the specified 'tag' into the
+    // specified 'block', which holds at least 'size' bytes.
+{
+    bsl::memcpy(block, &size, sizeof size);
+    bsl::memset(block + sizeof size, tag, size - sizeof size);
+}
+
+bool checkBlock(const char *block, int tag)
+    // Return 'true' if the specified 'block' was filled by 'fillBlock' with
+    // the specified 'tag', and 'false' otherwise.
+{
+    size_type size;
+    bsl::memcpy(&size, block, sizeof size);
+    for (size_type i = sizeof size; i < size; ++i) {
+        if (static_cast<char>(tag) != block[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+extern "C" void *stressTestThread(void *arg)
+    // Repeatedly allocate, verify, and deallocate blocks of random sizes
+    // using the allocator described by the 'StressTestArgs' at the specified
+    // 'arg' address, handing some blocks off to be deallocated by other
+    // threads.
+{
+    StressTestArgs   *args   = static_cast<StressTestArgs *>(arg);
+    StressTestShared *shared = args->d_shared_p;
+    bslma::Allocator *alloc  = shared->d_allocator_p;
+    unsigned int      state  = args->d_threadId + 1;
+
+    const int TAG = 'A' + args->d_threadId;
+
+    bsl::vector<char *> live;
+
+    shared->d_barrier_p->wait();
+
+    for (int i = 0; i < shared->d_numIterations; ++i) {
+        const unsigned int r = nextRandom(&state);
+
+        if (live.size() < 64 && 0 != r % 3) {
+            // Mostly pooled sizes, occasionally a large one.
+
+            const size_type size = 0 == r % 97
+                                 ? 3000 + r % 2000
+                                 : sizeof(size_type) + r % 500;
+
+            char *block = static_cast<char *>(alloc->allocate(size));
+
+            if (!isMaximallyAligned(block)) {
+                ++args->d_numErrors;
+            }
+            fillBlock(block, size, TAG);
+            live.push_back(block);
+        }
+        else if (!live.empty()) {
+            const bsl::size_t index = r % live.size();
+            char *block = live[index];
+
+            live[index] = live.back();
+            live.pop_back();
+
+            if (!checkBlock(block, TAG)) {
+                ++args->d_numErrors;
+            }
+
+            if (0 == r % 5) {
+                // Hand the block off to another thread.
+
+                bsl::memset(block + sizeof(size_type), 'X', 1);
+                bslmt::LockGuard<bslmt::Mutex> guard(&shared->d_mutex);
+                shared->d_handOff.push_back(block);
+            }
+            else {
+                alloc->deallocate(block);
+            }
+        }
+
+        if (0 == i % 16) {
+            char *block = 0;
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&shared->d_mutex);
+                if (!shared->d_handOff.empty()) {
+                    block = shared->d_handOff.back();
+                    shared->d_handOff.pop_back();
+                }
+            }
+            if (block) {
+                if ('X' != block[sizeof(size_type)]) {
+                    ++args->d_numErrors;
+                }
+                alloc->deallocate(block);
+            }
+        }
+    }
+
+    for (bsl::size_t i = 0; i < live.size(); ++i) {
+        if (!checkBlock(live[i], TAG)) {
+            ++args->d_numErrors;
+        }
+        alloc->deallocate(live[i]);
+    }
+    return 0;
+}
+
+                           // ====================
+                           // struct BenchmarkArgs
+                           // ====================
+
+struct BenchmarkArgs {
+    // This 'struct' holds the arguments of 'benchmarkThread'.
+
+    bslma::Allocator *d_allocator_p;
+    int               d_numIterations;
+    bslmt::Barrier   *d_barrier_p;
+    double            d_elapsed;      // seconds, set by 'benchmarkThread'
+};
+
+extern "C" void *benchmarkThread(void *arg)
+    // Repeatedly allocate and deallocate batches of small blocks using the
+    // allocator described by the 'BenchmarkArgs' at the specified 'arg'
+    // address, and record the elapsed time.
+{
+    enum { k_BATCH = 16 };
+
+    BenchmarkArgs *args = static_cast<BenchmarkArgs *>(arg);
+    void          *blocks[k_BATCH];
+
+    args->d_barrier_p->wait();
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < args->d_numIterations; ++i) {
+        for (int j = 0; j < k_BATCH; ++j) {
+            blocks[j] = args->d_allocator_p->allocate(16 + 8 * (j % 4));
+        }
+        for (int j = 0; j < k_BATCH; ++j) {
+            args->d_allocator_p->deallocate(blocks[j]);
+        }
+    }
+    timer.stop();
+    args->d_elapsed = timer.elapsedTime();
+    return 0;
+}
+
+double runBenchmark(bslma::Allocator *allocator,
+                    int               numThreads,
+                    int               numIterations)
+    // Run 'benchmarkThread' in the specified 'numThreads' threads, each
+    // performing the specified 'numIterations', using the specified
+    // 'allocator', and return the maximum elapsed time (in seconds) of any
+    // thread.
+{
+    bslmt::Barrier                    barrier(numThreads);
+    bsl::vector<BenchmarkArgs>        args(numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    for (int i = 0; i < numThreads; ++i) {
+        args[i].d_allocator_p   = allocator;
+        args[i].d_numIterations = numIterations;
+        args[i].d_barrier_p     = &barrier;
+        args[i].d_elapsed       = 0;
+        bslmt::ThreadUtil::create(&handles[i], benchmarkThread, &args[i]);
+    }
+
+    double elapsed = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+        if (args[i].d_elapsed > elapsed) {
+            elapsed = args[i].d_elapsed;
+        }
+    }
+    return elapsed;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Among Worker Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a number of worker threads each repeatedly build and discard
+// small, short-lived containers, all using a single allocator.  Using a
+// 'bdlma::ThreadCachingMultipoolAllocator', each worker recycles the nodes of
+// its own containers without contending with the other workers.
+//
+// First, we define the function executed by each worker thread:
+//..
+    extern "C" void *workerFunction(void *arg)
+    {
+        bslma::Allocator *allocator = static_cast<bslma::Allocator *>(arg);
+
+        for (int i = 0; i < 1000; ++i) {
+            bsl::list<int> list(allocator);
+
+            for (int j = 0; j < 100; ++j) {
+                list.push_back(j);
+            }
+        }
+        return 0;
+    }
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create the allocator, with 6 pools (covering blocks of up to 256
+// bytes), and run 4 workers that share it:
+//..
+    bdlma::ThreadCachingMultipoolAllocator allocator(6);
+
+    bslmt::ThreadUtil::Handle handles[4];
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::create(&handles[i], workerFunction, &allocator);
+    }
+    for (int i = 0; i < 4; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+//..
+// Finally, we observe that every worker's thread cache was flushed back to
+// the shared pools, and deallocated, as its thread exited:
+//..
+    ASSERT(0 == allocator.numThreadCaches());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT USE
+        //
+        // Concerns:
+        //: 1 Blocks allocated concurrently by many threads are distinct,
+        //:   maximally aligned, and not overwritten while in use.
+        //:
+        //: 2 Blocks may be deallocated by a thread other than the one that
+        //:   allocated them.
+        //:
+        //: 3 No memory is leaked once all threads have exited and the
+        //:   allocator is destroyed.
+        //
+        // Plan:
+        //: 1 Run several threads, each of which repeatedly allocates blocks
+        //:   of random (mostly pooled) sizes, fills each block with a
+        //:   thread-specific pattern, and verifies and deallocates a random
+        //:   live block, occasionally handing it to another thread for
+        //:   deallocation instead.  Use small caches so that batches are
+        //:   frequently exchanged with the shared pools.  (C-1..2)
+        //:
+        //: 2 Verify that all memory is returned to the test allocator.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: concurrent use, including cross-thread deallocation
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CONCURRENT USE" << endl
+                          << "=======================" << endl;
+
+        enum { k_NUM_THREADS = 6 };
+
+        const int CACHE_SIZES[] = { 1, 2, 8, 32 };
+        const int NUM_CACHE_SIZES = sizeof CACHE_SIZES / sizeof *CACHE_SIZES;
+
+        for (int ti = 0; ti < NUM_CACHE_SIZES; ++ti) {
+            const int CACHE_SIZE = CACHE_SIZES[ti];
+
+            if (veryVerbose) { T_ P(CACHE_SIZE) }
+
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(9,
+                       bsls::BlockGrowth::BSLS_GEOMETRIC,
+                       16,
+                       CACHE_SIZE,
+                       &ta);
+
+                bslmt::Barrier   barrier(k_NUM_THREADS);
+                StressTestShared shared;
+                shared.d_allocator_p   = &mX;
+                shared.d_numIterations = 20000;
+                shared.d_barrier_p     = &barrier;
+
+                StressTestArgs            args[k_NUM_THREADS];
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    args[i].d_shared_p  = &shared;
+                    args[i].d_threadId  = i;
+                    args[i].d_numErrors = 0;
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          stressTestThread,
+                                                          &args[i]));
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                    ASSERTV(CACHE_SIZE, i, args[i].d_numErrors,
+                            0 == args[i].d_numErrors);
+                }
+
+                for (bsl::size_t i = 0; i < shared.d_handOff.size(); ++i) {
+                    mX.deallocate(shared.d_handOff[i]);
+                }
+
+                // Only the main thread, if it deallocated any block, still
+                // has a cache.
+
+                const int NUM_CACHES = shared.d_handOff.empty() ? 0 : 1;
+                ASSERTV(CACHE_SIZE, mX.numThreadCaches(),
+                        NUM_CACHES == mX.numThreadCaches());
+            }
+            ASSERTV(CACHE_SIZE, ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'release' AND DESTRUCTOR
+        //
+        // Concerns:
+        //: 1 'release' returns all memory obtained from the underlying
+        //:   allocator, except that used by the pool array and by thread
+        //:   caches.
+        //:
+        //: 2 After 'release', blocks that were in a thread cache are not
+        //:   dispensed again, and the allocator remains usable from every
+        //:   thread.
+        //:
+        //: 3 The destructor reclaims the caches of threads that have not
+        //:   exited, and a thread exiting after the allocator is destroyed
+        //:   does not access it.
+        //:
+        //: 4 A thread using an allocator created at the address of one that
+        //:   it used before, and that was destroyed, does not use the cache it
+        //:   had for the destroyed allocator.
+        //:
+        //: 5 A thread alternating between two allocators uses the cache
+        //:   belonging to each.
+        //
+        // Plan:
+        //: 1 Allocate pooled and large blocks, deallocate some of them into
+        //:   the calling thread's cache, and call 'release'.  Verify the
+        //:   number of blocks in use by the underlying test allocator.  (C-1)
+        //:
+        //: 2 Allocate again from the same pool and verify that the allocation
+        //:   succeeds and that a new chunk was obtained.  (C-2)
+        //:
+        //: 3 Start a thread that allocates and deallocates a block and then
+        //:   waits on a barrier; destroy the allocator while that thread is
+        //:   still waiting, and then let it exit.  Verify that all memory was
+        //:   returned to the test allocator.  (C-3)
+        //:
+        //: 4 Create an allocator in an object buffer, allocate and deallocate
+        //:   a block, and destroy it; create another allocator, having a
+        //:   different test allocator, in the same buffer, and allocate and
+        //:   deallocate a block.  Verify that the second allocator created a
+        //:   cache, and that each test allocator has no blocks in use once
+        //:   its allocator is destroyed.  (C-4)
+        //:
+        //: 5 Alternately allocate from and deallocate to two allocators, and
+        //:   verify that each dispenses the block last returned to it.  (C-5)
+        //
+        // Testing:
+        //   void release();
+        //   ~ThreadCachingMultipoolAllocator();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release' AND DESTRUCTOR" << endl
+                          << "========================" << endl;
+
+        if (verbose) cout << "\nTesting 'release'." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            // Caches of 8 blocks are refilled with 8 / 2 + 1 == 5 blocks, one
+            // chunk at a time.
+
+            Obj mX(4, bsls::BlockGrowth::BSLS_CONSTANT, 5, 8, &ta);
+
+            const Int64 NUM_INITIAL = ta.numBlocksInUse();  // pool array
+
+            void *blocks[10];
+            for (int i = 0; i < 10; ++i) {
+                blocks[i] = mX.allocate(20);
+            }
+            void *large = mX.allocate(1000);
+            (void)large;
+
+            for (int i = 0; i < 5; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(1 == mX.numThreadCaches());
+
+            // pool array, one cache, 2 chunks, one large block
+
+            ASSERTV(ta.numBlocksInUse(),
+                    NUM_INITIAL + 4 == ta.numBlocksInUse());
+
+            mX.release();
+
+            ASSERTV(ta.numBlocksInUse(),
+                    NUM_INITIAL + 1 == ta.numBlocksInUse());
+            ASSERT(1 == mX.numThreadCaches());
+
+            const Int64 NUM_ALLOCS = ta.numAllocations();
+
+            void *p = mX.allocate(20);
+            ASSERT(0 != p);
+            ASSERT(NUM_ALLOCS + 1 == ta.numAllocations());
+            bsl::memset(p, 0xa5, 20);
+
+            // The cache was emptied, so the batch came from the new chunk.
+
+            for (int i = 0; i < 3; ++i) {
+                void *q = mX.allocate(20);
+                ASSERT(p != q);
+                bsl::memset(q, 0x5a, 20);
+            }
+            ASSERT(NUM_ALLOCS + 1 == ta.numAllocations());
+
+            mX.flushThreadCache();
+            mX.release();
+            ASSERT(NUM_INITIAL + 1 == ta.numBlocksInUse());
+
+            // Another thread's cache, invalidated while that thread is
+            // waiting.
+
+            bslmt::Barrier barrier(2);
+            SingleCallArgs args = { &mX, 20, 0, &barrier };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  allocateAndDeallocate,
+                                                  &args));
+            barrier.wait();
+            ASSERT(2 == mX.numThreadCaches());
+            mX.release();
+            barrier.wait();
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERT(1 == mX.numThreadCaches());
+            ASSERTV(ta.numBlocksInUse(),
+                    NUM_INITIAL + 1 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting destructor." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            bslmt::Barrier barrier(2);
+            SingleCallArgs args = { 0, 100, 0, &barrier };
+
+            bslmt::ThreadUtil::Handle handle;
+            {
+                Obj mX(&ta);
+                args.d_allocator_p = &mX;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      allocateAndDeallocate,
+                                                      &args));
+                barrier.wait();
+
+                void *p = mX.allocate(100);
+                mX.deallocate(p);
+                mX.allocate(5000);
+
+                ASSERT(2 == mX.numThreadCaches());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+            barrier.wait();
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting reuse of the address of an allocator."
+                          << endl;
+        {
+            bslma::TestAllocator ta1("first",  veryVeryVeryVerbose);
+            bslma::TestAllocator ta2("second", veryVeryVeryVerbose);
+
+            bsls::ObjectBuffer<Obj> buffer;
+
+            Obj *mX = new (buffer.buffer()) Obj(&ta1);
+            mX->deallocate(mX->allocate(100));
+            ASSERT(1 == mX->numThreadCaches());
+            mX->~Obj();
+            ASSERTV(ta1.numBlocksInUse(), 0 == ta1.numBlocksInUse());
+
+            Obj *mY = new (buffer.buffer()) Obj(&ta2);
+            ASSERT(0 == mY->numThreadCaches());
+            mY->deallocate(mY->allocate(100));
+            ASSERT(1 == mY->numThreadCaches());
+            mY->~Obj();
+            ASSERTV(ta2.numBlocksInUse(), 0 == ta2.numBlocksInUse());
+            ASSERTV(ta1.numBlocksInUse(), 0 == ta1.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting alternating allocators." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&ta);
+                Obj mY(&ta);
+
+                void *p = mX.allocate(24);
+                void *q = mY.allocate(24);
+                ASSERT(p != q);
+
+                for (int i = 0; i < 4; ++i) {
+                    mX.deallocate(p);
+                    mY.deallocate(q);
+                    ASSERT(p == mX.allocate(24));
+                    ASSERT(q == mY.allocate(24));
+                }
+                mX.deallocate(p);
+                mY.deallocate(q);
+
+                ASSERT(1 == mX.numThreadCaches());
+                ASSERT(1 == mY.numThreadCaches());
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD CACHES ARE FLUSHED ON THREAD EXIT
+        //
+        // Concerns:
+        //: 1 A thread cache is created on first use by a thread, and is
+        //:   deallocated when that thread exits.
+        //:
+        //: 2 The blocks held in the cache of an exiting thread are returned to
+        //:   the shared pools.
+        //:
+        //: 3 A block deallocated by a thread remains in that thread's cache,
+        //:   and is not dispensed to another thread, while the thread is
+        //:   running.
+        //
+        // Plan:
+        //: 1 Using an allocator with single-block caches, allocate and
+        //:   deallocate a block in another thread, and verify that the main
+        //:   thread then allocates that same block; verify the number of
+        //:   thread caches and of blocks in use by the underlying allocator.
+        //:   (C-1..2)
+        //:
+        //: 2 Repeat, but have the other thread wait on a barrier before
+        //:   exiting, and verify that the main thread does not receive the
+        //:   block while the other thread is running.  (C-3)
+        //
+        // Testing:
+        //   int numThreadCaches() const;
+        //   CONCERN: thread caches are flushed on thread exit
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "CONCERN: THREAD CACHES ARE FLUSHED ON THREAD EXIT"
+                   << endl
+                   << "================================================="
+                   << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(4, bsls::BlockGrowth::BSLS_CONSTANT, 8, 1, &ta);
+
+            const Int64 NUM_INITIAL = ta.numBlocksInUse();
+
+            ASSERT(0 == mX.numThreadCaches());
+
+            SingleCallArgs args = { &mX, 24, 0, 0 };
+            runInThread(allocateAndDeallocate, &args);
+
+            ASSERT(0 == mX.numThreadCaches());
+            ASSERTV(ta.numBlocksInUse(),
+                    NUM_INITIAL + 1 == ta.numBlocksInUse());  // one chunk
+
+            void *p = mX.allocate(24);
+            ASSERT(args.d_address_p == p);
+            ASSERT(1 == mX.numThreadCaches());
+            mX.deallocate(p);
+
+            bslmt::Barrier barrier(2);
+            args.d_barrier_p = &barrier;
+
+            mX.flushThreadCache();
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  allocateAndDeallocate,
+                                                  &args));
+            barrier.wait();
+            ASSERT(2 == mX.numThreadCaches());
+            ASSERT(p == args.d_address_p);
+
+            void *q = mX.allocate(24);
+            ASSERT(p != q);
+
+            barrier.wait();
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(1 == mX.numThreadCaches());
+
+            void *r = mX.allocate(24);
+            ASSERT(p == r);
+
+            mX.deallocate(q);
+            mX.deallocate(r);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: THREAD CACHES ARE BOUNDED AND REUSE BLOCKS LIFO
+        //
+        // Concerns:
+        //: 1 A block deallocated by a thread is the next block of the same
+        //:   pool allocated by that thread.
+        //:
+        //: 2 Once a magazine holds 'maxCachedBlocksPerPool()' blocks, further
+        //:   deallocations return blocks to the shared pool, where they are
+        //:   available to other threads.
+        //:
+        //: 3 'flushThreadCache' returns all blocks cached by the calling
+        //:   thread to the shared pools.
+        //:
+        //: 4 Refilling an empty magazine obtains a batch of blocks from the
+        //:   shared pool.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of several sizes and verify that
+        //:   the addresses are reused in LIFO order.  (C-1)
+        //:
+        //: 2 Using single-block caches, deallocate two blocks in the main
+        //:   thread and verify that another thread then allocates the first
+        //:   of them.  (C-2)
+        //:
+        //: 3 Deallocate a block into the main thread's cache, call
+        //:   'flushThreadCache', and verify that another thread allocates it.
+        //:   (C-3)
+        //:
+        //: 4 Using a fixed chunk size equal to the refill batch, verify that
+        //:   allocating a batch of blocks obtains exactly one chunk from the
+        //:   underlying allocator.  (C-4)
+        //
+        // Testing:
+        //   void flushThreadCache();
+        //   CONCERN: thread caches are bounded and reuse blocks LIFO
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "CONCERN: THREAD CACHES ARE BOUNDED AND REUSE BLOCKS LIFO"
+                 << endl
+                 << "========================================================"
+                 << endl;
+
+        if (verbose) cout << "\nLIFO reuse." << endl;
+        {
+            Obj mX;
+
+            for (size_type size = 1; size <= mX.maxPooledBlockSize();
+                                                                  size *= 3) {
+                void *p1 = mX.allocate(size);
+                void *p2 = mX.allocate(size);
+                ASSERTV(size, p1 != p2);
+
+                mX.deallocate(p1);
+                mX.deallocate(p2);
+
+                ASSERTV(size, p2 == mX.allocate(size));
+                ASSERTV(size, p1 == mX.allocate(size));
+
+                mX.deallocate(p1);
+                mX.deallocate(p2);
+            }
+        }
+
+        if (verbose) cout << "\nBounded caches." << endl;
+        {
+            Obj mX(4, bsls::BlockGrowth::BSLS_CONSTANT, 8, 1);
+
+            void *p1 = mX.allocate(32);
+            void *p2 = mX.allocate(32);
+
+            mX.deallocate(p1);  // cached
+            mX.deallocate(p2);  // 'p1' returned to the pool, 'p2' cached
+
+            SingleCallArgs args = { &mX, 32, 0, 0 };
+            runInThread(allocateOnce, &args);
+            ASSERT(p1 == args.d_address_p);
+
+            ASSERT(p2 == mX.allocate(32));
+            mX.deallocate(p2);
+            mX.deallocate(args.d_address_p);
+        }
+
+        if (verbose) cout << "\n'flushThreadCache'." << endl;
+        {
+            Obj mX(4, bsls::BlockGrowth::BSLS_CONSTANT, 8, 1);
+
+            mX.flushThreadCache();  // no cache yet
+            ASSERT(0 == mX.numThreadCaches());
+
+            void *p = mX.allocate(16);
+            mX.deallocate(p);
+            mX.flushThreadCache();
+            ASSERT(1 == mX.numThreadCaches());
+
+            SingleCallArgs args = { &mX, 16, 0, 0 };
+            runInThread(allocateOnce, &args);
+            ASSERT(p == args.d_address_p);
+        }
+
+        if (verbose) cout << "\nBatch refill." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+            // Caches of 8 blocks are refilled with 8 / 2 + 1 == 5 blocks.
+
+            Obj mX(4, bsls::BlockGrowth::BSLS_CONSTANT, 5, 8, &ta);
+
+            const Int64 NUM_ALLOCS = ta.numAllocations();
+
+            mX.allocate(8);                                  // cache + chunk
+            ASSERT(NUM_ALLOCS + 2 == ta.numAllocations());
+
+            for (int i = 0; i < 4; ++i) {
+                mX.allocate(8);
+            }
+            ASSERT(NUM_ALLOCS + 2 == ta.numAllocations());
+
+            mX.allocate(8);
+            ASSERT(NUM_ALLOCS + 3 == ta.numAllocations());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'reserveCapacity', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor configures the number of pools (defaulting to
+        //:   10), and the size of the thread caches (defaulting to 32).
+        //:
+        //: 2 'maxPooledBlockSize' is '2 ^ (numPools() + 2)'.
+        //:
+        //: 3 Memory is obtained from the supplied allocator, or from the
+        //:   default allocator if none is supplied.
+        //:
+        //: 4 'reserveCapacity' obtains memory for the requested number of
+        //:   blocks at once, after which allocating that many blocks requests
+        //:   no further memory (other than for the thread cache).
+        //
+        // Plan:
+        //: 1 Create objects using each constructor and verify the accessors
+        //:   and the allocator from which memory is obtained.  (C-1..3)
+        //:
+        //: 2 Reserve capacity and verify, using a test allocator, that
+        //:   subsequent allocations are satisfied without further memory
+        //:   obtained for the pool.  (C-4)
+        //
+        // Testing:
+        //   ThreadCachingMultipoolAllocator(bslma::Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int numPools, Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int, Strategy, int, int, Alloc*);
+        //   void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+        //   int maxCachedBlocksPerPool() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   int numPools() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "CREATORS, 'reserveCapacity', AND ACCESSORS" << endl
+                      << "==========================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(10   == X.numPools());
+            ASSERT(4096 == X.maxPooledBlockSize());
+            ASSERT(32   == X.maxCachedBlocksPerPool());
+            ASSERT(0    <  defaultAllocator.numBlocksInUse());
+
+            mX.deallocate(mX.allocate(4096));
+            mX.deallocate(mX.allocate(4097));
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(10 == X.numPools());
+            ASSERT(32 == X.maxCachedBlocksPerPool());
+            ASSERT(0  <  ta.numBlocksInUse());
+            ASSERT(0  == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        for (int numPools = 1; numPools <= 12; ++numPools) {
+            Obj mX(numPools, &ta);  const Obj& X = mX;
+
+            ASSERTV(numPools, numPools == X.numPools());
+            ASSERTV(numPools,
+                    (size_type(4) << numPools) == X.maxPooledBlockSize());
+            ASSERTV(numPools, 32 == X.maxCachedBlocksPerPool());
+
+            // Largest pooled and smallest non-pooled sizes.
+
+            const size_type MAX = X.maxPooledBlockSize();
+            char *p = static_cast<char *>(mX.allocate(MAX));
+            char *q = static_cast<char *>(mX.allocate(MAX + 1));
+            bsl::memset(p, 1, MAX);
+            bsl::memset(q, 2, MAX + 1);
+            ASSERTV(numPools, isMaximallyAligned(p));
+            ASSERTV(numPools, isMaximallyAligned(q));
+            mX.deallocate(p);
+            mX.deallocate(q);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            Obj mX(3, bsls::BlockGrowth::BSLS_CONSTANT, 4, 7, &ta);
+            const Obj& X = mX;
+
+            ASSERT(3  == X.numPools());
+            ASSERT(32 == X.maxPooledBlockSize());
+            ASSERT(7  == X.maxCachedBlocksPerPool());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'reserveCapacity'." << endl;
+        {
+            Obj mX(4, bsls::BlockGrowth::BSLS_CONSTANT, 1, 4, &ta);
+
+            mX.reserveCapacity(0, 100);  // no effect
+
+            const Int64 NUM_ALLOCS = ta.numAllocations();
+
+            mX.reserveCapacity(20, 30);
+            ASSERT(NUM_ALLOCS + 1 == ta.numAllocations());
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < 30; ++i) {
+                blocks.push_back(mX.allocate(20));
+            }
+            ASSERT(NUM_ALLOCS + 2 == ta.numAllocations());  // + thread cache
+
+            for (int i = 0; i < 30; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate blocks of various sizes, pooled and not pooled, verify
+        //:   that they are distinct and aligned, and deallocate them.
+        //:
+        //: 2 Verify that allocating 0 bytes returns 0, and that deallocating 0
+        //:   has no effect.
+        //:
+        //: 3 Verify that no memory is leaked.
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(0 == mX.numThreadCaches());
+
+            const size_type SIZES[] = { 1, 7, 8, 9, 16, 100, 1000, 4096,
+                                        4097, 10000 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            bsl::vector<char *> blocks;
+            for (int round = 0; round < 3; ++round) {
+                for (int i = 0; i < NUM_SIZES; ++i) {
+                    char *p = static_cast<char *>(mX.allocate(SIZES[i]));
+                    ASSERTV(i, isMaximallyAligned(p));
+                    bsl::memset(p, i, SIZES[i]);
+                    blocks.push_back(p);
+                }
+            }
+            ASSERT(1 == mX.numThreadCaches());
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                for (bsl::size_t j = i + 1; j < blocks.size(); ++j) {
+                    ASSERTV(i, j, blocks[i] != blocks[j]);
+                }
+                const int        I = static_cast<int>(i % NUM_SIZES);
+                const size_type  S = SIZES[I];
+                ASSERTV(i, static_cast<char>(I) == blocks[i][0]);
+                ASSERTV(i, static_cast<char>(I) == blocks[i][S - 1]);
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Steady-state allocation and deallocation from several threads is
+        //:   faster than with 'bdlma::ConcurrentMultipoolAllocator'.
+        //
+        // Plan:
+        //: 1 In 1, 2, 4, and 8 threads, repeatedly allocate and deallocate
+        //:   batches of small blocks, using a
+        //:   'bdlma::ConcurrentMultipoolAllocator' and a
+        //:   'bdlma::ThreadCachingMultipoolAllocator', and report the time
+        //:   taken by each.  The number of iterations per thread may be
+        //:   specified as the second argument.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 200000;
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            bdlma::ConcurrentMultipoolAllocator concurrent;
+            Obj                                 caching;
+
+            const double T1 = runBenchmark(&concurrent,
+                                           numThreads,
+                                           NUM_ITERATIONS);
+            const double T2 = runBenchmark(&caching,
+                                           numThreads,
+                                           NUM_ITERATIONS);
+
+            cout << "threads: " << numThreads
+                 << "\tconcurrent: " << T1 << "s"
+                 << "\tthread-caching: " << T2 << "s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,380 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_deque.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                   // ====================================
+                   // struct WorkStealingThreadPool::Worker
+                   // ====================================
+
+struct WorkStealingThreadPool::Worker {
+    // This 'struct' holds the state of one processing thread of a
+    // 'WorkStealingThreadPool': the queue of jobs enqueued to the thread, and
+    // the mutex guarding it.  The owning thread pops jobs from the front of
+    // 'd_jobs' and other threads steal jobs from the back.
+
+    // DATA
+    bslmt::Mutex    d_mutex;  // protects 'd_jobs'
+
+    bsl::deque<Job> d_jobs;   // pending jobs
+
+    const int       d_index;  // index of this worker in the pool
+
+    // CREATORS
+    Worker(int index, bslma::Allocator *basicAllocator)
+    : d_jobs(basicAllocator)
+    , d_index(index)
+        // Create a 'Worker' having the specified 'index'.  Use the specified
+        // 'basicAllocator' to supply memory.
+    {
+    }
+};
+
+                       // ----------------------------
+                       // class WorkStealingThreadPool
+                       // ----------------------------
+
+// PRIVATE MANIPULATORS
+int WorkStealingThreadPool::doEnqueueJob(bslmf::MovableRef<Job> job)
+{
+    // The outstanding count is incremented *before* 'd_enabled' is checked so
+    // that 'drain', which clears 'd_enabled' and then waits for the
+    // outstanding count to drop to 0, cannot miss a job whose enqueue
+    // operation observed the pool as enabled.
+
+    d_numOutstandingJobs.add(1);
+
+    if (!d_enabled.load()) {
+        jobCompleted();
+        return -1;                                                    // RETURN
+    }
+
+    Worker *worker = static_cast<Worker *>(
+                                bslmt::ThreadUtil::getSpecific(d_workerKey));
+    if (!worker) {
+        worker = d_workers[d_nextWorker.addRelaxed(1) % d_numThreads];
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&worker->d_mutex);
+
+        worker->d_jobs.push_back(bslmf::MovableRefUtil::move(job));
+        d_numPendingJobs.add(1);
+    }
+
+    if (d_numSleeping.load()) {
+        wakeSleepingWorker();
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::jobCompleted()
+{
+    if (0 == d_numOutstandingJobs.add(-1)) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_drainMutex);
+        d_drainCondition.broadcast();
+    }
+}
+
+bool WorkStealingThreadPool::popJob(Job *job, Worker *worker)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&worker->d_mutex);
+
+        if (!worker->d_jobs.empty()) {
+            *job = bslmf::MovableRefUtil::move(worker->d_jobs.front());
+            worker->d_jobs.pop_front();
+            d_numPendingJobs.add(-1);
+            return true;                                              // RETURN
+        }
+    }
+
+    for (int i = 1; i < d_numThreads; ++i) {
+        Worker *victim = d_workers[(worker->d_index + i) % d_numThreads];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&victim->d_mutex);
+
+        if (!victim->d_jobs.empty()) {
+            *job = bslmf::MovableRefUtil::move(victim->d_jobs.back());
+            victim->d_jobs.pop_back();
+            d_numPendingJobs.add(-1);
+            d_numStolenJobs.addRelaxed(1);
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+int WorkStealingThreadPool::startNewThread(Worker *worker)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = d_threadGroup.addThread(
+                    bdlf::BindUtil::bind(&WorkStealingThreadPool::workerThread,
+                                         this,
+                                         worker),
+                    d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_sleepMutex);
+        d_stopFlag = true;
+        d_sleepCondition.broadcast();
+    }
+    d_threadGroup.joinAll();
+}
+
+void WorkStealingThreadPool::wakeSleepingWorker()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_sleepMutex);
+    d_sleepCondition.signal();
+}
+
+void WorkStealingThreadPool::workerThread(Worker *worker)
+{
+    bslmt::ThreadUtil::setSpecific(d_workerKey, worker);
+
+    Job job(bsl::allocator_arg, d_allocator_p);
+    while (1) {
+        if (popJob(&job, worker)) {
+            job();
+
+            // The job has to be destroyed before it is reported as completed,
+            // as it might have bound objects whose lifetime is tied to the
+            // completion of 'drain'.
+
+            job = bsl::nullptr_t();
+            jobCompleted();
+            continue;
+        }
+
+        // No job could be found: sleep until a job is enqueued or the pool is
+        // stopped.  'd_numSleeping' is incremented (under 'd_sleepMutex')
+        // before 'd_numPendingJobs' is examined, and 'doEnqueueJob' increments
+        // 'd_numPendingJobs' before examining 'd_numSleeping', so that either
+        // this thread observes the new job or the enqueuing thread observes
+        // this thread sleeping and signals it.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_sleepMutex);
+
+        d_numSleeping.add(1);
+        while (0 >= d_numPendingJobs.load() && !d_stopFlag) {
+            d_sleepCondition.wait(&d_sleepMutex);
+        }
+        d_numSleeping.add(-1);
+
+        if (d_stopFlag) {
+            break;
+        }
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+}
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void WorkStealingThreadPool::initBlockSet()
+{
+    sigfillset(&d_blockSet);
+
+    static const int synchronousSignals[] = {
+        SIGBUS,
+        SIGFPE,
+        SIGILL,
+        SIGSEGV,
+        SIGSYS,
+        SIGABRT,
+        SIGTRAP,
+    #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+        SIGIOT
+    #endif
+    };
+    static const int SIZE =
+                        sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(&d_blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             bslma::Allocator               *basicAllocator)
+: d_workers(basicAllocator)
+, d_nextWorker(0)
+, d_numPendingJobs(0)
+, d_numOutstandingJobs(0)
+, d_numSleeping(0)
+, d_numStolenJobs(0)
+, d_enabled(0)
+, d_stopFlag(false)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    // Force all threads to be joinable.
+
+    d_threadAttributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    if (0 != rc) {
+        BSLS_ASSERT(0 && "unable to create thread-specific key");
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    d_workers.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(i, d_allocator_p));
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet();
+#endif
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_allocator_p->deleteObjectRaw(d_workers[i]);
+    }
+
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    d_enabled = 0;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_drainMutex);
+    while (d_numOutstandingJobs.load() && isStarted()) {
+        d_drainCondition.wait(&d_drainMutex);
+    }
+}
+
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    Job job(bsl::allocator_arg, d_allocator_p, functor);
+    return doEnqueueJob(bslmf::MovableRefUtil::move(job));
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    BSLS_ASSERT(bslmf::MovableRefUtil::access(functor));
+
+    return doEnqueueJob(bslmf::MovableRefUtil::move(functor));
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    d_enabled = 0;
+
+    // Cancel the queued jobs, destroying them outside of the worker mutexes as
+    // they might have bound objects with non-trivial destructors.
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        bsl::deque<Job> cancelled(d_allocator_p);
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_workers[i]->d_mutex);
+
+            cancelled.swap(d_workers[i]->d_jobs);
+            d_numPendingJobs.add(-static_cast<int>(cancelled.size()));
+        }
+        for (bsl::size_t j = 0; j < cancelled.size(); ++j) {
+            jobCompleted();
+        }
+    }
+
+    // Wait for the active jobs to complete (and for jobs enqueued
+    // concurrently with this call, prior to 'd_enabled' being cleared), then
+    // stop the threads.
+
+    drain();
+    stopThreads();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (!isStarted()) {
+        d_stopFlag = false;
+
+        for (int i = 0; i < d_numThreads; ++i) {
+            if (0 != startNewThread(d_workers[i])) {
+                stopThreads();
+                return -1;                                            // RETURN
+            }
+        }
+    }
+
+    d_enabled = 1;
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    drain();
+    stopThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
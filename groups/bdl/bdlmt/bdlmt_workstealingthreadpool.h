@@ -0,0 +1,470 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size thread pool with per-thread job queues.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: thread pool using work stealing
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that executes user-defined functions
+// ("jobs") on a fixed number of processing threads.  The interface mirrors
+// that of 'bdlmt::ThreadPool' ('enqueueJob', 'drain', 'start', 'stop', and
+// 'shutdown' have the same meaning), but the internal organization is
+// different: instead of a single job queue shared (under one mutex) by every
+// processing thread, each processing thread ("worker") owns its own queue.
+//
+// Jobs are distributed to the workers as follows:
+//
+//: o A job enqueued from a thread that is *not* a worker of the pool is placed
+//:   on the queue of one of the workers, selected in round-robin order.
+//:
+//: o A job enqueued from a worker of the pool (i.e., by a job running on the
+//:   pool) is placed on the queue of that same worker.
+//
+// Each worker processes the jobs from its own queue in FIFO order.  A worker
+// whose queue is empty attempts to "steal" the most recently enqueued job
+// from the queue of another worker before going to sleep.  Consequently, the
+// only synchronization on the common enqueue/dequeue path is a mutex local to
+// one worker, which is contended only when another worker steals from it, and
+// the pool scales with the number of processing threads far better than
+// 'bdlmt::ThreadPool' when jobs are small and numerous.  Sleeping workers are
+// woken only when a job is enqueued while some worker is idle, so that in
+// steady state (all workers busy) enqueuing a job does not touch any shared
+// mutex.
+//
+// Note that, unlike 'bdlmt::ThreadPool', the number of processing threads is
+// fixed at construction and jobs are not guaranteed to be started in the
+// order in which they were enqueued (jobs on the queue of a given worker are
+// started in order, except when one is stolen).
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe* (i.e.,
+// all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// A thread pool ensures that, on unix platforms, all the threads in the pool
+// block all asynchronous signals.  Specifically all the signals, except the
+// following synchronous signals are blocked:
+//..
+//  SIGBUS
+//  SIGFPE
+//  SIGILL
+//  SIGSEGV
+//  SIGSYS
+//  SIGABRT
+//  SIGTRAP
+//  SIGIOT
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Divide-and-Conquer Summation
+///- - - - - - - - - - - - - - - - - - - -
+// In this example we compute the sum of a large array of integers by
+// recursively splitting the array in two halves until each part is small
+// enough to be summed directly.  Every split enqueues a new job from a worker
+// thread, so that jobs are placed on the queue of the splitting worker and
+// idle workers steal them, spreading the work across the pool without
+// contending on a shared queue.
+//
+// First, we define the state shared by all the jobs of one summation: the
+// data to be summed, the accumulated result, and a latch that is released once
+// every element has been accounted for:
+//..
+//  struct SumContext {
+//      bdlmt::WorkStealingThreadPool *d_pool_p;  // pool running the jobs
+//      const int                     *d_data_p;  // data to be summed
+//      bsls::AtomicInt64              d_sum;     // accumulated result
+//      bslmt::Latch                  *d_done_p;  // counts summed elements
+//  };
+//..
+// Then, we define the job, which either sums its range directly or enqueues
+// the upper half of the range as a new job and continues with the lower half:
+//..
+//  void sumRange(SumContext *context, int begin, int end)
+//  {
+//      enum { k_GRAIN = 1024 };
+//
+//      while (end - begin > k_GRAIN) {
+//          int middle = begin + (end - begin) / 2;
+//
+//          int rc = context->d_pool_p->enqueueJob(
+//                  bdlf::BindUtil::bind(&sumRange, context, middle, end));
+//          assert(0 == rc);
+//
+//          end = middle;
+//      }
+//
+//      bsls::Types::Int64 sum = 0;
+//      for (int i = begin; i < end; ++i) {
+//          sum += context->d_data_p[i];
+//      }
+//      context->d_sum.addRelaxed(sum);
+//      context->d_done_p->countDown(end - begin);
+//  }
+//..
+// Next, we create the pool and start its processing threads:
+//..
+//  enum { k_NUM_THREADS = 4, k_NUM_ELEMENTS = 1024 * 1024 };
+//
+//  bdlmt::WorkStealingThreadPool pool(bslmt::ThreadAttributes(),
+//                                     k_NUM_THREADS);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Then, we prepare the data:
+//..
+//  bsl::vector<int> data(k_NUM_ELEMENTS);
+//  for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+//      data[i] = i % 100;
+//  }
+//..
+// Now, we enqueue a single job covering the whole array and wait for every
+// element to be summed:
+//..
+//  bslmt::Latch done(k_NUM_ELEMENTS);
+//
+//  SumContext context;
+//  context.d_pool_p = &pool;
+//  context.d_data_p = data.data();
+//  context.d_done_p = &done;
+//
+//  rc = pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                            &context,
+//                                            0,
+//                                            static_cast<int>(k_NUM_ELEMENTS)));
+//  assert(0 == rc);
+//
+//  done.wait();
+//..
+// Finally, we verify the result and stop the pool:
+//..
+//  bsls::Types::Int64 expected = 0;
+//  for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+//      expected += data[i];
+//  }
+//  assert(expected == context.d_sum);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_csignal.h>              // sigset_t
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+                       // ============================
+                       // class WorkStealingThreadPool
+                       // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a thread pool used for concurrently executing
+    // multiple user-defined functions ("jobs") on a fixed number of threads,
+    // each of which owns a queue of pending jobs and steals jobs from the
+    // queues of the other threads when its own queue is empty.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    struct Worker;
+        // Per-thread state (job queue and the mutex protecting it), defined
+        // in the implementation file.
+
+    // DATA
+    bsl::vector<Worker *>    d_workers;            // per-thread state, owned
+
+    bslmt::ThreadUtil::Key   d_workerKey;          // thread-specific key
+                                                   // holding the 'Worker' of
+                                                   // the calling thread (null
+                                                   // for non-pool threads)
+
+    bsls::AtomicUint         d_nextWorker;         // round-robin index used to
+                                                   // select the worker queue
+                                                   // of jobs enqueued by
+                                                   // non-pool threads
+
+    bsls::AtomicInt          d_numPendingJobs;     // number of jobs queued but
+                                                   // not yet started
+
+    bsls::AtomicInt          d_numOutstandingJobs; // number of jobs queued or
+                                                   // being executed, plus
+                                                   // enqueue attempts in
+                                                   // progress
+
+    bsls::AtomicInt          d_numSleeping;        // number of workers blocked
+                                                   // on 'd_sleepCondition'
+
+    bsls::AtomicInt64        d_numStolenJobs;      // number of jobs executed
+                                                   // by a worker other than
+                                                   // the one they were queued
+                                                   // to
+
+    bsls::AtomicInt          d_enabled;            // 1 if enqueuing jobs is
+                                                   // enabled, 0 otherwise
+
+    bool                     d_stopFlag;           // 'true' if the workers
+                                                   // must exit; protected by
+                                                   // 'd_sleepMutex'
+
+    bslmt::Mutex             d_sleepMutex;         // mutex for idle workers
+
+    bslmt::Condition         d_sleepCondition;     // signaled when a job is
+                                                   // enqueued and a worker is
+                                                   // sleeping, or on stop
+
+    bslmt::Mutex             d_drainMutex;         // mutex for 'drain'
+
+    bslmt::Condition         d_drainCondition;     // signaled when the number
+                                                   // of outstanding jobs drops
+                                                   // to 0
+
+    bslmt::Mutex             d_metaMutex;          // serializes 'start',
+                                                   // 'stop', and 'shutdown'
+
+    bslmt::ThreadGroup       d_threadGroup;        // processing threads
+
+    bslmt::ThreadAttributes  d_threadAttributes;   // thread attributes to be
+                                                   // used when constructing
+                                                   // processing threads
+
+    const int                d_numThreads;         // number of configured
+                                                   // processing threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                 d_blockSet;           // set of signals to be
+                                                   // blocked in managed threads
+#endif
+
+    bslma::Allocator        *d_allocator_p;        // memory allocator (held)
+
+    // PRIVATE MANIPULATORS
+    int doEnqueueJob(bslmf::MovableRef<Job> job);
+        // Push the specified 'job' onto the queue of the worker associated
+        // with the calling thread, or onto the queue of the next worker in
+        // round-robin order if the calling thread is not a worker of this
+        // pool, and wake a sleeping worker if there is one.  Return 0 on
+        // success, and a non-zero value if enqueuing is disabled.
+
+    void jobCompleted();
+        // Record the completion (or cancellation) of a job, and signal
+        // 'd_drainCondition' if no outstanding jobs remain.
+
+    bool popJob(Job *job, Worker *worker);
+        // Load into the specified 'job' the next job from the queue of the
+        // specified 'worker' or, if that queue is empty, a job stolen from
+        // another worker.  Return 'true' if a job was loaded, and 'false'
+        // otherwise.
+
+    int startNewThread(Worker *worker);
+        // Spawn a processing thread for the specified 'worker'.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    void stopThreads();
+        // Instruct the processing threads to exit, and join them.  Note that
+        // this method must be called with 'd_metaMutex' locked.
+
+    void wakeSleepingWorker();
+        // Signal one of the sleeping workers, if any.
+
+    void workerThread(Worker *worker);
+        // Processing thread function for the specified 'worker'.
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    void initBlockSet();
+        // Initialize the set of signals to be blocked in the managed threads.
+#endif
+
+  private:
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Construct a thread pool with the specified 'threadAttributes' and
+        // the specified 'numThreads' number of processing threads.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numThreads'.  Note
+        // that the pool must be started (see 'start') before jobs can be
+        // enqueued.
+
+    ~WorkStealingThreadPool();
+        // Call 'shutdown()' and destroy this thread pool.
+
+    // MANIPULATORS
+    void drain();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete.  Use 'start' to re-enable queuing.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a processing
+        // thread.  If the calling thread is a processing thread of this pool,
+        // 'functor' is placed on the queue of the calling thread.  Return 0 if
+        // enqueued successfully, and a non-zero value if queuing is currently
+        // disabled.  The behavior is undefined unless 'functor' is not
+        // "unset".  See 'bsl::function' for more information on functors.
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a processing
+        // thread.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently disabled.
+
+    void shutdown();
+        // Disable queuing on this thread pool, cancel all queued jobs, and
+        // shut down all processing threads (after all active jobs complete).
+
+    int start();
+        // Enable queuing on this thread pool and spawn the processing threads
+        // if they are not already running.  Return 0 on success, and a
+        // non-zero value otherwise.  If not all the threads were successfully
+        // started, all threads are stopped.
+
+    void stop();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete, then shut down all processing threads.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if queuing is enabled on this thread pool, and
+        // 'false' otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if the processing threads of this thread pool are
+        // running, and 'false' otherwise.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs that are currently queued,
+        // but not yet being processed.
+
+    bsls::Types::Int64 numStolenJobs() const;
+        // Return a snapshot of the number of jobs that were executed by a
+        // processing thread other than the one on whose queue they were
+        // placed.
+
+    int numThreads() const;
+        // Return the number of processing threads of this thread pool.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class WorkStealingThreadPool
+                       // ----------------------------
+
+// MANIPULATORS
+inline
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return 0 != d_enabled.load();
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 WorkStealingThreadPool::numStolenJobs() const
+{
+    return d_numStolenJobs.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,782 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_threadpool.h>  // for performance comparison only
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// A work-stealing thread pool dispatches jobs onto a fixed number of threads,
+// each owning a queue.  We need to test that the pool can be started,
+// stopped, drained, and shut down properly, that every enqueued job is
+// executed exactly once, that jobs enqueued from a processing thread are
+// placed on the queue of that thread, and that idle threads steal jobs from
+// the queues of busy threads.
+//
+// In addition to the positive test cases, a negative test case -1 can be run
+// manually to compare the throughput of fine-grained jobs with that of
+// 'bdlmt::ThreadPool'.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 2] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 2] int enqueueJob(const Job&);
+// [ 5] int enqueueJob(bslmf::MovableRef<Job>);
+// [ 5] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 2] void drain();
+// [ 4] void shutdown();
+// [ 2] int start();
+// [ 4] void stop();
+//
+// ACCESSORS
+// [ 2] bool isEnabled() const;
+// [ 2] bool isStarted() const;
+// [ 4] int numPendingJobs() const;
+// [ 3] bsls::Types::Int64 numStolenJobs() const;
+// [ 2] int numThreads() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: jobs enqueued from a processing thread are stolen
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: fine-grained jobs versus 'bdlmt::ThreadPool'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+typedef Obj::Job                      Job;
+
+// ============================================================================
+//                     HELPER FUNCTIONS AND CLASSES
+// ----------------------------------------------------------------------------
+
+namespace {
+namespace u {
+
+void increment(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    counter->add(1);
+}
+
+extern "C" void incrementCallback(void *counter)
+    // Increment the 'bsls::AtomicInt' addressed by the specified 'counter'.
+{
+    static_cast<bsls::AtomicInt *>(counter)->add(1);
+}
+
+void waitAndIncrement(bslmt::Semaphore *semaphore, bsls::AtomicInt *counter)
+    // Wait on the specified 'semaphore', then increment the specified
+    // 'counter'.
+{
+    semaphore->wait();
+    counter->add(1);
+}
+
+void waitOnBarrier(bslmt::Barrier *barrier)
+    // Wait on the specified 'barrier'.
+{
+    barrier->wait();
+}
+
+void spawnAndWait(Obj *pool, bslmt::Barrier *barrier, int numChildren)
+    // Enqueue the specified 'numChildren' jobs, each waiting on the specified
+    // 'barrier', onto the specified 'pool', and then wait on 'barrier'.  Note
+    // that, since this function is run by a processing thread of 'pool', the
+    // children are placed on the queue of that thread, which is blocked until
+    // all the children are stolen by other threads.
+{
+    for (int i = 0; i < numChildren; ++i) {
+        int rc = pool->enqueueJob(bdlf::BindUtil::bind(&waitOnBarrier,
+                                                       barrier));
+        ASSERT(0 == rc);
+    }
+    barrier->wait();
+}
+
+void enqueueMany(Obj *pool, bsls::AtomicInt *counter, int numJobs)
+    // Enqueue onto the specified 'pool' the specified 'numJobs' jobs, each
+    // incrementing the specified 'counter'.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        int rc = pool->enqueueJob(bdlf::BindUtil::bind(&increment, counter));
+        ASSERT(0 == rc);
+    }
+}
+
+void shutdownPool(Obj *pool)
+    // Call 'shutdown' on the specified 'pool'.
+{
+    pool->shutdown();
+}
+
+void stopPool(Obj *pool)
+    // Call 'stop' on the specified 'pool'.
+{
+    pool->stop();
+}
+
+void spin(bsls::AtomicInt *counter, int numIterations)
+    // Perform the specified 'numIterations' trivial operations, then increment
+    // the specified 'counter'.
+{
+    volatile int x = 0;
+    for (int i = 0; i < numIterations; ++i) {
+        x = x + i;
+    }
+    counter->addRelaxed(1);
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Divide-and-Conquer Summation
+///- - - - - - - - - - - - - - - - - - - -
+// In this example we compute the sum of a large array of integers by
+// recursively splitting the array in two halves until each part is small
+// enough to be summed directly.  Every split enqueues a new job from a worker
+// thread, so that jobs are placed on the queue of the splitting worker and
+// idle workers steal them, spreading the work across the pool without
+// contending on a shared queue.
+//
+// First, we define the state shared by all the jobs of one summation: the
+// data to be summed, the accumulated result, and a latch that is released once
+// every element has been accounted for:
+//..
+    struct SumContext {
+        bdlmt::WorkStealingThreadPool *d_pool_p;  // pool running the jobs
+        const int                     *d_data_p;  // data to be summed
+        bsls::AtomicInt64              d_sum;     // accumulated result
+        bslmt::Latch                  *d_done_p;  // counts summed elements
+    };
+//..
+// Then, we define the job, which either sums its range directly or enqueues
+// the upper half of the range as a new job and continues with the lower half:
+//..
+    void sumRange(SumContext *context, int begin, int end)
+    {
+        enum { k_GRAIN = 1024 };
+
+        while (end - begin > k_GRAIN) {
+            int middle = begin + (end - begin) / 2;
+
+            int rc = context->d_pool_p->enqueueJob(
+                    bdlf::BindUtil::bind(&sumRange, context, middle, end));
+            ASSERT(0 == rc);
+
+            end = middle;
+        }
+
+        bsls::Types::Int64 sum = 0;
+        for (int i = begin; i < end; ++i) {
+            sum += context->d_data_p[i];
+        }
+        context->d_sum.addRelaxed(sum);
+        context->d_done_p->countDown(end - begin);
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Next, we create the pool and start its processing threads:
+//..
+    enum { k_NUM_THREADS = 4, k_NUM_ELEMENTS = 1024 * 1024 };
+
+    bdlmt::WorkStealingThreadPool pool(bslmt::ThreadAttributes(),
+                                       k_NUM_THREADS);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Then, we prepare the data:
+//..
+    bsl::vector<int> data(k_NUM_ELEMENTS);
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        data[i] = i % 100;
+    }
+//..
+// Now, we enqueue a single job covering the whole array and wait for every
+// element to be summed:
+//..
+    bslmt::Latch done(k_NUM_ELEMENTS);
+
+    SumContext context;
+    context.d_pool_p = &pool;
+    context.d_data_p = data.data();
+    context.d_done_p = &done;
+
+    rc = pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                              &context,
+                                              0,
+                                              static_cast<int>(k_NUM_ELEMENTS)));
+    ASSERT(0 == rc);
+
+    done.wait();
+//..
+// Finally, we verify the result and stop the pool:
+//..
+    bsls::Types::Int64 expected = 0;
+    for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+        expected += data[i];
+    }
+    ASSERT(expected == context.d_sum);
+
+    pool.stop();
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING ALTERNATE 'enqueueJob' OVERLOADS
+        //
+        // Concerns:
+        //: 1 A job supplied as a "void function/void pointer" pair is
+        //:   executed with the supplied pointer.
+        //:
+        //: 2 A job supplied as a 'bslmf::MovableRef' is executed, and the
+        //:   source is left in a valid state.
+        //
+        // Plan:
+        //: 1 Enqueue jobs using each overload, drain the pool, and verify the
+        //:   number of executions.  (C-1..2)
+        //
+        // Testing:
+        //   int enqueueJob(bslmf::MovableRef<Job>);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ALTERNATE 'enqueueJob' OVERLOADS" << endl
+                          << "========================================" << endl;
+
+        enum { k_NUM_JOBS = 100 };
+
+        bsls::AtomicInt counter(0);
+
+        Obj mX(bslmt::ThreadAttributes(), 3, &ta);
+        ASSERT(0 == mX.start());
+
+        for (int i = 0; i < k_NUM_JOBS; ++i) {
+            ASSERT(0 == mX.enqueueJob(&u::incrementCallback, &counter));
+
+            Job job(bdlf::BindUtil::bind(&u::increment, &counter));
+            ASSERT(0 == mX.enqueueJob(bslmf::MovableRefUtil::move(job)));
+        }
+
+        mX.drain();
+        ASSERTV(counter, 2 * k_NUM_JOBS == counter);
+
+        ASSERT(0 != mX.enqueueJob(&u::incrementCallback, &counter));
+
+        mX.stop();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'stop' AND 'shutdown'
+        //
+        // Concerns:
+        //: 1 'stop' executes every pending job before stopping the threads.
+        //:
+        //: 2 'shutdown' cancels every pending job, but waits for the active
+        //:   jobs to complete.
+        //:
+        //: 3 Jobs cannot be enqueued once the pool is stopped.
+        //:
+        //: 4 The pool can be restarted after it is stopped.
+        //
+        // Plan:
+        //: 1 Using a single-threaded pool, enqueue a job blocked on a
+        //:   semaphore followed by a number of jobs incrementing a counter.
+        //:   Invoke 'stop' or 'shutdown' from a separate thread, release the
+        //:   blocked job, and verify the counter.  For 'shutdown', release
+        //:   the blocked job only once the pending jobs are cancelled.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify enqueuing fails after the pool is stopped, and succeeds
+        //:   once the pool is restarted.  (C-3..4)
+        //
+        // Testing:
+        //   void shutdown();
+        //   void stop();
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'stop' AND 'shutdown'" << endl
+                          << "=============================" << endl;
+
+        enum { k_NUM_JOBS = 10 };
+
+        for (int shutdownFlag = 0; shutdownFlag < 2; ++shutdownFlag) {
+            bsls::AtomicInt  counter(0);
+            bsls::AtomicInt  blockedCounter(0);
+            bslmt::Semaphore semaphore;
+
+            Obj mX(bslmt::ThreadAttributes(), 1, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                         &u::waitAndIncrement,
+                                                         &semaphore,
+                                                         &blockedCounter)));
+
+            u::enqueueMany(&mX, &counter, k_NUM_JOBS);
+
+            bslmt::ThreadUtil::Handle handle;
+            if (shutdownFlag) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                               &handle,
+                               bdlf::BindUtil::bind(&u::shutdownPool, &mX)));
+
+                while (0 != X.numPendingJobs()) {
+                    bslmt::ThreadUtil::yield();
+                }
+            }
+            else {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                   &handle,
+                                   bdlf::BindUtil::bind(&u::stopPool, &mX)));
+            }
+
+            semaphore.post();
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(shutdownFlag, blockedCounter, 1 == blockedCounter);
+            ASSERTV(shutdownFlag,
+                    counter,
+                    (shutdownFlag ? 0 : k_NUM_JOBS) == counter);
+
+            ASSERT(false == X.isStarted());
+            ASSERT(false == X.isEnabled());
+            ASSERT(0     == X.numPendingJobs());
+            ASSERT(0     != mX.enqueueJob(bdlf::BindUtil::bind(&u::increment,
+                                                                &counter)));
+
+            ASSERT(0 == mX.start());
+            ASSERT(true == X.isStarted());
+
+            counter = 0;
+            u::enqueueMany(&mX, &counter, k_NUM_JOBS);
+            mX.stop();
+            ASSERTV(shutdownFlag, counter, k_NUM_JOBS == counter);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING WORK STEALING
+        //
+        // Concerns:
+        //: 1 Jobs enqueued by a processing thread are placed on the queue of
+        //:   that thread.
+        //:
+        //: 2 Idle threads steal jobs from the queues of busy threads.
+        //:
+        //: 3 'numStolenJobs' reports the number of stolen jobs.
+        //
+        // Plan:
+        //: 1 Enqueue a job that itself enqueues 'N - 1' jobs, where 'N' is
+        //:   the number of threads of the pool, and then blocks on a barrier
+        //:   shared with the 'N - 1' children and the main thread.  Since the
+        //:   children are placed on the queue of the (blocked) parent thread,
+        //:   the barrier can only be passed if the other threads steal the
+        //:   children.  Verify that 'numStolenJobs' is at least 'N - 1'.
+        //:   (C-1..3)
+        //:
+        //: 2 Repeat P-1 several times, and for several pool sizes.
+        //
+        // Testing:
+        //   CONCERN: jobs enqueued from a processing thread are stolen
+        //   bsls::Types::Int64 numStolenJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING WORK STEALING" << endl
+                          << "=====================" << endl;
+
+        for (int numThreads = 2; numThreads <= 8; numThreads *= 2) {
+            Obj mX(bslmt::ThreadAttributes(), numThreads, &ta);
+            const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == X.numStolenJobs());
+
+            enum { k_NUM_ITERATIONS = 10 };
+
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                bslmt::Barrier barrier(numThreads + 1);
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                            &u::spawnAndWait,
+                                                            &mX,
+                                                            &barrier,
+                                                            numThreads - 1)));
+                barrier.wait();
+                mX.drain();
+                ASSERT(0 == mX.start());
+            }
+
+            if (veryVerbose) {
+                P_(numThreads);  P(X.numStolenJobs());
+            }
+
+            ASSERTV(numThreads,
+                    X.numStolenJobs(),
+                    k_NUM_ITERATIONS * (numThreads - 1) <= X.numStolenJobs());
+
+            mX.stop();
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS
+        //
+        // Concerns:
+        //: 1 The pool is constructed stopped and disabled, with the specified
+        //:   number of threads.
+        //:
+        //: 2 'start' starts the threads and enables queuing.
+        //:
+        //: 3 Every job enqueued, concurrently from several threads, is
+        //:   executed exactly once before 'drain' returns.
+        //:
+        //: 4 'drain' disables queuing, but does not stop the threads.
+        //:
+        //: 5 All memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Create pools of various sizes, verify the initial state, start
+        //:   them, and enqueue jobs incrementing a counter from several
+        //:   threads.  Drain the pool and verify the counter and the state of
+        //:   the pool.  (C-1..4)
+        //:
+        //: 2 Verify the default allocator is not used and all memory is
+        //:   released on destruction.  (C-5)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   ~WorkStealingThreadPool();
+        //   int enqueueJob(const Job&);
+        //   void drain();
+        //   int start();
+        //   bool isEnabled() const;
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PRIMARY MANIPULATORS" << endl
+                          << "============================" << endl;
+
+        enum { k_NUM_PRODUCERS = 4, k_NUM_JOBS = 1000 };
+
+        static const int NUM_THREADS[] = { 1, 2, 3, 8 };
+        enum { k_NUM_CONFIGS = sizeof NUM_THREADS / sizeof *NUM_THREADS };
+
+        for (int ti = 0; ti < k_NUM_CONFIGS; ++ti) {
+            const int NT = NUM_THREADS[ti];
+
+            {
+                Obj mX(bslmt::ThreadAttributes(), NT, &ta);
+                const Obj& X = mX;
+
+                ASSERTV(NT, NT    == X.numThreads());
+                ASSERTV(NT, false == X.isStarted());
+                ASSERTV(NT, false == X.isEnabled());
+                ASSERTV(NT, 0     == X.numPendingJobs());
+
+                bsls::AtomicInt counter(0);
+                ASSERTV(NT, 0 != mX.enqueueJob(bdlf::BindUtil::bind(
+                                                               &u::increment,
+                                                               &counter)));
+
+                ASSERTV(NT, 0    == mX.start());
+                ASSERTV(NT, true == X.isStarted());
+                ASSERTV(NT, true == X.isEnabled());
+
+                bslmt::ThreadGroup producers(&ta);
+                ASSERTV(NT, k_NUM_PRODUCERS == producers.addThreads(
+                                          bdlf::BindUtil::bind(&u::enqueueMany,
+                                                               &mX,
+                                                               &counter,
+                                                               k_NUM_JOBS),
+                                          k_NUM_PRODUCERS));
+                producers.joinAll();
+
+                mX.drain();
+
+                ASSERTV(NT, counter, k_NUM_PRODUCERS * k_NUM_JOBS == counter);
+                ASSERTV(NT, true  == X.isStarted());
+                ASSERTV(NT, false == X.isEnabled());
+                ASSERTV(NT, 0     == X.numPendingJobs());
+
+                ASSERTV(NT, 0 == mX.start());
+                ASSERTV(NT, true == X.isEnabled());
+            }
+
+            ASSERTV(NT, 0 == ta.numBlocksInUse());
+        }
+
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, enqueue a few jobs, and stop the pool.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsls::AtomicInt counter(0);
+
+        Obj mX(bslmt::ThreadAttributes(), 4, &ta);
+        ASSERT(0 == mX.start());
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&u::increment,
+                                                           &counter)));
+        }
+
+        mX.stop();
+        ASSERTV(counter, 100 == counter);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: FINE-GRAINED JOBS
+        //
+        // Concerns:
+        //: 1 The throughput of fine-grained jobs enqueued by jobs scales with
+        //:   the number of threads better than that of 'bdlmt::ThreadPool'.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, enqueue a fixed number of
+        //:   short jobs, each of which enqueues further short jobs, onto a
+        //:   'bdlmt::ThreadPool' and a 'bdlmt::WorkStealingThreadPool', and
+        //:   report the elapsed time.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: fine-grained jobs versus 'bdlmt::ThreadPool'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: FINE-GRAINED JOBS" << endl
+                          << "==============================" << endl;
+
+        enum { k_NUM_JOBS = 1000000, k_WORK = 200 };
+
+        const int maxThreads = argc > 2 ? atoi(argv[2]) : 32;
+
+        for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            double          elapsed[2];
+            bsls::AtomicInt counter(0);
+
+            {
+                bdlmt::ThreadPool pool(bslmt::ThreadAttributes(),
+                                       numThreads,
+                                       numThreads,
+                                       1000);
+                pool.start();
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < k_NUM_JOBS; ++i) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&u::spin,
+                                                         &counter,
+                                                         k_WORK));
+                }
+                pool.drain();
+                timer.stop();
+                elapsed[0] = timer.elapsedTime();
+                pool.stop();
+            }
+
+            {
+                Obj pool(bslmt::ThreadAttributes(), numThreads);
+                pool.start();
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < k_NUM_JOBS; ++i) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&u::spin,
+                                                         &counter,
+                                                         k_WORK));
+                }
+                pool.drain();
+                timer.stop();
+                elapsed[1] = timer.elapsedTime();
+                pool.stop();
+            }
+
+            ASSERTV(counter, 2 * k_NUM_JOBS == counter);
+
+            cout << "threads: " << numThreads
+                 << "\tThreadPool: " << elapsed[0]
+                 << "s\tWorkStealingThreadPool: " << elapsed[1] << "s"
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
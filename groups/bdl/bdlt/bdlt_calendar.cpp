@@ -315,16 +315,37 @@ int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
 
     enum { e_SUCCESS = 0, e_FAILURE = 1 };
 
-    int offset = date - firstDate();
-    while (nth) {
-        offset = static_cast<int>(
-                                d_nonBusinessDays.find0AtMinIndex(offset + 1));
-        if (0 > offset) {
-            return e_FAILURE;                                         // RETURN
-        }
-        --nth;
+    const bsl::size_t offset = d_nonBusinessDays.findNth0AtMinIndex(
+                                                    date + 1 - firstDate(),
+                                                    d_nonBusinessDays.length(),
+                                                    nth);
+    if (bdlc::BitArray::k_INVALID_INDEX == offset) {
+        return e_FAILURE;                                             // RETURN
+    }
+    *nextBusinessDay = firstDate() + static_cast<int>(offset);
+
+    return e_SUCCESS;
+}
+
+int Calendar::getPreviousBusinessDay(Date        *previousBusinessDay,
+                                     const Date&  date,
+                                     int          nth) const
+{
+    BSLS_ASSERT(previousBusinessDay);
+    BSLS_ASSERT(Date(1, 1, 1) < date);
+    BSLS_ASSERT(isInRange(date - 1));
+    BSLS_ASSERT(0 < nth);
+
+    enum { e_SUCCESS = 0, e_FAILURE = 1 };
+
+    const bsl::size_t offset = d_nonBusinessDays.findNth0AtMaxIndex(
+                                                            0,
+                                                            date - firstDate(),
+                                                            nth);
+    if (bdlc::BitArray::k_INVALID_INDEX == offset) {
+        return e_FAILURE;                                             // RETURN
     }
-    *nextBusinessDay = firstDate() + offset;
+    *previousBusinessDay = firstDate() + static_cast<int>(offset);
 
     return e_SUCCESS;
 }
@@ -935,7 +935,31 @@ class Calendar {
         // day exists, and a non-zero value (with no effect on
         // 'nextBusinessDay') otherwise.  The behavior is undefined unless
         // 'date + 1' is both a valid 'bdlt::Date' and within the valid range
-        // of this calendar, and '0 < nth'.
+        // of this calendar, and '0 < nth'.  Note that the cost of this method
+        // does not grow with 'nth', since runs of 64 days are skipped by
+        // counting their business days.
+
+    int getPreviousBusinessDay(Date        *previousBusinessDay,
+                               const Date&  date) const;
+        // Load, into the specified 'previousBusinessDay', the date of the
+        // first business day in this calendar preceding the specified 'date'.
+        // Return 0 on success -- i.e., if such a business day exists, and a
+        // non-zero value (with no effect on 'previousBusinessDay') otherwise.
+        // The behavior is undefined unless 'date - 1' is both a valid
+        // 'bdlt::Date' and within the valid range of this calendar.
+
+    int getPreviousBusinessDay(Date        *previousBusinessDay,
+                               const Date&  date,
+                               int          nth) const;
+        // Load, into the specified 'previousBusinessDay', the date of the
+        // specified 'nth' business day in this calendar preceding the
+        // specified 'date'.  Return 0 on success -- i.e., if such a business
+        // day exists, and a non-zero value (with no effect on
+        // 'previousBusinessDay') otherwise.  The behavior is undefined unless
+        // 'date - 1' is both a valid 'bdlt::Date' and within the valid range
+        // of this calendar, and '0 < nth'.  Note that the cost of this method
+        // does not grow with 'nth', since runs of 64 days are skipped by
+        // counting their business days.
 
     Date holiday(int index) const;
         // Return the holiday at the specified 'index' in this calendar.  For
@@ -1712,6 +1736,25 @@ int Calendar::getNextBusinessDay(Date *nextBusinessDay, const Date& date) const
     return e_FAILURE;
 }
 
+inline
+int Calendar::getPreviousBusinessDay(Date        *previousBusinessDay,
+                                     const Date&  date) const
+{
+    BSLS_ASSERT_SAFE(previousBusinessDay);
+    BSLS_ASSERT_SAFE(Date(1, 1, 1) < date);
+    BSLS_ASSERT_SAFE(isInRange(date - 1));
+
+    enum { e_SUCCESS = 0, e_FAILURE = 1 };
+
+    int offset = static_cast<int>(
+                    d_nonBusinessDays.find0AtMaxIndex(0, date - firstDate()));
+    if (0 <= offset) {
+        *previousBusinessDay = firstDate() + offset;
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    return e_FAILURE;
+}
 
 inline
 Date Calendar::holiday(int index) const
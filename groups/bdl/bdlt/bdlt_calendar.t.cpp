@@ -124,6 +124,8 @@ using namespace bsl;
 // [ 4] const Date& firstDate() const;
 // [28] int getNextBusinessDay(Date *nextBusinessDay, const Date& date);
 // [28] int getNextBusinessDay(Date *nBD, const Date& date, int nth);
+// [28] int getPreviousBusinessDay(Date *pBD, const Date& date);
+// [28] int getPreviousBusinessDay(Date *pBD, const Date& date, int nth);
 // [ 4] bdlt::Date holiday(int index) const;
 // [ 4] int holidayCode(const Date& date, int index) const;
 // [11] bool isBusinessDay(const Date& date) const;
@@ -1377,13 +1379,14 @@ int main(int argc, char *argv[])
       } break;
       case 28: {
         // -------------------------------------------------------------------
-        // 'nextBusinessDay' ACCESSORS
-        //   Ensure both of these non-basic accessors properly interpret
+        // 'nextBusinessDay' AND 'previousBusinessDay' ACCESSORS
+        //   Ensure each of these non-basic accessors properly interprets
         //   object state.
         //
         // Concerns:
-        //: 1 Both of these non-basic accessors returns the expected value and
-        //:   correctly loads the supplied 'nextBusinessDay'.
+        //: 1 Each of these non-basic accessors returns the expected value and
+        //:   correctly loads the supplied 'nextBusinessDay' or
+        //:   'previousBusinessDay'.
         //:
         //: 2 Each non-basic accessor method is declared 'const'.
         //:
@@ -1392,14 +1395,17 @@ int main(int argc, char *argv[])
         // Plan:
         //: 1 For a set of 'const' objects created with the generator function,
         //:   compute and store all business days for the calendar.
-        //:   Exhaustively verify the return value and loaded 'nextBusinessDay'
-        //:   using the stored business days.  (C-1..2)
+        //:   Exhaustively verify the return value and loaded
+        //:   'nextBusinessDay' or 'previousBusinessDay' using the stored
+        //:   business days.  (C-1..2)
         //:
         //: 2 Verify defensive checks are triggered for invalid values.  (C-3)
         //
         // Testing:
         //   int getNextBusinessDay(Date *nextBusinessDay, const Date& date);
         //   int getNextBusinessDay(Date *nBD, const Date& date, int nth);
+        //   int getPreviousBusinessDay(Date *pBD, const Date& date);
+        //   int getPreviousBusinessDay(Date *pBD, const Date& date, int nth);
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED  // BDE3.0
         //   Date getNextBusinessDay(const Date& initialDate) const;
         //   Date getNextBusinessDay(const Date& initialDate, int n) const;
@@ -1407,8 +1413,10 @@ int main(int argc, char *argv[])
         // -------------------------------------------------------------------
 
         if (verbose) cout << endl
-                          << "'nextBusinessDay' ACCESSORS" << endl
-                          << "===========================" << endl;
+                          << "'nextBusinessDay' AND 'previousBusinessDay' "
+                          << "ACCESSORS" << endl
+                          << "============================================"
+                          << "=========" << endl;
 
         const char **SPECS = DEFAULT_SPECS;
 
@@ -1486,6 +1494,58 @@ int main(int argc, char *argv[])
                             date,
                             0 != X.getNextBusinessDay(&rv, date, nthTooLarge));
                 }
+
+                // 'nextBusinessDayIndex' is the index in 'businessDay' of the
+                // first business day on or after 'date'.
+
+                int nextBusinessDayIndex = 0;
+
+                for (int offset = 1; offset < X.length(); ++offset) {
+                    const bdlt::Date date = X.firstDate() + offset;
+
+                    if (X.isBusinessDay(date - 1)) {
+                        ++nextBusinessDayIndex;
+                    }
+
+                    bdlt::Date rv;
+
+                    if (0 < nextBusinessDayIndex) {
+                        const bdlt::Date EXP =
+                                         businessDay[nextBusinessDayIndex - 1];
+
+                        ASSERTV(ti,
+                                X,
+                                date,
+                                0 == X.getPreviousBusinessDay(&rv, date));
+                        ASSERTV(ti, date, EXP == rv);
+                    }
+                    else {
+                        ASSERTV(ti,
+                                X,
+                                date,
+                                0 != X.getPreviousBusinessDay(&rv, date));
+                    }
+
+                    for (int tj = 1; tj <= nextBusinessDayIndex; ++tj) {
+                        const bdlt::Date EXP =
+                                        businessDay[nextBusinessDayIndex - tj];
+
+                        ASSERTV(ti,
+                                X,
+                                date,
+                                tj,
+                                0 == X.getPreviousBusinessDay(&rv, date, tj));
+                        ASSERTV(ti, date, EXP == rv);
+                    }
+
+                    ASSERTV(ti,
+                            X,
+                            date,
+                            0 != X.getPreviousBusinessDay(
+                                                   &rv,
+                                                   date,
+                                                   nextBusinessDayIndex + 1));
+                }
             }
         }
 
@@ -1515,6 +1575,30 @@ int main(int argc, char *argv[])
                                              1));
             ASSERT_FAIL(X.getNextBusinessDay(&date, X.firstDate() - 1, 0));
             ASSERT_FAIL(X.getNextBusinessDay(0, X.firstDate() - 1, 1));
+
+            ASSERT_SAFE_FAIL(X.getPreviousBusinessDay(&date,
+                                                      X.lastDate() + 2));
+            ASSERT_SAFE_PASS(X.getPreviousBusinessDay(&date,
+                                                      X.lastDate() + 1));
+            ASSERT_SAFE_PASS(X.getPreviousBusinessDay(&date,
+                                                      X.firstDate() + 1));
+            ASSERT_SAFE_FAIL(X.getPreviousBusinessDay(&date, X.firstDate()));
+            ASSERT_SAFE_FAIL(X.getPreviousBusinessDay(0, X.lastDate() + 1));
+
+            ASSERT_FAIL(X.getPreviousBusinessDay(&date, X.lastDate() + 2, 1));
+            ASSERT_PASS(X.getPreviousBusinessDay(&date, X.lastDate() + 1, 1));
+            ASSERT_PASS(X.getPreviousBusinessDay(&date, X.firstDate() + 1, 1));
+            ASSERT_FAIL(X.getPreviousBusinessDay(&date, X.firstDate(), 1));
+            ASSERT_FAIL(X.getPreviousBusinessDay(&date, X.lastDate() + 1, 0));
+            ASSERT_FAIL(X.getPreviousBusinessDay(0, X.lastDate() + 1, 1));
+
+            Obj mY;  const Obj& Y = gg(&mY, "@0001/1/1 30");
+
+            ASSERT_SAFE_FAIL(Y.getPreviousBusinessDay(&date,
+                                                      bdlt::Date(1, 1, 1)));
+            ASSERT_FAIL(Y.getPreviousBusinessDay(&date,
+                                                 bdlt::Date(1, 1, 1),
+                                                 1));
         }
 
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED  // BDE3.0
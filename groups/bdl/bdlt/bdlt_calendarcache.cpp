@@ -12,13 +12,61 @@ BSLS_IDENT_RCSID(bdlt_calendarcache_cpp,"$Id$ $CSID$")
 #include <bslma_default.h>
 
 #include <bslmt_lockguard.h>
+#include <bslmt_threadgroup.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_climits.h>      // 'INT_MAX'
 
 namespace BloombergLP {
 namespace bdlt {
+namespace {
+
+class PrefetchJob {
+    // This class provides a function object that repeatedly claims the next
+    // unclaimed name in a list of calendar names and fetches the identified
+    // calendar into a calendar cache, until no names remain.
+
+    // DATA
+    CalendarCache                  *d_cache_p;        // cache to populate
+    const bsl::vector<bsl::string> *d_names_p;        // names to fetch
+    bsls::AtomicInt                *d_nextIndex_p;    // next unclaimed name
+    bsls::AtomicInt                *d_numFailures_p;  // failed loads
+
+  public:
+    // CREATORS
+    PrefetchJob(CalendarCache                  *cache,
+                const bsl::vector<bsl::string> *names,
+                bsls::AtomicInt                *nextIndex,
+                bsls::AtomicInt                *numFailures)
+        // Create a job that fetches the specified 'names' into the specified
+        // 'cache', claiming names using the specified 'nextIndex' and
+        // counting failed loads in the specified 'numFailures'.
+    : d_cache_p(cache)
+    , d_names_p(names)
+    , d_nextIndex_p(nextIndex)
+    , d_numFailures_p(numFailures)
+    {
+    }
+
+    // ACCESSORS
+    void operator()() const
+        // Fetch calendars until every name has been claimed.
+    {
+        const int numNames = static_cast<int>(d_names_p->size());
+
+        int index;
+        while ((index = d_nextIndex_p->add(1) - 1) < numNames) {
+            if (!d_cache_p->getCalendar((*d_names_p)[index].c_str())) {
+                ++*d_numFailures_p;
+            }
+        }
+    }
+};
+
+}  // close unnamed namespace
 
                         // -------------------------
                         // class CalendarCache_Entry
@@ -196,6 +244,37 @@ int CalendarCache::invalidateAll()
     return numInvalidated;
 }
 
+int CalendarCache::prefetch(const bsl::vector<bsl::string>& calendarNames,
+                            int                             numThreads)
+{
+    BSLS_ASSERT(0 < numThreads);
+
+    bsls::AtomicInt nextIndex(0);
+    bsls::AtomicInt numFailures(0);
+
+    const PrefetchJob job(this, &calendarNames, &nextIndex, &numFailures);
+
+    const int numNames        = static_cast<int>(calendarNames.size());
+    const int numExtraThreads = bsl::min(numThreads, numNames) - 1;
+
+    if (0 < numExtraThreads) {
+        // The calling thread participates, so the prefetch completes even if
+        // no additional thread can be created.
+
+        bslmt::ThreadGroup threadGroup(d_allocator_p);
+        threadGroup.addThreads(job, numExtraThreads);
+
+        job();
+
+        threadGroup.joinAll();
+    }
+    else {
+        job();
+    }
+
+    return numFailures;
+}
+
 // ACCESSORS
 bsl::shared_ptr<const Calendar>
 CalendarCache::lookupCalendar(const char *calendarName) const
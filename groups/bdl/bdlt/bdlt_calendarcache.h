@@ -10,7 +10,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 // bdlt::CalendarCache: cache for read-only calendars that are loaded on demand
 //
-//@SEE_ALSO: bdlt_calendar, bdlt_calendarloader
+//@SEE_ALSO: bdlt_calendar, bdlt_calendarloader, bdlt_snapshotcalendarloader
 //
 //@DESCRIPTION: This component defines the 'bdlt::CalendarCache' class, a cache
 // for read-only 'bdlt::Calendar' objects.  The 'bdlt::CalendarCache' class
@@ -54,6 +54,20 @@ BSLS_IDENT("$Id: $")
 // 'bsl::shared_ptr<const bdlt::Calendar>' is returned if the requested
 // calendar is found to have expired.
 //
+///Prefetching
+///-----------
+// An application that is known to need many calendars can load them into the
+// cache in bulk using the 'prefetch' manipulator, which loads each calendar in
+// a list of names that is not already present in the cache (as if by
+// 'getCalendar'), distributing the loads over a specified number of threads.
+// Calendars are loaded without holding the lock that guards the cache, so the
+// loads performed by separate threads proceed concurrently; consequently, the
+// loader supplied at construction must support concurrent calls to its 'load'
+// method if more than one thread is requested.  See
+// 'bdlt_snapshotcalendarloader' for a calendar loader that supports concurrent
+// use and that serves calendars from a binary snapshot (e.g., a memory-mapped
+// file) without parsing.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlt::CalendarCache' class is fully thread-safe (see 'bsldoc_glossary')
@@ -262,6 +276,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_map.h>
 #include <bsl_memory.h>  // 'bsl::shared_ptr'
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -454,6 +469,21 @@ class CalendarCache {
         // via earlier calls to the 'getCalendar' and 'lookupCalendar' methods,
         // until all of those references have been destroyed.
 
+    int prefetch(const bsl::vector<bsl::string>& calendarNames,
+                 int                             numThreads = 1);
+        // Load into this calendar cache, using the loader that was supplied
+        // at construction, each calendar identified by the specified
+        // 'calendarNames' that is not already present in the cache or that
+        // has expired (i.e., per a timeout optionally supplied at
+        // construction), distributing the loads over at most the optionally
+        // specified 'numThreads' threads, including the calling thread.
+        // Return the number of elements of 'calendarNames' for which the
+        // loader failed.  The behavior is undefined unless '0 < numThreads',
+        // and the loader supports concurrent calls to 'load' if
+        // '1 < numThreads'.  Note that fewer than 'numThreads' threads are
+        // used if 'calendarNames' has fewer than 'numThreads' elements or if a
+        // thread cannot be created.
+
     // ACCESSORS
     bsl::shared_ptr<const Calendar>
     lookupCalendar(const char *calendarName) const;
@@ -9,16 +9,22 @@ BSLS_IDENT_RCSID(bdlt_calendarutil_cpp,"$Id$ $CSID$")
 
 namespace BloombergLP {
 namespace bdlt {
-
-                           // ===================
-                           // struct CalendarUtil
-                           // ===================
-
-int CalendarUtil::addBusinessDaysIfValid(
-                                        bdlt::Date            *result,
-                                        const bdlt::Date&      original,
-                                        const bdlt::Calendar&  calendar,
-                                        int                    numBusinessDays)
+namespace {
+
+int shiftBusinessDays(bdlt::Date            *result,
+                      const bdlt::Date&      original,
+                      const bdlt::Calendar&  calendar,
+                      unsigned int           numBusinessDays,
+                      bool                   isForward)
+    // Load, into the specified 'result', the date that is the specified
+    // 'numBusinessDays' business days after the specified 'original' date, if
+    // the specified 'isForward' is 'true', or before 'original' otherwise,
+    // according to the specified 'calendar', where the first business day on
+    // or after (or on or before) 'original' is reached after 0 business days
+    // if 'original' is a business day and after 1 business day otherwise.
+    // Return 0 on success, and a non-zero value, without modifying '*result',
+    // if either 'original' or the resulting date is not within the valid
+    // range of 'calendar'.
 {
     BSLS_ASSERT(result);
 
@@ -28,50 +34,74 @@ int CalendarUtil::addBusinessDaysIfValid(
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    unsigned int absNumBusDays = numBusinessDays >= 0
-                               ? numBusinessDays
-                               : -numBusinessDays;
-
-    // declare forward and reverse iterators
-
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
-
-    if (numBusinessDays < 0) {
-        // an iterator to the business day on or before original
+    if (calendar.isBusinessDay(original)) {
+        if (0 == numBusinessDays) {
+            *result = original;
+            return e_SUCCESS;                                         // RETURN
+        }
+    }
+    else if (0 == numBusinessDays) {
+        numBusinessDays = 1;
+    }
 
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
+    // A calendar cannot have more business days than it has days, and
+    // rejecting larger counts here keeps 'numBusinessDays' within the range
+    // of 'int'.
 
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
+    if (numBusinessDays > static_cast<unsigned int>(calendar.length())) {
+        return e_OUT_OF_RANGE;                                        // RETURN
+    }
 
-        if (rit == calendar.rendBusinessDays()) {
+    if (isForward) {
+        if (calendar.lastDate() == original) {
             return e_OUT_OF_RANGE;                                    // RETURN
         }
 
-        *result = *rit;
+        return calendar.getNextBusinessDay(
+                                        result,
+                                        original,
+                                        static_cast<int>(numBusinessDays))
+               ? e_OUT_OF_RANGE
+               : e_SUCCESS;                                           // RETURN
     }
-    else {
-        // an iterator to the business day on or after 'original'
 
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
+    if (calendar.firstDate() == original) {
+        return e_OUT_OF_RANGE;                                        // RETURN
+    }
 
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
+    return calendar.getPreviousBusinessDay(result,
+                                           original,
+                                           static_cast<int>(numBusinessDays))
+           ? e_OUT_OF_RANGE
+           : e_SUCCESS;
+}
 
-        if (fit == calendar.endBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
+}  // close unnamed namespace
 
-        *result = *fit;
-    }
+                           // ===================
+                           // struct CalendarUtil
+                           // ===================
 
-    return e_SUCCESS;
+int CalendarUtil::addBusinessDaysIfValid(
+                                        bdlt::Date            *result,
+                                        const bdlt::Date&      original,
+                                        const bdlt::Calendar&  calendar,
+                                        int                    numBusinessDays)
+{
+    BSLS_ASSERT(result);
+
+    // Negate as 'unsigned int' so that 'INT_MIN' is handled.
+
+    const unsigned int absNumBusDays =
+                            numBusinessDays >= 0
+                            ? static_cast<unsigned int>(numBusinessDays)
+                            : 0u - static_cast<unsigned int>(numBusinessDays);
+
+    return shiftBusinessDays(result,
+                             original,
+                             calendar,
+                             absNumBusDays,
+                             numBusinessDays >= 0);
 }
 
 int CalendarUtil::nthBusinessDayOfMonthOrMaxIfValid(
@@ -98,63 +128,45 @@ int CalendarUtil::nthBusinessDayOfMonthOrMaxIfValid(
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    bdlt::Date countStart = (n > 0 ? monthStart : monthEnd);
+    const int numBusinessDays = calendar.numBusinessDays(monthStart,
+                                                         monthEnd);
 
-    if (n < 0) {
-        // Create an iterator to the business day on or before 'countStart'.
+    // The 'calendar' must have at least one business day in the specified
+    // month.
 
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                       calendar.rbeginBusinessDays(countStart);
-        ++n;
-
-        // The 'calendar' must have at least one business day in the specified
-        // month and the whole month must be in the valid range if the
-        // 'calendar'.
+    if (0 == numBusinessDays) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
 
-        if (rit == calendar.rendBusinessDays() || *rit < monthStart) {
-            return e_NOT_FOUND;                                       // RETURN
-        }
+    // Clamp 'abs(n)' to the number of business days in the month, negating
+    // only once 'n' is known to be greater than 'INT_MIN'.
 
-        while (n < 0) {
-            ++rit;
+    const int nth = n > 0
+                  ? (n < numBusinessDays ? n : numBusinessDays)
+                  : (n > -numBusinessDays ? -n : numBusinessDays);
 
-            if (rit == calendar.rendBusinessDays() || *rit < monthStart ) {
-                --rit;
-                break;
-            }
+    // Count from 'countStart', which is the first counted business day if it
+    // is a business day.  Note that 'countStart + 1' and 'countStart - 1'
+    // are within the month, and so within the valid range of 'calendar'.
 
-            ++n;
-        }
+    const bdlt::Date countStart = n > 0 ? monthStart : monthEnd;
+    const int        numToSkip  = calendar.isBusinessDay(countStart)
+                                ? nth - 1
+                                : nth;
 
-        *result = *rit;
+    if (0 == numToSkip) {
+        *result = countStart;
     }
     else {
-        // Create an iterator to the business day on or after 'countStart'.
-
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                        calendar.beginBusinessDays(countStart);
-        --n;
-
-        // The 'calendar' must have at least one business day in the specified
-        // month and the whole month must be in the valid range if the
-        // 'calendar'.
-
-        if (fit == calendar.endBusinessDays() || *fit > monthEnd) {
-            return e_NOT_FOUND;                                       // RETURN
-        }
-
-        while (n > 0) {
-            ++fit;
-
-            if (fit == calendar.endBusinessDays() || *fit > monthEnd) {
-                --fit;
-                break;
-            }
-
-            --n;
-        }
-
-        *result = *fit;
+        const int rc = n > 0
+                     ? calendar.getNextBusinessDay(result,
+                                                   countStart,
+                                                   numToSkip)
+                     : calendar.getPreviousBusinessDay(result,
+                                                       countStart,
+                                                       numToSkip);
+        BSLS_ASSERT(0 == rc);
+        (void)rc;
     }
 
     return e_SUCCESS;
@@ -350,56 +362,18 @@ int CalendarUtil::subtractBusinessDaysIfValid(
 {
     BSLS_ASSERT(result);
 
-    enum { e_SUCCESS = 0, e_OUT_OF_RANGE = 1 };
-
-    if (!calendar.isInRange(original)) {
-        return e_OUT_OF_RANGE;                                        // RETURN
-    }
-
-    unsigned int absNumBusDays = numBusinessDays >= 0
-                               ? numBusinessDays
-                               : -numBusinessDays;
+    // Negate as 'unsigned int' so that 'INT_MIN' is handled.
 
-    // declare forward and reverse iterators
+    const unsigned int absNumBusDays =
+                            numBusinessDays >= 0
+                            ? static_cast<unsigned int>(numBusinessDays)
+                            : 0u - static_cast<unsigned int>(numBusinessDays);
 
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
-
-    if (numBusinessDays >= 0) {
-        // an iterator to the business day on or before original
-
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
-
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
-
-        if (rit == calendar.rendBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
-
-        *result = *rit;
-    }
-    else {
-        // an iterator to the business day on or after 'original'
-
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
-
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
-
-        if (fit == calendar.endBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
-
-        *result = *fit;
-    }
-
-    return e_SUCCESS;
+    return shiftBusinessDays(result,
+                             original,
+                             calendar,
+                             absNumBusDays,
+                             numBusinessDays < 0);
 }
 
 }  // close package namespace
@@ -3,6 +3,7 @@
 
 #include <bdlt_calendar.h>
 #include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
 
 #include <bslim_testutil.h>
 
@@ -14,11 +15,15 @@
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
+#include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_set.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace BloombergLP::bdlt;
@@ -231,6 +236,89 @@ int getStartDate(const char *input)
     return 999;
 }
 
+bdlt::Calendar makeLongCalendar(int firstYear, int lastYear)
+    // Return a calendar whose valid range is every day of the years from the
+    // specified 'firstYear' to the specified 'lastYear' (inclusive), having
+    // Saturday and Sunday as weekend days, and having as holidays January 1,
+    // July 4, and December 25 of each year, as well as every 37th day of the
+    // valid range.  The behavior is undefined unless
+    // '1 <= firstYear <= lastYear <= 9999'.
+{
+    bdlt::Calendar result(bdlt::Date(firstYear,  1,  1),
+                          bdlt::Date(lastYear,  12, 31));
+
+    result.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+    result.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+
+    for (int year = firstYear; year <= lastYear; ++year) {
+        result.addHoliday(bdlt::Date(year,  1,  1));
+        result.addHoliday(bdlt::Date(year,  7,  4));
+        result.addHoliday(bdlt::Date(year, 12, 25));
+    }
+
+    for (int offset = 0; offset < result.length(); offset += 37) {
+        result.addHoliday(result.firstDate() + offset);
+    }
+
+    return result;
+}
+
+int addBusinessDaysByIteration(bdlt::Date            *result,
+                               const bdlt::Date&      original,
+                               const bdlt::Calendar&  calendar,
+                               int                    numBusinessDays)
+    // Load, into the specified 'result', the date that is the specified
+    // 'numBusinessDays' after the specified 'original' date according to the
+    // specified 'calendar' by stepping a business-day iterator one business
+    // day at a time.  Return 0 on success, and a non-zero value, without
+    // modifying '*result', otherwise.  Note that this function is an
+    // inefficient but reliable oracle for 'addBusinessDaysIfValid'.
+{
+    if (!calendar.isInRange(original)) {
+        return 1;                                                     // RETURN
+    }
+
+    const unsigned int absNumBusDays =
+                            numBusinessDays >= 0
+                            ? static_cast<unsigned int>(numBusinessDays)
+                            : 0u - static_cast<unsigned int>(numBusinessDays);
+
+    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
+
+    if (numBusinessDays < 0) {
+        bdlt::Calendar::BusinessDayConstReverseIterator rit =
+                                         calendar.rbeginBusinessDays(original);
+
+        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
+            ++rit;
+            ++count;
+        }
+
+        if (rit == calendar.rendBusinessDays()) {
+            return 1;                                                 // RETURN
+        }
+
+        *result = *rit;
+    }
+    else {
+        bdlt::Calendar::BusinessDayConstIterator fit =
+                                          calendar.beginBusinessDays(original);
+
+        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
+            ++fit;
+            ++count;
+        }
+
+        if (fit == calendar.endBusinessDays()) {
+            return 1;                                                 // RETURN
+        }
+
+        *result = *fit;
+    }
+
+    return 0;
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -328,14 +416,21 @@ int main(int argc, char *argv[])
         //:   result unchanged, otherwise the expected value is loaded into the
         //:   result and success indicated in return value.
         //:
-        //: 2 QoI: Asserted precondition violations are detected when enabled.
+        //: 2 Counts spanning many years, and counts of 'INT_MAX' and
+        //:   'INT_MIN', are handled.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
         //
         // Plan:
         //: 1 Use the table-driven approach, define a representative set of
         //:   valid and invalid inputs to address the above concerns. (C-1)
         //:
-        //: 2 Verify that, in appropriate build modes, defensive checks are
-        //:   triggered for argument values.  (C-2)
+        //: 2 For a calendar spanning 30 years, and for a variety of original
+        //:   dates and counts, verify that the results of both functions
+        //:   match those of 'addBusinessDaysByIteration'.  (C-1..2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for argument values.  (C-3)
         //
         // Testing:
         //   int addBusinessDays(bdlt::Date *result, orig, cdr, num);
@@ -510,6 +605,51 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) cout << "\nTesting long ranges." << endl;
+        {
+            const bdlt::Calendar calendar = makeLongCalendar(2000, 2029);
+
+            const int COUNTS[] = {
+                0,     1,     2,     5,    63,    64,    65,   250,  1000,
+                7000,  7500,  7900,  8000,  INT_MAX,
+                -1,    -2,    -5,   -63,   -64,   -65,  -250, -1000,
+               -7000, -7500, -7900, -8000,  INT_MIN
+            };
+            const int NUM_COUNTS = sizeof COUNTS / sizeof *COUNTS;
+
+            for (int offset = -1; offset <= calendar.length(); offset += 13) {
+                const bdlt::Date ORIGINAL = calendar.firstDate() + offset;
+
+                for (int ti = 0; ti < NUM_COUNTS; ++ti) {
+                    const int NUMDAYS = COUNTS[ti];
+
+                    bdlt::Date EXP = ORIGIN - 5;
+                    const int  RET = addBusinessDaysByIteration(&EXP,
+                                                                ORIGINAL,
+                                                                calendar,
+                                                                NUMDAYS);
+
+                    bdlt::Date result = ORIGIN - 5;
+                    ASSERTV(ORIGINAL, NUMDAYS, RET ==
+                                     Util::addBusinessDaysIfValid(&result,
+                                                                  ORIGINAL,
+                                                                  calendar,
+                                                                  NUMDAYS));
+                    ASSERTV(ORIGINAL, NUMDAYS, EXP, result, EXP == result);
+
+                    if (0 != NUMDAYS && INT_MIN != NUMDAYS) {
+                        result = ORIGIN - 5;
+                        ASSERTV(ORIGINAL, NUMDAYS, RET ==
+                                Util::subtractBusinessDaysIfValid(&result,
+                                                                  ORIGINAL,
+                                                                  calendar,
+                                                                  -NUMDAYS));
+                        ASSERTV(ORIGINAL, NUMDAYS, EXP, result, EXP == result);
+                    }
+                }
+            }
+        }
+
         // negative tests
         if (verbose) cout << "\nNegative Testing." << endl;
         {
@@ -6029,6 +6169,116 @@ int main(int argc, char *argv[])
                     rval.length() == LENGTH);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Measure the cost of counting and shifting business days over long
+        //   date ranges.
+        //
+        // Concerns:
+        //: 1 'addBusinessDaysIfValid' and 'subtractBusinessDaysIfValid' cost
+        //:   far less than stepping a business-day iterator when the count is
+        //:   large.
+        //
+        // Plan:
+        //: 1 Using a calendar spanning 30 years, time the following for a
+        //:   fixed set of original dates and counts, and report the results:
+        //:   o 'Calendar::numBusinessDays' over ranges of up to 30 years.
+        //:   o 'addBusinessDaysIfValid'.
+        //:   o 'addBusinessDaysByIteration' (the former implementation).
+        //:   o 'nthBusinessDayOfMonthOrMaxIfValid'.
+        //:
+        //: 2 Verify that the results of the timed functions agree.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const bdlt::Calendar calendar = makeLongCalendar(1995, 2024);
+
+        const int LENGTH = calendar.length();
+
+        enum { k_NUM_QUERIES = 20000 };
+
+        bsl::vector<int> offsets(k_NUM_QUERIES);
+        bsl::vector<int> counts(k_NUM_QUERIES);
+
+        bsl::srand(1);
+        for (int i = 0; i < k_NUM_QUERIES; ++i) {
+            offsets[i] = bsl::rand() % LENGTH;
+            counts[i]  = bsl::rand() % 7500 - 3750;
+        }
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        bsls::Types::Int64 total = 0;
+        for (int i = 0; i < k_NUM_QUERIES; ++i) {
+            total += calendar.numBusinessDays(
+                                           calendar.firstDate() + offsets[i],
+                                           calendar.lastDate());
+        }
+        timer.stop();
+
+        cout << "numBusinessDays:            "
+             << timer.accumulatedWallTime() * 1e9 / k_NUM_QUERIES
+             << " ns/call (" << total << ")" << endl;
+
+        bsl::vector<bdlt::Date> fast(k_NUM_QUERIES);
+        bsl::vector<bdlt::Date> slow(k_NUM_QUERIES);
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_NUM_QUERIES; ++i) {
+            Util::addBusinessDaysIfValid(&fast[i],
+                                         calendar.firstDate() + offsets[i],
+                                         calendar,
+                                         counts[i]);
+        }
+        timer.stop();
+
+        cout << "addBusinessDaysIfValid:     "
+             << timer.accumulatedWallTime() * 1e9 / k_NUM_QUERIES
+             << " ns/call" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_NUM_QUERIES; ++i) {
+            addBusinessDaysByIteration(&slow[i],
+                                       calendar.firstDate() + offsets[i],
+                                       calendar,
+                                       counts[i]);
+        }
+        timer.stop();
+
+        cout << "addBusinessDaysByIteration: "
+             << timer.accumulatedWallTime() * 1e9 / k_NUM_QUERIES
+             << " ns/call" << endl;
+
+        ASSERT(fast == slow);
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_NUM_QUERIES; ++i) {
+            const bdlt::Date date = calendar.firstDate() + offsets[i];
+            const int        n    = counts[i] % 23 ? counts[i] % 23 : 1;
+
+            Util::nthBusinessDayOfMonthOrMaxIfValid(&fast[i],
+                                                    calendar,
+                                                    date.year(),
+                                                    date.month(),
+                                                    n);
+        }
+        timer.stop();
+
+        cout << "nthBusinessDayOfMonth:      "
+             << timer.accumulatedWallTime() * 1e9 / k_NUM_QUERIES
+             << " ns/call" << endl;
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
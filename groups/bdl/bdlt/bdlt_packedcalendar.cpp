@@ -9,8 +9,10 @@ BSLS_IDENT_RCSID(bdlt_packedcalendar_cpp,"$Id$ $CSID$")
 #include <bslma_default.h>
 
 #include <bsls_performancehint.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_ostream.h>
 
 namespace BloombergLP {
@@ -310,6 +312,99 @@ void unionWeekendDaysTransitions(WTransitions        *result,
     }
 }
 
+// SNAPSHOT LAYOUT
+//
+// A calendar snapshot (see 'loadSnapshot' and 'writeSnapshot') is a sequence
+// of native-endian 32-bit integers laid out as follows:
+//..
+//  magic, version, firstDate, lastDate,
+//  numTransitions, numHolidays, numHolidayCodes,
+//  { transitionDate, weekendDays } x numTransitions,
+//  holidayOffset                   x numHolidays,
+//  holidayCodesIndex               x numHolidays,
+//  holidayCode                     x numHolidayCodes
+//..
+// where each date is stored as the number of days since 0001/01/01, and each
+// set of weekend days uses the bitwise representation of
+// 'bdlt::DayOfWeekSet' (bits '1 .. 7' reflect '[ SUN, MON, ..., SAT ]').  The
+// three holiday arrays are verbatim copies of 'd_holidayOffsets',
+// 'd_holidayCodesIndex', and 'd_holidayCodes'.  A snapshot written on a
+// platform having the opposite byte order fails the 'magic' check.
+
+static const int k_SNAPSHOT_MAGIC         = 0x50434c53;  // "PCLS"
+static const int k_SNAPSHOT_VERSION       = 1;
+static const int k_SNAPSHOT_HEADER_LENGTH = 7;           // in integers
+
+static inline
+int getSnapshotInt(const char *snapshot, bsl::size_t index)
+    // Return the integer at the specified 'index' in the specified
+    // 'snapshot'.
+{
+    int value;
+    bsl::memcpy(&value, snapshot + index * sizeof(int), sizeof(int));
+    return value;
+}
+
+static inline
+void putSnapshotInt(char *snapshot, bsl::size_t index, int value)
+    // Store the specified 'value' at the specified 'index' in the specified
+    // 'snapshot'.
+{
+    bsl::memcpy(snapshot + index * sizeof(int), &value, sizeof(int));
+}
+
+static
+bsls::Types::Uint64 snapshotLengthImp(bsls::Types::Uint64 numTransitions,
+                                      bsls::Types::Uint64 numHolidays,
+                                      bsls::Types::Uint64 numHolidayCodes)
+    // Return the number of bytes in the snapshot of a calendar having the
+    // specified 'numTransitions', 'numHolidays', and 'numHolidayCodes'.
+{
+    return (k_SNAPSHOT_HEADER_LENGTH
+          + 2 * numTransitions
+          + 2 * numHolidays
+          + numHolidayCodes) * sizeof(int);
+}
+
+static
+bool isValidSnapshotDate(int serial)
+    // Return 'true' if the specified 'serial' is the number of days from
+    // 0001/01/01 to a valid 'Date', and 'false' otherwise.
+{
+    return 0 <= serial && serial <= Date(9999, 12, 31) - Date(1, 1, 1);
+}
+
+static
+void loadSnapshotArray(bdlc::PackedIntArray<int> *result,
+                       const char                *snapshot,
+                       bsl::size_t                index,
+                       int                        numElements)
+    // Load, into the specified 'result', the specified 'numElements' integers
+    // starting at the specified 'index' in the specified 'snapshot'.  The
+    // capacity (and element width) of 'result' is established before any
+    // element is appended so that no element is repacked.
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= numElements);
+
+    if (0 == numElements) {
+        return;                                                       // RETURN
+    }
+
+    int minValue = getSnapshotInt(snapshot, index);
+    int maxValue = minValue;
+    for (int i = 1; i < numElements; ++i) {
+        const int value = getSnapshotInt(snapshot, index + i);
+        minValue = bsl::min(minValue, value);
+        maxValue = bsl::max(maxValue, value);
+    }
+
+    result->reserveCapacity(numElements, minValue, maxValue);
+    for (int i = 0; i < numElements; ++i) {
+        result->append(getSnapshotInt(snapshot, index + i));
+    }
+}
+
                           // --------------------
                           // class PackedCalendar
                           // --------------------
@@ -1045,6 +1140,147 @@ PackedCalendar::unionNonBusinessDays(const PackedCalendar& other)
 
                                   // Aspects
 
+int PackedCalendar::loadSnapshot(const char *snapshot, bsl::size_t length)
+{
+    BSLS_ASSERT(snapshot || 0 == length);
+
+    if (length < k_SNAPSHOT_HEADER_LENGTH * sizeof(int)
+     || k_SNAPSHOT_MAGIC   != getSnapshotInt(snapshot, 0)
+     || k_SNAPSHOT_VERSION != getSnapshotInt(snapshot, 1)) {
+        return -1;                                                    // RETURN
+    }
+
+    const int firstSerial     = getSnapshotInt(snapshot, 2);
+    const int lastSerial      = getSnapshotInt(snapshot, 3);
+    const int numTransitions  = getSnapshotInt(snapshot, 4);
+    const int numHolidays     = getSnapshotInt(snapshot, 5);
+    const int numHolidayCodes = getSnapshotInt(snapshot, 6);
+
+    if (numTransitions < 0
+     || numHolidays < 0
+     || numHolidayCodes < 0
+     || length != snapshotLengthImp(numTransitions,
+                                    numHolidays,
+                                    numHolidayCodes)) {
+        return -2;                                                    // RETURN
+    }
+
+    if (!isValidSnapshotDate(firstSerial)
+     || !isValidSnapshotDate(lastSerial)) {
+        return -3;                                                    // RETURN
+    }
+
+    Date firstDate = Date(1, 1, 1) + firstSerial;
+    Date lastDate  = Date(1, 1, 1) + lastSerial;
+
+    if (firstDate > lastDate
+     && (firstDate != Date(9999, 12, 31) || lastDate != Date(1, 1, 1))) {
+        return -4;                                                    // RETURN
+    }
+
+    bsl::size_t index = k_SNAPSHOT_HEADER_LENGTH;
+
+    // The weekend-days transitions must be chronologically increasing.
+
+    WeekendDaysTransitionSequence weekendDaysTransitions(d_allocator_p);
+    weekendDaysTransitions.reserve(numTransitions);
+
+    for (int i = 0; i < numTransitions; ++i) {
+        const int serial = getSnapshotInt(snapshot, index++);
+        const int days   = getSnapshotInt(snapshot, index++);
+
+        if (!isValidSnapshotDate(serial)
+         || (days & ~0xFE)
+         || (i && Date(1, 1, 1) + serial
+                                    <= weekendDaysTransitions.back().first)) {
+            return -5;                                                // RETURN
+        }
+
+        DayOfWeekSet weekendDays;
+        for (int d = DayOfWeek::e_SUN; d <= DayOfWeek::e_SAT; ++d) {
+            if (days & (1 << d)) {
+                weekendDays.add(static_cast<DayOfWeek::Enum>(d));
+            }
+        }
+
+        weekendDaysTransitions.push_back(
+                   WeekendDaysTransition(Date(1, 1, 1) + serial, weekendDays));
+    }
+
+    // The holiday offsets must be increasing and within the valid range, and
+    // the holiday-code indices must be non-decreasing, starting at 0.
+
+    const bsl::size_t offsetsIndex    = index;
+    const bsl::size_t codesIndexIndex = offsetsIndex + numHolidays;
+    const bsl::size_t codesIndex      = codesIndexIndex + numHolidays;
+
+    const int rangeLength = firstDate <= lastDate
+                          ? lastDate - firstDate + 1
+                          : 0;
+
+    if (numHolidays > rangeLength || (0 == numHolidays && numHolidayCodes)) {
+        return -6;                                                    // RETURN
+    }
+
+    for (int i = 0; i < numHolidays; ++i) {
+        const int offset    = getSnapshotInt(snapshot, offsetsIndex + i);
+        const int codeIndex = getSnapshotInt(snapshot, codesIndexIndex + i);
+
+        if (offset < 0
+         || offset >= rangeLength
+         || codeIndex > numHolidayCodes
+         || (0 == i && 0 != codeIndex)) {
+            return -7;                                                // RETURN
+        }
+
+        if (i
+         && (offset <= getSnapshotInt(snapshot, offsetsIndex + i - 1)
+          || codeIndex < getSnapshotInt(snapshot, codesIndexIndex + i - 1))) {
+            return -7;                                                // RETURN
+        }
+    }
+
+    // The holiday codes of each holiday must be increasing.
+
+    int holiday = 0;
+    for (int i = 1; i < numHolidayCodes; ++i) {
+        while (holiday + 1 < numHolidays
+            && getSnapshotInt(snapshot, codesIndexIndex + holiday + 1) <= i) {
+            ++holiday;
+        }
+
+        const bool isFirstCode =
+                  i == getSnapshotInt(snapshot, codesIndexIndex + holiday);
+
+        if (!isFirstCode
+         && getSnapshotInt(snapshot, codesIndex + i - 1)
+                                 >= getSnapshotInt(snapshot, codesIndex + i)) {
+            return -8;                                                // RETURN
+        }
+    }
+
+    bdlc::PackedIntArray<int> holidayOffsets(d_allocator_p);
+    bdlc::PackedIntArray<int> holidayCodesIndex(d_allocator_p);
+    bdlc::PackedIntArray<int> holidayCodes(d_allocator_p);
+
+    loadSnapshotArray(&holidayOffsets,    snapshot, offsetsIndex, numHolidays);
+    loadSnapshotArray(&holidayCodesIndex,
+                      snapshot,
+                      codesIndexIndex,
+                      numHolidays);
+    loadSnapshotArray(&holidayCodes, snapshot, codesIndex, numHolidayCodes);
+
+    bslalg::SwapUtil::swap(&d_firstDate,         &firstDate);
+    bslalg::SwapUtil::swap(&d_lastDate,          &lastDate);
+    bslalg::SwapUtil::swap(&d_weekendDaysTransitions,
+                                                 &weekendDaysTransitions);
+    bslalg::SwapUtil::swap(&d_holidayOffsets,    &holidayOffsets);
+    bslalg::SwapUtil::swap(&d_holidayCodesIndex, &holidayCodesIndex);
+    bslalg::SwapUtil::swap(&d_holidayCodes,      &holidayCodes);
+
+    return 0;
+}
+
 void PackedCalendar::swap(PackedCalendar& other)
 {
     // 'swap' is undefined for objects with non-equal allocators.
@@ -1266,6 +1502,58 @@ int PackedCalendar::numWeekendDaysInRange() const
 
                                   // Aspects
 
+bsl::size_t PackedCalendar::snapshotLength() const
+{
+    return static_cast<bsl::size_t>(
+                         snapshotLengthImp(d_weekendDaysTransitions.size(),
+                                           d_holidayOffsets.length(),
+                                           d_holidayCodes.length()));
+}
+
+void PackedCalendar::writeSnapshot(char *buffer) const
+{
+    BSLS_ASSERT(buffer);
+
+    const int numTransitions  =
+                         static_cast<int>(d_weekendDaysTransitions.size());
+    const int numHolidays     = static_cast<int>(d_holidayOffsets.length());
+    const int numHolidayCodes = static_cast<int>(d_holidayCodes.length());
+
+    putSnapshotInt(buffer, 0, k_SNAPSHOT_MAGIC);
+    putSnapshotInt(buffer, 1, k_SNAPSHOT_VERSION);
+    putSnapshotInt(buffer, 2, d_firstDate - Date(1, 1, 1));
+    putSnapshotInt(buffer, 3, d_lastDate  - Date(1, 1, 1));
+    putSnapshotInt(buffer, 4, numTransitions);
+    putSnapshotInt(buffer, 5, numHolidays);
+    putSnapshotInt(buffer, 6, numHolidayCodes);
+
+    bsl::size_t index = k_SNAPSHOT_HEADER_LENGTH;
+
+    for (int i = 0; i < numTransitions; ++i) {
+        const WeekendDaysTransition& transition = d_weekendDaysTransitions[i];
+
+        int days = 0;
+        for (int d = DayOfWeek::e_SUN; d <= DayOfWeek::e_SAT; ++d) {
+            if (transition.second.isMember(static_cast<DayOfWeek::Enum>(d))) {
+                days |= 1 << d;
+            }
+        }
+
+        putSnapshotInt(buffer, index++, transition.first - Date(1, 1, 1));
+        putSnapshotInt(buffer, index++, days);
+    }
+
+    for (int i = 0; i < numHolidays; ++i) {
+        putSnapshotInt(buffer, index++, d_holidayOffsets[i]);
+    }
+    for (int i = 0; i < numHolidays; ++i) {
+        putSnapshotInt(buffer, index++, d_holidayCodesIndex[i]);
+    }
+    for (int i = 0; i < numHolidayCodes; ++i) {
+        putSnapshotInt(buffer, index++, d_holidayCodes[i]);
+    }
+}
+
 bsl::ostream& PackedCalendar::print(bsl::ostream& stream,
                                     int           level,
                                     int           spacesPerLevel) const
@@ -151,6 +151,7 @@ BSLS_IDENT("$Id: $")
 //    'addWeekendDaysTransition'                       WDT    BD
 //    'intersectBusinessDays'               H    HC    WDT    BD
 //    'intersectNonBusinessDays'            H    HC    WDT    BD
+//    'loadSnapshot'                        H    HC    WDT    BD
 //    'removeAll'                           H    HC    WDT    BD
 //    'removeHoliday'                       H    HC           BD
 //    'removeHolidayCode'                        HC
@@ -168,6 +169,23 @@ BSLS_IDENT("$Id: $")
 // 'BusinessDayConstReverseIterator').
 //..
 //
+///Binary Snapshots
+///----------------
+// In addition to BDEX streaming, a 'bdlt::PackedCalendar' can be written to
+// and read from a *snapshot*: a flat, contiguous block of native-endian 32-bit
+// integers that mirrors the internal representation of the calendar.  The
+// 'writeSnapshot' accessor writes exactly 'snapshotLength()' bytes into a
+// caller-supplied buffer, and the 'loadSnapshot' manipulator assigns to a
+// calendar the value held in such a buffer.  Loading a snapshot performs one
+// bulk pass over each array of the calendar and involves no per-element
+// decoding or intermediate stream, so a snapshot can be loaded directly from a
+// memory-mapped file.  Snapshots are intended for caching calendars between
+// runs of processes on the same platform and are *not* a portable
+// externalization format; use BDEX streaming for that purpose.  A snapshot
+// written on a platform having a different byte order is rejected by
+// 'loadSnapshot'.  See 'bdlt_snapshotcalendarloader' for a calendar loader
+// that serves calendars from a snapshot of many named calendars.
+//
 ///Performance and Exception-Safety Guarantees
 ///-------------------------------------------
 // The asymptotic worst-case performance of representative operations is
@@ -932,6 +950,14 @@ class PackedCalendar {
         // 'bslx' package-level documentation for more information on BDEX
         // streaming of value-semantic types and containers.
 
+    int loadSnapshot(const char *snapshot, bsl::size_t length);
+        // Assign to this object the value held in the specified 'snapshot' of
+        // the specified 'length' (in bytes).  Return 0 on success, and a
+        // non-zero value (with no effect on this object) if 'snapshot' does
+        // not hold a well-formed calendar snapshot of exactly 'length' bytes
+        // in the byte order of this platform.  'snapshot' need not be
+        // suitably aligned for any type.  See {Binary Snapshots}.
+
     void swap(PackedCalendar& other);
         // Efficiently exchange the value of this object with the value of the
         // specified 'other' object.  This method provides the no-throw
@@ -1301,6 +1327,17 @@ class PackedCalendar {
         // package-level documentation for more information on BDEX streaming
         // of value-semantic types and containers.
 
+    bsl::size_t snapshotLength() const;
+        // Return the number of bytes written by 'writeSnapshot' for the
+        // current value of this calendar.
+
+    void writeSnapshot(char *buffer) const;
+        // Write a snapshot of the value of this calendar, occupying exactly
+        // 'snapshotLength()' bytes, to the specified 'buffer'.  The behavior
+        // is undefined unless 'buffer' has room for at least
+        // 'snapshotLength()' bytes.  Note that 'buffer' need not be suitably
+        // aligned for any type.  See {Binary Snapshots}.
+
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
                         int           spacesPerLevel = 4) const;
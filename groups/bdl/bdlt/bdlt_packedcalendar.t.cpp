@@ -15,6 +15,7 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bslx_byteinstream.h>
 #include <bslx_byteoutstream.h>
@@ -31,6 +32,7 @@
 #include <bsl_iosfwd.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -97,6 +99,7 @@ using namespace bsl;
 // [18] void unionBusinessDays(const PackedCalendar& calendar);
 // [18] void unionNonBusinessDays(const PackedCalendar& calendar);
 // [10] STREAM& bdexStreamIn(STREAM& stream, int version);
+// [30] int loadSnapshot(const char *snapshot, size_t length);
 // [ 8] void swap(PackedCalendar& other);
 //
 // ACCESSORS
@@ -152,6 +155,8 @@ using namespace bsl;
 // [ 4] WeekendDaysTransition weekendDaysTransition(int index) const;
 // [ 4] bslma::Allocator *allocator() const;
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
+// [30] size_t snapshotLength() const;
+// [30] void writeSnapshot(char *buffer) const;
 // [ 5] ostream& print(ostream& stream, int level = 0, int sPL = 4) const;
 //
 #ifndef BDE_OMIT_INTERNAL_DEPRECATED  // BDE2.22
@@ -169,7 +174,7 @@ using namespace bsl;
 // [ 8] void swap(PackedCalendar& a, PackedCalendar& b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [30] USAGE EXAMPLE
+// [31] USAGE EXAMPLE
 // [ 3] bdlt::PackedCalendar& gg(bdlt::PackedCalendar *o, const char *s);
 // [ 3] int ggg(bdlt::PackedCalendar *obj, const char *spec, bool vF);
 // ============================================================================
@@ -1118,7 +1123,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 30: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1184,6 +1189,128 @@ int main(int argc, char *argv[])
                                  "02NOV2010\n\n25NOV2010\nThanksgiving Day\n");
 //..
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING SNAPSHOTS
+        //   Ensure that a calendar can be written to, and restored from, a
+        //   binary snapshot, and that malformed snapshots are rejected.
+        //
+        // Concerns:
+        //: 1 'writeSnapshot' writes exactly 'snapshotLength()' bytes.
+        //:
+        //: 2 'loadSnapshot' restores the value of the written calendar,
+        //:   regardless of the prior value of the target object.
+        //:
+        //: 3 'loadSnapshot' does not require an aligned buffer.
+        //:
+        //: 4 'loadSnapshot' rejects a truncated, extended, or corrupted
+        //:   snapshot, leaving the target object unchanged.
+        //:
+        //: 5 Any memory allocation is from the object allocator.
+        //
+        // Plan:
+        //: 1 For each calendar in a table of specifications, write a snapshot
+        //:   at an odd offset within a buffer guarded by sentinel bytes, and
+        //:   verify that the sentinels are untouched.  (C-1)
+        //:
+        //: 2 Load each snapshot into objects having each value in the table
+        //:   and verify the result using the equality operator.  (C-2..3)
+        //:
+        //: 3 Verify that loading a snapshot with a shortened length, an
+        //:   extended length, or a modified byte in its header fails and has
+        //:   no effect.  (C-4)
+        //:
+        //: 4 Use a test allocator installed as the default allocator to
+        //:   verify that 'loadSnapshot' allocates only from the object
+        //:   allocator.  (C-5)
+        //
+        // Testing:
+        //   int loadSnapshot(const char *snapshot, size_t length);
+        //   size_t snapshotLength() const;
+        //   void writeSnapshot(char *buffer) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING SNAPSHOTS" << endl
+                          << "=================" << endl;
+
+        static const char **SPECS = DEFAULT_SPECS;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        for (int ti = 0; SPECS[ti]; ++ti) {
+            Obj mX(&oa);  const Obj& X = gg(&mX, SPECS[ti]);
+
+            const bsl::size_t LENGTH = X.snapshotLength();
+
+            if (veryVerbose) { T_ P_(ti) P_(LENGTH) P(X) }
+
+            const char SENTINEL = static_cast<char>(0xA5);
+
+            bsl::vector<char> buffer(LENGTH + 2, SENTINEL);
+            X.writeSnapshot(&buffer[1]);
+
+            ASSERTV(ti, SENTINEL == buffer[0]);
+            ASSERTV(ti, SENTINEL == buffer[LENGTH + 1]);
+
+            const char *SNAPSHOT = &buffer[1];
+
+            for (int tj = 0; SPECS[tj]; ++tj) {
+                Obj mY(&oa);  const Obj& Y = gg(&mY, SPECS[tj]);
+
+                bsls::Types::Int64 numDefault = da.numBlocksTotal();
+
+                ASSERTV(ti, tj, 0 == mY.loadSnapshot(SNAPSHOT, LENGTH));
+                ASSERTV(ti, tj, X == Y);
+
+                ASSERTV(ti, tj, numDefault == da.numBlocksTotal());
+            }
+
+            // Malformed snapshots.
+
+            Obj mY(&oa);  const Obj& Y = gg(&mY, "@2012/1/1 30 2");
+            const Obj Z(Y);
+
+            ASSERTV(ti, 0 != mY.loadSnapshot(SNAPSHOT, LENGTH - 1));
+            ASSERTV(ti, Z == Y);
+
+            ASSERTV(ti, 0 != mY.loadSnapshot(&buffer[0], LENGTH + 2));
+            ASSERTV(ti, Z == Y);
+
+            ASSERTV(ti, 0 != mY.loadSnapshot(SNAPSHOT, 0));
+            ASSERTV(ti, Z == Y);
+
+            for (bsl::size_t i = 0; i < 2 * sizeof(int); ++i) {
+                bsl::vector<char> corrupt(buffer);
+                corrupt[1 + i] = static_cast<char>(corrupt[1 + i] ^ 0x10);
+
+                ASSERTV(ti, i, 0 != mY.loadSnapshot(&corrupt[1], LENGTH));
+                ASSERTV(ti, i, Z == Y);
+            }
+        }
+
+        if (verbose) cout << "\nA holiday outside the valid range." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = gg(&mX, "@2012/1/1 30 2 5 9");
+
+            bsl::vector<char> buffer(X.snapshotLength());
+            X.writeSnapshot(buffer.data());
+
+            // The first holiday offset follows the seven-integer header; the
+            // valid range of 'X' has 31 days.
+
+            int offset = 31;
+            bsl::memcpy(&buffer[7 * sizeof(int)], &offset, sizeof offset);
+
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            ASSERT(0 != mY.loadSnapshot(buffer.data(), buffer.size()));
+            ASSERT(Obj() == Y);
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // TESTING: hashAppend
@@ -0,0 +1,253 @@
+// bdlt_snapshotcalendarloader.cpp                                    -*-C++-*-
+#include <bdlt_snapshotcalendarloader.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlt_snapshotcalendarloader_cpp,"$Id$ $CSID$")
+
+#include <bdlt_packedcalendar.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+// IMPLEMENTATION NOTES
+// --------------------
+// A snapshot is laid out as follows, where every integer is a native-endian
+// 32-bit 'int' and every offset is relative to the start of the snapshot:
+//..
+//  magic, version, numCalendars
+//  { nameOffset, nameLength, dataOffset, dataLength } x numCalendars
+//  name and calendar data, each calendar padded to a multiple of 4 bytes
+//..
+// The directory entries are sorted by name (as by 'bsl::memcmp', with a
+// shorter name ordered before a longer name having it as a prefix), and names
+// are not null-terminated.  The data of each entry is a calendar snapshot as
+// written by 'PackedCalendar::writeSnapshot'.  A snapshot written on a
+// platform having the opposite byte order fails the 'magic' check.
+
+namespace BloombergLP {
+namespace bdlt {
+namespace {
+
+const int k_MAGIC          = 0x53434c44;  // "SCLD"
+const int k_VERSION        = 1;
+const int k_HEADER_LENGTH  = 3;           // in integers
+const int k_ENTRY_LENGTH   = 4;           // in integers
+
+int getInt(const char *snapshot, bsl::size_t index)
+    // Return the integer at the specified 'index' in the specified
+    // 'snapshot'.
+{
+    int value;
+    bsl::memcpy(&value, snapshot + index * sizeof(int), sizeof(int));
+    return value;
+}
+
+void putInt(bsl::vector<char> *snapshot, bsl::size_t index, int value)
+    // Store the specified 'value' at the specified 'index' in the specified
+    // 'snapshot'.
+{
+    bsl::memcpy(snapshot->data() + index * sizeof(int), &value, sizeof(int));
+}
+
+bsl::size_t entryIndex(int entry)
+    // Return the index of the first integer of the specified 'entry' in the
+    // directory of a snapshot.
+{
+    return k_HEADER_LENGTH + static_cast<bsl::size_t>(entry) * k_ENTRY_LENGTH;
+}
+
+int compareNames(const char  *lhs,
+                 bsl::size_t  lhsLength,
+                 const char  *rhs,
+                 bsl::size_t  rhsLength)
+    // Return a negative value, 0, or a positive value if the specified 'lhs'
+    // name having the specified 'lhsLength' is ordered before, the same as,
+    // or after the specified 'rhs' name having the specified 'rhsLength',
+    // respectively.
+{
+    const int result = bsl::memcmp(lhs, rhs, bsl::min(lhsLength, rhsLength));
+
+    if (result) {
+        return result;                                                // RETURN
+    }
+
+    return lhsLength < rhsLength ? -1 : lhsLength > rhsLength ? 1 : 0;
+}
+
+bool isValidRange(bsls::Types::Int64 offset,
+                  bsls::Types::Int64 length,
+                  bsl::size_t        snapshotLength)
+    // Return 'true' if the specified 'offset' and 'length' denote a range of
+    // bytes within a snapshot having the specified 'snapshotLength', and
+    // 'false' otherwise.
+{
+    return 0 <= offset
+        && 0 <= length
+        && static_cast<bsls::Types::Uint64>(offset + length) <= snapshotLength;
+}
+
+}  // close unnamed namespace
+
+                       // ----------------------------
+                       // class SnapshotCalendarLoader
+                       // ----------------------------
+
+// CLASS METHODS
+int SnapshotCalendarLoader::createSnapshot(
+                               bsl::vector<char>               *result,
+                               CalendarLoader                  *loader,
+                               const bsl::vector<bsl::string>&  calendarNames)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(loader);
+
+    bsl::vector<bsl::string> names(calendarNames);
+    bsl::sort(names.begin(), names.end());
+    names.erase(bsl::unique(names.begin(), names.end()), names.end());
+
+    const int numCalendars = static_cast<int>(names.size());
+
+    result->clear();
+    result->resize(entryIndex(numCalendars) * sizeof(int));
+
+    putInt(result, 0, k_MAGIC);
+    putInt(result, 1, k_VERSION);
+    putInt(result, 2, numCalendars);
+
+    PackedCalendar calendar;  // temporary, so use default allocator
+
+    for (int i = 0; i < numCalendars; ++i) {
+        const bsl::string& name = names[i];
+
+        const int rc = loader->load(&calendar, name.c_str());
+        if (rc) {
+            return rc;                                                // RETURN
+        }
+
+        const bsl::size_t nameOffset = result->size();
+        result->insert(result->end(), name.begin(), name.end());
+        result->resize((result->size() + sizeof(int) - 1)
+                                                / sizeof(int) * sizeof(int));
+
+        const bsl::size_t dataOffset = result->size();
+        const bsl::size_t dataLength = calendar.snapshotLength();
+        result->resize(dataOffset + dataLength);
+        calendar.writeSnapshot(result->data() + dataOffset);
+
+        const bsl::size_t index = entryIndex(i);
+        putInt(result, index,     static_cast<int>(nameOffset));
+        putInt(result, index + 1, static_cast<int>(name.length()));
+        putInt(result, index + 2, static_cast<int>(dataOffset));
+        putInt(result, index + 3, static_cast<int>(dataLength));
+
+        calendar.removeAll();
+    }
+
+    return 0;
+}
+
+// CREATORS
+SnapshotCalendarLoader::SnapshotCalendarLoader(const char  *snapshot,
+                                               bsl::size_t  length)
+: d_snapshot_p(snapshot)
+, d_length(length)
+, d_numCalendars(0)
+, d_isValid(false)
+{
+    BSLS_ASSERT(snapshot || 0 == length);
+
+    if (length < k_HEADER_LENGTH * sizeof(int)
+     || k_MAGIC   != getInt(snapshot, 0)
+     || k_VERSION != getInt(snapshot, 1)) {
+        return;                                                       // RETURN
+    }
+
+    const int numCalendars = getInt(snapshot, 2);
+
+    if (numCalendars < 0
+     || !isValidRange(0, entryIndex(numCalendars) * sizeof(int), length)) {
+        return;                                                       // RETURN
+    }
+
+    for (int i = 0; i < numCalendars; ++i) {
+        const bsl::size_t index = entryIndex(i);
+
+        if (!isValidRange(getInt(snapshot, index),
+                          getInt(snapshot, index + 1),
+                          length)
+         || !isValidRange(getInt(snapshot, index + 2),
+                          getInt(snapshot, index + 3),
+                          length)) {
+            return;                                                   // RETURN
+        }
+    }
+
+    d_numCalendars = numCalendars;
+    d_isValid      = true;
+}
+
+SnapshotCalendarLoader::~SnapshotCalendarLoader()
+{
+}
+
+// MANIPULATORS
+int SnapshotCalendarLoader::load(PackedCalendar *result,
+                                 const char     *calendarName)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(calendarName);
+
+    const bsl::size_t nameLength = bsl::strlen(calendarName);
+
+    int first = 0;
+    int last  = d_numCalendars;
+
+    while (first < last) {
+        const int         middle = first + (last - first) / 2;
+        const bsl::size_t index  = entryIndex(middle);
+
+        const int cmp = compareNames(
+                                d_snapshot_p + getInt(d_snapshot_p, index),
+                                getInt(d_snapshot_p, index + 1),
+                                calendarName,
+                                nameLength);
+
+        if (cmp < 0) {
+            first = middle + 1;
+        }
+        else if (cmp > 0) {
+            last = middle;
+        }
+        else {
+            const int rc = result->loadSnapshot(
+                                d_snapshot_p + getInt(d_snapshot_p, index + 2),
+                                getInt(d_snapshot_p, index + 3));
+
+            return 0 == rc ? 0 : -1;                                  // RETURN
+        }
+    }
+
+    return 1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,221 @@
+// bdlt_snapshotcalendarloader.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLT_SNAPSHOTCALENDARLOADER
+#define INCLUDED_BDLT_SNAPSHOTCALENDARLOADER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a calendar loader that reads from a binary snapshot.
+//
+//@CLASSES:
+//  bdlt::SnapshotCalendarLoader: loads calendars from an in-memory snapshot
+//
+//@SEE_ALSO: bdlt_calendarloader, bdlt_calendarcache, bdlt_packedcalendar
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'bdlt::CalendarLoader' protocol, 'bdlt::SnapshotCalendarLoader', that loads
+// calendars from a *snapshot*: a single contiguous block of memory holding
+// any number of named calendars in the binary snapshot format of
+// 'bdlt::PackedCalendar' (see {'bdlt_packedcalendar'|Binary Snapshots}).  A
+// snapshot is created by the 'createSnapshot' class method, which fetches each
+// of a list of calendars from another calendar loader.
+//
+// A snapshot is self-contained and holds no pointers, so it can be written to
+// a file by one process and memory-mapped by another.  A
+// 'bdlt::SnapshotCalendarLoader' does not copy the snapshot supplied at
+// construction; each call to 'load' finds the requested calendar by binary
+// search over the sorted directory of the snapshot and assigns it to the
+// result with a single call to 'bdlt::PackedCalendar::loadSnapshot'.  A
+// process that has a snapshot of its calendars can therefore populate a
+// 'bdlt::CalendarCache' at startup (e.g., using
+// 'bdlt::CalendarCache::prefetch') without contacting, or parsing the output
+// of, the calendar source from which the snapshot was created.
+//
+// Note that a snapshot is stored in the native byte order and is not intended
+// to be moved between platforms; 'load' fails for a calendar whose snapshot
+// was written on a platform having a different byte order.
+//
+///Thread Safety
+///-------------
+// The 'load' method of 'bdlt::SnapshotCalendarLoader' modifies no state of
+// the loader, and so a single loader object may be used concurrently by
+// multiple threads (e.g., by the threads of 'bdlt::CalendarCache::prefetch').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reloading Calendars from a Snapshot
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the calendars used by an application are served by a loader,
+// 'MyCalendarLoader', that is expensive to use (e.g., it queries a remote
+// database).  In this example, we snapshot two of those calendars so that
+// they can later be loaded without going back to the original source.
+//
+// First, we create the snapshot using the original loader:
+//..
+//  MyCalendarLoader         sourceLoader;
+//  bsl::vector<bsl::string> names;
+//  names.push_back("US");
+//  names.push_back("FR");
+//
+//  bsl::vector<char> snapshot;
+//  int rc = bdlt::SnapshotCalendarLoader::createSnapshot(&snapshot,
+//                                                        &sourceLoader,
+//                                                        names);
+//  assert(0 == rc);
+//..
+// Typically, 'snapshot' would now be written to a file, and a later run of
+// the application would memory-map that file.  For the purposes of this
+// example, we use the vector directly.
+//
+// Then, we create a loader that serves calendars from the snapshot:
+//..
+//  bdlt::SnapshotCalendarLoader loader(snapshot.data(), snapshot.size());
+//  assert(loader.isValid());
+//  assert(2 == loader.numCalendars());
+//..
+// Next, we load the "US" calendar and verify that it has the same value as
+// the one served by the original loader:
+//..
+//  bdlt::PackedCalendar us;
+//  rc = loader.load(&us, "US");
+//  assert(0 == rc);
+//
+//  bdlt::PackedCalendar expected;
+//  rc = sourceLoader.load(&expected, "US");
+//  assert(0 == rc);
+//  assert(expected == us);
+//..
+// Finally, we observe that a calendar that is not in the snapshot is reported
+// as not found:
+//..
+//  bdlt::PackedCalendar de;
+//  rc = loader.load(&de, "DE");
+//  assert(1 == rc);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlt_calendarloader.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlt {
+
+class PackedCalendar;
+
+                       // ============================
+                       // class SnapshotCalendarLoader
+                       // ============================
+
+class SnapshotCalendarLoader : public CalendarLoader {
+    // This class provides a concrete implementation of the
+    // 'bdlt::CalendarLoader' protocol that loads calendars from a binary
+    // snapshot held in memory that is supplied at construction.  The snapshot
+    // is neither copied nor owned.
+
+    // DATA
+    const char  *d_snapshot_p;    // snapshot (held, not owned)
+
+    bsl::size_t  d_length;        // length of snapshot in bytes
+
+    int          d_numCalendars;  // number of calendars in the snapshot
+
+    bool         d_isValid;       // 'true' if the header and directory of the
+                                  // snapshot are well-formed
+
+  private:
+    // NOT IMPLEMENTED
+    SnapshotCalendarLoader(const SnapshotCalendarLoader&);
+    SnapshotCalendarLoader& operator=(const SnapshotCalendarLoader&);
+
+  public:
+    // CLASS METHODS
+    static int createSnapshot(bsl::vector<char>               *result,
+                              CalendarLoader                  *loader,
+                              const bsl::vector<bsl::string>&  calendarNames);
+        // Load, into the specified 'result', a snapshot of the calendars
+        // identified by the specified 'calendarNames' as loaded by the
+        // specified 'loader'.  Return 0 on success, and the non-zero status
+        // returned by 'loader' for the first calendar that it fails to load
+        // otherwise, in which case the value of '*result' is unspecified.  A
+        // name that occurs more than once in 'calendarNames' is stored once.
+
+    // CREATORS
+    SnapshotCalendarLoader(const char *snapshot, bsl::size_t length);
+        // Create a calendar loader that loads calendars from the specified
+        // 'snapshot' having the specified 'length' (in bytes).  If 'snapshot'
+        // does not have a well-formed header and directory, the created
+        // loader is not valid (see 'isValid') and fails to load any calendar.
+        // The behavior is undefined unless 'snapshot' remains valid and
+        // unmodified throughout the lifetime of this loader.  Note that
+        // 'snapshot' need not be suitably aligned for any type.
+
+    virtual ~SnapshotCalendarLoader();
+        // Destroy this object.
+
+    // MANIPULATORS
+    virtual int load(PackedCalendar *result, const char *calendarName);
+        // Load, into the specified 'result', the calendar identified by the
+        // specified 'calendarName' in the snapshot supplied at construction.
+        // Return 0 on success, and a non-zero value otherwise.  If the
+        // calendar corresponding to 'calendarName' is not found, 1 is returned
+        // with no effect on '*result'.  If the snapshot of the calendar is
+        // malformed, a negative value is returned with no effect on
+        // '*result'.
+
+    // ACCESSORS
+    bool isValid() const;
+        // Return 'true' if the header and directory of the snapshot supplied
+        // at construction are well-formed, and 'false' otherwise.
+
+    int numCalendars() const;
+        // Return the number of calendars in the snapshot supplied at
+        // construction, or 0 if this loader is not valid.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class SnapshotCalendarLoader
+                       // ----------------------------
+
+// ACCESSORS
+inline
+bool SnapshotCalendarLoader::isValid() const
+{
+    return d_isValid;
+}
+
+inline
+int SnapshotCalendarLoader::numCalendars() const
+{
+    return d_numCalendars;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
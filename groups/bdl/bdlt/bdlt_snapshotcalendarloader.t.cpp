@@ -0,0 +1,726 @@
+// bdlt_snapshotcalendarloader.t.cpp                                  -*-C++-*-
+#include <bdlt_snapshotcalendarloader.h>
+
+#include <bdlt_calendarloader.h>
+#include <bdlt_date.h>
+#include <bdlt_dayofweek.h>
+#include <bdlt_dayofweekset.h>
+#include <bdlt_packedcalendar.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>    // 'atoi'
+#include <bsl_cstring.h>    // 'memcpy', 'strcmp'
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a concrete implementation of the
+// 'bdlt::CalendarLoader' protocol that serves calendars from an in-memory
+// snapshot created by its 'createSnapshot' class method.  We use a test loader
+// that serves a small set of calendars having holidays, holiday codes, and
+// weekend-days transitions, create snapshots from it, and verify that each
+// calendar loaded from a snapshot has the same value as the one served by the
+// test loader.  We also verify that malformed snapshots are detected.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int createSnapshot(vector<char> *, CalendarLoader *, names);
+//
+// CREATORS
+// [ 2] SnapshotCalendarLoader(const char *snapshot, size_t length);
+// [ 2] virtual ~SnapshotCalendarLoader();
+//
+// MANIPULATORS
+// [ 2] virtual int load(PackedCalendar *result, const char *name);
+//
+// ACCESSORS
+// [ 2] bool isValid() const;
+// [ 2] int numCalendars() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [ 3] CONCERN: Malformed snapshots are detected.
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlt::SnapshotCalendarLoader Obj;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+class TestLoader : public bdlt::CalendarLoader {
+    // This concrete calendar loader successfully loads calendars named
+    // "EMPTY", "CAL-1", "CAL-2", and "CAL-10".  "ERROR" results in a status
+    // of -1, and any other name results in a status of 1.
+
+  private:
+    // NOT IMPLEMENTED
+    TestLoader(const TestLoader&);             // = delete
+    TestLoader& operator=(const TestLoader&);  // = delete
+
+  public:
+    // CREATORS
+    TestLoader();
+        // Create a test loader.
+
+    ~TestLoader();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int load(bdlt::PackedCalendar *result, const char *calendarName);
+        // Load, into the specified 'result', the calendar identified by the
+        // specified 'calendarName'.  Return 0 on success, and a non-zero value
+        // otherwise.
+};
+
+// CREATORS
+inline
+TestLoader::TestLoader()
+{
+}
+
+TestLoader::~TestLoader()
+{
+}
+
+// MANIPULATORS
+int TestLoader::load(bdlt::PackedCalendar *result, const char *calendarName)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(calendarName);
+
+    if (0 == bsl::strcmp("ERROR", calendarName)) {
+        return -1;                                                    // RETURN
+    }
+
+    result->removeAll();
+
+    if (0 == bsl::strcmp("EMPTY", calendarName)) {
+        return 0;                                                     // RETURN
+    }
+
+    if (0 == bsl::strcmp("CAL-1", calendarName)) {
+        result->setValidRange(bdlt::Date(2000, 1, 1),
+                              bdlt::Date(2000, 12, 31));
+        result->addHoliday(bdlt::Date(2000, 7, 4));
+        return 0;                                                     // RETURN
+    }
+
+    if (0 == bsl::strcmp("CAL-2", calendarName)) {
+        bdlt::DayOfWeekSet weekendDays;
+        weekendDays.add(bdlt::DayOfWeek::e_SAT);
+        weekendDays.add(bdlt::DayOfWeek::e_SUN);
+
+        result->setValidRange(bdlt::Date(1990, 1, 1),
+                              bdlt::Date(2030, 12, 31));
+        result->addWeekendDaysTransition(bdlt::Date(1, 1, 1), weekendDays);
+
+        weekendDays.removeAll();
+        weekendDays.add(bdlt::DayOfWeek::e_FRI);
+        result->addWeekendDaysTransition(bdlt::Date(2010, 1, 1), weekendDays);
+
+        for (int year = 1990; year <= 2030; ++year) {
+            result->addHolidayCode(bdlt::Date(year, 1, 1), 1);
+            result->addHolidayCode(bdlt::Date(year, 12, 25), 300);
+            result->addHolidayCode(bdlt::Date(year, 12, 25), 7);
+            result->addHoliday(bdlt::Date(year, 12, 26));
+        }
+        return 0;                                                     // RETURN
+    }
+
+    if (0 == bsl::strcmp("CAL-10", calendarName)) {
+        result->setValidRange(bdlt::Date(9999, 1, 1),
+                              bdlt::Date(9999, 12, 31));
+        result->addHolidayCode(bdlt::Date(9999, 12, 31), -100000);
+        return 0;                                                     // RETURN
+    }
+
+    return 1;
+}
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// Define the 'MyCalendarLoader' class that is used in the Usage example.
+
+class MyCalendarLoader : public bdlt::CalendarLoader {
+
+  private:
+    // NOT IMPLEMENTED
+    MyCalendarLoader(const MyCalendarLoader&);             // = delete
+    MyCalendarLoader& operator=(const MyCalendarLoader&);  // = delete
+
+  public:
+    // CREATORS
+    MyCalendarLoader();
+        // Create a 'MyCalendarLoader' object.
+
+    ~MyCalendarLoader();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int load(bdlt::PackedCalendar *result, const char *calendarName);
+        // Load, into the specified 'result', the calendar identified by the
+        // specified 'calendarName'.  Return 0 on success, and a non-zero value
+        // otherwise.
+};
+
+// CREATORS
+inline
+MyCalendarLoader::MyCalendarLoader()
+{
+}
+
+MyCalendarLoader::~MyCalendarLoader()
+{
+}
+
+int MyCalendarLoader::load(bdlt::PackedCalendar *result,
+                           const char           *calendarName)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(calendarName);
+
+    result->removeAll();
+    result->setValidRange(bdlt::Date(2000, 1, 1), bdlt::Date(2020, 12, 31));
+
+    if (     0 == bsl::strcmp("DE", calendarName)) {  // Germany
+        return 0;                                                     // RETURN
+    }
+    else if (0 == bsl::strcmp("FR", calendarName)) {  // France
+        result->addHoliday(bdlt::Date(2011, 7, 14));
+
+        return 0;                                                     // RETURN
+    }
+    else if (0 == bsl::strcmp("US", calendarName)) {  // USA
+        result->addHoliday(bdlt::Date(2011, 7,  4));
+
+        return 0;                                                     // RETURN
+    }
+    else {                                            // others not supported
+        return -1;                                                    // RETURN
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reloading Calendars from a Snapshot
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the calendars used by an application are served by a loader,
+// 'MyCalendarLoader', that is expensive to use (e.g., it queries a remote
+// database).  In this example, we snapshot two of those calendars so that
+// they can later be loaded without going back to the original source.
+//
+// First, we create the snapshot using the original loader:
+//..
+    MyCalendarLoader         sourceLoader;
+    bsl::vector<bsl::string> names;
+    names.push_back("US");
+    names.push_back("FR");
+
+    bsl::vector<char> snapshot;
+    int rc = bdlt::SnapshotCalendarLoader::createSnapshot(&snapshot,
+                                                          &sourceLoader,
+                                                          names);
+    ASSERT(0 == rc);
+//..
+// Typically, 'snapshot' would now be written to a file, and a later run of
+// the application would memory-map that file.  For the purposes of this
+// example, we use the vector directly.
+//
+// Then, we create a loader that serves calendars from the snapshot:
+//..
+    bdlt::SnapshotCalendarLoader loader(snapshot.data(), snapshot.size());
+    ASSERT(loader.isValid());
+    ASSERT(2 == loader.numCalendars());
+//..
+// Next, we load the "US" calendar and verify that it has the same value as
+// the one served by the original loader:
+//..
+    bdlt::PackedCalendar us;
+    rc = loader.load(&us, "US");
+    ASSERT(0 == rc);
+
+    bdlt::PackedCalendar expected;
+    rc = sourceLoader.load(&expected, "US");
+    ASSERT(0 == rc);
+    ASSERT(expected == us);
+//..
+// Finally, we observe that a calendar that is not in the snapshot is reported
+// as not found:
+//..
+    bdlt::PackedCalendar de;
+    rc = loader.load(&de, "DE");
+    ASSERT(1 == rc);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MALFORMED SNAPSHOTS
+        //   Ensure that malformed snapshots are detected.
+        //
+        // Concerns:
+        //: 1 A snapshot that is too short to hold its header or directory, or
+        //:   that has a corrupted header, results in an invalid loader that
+        //:   loads no calendar.
+        //:
+        //: 2 A directory entry that refers outside of the snapshot results in
+        //:   an invalid loader.
+        //:
+        //: 3 A corrupted calendar is reported by a negative status from
+        //:   'load', with no effect on the result.
+        //
+        // Plan:
+        //: 1 Create a valid snapshot, then create loaders over truncated and
+        //:   modified copies of it, and verify 'isValid', 'numCalendars', and
+        //:   the status returned by 'load'.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: Malformed snapshots are detected.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MALFORMED SNAPSHOTS" << endl
+                          << "===================" << endl;
+
+        TestLoader               source;
+        bsl::vector<bsl::string> names;
+        names.push_back("CAL-1");
+        names.push_back("CAL-2");
+
+        bsl::vector<char> snapshot;
+        ASSERT(0 == Obj::createSnapshot(&snapshot, &source, names));
+
+        {
+            const Obj X(snapshot.data(), snapshot.size());
+            ASSERT(X.isValid());
+            ASSERT(2 == X.numCalendars());
+        }
+
+        if (verbose) cout << "\tTruncated snapshots." << endl;
+        {
+            const bsl::size_t DIRECTORY_END = (3 + 2 * 4) * sizeof(int);
+
+            for (bsl::size_t length = 0; length < DIRECTORY_END; ++length) {
+                Obj mX(length ? snapshot.data() : 0, length);
+                const Obj& X = mX;
+
+                ASSERTV(length, !X.isValid());
+                ASSERTV(length, 0 == X.numCalendars());
+
+                bdlt::PackedCalendar calendar;
+                ASSERTV(length, 1 == mX.load(&calendar, "CAL-1"));
+            }
+
+            // The directory is intact, but the calendar data are not.
+
+            const Obj X(snapshot.data(), snapshot.size() - 1);
+            ASSERT(!X.isValid());
+        }
+
+        if (verbose) cout << "\tCorrupted header." << endl;
+        {
+            for (bsl::size_t i = 0; i < 3 * sizeof(int); ++i) {
+                bsl::vector<char> corrupt(snapshot);
+                corrupt[i] = static_cast<char>(corrupt[i] ^ 0x40);
+
+                const Obj X(corrupt.data(), corrupt.size());
+
+                ASSERTV(i, !X.isValid());
+                ASSERTV(i, 0 == X.numCalendars());
+            }
+        }
+
+        if (verbose) cout << "\tDirectory entry out of range." << endl;
+        {
+            for (int field = 0; field < 4; ++field) {
+                bsl::vector<char> corrupt(snapshot);
+
+                const int value = static_cast<int>(corrupt.size()) + 1;
+                bsl::memcpy(&corrupt[(3 + field) * sizeof(int)],
+                            &value,
+                            sizeof value);
+
+                const Obj X(corrupt.data(), corrupt.size());
+
+                ASSERTV(field, !X.isValid());
+            }
+        }
+
+        if (verbose) cout << "\tCorrupted calendar." << endl;
+        {
+            // Overwrite the magic number of the first calendar's data.
+
+            bsl::vector<char> corrupt(snapshot);
+
+            int dataOffset;
+            bsl::memcpy(&dataOffset, &corrupt[5 * sizeof(int)], sizeof(int));
+
+            corrupt[dataOffset] = static_cast<char>(corrupt[dataOffset] ^ 1);
+
+            Obj mX(corrupt.data(), corrupt.size());  const Obj& X = mX;
+            ASSERT(X.isValid());
+
+            bdlt::PackedCalendar expected;
+            ASSERT(0 == source.load(&expected, "CAL-2"));
+
+            bdlt::PackedCalendar calendar(expected);
+            ASSERT(0 >  mX.load(&calendar, "CAL-1"));
+            ASSERT(expected == calendar);
+
+            ASSERT(0 == mX.load(&calendar, "CAL-2"));
+            ASSERT(expected == calendar);
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'createSnapshot' AND 'load'
+        //   Ensure that calendars loaded from a snapshot have the value of the
+        //   calendars from which the snapshot was created.
+        //
+        // Concerns:
+        //: 1 Each calendar loaded from a snapshot has the same value as the
+        //:   one served by the source loader, including weekend-days
+        //:   transitions, holidays, and holiday codes.
+        //:
+        //: 2 Names are matched exactly, including names that are prefixes of
+        //:   other names.
+        //:
+        //: 3 A name that is not in the snapshot results in a status of 1 with
+        //:   no effect on the result.
+        //:
+        //: 4 Duplicate names are stored once.
+        //:
+        //: 5 'createSnapshot' returns the status of the first failed load.
+        //:
+        //: 6 'load' allocates memory only from the allocator of the result.
+        //:
+        //: 7 The snapshot need not be aligned.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a snapshot of all calendars served by 'TestLoader', with
+        //:   a duplicated name, copy it to an odd address, and verify each
+        //:   calendar loaded from the copy against 'TestLoader'.  (C-1..2, 4,
+        //:   6..7)
+        //:
+        //: 2 Verify the status of 'load' for names that are absent.  (C-3)
+        //:
+        //: 3 Verify the status of 'createSnapshot' when a name is not served
+        //:   by the source loader.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   int createSnapshot(vector<char> *, CalendarLoader *, names);
+        //   SnapshotCalendarLoader(const char *snapshot, size_t length);
+        //   virtual ~SnapshotCalendarLoader();
+        //   virtual int load(PackedCalendar *result, const char *name);
+        //   bool isValid() const;
+        //   int numCalendars() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'createSnapshot' AND 'load'" << endl
+                          << "===========================" << endl;
+
+        static const char *NAMES[] = { "CAL-2", "CAL-10", "EMPTY", "CAL-1",
+                                       "CAL-2" };
+        const int NUM_NAMES = static_cast<int>(sizeof NAMES / sizeof *NAMES);
+
+        TestLoader               source;
+        bsl::vector<bsl::string> names(NAMES, NAMES + NUM_NAMES);
+
+        bsl::vector<char> snapshot;
+        ASSERT(0 == Obj::createSnapshot(&snapshot, &source, names));
+
+        bsl::vector<char> buffer(snapshot.size() + 1);
+        bsl::memcpy(&buffer[1], snapshot.data(), snapshot.size());
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&buffer[1], snapshot.size());  const Obj& X = mX;
+
+        ASSERT(X.isValid());
+        ASSERT(4 == X.numCalendars());
+        ASSERT(0 == da.numBlocksTotal());
+
+        for (int ti = 0; ti < NUM_NAMES; ++ti) {
+            const char *NAME = NAMES[ti];
+
+            bdlt::PackedCalendar expected;
+            ASSERTV(NAME, 0 == source.load(&expected, NAME));
+
+            bdlt::PackedCalendar calendar(&oa);
+            ASSERTV(NAME, 0 == mX.load(&calendar, NAME));
+
+            if (veryVerbose) { T_ P_(NAME) P(calendar) }
+
+            ASSERTV(NAME, expected == calendar);
+        }
+
+        ASSERTV(da.numBlocksInUse(), 0 == da.numBlocksInUse());
+
+        {
+            static const char *ABSENT[] = { "", "CAL", "CAL-", "CAL-3",
+                                            "CAL-100", "ERROR", "ZZZ" };
+            const int NUM_ABSENT = static_cast<int>(sizeof ABSENT
+                                                    / sizeof *ABSENT);
+
+            bdlt::PackedCalendar expected;
+            ASSERT(0 == source.load(&expected, "CAL-1"));
+
+            for (int ti = 0; ti < NUM_ABSENT; ++ti) {
+                bdlt::PackedCalendar calendar(expected);
+
+                ASSERTV(ABSENT[ti], 1 == mX.load(&calendar, ABSENT[ti]));
+                ASSERTV(ABSENT[ti], expected == calendar);
+            }
+        }
+
+        if (verbose) cout << "\nAn empty snapshot." << endl;
+        {
+            bsl::vector<char> empty;
+            ASSERT(0 == Obj::createSnapshot(&empty,
+                                            &source,
+                                            bsl::vector<bsl::string>()));
+
+            Obj mY(empty.data(), empty.size());  const Obj& Y = mY;
+
+            ASSERT(Y.isValid());
+            ASSERT(0 == Y.numCalendars());
+
+            bdlt::PackedCalendar calendar;
+            ASSERT(1 == mY.load(&calendar, "CAL-1"));
+        }
+
+        if (verbose) cout << "\nFailure of the source loader." << endl;
+        {
+            bsl::vector<char> result;
+
+            names.push_back("ERROR");
+            ASSERT(-1 == Obj::createSnapshot(&result, &source, names));
+
+            names.back() = "UNKNOWN";
+            ASSERT( 1 == Obj::createSnapshot(&result, &source, names));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<char>        result;
+            bsl::vector<bsl::string> none;
+
+            ASSERT_PASS(Obj::createSnapshot(&result, &source, none));
+            ASSERT_FAIL(Obj::createSnapshot(      0, &source, none));
+            ASSERT_FAIL(Obj::createSnapshot(&result,       0, none));
+
+            bdlt::PackedCalendar calendar;
+
+            ASSERT_PASS(mX.load(&calendar, "CAL-1"));
+            ASSERT_FAIL(mX.load(        0, "CAL-1"));
+            ASSERT_FAIL(mX.load(&calendar,       0));
+
+            ASSERT_PASS(Obj(0, 0));
+            ASSERT_FAIL(Obj(0, 1));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a snapshot of one calendar, and load it back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        TestLoader               source;
+        bsl::vector<bsl::string> names(1, "CAL-1");
+
+        bsl::vector<char> snapshot;
+        ASSERT(0 == Obj::createSnapshot(&snapshot, &source, names));
+
+        Obj mX(snapshot.data(), snapshot.size());  const Obj& X = mX;
+        ASSERT(X.isValid());
+        ASSERT(1 == X.numCalendars());
+
+        bdlt::PackedCalendar calendar;
+        ASSERT(0 == mX.load(&calendar, "CAL-1"));
+        ASSERT(bdlt::Date(2000, 1,  1) == calendar.firstDate());
+        ASSERT(bdlt::Date(2000, 7,  4) == *calendar.beginHolidays());
+        ASSERT(1 == calendar.numHolidays());
+
+        ASSERT(1 == mX.load(&calendar, "CAL-2"));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
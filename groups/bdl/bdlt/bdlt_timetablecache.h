@@ -54,6 +54,17 @@ BSLS_IDENT("$Id: $")
 // an empty 'bsl::shared_ptr<const bdlt::Timetable>' is returned if the
 // requested timetable is found to have expired.
 //
+///Prefetching
+///-----------
+// An application that is known to need many timetables can load them into the
+// cache in bulk using the 'prefetch' manipulator, which loads each timetable
+// in a list of names that is not already present in the cache (as if by
+// 'getTimetable'), distributing the loads over a specified number of threads.
+// Timetables are loaded without holding the lock that guards the cache, so the
+// loads performed by separate threads proceed concurrently; consequently, the
+// loader supplied at construction must support concurrent calls to its 'load'
+// method if more than one thread is requested.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlt::TimetableCache' class is fully thread-safe (see
@@ -248,6 +259,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_map.h>
 #include <bsl_memory.h>  // 'bsl::shared_ptr'
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bdlt {
@@ -436,6 +448,21 @@ class TimetableCache {
         // via earlier calls to the 'getTimetable' and 'lookupTimetable'
         // methods, until all of those references have been destroyed.
 
+    int prefetch(const bsl::vector<bsl::string>& timetableNames,
+                 int                             numThreads = 1);
+        // Load into this timetable cache, using the loader that was supplied
+        // at construction, each timetable identified by the specified
+        // 'timetableNames' that is not already present in the cache or that
+        // has expired (i.e., per a timeout optionally supplied at
+        // construction), distributing the loads over at most the optionally
+        // specified 'numThreads' threads, including the calling thread.
+        // Return the number of elements of 'timetableNames' for which the
+        // loader failed.  The behavior is undefined unless '0 < numThreads',
+        // and the loader supports concurrent calls to 'load' if
+        // '1 < numThreads'.  Note that fewer than 'numThreads' threads are
+        // used if 'timetableNames' has fewer than 'numThreads' elements or if
+        // a thread cannot be created.
+
     // ACCESSORS
     bsl::shared_ptr<const Timetable>
     lookupTimetable(const char *timetableName) const;
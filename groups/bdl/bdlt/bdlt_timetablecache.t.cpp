@@ -27,6 +27,8 @@
 #include <bsl_cstdlib.h>    // 'atoi'
 #include <bsl_cstring.h>    // 'strcmp'
 #include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_WINDOWS
 #include <windows.h>
@@ -76,11 +78,12 @@ using namespace bsl;
 // [ 3] shared_ptr<const Timetable> getTimetable(const char *name);
 // [ 4] int invalidate(const char *name);
 // [ 4] int invalidateAll();
+// [ 7] int prefetch(const vector<string>& names, int numThreads = 1);
 // [ 3] shared_ptr<const Timetable> lookupTimetable(const char *n) const;
 // [ 3] Datetime lookupLoadTime(const char *name) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [ *] CONCERN: Precondition violations are detected when enabled.
 // [ 5] CONCERN: All memory allocation is exception neutral.
@@ -736,7 +739,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -936,6 +939,110 @@ int main(int argc, char *argv[])
 //..
         }
 
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'prefetch'
+        //   Ensure that 'prefetch' loads each requested timetable.
+        //
+        // Concerns:
+        //: 1 'prefetch' loads into the cache each timetable that the loader
+        //:   supports, for any number of threads.
+        //:
+        //: 2 'prefetch' returns the number of names for which the loader
+        //:   failed.
+        //:
+        //: 3 A timetable that is already present in the cache is not reloaded.
+        //:
+        //: 4 A name that occurs more than once is loaded at most once.
+        //:
+        //: 5 An empty list of names has no effect.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a range of thread counts, prefetch a list of names, some of
+        //:   which are not supported by the loader, into an empty cache and
+        //:   verify the return value and that each supported timetable can then
+        //:   be retrieved with 'lookupTimetable'.  (C-1..2, 4)
+        //:
+        //: 2 Prefetch the same list again and verify that the timetables
+        //:   retrieved before and after are the same objects.  (C-3)
+        //:
+        //: 3 Prefetch an empty list and verify that the cache is unchanged.
+        //:   (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a non-positive number of threads.  (C-6)
+        //
+        // Testing:
+        //   int prefetch(const vector<string>& names, int numThreads = 1);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'prefetch'" << endl
+                          << "==========" << endl;
+
+        TestLoader loader;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::string> names;
+        names.push_back("CAL-1");
+        names.push_back("ERROR");
+        names.push_back("CAL-2");
+        names.push_back("CAL-1");
+        names.push_back("UNKNOWN");
+        names.push_back("CAL-3");
+
+        const int THREADS[] = { 1, 2, 3, 4, 16 };
+        const int NUM_THREADS = static_cast<int>(sizeof THREADS
+                                                 / sizeof *THREADS);
+
+        for (int ti = 0; ti < NUM_THREADS; ++ti) {
+            const int NT = THREADS[ti];
+
+            if (veryVerbose) { T_ P(NT) }
+
+            Obj mX(&loader, &sa);  const Obj& X = mX;
+
+            ASSERTV(NT, 2 == mX.prefetch(names, NT));
+
+            Entry e1 = X.lookupTimetable("CAL-1");
+            Entry e2 = X.lookupTimetable("CAL-2");
+            Entry e3 = X.lookupTimetable("CAL-3");
+
+            ASSERTV(NT, e1.get() && e1->firstDate() == gFirstDate1);
+            ASSERTV(NT, e2.get() && e2->firstDate() == gFirstDate2);
+            ASSERTV(NT, e3.get() && e3->firstDate() == gFirstDate3);
+
+            ASSERTV(NT, !X.lookupTimetable("ERROR").get());
+            ASSERTV(NT, !X.lookupTimetable("UNKNOWN").get());
+
+            ASSERTV(NT, 2 == mX.prefetch(names, NT));
+
+            ASSERTV(NT, e1.get() == X.lookupTimetable("CAL-1").get());
+            ASSERTV(NT, e2.get() == X.lookupTimetable("CAL-2").get());
+            ASSERTV(NT, e3.get() == X.lookupTimetable("CAL-3").get());
+
+            ASSERTV(NT, 0 == mX.prefetch(bsl::vector<bsl::string>(), NT));
+
+            ASSERTV(NT, e1.get() == X.lookupTimetable("CAL-1").get());
+
+            ASSERTV(NT, 3 == mX.invalidateAll());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&loader, &sa);
+
+            ASSERT_PASS(mX.prefetch(names,  1));
+            ASSERT_FAIL(mX.prefetch(names,  0));
+            ASSERT_FAIL(mX.prefetch(names, -1));
+        }
+
       } break;
       case 6: {
         // --------------------------------------------------------------------
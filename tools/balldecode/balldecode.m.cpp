@@ -0,0 +1,177 @@
+// balldecode.m.cpp                                                   -*-C++-*-
+
+// ----------------------------------------------------------------------------
+//                                   NOTICE
+//
+// This program is a tool, not a component: it is built on its own (see
+// 'README.md') and is not part of any package group.
+// ----------------------------------------------------------------------------
+
+//@PURPOSE: Render binary log segments as text.
+//
+//@DESCRIPTION: This program decodes the segment files written by a
+// 'ball::BinaryFileObserver' and writes the records they hold to 'stdout',
+// formatted by a 'ball::RecordStringFormatter'.  The segments are processed
+// in the order in which they are specified on the command line, and the
+// records of each segment are written in the order in which they were
+// published.  A segment that cannot be read, or that holds an invalid frame,
+// is reported on 'stderr' (after the records preceding the invalid frame
+// have been written), and the program then returns a non-zero status.
+//
+///Usage
+///-----
+//..
+//  balldecode [-f format] [-l] segment...
+//..
+// The '-f' option specifies the format used to render each record (see
+// 'ball_recordstringformatter'); if it is not given, the default format of
+// 'ball::RecordStringFormatter' is used.  The '-l' option renders timestamps
+// in local time rather than in UTC.  For example:
+//..
+//  balldecode -f '%d %t %s %c %m %u\n' /var/log/myapp.binlog.*
+//..
+
+#include <ball_binarylogutil.h>
+#include <ball_record.h>
+#include <ball_recordstringformatter.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bdls_filesystemutil.h>
+#include <bdls_memoryutil.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+void usage(const char *program)
+    // Print the command-line usage of the specified 'program' to 'stderr'.
+{
+    bsl::fprintf(stderr, "usage: %s [-f format] [-l] segment...\n", program);
+}
+
+void printRecord(const ball::RecordStringFormatter& formatter,
+                 const ball::Record&                record)
+    // Write the specified 'record', formatted by the specified 'formatter',
+    // to 'stdout'.
+{
+    formatter(bsl::cout, record);
+}
+
+int decodeFile(const char                         *path,
+               const ball::RecordStringFormatter&  formatter)
+    // Write the records of the segment file having the specified 'path',
+    // formatted by the specified 'formatter', to 'stdout'.  Return 0 on
+    // success, and a non-zero value otherwise.
+{
+    typedef bdls::FilesystemUtil FileUtil;
+
+    const FileUtil::Offset size = FileUtil::getFileSize(path);
+
+    FileUtil::FileDescriptor fd = FileUtil::open(path,
+                                                 FileUtil::e_OPEN,
+                                                 FileUtil::e_READ_ONLY);
+    if (FileUtil::k_INVALID_FD == fd) {
+        bsl::fprintf(stderr, "%s: cannot open\n", path);
+        return -1;                                                    // RETURN
+    }
+
+    void *segment = 0;
+
+    if (0 >= size
+     || 0 != FileUtil::map(fd,
+                           &segment,
+                           0,
+                           static_cast<bsl::size_t>(size),
+                           bdls::MemoryUtil::k_ACCESS_READ)) {
+        bsl::fprintf(stderr, "%s: cannot map\n", path);
+        FileUtil::close(fd);
+        return -1;                                                    // RETURN
+    }
+
+    using bdlf::PlaceHolders::_1;
+
+    const int rc = ball::BinaryLogUtil::decodeSegment(
+                           static_cast<const char *>(segment),
+                           static_cast<bsl::size_t>(size),
+                           bdlf::BindUtil::bind(&printRecord,
+                                                bsl::cref(formatter),
+                                                _1));
+    bsl::cout.flush();
+
+    if (0 > rc) {
+        bsl::fprintf(stderr, "%s: invalid segment\n", path);
+    }
+
+    FileUtil::unmap(segment, static_cast<bsl::size_t>(size));
+    FileUtil::close(fd);
+
+    return 0 > rc ? rc : 0;
+}
+
+}  // close unnamed namespace
+
+int main(int argc, char *argv[])
+{
+    const char *format      = 0;
+    bool        isLocalTime = false;
+    int         i           = 1;
+
+    for (; i < argc && '-' == argv[i][0]; ++i) {
+        if (0 == bsl::strcmp(argv[i], "-f") && i + 1 < argc) {
+            format = argv[++i];
+        }
+        else if (0 == bsl::strcmp(argv[i], "-l")) {
+            isLocalTime = true;
+        }
+        else {
+            usage(argv[0]);
+            return 1;                                                 // RETURN
+        }
+    }
+
+    if (i == argc) {
+        usage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    ball::RecordStringFormatter formatter;
+
+    if (format) {
+        formatter.setFormat(format);
+    }
+    if (isLocalTime) {
+        formatter.enablePublishInLocalTime();
+    }
+
+    int status = 0;
+
+    for (; i < argc; ++i) {
+        if (0 != decodeFile(argv[i], formatter)) {
+            status = 2;
+        }
+    }
+
+    return status;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------